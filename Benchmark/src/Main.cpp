@@ -0,0 +1,35 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include <HighLo.h>
+
+#include "benchmarks/BenchmarkUtils.h"
+#include "benchmarks/AnimationBenchmarks.h"
+#include "benchmarks/AssetLoadingBenchmarks.h"
+#include "benchmarks/DocumentBenchmarks.h"
+#include "benchmarks/StringBenchmarks.h"
+#include "benchmarks/NameBenchmarks.h"
+#include "benchmarks/UUIDBenchmarks.h"
+#include "benchmarks/Base64Benchmarks.h"
+#include "benchmarks/EncryptionBenchmarks.h"
+#include "benchmarks/SortingBenchmarks.h"
+#include "benchmarks/QueueBenchmarks.h"
+#include "benchmarks/VectorBenchmarks.h"
+#include "benchmarks/OrderedMapBenchmarks.h"
+
+int main(int argc, char *argv[])
+{
+	// Optionally only run the benchmarks that contain the given filter in their name
+	const char *filter = argc > 1 ? argv[1] : nullptr;
+
+	for (const BenchmarkEntry &benchmark : GetBenchmarks())
+	{
+		if (filter && !strstr(benchmark.Name, filter))
+			continue;
+
+		std::cout << benchmark.Name << std::endl;
+		benchmark.Function();
+	}
+
+	return 0;
+}
+
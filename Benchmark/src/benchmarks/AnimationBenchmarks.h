@@ -0,0 +1,183 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//     - 1.2 (2026-10-19) Added skinning palette benchmark
+//     - 1.1 (2026-10-19) Added compressed clip and animation controller benchmarks
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include "Engine/Renderer/AnimationClip.h"
+#include "Engine/Renderer/AnimationController.h"
+#include "Engine/Renderer/SkinningPalette.h"
+
+static Bone CreateBenchmarkBone(uint32 &nextID, uint32 depth, uint32 keyframeCount)
+{
+	Bone bone;
+	bone.ID = nextID++;
+	bone.Name = HLString::ToString(bone.ID);
+
+	for (uint32 i = 0; i < keyframeCount; ++i)
+	{
+		float t = (float)i / (float)keyframeCount;
+
+		Keyframe keyframe;
+		keyframe.Timestamp = (float)i;
+		keyframe.Transform.Translation = glm::vec3(t, 1.0f - t, 0.5f * t);
+		keyframe.Transform.Rotation = glm::angleAxis(t * HL_TWO_PI, glm::normalize(glm::vec3(1.0f, t, 0.25f)));
+		bone.Keyframes.push_back(keyframe);
+	}
+
+	// A binary hierarchy, which is close to the branching factor of common humanoid rigs
+	if (depth > 0)
+	{
+		bone.Children.push_back(CreateBenchmarkBone(nextID, depth - 1, keyframeCount));
+		bone.Children.push_back(CreateBenchmarkBone(nextID, depth - 1, keyframeCount));
+	}
+
+	return bone;
+}
+
+HL_BENCHMARK(AnimationPoseEvaluation)
+{
+	const uint32 keyframeCount = 120;
+	const uint32 instanceCount = 1024;
+
+	uint32 boneCount = 0;
+	Bone rootBone = CreateBenchmarkBone(boneCount, 6, keyframeCount);
+	Ref<Animation> animation = Animation::Create("Benchmark", (float)keyframeCount, 30.0f, glm::mat4(1.0f), boneCount, rootBone, glm::mat4(1.0f));
+
+	std::vector<AnimationPose> poses(instanceCount);
+	std::vector<AnimationEvaluationRequest> requests(instanceCount);
+	for (uint32 i = 0; i < instanceCount; ++i)
+	{
+		poses[i].Time = (float)(i % keyframeCount);
+		requests[i] = { animation.Get(), &poses[i] };
+	}
+
+	auto advance = [&poses, keyframeCount]()
+	{
+		for (AnimationPose &pose : poses)
+		{
+			pose.Time += 0.5f;
+			if (pose.Time >= (float)keyframeCount)
+				pose.Time = 0.0f;
+		}
+	};
+
+	double totalBones = (double)boneCount * (double)instanceCount;
+
+	double singleThreaded = MeasureMilliseconds(20, [&]()
+	{
+		advance();
+		for (AnimationPose &pose : poses)
+			animation->EvaluatePose(pose);
+	});
+	ReportBenchmark("EvaluatePose (single thread)", singleThreaded, totalBones, "bones");
+
+	double batched = MeasureMilliseconds(20, [&]()
+	{
+		advance();
+		Animation::EvaluatePoses(requests);
+	});
+	ReportBenchmark("EvaluatePoses (thread pool)", batched, totalBones, "bones");
+}
+
+HL_BENCHMARK(AnimationClipCompression)
+{
+	const uint32 keyframeCount = 120;
+	const uint32 instanceCount = 256;
+
+	uint32 boneCount = 0;
+	Bone rootBone = CreateBenchmarkBone(boneCount, 6, keyframeCount);
+	Ref<Animation> animation = Animation::Create("Benchmark", (float)keyframeCount, 30.0f, glm::mat4(1.0f), boneCount, rootBone, glm::mat4(1.0f));
+	Ref<AnimationClip> clip = AnimationClip::Create(*animation);
+
+	double rawSize = (double)animation->GetSkeleton().KeyTimestamps.size() * sizeof(Keyframe);
+	std::cout << "    raw keyframes: " << (uint64)rawSize << " bytes, compressed clip: " << clip->GetMemorySize() << " bytes ("
+		<< std::setprecision(2) << rawSize / (double)clip->GetMemorySize() << "x), keyframes: "
+		<< animation->GetSkeleton().KeyTimestamps.size() << " -> " << clip->GetKeyframeCount() << std::endl;
+
+	std::vector<std::vector<uint32>> cursors(instanceCount);
+	AnimationLocalPose localPose;
+	float time = 0.0f;
+
+	double totalBones = (double)boneCount * (double)instanceCount;
+
+	double raw = MeasureMilliseconds(20, [&]()
+	{
+		time = time + 0.5f >= (float)keyframeCount ? 0.0f : time + 0.5f;
+		for (uint32 i = 0; i < instanceCount; ++i)
+			animation->SampleLocalPose(time, cursors[i], localPose);
+	});
+	ReportBenchmark("Animation::SampleLocalPose", raw, totalBones, "bones");
+
+	double compressed = MeasureMilliseconds(20, [&]()
+	{
+		time = time + 0.5f >= (float)keyframeCount ? 0.0f : time + 0.5f;
+		for (uint32 i = 0; i < instanceCount; ++i)
+			clip->SampleLocalPose(time, cursors[i], localPose);
+	});
+	ReportBenchmark("AnimationClip::SampleLocalPose", compressed, totalBones, "bones");
+
+	Ref<AnimationController> controller = AnimationController::Create(animation);
+	uint32 baseLayer = controller->AddLayer();
+	uint32 additiveLayer = controller->AddLayer(AnimationLayerBlendMode::Additive, 0.5f);
+	controller->PlayBlendTree(baseLayer, { { clip, 0.0f }, { clip, 1.0f } });
+	controller->SetBlendParameter(baseLayer, 0.5f);
+	controller->Play(additiveLayer, clip);
+
+	double blended = MeasureMilliseconds(100, [&]()
+	{
+		controller->Update(1.0f / 60.0f);
+		controller->Evaluate();
+	});
+	ReportBenchmark("AnimationController (blend tree + additive)", blended, (double)boneCount, "bones");
+}
+
+HL_BENCHMARK(SkinningPalettePacking)
+{
+	const uint32 keyframeCount = 120;
+	const uint32 instanceCount = 1024;
+
+	uint32 boneCount = 0;
+	Bone rootBone = CreateBenchmarkBone(boneCount, 5, keyframeCount);
+	Ref<Animation> animation = Animation::Create("Benchmark", (float)keyframeCount, 30.0f, glm::mat4(1.0f), boneCount, rootBone, glm::mat4(1.0f));
+	animation->Play();
+
+	// The previous path copied the full bone array for every instance
+	std::vector<glm::mat4> fullPalette((uint64)instanceCount * HL_MAX_SKELETAL_BONES);
+	double full = MeasureMilliseconds(20, [&]()
+	{
+		glm::mat4 *boneTransforms = animation->GetCurrentPoseTransforms();
+		for (uint32 i = 0; i < instanceCount; ++i)
+			memcpy(&fullPalette[(uint64)i * HL_MAX_SKELETAL_BONES], boneTransforms, HL_MAX_SKELETAL_BONES * sizeof(glm::mat4));
+	});
+	ReportBenchmark("Full bone arrays", full, (double)instanceCount, "instances");
+
+	SkinningPalette palette;
+	double packed = MeasureMilliseconds(20, [&]()
+	{
+		glm::mat4 *boneTransforms = animation->GetCurrentPoseTransforms();
+
+		palette.Begin();
+		for (uint32 i = 0; i < instanceCount; ++i)
+			palette.Add(boneTransforms, boneCount, 0, 0);
+	});
+	ReportBenchmark("SkinningPalette (used bones only)", packed, (double)instanceCount, "instances");
+
+	std::cout << "    palette size: " << (uint64)fullPalette.size() * sizeof(glm::mat4) << " bytes -> " << (uint64)palette.GetBoneCount() * sizeof(glm::mat4) << " bytes" << std::endl;
+
+	// A paused animation must not re-evaluate its pose
+	animation->Pause();
+	double paused = MeasureMilliseconds(1000, [&]()
+	{
+		animation->GetCurrentPoseTransforms();
+	});
+	ReportBenchmark("Paused GetCurrentPoseTransforms", paused, 1.0, "calls");
+}
+
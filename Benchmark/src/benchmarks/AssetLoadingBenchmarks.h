@@ -0,0 +1,413 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//     - 1.1 (2026-10-19) Added cooked mesh benchmark
+//     - 1.2 (2026-10-19) Added asset registry lookup benchmark
+//     - 1.3 (2026-10-19) Added asset directory scan benchmark
+//     - 1.4 (2026-10-19) Added derived data cache benchmark
+//     - 1.5 (2026-10-19) The asset decoding benchmark also measures the finalize step
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <filesystem>
+
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Loaders/AssetImporter.h"
+#include "Engine/Loaders/CookedMeshLoader.h"
+#include "Engine/Loaders/TextureLoader.h"
+#include "Engine/ThirdParty/Assimp/AssimpMeshLoader.h"
+
+/// <summary>
+/// Returns the assets directory of the Sponza demo, it can be overridden with the HL_BENCHMARK_ASSET_DIR environment variable.
+/// </summary>
+static std::filesystem::path GetBenchmarkAssetDirectory()
+{
+	const char *overrideDir = std::getenv("HL_BENCHMARK_ASSET_DIR");
+	return overrideDir ? overrideDir : "../../../../Demos/SponzaSceneDemo/assets";
+}
+
+/// <summary>
+/// Creates a hidden window with a renderer, so that the GPU resources of the assets can be created.
+/// The renderer loads its shaders relative to the working directory, so nullptr is returned, if the benchmark has not been started from the HighLo directory.
+/// </summary>
+static UniqueRef<Window> InitBenchmarkRenderer()
+{
+	if (!std::filesystem::exists("assets/shaders/HighLoPBR.glsl"))
+		return nullptr;
+
+	WindowData data(false, 1270, 720, "HighLoBenchmark");
+	data.Visible = false;
+	data.VSync = false;
+
+	UniqueRef<Window> window = Window::Create(data);
+	Renderer::Init(window.Get());
+	Renderer::WaitAndRender();
+	return window;
+}
+
+/// <summary>
+/// Collects all assets of the Sponza demo that have a decode step.
+/// </summary>
+static std::vector<AssetMetaData> CollectBenchmarkAssets()
+{
+	std::filesystem::path assetDir = GetBenchmarkAssetDirectory();
+
+	std::vector<AssetMetaData> assets;
+	if (!std::filesystem::exists(assetDir))
+		return assets;
+
+	for (const auto &entry : std::filesystem::recursive_directory_iterator(assetDir))
+	{
+		if (!entry.is_regular_file())
+			continue;
+
+		AssetMetaData metaData;
+		metaData.Handle = AssetHandle();
+		metaData.FilePath = FileSystemPath(entry.path().string());
+		metaData.Type = AssetManager::Get()->GetAssetTypeFromPath(metaData.FilePath);
+
+		if (metaData.Type == AssetType::Texture || metaData.Type == AssetType::StaticMesh || metaData.Type == AssetType::DynamicMesh)
+			assets.push_back(metaData);
+	}
+
+	return assets;
+}
+
+HL_BENCHMARK(AssetDecoding)
+{
+	std::vector<AssetMetaData> assets = CollectBenchmarkAssets();
+	if (assets.empty())
+	{
+		std::cout << "    No assets found, set HL_BENCHMARK_ASSET_DIR to the assets directory of the Sponza demo" << std::endl;
+		return;
+	}
+
+	const uint32 assetCount = (uint32)assets.size();
+	std::cout << "    " << assetCount << " assets, " << ThreadPool::Get().GetThreadCount() << " worker threads" << std::endl;
+
+	std::vector<AssetLoadData> results(assetCount);
+	auto releaseResults = [&results]()
+	{
+		for (AssetLoadData &data : results)
+			data.Release();
+	};
+
+	// Decoding everything on one thread corresponds to the previous synchronous GetAsset path without the GPU upload
+	double sequentialMs = MeasureMilliseconds(3, [&]()
+	{
+		for (uint32 i = 0; i < assetCount; ++i)
+			AssetImporter::TryDecodeData(assets[i], results[i]);
+
+		releaseResults();
+	});
+	ReportBenchmark("Decode sequential", sequentialMs, (double)assetCount, "assets");
+
+	double parallelMs = MeasureMilliseconds(3, [&]()
+	{
+		ThreadPool::Get().ParallelFor(assetCount, 1, [&](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+				AssetImporter::TryDecodeData(assets[i], results[i]);
+		});
+
+		releaseResults();
+	});
+	ReportBenchmark("Decode on the thread pool", parallelMs, (double)assetCount, "assets");
+
+	// The largest single asset bounds the time until everything is decoded, no matter how many workers there are
+	double slowestMs = 0.0;
+	for (uint32 i = 0; i < assetCount; ++i)
+	{
+		double ms = MeasureMilliseconds(1, [&]()
+		{
+			AssetImporter::TryDecodeData(assets[i], results[i]);
+			results[i].Release();
+		});
+
+		slowestMs = HL_MAX(slowestMs, ms);
+	}
+	ReportBenchmark("Slowest single asset", slowestMs);
+
+	// Finalizing creates the GPU resources on the main thread, so the slowest finalize is the longest stall of a frame
+	UniqueRef<Window> window = InitBenchmarkRenderer();
+	if (!window)
+	{
+		std::cout << "    Finalize skipped, start the benchmark from the HighLo directory to create the GPU resources" << std::endl;
+		return;
+	}
+
+	const uint32 finalizeRounds = 3;
+	std::vector<Ref<Asset>> finalized(assetCount);
+	double finalizeMs = 0.0;
+	double slowestFinalizeMs = 0.0;
+
+	for (uint32 round = 0; round < finalizeRounds; ++round)
+	{
+		ThreadPool::Get().ParallelFor(assetCount, 1, [&](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+				AssetImporter::TryDecodeData(assets[i], results[i]);
+		});
+
+		for (uint32 i = 0; i < assetCount; ++i)
+		{
+			// The render commands are flushed right away, so that the upload is part of the measurement
+			auto start = std::chrono::steady_clock::now();
+			AssetImporter::TryFinalizeData(assets[i], results[i], finalized[i]);
+			Renderer::WaitAndRender();
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			finalizeMs += ms;
+			slowestFinalizeMs = HL_MAX(slowestFinalizeMs, ms);
+		}
+
+		releaseResults();
+		finalized.assign(assetCount, nullptr);
+	}
+
+	ReportBenchmark("Finalize on the main thread", finalizeMs / (double)finalizeRounds, (double)assetCount, "assets");
+	ReportBenchmark("Slowest single finalize", slowestFinalizeMs);
+
+	Renderer::Shutdown();
+}
+
+HL_BENCHMARK(CookedMeshLoading)
+{
+	std::vector<AssetMetaData> meshes;
+	for (const AssetMetaData &metaData : CollectBenchmarkAssets())
+	{
+		if (metaData.Type != AssetType::Texture)
+			meshes.push_back(metaData);
+	}
+
+	if (meshes.empty())
+	{
+		std::cout << "    No meshes found, set HL_BENCHMARK_ASSET_DIR to the assets directory of the Sponza demo" << std::endl;
+		return;
+	}
+
+	// The cooked files are written into the derived data cache of the demo, when it loads the meshes for the first time
+	DerivedDataCache::Get()->Init(FileSystemPath((GetBenchmarkAssetDirectory() / "cache" / "derived").string()), 0);
+
+	// Both sides only measure the CPU work, creating the GPU buffers costs the same for both paths
+	for (const AssetMetaData &mesh : meshes)
+	{
+		const HLString &fileName = mesh.FilePath.Filename();
+		std::cout << "    " << *fileName << std::endl;
+
+		double importMs = MeasureMilliseconds(1, [&]()
+		{
+			Assimp::Importer importer;
+			importer.ReadFile(*mesh.FilePath.String(), AssimpMeshLoader::MeshImportFlags);
+		});
+		ReportBenchmark("Assimp import", importMs);
+
+		DerivedDataKey cookedKey;
+		if (!CookedMeshLoader::GetCacheKey(mesh.FilePath, cookedKey) || !DerivedDataCache::Get()->Contains(cookedKey))
+		{
+			std::cout << "    No up to date cooked file, load the mesh once in the Sponza demo to cook it" << std::endl;
+			continue;
+		}
+
+		FileSystemPath cookedPath = DerivedDataCache::Get()->GetEntryPath(cookedKey);
+
+		double cookedMs = MeasureMilliseconds(10, [&]()
+		{
+			CookedMeshData data;
+			CookedMeshData::Read(cookedPath, data);
+			data.Release();
+		});
+		ReportBenchmark("Cooked read", cookedMs);
+	}
+
+	DerivedDataCache::Get()->Shutdown();
+}
+
+HL_BENCHMARK(DerivedDataCacheTextures)
+{
+	std::vector<AssetMetaData> textures;
+	for (const AssetMetaData &metaData : CollectBenchmarkAssets())
+	{
+		if (metaData.Type == AssetType::Texture)
+			textures.push_back(metaData);
+	}
+
+	if (textures.empty())
+	{
+		std::cout << "    No textures found, set HL_BENCHMARK_ASSET_DIR to the assets directory of the Sponza demo" << std::endl;
+		return;
+	}
+
+	const uint32 textureCount = (uint32)textures.size();
+	auto loadAll = [&textures]()
+	{
+		for (const AssetMetaData &texture : textures)
+		{
+			Allocator pixels;
+			uint32 width, height;
+			TextureLoader::LoadRGBA(texture.FilePath, false, pixels, width, height);
+			pixels.Release();
+		}
+	};
+
+	// Without an opened cache every texture is decoded
+	double decodeMs = MeasureMilliseconds(1, loadAll);
+	ReportBenchmark("Decode without cache", decodeMs, (double)textureCount, "textures");
+
+	FileSystemPath cacheDirectory = FileSystemPath("DerivedDataBenchmark/");
+	DerivedDataCache::Get()->Init(cacheDirectory, 0);
+
+	double fillMs = MeasureMilliseconds(1, loadAll);
+	ReportBenchmark("Decode and store", fillMs, (double)textureCount, "textures");
+
+	double hitMs = MeasureMilliseconds(3, loadAll);
+	ReportBenchmark("Read from cache", hitMs, (double)textureCount, "textures");
+
+	DerivedDataStats stats = DerivedDataCache::Get()->GetStats();
+	std::cout << "    " << stats.EntryCount << " entries, " << (stats.TotalSize / (1024 * 1024)) << " MB, " << stats.Hits << " hits, " << stats.Misses << " misses" << std::endl;
+
+	DerivedDataCache::Get()->Shutdown();
+
+	std::error_code error;
+	std::filesystem::remove_all(*cacheDirectory.String(), error);
+}
+
+HL_BENCHMARK(AssetRegistryLookup)
+{
+	const uint32 assetCount = 100000;
+	const uint32 linearLookupCount = 1000;
+
+	AssetRegistry registry;
+	std::vector<AssetHandle> handles;
+	std::vector<FileSystemPath> paths;
+	handles.reserve(assetCount);
+	paths.reserve(assetCount);
+
+	for (uint32 i = 0; i < assetCount; ++i)
+	{
+		AssetMetaData metaData;
+		metaData.Handle = AssetHandle();
+		metaData.FilePath = FileSystemPath(fmt::format("textures/group_{0}/texture_{1}.png", i % 64, i));
+		metaData.Type = AssetType::Texture;
+
+		registry.Add(metaData.FilePath, metaData);
+		handles.push_back(metaData.Handle);
+		paths.push_back(metaData.FilePath);
+	}
+
+	// The previous lookup by handle walked over all entries of the registry
+	double linearMs = MeasureMilliseconds(1, [&]()
+	{
+		uint64 found = 0;
+		for (uint32 i = 0; i < linearLookupCount; ++i)
+		{
+			AssetHandle handle = handles[(i * 7919) % assetCount];
+			for (auto it = registry.cbegin(); it != registry.cend(); ++it)
+			{
+				if (it->second.Handle == handle)
+				{
+					++found;
+					break;
+				}
+			}
+		}
+		HL_ASSERT(found == linearLookupCount);
+	});
+	ReportBenchmark("Handle lookup, linear scan", linearMs, (double)linearLookupCount, "lookups");
+
+	double handleMs = MeasureMilliseconds(10, [&]()
+	{
+		uint64 found = 0;
+		for (AssetHandle handle : handles)
+			found += registry.Contains(handle);
+		HL_ASSERT(found == assetCount);
+	});
+	ReportBenchmark("Handle lookup, indexed", handleMs, (double)assetCount, "lookups");
+
+	// The previous lookup by path normalized the path again for every call
+	double normalizeMs = MeasureMilliseconds(1, [&]()
+	{
+		for (uint32 i = 0; i < linearLookupCount; ++i)
+			paths[i].LexicallyNormal();
+	});
+	ReportBenchmark("Path key, normalized per lookup", normalizeMs, (double)linearLookupCount, "lookups");
+
+	double pathMs = MeasureMilliseconds(10, [&]()
+	{
+		uint64 found = 0;
+		for (const FileSystemPath &path : paths)
+			found += registry.Contains(path);
+		HL_ASSERT(found == assetCount);
+	});
+	ReportBenchmark("Path lookup, lexical key", pathMs, (double)assetCount, "lookups");
+
+	double workerMs = MeasureMilliseconds(10, [&]()
+	{
+		ThreadPool::Get().ParallelFor(assetCount, 1024, [&](uint32 begin, uint32 end)
+		{
+			AssetMetaData metaData;
+			for (uint32 i = begin; i < end; ++i)
+				registry.TryGet(handles[i], metaData);
+		});
+	});
+	ReportBenchmark("Handle lookup from the thread pool", workerMs, (double)assetCount, "lookups");
+}
+
+static uint32 CountFilesSequential(const FileSystemPath &directory)
+{
+	uint32 count = 0;
+	for (const File &entry : directory.GetFileList())
+		count += entry.IsFile ? 1 : CountFilesSequential(entry.FullPath);
+
+	return count;
+}
+
+HL_BENCHMARK(AssetDirectoryScan)
+{
+	std::filesystem::path assetDir = GetBenchmarkAssetDirectory();
+	if (!std::filesystem::exists(assetDir))
+	{
+		std::cout << "    No assets found, set HL_BENCHMARK_ASSET_DIR to the assets directory of a project" << std::endl;
+		return;
+	}
+
+	FileSystemPath rootDirectory = FileSystemPath(assetDir.string());
+	FileSystemPath manifestPath = FileSystemPath("AssetManifestBenchmark.hlcache");
+
+	uint32 fileCount = 0;
+	double sequentialMs = MeasureMilliseconds(3, [&]()
+	{
+		fileCount = CountFilesSequential(rootDirectory);
+	});
+	ReportBenchmark("Sequential walk with GetFileList", sequentialMs, (double)fileCount, "files");
+
+	// Without a manifest every file has to be hashed
+	double coldMs = MeasureMilliseconds(3, [&]()
+	{
+		AssetDirectoryScanner scanner;
+		scanner.Scan(rootDirectory);
+	});
+	ReportBenchmark("Parallel scan, no manifest", coldMs, (double)fileCount, "files");
+
+	AssetDirectoryScanner scanner;
+	scanner.Scan(rootDirectory);
+	scanner.WriteManifest(manifestPath);
+
+	double warmMs = MeasureMilliseconds(3, [&]()
+	{
+		AssetDirectoryScanner warmScanner;
+		warmScanner.LoadManifest(manifestPath);
+		warmScanner.Scan(rootDirectory);
+	});
+	ReportBenchmark("Parallel scan, unchanged manifest", warmMs, (double)fileCount, "files");
+
+	const AssetScanReport &report = scanner.GetReport();
+	std::cout << "    " << report.FileCount << " files in " << report.DirectoryCount << " directories, " << (report.HashedBytes / 1024) << " KB hashed without a manifest" << std::endl;
+
+	FileSystem::Get()->RemoveFile(manifestPath);
+}
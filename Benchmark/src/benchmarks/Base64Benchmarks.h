@@ -0,0 +1,212 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <random>
+
+// The previous implementation, that appended every character to the result and looked the characters up with HLString::IndexOf
+static const HLString s_LegacyBase64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static HLString LegacyBase64Encode(const Byte *buffer, uint32 bufferLength)
+{
+	HLString result;
+	int32 i = 0;
+	Byte char_array_3[3];
+	Byte char_array_4[4];
+
+	while (bufferLength--)
+	{
+		char_array_3[i++] = *(buffer++);
+		if (i == 3)
+		{
+			char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
+			char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
+			char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
+			char_array_4[3] = char_array_3[2] & 0x3f;
+
+			for (i = 0; i < 4; i++)
+				result += s_LegacyBase64Chars[char_array_4[i]];
+			i = 0;
+		}
+	}
+
+	if (i)
+	{
+		for (int32 j = i; j < 3; j++)
+			char_array_3[j] = '\0';
+
+		char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
+		char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
+		char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
+
+		for (int32 j = 0; j < i + 1; j++)
+			result += s_LegacyBase64Chars[char_array_4[j]];
+
+		while (i++ < 3)
+			result += '=';
+	}
+
+	return result;
+}
+
+static std::vector<Byte> LegacyBase64Decode(const HLString &encodedString)
+{
+	int32 in_len = (int32)encodedString.Length();
+	int32 i = 0;
+	int32 in_ = 0;
+	Byte char_array_4[4], char_array_3[3];
+	std::vector<Byte> result;
+
+	while (in_len-- && (encodedString[in_] != '=') && (isalnum((Byte)encodedString[in_]) || encodedString[in_] == '+' || encodedString[in_] == '/'))
+	{
+		char_array_4[i++] = encodedString[in_]; in_++;
+		if (i == 4)
+		{
+			for (i = 0; i < 4; i++)
+				char_array_4[i] = (Byte)s_LegacyBase64Chars.IndexOf(char_array_4[i]);
+
+			char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
+			char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
+			char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
+
+			for (i = 0; i < 3; i++)
+				result.push_back(char_array_3[i]);
+			i = 0;
+		}
+	}
+
+	if (i)
+	{
+		for (int32 j = i; j < 4; j++)
+			char_array_4[j] = 0;
+
+		for (int32 j = 0; j < 4; j++)
+			char_array_4[j] = (Byte)s_LegacyBase64Chars.IndexOf(char_array_4[j]);
+
+		char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
+		char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
+
+		for (int32 j = 0; j < i - 1; j++)
+			result.push_back(char_array_3[j]);
+	}
+
+	return result;
+}
+
+HL_BENCHMARK(Base64)
+{
+	const uint32 sizes[] = { 1024, 64 * 1024, 1024 * 1024, 100 * 1024 * 1024 };
+	const char *sizeNames[] = { "1 KB", "64 KB", "1 MB", "100 MB" };
+
+	std::mt19937 engine(49);
+	std::vector<Byte> payload(sizes[3]);
+	for (Byte &byte : payload)
+		byte = (Byte)(engine() & 0xFF);
+
+	uint64 sink = 0;
+	for (uint32 s = 0; s < 4; ++s)
+	{
+		const uint32 size = sizes[s];
+		const double kilobytes = (double)size / 1024.0;
+
+		// Roughly 64 MB per measurement, the 100 MB payload runs once
+		const uint32 iterations = HL_MAX(1u, (64u * 1024u * 1024u) / size);
+		const uint32 legacyIterations = HL_MAX(1u, iterations / 16);
+
+		std::cout << "  " << sizeNames[s] << std::endl;
+
+		HLString legacyEncoded;
+		double legacyEncodeMs = MeasureMilliseconds(legacyIterations, [&]()
+		{
+			legacyEncoded = LegacyBase64Encode(payload.data(), size);
+		});
+		ReportBenchmark("Previous Encode", legacyEncodeMs, kilobytes, "KB");
+
+		std::vector<char> encoded(Base64::GetEncodedLength(size));
+		double encodeMs = MeasureMilliseconds(iterations, [&]()
+		{
+			sink += Base64::Encode(payload.data(), size, encoded.data());
+		});
+		ReportBenchmark("Encode into buffer", encodeMs, kilobytes, "KB");
+
+		double stringEncodeMs = MeasureMilliseconds(iterations, [&]()
+		{
+			sink += Base64::Encode(payload.data(), size).Length();
+		});
+		ReportBenchmark("Encode to HLString", stringEncodeMs, kilobytes, "KB");
+
+		double legacyDecodeMs = MeasureMilliseconds(legacyIterations, [&]()
+		{
+			sink += LegacyBase64Decode(legacyEncoded).size();
+		});
+		ReportBenchmark("Previous Decode", legacyDecodeMs, kilobytes, "KB");
+
+		std::vector<Byte> decoded(Base64::GetMaxDecodedLength(encoded.size()));
+		double decodeMs = MeasureMilliseconds(iterations, [&]()
+		{
+			uint64 length = 0;
+			Base64::Decode(encoded.data(), encoded.size(), decoded.data(), length);
+			sink += length;
+		});
+		ReportBenchmark("Decode into buffer", decodeMs, kilobytes, "KB");
+
+		double vectorDecodeMs = MeasureMilliseconds(iterations, [&]()
+		{
+			sink += Base64::Decode(legacyEncoded).size();
+		});
+		ReportBenchmark("Decode to std::vector", vectorDecodeMs, kilobytes, "KB");
+	}
+
+	// Streams the 100 MB payload in 64 KB chunks through buffers, that stay in the cache
+	const uint32 chunkSize = 64 * 1024;
+	const double payloadKilobytes = (double)payload.size() / 1024.0;
+	std::vector<char> encodedChunk(Base64::GetEncodedLength(chunkSize + 2));
+	std::vector<Byte> decodedChunk(Base64::GetMaxDecodedLength(chunkSize + 4));
+	std::vector<char> encodedPayload(Base64::GetEncodedLength(payload.size()));
+
+	std::cout << "  100 MB in 64 KB chunks" << std::endl;
+
+	double streamEncodeMs = MeasureMilliseconds(1, [&]()
+	{
+		Base64Encoder encoder;
+		uint64 offset = 0;
+		for (uint64 i = 0; i < payload.size(); i += chunkSize)
+		{
+			const uint64 length = HL_MIN((uint64)chunkSize, payload.size() - i);
+			const uint64 written = encoder.Update(payload.data() + i, length, encodedChunk.data());
+			memcpy(encodedPayload.data() + offset, encodedChunk.data(), written);
+			offset += written;
+		}
+
+		offset += encoder.Finish(encodedPayload.data() + offset);
+		sink += offset;
+	});
+	ReportBenchmark("Base64Encoder", streamEncodeMs, payloadKilobytes, "KB");
+
+	double streamDecodeMs = MeasureMilliseconds(1, [&]()
+	{
+		Base64Decoder decoder;
+		for (uint64 i = 0; i < encodedPayload.size(); i += chunkSize)
+		{
+			const uint64 length = HL_MIN((uint64)chunkSize, encodedPayload.size() - i);
+			uint64 written = 0;
+			decoder.Update(encodedPayload.data() + i, length, decodedChunk.data(), written);
+			sink += written;
+		}
+
+		uint64 written = 0;
+		decoder.Finish(decodedChunk.data(), written);
+		sink += written;
+	});
+	ReportBenchmark("Base64Decoder", streamDecodeMs, payloadKilobytes, "KB");
+
+	std::cout << "    (checksum " << sink << ")" << std::endl;
+}
+
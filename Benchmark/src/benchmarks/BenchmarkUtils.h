@@ -0,0 +1,69 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace highlo;
+
+struct BenchmarkEntry
+{
+	const char *Name;
+	void(*Function)();
+};
+
+static std::vector<BenchmarkEntry> &GetBenchmarks()
+{
+	static std::vector<BenchmarkEntry> s_Benchmarks;
+	return s_Benchmarks;
+}
+
+struct BenchmarkRegistrar
+{
+	BenchmarkRegistrar(const char *name, void(*function)())
+	{
+		GetBenchmarks().push_back({ name, function });
+	}
+};
+
+#define HL_BENCHMARK(name) \
+	static void Benchmark_##name(); \
+	static BenchmarkRegistrar s_BenchmarkRegistrar_##name(#name, &Benchmark_##name); \
+	static void Benchmark_##name()
+
+/// <summary>
+/// Runs the function the given amount of times and returns the average duration of one run in milliseconds.
+/// </summary>
+template<typename Fn>
+static double MeasureMilliseconds(uint32 iterations, Fn &&fn)
+{
+	// Warm up caches and lazily initialized systems
+	fn();
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint32 i = 0; i < iterations; ++i)
+		fn();
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - start).count() / (double)iterations;
+}
+
+static void ReportBenchmark(const char *label, double milliseconds, double workItems = 0.0, const char *unit = nullptr)
+{
+	std::cout << "    " << std::left << std::setw(48) << label << std::right << std::setw(12) << std::fixed << std::setprecision(4) << milliseconds << " ms";
+
+	if (unit && milliseconds > 0.0)
+		std::cout << std::setw(16) << std::setprecision(1) << (workItems / milliseconds) << " " << unit << "/ms";
+
+	std::cout << std::endl;
+}
+
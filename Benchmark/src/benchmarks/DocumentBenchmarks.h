@@ -0,0 +1,150 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added the comparison of the binary and JSON documents
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "Engine/Loaders/DocumentReader.h"
+#include "Engine/Loaders/DocumentWriter.h"
+
+/// <summary>
+/// Writes a registry-like JSON document with the given size, the size can be overridden with the HL_BENCHMARK_DOCUMENT_MB environment variable.
+/// </summary>
+static uint64 WriteBenchmarkDocument(const std::filesystem::path &filePath)
+{
+	const char *overrideSize = std::getenv("HL_BENCHMARK_DOCUMENT_MB");
+	uint64 targetSize = (overrideSize ? std::strtoull(overrideSize, nullptr, 10) : 100) * 1024 * 1024;
+
+	std::ofstream out(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+	out << "{\"assets\":[";
+
+	uint64 size = 0;
+	for (uint64 i = 0; size < targetSize; ++i)
+	{
+		std::string entry = fmt::format("{0}{{\"handle\":{1},\"path\":\"assets/meshes/mesh_{2}.fbx\",\"type\":\"StaticMesh\",\"scale\":{3},\"transform\":[1.0,0.0,0.0,0.0,0.0,1.0,0.0,0.0,0.0,0.0,1.0,0.0,{2}.5,{2}.25,-{2}.75,1.0]}}",
+			i > 0 ? "," : "", 0x9E3779B97F4A7C15ull * (i + 1), i, 0.5 + (double)(i % 100) * 0.01);
+
+		out << entry;
+		size += entry.size();
+	}
+
+	out << "]}";
+	return size + 13;
+}
+
+/// <summary>
+/// Counts the values of the streamed document, so that the parser can't skip any work.
+/// </summary>
+struct BenchmarkStreamCounter : public DocumentStreamHandler
+{
+	uint64 Values = 0;
+	uint64 Objects = 0;
+
+	virtual bool OnInt64(int64 value) override { ++Values; return true; }
+	virtual bool OnUInt64(uint64 value) override { ++Values; return true; }
+	virtual bool OnDouble(double value) override { ++Values; return true; }
+	virtual bool OnString(const char *str, uint32 length) override { ++Values; return true; }
+	virtual bool OnEndObject(uint32 memberCount) override { ++Objects; return true; }
+};
+
+HL_BENCHMARK(JsonDocumentReading)
+{
+	Logger::Init();
+
+	std::filesystem::path filePath = "DocumentBenchmark.json";
+	uint64 documentSize = WriteBenchmarkDocument(filePath);
+	double megabytes = (double)documentSize / (1024.0 * 1024.0);
+	std::cout << "    " << std::fixed << std::setprecision(1) << megabytes << " MB document" << std::endl;
+
+	FileSystemPath documentPath = FileSystemPath(filePath.string());
+
+	// The whole document is built in memory, the strings point into one copy of the file
+	double domMs = MeasureMilliseconds(3, [&]()
+	{
+		Ref<DocumentReader> reader = DocumentReader::Create(documentPath, DocumentType::Json);
+		reader->ReadContents();
+	});
+	ReportBenchmark("DOM, parsed in situ", domMs, megabytes, "MB");
+
+	// Only the values are visited, nothing is kept
+	BenchmarkStreamCounter counter;
+	double streamMs = MeasureMilliseconds(3, [&]()
+	{
+		counter = BenchmarkStreamCounter();
+
+		Ref<DocumentReader> reader = DocumentReader::Create(documentPath, DocumentType::Json);
+		reader->ReadStream(counter);
+	});
+	ReportBenchmark("Stream", streamMs, megabytes, "MB");
+
+	std::cout << "    " << counter.Objects << " objects, " << counter.Values << " values" << std::endl;
+
+	std::error_code error;
+	std::filesystem::remove(filePath, error);
+
+	Logger::Shutdown();
+}
+
+HL_BENCHMARK(BinaryDocumentRoundTrip)
+{
+	Logger::Init();
+
+	// A mesh-like document, the arrays dominate the size as in scene, prefab and shader cache data
+	std::vector<glm::vec3> positions(250000);
+	std::vector<glm::mat4> transforms(25000);
+	for (uint32 i = 0; i < (uint32)positions.size(); ++i)
+		positions[i] = glm::vec3((float)i * 0.25f, (float)(i % 1000), -(float)i * 0.5f);
+
+	for (uint32 i = 0; i < (uint32)transforms.size(); ++i)
+		transforms[i] = glm::mat4((float)i);
+
+	auto run = [&](const char *name, const char *fileName, DocumentType type)
+	{
+		FileSystemPath filePath = FileSystemPath(fileName);
+
+		double writeMs = MeasureMilliseconds(3, [&]()
+		{
+			Ref<DocumentWriter> writer = DocumentWriter::Create(filePath, type);
+			writer->WriteVec3Array("positions", positions);
+			writer->WriteMat4Array("transforms", transforms);
+			writer->WriteOut();
+		});
+
+		std::vector<glm::vec3> readPositions;
+		std::vector<glm::mat4> readTransforms;
+		double readMs = MeasureMilliseconds(3, [&]()
+		{
+			readPositions.clear();
+			readTransforms.clear();
+
+			Ref<DocumentReader> reader = DocumentReader::Create(filePath, type);
+			reader->ReadContents();
+			reader->ReadVec3Array("positions", readPositions);
+			reader->ReadMat4Array("transforms", readTransforms);
+		});
+
+		double megabytes = (double)std::filesystem::file_size(fileName) / (1024.0 * 1024.0);
+		ReportBenchmark(fmt::format("{0} write", name).c_str(), writeMs, megabytes, "MB");
+		ReportBenchmark(fmt::format("{0} read", name).c_str(), readMs, megabytes, "MB");
+
+		if (readPositions.size() != positions.size() || readTransforms.size() != transforms.size())
+			std::cout << "    " << name << " did not read back all values" << std::endl;
+
+		std::error_code error;
+		std::filesystem::remove(fileName, error);
+	};
+
+	run("JSON", "DocumentBenchmark.json", DocumentType::Json);
+	run("Binary", "DocumentBenchmark.hlbd", DocumentType::Binary);
+
+	Logger::Shutdown();
+}
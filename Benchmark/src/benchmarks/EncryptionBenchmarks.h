@@ -0,0 +1,134 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <random>
+
+#define ENCRYPTION_BENCHMARK_KEY "E4D49345E9AFD7A487B6C3117FD574AEF92A27B38D80879A294CD1D72608BEAC"
+#define ENCRYPTION_BENCHMARK_IV "1A92E5E9C29D0A005E4CCC0D94BE886A"
+
+// All throughputs are reported in MB/ms, which is the same as GB/s
+HL_BENCHMARK(EncryptionThroughput)
+{
+	const uint64 size = 64 * 1024 * 1024;
+	const double megabytes = (double)size / (1024.0 * 1024.0);
+
+	std::mt19937 engine(50);
+	std::vector<Byte> payload(size);
+	for (Byte &byte : payload)
+		byte = (Byte)(engine() & 0xFF);
+
+	std::vector<Byte> cipher;
+	std::vector<Byte> plain;
+	uint64 sum = 0;
+
+	const std::pair<EncryptionAlgorithm, const char*> algorithms[] =
+	{
+		{ EncryptionAlgorithm::AES_256_CBC, "AES-256-CBC" },
+		{ EncryptionAlgorithm::AES_256_CFB, "AES-256-CFB" },
+		{ EncryptionAlgorithm::AES_256_GCM, "AES-256-GCM" }
+	};
+
+	for (const auto &[algorithm, name] : algorithms)
+	{
+		Encryptor enc(ENCRYPTION_BENCHMARK_KEY, ENCRYPTION_BENCHMARK_IV, algorithm);
+		std::cout << "  " << name << ", 64 MB" << std::endl;
+
+		double encryptMs = MeasureMilliseconds(3, [&]()
+		{
+			enc.Encrypt(payload.data(), payload.size(), cipher);
+			sum += cipher.size();
+		});
+		ReportBenchmark("Encrypt", encryptMs, megabytes, "MB");
+
+		double decryptMs = MeasureMilliseconds(3, [&]()
+		{
+			enc.Decrypt(cipher.data(), cipher.size(), plain);
+			sum += plain.size();
+		});
+		ReportBenchmark("Decrypt", decryptMs, megabytes, "MB");
+
+		// CBC encryption is sequential, so splitting it into independent chunks is the only way to use several cores
+		double parallelEncryptMs = MeasureMilliseconds(3, [&]()
+		{
+			enc.EncryptParallel(payload.data(), payload.size(), cipher);
+			sum += cipher.size();
+		});
+		ReportBenchmark("EncryptParallel, 1 MB chunks", parallelEncryptMs, megabytes, "MB");
+
+		double parallelDecryptMs = MeasureMilliseconds(3, [&]()
+		{
+			enc.DecryptParallel(cipher.data(), cipher.size(), plain);
+			sum += plain.size();
+		});
+		ReportBenchmark("DecryptParallel, 1 MB chunks", parallelDecryptMs, megabytes, "MB");
+
+		std::vector<Byte> chunkOut(64 * 1024 + CipherStream::MaxOverhead);
+		double streamMs = MeasureMilliseconds(3, [&]()
+		{
+			CipherStream stream = enc.CreateEncryptStream();
+			for (uint64 offset = 0; offset < payload.size(); offset += 64 * 1024)
+			{
+				uint64 written = 0;
+				stream.Update(payload.data() + offset, HL_MIN((uint64)(64 * 1024), payload.size() - offset), chunkOut.data(), written);
+				sum += written;
+			}
+
+			uint64 written = 0;
+			stream.Finish(chunkOut.data(), written);
+			sum += written;
+		});
+		ReportBenchmark("CipherStream, 64 KB chunks", streamMs, megabytes, "MB");
+	}
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+HL_BENCHMARK(EncryptionSmallMessages)
+{
+	const uint32 messageCount = 20000;
+	const uint32 messageSize = 4096;
+
+	std::vector<Byte> message(messageSize, 0x5A);
+	std::vector<Byte> cipher;
+	uint64 sum = 0;
+
+	Encryptor enc(ENCRYPTION_BENCHMARK_KEY, ENCRYPTION_BENCHMARK_IV, EncryptionAlgorithm::AES_256_GCM);
+
+	// The one-shot functions initialize the cipher context of the thread again instead of allocating a new one per message
+	double reusedMs = MeasureMilliseconds(3, [&]()
+	{
+		for (uint32 i = 0; i < messageCount; ++i)
+		{
+			enc.Encrypt(message.data(), message.size(), cipher);
+			sum += cipher.size();
+		}
+	});
+	ReportBenchmark("Encrypt 4 KB, thread context", reusedMs, (double)messageCount, "messages");
+
+	double streamMs = MeasureMilliseconds(3, [&]()
+	{
+		std::vector<Byte> out(messageSize + 2 * CipherStream::MaxOverhead);
+		for (uint32 i = 0; i < messageCount; ++i)
+		{
+			CipherStream stream = enc.CreateEncryptStream();
+
+			uint64 written = 0;
+			stream.Update(message.data(), message.size(), out.data(), written);
+			sum += written;
+			stream.Finish(out.data() + written, written);
+			sum += written;
+		}
+	});
+	ReportBenchmark("Encrypt 4 KB, new context per message", streamMs, (double)messageCount, "messages");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
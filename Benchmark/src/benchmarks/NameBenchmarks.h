@@ -0,0 +1,63 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <unordered_map>
+
+HL_BENCHMARK(NameLookup)
+{
+	const uint32 count = 64;
+	const uint32 lookups = 1000000;
+
+	// Roughly the amount of uniforms of a material
+	std::vector<HLString> strings;
+	std::vector<HLName> names;
+	std::unordered_map<HLString, uint32> stringMap;
+	std::unordered_map<HLName, uint32> nameMap;
+
+	for (uint32 i = 0; i < count; ++i)
+	{
+		strings.push_back(HLString("u_MaterialUniforms.Property") + HLString::ToString(i));
+		names.push_back(strings.back());
+		stringMap[strings.back()] = i;
+		nameMap[names.back()] = i;
+	}
+
+	uint64 sum = 0;
+	double stringLookup = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += stringMap.find(strings[i % count])->second;
+	});
+	ReportBenchmark("std::unordered_map<HLString> lookup", stringLookup, (double)lookups, "lookups");
+
+	double nameLookup = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += nameMap.find(names[i % count])->second;
+	});
+	ReportBenchmark("std::unordered_map<HLName> lookup", nameLookup, (double)lookups, "lookups");
+
+	double literalLookup = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += nameMap.find(HL_NAME("u_MaterialUniforms.Property42"))->second;
+	});
+	ReportBenchmark("HL_NAME literal lookup", literalLookup, (double)lookups, "lookups");
+
+	double interning = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += HLName(strings[i % count]).GetID();
+	});
+	ReportBenchmark("HLName from an existing string", interning, (double)lookups, "names");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
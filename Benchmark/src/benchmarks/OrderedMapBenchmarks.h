@@ -0,0 +1,176 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <map>
+#include <random>
+
+HL_BENCHMARK(OrderedMapLookup)
+{
+	const uint32 count = 100000;
+	const uint32 lookups = 1000000;
+	uint64 sum = 0;
+
+	std::mt19937 random(42);
+	std::vector<uint64> keys(count);
+	for (uint64 &key : keys)
+		key = ((uint64)random() << 32) | random();
+
+	std::vector<uint64> queries(lookups);
+	for (uint64 &query : queries)
+		query = keys[random() % count];
+
+	std::map<uint64, uint64> stdMap;
+	HLFlatMap<uint64, uint64> flatMap;
+	HLBTreeMap<uint64, uint64> treeMap;
+	for (uint32 i = 0; i < count; ++i)
+	{
+		stdMap[keys[i]] = i;
+		flatMap.Insert(keys[i], i);
+		treeMap.Insert(keys[i], i);
+	}
+
+	double stdFind = MeasureMilliseconds(10, [&]()
+	{
+		for (uint64 query : queries)
+			sum += stdMap.find(query)->second;
+	});
+	ReportBenchmark("std::map<uint64>::find", stdFind, (double)lookups, "lookups");
+
+	double flatFind = MeasureMilliseconds(10, [&]()
+	{
+		for (uint64 query : queries)
+			sum += *flatMap.TryGet(query);
+	});
+	ReportBenchmark("HLFlatMap<uint64>::TryGet", flatFind, (double)lookups, "lookups");
+
+	double treeFind = MeasureMilliseconds(10, [&]()
+	{
+		for (uint64 query : queries)
+			sum += *treeMap.TryGet(query);
+	});
+	ReportBenchmark("HLBTreeMap<uint64>::TryGet", treeFind, (double)lookups, "lookups");
+
+	double stdIterate = MeasureMilliseconds(10, [&]()
+	{
+		for (const auto &[key, value] : stdMap)
+			sum += value;
+	});
+	ReportBenchmark("std::map<uint64> iteration", stdIterate, (double)count, "entries");
+
+	double treeIterate = MeasureMilliseconds(10, [&]()
+	{
+		for (const auto &[key, value] : treeMap)
+			sum += value;
+	});
+	ReportBenchmark("HLBTreeMap<uint64> iteration", treeIterate, (double)count, "entries");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+HL_BENCHMARK(OrderedMapInsertRemove)
+{
+	const uint32 count = 100000;
+	uint64 sum = 0;
+
+	std::mt19937 random(42);
+	std::vector<uint64> keys(count);
+	for (uint64 &key : keys)
+		key = ((uint64)random() << 32) | random();
+
+	double stdInsert = MeasureMilliseconds(5, [&]()
+	{
+		std::map<uint64, uint64> map;
+		for (uint32 i = 0; i < count; ++i)
+			map[keys[i]] = i;
+
+		for (uint32 i = 0; i < count; i += 2)
+			map.erase(keys[i]);
+
+		sum += map.size();
+	});
+	ReportBenchmark("std::map<uint64> insert and erase", stdInsert, (double)count, "keys");
+
+	double treeInsert = MeasureMilliseconds(5, [&]()
+	{
+		HLBTreeMap<uint64, uint64> map;
+		for (uint32 i = 0; i < count; ++i)
+			map.InsertOrAssign(keys[i], i);
+
+		for (uint32 i = 0; i < count; i += 2)
+			map.Remove(keys[i]);
+
+		sum += map.Size();
+	});
+	ReportBenchmark("HLBTreeMap<uint64> insert and remove", treeInsert, (double)count, "keys");
+
+	// Every insert moves the following entries, so the flat map is only built from a smaller set of keys
+	const uint32 flatCount = 10000;
+	double flatInsert = MeasureMilliseconds(5, [&]()
+	{
+		HLFlatMap<uint64, uint64> map;
+		for (uint32 i = 0; i < flatCount; ++i)
+			map.InsertOrAssign(keys[i], i);
+
+		for (uint32 i = 0; i < flatCount; i += 2)
+			map.Remove(keys[i]);
+
+		sum += map.Size();
+	});
+	ReportBenchmark("HLFlatMap<uint64> insert and remove", flatInsert, (double)flatCount, "keys");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+HL_BENCHMARK(OrderedMapStringKeys)
+{
+	// Like the shader cache, that maps the paths of all shader files to the hash of their source
+	const uint32 count = 2000;
+	const uint32 lookups = 200000;
+	uint64 sum = 0;
+
+	std::vector<HLString> paths;
+	for (uint32 i = 0; i < count; ++i)
+		paths.push_back(HLString("assets/shaders/Shader") + HLString::ToString(i) + ".glsl");
+
+	std::map<HLString, uint64> stdMap;
+	HLFlatMap<HLString, uint64> flatMap;
+	HLBTreeMap<HLString, uint64> treeMap;
+	for (uint32 i = 0; i < count; ++i)
+	{
+		stdMap[paths[i]] = i;
+		flatMap.Insert(paths[i], i);
+		treeMap.Insert(paths[i], i);
+	}
+
+	double stdFind = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += stdMap.find(paths[(i * 7919) % count])->second;
+	});
+	ReportBenchmark("std::map<HLString>::find", stdFind, (double)lookups, "lookups");
+
+	double flatFind = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += *flatMap.TryGet(paths[(i * 7919) % count]);
+	});
+	ReportBenchmark("HLFlatMap<HLString>::TryGet", flatFind, (double)lookups, "lookups");
+
+	double treeFind = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < lookups; ++i)
+			sum += *treeMap.TryGet(paths[(i * 7919) % count]);
+	});
+	ReportBenchmark("HLBTreeMap<HLString>::TryGet", treeFind, (double)lookups, "lookups");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
@@ -0,0 +1,197 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <mutex>
+#include <queue>
+#include <stack>
+#include <thread>
+
+HL_BENCHMARK(QueueAndStack)
+{
+	// The containers live across the runs like a per frame event queue, so the runs measure the steady state and not the first growth
+	const uint32 count = 1000000;
+	uint64 sum = 0;
+
+	HLQueue<uint64> hlQueue;
+	double hlQueueMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+		{
+			hlQueue.Enqueue(i);
+			if (i % 4 == 3)
+			{
+				sum += hlQueue.Front();
+				hlQueue.Dequeue();
+			}
+		}
+
+		while (!hlQueue.IsEmpty())
+		{
+			sum += hlQueue.Front();
+			hlQueue.Dequeue();
+		}
+	});
+	ReportBenchmark("HLQueue enqueue + dequeue", hlQueueMs, (double)count, "elements");
+
+	std::queue<uint64> stdQueue;
+	double stdQueueMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+		{
+			stdQueue.push(i);
+			if (i % 4 == 3)
+			{
+				sum += stdQueue.front();
+				stdQueue.pop();
+			}
+		}
+
+		while (!stdQueue.empty())
+		{
+			sum += stdQueue.front();
+			stdQueue.pop();
+		}
+	});
+	ReportBenchmark("std::queue push + pop", stdQueueMs, (double)count, "elements");
+
+	HLStack<uint64> hlStack;
+	double hlStackMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			hlStack.Push(i);
+
+		while (!hlStack.IsEmpty())
+		{
+			sum += hlStack.Top();
+			hlStack.Pop();
+		}
+	});
+	ReportBenchmark("HLStack push + pop", hlStackMs, (double)count, "elements");
+
+	std::stack<uint64> stdStack;
+	double stdStackMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			stdStack.push(i);
+
+		while (!stdStack.empty())
+		{
+			sum += stdStack.top();
+			stdStack.pop();
+		}
+	});
+	ReportBenchmark("std::stack push + pop", stdStackMs, (double)count, "elements");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+/// <summary>
+/// Queue that is guarded by a mutex, the way the cross thread traffic is usually implemented without a lock-free queue.
+/// </summary>
+template<typename T>
+class BenchmarkMutexQueue
+{
+public:
+
+	bool TryPush(const T &value)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Queue.push(value);
+		return true;
+	}
+
+	bool TryPop(T &value)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (m_Queue.empty())
+			return false;
+
+		value = m_Queue.front();
+		m_Queue.pop();
+		return true;
+	}
+
+private:
+
+	std::mutex m_Mutex;
+	std::queue<T> m_Queue;
+};
+
+/// <summary>
+/// Sends count elements from the producers to the consumers and returns the duration in milliseconds.
+/// </summary>
+template<typename Queue>
+static double MeasureQueueThroughput(Queue &queue, uint32 producerCount, uint32 consumerCount, uint32 count)
+{
+	std::atomic<uint32> received = 0;
+	std::vector<std::thread> threads;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (uint32 producer = 0; producer < producerCount; ++producer)
+	{
+		threads.emplace_back([&queue, count, producerCount]()
+		{
+			for (uint32 i = 0; i < count / producerCount; ++i)
+			{
+				while (!queue.TryPush(i))
+					std::this_thread::yield();
+			}
+		});
+	}
+
+	for (uint32 consumer = 0; consumer < consumerCount; ++consumer)
+	{
+		threads.emplace_back([&queue, &received, count]()
+		{
+			uint32 value;
+			while (received.load(std::memory_order_relaxed) < count)
+			{
+				if (queue.TryPop(value))
+					received.fetch_add(1, std::memory_order_relaxed);
+				else
+					std::this_thread::yield();
+			}
+		});
+	}
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+HL_BENCHMARK(ConcurrentQueueThroughput)
+{
+	const uint32 count = 1000000;
+
+	{
+		HLSPSCQueue<uint32> queue(4096);
+		ReportBenchmark("HLSPSCQueue 1 producer, 1 consumer", MeasureQueueThroughput(queue, 1, 1, count), (double)count, "elements");
+	}
+
+	{
+		BenchmarkMutexQueue<uint32> queue;
+		ReportBenchmark("mutex + std::queue 1 producer, 1 consumer", MeasureQueueThroughput(queue, 1, 1, count), (double)count, "elements");
+	}
+
+	{
+		HLMPMCQueue<uint32> queue(4096);
+		ReportBenchmark("HLMPMCQueue 4 producers, 4 consumers", MeasureQueueThroughput(queue, 4, 4, count), (double)count, "elements");
+	}
+
+	{
+		BenchmarkMutexQueue<uint32> queue;
+		ReportBenchmark("mutex + std::queue 4 producers, 4 consumers", MeasureQueueThroughput(queue, 4, 4, count), (double)count, "elements");
+	}
+}
+
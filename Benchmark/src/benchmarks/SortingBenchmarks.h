@@ -0,0 +1,83 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <algorithm>
+#include <random>
+
+static std::vector<uint32> CreateBenchmarkSortKeys(uint32 count)
+{
+	std::mt19937 random(1337);
+
+	std::vector<uint32> keys(count);
+	for (uint32 &key : keys)
+		key = random();
+
+	return keys;
+}
+
+/// <summary>
+/// Every run sorts a fresh copy of the input, the copy is part of the measured time for all sorts.
+/// </summary>
+template<typename T, typename SortFn>
+static void BenchmarkSort(const char *label, const std::vector<T> &input, uint32 iterations, SortFn &&sort)
+{
+	std::vector<T> values;
+	double ms = MeasureMilliseconds(iterations, [&]()
+	{
+		values = input;
+		sort(values);
+	});
+
+	if (!std::is_sorted(values.begin(), values.end()))
+		std::cout << "    " << label << " did not sort the input!" << std::endl;
+
+	ReportBenchmark(label, ms, (double)input.size(), "elements");
+}
+
+HL_BENCHMARK(SortRandom)
+{
+	std::vector<uint32> keys = CreateBenchmarkSortKeys(1000000);
+
+	BenchmarkSort("std::sort", keys, 10, [](std::vector<uint32> &values) { std::sort(values.begin(), values.end()); });
+	BenchmarkSort("std::stable_sort", keys, 10, [](std::vector<uint32> &values) { std::stable_sort(values.begin(), values.end()); });
+	BenchmarkSort("Sorting::IntroSort", keys, 10, [](std::vector<uint32> &values) { Sorting::IntroSort(values.data(), (int32)values.size()); });
+	BenchmarkSort("Sorting::MergeSort", keys, 10, [](std::vector<uint32> &values) { Sorting::MergeSort(values.data(), (int32)values.size()); });
+	BenchmarkSort("Sorting::RadixSort", keys, 10, [](std::vector<uint32> &values) { Sorting::RadixSort(values.data(), (int32)values.size()); });
+	BenchmarkSort("Sorting::ParallelSort", keys, 10, [](std::vector<uint32> &values) { Sorting::ParallelSort(values.data(), (int32)values.size()); });
+}
+
+HL_BENCHMARK(SortAlreadySorted)
+{
+	std::vector<uint32> keys = CreateBenchmarkSortKeys(1000000);
+	std::sort(keys.begin(), keys.end());
+
+	BenchmarkSort("std::sort (sorted)", keys, 10, [](std::vector<uint32> &values) { std::sort(values.begin(), values.end()); });
+	BenchmarkSort("Sorting::IntroSort (sorted)", keys, 10, [](std::vector<uint32> &values) { Sorting::IntroSort(values.data(), (int32)values.size()); });
+
+	std::reverse(keys.begin(), keys.end());
+	BenchmarkSort("std::sort (reversed)", keys, 10, [](std::vector<uint32> &values) { std::sort(values.begin(), values.end()); });
+	BenchmarkSort("Sorting::IntroSort (reversed)", keys, 10, [](std::vector<uint32> &values) { Sorting::IntroSort(values.data(), (int32)values.size()); });
+}
+
+HL_BENCHMARK(SortFloatKeys)
+{
+	// Like the view depths used to sort transparent objects
+	std::mt19937 random(1337);
+	std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+
+	std::vector<float> depths(1000000);
+	for (float &depth : depths)
+		depth = distribution(random);
+
+	BenchmarkSort("std::sort (float)", depths, 10, [](std::vector<float> &values) { std::sort(values.begin(), values.end()); });
+	BenchmarkSort("Sorting::IntroSort (float)", depths, 10, [](std::vector<float> &values) { Sorting::IntroSort(values.data(), (int32)values.size()); });
+	BenchmarkSort("Sorting::RadixSort (float)", depths, 10, [](std::vector<float> &values) { Sorting::RadixSort(values.data(), (int32)values.size()); });
+}
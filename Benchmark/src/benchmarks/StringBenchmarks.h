@@ -0,0 +1,294 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added text processing benchmarks on a large shader source
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+/// <summary>
+/// Names like the ones used for assets, components and shader uniforms, most of them fit into the inline storage.
+/// </summary>
+static std::vector<std::string> CreateBenchmarkNames(uint32 count)
+{
+	std::vector<std::string> names;
+	names.reserve(count);
+
+	for (uint32 i = 0; i < count; ++i)
+	{
+		if (i % 4 == 0)
+			names.push_back("assets/meshes/environment/mesh_" + std::to_string(i) + ".fbx");
+		else
+			names.push_back("u_Uniform" + std::to_string(i));
+	}
+
+	return names;
+}
+
+HL_BENCHMARK(StringConstruction)
+{
+	const uint32 count = 100000;
+	std::vector<std::string> names = CreateBenchmarkNames(count);
+
+	std::vector<HLString> hlStrings(count);
+	double hlConstruct = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			hlStrings[i] = HLString(names[i].c_str(), (uint32)names[i].size());
+	});
+	ReportBenchmark("HLString construct + assign", hlConstruct, (double)count, "strings");
+
+	std::vector<std::string> stdStrings(count);
+	double stdConstruct = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			stdStrings[i] = std::string(names[i].c_str(), names[i].size());
+	});
+	ReportBenchmark("std::string construct + assign", stdConstruct, (double)count, "strings");
+
+	double hlCopy = MeasureMilliseconds(20, [&]()
+	{
+		std::vector<HLString> copies = hlStrings;
+	});
+	ReportBenchmark("HLString copy", hlCopy, (double)count, "strings");
+
+	double stdCopy = MeasureMilliseconds(20, [&]()
+	{
+		std::vector<std::string> copies = stdStrings;
+	});
+	ReportBenchmark("std::string copy", stdCopy, (double)count, "strings");
+}
+
+HL_BENCHMARK(StringAppend)
+{
+	const uint32 length = 1000000;
+
+	double hlAppend = MeasureMilliseconds(20, [&]()
+	{
+		HLString str;
+		for (uint32 i = 0; i < length; ++i)
+			str += (char)('a' + i % 26);
+	});
+	ReportBenchmark("HLString append characters", hlAppend, (double)length, "chars");
+
+	double stdAppend = MeasureMilliseconds(20, [&]()
+	{
+		std::string str;
+		for (uint32 i = 0; i < length; ++i)
+			str += (char)('a' + i % 26);
+	});
+	ReportBenchmark("std::string append characters", stdAppend, (double)length, "chars");
+}
+
+HL_BENCHMARK(StringCompareAndFind)
+{
+	const uint32 count = 100000;
+	std::vector<std::string> names = CreateBenchmarkNames(count);
+
+	std::vector<HLString> hlStrings;
+	hlStrings.reserve(count);
+	for (const std::string &name : names)
+		hlStrings.emplace_back(name.c_str(), (uint32)name.size());
+
+	uint64 matches = 0;
+	double hlCompare = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 1; i < count; ++i)
+			matches += hlStrings[i].Compare(hlStrings[i - 1]) < 0;
+	});
+	ReportBenchmark("HLString::Compare", hlCompare, (double)count, "strings");
+
+	double stdCompare = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 1; i < count; ++i)
+			matches += names[i].compare(names[i - 1]) < 0;
+	});
+	ReportBenchmark("std::string::compare", stdCompare, (double)count, "strings");
+
+	HLString hlNeedle = "mesh_";
+	double hlFind = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			matches += hlStrings[i].IndexOf(hlNeedle) != HLString::NPOS;
+	});
+	ReportBenchmark("HLString::IndexOf", hlFind, (double)count, "strings");
+
+	double stdFind = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			matches += names[i].find("mesh_") != std::string::npos;
+	});
+	ReportBenchmark("std::string::find", stdFind, (double)count, "strings");
+
+	std::cout << "    (" << matches << " matches)" << std::endl;
+}
+
+HL_BENCHMARK(StringHashMapLookup)
+{
+	const uint32 count = 100000;
+	std::vector<std::string> names = CreateBenchmarkNames(count);
+
+	std::unordered_map<HLString, uint32> hlMap;
+	std::unordered_map<std::string, uint32> stdMap;
+	std::vector<HLString> hlKeys;
+	hlKeys.reserve(count);
+
+	for (uint32 i = 0; i < count; ++i)
+	{
+		hlKeys.emplace_back(names[i].c_str(), (uint32)names[i].size());
+		hlMap[hlKeys.back()] = i;
+		stdMap[names[i]] = i;
+	}
+
+	uint64 sum = 0;
+	double hlLookup = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			sum += hlMap.find(hlKeys[i])->second;
+	});
+	ReportBenchmark("std::unordered_map<HLString> lookup", hlLookup, (double)count, "lookups");
+
+	double stdLookup = MeasureMilliseconds(20, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			sum += stdMap.find(names[i])->second;
+	});
+	ReportBenchmark("std::unordered_map<std::string> lookup", stdLookup, (double)count, "lookups");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+/// <summary>
+/// A large shader source with a few non ASCII characters in the comments.
+/// </summary>
+static std::string CreateBenchmarkShaderSource(uint32 lineCount)
+{
+	static const char *lines[] =
+	{
+		"#version 450 core",
+		"layout(location = 0) in vec3 a_Position;",
+		"layout(std140, binding = 0) uniform Camera { mat4 u_ViewProjection; };",
+		"// Beleuchtung für die Szene, Größe in Metern",
+		"uniform sampler2D u_AlbedoTexture;",
+		"vec3 CalculateLight(vec3 normal, vec3 lightDirection) { return max(dot(normal, lightDirection), 0.0) * vec3(1.0); }",
+		"void main() { v_Position = a_Position; gl_Position = u_ViewProjection * vec4(a_Position, 1.0); }",
+	};
+
+	std::string source;
+	for (uint32 i = 0; i < lineCount; ++i)
+	{
+		source += lines[i % (sizeof(lines) / sizeof(lines[0]))];
+		source += (i % 2 == 0) ? "\r\n" : "\n";
+	}
+
+	return source;
+}
+
+HL_BENCHMARK(StringTextProcessing)
+{
+	std::string stdSource = CreateBenchmarkShaderSource(20000);
+	HLString source(stdSource.c_str(), (uint32)stdSource.size());
+	const double kilobytes = (double)source.Length() / 1024.0;
+	uint64 sum = 0;
+
+	std::cout << "    (" << (utils::IsStringAVX2Enabled() ? "AVX2" : "SSE2 or scalar") << " kernels)" << std::endl;
+
+	double hlFind = MeasureMilliseconds(50, [&]()
+	{
+		sum += source.IndexOf("u_NotDeclared");
+	});
+	ReportBenchmark("HLString::IndexOf (not found)", hlFind, kilobytes, "KB");
+
+	double stdFind = MeasureMilliseconds(50, [&]()
+	{
+		sum += stdSource.find("u_NotDeclared");
+	});
+	ReportBenchmark("std::string::find (not found)", stdFind, kilobytes, "KB");
+
+	double hlFindAny = MeasureMilliseconds(50, [&]()
+	{
+		sum += source.IndexOfAny("@$`");
+	});
+	ReportBenchmark("HLString::IndexOfAny (not found)", hlFindAny, kilobytes, "KB");
+
+	double stdFindAny = MeasureMilliseconds(50, [&]()
+	{
+		sum += stdSource.find_first_of("@$`");
+	});
+	ReportBenchmark("std::string::find_first_of (not found)", stdFindAny, kilobytes, "KB");
+
+	double hlCount = MeasureMilliseconds(50, [&]()
+	{
+		sum += source.CountOf(';');
+	});
+	ReportBenchmark("HLString::CountOf", hlCount, kilobytes, "KB");
+
+	double stdCount = MeasureMilliseconds(50, [&]()
+	{
+		sum += std::count(stdSource.begin(), stdSource.end(), ';');
+	});
+	ReportBenchmark("std::count", stdCount, kilobytes, "KB");
+
+	HLString lower = source;
+	double hlLower = MeasureMilliseconds(50, [&]()
+	{
+		lower.ToLowerCase();
+		sum += lower[0];
+	});
+	ReportBenchmark("HLString::ToLowerCase", hlLower, kilobytes, "KB");
+
+	std::string stdLower = stdSource;
+	double scalarLower = MeasureMilliseconds(50, [&]()
+	{
+		for (char &c : stdLower)
+		{
+			if (c >= 'A' && c <= 'Z')
+				c = c - ('A' - 'a');
+		}
+
+		sum += stdLower[0];
+	});
+	ReportBenchmark("Scalar lower case loop", scalarLower, kilobytes, "KB");
+
+	double hlSplitLines = MeasureMilliseconds(20, [&]()
+	{
+		sum += source.SplitLines().size();
+	});
+	ReportBenchmark("HLString::SplitLines", hlSplitLines, kilobytes, "KB");
+
+	double hlValidate = MeasureMilliseconds(50, [&]()
+	{
+		sum += HLStringUTF8::IsValid(source) ? 1 : 0;
+	});
+	ReportBenchmark("HLStringUTF8::IsValid", hlValidate, kilobytes, "KB");
+
+	double hlToUTF16 = MeasureMilliseconds(20, [&]()
+	{
+		sum += HLStringUTF8::ToUTF16(source).Length();
+	});
+	ReportBenchmark("HLStringUTF8::ToUTF16", hlToUTF16, kilobytes, "KB");
+
+	HLString16 utf16 = HLStringUTF8::ToUTF16(source);
+	double hlFromUTF16 = MeasureMilliseconds(20, [&]()
+	{
+		sum += HLStringUTF8::FromUTF16(utf16).Length();
+	});
+	ReportBenchmark("HLStringUTF8::FromUTF16", hlFromUTF16, kilobytes, "KB");
+
+	double hlToUTF32 = MeasureMilliseconds(20, [&]()
+	{
+		sum += HLStringUTF8::ToUTF32(source).Length();
+	});
+	ReportBenchmark("HLStringUTF8::ToUTF32", hlToUTF32, kilobytes, "KB");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
@@ -0,0 +1,158 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+HL_BENCHMARK(UUIDGeneration)
+{
+	const uint32 count = 1000000;
+	uint64 sum = 0;
+
+	double randomMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			sum += UUID();
+	});
+	ReportBenchmark("UUID() random", randomMs, (double)count, "UUIDs");
+
+	UUID::SetGenerationMode(UUIDGenerationMode::TimeOrdered);
+	double timeOrderedMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+			sum += UUID();
+	});
+	ReportBenchmark("UUID() time-ordered", timeOrderedMs, (double)count, "UUIDs");
+	UUID::SetGenerationMode(UUIDGenerationMode::Random);
+
+	// The previous generator: one shared std::mt19937_64, that has to be locked to be used from several threads
+	std::mt19937_64 engine(std::random_device{}());
+	std::uniform_int_distribution<uint64> distribution;
+	std::mutex engineMutex;
+
+	double mersenneMs = MeasureMilliseconds(10, [&]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+		{
+			std::lock_guard<std::mutex> lock(engineMutex);
+			sum += distribution(engine);
+		}
+	});
+	ReportBenchmark("Locked std::mt19937_64", mersenneMs, (double)count, "UUIDs");
+
+	const uint32 threadCount = 4;
+	double threadedMs = MeasureMilliseconds(5, [&]()
+	{
+		std::vector<std::thread> threads;
+		for (uint32 t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back([count]()
+			{
+				uint64 threadSum = 0;
+				for (uint32 i = 0; i < count; ++i)
+					threadSum += UUID();
+
+				static std::atomic<uint64> s_Sink;
+				s_Sink += threadSum;
+			});
+		}
+
+		for (std::thread &thread : threads)
+			thread.join();
+	});
+	ReportBenchmark("UUID() random on 4 threads", threadedMs, (double)(count * threadCount), "UUIDs");
+
+	double threadedMersenneMs = MeasureMilliseconds(5, [&]()
+	{
+		std::vector<std::thread> threads;
+		for (uint32 t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back([&, count]()
+			{
+				uint64 threadSum = 0;
+				for (uint32 i = 0; i < count; ++i)
+				{
+					std::lock_guard<std::mutex> lock(engineMutex);
+					threadSum += distribution(engine);
+				}
+
+				static std::atomic<uint64> s_Sink;
+				s_Sink += threadSum;
+			});
+		}
+
+		for (std::thread &thread : threads)
+			thread.join();
+	});
+	ReportBenchmark("Locked std::mt19937_64 on 4 threads", threadedMersenneMs, (double)(count * threadCount), "UUIDs");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+HL_BENCHMARK(UUIDHashMap)
+{
+	const uint32 count = 200000;
+	uint64 sum = 0;
+
+	UUID::SetGenerationMode(UUIDGenerationMode::TimeOrdered);
+	std::vector<UUID> uuids;
+	uuids.reserve(count);
+	for (uint32 i = 0; i < count; ++i)
+		uuids.push_back(UUID());
+	UUID::SetGenerationMode(UUIDGenerationMode::Random);
+
+	// Hash tables with a power of two bucket count, that take the upper bits of the hash, like Fibonacci hashing.
+	// The upper bits of time-ordered UUIDs are the time, so without mixing they all share a few buckets.
+	const uint32 bucketBits = 12;
+	std::vector<uint32> identityBuckets(1 << bucketBits, 0);
+	std::vector<uint32> mixedBuckets(1 << bucketBits, 0);
+	for (const UUID &uuid : uuids)
+	{
+		++identityBuckets[(uint64)uuid >> (64 - bucketBits)];
+		++mixedBuckets[std::hash<UUID>()(uuid) >> (64 - bucketBits)];
+	}
+
+	std::cout << "    Largest of " << (1 << bucketBits) << " buckets, identity hash: " << *std::max_element(identityBuckets.begin(), identityBuckets.end())
+		<< ", std::hash<UUID>: " << *std::max_element(mixedBuckets.begin(), mixedBuckets.end()) << std::endl;
+
+	double hashMs = MeasureMilliseconds(20, [&]()
+	{
+		for (const UUID &uuid : uuids)
+			sum += std::hash<UUID>()(uuid);
+	});
+	ReportBenchmark("std::hash<UUID>", hashMs, (double)count, "UUIDs");
+
+	double previousHashMs = MeasureMilliseconds(20, [&]()
+	{
+		for (const UUID &uuid : uuids)
+			sum += std::hash<uint64>()((uint64)uuid);
+	});
+	ReportBenchmark("std::hash<uint64> (previous hash)", previousHashMs, (double)count, "UUIDs");
+
+	double mapMs = MeasureMilliseconds(5, [&]()
+	{
+		std::unordered_map<UUID, uint32> map;
+		map.reserve(count);
+		for (uint32 i = 0; i < count; ++i)
+			map[uuids[i]] = i;
+
+		for (uint32 i = 0; i < count; ++i)
+			sum += map.find(uuids[i])->second;
+	});
+	ReportBenchmark("unordered_map<UUID> insert + find", mapMs, (double)count, "UUIDs");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
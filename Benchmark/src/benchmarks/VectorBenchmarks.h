@@ -0,0 +1,120 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "BenchmarkUtils.h"
+
+HL_BENCHMARK(VectorPushBack)
+{
+	const uint32 count = 1000000;
+	uint64 sum = 0;
+
+	double hlPush = MeasureMilliseconds(10, [&]()
+	{
+		HLVector<uint64> vector;
+		for (uint32 i = 0; i < count; ++i)
+			vector.PushBack(i);
+
+		sum += vector.Back();
+	});
+	ReportBenchmark("HLVector<uint64>::PushBack", hlPush, (double)count, "elements");
+
+	double stdPush = MeasureMilliseconds(10, [&]()
+	{
+		std::vector<uint64> vector;
+		for (uint32 i = 0; i < count; ++i)
+			vector.push_back(i);
+
+		sum += vector.back();
+	});
+	ReportBenchmark("std::vector<uint64>::push_back", stdPush, (double)count, "elements");
+
+	const uint32 stringCount = 200000;
+
+	double hlStringPush = MeasureMilliseconds(10, [&]()
+	{
+		HLVector<HLString> vector;
+		for (uint32 i = 0; i < stringCount; ++i)
+			vector.EmplaceBack("u_Uniform");
+
+		sum += vector.Size();
+	});
+	ReportBenchmark("HLVector<HLString>::EmplaceBack", hlStringPush, (double)stringCount, "elements");
+
+	double stdStringPush = MeasureMilliseconds(10, [&]()
+	{
+		std::vector<HLString> vector;
+		for (uint32 i = 0; i < stringCount; ++i)
+			vector.emplace_back("u_Uniform");
+
+		sum += vector.size();
+	});
+	ReportBenchmark("std::vector<HLString>::emplace_back", stdStringPush, (double)stringCount, "elements");
+
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
+HL_BENCHMARK(VectorSmallLists)
+{
+	// Like the children of the entities in a scene, most entities have less than four children
+	const uint32 listCount = 100000;
+	uint64 sum = 0;
+
+	double hlSmall = MeasureMilliseconds(10, [&]()
+	{
+		std::vector<HLSmallVector<UUID, 4>> lists(listCount);
+		for (uint32 i = 0; i < listCount; ++i)
+		{
+			for (uint32 child = 0; child < i % 4; ++child)
+				lists[i].PushBack(UUID(i + child));
+		}
+
+		for (const HLSmallVector<UUID, 4> &list : lists)
+			sum += list.Size();
+	});
+	ReportBenchmark("HLSmallVector<UUID, 4> lists", hlSmall, (double)listCount, "lists");
+
+	double stdLists = MeasureMilliseconds(10, [&]()
+	{
+		std::vector<std::vector<UUID>> lists(listCount);
+		for (uint32 i = 0; i < listCount; ++i)
+		{
+			for (uint32 child = 0; child < i % 4; ++child)
+				lists[i].push_back(UUID(i + child));
+		}
+
+		for (const std::vector<UUID> &list : lists)
+			sum += list.size();
+	});
+	ReportBenchmark("std::vector<UUID> lists", stdLists, (double)listCount, "lists");
+
+	// FreeAll clears the whole arena, so it is only as large as the lists need
+	LinearAllocator arena;
+	arena.Init(listCount * (4 * sizeof(UUID) + alignof(UUID)));
+
+	double linearLists = MeasureMilliseconds(10, [&]()
+	{
+		arena.FreeAll();
+
+		LinearContainerAllocator allocator(&arena);
+		for (uint32 i = 0; i < listCount; ++i)
+		{
+			HLVector<UUID, LinearContainerAllocator> list(allocator);
+			list.Reserve(4);
+			for (uint32 child = 0; child < i % 4; ++child)
+				list.PushBack(UUID(i + child));
+
+			sum += list.Size();
+		}
+	});
+	ReportBenchmark("HLVector<UUID, LinearContainerAllocator> lists", linearLists, (double)listCount, "lists");
+
+	arena.Shutdown();
+	std::cout << "    (checksum " << sum << ")" << std::endl;
+}
+
@@ -5,9 +5,6 @@
 #include <Lighting.glslh>
 #include <ShadowMapping.glslh>
 
-const int MAX_BONES = 100;
-const int MAX_ANIMATED_MESHES = 1024;
-
 layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec2 a_TexCoord;
 layout(location = 2) in vec3 a_Normal;
@@ -36,25 +33,29 @@ struct VertexOutput
 
 layout(location = 0) out VertexOutput Output;
 
+// The skinning palette only contains the bones that are used by each instance,
+// Base is the first matrix of the first instance and BoneCount the number of matrices per instance (0 if all instances share one pose)
 #ifdef __VULKAN__
 layout(std140, set = 2, binding = 22) readonly buffer BoneTransforms
 {
-	mat4 BoneTransform[MAX_BONES * MAX_ANIMATED_MESHES];
+	mat4 BoneTransform[];
 } r_BoneTransforms;
 
 layout(push_constant) uniform BoneTransformIndex
 {
 	uint Base;
+	uint BoneCount;
 } u_BoneTransformIndex;
 #else
 layout(binding = 22, std140) readonly buffer BoneTransforms
 {
-	mat4 BoneTransform[MAX_BONES * MAX_ANIMATED_MESHES];
+	mat4 BoneTransform[];
 } r_BoneTransforms;
 
 layout(binding = 19, std140) uniform BoneTransformIndex
 {
 	uint Base;
+	uint BoneCount;
 } u_BoneTransformIndex;
 #endif // __VULKAN__
 
@@ -73,10 +74,12 @@ void main()
 	int instanceIndex = gl_InstanceID;
 #endif // __VULKAN__
 
-	mat4 boneTransform = r_BoneTransforms.BoneTransform[(u_BoneTransformIndex.Base + instanceIndex) * MAX_BONES + a_BoneIndices[0]] * a_BoneWeights[0];
-	boneTransform     += r_BoneTransforms.BoneTransform[(u_BoneTransformIndex.Base + instanceIndex) * MAX_BONES + a_BoneIndices[1]] * a_BoneWeights[1];
-	boneTransform     += r_BoneTransforms.BoneTransform[(u_BoneTransformIndex.Base + instanceIndex) * MAX_BONES + a_BoneIndices[2]] * a_BoneWeights[2];
-	boneTransform     += r_BoneTransforms.BoneTransform[(u_BoneTransformIndex.Base + instanceIndex) * MAX_BONES + a_BoneIndices[3]] * a_BoneWeights[3];
+	uint paletteOffset = u_BoneTransformIndex.Base + uint(instanceIndex) * u_BoneTransformIndex.BoneCount;
+
+	mat4 boneTransform = r_BoneTransforms.BoneTransform[paletteOffset + uint(a_BoneIndices[0])] * a_BoneWeights[0];
+	boneTransform     += r_BoneTransforms.BoneTransform[paletteOffset + uint(a_BoneIndices[1])] * a_BoneWeights[1];
+	boneTransform     += r_BoneTransforms.BoneTransform[paletteOffset + uint(a_BoneIndices[2])] * a_BoneWeights[2];
+	boneTransform     += r_BoneTransforms.BoneTransform[paletteOffset + uint(a_BoneIndices[3])] * a_BoneWeights[3];
 
 	vec4 worldPosition = transform * boneTransform * vec4(a_Position, 1.0);
 
@@ -4,6 +4,7 @@
 #include "Application.h"
 
 #include "Engine/Core/VirtualFileSystem.h"
+#include "Engine/Core/AsyncFileIO.h"
 #include "Engine/Core/Input.h"
 #include "Engine/Core/Service.h"
 #include "Engine/Core/Profiler/ProfilerTimer.h"
@@ -19,6 +20,8 @@
 #include "Engine/ECS/RenderSystem.h"
 #include "Engine/Threading/ThreadRegistry.h"
 #include "Engine/Loaders/AssetImporter.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/DerivedDataCache.h"
 #include "Engine/Scripting/ScriptEngine.h"
 #include "Engine/Core/FileSystem.h"
 #include "Engine/Core/LinearAllocator.h"
@@ -76,6 +79,9 @@ namespace highlo
 
 			if (!m_Minimized && !m_Settings.Headless)
 			{
+				// Finalize the assets that have been loaded in the background
+				AssetManager::Get()->ProcessAsyncLoads();
+
 				// Update Entities and Client Application
 				m_ECS_SystemManager.Update(m_TimeStep);
 				OnUpdate(m_TimeStep);
@@ -186,6 +192,12 @@ namespace highlo
 		// Read the json registry with previous shader cache data
 		ShaderCache::Init();
 
+		// Open the cache with the results of previous asset imports
+		DerivedDataCache::Get()->Init(m_Settings.DerivedDataCachePath, (uint64)m_Settings.DerivedDataCacheSizeMB * 1024 * 1024);
+
+		// Choose the backend for asynchronous file reads before the first asset is streamed
+		AsyncFileIO::Get()->Init();
+
 		// Init Window
 		if (!m_Settings.Headless)
 		{
@@ -242,8 +254,12 @@ namespace highlo
 		m_ECS_SystemManager.Shutdown();
 		FontManager::Get()->Shutdown();
 
+		// The callbacks of the pending reads can still access the caches
+		AsyncFileIO::Get()->Shutdown();
+
 		// Save the current shader cache state into the json registry
 		ShaderCache::Shutdown();
+		DerivedDataCache::Get()->Shutdown();
 
 		AssetImporter::Shutdown();
 
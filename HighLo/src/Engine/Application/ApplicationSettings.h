@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Added derived data cache settings
 //     - 1.1 (2021-10-23) Added MainThreadID
 //     - 1.0 (2021-09-26) initial release
 //
@@ -97,6 +98,16 @@ namespace highlo
 		/// </summary>
 		FileSystemPath AssetsRegistryPath = "assets/assets.registry";
 
+		/// <summary>
+		/// Determines the directory of the derived data cache, which stores the results of asset imports. It can be shared, for example between build agents.
+		/// </summary>
+		FileSystemPath DerivedDataCachePath = "assets/cache/derived/";
+
+		/// <summary>
+		/// Determines the maximum size of the derived data cache in megabytes, the least recently used entries are removed above it.
+		/// </summary>
+		uint32 DerivedDataCacheSizeMB = 4096;
+
 		/// <summary>
 		/// Determines the default language the engine should start with.
 		/// </summary>
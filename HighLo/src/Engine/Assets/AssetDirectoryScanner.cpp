@@ -0,0 +1,416 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AssetDirectoryScanner.h"
+
+#include "Engine/Core/FileSystem.h"
+#include "Engine/Threading/ThreadPool.h"
+
+#define ASSET_SCANNER_LOG_PREFIX "AScanner>     "
+#define ASSET_SCANNER_HASH_BLOCK_SIZE (64 * 1024)
+
+namespace highlo
+{
+	namespace utils
+	{
+		static float GetElapsedMilliseconds(std::chrono::steady_clock::time_point start)
+		{
+			return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		static uint64 MixContentHash(uint64 hash, uint64 value)
+		{
+			hash = (hash ^ value) * 1099511628211ull;
+			return hash ^ (hash >> 32);
+		}
+	}
+
+	bool AssetDirectoryScanner::LoadManifest(const FileSystemPath &manifestPath, uint64 importFilterHash)
+	{
+		m_Manifest.clear();
+		m_ImportFilterHash = importFilterHash;
+		if (!FileSystem::Get()->FileExists(manifestPath))
+			return false;
+
+		int64 size = 0;
+		Byte *fileData = FileSystem::Get()->ReadFile(manifestPath, &size);
+		if (!fileData)
+			return false;
+
+		const uint64 fileSize = (uint64)size;
+		const AssetManifestHeader *header = (const AssetManifestHeader*)fileData;
+		const uint64 entriesOffset = sizeof(AssetManifestHeader);
+
+		bool valid = fileSize >= sizeof(AssetManifestHeader)
+			&& header->Magic == HL_ASSET_MANIFEST_MAGIC
+			&& header->Version == HL_ASSET_MANIFEST_VERSION
+			&& entriesOffset + (uint64)header->EntryCount * sizeof(AssetManifestEntry) + header->StringTableSize <= fileSize;
+
+		if (!valid)
+		{
+			HL_CORE_WARN(ASSET_SCANNER_LOG_PREFIX "[-] {0} is not a valid asset manifest, all files are hashed again [-]", *manifestPath.String());
+			delete[] fileData;
+			return false;
+		}
+
+		const AssetManifestEntry *entries = (const AssetManifestEntry*)(fileData + entriesOffset);
+		const char *strings = (const char*)(entries + header->EntryCount);
+
+		// Files, that have been rejected by a different importer, might be assets now
+		const bool importFilterChanged = header->ImportFilterHash != importFilterHash;
+
+		m_Manifest.reserve(header->EntryCount);
+		for (uint32 i = 0; i < header->EntryCount; ++i)
+		{
+			const AssetManifestEntry &entry = entries[i];
+			if ((uint64)entry.PathOffset + entry.PathLength > header->StringTableSize)
+				continue;
+
+			const bool isAsset = (entry.Flags & HL_ASSET_MANIFEST_FLAG_NOT_AN_ASSET) == 0;
+			if (!isAsset && importFilterChanged)
+				continue;
+
+			ManifestRecord &record = m_Manifest[HLString(strings + entry.PathOffset, entry.PathLength)];
+			record.Handle = entry.Handle;
+			record.ContentHash = entry.ContentHash;
+			record.Size = entry.Size;
+			record.WriteTime = entry.WriteTime;
+			record.IsAsset = isAsset;
+		}
+
+		delete[] fileData;
+		return true;
+	}
+
+	bool AssetDirectoryScanner::WriteManifest(const FileSystemPath &manifestPath) const
+	{
+		std::vector<AssetManifestEntry> entries;
+		entries.reserve(m_Files.size());
+
+		std::vector<char> strings;
+		for (const AssetScanFile &file : m_Files)
+		{
+			AssetManifestEntry &entry = entries.emplace_back();
+			entry.Handle = (uint64)file.Handle;
+			entry.ContentHash = file.ContentHash;
+			entry.Size = file.Size;
+			entry.WriteTime = file.WriteTime;
+			entry.PathOffset = (uint32)strings.size();
+			entry.PathLength = file.FilePath.Length();
+			entry.Flags = file.IsAsset ? 0 : HL_ASSET_MANIFEST_FLAG_NOT_AN_ASSET;
+			strings.insert(strings.end(), *file.FilePath, *file.FilePath + file.FilePath.Length());
+		}
+
+		AssetManifestHeader header;
+		header.EntryCount = (uint32)entries.size();
+		header.StringTableSize = (uint32)strings.size();
+		header.ImportFilterHash = m_ImportFilterHash;
+
+		std::vector<Byte> buffer(sizeof(AssetManifestHeader) + entries.size() * sizeof(AssetManifestEntry) + strings.size());
+		Byte *writePtr = buffer.data();
+		memcpy(writePtr, &header, sizeof(AssetManifestHeader));
+		writePtr += sizeof(AssetManifestHeader);
+		memcpy(writePtr, entries.data(), entries.size() * sizeof(AssetManifestEntry));
+		writePtr += entries.size() * sizeof(AssetManifestEntry);
+		memcpy(writePtr, strings.data(), strings.size());
+
+		FileSystemPath directory = manifestPath.ParentPath();
+		if (!directory.String().IsEmpty() && !FileSystem::Get()->FolderExists(directory))
+			FileSystem::Get()->CreateFolder(directory);
+
+		// WriteFile does not overwrite existing files
+		if (FileSystem::Get()->FileExists(manifestPath))
+			FileSystem::Get()->RemoveFile(manifestPath);
+
+		if (!FileSystem::Get()->WriteFile(manifestPath, buffer.data(), (int64)buffer.size()))
+		{
+			HL_CORE_ERROR(ASSET_SCANNER_LOG_PREFIX "[-] Failed to write asset manifest {0} [-]", *manifestPath.String());
+			return false;
+		}
+
+		return true;
+	}
+
+	std::vector<AssetScanFile> &AssetDirectoryScanner::Scan(const FileSystemPath &rootDirectory)
+	{
+		m_Files.clear();
+		m_Report = AssetScanReport();
+		m_Progress.DirectoryCount = 0;
+		m_Progress.FileCount = 0;
+		m_Progress.FilesToHash = 0;
+		m_Progress.HashedCount = 0;
+		m_Progress.ImportedCount = 0;
+
+		auto start = std::chrono::steady_clock::now();
+		m_Progress.Stage = AssetScanStage::Crawling;
+		Crawl(std::filesystem::path(*rootDirectory.String()));
+		m_Report.CrawlMs = utils::GetElapsedMilliseconds(start);
+
+		// The jobs finish in any order, sorting keeps the import order and the manifest stable between runs
+		std::sort(m_Files.begin(), m_Files.end(), [](const AssetScanFile &a, const AssetScanFile &b)
+		{
+			return a.FilePath < b.FilePath;
+		});
+
+		start = std::chrono::steady_clock::now();
+		m_Progress.Stage = AssetScanStage::Hashing;
+		ClassifyFiles();
+		m_Report.HashMs = utils::GetElapsedMilliseconds(start);
+
+		m_Report.DirectoryCount = m_Progress.DirectoryCount;
+		m_Report.FileCount = (uint32)m_Files.size();
+		m_Progress.Stage = AssetScanStage::Importing;
+		return m_Files;
+	}
+
+	void AssetDirectoryScanner::FinishImport(float importMs)
+	{
+		m_Report.ImportMs = importMs;
+		m_Progress.ImportedCount = (uint32)m_Files.size();
+		m_Progress.Stage = AssetScanStage::Done;
+	}
+
+	bool AssetDirectoryScanner::HashFileContent(const FileSystemPath &filePath, uint64 &outHash, uint64 *outBytesRead)
+	{
+		std::ifstream in(*filePath.String(), std::ios::in | std::ios::binary);
+		if (!in)
+			return false;
+
+		std::vector<Byte> block(ASSET_SCANNER_HASH_BLOCK_SIZE);
+		uint64 hash = 14695981039346656037ull;
+		uint64 totalBytes = 0;
+
+		while (in)
+		{
+			in.read((char*)block.data(), block.size());
+			uint64 bytesRead = (uint64)in.gcount();
+			if (bytesRead == 0)
+				break;
+
+			// Hashing whole words instead of single bytes, the remainder of the block is padded with zeros
+			uint64 wordCount = (bytesRead + sizeof(uint64) - 1) / sizeof(uint64);
+			memset(block.data() + bytesRead, 0, wordCount * sizeof(uint64) - bytesRead);
+
+			for (uint64 i = 0; i < wordCount; ++i)
+			{
+				uint64 word;
+				memcpy(&word, block.data() + i * sizeof(uint64), sizeof(uint64));
+				hash = utils::MixContentHash(hash, word);
+			}
+
+			totalBytes += bytesRead;
+		}
+
+		outHash = utils::MixContentHash(hash, totalBytes);
+		if (outBytesRead)
+			*outBytesRead = totalBytes;
+
+		return true;
+	}
+
+	void AssetDirectoryScanner::Crawl(const std::filesystem::path &rootDirectory)
+	{
+		std::error_code error;
+		if (!std::filesystem::is_directory(rootDirectory, error))
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_CrawlMutex);
+			m_PendingDirectories = 1;
+		}
+
+		SubmitDirectory(rootDirectory);
+
+		std::unique_lock<std::mutex> lock(m_CrawlMutex);
+		m_CrawlFinished.wait(lock, [this]() { return m_PendingDirectories == 0; });
+	}
+
+	void AssetDirectoryScanner::SubmitDirectory(const std::filesystem::path &directory)
+	{
+		ThreadPool::Get().Submit([this, directory]() { CrawlDirectory(directory); });
+	}
+
+	void AssetDirectoryScanner::CrawlDirectory(const std::filesystem::path &directory)
+	{
+		std::vector<AssetScanFile> files;
+		std::vector<std::filesystem::path> subDirectories;
+
+		std::error_code error;
+		std::filesystem::directory_iterator it(directory, error);
+		for (; !error && it != std::filesystem::directory_iterator(); it.increment(error))
+		{
+			const std::filesystem::directory_entry &entry = *it;
+
+			std::error_code entryError;
+			if (entry.is_directory(entryError))
+			{
+				subDirectories.push_back(entry.path());
+				continue;
+			}
+
+			if (!entry.is_regular_file(entryError))
+				continue;
+
+			AssetScanFile &file = files.emplace_back();
+			file.FilePath = entry.path().generic_string();
+			file.Size = (uint64)entry.file_size(entryError);
+			file.WriteTime = (int64)entry.last_write_time(entryError).time_since_epoch().count();
+		}
+
+		if (error)
+			HL_CORE_WARN(ASSET_SCANNER_LOG_PREFIX "[-] Failed to read directory {0}: {1} [-]", directory.string(), error.message());
+
+		m_Progress.DirectoryCount.fetch_add(1);
+		m_Progress.FileCount.fetch_add((uint32)files.size());
+
+		std::lock_guard<std::mutex> lock(m_CrawlMutex);
+		m_Files.insert(m_Files.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+
+		// Every subdirectory becomes a job of its own, so that wide and deep trees are spread over all workers
+		m_PendingDirectories += (uint32)subDirectories.size();
+		for (const std::filesystem::path &subDirectory : subDirectories)
+			SubmitDirectory(subDirectory);
+
+		if (--m_PendingDirectories == 0)
+			m_CrawlFinished.notify_all();
+	}
+
+	void AssetDirectoryScanner::ClassifyFiles()
+	{
+		std::vector<uint32> filesToHash;
+
+		for (auto &[filePath, record] : m_Manifest)
+			record.Found = false;
+
+		for (uint32 i = 0; i < (uint32)m_Files.size(); ++i)
+		{
+			AssetScanFile &file = m_Files[i];
+			auto it = m_Manifest.find(file.FilePath);
+			if (it == m_Manifest.end())
+			{
+				file.State = AssetFileState::Added;
+				filesToHash.push_back(i);
+				continue;
+			}
+
+			ManifestRecord &record = it->second;
+			record.Found = true;
+			file.Handle = record.Handle;
+			file.ContentHash = record.ContentHash;
+
+			if (record.Size == file.Size && record.WriteTime == file.WriteTime)
+			{
+				// Files, that are not assets, are remembered by their path and write time, so that they are not imported on every start
+				file.IsAsset = record.IsAsset;
+				file.State = record.IsAsset ? AssetFileState::Unchanged : AssetFileState::Ignored;
+				continue;
+			}
+
+			file.State = AssetFileState::Modified;
+			filesToHash.push_back(i);
+		}
+
+		m_Progress.FilesToHash = (uint32)filesToHash.size();
+		std::atomic<uint64> hashedBytes = 0;
+		std::vector<uint8> hashedFiles(m_Files.size(), 0);
+
+		ThreadPool::Get().ParallelFor((uint32)filesToHash.size(), 16, [&](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+			{
+				AssetScanFile &file = m_Files[filesToHash[i]];
+				uint64 previousHash = file.ContentHash;
+				uint64 bytesRead = 0;
+
+				if (!HashFileContent(FileSystemPath(file.FilePath), file.ContentHash, &bytesRead))
+					continue;
+
+				hashedFiles[filesToHash[i]] = 1;
+
+				// Only the write time has changed, for example after the file has been checked out again
+				if (file.State == AssetFileState::Modified && file.ContentHash == previousHash)
+					file.State = AssetFileState::Unchanged;
+
+				hashedBytes.fetch_add(bytesRead);
+				m_Progress.HashedCount.fetch_add(1);
+			}
+		});
+
+		MatchMovedFiles(hashedFiles);
+
+		for (const AssetScanFile &file : m_Files)
+		{
+			switch (file.State)
+			{
+				case AssetFileState::Added:
+					++m_Report.AddedCount;
+					break;
+
+				case AssetFileState::Modified:
+					++m_Report.ModifiedCount;
+					break;
+
+				case AssetFileState::Unchanged:
+					++m_Report.UnchangedCount;
+					break;
+
+				case AssetFileState::Moved:
+					++m_Report.MovedCount;
+					break;
+
+				case AssetFileState::Ignored:
+					++m_Report.IgnoredCount;
+					break;
+			}
+		}
+
+		for (const auto &[filePath, record] : m_Manifest)
+		{
+			if (!record.Found)
+				++m_Report.RemovedCount;
+		}
+
+		m_Report.HashedCount = m_Progress.HashedCount;
+		m_Report.HashedBytes = hashedBytes;
+	}
+
+	void AssetDirectoryScanner::MatchMovedFiles(const std::vector<uint8> &hashedFiles)
+	{
+		// The assets of the manifest, whose paths have disappeared, by their content
+		std::unordered_multimap<uint64, std::pair<const HLString, ManifestRecord>*> orphans;
+		for (auto &entry : m_Manifest)
+		{
+			const ManifestRecord &record = entry.second;
+			if (!record.Found && record.IsAsset && record.Handle != 0)
+				orphans.emplace(record.ContentHash, &entry);
+		}
+
+		if (orphans.empty())
+			return;
+
+		// A new file with the same content as a disappeared asset has been renamed or moved while the engine was not running.
+		// The files are sorted, so copies of the same content are matched in the same order on every run.
+		for (uint32 i = 0; i < (uint32)m_Files.size(); ++i)
+		{
+			AssetScanFile &file = m_Files[i];
+			if (file.State != AssetFileState::Added || !hashedFiles[i])
+				continue;
+
+			auto [begin, end] = orphans.equal_range(file.ContentHash);
+			for (auto it = begin; it != end; ++it)
+			{
+				auto &[previousFilePath, record] = *it->second;
+				if (record.Size != file.Size)
+					continue;
+
+				record.Found = true;
+				file.Handle = record.Handle;
+				file.State = AssetFileState::Moved;
+				file.PreviousFilePath = previousFilePath;
+				orphans.erase(it);
+				break;
+			}
+		}
+	}
+}
+
@@ -0,0 +1,185 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Remembered files, that are not assets, and kept the handles of files, that have been renamed while the engine was not running
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <filesystem>
+
+#include "Asset.h"
+#include "Engine/Core/FileSystemPath.h"
+
+#define HL_ASSET_MANIFEST_MAGIC 0x4D414C48 // "HLAM"
+#define HL_ASSET_MANIFEST_VERSION 2
+
+#define HL_ASSET_MANIFEST_FLAG_NOT_AN_ASSET 0x1
+
+namespace highlo
+{
+	enum class AssetScanStage : uint32
+	{
+		Idle = 0,
+		Crawling,		/**< The directories are walked by the thread pool. */
+		Hashing,		/**< The content of new and touched files is hashed by the thread pool. */
+		Importing,		/**< The new and changed files are imported into the registry on the main thread. */
+		Done
+	};
+
+	enum class AssetFileState : uint32
+	{
+		Added = 0,		/**< The file is not contained in the manifest. */
+		Modified,		/**< The content of the file has changed since the manifest has been written. */
+		Unchanged,		/**< The file has the same content as in the manifest, it does not have to be imported again. */
+		Moved,			/**< The file is not contained in the manifest, but has the same content as a file, that has disappeared since. It keeps the handle of that file. */
+		Ignored			/**< The file has not been an asset during the last scan and has not changed since, it is not imported. */
+	};
+
+	struct AssetScanFile
+	{
+		HLString FilePath;
+		uint64 Size = 0;
+		int64 WriteTime = 0;
+		uint64 ContentHash = 0;
+		AssetHandle Handle = 0;		/**< The handle from the manifest, has to be set by the importer for new files. */
+		AssetFileState State = AssetFileState::Added;
+		bool IsAsset = true;		/**< Has to be cleared by the importer for files, that are not assets, so that they are ignored by the next scan. */
+		HLString PreviousFilePath;	/**< The path of the disappeared file, if the file has been moved. */
+	};
+
+	/// <summary>
+	/// Can be polled from any thread while a scan is running, for example to show a loading screen.
+	/// </summary>
+	struct AssetScanProgress
+	{
+		std::atomic<AssetScanStage> Stage = AssetScanStage::Idle;
+		std::atomic<uint32> DirectoryCount = 0;
+		std::atomic<uint32> FileCount = 0;
+		std::atomic<uint32> FilesToHash = 0;
+		std::atomic<uint32> HashedCount = 0;
+		std::atomic<uint32> ImportedCount = 0;
+	};
+
+	struct AssetScanReport
+	{
+		uint32 DirectoryCount = 0;
+		uint32 FileCount = 0;
+		uint32 AddedCount = 0;
+		uint32 ModifiedCount = 0;
+		uint32 UnchangedCount = 0;
+		uint32 MovedCount = 0;
+		uint32 IgnoredCount = 0;
+		uint32 RemovedCount = 0;
+		uint32 HashedCount = 0;
+		uint64 HashedBytes = 0;
+
+		float CrawlMs = 0.0f;
+		float HashMs = 0.0f;
+		float ImportMs = 0.0f;
+	};
+
+	/// <summary>
+	/// The header at the beginning of the manifest, it is followed by one entry per file and the string table with the file paths.
+	/// </summary>
+	struct AssetManifestHeader
+	{
+		uint32 Magic = HL_ASSET_MANIFEST_MAGIC;
+		uint32 Version = HL_ASSET_MANIFEST_VERSION;
+		uint32 EntryCount = 0;
+		uint32 StringTableSize = 0;
+		uint64 ImportFilterHash = 0;
+	};
+
+	struct AssetManifestEntry
+	{
+		uint64 Handle = 0;
+		uint64 ContentHash = 0;
+		uint64 Size = 0;
+		int64 WriteTime = 0;
+		uint32 PathOffset = 0;
+		uint32 PathLength = 0;
+		uint32 Flags = 0;
+		uint32 Padding = 0;
+	};
+
+	/// <summary>
+	/// Walks the asset directory on the thread pool, with one job per subdirectory, and compares the found files against the manifest of the last scan.
+	/// Files, whose size and write time have not changed, are trusted without reading them. All other files are hashed,
+	/// so that touched but unchanged files are still detected as unchanged and renamed files are matched with the handle of their old path.
+	/// </summary>
+	class AssetDirectoryScanner
+	{
+	public:
+
+		HLAPI AssetDirectoryScanner() = default;
+
+		HL_NON_COPYABLE(AssetDirectoryScanner);
+
+		/// <summary>
+		/// Loads the manifest of the last scan, without a manifest all files are reported as added.
+		/// The import filter hash identifies the file types, that the importer accepts. If it differs from the manifest,
+		/// the files, that have not been assets before, are imported again.
+		/// </summary>
+		HLAPI bool LoadManifest(const FileSystemPath &manifestPath, uint64 importFilterHash = 0);
+
+		/// <summary>
+		/// Writes the files of the last scan, including the handles that have been assigned by the importer, as the new manifest.
+		/// </summary>
+		HLAPI bool WriteManifest(const FileSystemPath &manifestPath) const;
+
+		/// <summary>
+		/// Crawls the directory and classifies every found file, blocks until the scan is finished.
+		/// </summary>
+		HLAPI std::vector<AssetScanFile> &Scan(const FileSystemPath &rootDirectory);
+
+		/// <summary>
+		/// Should be called after the importer has processed the files of the scan, to complete the report.
+		/// </summary>
+		HLAPI void FinishImport(float importMs);
+
+		HLAPI std::vector<AssetScanFile> &GetFiles() { return m_Files; }
+		HLAPI const AssetScanProgress &GetProgress() const { return m_Progress; }
+		HLAPI const AssetScanReport &GetReport() const { return m_Report; }
+
+		/// <summary>
+		/// Computes a 64 bit hash of the file content, the file is read in blocks.
+		/// </summary>
+		HLAPI static bool HashFileContent(const FileSystemPath &filePath, uint64 &outHash, uint64 *outBytesRead = nullptr);
+
+	private:
+
+		struct ManifestRecord
+		{
+			AssetHandle Handle = 0;
+			uint64 ContentHash = 0;
+			uint64 Size = 0;
+			int64 WriteTime = 0;
+			bool IsAsset = true;
+			bool Found = false;
+		};
+
+		void Crawl(const std::filesystem::path &rootDirectory);
+		void SubmitDirectory(const std::filesystem::path &directory);
+		void CrawlDirectory(const std::filesystem::path &directory);
+		void ClassifyFiles();
+		void MatchMovedFiles(const std::vector<uint8> &hashedFiles);
+
+		std::unordered_map<HLString, ManifestRecord> m_Manifest;
+		std::vector<AssetScanFile> m_Files;
+		AssetScanProgress m_Progress;
+		AssetScanReport m_Report;
+		uint64 m_ImportFilterHash = 0;
+
+		// Shared with the crawl jobs
+		std::mutex m_CrawlMutex;
+		std::condition_variable m_CrawlFinished;
+		uint32 m_PendingDirectories = 0;
+	};
+}
+
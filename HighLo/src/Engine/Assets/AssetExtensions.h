@@ -22,6 +22,7 @@ namespace highlo
 		{ "hldmesh", AssetType::DynamicMesh },
 		{ "hlmaterial", AssetType::Material },
 		{ "hlfont", AssetType::Font },
+		{ "hlanim", AssetType::AnimationClip },
 		
 		// global file extensions
 		{ "fbx", AssetType::MeshAsset },
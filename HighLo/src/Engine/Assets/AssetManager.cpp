@@ -10,32 +10,39 @@
 #include "AssetExtensions.h"
 
 #include "Engine/Scene/Project.h"
-#include "Engine/Loaders/DocumentWriter.h"
-#include "Engine/Loaders/DocumentReader.h"
 
 #define ASSET_MANAGER_LOG_PREFIX "AManager>     "
 
 namespace highlo
 {
-	static AssetMetaData s_NullMetaData;
+	namespace utils
+	{
+		static uint64 GetAssetExtensionsHash()
+		{
+			// Independent of the iteration order of the map
+			uint64 hash = 0;
+			for (const auto &[extension, type] : s_AssetExtesions)
+				hash += MixUUID(extension.Hash() ^ (uint64)type);
+
+			return hash;
+		}
+	}
+
 	std::unordered_map<AssetHandle, Ref<Asset>> AssetManager::s_LoadedAssets;
 	std::unordered_map<AssetHandle, Ref<Asset>> AssetManager::s_MemoryAssets;
 
-	struct AssetRegistryEntry
-	{
-		FileSystemPath FilePath;
-		AssetType Type;
-	};
-
 	void AssetManager::Init()
 	{
 		LoadAssetRegistry();
+		s_RegistryJournal.Start(AssetRegistryFile::GetJournalPath(Project::GetAssetRegistryPath()));
 		ReloadAllAssets();
 	}
 
 	void AssetManager::Shutdown()
 	{
+		s_AsyncLoader.Shutdown();
 		WriteRegistryToFile();
+		s_RegistryJournal.Stop();
 
 		s_AssetRegistry.Clear();
 		s_LoadedAssets.clear();
@@ -48,23 +55,18 @@ namespace highlo
 		dispatcher.Dispatch<FileSystemChangedEvent>(HL_BIND_EVENT_FUNCTION(AssetManager::OnFileSystemChangedEvent));
 	}
 
-	AssetMetaData &AssetManager::GetMetaData(AssetHandle handle)
+	AssetMetaData AssetManager::GetMetaData(AssetHandle handle)
 	{
-		for (auto &[path, metaData] : s_AssetRegistry)
-		{
-			if (metaData.Handle == handle)
-				return metaData;
-		}
-
-		return s_NullMetaData;
+		AssetMetaData metaData;
+		s_AssetRegistry.TryGet(handle, metaData);
+		return metaData;
 	}
 
-	AssetMetaData &AssetManager::GetMetaData(const FileSystemPath &path)
+	AssetMetaData AssetManager::GetMetaData(const FileSystemPath &path)
 	{
-		if (s_AssetRegistry.Contains(path))
-			return s_AssetRegistry[path];
-
-		return s_NullMetaData;
+		AssetMetaData metaData;
+		s_AssetRegistry.TryGet(path, metaData);
+		return metaData;
 	}
 
 	FileSystemPath AssetManager::GetFileSystemPath(const AssetMetaData &metaData)
@@ -83,7 +85,7 @@ namespace highlo
 
 	AssetHandle AssetManager::GetAssetHandleFromFilePath(const FileSystemPath &path)
 	{
-		return s_AssetRegistry.Contains(*path) ? s_AssetRegistry[*path].Handle : 0;
+		return s_AssetRegistry.GetHandle(path);
 	}
 
 	AssetType AssetManager::GetAssetTypeFromExtension(HLString &extension)
@@ -104,8 +106,8 @@ namespace highlo
 	{
 		FileSystemPath relativePath = path.RelativePath();
 
-		if (s_AssetRegistry.Contains(relativePath))
-			return s_AssetRegistry[relativePath].Handle;
+		if (AssetHandle handle = s_AssetRegistry.GetHandle(relativePath))
+			return handle;
 
 		AssetType type = GetAssetTypeFromPath(relativePath);
 		if (type == AssetType::None)
@@ -115,29 +117,104 @@ namespace highlo
 		assetInfo.Handle = AssetHandle(); // New UUID
 		assetInfo.FilePath = relativePath;
 		assetInfo.Type = type;
-		s_AssetRegistry[assetInfo.FilePath] = assetInfo;
+		s_AssetRegistry.Add(assetInfo.FilePath, assetInfo);
+		s_RegistryJournal.RecordAdd(assetInfo);
 
 		return assetInfo.Handle;
 	}
 
 	bool AssetManager::ReloadAsset(AssetHandle handle)
 	{
-		AssetMetaData &assetInfo = GetMetaData(handle);
+		AssetMetaData assetInfo = GetMetaData(handle);
 		if (!assetInfo.IsDataLoaded)
 		{
 			HL_CORE_WARN(ASSET_MANAGER_LOG_PREFIX "[-] Trying to load asset '{0}', but it was never loaded before! [-]", *assetInfo.FilePath);
 
 			Ref<Asset> asset;
 			assetInfo.IsDataLoaded = AssetImporter::TryLoadData(assetInfo, asset);
+			s_AssetRegistry.SetDataLoaded(handle, assetInfo.IsDataLoaded);
 			return assetInfo.IsDataLoaded;
 		}
 
 		HL_ASSERT(s_LoadedAssets.find(handle) != s_LoadedAssets.end());
 		Ref<Asset> &asset = s_LoadedAssets.at(handle);
 		assetInfo.IsDataLoaded = AssetImporter::TryLoadData(assetInfo, asset);
+		s_AssetRegistry.SetDataLoaded(handle, assetInfo.IsDataLoaded);
 		return assetInfo.IsDataLoaded;
 	}
 
+	void AssetManager::ProcessAsyncLoads()
+	{
+		if (s_AsyncLoader.GetPendingCount() == 0)
+			return;
+
+		std::vector<Ref<AssetLoadRequest>> finished;
+		s_AsyncLoader.Finalize(s_AsyncLoadBudgetMs, finished);
+
+		for (const Ref<AssetLoadRequest> &request : finished)
+			RegisterAsyncLoad(request);
+	}
+
+	Ref<AssetLoadRequest> AssetManager::RequestAsyncLoad(AssetHandle handle, AssetLoadPriority priority, const std::vector<AssetHandle> &dependencies)
+	{
+		Ref<AssetLoadRequest> request = Ref<AssetLoadRequest>::Create();
+		request->MetaData.Handle = handle;
+
+		if (IsMemoryAsset(handle))
+		{
+			request->LoadedAsset = s_MemoryAssets[handle];
+			request->State = AssetLoadState::Loaded;
+			return request;
+		}
+
+		AssetMetaData assetInfo = GetMetaData(handle);
+		if (!assetInfo.IsValid())
+		{
+			HL_CORE_ERROR(ASSET_MANAGER_LOG_PREFIX "[-] Trying to load unknown asset {0} asynchronously! [-]", handle);
+			request->State = AssetLoadState::Failed;
+			return request;
+		}
+
+		if (assetInfo.IsDataLoaded)
+		{
+			request->MetaData = assetInfo;
+			request->LoadedAsset = s_LoadedAssets[handle];
+			request->State = AssetLoadState::Loaded;
+			return request;
+		}
+
+		// Dependencies are queued with the same priority, so that they are not starved by less important requests
+		for (AssetHandle dependency : dependencies)
+		{
+			if (!IsMemoryAsset(dependency) && !GetMetaData(dependency).IsDataLoaded)
+				RequestAsyncLoad(dependency, priority, {});
+		}
+
+		// The worker threads must not access the registry, so the path is resolved up front
+		AssetMetaData resolvedInfo = assetInfo;
+		resolvedInfo.FilePath = GetFileSystemPath(assetInfo);
+		return s_AsyncLoader.Enqueue(resolvedInfo, priority, dependencies);
+	}
+
+	void AssetManager::FinishAsyncLoad(AssetHandle handle)
+	{
+		Ref<AssetLoadRequest> request = s_AsyncLoader.Complete(handle);
+		if (request)
+			RegisterAsyncLoad(request);
+	}
+
+	void AssetManager::RegisterAsyncLoad(const Ref<AssetLoadRequest> &request)
+	{
+		if (request->State != AssetLoadState::Loaded)
+			return;
+
+		// The asset might have been removed from the registry while it was loaded
+		if (!s_AssetRegistry.SetDataLoaded(request->MetaData.Handle, true))
+			return;
+
+		s_LoadedAssets[request->MetaData.Handle] = request->LoadedAsset;
+	}
+
 	bool AssetManager::AssetExists(AssetMetaData &metaData)
 	{
 		return FileSystem::Get()->FileExists(Project::GetActive()->GetAssetDirectory() / metaData.FilePath);
@@ -145,73 +222,82 @@ namespace highlo
 
 	void AssetManager::LoadAssetRegistry()
 	{
-		FileSystemPath assetRegistryPath = Project::GetAssetRegistryPath();
-		if (!FileSystem::Get()->FileExists(assetRegistryPath))
-			return;
-
-		// TODO
+		// Without a valid registry all assets are discovered again by the directory scan
+		AssetRegistryFile::Read(Project::GetAssetRegistryPath(), s_AssetRegistry);
 	}
 
 	void AssetManager::WriteRegistryToFile()
 	{
-		FileSystemPath assetRegistryPath = Project::GetAssetRegistryPath();
-		Ref<DocumentWriter> writer = DocumentWriter::Create(assetRegistryPath, DocumentType::Json);
+		// The journal only contains changes, that are part of the new snapshot, so it can be discarded afterwards
+		s_RegistryJournal.Flush();
+		if (AssetRegistryFile::Write(Project::GetAssetRegistryPath(), s_AssetRegistry))
+			s_RegistryJournal.Reset();
+	}
+
+	void AssetManager::ReloadAllAssets()
+	{
+		FileSystemPath manifestPath = Project::GetCacheDirectory() / "AssetManifest.hlcache";
+		s_AssetScanner.LoadManifest(manifestPath, utils::GetAssetExtensionsHash());
 
-		std::map<UUID, AssetRegistryEntry> sortedAssets;
-		for (auto &[filePath, assetInfo] : s_AssetRegistry)
+		std::vector<AssetScanFile> &files = s_AssetScanner.Scan(Project::GetAssetDirectory());
+
+		auto importStart = std::chrono::steady_clock::now();
+		std::unordered_set<AssetHandle> discovered;
+		discovered.reserve(files.size());
+
+		for (AssetScanFile &file : files)
 		{
-			if (!FileSystem::Get()->FileExists(GetFileSystemPath(assetInfo)))
+			if (file.State == AssetFileState::Ignored)
 				continue;
 
-			FileSystemPath pathToSerialize = assetInfo.FilePath;
-			HLString pathStr = pathToSerialize.String();
-
-			if (pathStr.Contains("\\"))
+			// Unchanged files keep the handle from the manifest, as long as the registry still knows it
+			if (file.State == AssetFileState::Unchanged && file.Handle != 0 && s_AssetRegistry.Contains(file.Handle))
 			{
-				pathStr = pathStr.Replace("\\", "/");
+				discovered.insert(file.Handle);
+				continue;
 			}
 
-			sortedAssets[assetInfo.Handle] = { FileSystemPath(pathStr), assetInfo.Type };
-		}
+			// Renamed or moved while the engine was not running, the registry still knows the asset by its old path
+			if (file.State == AssetFileState::Moved && s_AssetRegistry.Contains(file.Handle))
+			{
+				OnAssetRenamed(file.Handle, FileSystemPath(file.FilePath));
+				discovered.insert(file.Handle);
+				continue;
+			}
 
-		HL_CORE_INFO(ASSET_MANAGER_LOG_PREFIX "[+] Serializing asset registry with {0} entries [+]", sortedAssets.size());
+			file.Handle = ImportAsset(FileSystemPath(file.FilePath));
+			if (file.Handle == 0)
+			{
+				file.IsAsset = false;
+				continue;
+			}
 
-		writer->BeginArray();
-		for (auto &[handle, entry] : sortedAssets)
-		{
-			writer->BeginObject();
-			writer->WriteUInt64("Handle", (uint64)handle);
-			writer->WriteString("FilePath", entry.FilePath.String());
-			writer->WriteString("AssetType", utils::AssetTypeToString(entry.Type));
-			writer->EndObject();
+			discovered.insert(file.Handle);
+			if (file.State == AssetFileState::Modified && s_LoadedAssets.find(file.Handle) != s_LoadedAssets.end())
+				ReloadAsset(file.Handle);
 		}
-		writer->EndArray();
 
-		writer->WriteOut();
-	}
+		s_AssetScanner.FinishImport(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - importStart).count());
+		s_AssetScanner.WriteManifest(manifestPath);
 
-	void AssetManager::ProcessDirectory(const FileSystemPath &dirPath)
-	{
-		std::vector<File> fileList = dirPath.GetFileList();
-		for (uint32 i = 0; i < fileList.size(); ++i)
+		const AssetScanReport &report = s_AssetScanner.GetReport();
+		HL_CORE_INFO(ASSET_MANAGER_LOG_PREFIX "[+] Scanned {0} files in {1} directories: {2} added, {3} modified, {4} unchanged, {5} moved, {6} ignored, {7} removed [+]",
+			report.FileCount, report.DirectoryCount, report.AddedCount, report.ModifiedCount, report.UnchangedCount, report.MovedCount, report.IgnoredCount, report.RemovedCount);
+		HL_CORE_INFO(ASSET_MANAGER_LOG_PREFIX "[+] Crawl {0:.1f} ms, hashing {1} files ({2} KB) {3:.1f} ms, import {4:.1f} ms [+]",
+			report.CrawlMs, report.HashedCount, report.HashedBytes / 1024, report.HashMs, report.ImportMs);
+
+		// Entries of the loaded registry, whose files have been deleted while the engine was not running, are not found by the scan.
+		// This replaces checking every single entry against the file system.
+		std::vector<AssetHandle> missing;
+		for (auto &[handle, assetInfo] : s_AssetRegistry)
 		{
-			File entry = fileList[i];
-			if (!entry.IsFile)
-			{
-			//	HL_CORE_TRACE(ASSET_MANAGER_LOG_PREFIX "[=] Discovering path {0} [=]", *entry.Name);
-				ProcessDirectory(entry.FullPath);
-			}
-			else
-			{
-			//	HL_CORE_TRACE(ASSET_MANAGER_LOG_PREFIX "[=] Importing asset {0} [=]", *entry.Name);
-				ImportAsset(entry.FullPath);
-			}
+			if (discovered.find(handle) == discovered.end())
+				missing.push_back(handle);
 		}
-	}
 
-	void AssetManager::ReloadAllAssets()
-	{
-		ProcessDirectory(Project::GetAssetDirectory());
+		for (AssetHandle handle : missing)
+			s_AssetRegistry.Remove(handle);
+
 		WriteRegistryToFile();
 	}
 
@@ -224,27 +310,28 @@ namespace highlo
 			switch (e.Action)
 			{
 				case FileSystemAction::Added:
-					AssetManager::Get()->ImportAsset(e.FilePath);
-					break;
-
-				case FileSystemAction::Deleted:
-					AssetManager::Get()->OnAssetDeleted(AssetManager::Get()->GetAssetHandleFromFilePath(e.FilePath));
-					break;
-
 				case FileSystemAction::Modified:
 				{
+					// Atomic saves replace a known file, so both actions reload known assets and import unknown ones
 					AssetHandle handle = GetAssetHandleFromFilePath(e.FilePath);
-					const auto &assetInfo = GetMetaData(handle);
+					AssetMetaData assetInfo = GetMetaData(handle);
 
-					if (assetInfo.IsValid() && assetInfo.IsDataLoaded)
+					if (!assetInfo.IsValid())
+						AssetManager::Get()->ImportAsset(e.FilePath);
+					else if (assetInfo.IsDataLoaded)
 						ReloadAsset(handle);
 
 					break;
 				}
 
+				case FileSystemAction::Deleted:
+					AssetManager::Get()->OnAssetDeleted(AssetManager::Get()->GetAssetHandleFromFilePath(e.FilePath));
+					break;
+
 				case FileSystemAction::Renamed:
 				{
-					AssetType prevType = AssetManager::Get()->GetAssetTypeFromPath(e.OldName);
+					FileSystemPath oldFilePath = e.OldFilePath.IsEmpty() ? e.FilePath.ParentPath() / e.OldName : e.OldFilePath;
+					AssetType prevType = AssetManager::Get()->GetAssetTypeFromPath(oldFilePath);
 					AssetType type = AssetManager::Get()->GetAssetTypeFromPath(e.FilePath);
 
 					if (prevType == AssetType::None && type != AssetType::None)
@@ -253,7 +340,12 @@ namespace highlo
 					}
 					else
 					{
-						OnAssetRenamed(AssetManager::Get()->GetAssetHandleFromFilePath(e.FilePath.ParentPath() / e.OldName), e.FilePath);
+						AssetHandle handle = AssetManager::Get()->GetAssetHandleFromFilePath(oldFilePath);
+						if (oldFilePath.ParentPath() == e.FilePath.ParentPath())
+							OnAssetRenamed(handle, e.FilePath);
+						else
+							OnAssetMoved(handle, e.FilePath.ParentPath());
+
 						e.Tracking = true;
 					}
 					break;
@@ -272,22 +364,20 @@ namespace highlo
 
 		s_AssetRegistry.Remove(assetInfo.FilePath);
 		assetInfo.FilePath = s_AssetRegistry.GetKey(newFilePath);
-		s_AssetRegistry[assetInfo.FilePath] = assetInfo;
-		
-		AssetManager::Get()->WriteRegistryToFile();
+		s_AssetRegistry.Add(assetInfo.FilePath, assetInfo);
+		s_RegistryJournal.RecordAdd(assetInfo);
 	}
 
-	void AssetManager::OnAssetMoved(AssetHandle handle, FileSystemPath &destinationFilePath)
+	void AssetManager::OnAssetMoved(AssetHandle handle, const FileSystemPath &destinationDirectory)
 	{
 		AssetMetaData assetInfo = AssetManager::Get()->GetMetaData(handle);
 		if (!assetInfo.IsValid())
 			return;
 
 		s_AssetRegistry.Remove(assetInfo.FilePath);
-		assetInfo.FilePath = destinationFilePath / assetInfo.FilePath;
-		s_AssetRegistry[assetInfo.FilePath] = assetInfo;
-
-		AssetManager::Get()->WriteRegistryToFile();
+		assetInfo.FilePath = s_AssetRegistry.GetKey(destinationDirectory / assetInfo.FilePath.Filename());
+		s_AssetRegistry.Add(assetInfo.FilePath, assetInfo);
+		s_RegistryJournal.RecordAdd(assetInfo);
 	}
 
 	void AssetManager::OnAssetDeleted(AssetHandle handle)
@@ -296,10 +386,9 @@ namespace highlo
 		if (!assetInfo.IsValid())
 			return;
 
-		s_AssetRegistry.Remove(assetInfo.FilePath);
+		s_AssetRegistry.Remove(handle);
 		s_LoadedAssets.erase(handle);
-
-		AssetManager::Get()->WriteRegistryToFile();
+		s_RegistryJournal.RecordRemove(handle);
 	}
 
 	void AssetManager::OnUIRender(bool &openui)
@@ -326,7 +415,7 @@ namespace highlo
 				ImGui::SetColumnWidth(0, assetManagerColumnWidth);
 			}
 
-			for (const auto &[path, assetInfo] : s_AssetRegistry)
+			for (const auto &[handle, assetInfo] : s_AssetRegistry)
 			{
 				HLString handleStr = fmt::format("{0}", assetInfo.Handle);
 				HLString filePath = assetInfo.FilePath.String();
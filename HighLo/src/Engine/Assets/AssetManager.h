@@ -2,6 +2,12 @@
 
 //
 // version history:
+//     - 2.0 (2026-10-19) The meta data is returned as a copy of the registry entry, the directory scan skips files, that are not assets, and keeps the handles of files, that have been renamed while the engine was not running
+//     - 1.9 (2026-10-19) Moves between directories keep the asset handle and atomic saves reload the asset
+//     - 1.8 (2026-10-19) Scan the asset directory in parallel and skip unchanged files with a content hash manifest
+//     - 1.7 (2026-10-19) Replaced the JSON registry with a binary snapshot and a journal, that is written in the background
+//     - 1.6 (2026-10-19) Metadata lookups by handle go through the handle index of the AssetRegistry
+//     - 1.5 (2026-10-19) Added asynchronous asset loading with priorities, dependencies and a per frame budget
 //     - 1.4 (2022-01-21) Added missing TODOs
 //     - 1.3 (2021-10-04) Refactored initialization to use the FileSystemWatcher instead of FileSystem class
 //     - 1.2 (2021-09-22) Changed AssetManager to be a Singleton class
@@ -11,8 +17,13 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "Asset.h"
 #include "AssetRegistry.h"
+#include "AssetRegistryFile.h"
+#include "AssetDirectoryScanner.h"
+#include "AsyncAssetLoader.h"
 
 #include "Engine/Core/FileSystemPath.h"
 #include "Engine/Events/Events.h"
@@ -45,9 +56,10 @@ namespace highlo
 		HLAPI const AssetRegistry &GetAssetRegistry() { return s_AssetRegistry; }
 		HLAPI const std::unordered_map<AssetHandle, Ref<Asset>> &GetLoadedAssets() { return s_LoadedAssets; }
 
-		HLAPI AssetMetaData &GetMetaData(AssetHandle handle);
-		HLAPI AssetMetaData &GetMetaData(const FileSystemPath &path);
-		HLAPI AssetMetaData &GetMetaData(const Ref<Asset> &asset) { return GetMetaData(asset->Handle); }
+		// The meta data is returned as a copy, changes have to go through the AssetManager
+		HLAPI AssetMetaData GetMetaData(AssetHandle handle);
+		HLAPI AssetMetaData GetMetaData(const FileSystemPath &path);
+		HLAPI AssetMetaData GetMetaData(const Ref<Asset> &asset) { return GetMetaData(asset->Handle); }
 
 		HLAPI FileSystemPath GetFileSystemPath(const AssetMetaData &metaData);
 		HLAPI FileSystemPath GetRelativePath(const FileSystemPath &path);
@@ -123,8 +135,8 @@ namespace highlo
 				}
 			}
 
-			s_AssetRegistry[assetInfo.FilePath.Absolute()] = assetInfo;
-			WriteRegistryToFile();
+			s_AssetRegistry.Add(assetInfo.FilePath.Absolute(), assetInfo);
+			s_RegistryJournal.RecordAdd(assetInfo);
 
 			Ref<Asset> asset = Ref<T>::Create(std::forward<Args>(args)...);
 			asset->Handle = assetInfo.Handle;
@@ -140,10 +152,21 @@ namespace highlo
 			if (IsMemoryAsset(handle))
 				return s_MemoryAssets[handle].As<T>();
 
-			auto &assetInfo = GetMetaData(handle);
+			AssetMetaData assetInfo = GetMetaData(handle);
 			if (!assetInfo.IsValid())
 				return nullptr;
 
+			// An asset that is still loaded in the background is finished right away instead of being loaded a second time
+			if (!assetInfo.IsDataLoaded && s_AsyncLoader.IsLoading(handle))
+			{
+				FinishAsyncLoad(handle);
+
+				// assetInfo is a copy, so the loaded state has to be read again from the registry
+				assetInfo = GetMetaData(handle);
+				if (!assetInfo.IsValid())
+					return nullptr;
+			}
+
 			Ref<Asset> asset = nullptr;
 			if (!assetInfo.IsDataLoaded)
 			{
@@ -151,6 +174,7 @@ namespace highlo
 				if (!assetInfo.IsDataLoaded)
 					return nullptr;
 
+				s_AssetRegistry.SetDataLoaded(handle, true);
 				s_LoadedAssets[handle] = asset;
 			}
 			else
@@ -167,20 +191,61 @@ namespace highlo
 			return GetAsset<T>(GetAssetHandleFromFilePath(path));
 		}
 
+		/// <summary>
+		/// Starts loading the asset in the background and returns immediately.
+		/// The asset is only finalized after all of its dependencies (for example the textures of a material) have been loaded,
+		/// until then the returned future provides a placeholder asset.
+		/// </summary>
+		template<typename T>
+		HLAPI AssetFuture<T> LoadAssetAsync(AssetHandle handle, AssetLoadPriority priority = AssetLoadPriority::Normal, const std::vector<AssetHandle> &dependencies = {})
+		{
+			static_assert(std::is_base_of<Asset, T>::value, "LoadAssetAsync only works for types derived from Asset");
+
+			Ref<Asset> placeholder = AsyncAssetLoader::GetPlaceholder(T::GetStaticType());
+			return AssetFuture<T>(RequestAsyncLoad(handle, priority, dependencies), placeholder);
+		}
+
+		template<typename T>
+		HLAPI AssetFuture<T> LoadAssetAsync(const FileSystemPath &path, AssetLoadPriority priority = AssetLoadPriority::Normal, const std::vector<AssetHandle> &dependencies = {})
+		{
+			return LoadAssetAsync<T>(GetAssetHandleFromFilePath(path), priority, dependencies);
+		}
+
+		/// <summary>
+		/// Finalizes the assets that have been decoded in the background, is called once per frame by the engine.
+		/// </summary>
+		HLAPI void ProcessAsyncLoads();
+
+		/// <summary>
+		/// Sets the time in milliseconds that may be spent per frame to finalize background loads, for example to upload textures to the GPU.
+		/// </summary>
+		HLAPI void SetAsyncLoadBudget(float budgetMs) { s_AsyncLoadBudgetMs = budgetMs; }
+		HLAPI float GetAsyncLoadBudget() const { return s_AsyncLoadBudgetMs; }
+		HLAPI uint32 GetPendingAsyncLoadCount() const { return s_AsyncLoader.GetPendingCount(); }
+
+		/// <summary>
+		/// Returns the progress of the startup scan of the asset directory, can be polled from any thread.
+		/// </summary>
+		HLAPI const AssetScanProgress &GetAssetScanProgress() const { return s_AssetScanner.GetProgress(); }
+		HLAPI const AssetScanReport &GetAssetScanReport() const { return s_AssetScanner.GetReport(); }
+
 		HLAPI bool AssetExists(AssetMetaData &metaData);
 		HLAPI void OnUIRender(bool &openui);
 
 	private:
 
+		Ref<AssetLoadRequest> RequestAsyncLoad(AssetHandle handle, AssetLoadPriority priority, const std::vector<AssetHandle> &dependencies);
+		void FinishAsyncLoad(AssetHandle handle);
+		void RegisterAsyncLoad(const Ref<AssetLoadRequest> &request);
+
 		void LoadAssetRegistry();
 		void WriteRegistryToFile();
 
-		void ProcessDirectory(const FileSystemPath &dirPath);
 		void ReloadAllAssets();
 		
 		bool OnFileSystemChangedEvent(FileSystemChangedEvent &e);
 		static void OnAssetRenamed(AssetHandle handle, const FileSystemPath &newFilePath);
-		static void OnAssetMoved(AssetHandle handle, FileSystemPath &destinationFilePath);
+		static void OnAssetMoved(AssetHandle handle, const FileSystemPath &destinationDirectory);
 		static void OnAssetDeleted(AssetHandle handle);
 
 	private:
@@ -188,6 +253,10 @@ namespace highlo
 		static std::unordered_map<AssetHandle, Ref<Asset>> s_LoadedAssets;
 		static std::unordered_map<AssetHandle, Ref<Asset>> s_MemoryAssets;
 		inline static AssetRegistry s_AssetRegistry;
+		inline static AssetRegistryJournal s_RegistryJournal;
+		inline static AssetDirectoryScanner s_AssetScanner;
+		inline static AsyncAssetLoader s_AsyncLoader;
+		inline static float s_AsyncLoadBudgetMs = 2.0f;
 
 	private:
 
@@ -5,17 +5,17 @@
 
 namespace highlo
 {
-	static const HLString s_DiffuseColorUniform = "u_MaterialUniforms.DiffuseColor";
-	static const HLString s_UseNormalMapUniform = "u_MaterialUniforms.UseNormalMap";
-	static const HLString s_MetalnessUniform = "u_MaterialUniforms.Metalness";
-	static const HLString s_RoughnessUniform = "u_MaterialUniforms.Roughness";
-	static const HLString s_EmissionUniform = "u_MaterialUniforms.Emission";
-	static const HLString s_TransparencyUniform = "u_MaterialUniforms.Transparency";
+	static const HLName s_DiffuseColorUniform = "u_MaterialUniforms.DiffuseColor";
+	static const HLName s_UseNormalMapUniform = "u_MaterialUniforms.UseNormalMap";
+	static const HLName s_MetalnessUniform = "u_MaterialUniforms.Metalness";
+	static const HLName s_RoughnessUniform = "u_MaterialUniforms.Roughness";
+	static const HLName s_EmissionUniform = "u_MaterialUniforms.Emission";
+	static const HLName s_TransparencyUniform = "u_MaterialUniforms.Transparency";
 
-	static const HLString s_DiffuseMapUniform = "u_DiffuseTexture";
-	static const HLString s_NormalMapUniform = "u_NormalTexture";
-	static const HLString s_MetalnessMapUniform = "u_MetalnessTexture";
-	static const HLString s_RoughnessMapUniform = "u_RoughnessTexture";
+	static const HLName s_DiffuseMapUniform = "u_DiffuseTexture";
+	static const HLName s_NormalMapUniform = "u_NormalTexture";
+	static const HLName s_MetalnessMapUniform = "u_MetalnessTexture";
+	static const HLName s_RoughnessMapUniform = "u_RoughnessTexture";
 
 	Ref<MaterialAsset> MaterialAsset::Create(bool transparent)
 	{
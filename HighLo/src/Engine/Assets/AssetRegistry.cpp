@@ -12,52 +12,125 @@ namespace highlo
 {
 	FileSystemPath AssetRegistry::GetKey(const FileSystemPath &path) const
 	{
-		auto key = path.RelativePath(Project::GetAssetDirectory());
-		if (key.String().IsEmpty())
-			key = path.LexicallyNormal();
-
-		return key;
+		return FileSystemPath(GetKeyString(path));
 	}
 
-	AssetMetaData &AssetRegistry::operator[](const FileSystemPath &path)
+	void AssetRegistry::Add(const FileSystemPath &path, const AssetMetaData &metaData)
 	{
-		FileSystemPath key = GetKey(path);
+		HLString key = GetKeyString(path);
 
 	#if SHOULD_SHOW_EVENTS
-		HL_CORE_INFO(ASSET_REGISTRY_LOG_PREFIX "[+] Retrieving Asset '{0}' with key '{1}' [+]", **path, **key);
+		HL_CORE_INFO(ASSET_REGISTRY_LOG_PREFIX "[+] Adding Asset '{0}' with key '{1}' [+]", **path, *key);
 	#endif // SHOULD_SHOW_EVENTS
 
-		HL_ASSERT(!key.String().IsEmpty());
-		return m_AssetRegistry[key];
+		HL_ASSERT(!key.IsEmpty());
+
+		std::unique_lock<std::shared_mutex> lock(m_Mutex);
+
+		// Keep the path index consistent, every path belongs to exactly one handle and every handle to exactly one path
+		AssetHandle previousHandle = FindHandle(key);
+		if (previousHandle != 0 && previousHandle != metaData.Handle)
+			RemoveEntry(previousHandle);
+
+		RemoveEntry(metaData.Handle);
+
+		m_PathIndex[key] = metaData.Handle;
+		m_KeysByHandle[metaData.Handle] = key;
+		m_Assets[metaData.Handle] = metaData;
+	}
+
+	bool AssetRegistry::TryGet(AssetHandle handle, AssetMetaData &outMetaData) const
+	{
+		std::shared_lock<std::shared_mutex> lock(m_Mutex);
+
+		auto it = m_Assets.find(handle);
+		if (it == m_Assets.end())
+			return false;
+
+		outMetaData = it->second;
+		return true;
 	}
 
-	const AssetMetaData &AssetRegistry::Get(const FileSystemPath &path) const
+	bool AssetRegistry::TryGet(const FileSystemPath &path, AssetMetaData &outMetaData) const
 	{
-		const auto key = GetKey(path);
+		HLString key = GetKeyString(path);
 
 	#if SHOULD_SHOW_EVENTS
-		HL_CORE_INFO(ASSET_REGISTRY_LOG_PREFIX "[+] Retrieving Asset '{0}' with key '{1}' [+]", **path, **key);
+		HL_CORE_INFO(ASSET_REGISTRY_LOG_PREFIX "[+] Retrieving Asset '{0}' with key '{1}' [+]", **path, *key);
 	#endif // SHOULD_SHOW_EVENTS
-		
-		HL_ASSERT(!key.String().IsEmpty());
-		return m_AssetRegistry.at(key);
+
+		std::shared_lock<std::shared_mutex> lock(m_Mutex);
+
+		auto it = m_Assets.find(FindHandle(key));
+		if (it == m_Assets.end())
+			return false;
+
+		outMetaData = it->second;
+		return true;
+	}
+
+	AssetHandle AssetRegistry::GetHandle(const FileSystemPath &path) const
+	{
+		HLString key = GetKeyString(path);
+
+		std::shared_lock<std::shared_mutex> lock(m_Mutex);
+		return FindHandle(key);
+	}
+
+	bool AssetRegistry::SetDataLoaded(AssetHandle handle, bool isDataLoaded)
+	{
+		std::unique_lock<std::shared_mutex> lock(m_Mutex);
+
+		auto it = m_Assets.find(handle);
+		if (it == m_Assets.end())
+			return false;
+
+		it->second.IsDataLoaded = isDataLoaded;
+		return true;
+	}
+
+	uint64 AssetRegistry::Count() const
+	{
+		std::shared_lock<std::shared_mutex> lock(m_Mutex);
+		return m_Assets.size();
+	}
+
+	bool AssetRegistry::Contains(AssetHandle handle) const
+	{
+		std::shared_lock<std::shared_mutex> lock(m_Mutex);
+		return m_Assets.find(handle) != m_Assets.end();
 	}
 
 	bool AssetRegistry::Contains(const FileSystemPath &path) const
 	{
-		auto key = GetKey(path);
-		return m_AssetRegistry.find(key) != m_AssetRegistry.end();
+		return GetHandle(path) != 0;
+	}
+
+	uint64 AssetRegistry::Remove(AssetHandle handle)
+	{
+		std::unique_lock<std::shared_mutex> lock(m_Mutex);
+
+		uint64 count = m_Assets.count(handle);
+		RemoveEntry(handle);
+		return count;
 	}
 
 	uint64 AssetRegistry::Remove(const FileSystemPath &path)
 	{
-		auto key = GetKey(path);
+		HLString key = GetKeyString(path);
 
 	#if SHOULD_SHOW_EVENTS
 		HL_CORE_INFO(ASSET_REGISTRY_LOG_PREFIX "[+] Removing Asset '{0}' [+]", **path);
 	#endif // SHOULD_SHOW_EVENTS
-		
-		return m_AssetRegistry.erase(key);
+
+		std::unique_lock<std::shared_mutex> lock(m_Mutex);
+
+		AssetHandle handle = FindHandle(key);
+		if (handle == 0)
+			return 0;
+
+		RemoveEntry(handle);
+		return 1;
 	}
 
 	void AssetRegistry::Clear()
@@ -66,7 +139,47 @@ namespace highlo
 		HL_CORE_INFO(ASSET_REGISTRY_LOG_PREFIX "[+] Removing all assets [+]");
 	#endif // SHOULD_SHOW_EVENTS
 
-		m_AssetRegistry.clear();
+		std::unique_lock<std::shared_mutex> lock(m_Mutex);
+		m_Assets.clear();
+		m_PathIndex.clear();
+		m_KeysByHandle.clear();
 	}
-}
 
+	HLString AssetRegistry::GetKeyString(const FileSystemPath &path) const
+	{
+		// The absolute path is resolved when the FileSystemPath is created,
+		// so the key is derived from strings only and needs neither the file system nor a lock
+		std::filesystem::path absolutePath = std::filesystem::path(*path.Absolute()).lexically_normal();
+
+		std::filesystem::path key;
+		if (Ref<Project> project = Project::GetActive())
+			key = absolutePath.lexically_relative(std::filesystem::absolute(*project->GetConfig().AssetDirectory).lexically_normal());
+
+		if (key.empty())
+			key = std::filesystem::path(*path.String()).lexically_normal();
+
+		return HLString(key.generic_string().c_str());
+	}
+
+	AssetHandle AssetRegistry::FindHandle(const HLString &key) const
+	{
+		auto it = m_PathIndex.find(key);
+		return it != m_PathIndex.end() ? it->second : AssetHandle(0);
+	}
+
+	void AssetRegistry::RemoveEntry(AssetHandle handle)
+	{
+		auto it = m_Assets.find(handle);
+		if (it == m_Assets.end())
+			return;
+
+		auto keyIt = m_KeysByHandle.find(handle);
+		if (keyIt != m_KeysByHandle.end())
+		{
+			m_PathIndex.erase(keyIt->second);
+			m_KeysByHandle.erase(keyIt);
+		}
+
+		m_Assets.erase(it);
+	}
+}
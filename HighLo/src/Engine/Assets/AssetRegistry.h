@@ -2,38 +2,85 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Lookups return copies taken under the lock and the keys are computed lexically without a shared cache
+//     - 1.1 (2026-10-19) Indexed the registry by AssetHandle with a secondary path index and thread-safe lookups
 //     - 1.0 (2022-01-21) initial release
 //
 
 #pragma once
 
+#include <mutex>
+#include <shared_mutex>
+
 #include "Asset.h"
 #include "Engine/Core/FileSystemPath.h"
 
 namespace highlo
 {
+	/// <summary>
+	/// Stores the meta data of all assets of the active project.
+	/// The entries are indexed by their AssetHandle, a secondary index maps the normalized file paths to the handles.
+	/// The entries are only modified by the main thread, lookups are allowed from any thread.
+	/// All lookups return copies, that are taken while the registry is locked, so they stay valid when the entry changes afterwards.
+	/// </summary>
 	class AssetRegistry
 	{
 	public:
 
-		HLAPI AssetMetaData &operator[](const FileSystemPath &path);
-		HLAPI const AssetMetaData &Get(const FileSystemPath &path) const;
+		using AssetMap = std::unordered_map<AssetHandle, AssetMetaData>;
+
+		/// <summary>
+		/// Inserts or replaces the entry with the handle of the meta data and registers it under the given path.
+		/// An entry, that has been registered under the same path with a different handle before, is replaced.
+		/// </summary>
+		HLAPI void Add(const FileSystemPath &path, const AssetMetaData &metaData);
+
+		/// <summary>
+		/// Copies the entry of the handle or path into outMetaData.
+		/// </summary>
+		/// <returns>Returns false if no asset is registered under the handle or path.</returns>
+		HLAPI bool TryGet(AssetHandle handle, AssetMetaData &outMetaData) const;
+		HLAPI bool TryGet(const FileSystemPath &path, AssetMetaData &outMetaData) const;
 
-		HLAPI uint64 Count() const { return m_AssetRegistry.size(); }
+		/// <summary>
+		/// Returns the handle of the asset registered under the path, or 0 if there is none.
+		/// </summary>
+		HLAPI AssetHandle GetHandle(const FileSystemPath &path) const;
+
+		/// <summary>
+		/// Updates the loaded state of an entry, the entries must not be changed through the copies returned by TryGet().
+		/// </summary>
+		HLAPI bool SetDataLoaded(AssetHandle handle, bool isDataLoaded);
+
+		HLAPI uint64 Count() const;
+		HLAPI bool Contains(AssetHandle handle) const;
 		HLAPI bool Contains(const FileSystemPath &path) const;
+		HLAPI uint64 Remove(AssetHandle handle);
 		HLAPI uint64 Remove(const FileSystemPath &path);
 		HLAPI void Clear();
 
-		HLAPI std::unordered_map<FileSystemPath, AssetMetaData>::iterator begin() { return m_AssetRegistry.begin(); }
-		HLAPI std::unordered_map<FileSystemPath, AssetMetaData>::iterator end() { return m_AssetRegistry.end(); }
-		HLAPI std::unordered_map<FileSystemPath, AssetMetaData>::const_iterator cbegin() const { return m_AssetRegistry.begin(); }
-		HLAPI std::unordered_map<FileSystemPath, AssetMetaData>::const_iterator cend() const { return m_AssetRegistry.end(); }
+		// The iteration is not synchronized, it may only be used by the main thread
+		HLAPI AssetMap::iterator begin() { return m_Assets.begin(); }
+		HLAPI AssetMap::iterator end() { return m_Assets.end(); }
+		HLAPI AssetMap::const_iterator cbegin() const { return m_Assets.begin(); }
+		HLAPI AssetMap::const_iterator cend() const { return m_Assets.end(); }
 
+		/// <summary>
+		/// Returns the normalized path, under which an asset is registered.
+		/// The path is made relative to the asset directory of the active project without touching the file system.
+		/// </summary>
 		HLAPI FileSystemPath GetKey(const FileSystemPath &path) const;
 
 	private:
 
-		std::unordered_map<FileSystemPath, AssetMetaData> m_AssetRegistry;
+		HLString GetKeyString(const FileSystemPath &path) const;
+		AssetHandle FindHandle(const HLString &key) const;
+		void RemoveEntry(AssetHandle handle);
+
+		AssetMap m_Assets;
+		std::unordered_map<HLString, AssetHandle> m_PathIndex;
+		std::unordered_map<AssetHandle, HLString> m_KeysByHandle;
+		mutable std::shared_mutex m_Mutex;
 	};
 }
 
@@ -0,0 +1,334 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AssetRegistryFile.h"
+
+#include <filesystem>
+
+#include "Engine/Core/FileSystem.h"
+
+#define ASSET_REGISTRY_FILE_LOG_PREFIX "ARegFile>     "
+
+namespace highlo
+{
+	namespace utils
+	{
+		static void AppendBytes(std::vector<Byte> &buffer, const void *data, uint64 size)
+		{
+			const Byte *bytes = (const Byte*)data;
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+
+		static HLString NormalizeSeparators(const HLString &path)
+		{
+			HLString result = path;
+			if (result.Contains("\\"))
+				result.Replace("\\", "/");
+
+			return result;
+		}
+
+		static void ReplayJournal(const FileSystemPath &journalPath, AssetRegistry &outRegistry)
+		{
+			if (!FileSystem::Get()->FileExists(journalPath))
+				return;
+
+			int64 size = 0;
+			Byte *journalData = FileSystem::Get()->ReadFile(journalPath, &size);
+			if (!journalData)
+				return;
+
+			uint64 offset = 0;
+			uint32 replayedRecords = 0;
+			while (offset + sizeof(AssetRegistryJournalRecord) <= (uint64)size)
+			{
+				// The records are not aligned, because the paths have different lengths
+				AssetRegistryJournalRecord record;
+				memcpy(&record, journalData + offset, sizeof(AssetRegistryJournalRecord));
+				if (offset + sizeof(AssetRegistryJournalRecord) + record.PathLength > (uint64)size)
+					break;
+
+				const char *path = (const char*)(journalData + offset + sizeof(AssetRegistryJournalRecord));
+				offset += sizeof(AssetRegistryJournalRecord) + record.PathLength;
+
+				if (record.Op == AssetRegistryJournalOp::Add)
+				{
+					AssetMetaData metaData;
+					metaData.Handle = record.Handle;
+					metaData.Type = (AssetType)record.Type;
+					metaData.FilePath = FileSystemPath(HLString(path, record.PathLength));
+					outRegistry.Add(metaData.FilePath, metaData);
+				}
+				else if (record.Op == AssetRegistryJournalOp::Remove)
+				{
+					outRegistry.Remove(AssetHandle(record.Handle));
+				}
+				else
+				{
+					break;
+				}
+
+				++replayedRecords;
+			}
+
+			if (offset != (uint64)size)
+				HL_CORE_WARN(ASSET_REGISTRY_FILE_LOG_PREFIX "[-] Ignoring incomplete record at the end of the journal {0} [-]", *journalPath.String());
+
+			HL_CORE_INFO(ASSET_REGISTRY_FILE_LOG_PREFIX "[+] Replayed {0} journal records [+]", replayedRecords);
+			delete[] journalData;
+		}
+	}
+
+	bool AssetRegistryFile::Read(const FileSystemPath &filePath, AssetRegistry &outRegistry)
+	{
+		if (!FileSystem::Get()->FileExists(filePath))
+			return false;
+
+		int64 size = 0;
+		Byte *fileData = FileSystem::Get()->ReadFile(filePath, &size);
+		if (!fileData)
+			return false;
+
+		const uint64 fileSize = (uint64)size;
+		const AssetRegistryFileHeader *header = (const AssetRegistryFileHeader*)fileData;
+		const uint64 entriesOffset = sizeof(AssetRegistryFileHeader);
+
+		// Older projects still contain the JSON registry, they are migrated by the directory scan
+		bool valid = fileSize >= sizeof(AssetRegistryFileHeader)
+			&& header->Magic == HL_ASSET_REGISTRY_MAGIC
+			&& header->Version == HL_ASSET_REGISTRY_VERSION
+			&& entriesOffset + (uint64)header->EntryCount * sizeof(AssetRegistryFileEntry) + header->StringTableSize <= fileSize;
+
+		if (!valid)
+		{
+			HL_CORE_WARN(ASSET_REGISTRY_FILE_LOG_PREFIX "[-] {0} is not a valid asset registry, the assets are discovered again [-]", *filePath.String());
+			delete[] fileData;
+			return false;
+		}
+
+		const AssetRegistryFileEntry *entries = (const AssetRegistryFileEntry*)(fileData + entriesOffset);
+		const char *strings = (const char*)(entries + header->EntryCount);
+
+		for (uint32 i = 0; i < header->EntryCount; ++i)
+		{
+			const AssetRegistryFileEntry &entry = entries[i];
+			if ((uint64)entry.PathOffset + entry.PathLength > header->StringTableSize)
+				continue;
+
+			AssetMetaData metaData;
+			metaData.Handle = entry.Handle;
+			metaData.Type = (AssetType)entry.Type;
+			metaData.FilePath = FileSystemPath(HLString(strings + entry.PathOffset, entry.PathLength));
+			outRegistry.Add(metaData.FilePath, metaData);
+		}
+
+		delete[] fileData;
+
+		utils::ReplayJournal(GetJournalPath(filePath), outRegistry);
+		HL_CORE_INFO(ASSET_REGISTRY_FILE_LOG_PREFIX "[+] Loaded asset registry with {0} entries [+]", outRegistry.Count());
+		return true;
+	}
+
+	bool AssetRegistryFile::Write(const FileSystemPath &filePath, const AssetRegistry &registry)
+	{
+		std::vector<AssetRegistryFileEntry> entries;
+		entries.reserve(registry.Count());
+
+		std::vector<char> strings;
+		for (auto it = registry.cbegin(); it != registry.cend(); ++it)
+		{
+			const AssetMetaData &metaData = it->second;
+			HLString path = utils::NormalizeSeparators(metaData.FilePath.String());
+
+			AssetRegistryFileEntry &entry = entries.emplace_back();
+			entry.Handle = (uint64)metaData.Handle;
+			entry.Type = (uint32)metaData.Type;
+			entry.PathOffset = (uint32)strings.size();
+			entry.PathLength = path.Length();
+			strings.insert(strings.end(), *path, *path + path.Length());
+		}
+
+		// Sorted by handle, so that the file does not change if the registry has not changed
+		std::sort(entries.begin(), entries.end(), [](const AssetRegistryFileEntry &a, const AssetRegistryFileEntry &b)
+		{
+			return a.Handle < b.Handle;
+		});
+
+		AssetRegistryFileHeader header;
+		header.EntryCount = (uint32)entries.size();
+		header.StringTableSize = (uint32)strings.size();
+
+		std::vector<Byte> buffer;
+		buffer.reserve(sizeof(AssetRegistryFileHeader) + entries.size() * sizeof(AssetRegistryFileEntry) + strings.size());
+		utils::AppendBytes(buffer, &header, sizeof(AssetRegistryFileHeader));
+		utils::AppendBytes(buffer, entries.data(), entries.size() * sizeof(AssetRegistryFileEntry));
+		utils::AppendBytes(buffer, strings.data(), strings.size());
+
+		// The snapshot is written next to the old one and replaces it afterwards, so that a crash can't leave a half written registry behind
+		FileSystemPath tempPath = FileSystemPath(filePath.String() + ".tmp");
+		if (FileSystem::Get()->FileExists(tempPath))
+			FileSystem::Get()->RemoveFile(tempPath);
+
+		if (!FileSystem::Get()->WriteFile(tempPath, buffer.data(), (int64)buffer.size()))
+		{
+			HL_CORE_ERROR(ASSET_REGISTRY_FILE_LOG_PREFIX "[-] Failed to write asset registry {0} [-]", *tempPath.String());
+			return false;
+		}
+
+		std::error_code error;
+		std::filesystem::rename(*tempPath.String(), *filePath.String(), error);
+		if (error)
+		{
+			HL_CORE_ERROR(ASSET_REGISTRY_FILE_LOG_PREFIX "[-] Failed to replace asset registry {0}: {1} [-]", *filePath.String(), error.message());
+			return false;
+		}
+
+		HL_CORE_INFO(ASSET_REGISTRY_FILE_LOG_PREFIX "[+] Serialized asset registry with {0} entries [+]", entries.size());
+		return true;
+	}
+
+	FileSystemPath AssetRegistryFile::GetJournalPath(const FileSystemPath &filePath)
+	{
+		return FileSystemPath(filePath.String() + HL_ASSET_REGISTRY_JOURNAL_EXTENSION);
+	}
+
+	AssetRegistryJournal::~AssetRegistryJournal()
+	{
+		Stop();
+	}
+
+	void AssetRegistryJournal::Start(const FileSystemPath &journalPath, uint32 flushIntervalMs)
+	{
+		Stop();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_JournalPath = journalPath;
+		m_FlushIntervalMs = flushIntervalMs;
+		m_Running = true;
+		m_Flusher = std::thread([this]() { FlusherLoop(); });
+	}
+
+	void AssetRegistryJournal::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Running)
+				return;
+
+			m_Running = false;
+		}
+
+		m_ChangeRecorded.notify_all();
+		if (m_Flusher.joinable())
+			m_Flusher.join();
+
+		Flush();
+	}
+
+	void AssetRegistryJournal::RecordAdd(const AssetMetaData &metaData)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Running)
+				return;
+
+			m_Pending[metaData.Handle] = { AssetRegistryJournalOp::Add, metaData.Type, utils::NormalizeSeparators(metaData.FilePath.String()), m_NextSequence++ };
+		}
+
+		m_ChangeRecorded.notify_one();
+	}
+
+	void AssetRegistryJournal::RecordRemove(AssetHandle handle)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Running)
+				return;
+
+			m_Pending[handle] = { AssetRegistryJournalOp::Remove, AssetType::None, HLString(), m_NextSequence++ };
+		}
+
+		m_ChangeRecorded.notify_one();
+	}
+
+	void AssetRegistryJournal::Flush()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		WritePending(lock);
+	}
+
+	void AssetRegistryJournal::Reset()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		std::lock_guard<std::mutex> fileLock(m_FileMutex);
+
+		m_Pending.clear();
+		m_WrittenRecordCount = 0;
+
+		if (!m_JournalPath.String().IsEmpty() && FileSystem::Get()->FileExists(m_JournalPath))
+			FileSystem::Get()->RemoveFile(m_JournalPath);
+	}
+
+	void AssetRegistryJournal::FlusherLoop()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		while (m_Running)
+		{
+			m_ChangeRecorded.wait(lock, [this]() { return !m_Running || !m_Pending.empty(); });
+			if (!m_Running)
+				break;
+
+			// Bulk imports record many changes in a row, waiting a bit longer coalesces them into one write
+			m_ChangeRecorded.wait_for(lock, std::chrono::milliseconds(m_FlushIntervalMs), [this]() { return !m_Running; });
+			WritePending(lock);
+		}
+	}
+
+	void AssetRegistryJournal::WritePending(std::unique_lock<std::mutex> &lock)
+	{
+		if (m_Pending.empty() || m_JournalPath.String().IsEmpty())
+			return;
+
+		std::vector<std::pair<AssetHandle, PendingChange>> changes(m_Pending.begin(), m_Pending.end());
+		m_Pending.clear();
+
+		// The file lock is taken before the pending changes are released, so that the batches are written in the order in which they have been taken
+		std::unique_lock<std::mutex> fileLock(m_FileMutex);
+		lock.unlock();
+
+		// A change can depend on an earlier change of a different asset, for example if a path is reused
+		std::sort(changes.begin(), changes.end(), [](const auto &a, const auto &b)
+		{
+			return a.second.Sequence < b.second.Sequence;
+		});
+
+		std::vector<Byte> buffer;
+		for (const auto &[handle, change] : changes)
+		{
+			AssetRegistryJournalRecord record;
+			record.Op = change.Op;
+			record.Type = (uint32)change.Type;
+			record.Handle = (uint64)handle;
+			record.PathLength = change.FilePath.Length();
+
+			utils::AppendBytes(buffer, &record, sizeof(AssetRegistryJournalRecord));
+			utils::AppendBytes(buffer, *change.FilePath, change.FilePath.Length());
+		}
+
+		std::ofstream out(*m_JournalPath.String(), std::ios::out | std::ios::binary | std::ios::app);
+		if (out)
+		{
+			out.write((const char*)buffer.data(), buffer.size());
+			m_WrittenRecordCount += (uint32)changes.size();
+		}
+		else
+		{
+			HL_CORE_ERROR(ASSET_REGISTRY_FILE_LOG_PREFIX "[-] Failed to write asset registry journal {0} [-]", *m_JournalPath.String());
+		}
+
+		out.close();
+		fileLock.unlock();
+		lock.lock();
+	}
+}
+
@@ -0,0 +1,145 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "AssetRegistry.h"
+
+#define HL_ASSET_REGISTRY_MAGIC 0x52414C48 // "HLAR"
+#define HL_ASSET_REGISTRY_VERSION 1
+#define HL_ASSET_REGISTRY_JOURNAL_EXTENSION ".journal"
+
+namespace highlo
+{
+	/// <summary>
+	/// The header at the beginning of a registry snapshot, it is followed by the entries and the string table with the file paths.
+	/// </summary>
+	struct AssetRegistryFileHeader
+	{
+		uint32 Magic = HL_ASSET_REGISTRY_MAGIC;
+		uint32 Version = HL_ASSET_REGISTRY_VERSION;
+		uint32 EntryCount = 0;
+		uint32 StringTableSize = 0;
+	};
+
+	struct AssetRegistryFileEntry
+	{
+		uint64 Handle = 0;
+		uint32 Type = 0;
+		uint32 PathOffset = 0;
+		uint32 PathLength = 0;
+		uint32 Padding = 0;
+	};
+
+	enum class AssetRegistryJournalOp : uint32
+	{
+		Add = 0,
+		Remove
+	};
+
+	/// <summary>
+	/// Every change of the registry is appended to the journal as one record, followed by PathLength characters of the file path.
+	/// </summary>
+	struct AssetRegistryJournalRecord
+	{
+		AssetRegistryJournalOp Op = AssetRegistryJournalOp::Add;
+		uint32 Type = 0;
+		uint64 Handle = 0;
+		uint32 PathLength = 0;
+		uint32 Padding = 0;
+	};
+
+	class AssetRegistryFile
+	{
+	public:
+
+		/// <summary>
+		/// Reads the snapshot with one read and replays the journal, that has been written since the snapshot, on top of it.
+		/// An incomplete record at the end of the journal, for example after a crash, is ignored.
+		/// </summary>
+		/// <returns>Returns false, if there is no valid snapshot, in this case the registry stays untouched.</returns>
+		HLAPI static bool Read(const FileSystemPath &filePath, AssetRegistry &outRegistry);
+
+		/// <summary>
+		/// Writes all entries of the registry into a new snapshot, the journal has to be reset afterwards, because it is contained in the snapshot.
+		/// </summary>
+		HLAPI static bool Write(const FileSystemPath &filePath, const AssetRegistry &registry);
+
+		HLAPI static FileSystemPath GetJournalPath(const FileSystemPath &filePath);
+	};
+
+	/// <summary>
+	/// Collects the changes of the registry and appends them to the journal file from a background thread.
+	/// Multiple changes of the same asset between two flushes are coalesced into one record.
+	/// </summary>
+	class AssetRegistryJournal
+	{
+	public:
+
+		HLAPI AssetRegistryJournal() = default;
+		HLAPI ~AssetRegistryJournal();
+
+		HL_NON_COPYABLE(AssetRegistryJournal);
+
+		/// <summary>
+		/// Starts the background thread, that writes the recorded changes at most every flushIntervalMs milliseconds.
+		/// </summary>
+		HLAPI void Start(const FileSystemPath &journalPath, uint32 flushIntervalMs = 250);
+
+		/// <summary>
+		/// Writes the remaining changes and stops the background thread.
+		/// </summary>
+		HLAPI void Stop();
+
+		HLAPI void RecordAdd(const AssetMetaData &metaData);
+		HLAPI void RecordRemove(AssetHandle handle);
+
+		/// <summary>
+		/// Writes all recorded changes on the calling thread.
+		/// </summary>
+		HLAPI void Flush();
+
+		/// <summary>
+		/// Should be called after a snapshot has been written, the journal starts empty afterwards.
+		/// </summary>
+		HLAPI void Reset();
+
+		HLAPI uint32 GetWrittenRecordCount() const { return m_WrittenRecordCount; }
+
+	private:
+
+		struct PendingChange
+		{
+			AssetRegistryJournalOp Op;
+			AssetType Type;
+			HLString FilePath;
+			uint64 Sequence;
+		};
+
+		void FlusherLoop();
+		void WritePending(std::unique_lock<std::mutex> &lock);
+
+		FileSystemPath m_JournalPath;
+		uint32 m_FlushIntervalMs = 250;
+
+		std::unordered_map<AssetHandle, PendingChange> m_Pending;
+		uint64 m_NextSequence = 0;
+		std::atomic<uint32> m_WrittenRecordCount = 0;
+
+		std::thread m_Flusher;
+		std::mutex m_Mutex;
+		std::mutex m_FileMutex;
+		std::condition_variable m_ChangeRecorded;
+		bool m_Running = false;
+	};
+}
+
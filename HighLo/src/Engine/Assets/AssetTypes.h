@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Added AnimationClip Assetype
 //     - 1.1 (2021-09-21) Added Font Assetype
 //     - 1.1 (2021-09-19) Added Prefab Assetype
 //     - 1.0 (2021-09-14) initial release
@@ -32,6 +33,7 @@ namespace highlo
 		Script = 9,
 
 		MeshAsset = 10,
+		AnimationClip = 11,
 	};
 
 	namespace utils
@@ -48,6 +50,7 @@ namespace highlo
 			if (assetType == "Prefab") return AssetType::Prefab;
 			if (assetType == "Font") return AssetType::Font;
 			if (assetType == "MeshAsset") return AssetType::MeshAsset;
+			if (assetType == "AnimationClip") return AssetType::AnimationClip;
 
 			HL_ASSERT(false, "Unknown Asset");
 			return AssetType::None;
@@ -67,6 +70,7 @@ namespace highlo
 				case AssetType::Prefab:		 return "Prefab";
 				case AssetType::Font:		 return "Font";
 				case AssetType::MeshAsset:	 return "MeshAsset";
+				case AssetType::AnimationClip: return "AnimationClip";
 			}
 
 			HL_ASSERT(false, "Unknown Asset");
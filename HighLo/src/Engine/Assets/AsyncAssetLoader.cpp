@@ -0,0 +1,261 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AsyncAssetLoader.h"
+
+#include "Engine/Loaders/AssetImporter.h"
+#include "Engine/Threading/ThreadPool.h"
+#include "Engine/Renderer/Renderer.h"
+
+#define ASYNC_ASSET_LOADER_LOG_PREFIX "AsyncLoader>  "
+
+namespace highlo
+{
+	namespace utils
+	{
+		/// <summary>
+		/// Returns true, if request a should be handled before request b.
+		/// Requests with the same priority are handled in the order in which they have been queued.
+		/// </summary>
+		static bool HasHigherPriority(const AssetLoadRequest *a, const AssetLoadRequest *b)
+		{
+			if (a->Priority != b->Priority)
+				return a->Priority > b->Priority;
+
+			return a->Sequence < b->Sequence;
+		}
+	}
+
+	AsyncAssetLoader::~AsyncAssetLoader()
+	{
+		Shutdown();
+	}
+
+	Ref<AssetLoadRequest> AsyncAssetLoader::Enqueue(const AssetMetaData &metaData, AssetLoadPriority priority, const std::vector<AssetHandle> &dependencies)
+	{
+		auto it = m_Requests.find(metaData.Handle);
+		if (it != m_Requests.end())
+		{
+			Ref<AssetLoadRequest> &request = it->second;
+			for (AssetHandle dependency : dependencies)
+			{
+				if (std::find(request->Dependencies.begin(), request->Dependencies.end(), dependency) == request->Dependencies.end())
+					request->Dependencies.push_back(dependency);
+			}
+
+			// The priority is read by the workers when they pick the next request
+			std::lock_guard<std::mutex> lock(m_QueueMutex);
+			if (priority > request->Priority)
+				request->Priority = priority;
+
+			return request;
+		}
+
+		Ref<AssetLoadRequest> request = Ref<AssetLoadRequest>::Create();
+		request->MetaData = metaData;
+		request->Priority = priority;
+		request->Dependencies = dependencies;
+		request->Sequence = m_NextSequence++;
+		m_Requests[metaData.Handle] = request;
+
+		{
+			std::lock_guard<std::mutex> lock(m_QueueMutex);
+			m_Queue.push_back(request.Get());
+			++m_ScheduledJobs;
+		}
+
+		// Every job decodes the most important request that is queued at the time the job starts,
+		// not necessarily the one that has been queued together with the job
+		ThreadPool::Get().Submit([this]() { DecodeNext(); });
+		return request;
+	}
+
+	void AsyncAssetLoader::Finalize(float budgetMs, std::vector<Ref<AssetLoadRequest>> &outFinished)
+	{
+		if (m_Requests.empty())
+			return;
+
+		std::vector<Ref<AssetLoadRequest>> candidates;
+		candidates.reserve(m_Requests.size());
+		for (auto &[handle, request] : m_Requests)
+		{
+			AssetLoadState state = request->State;
+			if (state == AssetLoadState::Decoded || state == AssetLoadState::Failed)
+				candidates.push_back(request);
+		}
+
+		if (candidates.empty())
+			return;
+
+		std::sort(candidates.begin(), candidates.end(), [](const Ref<AssetLoadRequest> &a, const Ref<AssetLoadRequest> &b)
+		{
+			return utils::HasHigherPriority(a.Get(), b.Get());
+		});
+
+		auto start = std::chrono::steady_clock::now();
+		bool budgetExceeded = false;
+
+		for (const Ref<AssetLoadRequest> &request : candidates)
+		{
+			if (request->State == AssetLoadState::Decoded)
+			{
+				if (!AreDependenciesFinished(request))
+					continue;
+
+				if (budgetExceeded && request->Priority != AssetLoadPriority::Immediate)
+					continue;
+
+				FinalizeRequest(request);
+
+				float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+				budgetExceeded = elapsedMs >= budgetMs;
+			}
+			else
+			{
+				request->Data.Release();
+				HL_CORE_ERROR(ASYNC_ASSET_LOADER_LOG_PREFIX "[-] Failed to load asset {0} [-]", *request->MetaData.FilePath.String());
+			}
+
+			m_Requests.erase(request->MetaData.Handle);
+			outFinished.push_back(request);
+		}
+	}
+
+	Ref<AssetLoadRequest> AsyncAssetLoader::Complete(AssetHandle handle)
+	{
+		auto it = m_Requests.find(handle);
+		if (it == m_Requests.end())
+			return nullptr;
+
+		Ref<AssetLoadRequest> request = it->second;
+		m_Requests.erase(it);
+
+		bool decodeHere = false;
+		{
+			std::unique_lock<std::mutex> lock(m_QueueMutex);
+			auto queued = std::find(m_Queue.begin(), m_Queue.end(), request.Get());
+			if (queued != m_Queue.end())
+			{
+				// Nobody has started with the request yet, so it is cheaper to decode it right here than to wait for a worker
+				m_Queue.erase(queued);
+				request->State = AssetLoadState::Decoding;
+				decodeHere = true;
+			}
+			else
+			{
+				m_DecodeFinished.wait(lock, [&request]() { return request->State != AssetLoadState::Decoding; });
+			}
+		}
+
+		if (decodeHere)
+			Decode(request.Get());
+
+		if (request->State == AssetLoadState::Decoded)
+		{
+			FinalizeRequest(request);
+		}
+		else
+		{
+			request->Data.Release();
+			HL_CORE_ERROR(ASYNC_ASSET_LOADER_LOG_PREFIX "[-] Failed to load asset {0} [-]", *request->MetaData.FilePath.String());
+		}
+
+		return request;
+	}
+
+	void AsyncAssetLoader::Shutdown()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_QueueMutex);
+			m_Queue.clear();
+
+			// The jobs that have not started yet still reference the loader, so they have to run before it goes away
+			m_DecodeFinished.wait(lock, [this]() { return m_ScheduledJobs == 0; });
+		}
+
+		for (auto &[handle, request] : m_Requests)
+			request->Data.Release();
+
+		m_Requests.clear();
+	}
+
+	Ref<Asset> AsyncAssetLoader::GetPlaceholder(AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::Texture:
+				return Renderer::GetWhiteTexture();
+		}
+
+		return nullptr;
+	}
+
+	void AsyncAssetLoader::DecodeNext()
+	{
+		AssetLoadRequest *request = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(m_QueueMutex);
+			if (!m_Queue.empty())
+			{
+				auto next = std::min_element(m_Queue.begin(), m_Queue.end(), utils::HasHigherPriority);
+				request = *next;
+				m_Queue.erase(next);
+				request->State = AssetLoadState::Decoding;
+			}
+		}
+
+		if (request)
+			Decode(request);
+
+		std::lock_guard<std::mutex> lock(m_QueueMutex);
+		--m_ScheduledJobs;
+		m_DecodeFinished.notify_all();
+	}
+
+	void AsyncAssetLoader::Decode(AssetLoadRequest *request)
+	{
+		bool decoded = AssetImporter::TryDecodeData(request->MetaData, request->Data);
+
+		// The state is changed under the lock, so that Complete() can't miss the notification
+		std::lock_guard<std::mutex> lock(m_QueueMutex);
+		request->State = decoded ? AssetLoadState::Decoded : AssetLoadState::Failed;
+		m_DecodeFinished.notify_all();
+	}
+
+	void AsyncAssetLoader::FinalizeRequest(const Ref<AssetLoadRequest> &request)
+	{
+		Ref<Asset> asset = nullptr;
+		bool loaded = AssetImporter::TryFinalizeData(request->MetaData, request->Data, asset);
+		request->Data.Release();
+
+		if (loaded)
+		{
+			request->LoadedAsset = asset;
+			request->State = AssetLoadState::Loaded;
+		}
+		else
+		{
+			request->State = AssetLoadState::Failed;
+			HL_CORE_ERROR(ASYNC_ASSET_LOADER_LOG_PREFIX "[-] Failed to load asset {0} [-]", *request->MetaData.FilePath.String());
+		}
+	}
+
+	bool AsyncAssetLoader::AreDependenciesFinished(const Ref<AssetLoadRequest> &request) const
+	{
+		// Dependencies that are not known to the loader have either been loaded already or are loaded elsewhere
+		for (AssetHandle dependency : request->Dependencies)
+		{
+			auto it = m_Requests.find(dependency);
+			if (it == m_Requests.end())
+				continue;
+
+			AssetLoadState state = it->second->State;
+			if (state != AssetLoadState::Loaded && state != AssetLoadState::Failed)
+				return false;
+		}
+
+		return true;
+	}
+}
+
@@ -0,0 +1,175 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Meshes are decoded into a MeshLoader on the worker thread
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+#include "Asset.h"
+#include "Engine/Core/Allocator.h"
+#include "Engine/Loaders/MeshLoader.h"
+
+namespace highlo
+{
+	enum class AssetLoadPriority
+	{
+		Low = 0,
+		Normal,
+		High,
+		Immediate		/**< Is finalized as soon as it has been decoded, even if the budget of the frame is used up. */
+	};
+
+	enum class AssetLoadState
+	{
+		Queued = 0,		/**< Waiting for a worker thread. */
+		Decoding,		/**< A worker thread reads and decodes the file. */
+		Decoded,		/**< The data is ready to be finalized on the main thread. */
+		Loaded,			/**< The asset has been created and registered in the AssetManager. */
+		Failed			/**< The asset could not be loaded. */
+	};
+
+	/// <summary>
+	/// The intermediate result of decoding an asset on a worker thread.
+	/// Depending on the asset type either the raw buffer is filled, the mesh has been decoded without its GPU resources,
+	/// or the asset could be created on the worker thread and only its GPU resources are left for the main thread.
+	/// </summary>
+	struct AssetLoadData
+	{
+		Allocator Buffer;
+		uint32 Width = 0;
+		uint32 Height = 0;
+		Ref<Asset> DecodedAsset = nullptr;
+		Ref<MeshLoader> DecodedMesh = nullptr;
+
+		void Release()
+		{
+			Buffer.Release();
+			DecodedAsset = nullptr;
+			DecodedMesh = nullptr;
+		}
+	};
+
+	struct AssetLoadRequest : public IsSharedReference
+	{
+		AssetMetaData MetaData;
+		AssetLoadPriority Priority = AssetLoadPriority::Normal;
+		std::vector<AssetHandle> Dependencies;
+		std::atomic<AssetLoadState> State = AssetLoadState::Queued;
+		uint64 Sequence = 0;
+
+		// Only written by the thread that decodes the request
+		AssetLoadData Data;
+
+		// Only accessed by the main thread
+		Ref<Asset> LoadedAsset = nullptr;
+	};
+
+	/// <summary>
+	/// Handle to an asset that is loaded asynchronously.
+	/// Until the asset has been loaded, the future returns a placeholder asset, which can be used for rendering in the meantime.
+	/// </summary>
+	template<typename T>
+	class AssetFuture
+	{
+	public:
+
+		AssetFuture() = default;
+		AssetFuture(const Ref<AssetLoadRequest> &request, const Ref<Asset> &placeholder)
+			: m_Request(request), m_Placeholder(placeholder) {}
+
+		HLAPI bool IsReady() const { return m_Request && m_Request->State == AssetLoadState::Loaded; }
+		HLAPI bool HasFailed() const { return !m_Request || m_Request->State == AssetLoadState::Failed; }
+		HLAPI AssetLoadState GetState() const { return m_Request ? m_Request->State.load() : AssetLoadState::Failed; }
+		HLAPI AssetHandle GetHandle() const { return m_Request ? m_Request->MetaData.Handle : AssetHandle(0); }
+
+		/// <summary>
+		/// Returns the loaded asset, or the placeholder as long as the asset is still being loaded.
+		/// </summary>
+		HLAPI Ref<T> Get() const
+		{
+			if (IsReady())
+				return m_Request->LoadedAsset.As<T>();
+
+			return m_Placeholder.As<T>();
+		}
+
+		HLAPI operator bool() const { return IsReady(); }
+
+	private:
+
+		Ref<AssetLoadRequest> m_Request = nullptr;
+		Ref<Asset> m_Placeholder = nullptr;
+	};
+
+	/// <summary>
+	/// Loads assets in two stages: the file is read and decoded by the thread pool, afterwards the asset is finalized on the main thread,
+	/// because creating GPU resources is only allowed there. Queued requests are decoded by their priority,
+	/// the finalization is limited by a time budget per frame and waits until all dependencies of a request have been finished.
+	/// </summary>
+	class AsyncAssetLoader
+	{
+	public:
+
+		HLAPI AsyncAssetLoader() = default;
+		HLAPI ~AsyncAssetLoader();
+
+		HL_NON_COPYABLE(AsyncAssetLoader);
+
+		/// <summary>
+		/// Queues the asset for loading. If the asset is already being loaded, the existing request is returned and its priority is raised if necessary.
+		/// The metaData has to contain the resolved file path, because the worker threads don't access the AssetManager.
+		/// </summary>
+		HLAPI Ref<AssetLoadRequest> Enqueue(const AssetMetaData &metaData, AssetLoadPriority priority, const std::vector<AssetHandle> &dependencies = {});
+
+		/// <summary>
+		/// Finalizes decoded requests until the time budget is used up, at least one request is finalized per call.
+		/// </summary>
+		/// <param name="budgetMs">The time in milliseconds that may be spent for the finalization.</param>
+		/// <param name="outFinished">Receives all requests that have been loaded or have failed.</param>
+		HLAPI void Finalize(float budgetMs, std::vector<Ref<AssetLoadRequest>> &outFinished);
+
+		/// <summary>
+		/// Finishes the request of the given asset on the calling thread, regardless of the budget and its dependencies.
+		/// </summary>
+		/// <returns>Returns the finished request or nullptr, if the asset is not being loaded.</returns>
+		HLAPI Ref<AssetLoadRequest> Complete(AssetHandle handle);
+
+		/// <summary>
+		/// Drops all queued requests and waits for the requests that are currently decoded.
+		/// </summary>
+		HLAPI void Shutdown();
+
+		HLAPI bool IsLoading(AssetHandle handle) const { return m_Requests.find(handle) != m_Requests.end(); }
+		HLAPI uint32 GetPendingCount() const { return (uint32)m_Requests.size(); }
+
+		/// <summary>
+		/// Returns the asset that should be used until an asset of the given type has been loaded.
+		/// </summary>
+		HLAPI static Ref<Asset> GetPlaceholder(AssetType type);
+
+	private:
+
+		void DecodeNext();
+		void Decode(AssetLoadRequest *request);
+		void FinalizeRequest(const Ref<AssetLoadRequest> &request);
+		bool AreDependenciesFinished(const Ref<AssetLoadRequest> &request) const;
+
+		// Only accessed by the main thread
+		std::unordered_map<AssetHandle, Ref<AssetLoadRequest>> m_Requests;
+		uint64 m_NextSequence = 0;
+
+		// Shared with the worker threads
+		std::vector<AssetLoadRequest*> m_Queue;
+		std::mutex m_QueueMutex;
+		std::condition_variable m_DecodeFinished;
+		uint32 m_ScheduledJobs = 0;
+	};
+}
+
@@ -0,0 +1,392 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "DerivedDataCache.h"
+
+#include <filesystem>
+
+#include "Engine/Core/FileSystem.h"
+#include "Engine/Threading/Thread.h"
+#include "AssetDirectoryScanner.h"
+
+#define DERIVED_DATA_CACHE_LOG_PREFIX "DDC>          "
+#define DERIVED_DATA_INDEX_FILE "index.bin"
+
+namespace highlo
+{
+	namespace utils
+	{
+		struct DerivedDataIndexHeader
+		{
+			uint32 Magic = HL_DERIVED_DATA_INDEX_MAGIC;
+			uint32 Version = HL_DERIVED_DATA_INDEX_VERSION;
+			uint32 EntryCount = 0;
+			uint32 Padding = 0;
+			uint64 AccessCounter = 0;
+		};
+
+		struct DerivedDataIndexEntry
+		{
+			uint64 LastAccess = 0;
+			uint32 NameLength = 0;
+			uint32 Padding = 0;
+		};
+	}
+
+	HLString DerivedDataKey::ToString() const
+	{
+		return fmt::format("{0}-{1}-{2:016x}-{3:016x}{4}", *Importer, ImporterVersion, SourceHash, SettingsHash, HL_DERIVED_DATA_EXTENSION);
+	}
+
+	void DerivedDataCache::Init(const FileSystemPath &directory, uint64 maxSizeBytes)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+
+		m_Directory = directory;
+		m_MaxSize = maxSizeBytes;
+		m_Entries.clear();
+		m_TotalSize = 0;
+		m_AccessCounter = 0;
+		m_Stats = DerivedDataStats();
+
+		std::error_code error;
+		std::filesystem::create_directories(*m_Directory.String(), error);
+		if (error)
+		{
+			HL_CORE_ERROR(DERIVED_DATA_CACHE_LOG_PREFIX "[-] Failed to create the derived data cache {0}: {1} [-]", *m_Directory.String(), error.message());
+			m_Enabled = false;
+			return;
+		}
+
+		// The directory is the source of truth, the index only contributes the access order
+		for (const auto &entry : std::filesystem::directory_iterator(*m_Directory.String(), error))
+		{
+			std::error_code entryError;
+			if (!entry.is_regular_file(entryError) || entry.path().extension() != HL_DERIVED_DATA_EXTENSION)
+				continue;
+
+			AddEntry(entry.path().filename().string(), (uint64)entry.file_size(entryError));
+		}
+
+		ReadIndex();
+		m_Enabled = true;
+
+		HL_CORE_INFO(DERIVED_DATA_CACHE_LOG_PREFIX "[+] Opened derived data cache {0} with {1} entries ({2} MB) [+]", *m_Directory.String(), m_Entries.size(), m_TotalSize / (1024 * 1024));
+		EvictIfNeeded(lock);
+	}
+
+	void DerivedDataCache::Shutdown()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_Enabled)
+			return;
+
+		WriteIndex();
+		HL_CORE_INFO(DERIVED_DATA_CACHE_LOG_PREFIX "[+] {0} hits, {1} misses, {2} writes, {3} evictions [+]", m_Stats.Hits, m_Stats.Misses, m_Stats.Writes, m_Stats.Evictions);
+		m_Enabled = false;
+	}
+
+	bool DerivedDataCache::Get(const DerivedDataKey &key, Allocator &outData)
+	{
+		HLString name = key.ToString();
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Enabled || m_Entries.find(name) == m_Entries.end())
+			{
+				++m_Stats.Misses;
+				return false;
+			}
+		}
+
+		int64 size = 0;
+		Byte *data = FileSystem::Get()->ReadFile(m_Directory / name, &size);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!data)
+		{
+			// Another instance, that shares the directory, could have evicted the entry
+			auto it = m_Entries.find(name);
+			if (it != m_Entries.end())
+			{
+				m_TotalSize -= it->second.Size;
+				m_Entries.erase(it);
+			}
+
+			++m_Stats.Misses;
+			return false;
+		}
+
+		outData = Allocator(data, (uint32)size);
+		Touch(name);
+		++m_Stats.Hits;
+		return true;
+	}
+
+	bool DerivedDataCache::Put(const DerivedDataKey &key, const void *data, uint64 size)
+	{
+		if (!m_Enabled)
+			return false;
+
+		HLString name = key.ToString();
+		FileSystemPath entryPath = m_Directory / name;
+
+		// Readers never see a partially written entry, because the file is renamed after it has been written completely
+		HLString tempName = fmt::format("{0}.{1}.tmp", *name, Thread::GetCurrentThreadID());
+		FileSystemPath tempPath = m_Directory / tempName;
+
+		{
+			std::ofstream out(*tempPath.String(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!out)
+			{
+				HL_CORE_ERROR(DERIVED_DATA_CACHE_LOG_PREFIX "[-] Failed to write derived data {0} [-]", *name);
+				return false;
+			}
+
+			out.write((const char*)data, size);
+		}
+
+		std::error_code error;
+		std::filesystem::rename(*tempPath.String(), *entryPath.String(), error);
+		if (error)
+		{
+			std::filesystem::remove(*tempPath.String(), error);
+			HL_CORE_ERROR(DERIVED_DATA_CACHE_LOG_PREFIX "[-] Failed to write derived data {0} [-]", *name);
+			return false;
+		}
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		AddEntry(name, size);
+		Touch(name);
+		++m_Stats.Writes;
+		EvictIfNeeded(lock);
+		return true;
+	}
+
+	bool DerivedDataCache::Contains(const DerivedDataKey &key)
+	{
+		HLString name = key.ToString();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_Enabled || m_Entries.find(name) == m_Entries.end())
+		{
+			++m_Stats.Misses;
+			return false;
+		}
+
+		Touch(name);
+		++m_Stats.Hits;
+		return true;
+	}
+
+	bool DerivedDataCache::Register(const DerivedDataKey &key)
+	{
+		if (!m_Enabled)
+			return false;
+
+		HLString name = key.ToString();
+		int64 size = FileSystem::Get()->GetFileSize(m_Directory / name);
+		if (size < 0)
+			return false;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		AddEntry(name, (uint64)size);
+		Touch(name);
+		++m_Stats.Writes;
+		EvictIfNeeded(lock);
+		return true;
+	}
+
+	FileSystemPath DerivedDataCache::GetEntryPath(const DerivedDataKey &key) const
+	{
+		return m_Directory / key.ToString();
+	}
+
+	void DerivedDataCache::SetMaxSize(uint64 maxSizeBytes)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_MaxSize = maxSizeBytes;
+		EvictIfNeeded(lock);
+	}
+
+	DerivedDataStats DerivedDataCache::GetStats()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		DerivedDataStats stats = m_Stats;
+		stats.TotalSize = m_TotalSize;
+		stats.EntryCount = (uint32)m_Entries.size();
+		return stats;
+	}
+
+	bool DerivedDataCache::HashSourceFile(const FileSystemPath &filePath, uint64 &outHash)
+	{
+		std::error_code error;
+		std::filesystem::path path(*filePath.String());
+
+		uint64 size = (uint64)std::filesystem::file_size(path, error);
+		if (error)
+			return false;
+
+		int64 writeTime = (int64)std::filesystem::last_write_time(path, error).time_since_epoch().count();
+		if (error)
+			return false;
+
+		{
+			std::lock_guard<std::mutex> lock(m_SourceHashMutex);
+			auto it = m_SourceHashes.find(filePath.String());
+			if (it != m_SourceHashes.end() && it->second.Size == size && it->second.WriteTime == writeTime)
+			{
+				outHash = it->second.Hash;
+				return true;
+			}
+		}
+
+		if (!AssetDirectoryScanner::HashFileContent(filePath, outHash))
+			return false;
+
+		std::lock_guard<std::mutex> lock(m_SourceHashMutex);
+		m_SourceHashes[filePath.String()] = { size, writeTime, outHash };
+		return true;
+	}
+
+	uint64 DerivedDataCache::HashSettings(const void *data, uint64 size, uint64 seed)
+	{
+		const Byte *bytes = (const Byte*)data;
+		uint64 hash = seed;
+
+		for (uint64 i = 0; i < size; ++i)
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+
+		return hash;
+	}
+
+	void DerivedDataCache::Touch(const HLString &name)
+	{
+		auto it = m_Entries.find(name);
+		if (it != m_Entries.end())
+			it->second.LastAccess = ++m_AccessCounter;
+	}
+
+	void DerivedDataCache::AddEntry(const HLString &name, uint64 size)
+	{
+		Entry &entry = m_Entries[name];
+		m_TotalSize -= entry.Size;
+		m_TotalSize += size;
+		entry.Size = size;
+	}
+
+	void DerivedDataCache::EvictIfNeeded(std::unique_lock<std::mutex> &lock)
+	{
+		if (m_MaxSize == 0 || m_TotalSize <= m_MaxSize)
+			return;
+
+		// Evicting down to 90% of the limit, so that the next writes don't have to evict again right away
+		const uint64 targetSize = m_MaxSize - m_MaxSize / 10;
+
+		std::vector<std::pair<uint64, HLString>> entriesByAccess;
+		entriesByAccess.reserve(m_Entries.size());
+		for (const auto &[name, entry] : m_Entries)
+			entriesByAccess.emplace_back(entry.LastAccess, name);
+
+		std::sort(entriesByAccess.begin(), entriesByAccess.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+		std::vector<FileSystemPath> filesToRemove;
+		for (const auto &[lastAccess, name] : entriesByAccess)
+		{
+			if (m_TotalSize <= targetSize)
+				break;
+
+			auto it = m_Entries.find(name);
+			m_TotalSize -= it->second.Size;
+			m_Entries.erase(it);
+			filesToRemove.push_back(m_Directory / name);
+			++m_Stats.Evictions;
+		}
+
+		// The entries are not known anymore, so the files can be deleted without holding the lock
+		lock.unlock();
+		for (const FileSystemPath &filePath : filesToRemove)
+		{
+			std::error_code error;
+			std::filesystem::remove(*filePath.String(), error);
+		}
+		lock.lock();
+	}
+
+	void DerivedDataCache::ReadIndex()
+	{
+		FileSystemPath indexPath = m_Directory / DERIVED_DATA_INDEX_FILE;
+		if (!FileSystem::Get()->FileExists(indexPath))
+			return;
+
+		int64 size = 0;
+		Byte *indexData = FileSystem::Get()->ReadFile(indexPath, &size);
+		if (!indexData)
+			return;
+
+		const Byte *readPtr = indexData;
+		const Byte *endPtr = indexData + size;
+
+		utils::DerivedDataIndexHeader header;
+		if (size >= (int64)sizeof(header))
+		{
+			memcpy(&header, readPtr, sizeof(header));
+			readPtr += sizeof(header);
+		}
+
+		if (header.Magic == HL_DERIVED_DATA_INDEX_MAGIC && header.Version == HL_DERIVED_DATA_INDEX_VERSION)
+		{
+			m_AccessCounter = header.AccessCounter;
+
+			for (uint32 i = 0; i < header.EntryCount && readPtr + sizeof(utils::DerivedDataIndexEntry) <= endPtr; ++i)
+			{
+				utils::DerivedDataIndexEntry indexEntry;
+				memcpy(&indexEntry, readPtr, sizeof(indexEntry));
+				readPtr += sizeof(indexEntry);
+
+				if (readPtr + indexEntry.NameLength > endPtr)
+					break;
+
+				// Entries, whose files don't exist anymore, are skipped, files without an index entry are evicted first
+				auto it = m_Entries.find(HLString((const char*)readPtr, indexEntry.NameLength));
+				if (it != m_Entries.end())
+					it->second.LastAccess = indexEntry.LastAccess;
+
+				readPtr += indexEntry.NameLength;
+			}
+		}
+
+		delete[] indexData;
+	}
+
+	void DerivedDataCache::WriteIndex()
+	{
+		std::vector<Byte> buffer;
+
+		utils::DerivedDataIndexHeader header;
+		header.EntryCount = (uint32)m_Entries.size();
+		header.AccessCounter = m_AccessCounter;
+		buffer.insert(buffer.end(), (const Byte*)&header, (const Byte*)&header + sizeof(header));
+
+		for (const auto &[name, entry] : m_Entries)
+		{
+			utils::DerivedDataIndexEntry indexEntry;
+			indexEntry.LastAccess = entry.LastAccess;
+			indexEntry.NameLength = name.Length();
+
+			buffer.insert(buffer.end(), (const Byte*)&indexEntry, (const Byte*)&indexEntry + sizeof(indexEntry));
+			buffer.insert(buffer.end(), (const Byte*)*name, (const Byte*)*name + name.Length());
+		}
+
+		std::ofstream out(*(m_Directory / DERIVED_DATA_INDEX_FILE).String(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out)
+		{
+			HL_CORE_ERROR(DERIVED_DATA_CACHE_LOG_PREFIX "[-] Failed to write the derived data index [-]");
+			return;
+		}
+
+		out.write((const char*)buffer.data(), buffer.size());
+	}
+}
+
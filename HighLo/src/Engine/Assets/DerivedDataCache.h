@@ -0,0 +1,144 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+
+#include "Engine/Core/Singleton.h"
+#include "Engine/Core/Allocator.h"
+#include "Engine/Core/FileSystemPath.h"
+
+#define HL_DERIVED_DATA_INDEX_MAGIC 0x49444448 // "HDDI"
+#define HL_DERIVED_DATA_INDEX_VERSION 1
+#define HL_DERIVED_DATA_EXTENSION ".ddc"
+
+namespace highlo
+{
+	/// <summary>
+	/// Identifies a processed blob. Every importer has its own name and version, the version has to be increased
+	/// whenever the importer produces different results, so that the old entries are not used anymore.
+	/// </summary>
+	struct DerivedDataKey
+	{
+		HLString Importer;
+		uint32 ImporterVersion = 1;
+		uint64 SourceHash = 0;		/**< The hash of the source content, not of its path. */
+		uint64 SettingsHash = 0;	/**< The hash of all settings, that change the result of the import. */
+
+		HLAPI DerivedDataKey() = default;
+		HLAPI DerivedDataKey(const HLString &importer, uint32 importerVersion, uint64 sourceHash, uint64 settingsHash = 0)
+			: Importer(importer), ImporterVersion(importerVersion), SourceHash(sourceHash), SettingsHash(settingsHash) {}
+
+		/// <summary>
+		/// Returns the file name of the entry, which is unique for every key.
+		/// </summary>
+		HLAPI HLString ToString() const;
+	};
+
+	struct DerivedDataStats
+	{
+		uint64 Hits = 0;
+		uint64 Misses = 0;
+		uint64 Writes = 0;
+		uint64 Evictions = 0;
+		uint64 TotalSize = 0;
+		uint32 EntryCount = 0;
+	};
+
+	/// <summary>
+	/// Stores the results of expensive imports on disk, addressed by the content of the source and the settings of the import.
+	/// The total size is limited, the least recently used entries are evicted first. All functions can be called from any thread.
+	/// Before Init() has been called, the cache is disabled and every lookup misses.
+	/// </summary>
+	class DerivedDataCache : public Singleton<DerivedDataCache>
+	{
+	public:
+
+		/// <summary>
+		/// Opens the cache directory, several engine instances, for example build agents, can share the same directory.
+		/// A maximum size of 0 disables the eviction.
+		/// </summary>
+		HLAPI void Init(const FileSystemPath &directory, uint64 maxSizeBytes);
+
+		/// <summary>
+		/// Writes the access order of the entries, so that the eviction continues where it stopped.
+		/// </summary>
+		HLAPI void Shutdown();
+
+		HLAPI bool IsEnabled() const { return m_Enabled; }
+
+		/// <summary>
+		/// Reads the blob of the key into outData, which has to be released by the caller.
+		/// </summary>
+		HLAPI bool Get(const DerivedDataKey &key, Allocator &outData);
+		HLAPI bool Put(const DerivedDataKey &key, const void *data, uint64 size);
+
+		/// <summary>
+		/// Returns true, if the entry exists and marks it as used. Importers that read the entry themselves, for example
+		/// from a mapped file, can use GetEntryPath() afterwards.
+		/// </summary>
+		HLAPI bool Contains(const DerivedDataKey &key);
+
+		/// <summary>
+		/// Adds a file to the cache, that has been written to GetEntryPath() by the importer itself.
+		/// </summary>
+		HLAPI bool Register(const DerivedDataKey &key);
+
+		HLAPI FileSystemPath GetEntryPath(const DerivedDataKey &key) const;
+
+		HLAPI void SetMaxSize(uint64 maxSizeBytes);
+		HLAPI uint64 GetMaxSize() const { return m_MaxSize; }
+		HLAPI DerivedDataStats GetStats();
+
+		/// <summary>
+		/// Returns the hash of the file content. The hash is remembered as long as the size and the write time of the file don't change.
+		/// </summary>
+		HLAPI bool HashSourceFile(const FileSystemPath &filePath, uint64 &outHash);
+
+		/// <summary>
+		/// Hashes the raw bytes of the settings, structs with padding should be hashed member by member by passing the previous result as the seed.
+		/// </summary>
+		HLAPI static uint64 HashSettings(const void *data, uint64 size, uint64 seed = 14695981039346656037ull);
+
+	private:
+
+		struct Entry
+		{
+			uint64 Size = 0;
+			uint64 LastAccess = 0;
+		};
+
+		struct SourceHash
+		{
+			uint64 Size = 0;
+			int64 WriteTime = 0;
+			uint64 Hash = 0;
+		};
+
+		void Touch(const HLString &name);
+		void AddEntry(const HLString &name, uint64 size);
+		void EvictIfNeeded(std::unique_lock<std::mutex> &lock);
+		void ReadIndex();
+		void WriteIndex();
+
+		FileSystemPath m_Directory;
+		uint64 m_MaxSize = 0;
+		std::atomic<bool> m_Enabled = false;
+
+		std::unordered_map<HLString, Entry> m_Entries;
+		uint64 m_TotalSize = 0;
+		uint64 m_AccessCounter = 0;
+		DerivedDataStats m_Stats;
+		std::mutex m_Mutex;
+
+		std::unordered_map<HLString, SourceHash> m_SourceHashes;
+		std::mutex m_SourceHashMutex;
+	};
+}
+
@@ -0,0 +1,380 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AsyncFileIO.h"
+
+#include <thread>
+
+#include "Engine/Threading/ThreadPool.h"
+
+#define ASYNC_FILE_IO_LOG_PREFIX "AsyncFileIO>  "
+
+namespace highlo
+{
+	namespace utils
+	{
+		/// <summary>
+		/// Reads the files with blocking calls. It uses its own threads instead of the ThreadPool,
+		/// because waiting for the disk would block the workers that execute the engine's jobs.
+		/// </summary>
+		class ThreadedAsyncFileIOBackend : public AsyncFileIOBackend
+		{
+		public:
+
+			ThreadedAsyncFileIOBackend(uint32 threadCount, const CompletionFunction &onComplete)
+				: m_OnComplete(onComplete)
+			{
+				m_Threads.reserve(threadCount);
+				for (uint32 i = 0; i < threadCount; ++i)
+					m_Threads.emplace_back([this]() { WorkerLoop(); });
+			}
+
+			virtual ~ThreadedAsyncFileIOBackend()
+			{
+				Shutdown();
+			}
+
+			virtual const char *GetName() const override { return "Threads"; }
+			virtual uint32 GetCapacity() const override { return (uint32)m_Threads.size(); }
+
+			virtual void Submit(const std::vector<AsyncIORequest*> &requests) override
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					m_Requests.insert(m_Requests.end(), requests.begin(), requests.end());
+				}
+
+				m_RequestAvailable.notify_all();
+			}
+
+			virtual void Shutdown() override
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					m_ShouldStop = true;
+				}
+
+				m_RequestAvailable.notify_all();
+				for (std::thread &thread : m_Threads)
+				{
+					if (thread.joinable())
+						thread.join();
+				}
+			}
+
+		private:
+
+			void WorkerLoop()
+			{
+				for (;;)
+				{
+					AsyncIORequest *request = nullptr;
+
+					{
+						std::unique_lock<std::mutex> lock(m_Mutex);
+						m_RequestAvailable.wait(lock, [this]() { return m_ShouldStop || !m_Requests.empty(); });
+
+						// The remaining requests are still read, so that every request gets its completion
+						if (m_Requests.empty())
+							return;
+
+						request = m_Requests.front();
+						m_Requests.pop_front();
+					}
+
+					bool success = !request->CancelRequested && Read(request);
+					m_OnComplete(request, success);
+				}
+			}
+
+			bool Read(AsyncIORequest *request)
+			{
+				std::ifstream in(*request->FilePath.String(), std::ios::in | std::ios::binary | std::ios::ate);
+				if (!in)
+					return false;
+
+				uint64 readSize = 0;
+				if (!AllocateBuffer(request, (uint64)in.tellg(), readSize))
+					return false;
+
+				if (readSize == 0)
+					return true;
+
+				in.seekg((std::streamoff)request->Offset);
+				in.read((char*)request->Buffer.Data, (std::streamsize)readSize);
+				return (uint64)in.gcount() == readSize;
+			}
+
+			CompletionFunction m_OnComplete;
+			std::vector<std::thread> m_Threads;
+			std::deque<AsyncIORequest*> m_Requests;
+			std::mutex m_Mutex;
+			std::condition_variable m_RequestAvailable;
+			bool m_ShouldStop = false;
+		};
+	}
+
+	UniqueRef<AsyncFileIOBackend> AsyncFileIOBackend::CreateThreaded(uint32 threadCount, const CompletionFunction &onComplete)
+	{
+		return UniqueRef<AsyncFileIOBackend>(new utils::ThreadedAsyncFileIOBackend(threadCount > 0 ? threadCount : 1, onComplete));
+	}
+
+#ifndef HL_PLATFORM_LINUX
+	UniqueRef<AsyncFileIOBackend> AsyncFileIOBackend::CreateNative(uint32 queueDepth, const CompletionFunction &onComplete)
+	{
+		return nullptr;
+	}
+#endif // HL_PLATFORM_LINUX
+
+	bool AsyncFileIOBackend::AllocateBuffer(AsyncIORequest *request, uint64 fileSize, uint64 &outReadSize)
+	{
+		if (request->Offset > fileSize)
+			return false;
+
+		uint64 available = fileSize - request->Offset;
+		outReadSize = request->Size > 0 && request->Size < available ? request->Size : available;
+
+		// The buffers are addressed with 32 bits
+		if (outReadSize > 0xFFFFFFFF)
+			return false;
+
+		request->Buffer.Release();
+		request->Buffer.Allocate((uint32)outReadSize);
+		return true;
+	}
+
+	AsyncFileIO::~AsyncFileIO()
+	{
+		Shutdown();
+	}
+
+	void AsyncFileIO::Init(uint32 queueDepth, uint32 fallbackThreadCount)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_Backend)
+			CreateBackend(queueDepth, fallbackThreadCount);
+	}
+
+	void AsyncFileIO::Shutdown()
+	{
+		std::vector<Ref<AsyncIORequest>> cancelled;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Backend)
+				return;
+
+			for (std::deque<Ref<AsyncIORequest>> &queue : m_Queued)
+			{
+				cancelled.insert(cancelled.end(), queue.begin(), queue.end());
+				queue.clear();
+			}
+		}
+
+		for (Ref<AsyncIORequest> request : cancelled)
+		{
+			request->CancelRequested = true;
+			request->State = AsyncIOState::Cancelled;
+			FinishRequest(request);
+		}
+
+		WaitAll();
+
+		UniqueRef<AsyncFileIOBackend> backend;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			backend = std::move(m_Backend);
+		}
+
+		backend->Shutdown();
+	}
+
+	Ref<AsyncIORequest> AsyncFileIO::Read(const FileSystemPath &filePath, const AsyncIOCallback &callback, AsyncIOPriority priority, uint64 offset, uint64 size)
+	{
+		Ref<AsyncIORequest> request = Ref<AsyncIORequest>::Create();
+		request->FilePath = filePath;
+		request->Offset = offset;
+		request->Size = size;
+		request->Priority = priority;
+		request->Callback = callback;
+
+		Submit({ request });
+		return request;
+	}
+
+	void AsyncFileIO::Submit(const std::vector<Ref<AsyncIORequest>> &requests)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Backend)
+				CreateBackend(64, 4);
+
+			for (Ref<AsyncIORequest> request : requests)
+			{
+				request->State = AsyncIOState::Queued;
+				request->Sequence = m_NextSequence++;
+				m_Queued[(uint32)request->Priority].push_back(request);
+				++m_Outstanding;
+			}
+		}
+
+		Dispatch();
+	}
+
+	bool AsyncFileIO::Cancel(const Ref<AsyncIORequest> &request)
+	{
+		Ref<AsyncIORequest> target = request;
+		Ref<AsyncIORequest> removed = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			AsyncIOState state = target->State;
+			if (state != AsyncIOState::Queued && state != AsyncIOState::InFlight)
+				return false;
+
+			target->CancelRequested = true;
+
+			std::deque<Ref<AsyncIORequest>> &queue = m_Queued[(uint32)target->Priority];
+			auto it = std::find(queue.begin(), queue.end(), target);
+			if (it != queue.end())
+			{
+				removed = *it;
+				queue.erase(it);
+			}
+		}
+
+		// Requests in flight are finished by the backend, the completion reports them as cancelled
+		if (removed)
+		{
+			removed->State = AsyncIOState::Cancelled;
+			FinishRequest(removed);
+		}
+
+		return true;
+	}
+
+	void AsyncFileIO::Wait(const Ref<AsyncIORequest> &request)
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_RequestFinished.wait(lock, [&request]() { return request->Finished.load(); });
+	}
+
+	void AsyncFileIO::WaitAll()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_RequestFinished.wait(lock, [this]() { return m_Outstanding == 0; });
+	}
+
+	const char *AsyncFileIO::GetBackendName()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Backend ? m_Backend->GetName() : "None";
+	}
+
+	uint32 AsyncFileIO::GetOutstandingCount()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Outstanding;
+	}
+
+	void AsyncFileIO::CreateBackend(uint32 queueDepth, uint32 fallbackThreadCount)
+	{
+		AsyncFileIOBackend::CompletionFunction onComplete = [this](AsyncIORequest *request, bool success)
+		{
+			OnBackendComplete(request, success);
+		};
+
+		m_Backend = AsyncFileIOBackend::CreateNative(queueDepth, onComplete);
+		if (!m_Backend)
+			m_Backend = AsyncFileIOBackend::CreateThreaded(fallbackThreadCount, onComplete);
+
+		HL_CORE_INFO(ASYNC_FILE_IO_LOG_PREFIX "[+] Using the {0} backend with {1} reads in flight [+]", m_Backend->GetName(), m_Backend->GetCapacity());
+	}
+
+	void AsyncFileIO::Dispatch()
+	{
+		std::vector<AsyncIORequest*> batch;
+		AsyncFileIOBackend *backend = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Backend)
+				return;
+
+			backend = m_Backend.Get();
+			uint32 capacity = backend->GetCapacity();
+
+			// Higher priorities are dispatched first, the requests of the same priority in the order in which they have been submitted
+			for (int32 priority = (int32)AsyncIOPriority::Count - 1; priority >= 0; --priority)
+			{
+				std::deque<Ref<AsyncIORequest>> &queue = m_Queued[priority];
+				while (!queue.empty() && m_InFlight.size() < capacity)
+				{
+					Ref<AsyncIORequest> request = queue.front();
+					queue.pop_front();
+
+					request->State = AsyncIOState::InFlight;
+					m_InFlight[request.Get()] = request;
+					batch.push_back(request.Get());
+				}
+			}
+		}
+
+		// The backend stays alive until all outstanding requests are finished, so it can be used without the lock
+		if (!batch.empty())
+			backend->Submit(batch);
+	}
+
+	void AsyncFileIO::OnBackendComplete(AsyncIORequest *request, bool success)
+	{
+		Ref<AsyncIORequest> finished = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			auto it = m_InFlight.find(request);
+			HL_ASSERT(it != m_InFlight.end());
+
+			finished = it->second;
+			m_InFlight.erase(it);
+		}
+
+		if (finished->CancelRequested)
+			finished->State = AsyncIOState::Cancelled;
+		else
+			finished->State = success ? AsyncIOState::Completed : AsyncIOState::Failed;
+
+		if (finished->State != AsyncIOState::Completed)
+			finished->Buffer.Release();
+
+		// A slot in the backend became free
+		Dispatch();
+		FinishRequest(finished);
+	}
+
+	void AsyncFileIO::FinishRequest(Ref<AsyncIORequest> request)
+	{
+		if (!request->Callback)
+		{
+			MarkFinished(request);
+			return;
+		}
+
+		ThreadPool::Get().Submit([this, request]() mutable
+		{
+			request->Callback(*request);
+			MarkFinished(request);
+		});
+	}
+
+	void AsyncFileIO::MarkFinished(Ref<AsyncIORequest> request)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			request->Finished = true;
+			--m_Outstanding;
+		}
+
+		m_RequestFinished.notify_all();
+	}
+}
+
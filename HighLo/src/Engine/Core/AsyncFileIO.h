@@ -0,0 +1,192 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <deque>
+#include <condition_variable>
+
+#include "Engine/Core/Singleton.h"
+#include "Engine/Core/SharedReference.h"
+#include "Engine/Core/UniqueReference.h"
+#include "Engine/Core/Allocator.h"
+#include "Engine/Core/FileSystemPath.h"
+
+namespace highlo
+{
+	enum class AsyncIOPriority : uint32
+	{
+		Low = 0,
+		Normal,
+		High,
+
+		Count
+	};
+
+	enum class AsyncIOState : uint32
+	{
+		Queued = 0,		/**< Waiting until the backend has room for another read. */
+		InFlight,		/**< The backend reads the file. */
+		Completed,		/**< The content is in the buffer of the request. */
+		Failed,			/**< The file could not be opened or read. */
+		Cancelled		/**< The request has been cancelled before it has been completed. */
+	};
+
+	struct AsyncIORequest;
+	using AsyncIOCallback = std::function<void(AsyncIORequest &request)>;
+
+	/// <summary>
+	/// A read of a file or a range of a file. The request is shared between the caller and the I/O service,
+	/// the fields that describe the read must not be changed after it has been submitted.
+	/// </summary>
+	struct AsyncIORequest : public IsSharedReference
+	{
+		FileSystemPath FilePath;
+		uint64 Offset = 0;
+		uint64 Size = 0;				/**< 0 reads until the end of the file. */
+		AsyncIOPriority Priority = AsyncIOPriority::Normal;
+
+		/// <summary>
+		/// Executed by the ThreadPool once the request is completed, failed or cancelled.
+		/// </summary>
+		AsyncIOCallback Callback;
+
+		std::atomic<AsyncIOState> State = AsyncIOState::Queued;
+		std::atomic<bool> CancelRequested = false;
+		std::atomic<bool> Finished = false;	/**< Set after the callback has returned. */
+
+		// Only written by the backend until the request is finished
+		Allocator Buffer;
+		uint64 Sequence = 0;
+
+		~AsyncIORequest() { Buffer.Release(); }
+
+		HLAPI bool IsFinished() const { return Finished; }
+		HLAPI bool Succeeded() const { return State == AsyncIOState::Completed; }
+	};
+
+	/// <summary>
+	/// Executes the reads of the AsyncFileIO service, the backends are implemented per platform.
+	/// </summary>
+	class AsyncFileIOBackend
+	{
+	public:
+
+		using CompletionFunction = std::function<void(AsyncIORequest *request, bool success)>;
+
+		virtual ~AsyncFileIOBackend() = default;
+
+		virtual const char *GetName() const = 0;
+
+		/// <summary>
+		/// The amount of reads that can be in flight at the same time.
+		/// </summary>
+		virtual uint32 GetCapacity() const = 0;
+
+		/// <summary>
+		/// Starts the reads, the completion function is called for every request from an arbitrary thread. Can be called from any thread.
+		/// </summary>
+		virtual void Submit(const std::vector<AsyncIORequest*> &requests) = 0;
+
+		/// <summary>
+		/// Waits for the reads in flight and stops the threads of the backend.
+		/// </summary>
+		virtual void Shutdown() = 0;
+
+		/// <summary>
+		/// Creates the native backend of the platform, for example io_uring on Linux.
+		/// </summary>
+		/// <returns>Returns nullptr, if the platform or the running kernel has no native backend.</returns>
+		static UniqueRef<AsyncFileIOBackend> CreateNative(uint32 queueDepth, const CompletionFunction &onComplete);
+
+		/// <summary>
+		/// Creates the portable backend, which reads the files with blocking calls on its own threads.
+		/// </summary>
+		static UniqueRef<AsyncFileIOBackend> CreateThreaded(uint32 threadCount, const CompletionFunction &onComplete);
+
+	protected:
+
+		/// <summary>
+		/// Clamps the range of the request to the size of the file and allocates the buffer for it.
+		/// </summary>
+		/// <returns>Returns false, if the range starts behind the end of the file or is too large for a buffer.</returns>
+		static bool AllocateBuffer(AsyncIORequest *request, uint64 fileSize, uint64 &outReadSize);
+	};
+
+	/// <summary>
+	/// Reads files asynchronously. The requests are handed to the backend by their priority and in the order in which they have been submitted,
+	/// as many at once as the backend can keep in flight. The callbacks of finished requests are executed by the ThreadPool.
+	/// All functions can be called from any thread, but Wait() must not be called from a callback.
+	/// </summary>
+	class AsyncFileIO : public Singleton<AsyncFileIO>
+	{
+	public:
+
+		HLAPI ~AsyncFileIO();
+
+		/// <summary>
+		/// Creates the backend, the service is initialized with the default settings on the first submit otherwise.
+		/// </summary>
+		/// <param name="queueDepth">The maximum amount of reads in flight for the native backend.</param>
+		/// <param name="fallbackThreadCount">The amount of threads of the portable backend, if the platform has no native backend.</param>
+		HLAPI void Init(uint32 queueDepth = 64, uint32 fallbackThreadCount = 4);
+
+		/// <summary>
+		/// Cancels all queued requests and waits for the reads in flight and their callbacks.
+		/// </summary>
+		HLAPI void Shutdown();
+
+		/// <summary>
+		/// Reads the whole file or the given range of it.
+		/// </summary>
+		HLAPI Ref<AsyncIORequest> Read(const FileSystemPath &filePath, const AsyncIOCallback &callback = nullptr, AsyncIOPriority priority = AsyncIOPriority::Normal, uint64 offset = 0, uint64 size = 0);
+
+		/// <summary>
+		/// Submits prepared requests together, so that the backend can start them with a single system call.
+		/// </summary>
+		HLAPI void Submit(const std::vector<Ref<AsyncIORequest>> &requests);
+
+		/// <summary>
+		/// Queued requests are removed right away, requests in flight are reported as cancelled once the backend has finished them.
+		/// The callback is executed in both cases.
+		/// </summary>
+		/// <returns>Returns false, if the request has already been finished.</returns>
+		HLAPI bool Cancel(const Ref<AsyncIORequest> &request);
+
+		/// <summary>
+		/// Blocks until the request is finished and its callback has returned.
+		/// </summary>
+		HLAPI void Wait(const Ref<AsyncIORequest> &request);
+		HLAPI void WaitAll();
+
+		HLAPI const char *GetBackendName();
+		HLAPI uint32 GetOutstandingCount();
+
+	private:
+
+		// Expects m_Mutex to be locked
+		void CreateBackend(uint32 queueDepth, uint32 fallbackThreadCount);
+
+		void Dispatch();
+		void OnBackendComplete(AsyncIORequest *request, bool success);
+		void FinishRequest(Ref<AsyncIORequest> request);
+		void MarkFinished(Ref<AsyncIORequest> request);
+
+		UniqueRef<AsyncFileIOBackend> m_Backend;
+		uint64 m_NextSequence = 0;
+		uint32 m_Outstanding = 0;
+
+		std::deque<Ref<AsyncIORequest>> m_Queued[(uint32)AsyncIOPriority::Count];
+		std::unordered_map<AsyncIORequest*, Ref<AsyncIORequest>> m_InFlight;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_RequestFinished;
+	};
+}
+
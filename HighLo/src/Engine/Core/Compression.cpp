@@ -0,0 +1,302 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Compression.h"
+
+// The LZ4 block format: every sequence starts with a token, whose high nibble is the literal length and whose low nibble is the match length - 4.
+// Lengths of 15 are continued with additional bytes until a byte is smaller than 255. The literals follow the literal length,
+// then the 16 bit little endian offset of the match and the continuation of the match length. The last sequence only contains literals.
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5		// The last 5 bytes are always literals
+#define LZ4_MATCH_FIND_LIMIT 12	// The last match has to start at least 12 bytes before the end
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_MAX_INPUT_SIZE 0x7E000000
+#define LZ4_HASH_LOG 12
+
+namespace highlo
+{
+	namespace utils
+	{
+		static uint32 ReadUInt32(const Byte *ptr)
+		{
+			uint32 value;
+			memcpy(&value, ptr, sizeof(uint32));
+			return value;
+		}
+
+		static uint32 HashSequence(uint32 sequence)
+		{
+			return (sequence * 2654435761u) >> (32 - LZ4_HASH_LOG);
+		}
+
+		static Byte *WriteLength(Byte *op, uint64 length)
+		{
+			while (length >= 255)
+			{
+				*op++ = 255;
+				length -= 255;
+			}
+
+			*op++ = (Byte)length;
+			return op;
+		}
+
+		static bool ReadLength(const Byte *&ip, const Byte *end, uint64 &length)
+		{
+			Byte value;
+			do
+			{
+				if (ip >= end)
+					return false;
+
+				value = *ip++;
+				length += value;
+			}
+			while (value == 255);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Writes one sequence, a match length of 0 writes the final sequence, which only consists of literals.
+		/// </summary>
+		static Byte *WriteSequence(Byte *op, Byte *end, const Byte *literals, uint64 literalLength, uint16 offset, uint64 matchLength)
+		{
+			// Worst case: token, length bytes of both lengths, literals and offset
+			uint64 required = 1 + literalLength + literalLength / 255 + 1 + 2 + matchLength / 255 + 1;
+			if ((uint64)(end - op) < required)
+				return nullptr;
+
+			Byte *token = op++;
+			*token = 0;
+
+			if (literalLength >= 15)
+			{
+				*token = 15 << 4;
+				op = WriteLength(op, literalLength - 15);
+			}
+			else
+			{
+				*token = (Byte)(literalLength << 4);
+			}
+
+			memcpy(op, literals, literalLength);
+			op += literalLength;
+
+			if (matchLength == 0)
+				return op;
+
+			*op++ = (Byte)(offset & 0xFF);
+			*op++ = (Byte)(offset >> 8);
+
+			uint64 length = matchLength - LZ4_MIN_MATCH;
+			if (length >= 15)
+			{
+				*token |= 15;
+				op = WriteLength(op, length - 15);
+			}
+			else
+			{
+				*token |= (Byte)length;
+			}
+
+			return op;
+		}
+
+		static uint64 CompressLZ4(const Byte *source, uint64 sourceSize, Byte *destination, uint64 destinationCapacity)
+		{
+			if (sourceSize > LZ4_MAX_INPUT_SIZE)
+				return 0;
+
+			Byte *op = destination;
+			Byte *opEnd = destination + destinationCapacity;
+			const Byte *anchor = source;
+
+			if (sourceSize > LZ4_MATCH_FIND_LIMIT)
+			{
+				// Stores the position of the last occurrence of every hashed 4 byte sequence,
+				// the entries are only hints and are verified before they are used
+				uint32 table[1 << LZ4_HASH_LOG] = {};
+
+				const Byte *ip = source;
+				const Byte *matchLimit = source + sourceSize - LZ4_LAST_LITERALS;
+				const Byte *findLimit = source + sourceSize - LZ4_MATCH_FIND_LIMIT;
+
+				while (ip < findLimit)
+				{
+					uint32 sequence = ReadUInt32(ip);
+					uint32 hash = HashSequence(sequence);
+					const Byte *candidate = source + table[hash];
+					table[hash] = (uint32)(ip - source);
+
+					if (candidate >= ip || ip - candidate > LZ4_MAX_OFFSET || ReadUInt32(candidate) != sequence)
+					{
+						++ip;
+						continue;
+					}
+
+					uint64 matchLength = LZ4_MIN_MATCH;
+					while (ip + matchLength < matchLimit && candidate[matchLength] == ip[matchLength])
+						++matchLength;
+
+					op = WriteSequence(op, opEnd, anchor, (uint64)(ip - anchor), (uint16)(ip - candidate), matchLength);
+					if (!op)
+						return 0;
+
+					ip += matchLength;
+					anchor = ip;
+				}
+			}
+
+			op = WriteSequence(op, opEnd, anchor, (uint64)(source + sourceSize - anchor), 0, 0);
+			return op ? (uint64)(op - destination) : 0;
+		}
+
+		static bool DecompressLZ4(const Byte *source, uint64 sourceSize, Byte *destination, uint64 destinationSize)
+		{
+			const Byte *ip = source;
+			const Byte *ipEnd = source + sourceSize;
+			Byte *op = destination;
+			Byte *opEnd = destination + destinationSize;
+
+			while (ip < ipEnd)
+			{
+				Byte token = *ip++;
+
+				uint64 literalLength = token >> 4;
+				if (literalLength == 15 && !ReadLength(ip, ipEnd, literalLength))
+					return false;
+
+				if (literalLength > (uint64)(ipEnd - ip) || literalLength > (uint64)(opEnd - op))
+					return false;
+
+				memcpy(op, ip, literalLength);
+				ip += literalLength;
+				op += literalLength;
+
+				// The last sequence has no match
+				if (ip == ipEnd)
+					break;
+
+				if (ipEnd - ip < 2)
+					return false;
+
+				uint64 offset = (uint64)ip[0] | ((uint64)ip[1] << 8);
+				ip += 2;
+
+				if (offset == 0 || offset > (uint64)(op - destination))
+					return false;
+
+				uint64 matchLength = token & 15;
+				if (matchLength == 15 && !ReadLength(ip, ipEnd, matchLength))
+					return false;
+
+				matchLength += LZ4_MIN_MATCH;
+				if (matchLength > (uint64)(opEnd - op))
+					return false;
+
+				// The match can overlap with the bytes that are written, so it has to be copied byte by byte in that case
+				const Byte *match = op - offset;
+				if (offset >= matchLength)
+				{
+					memcpy(op, match, matchLength);
+					op += matchLength;
+				}
+				else
+				{
+					for (uint64 i = 0; i < matchLength; ++i)
+						*op++ = *match++;
+				}
+			}
+
+			return op == opEnd;
+		}
+	}
+
+	uint64 Compression::GetMaxCompressedSize(CompressionType type, uint64 size)
+	{
+		switch (type)
+		{
+			case CompressionType::None:
+				return size;
+
+			case CompressionType::LZ4:
+				return size + size / 255 + 16;
+		}
+
+		return 0;
+	}
+
+	uint64 Compression::GetMaxDecompressedSize(CompressionType type, uint64 compressedSize)
+	{
+		switch (type)
+		{
+			case CompressionType::None:
+				return compressedSize;
+
+			case CompressionType::LZ4:
+			{
+				// Every additional byte of a match length adds at most 255 bytes to the output
+				const uint64 maxRatio = 255;
+				return compressedSize <= UINT64_MAX / maxRatio ? compressedSize * maxRatio : UINT64_MAX;
+			}
+		}
+
+		return 0;
+	}
+
+	uint64 Compression::Compress(CompressionType type, const void *source, uint64 sourceSize, void *destination, uint64 destinationCapacity)
+	{
+		switch (type)
+		{
+			case CompressionType::None:
+			{
+				if (destinationCapacity < sourceSize)
+					return 0;
+
+				memcpy(destination, source, sourceSize);
+				return sourceSize;
+			}
+
+			case CompressionType::LZ4:
+				return utils::CompressLZ4((const Byte*)source, sourceSize, (Byte*)destination, destinationCapacity);
+		}
+
+		return 0;
+	}
+
+	bool Compression::Decompress(CompressionType type, const void *source, uint64 sourceSize, void *destination, uint64 destinationSize)
+	{
+		switch (type)
+		{
+			case CompressionType::None:
+			{
+				if (sourceSize != destinationSize)
+					return false;
+
+				memcpy(destination, source, sourceSize);
+				return true;
+			}
+
+			case CompressionType::LZ4:
+				return utils::DecompressLZ4((const Byte*)source, sourceSize, (Byte*)destination, destinationSize);
+		}
+
+		return false;
+	}
+
+	const char *Compression::GetName(CompressionType type)
+	{
+		switch (type)
+		{
+			case CompressionType::None:
+				return "None";
+
+			case CompressionType::LZ4:
+				return "LZ4";
+		}
+
+		return "Unknown";
+	}
+}
+
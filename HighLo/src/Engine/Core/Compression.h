@@ -0,0 +1,54 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added GetMaxDecompressedSize
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+namespace highlo
+{
+	enum class CompressionType : uint32
+	{
+		None = 0,
+		LZ4			/**< The LZ4 block format, fast to decompress and compatible with other LZ4 block decoders. */
+	};
+
+	/// <summary>
+	/// Compresses and decompresses memory blocks, the size of the uncompressed data has to be stored by the caller.
+	/// </summary>
+	class Compression
+	{
+	public:
+
+		/// <summary>
+		/// Returns the size the destination buffer must have, so that the compression of any input of the given size succeeds.
+		/// </summary>
+		HLAPI static uint64 GetMaxCompressedSize(CompressionType type, uint64 size);
+
+		/// <summary>
+		/// Returns the largest size, that compressed data of the given size can be decompressed to,
+		/// so that the stored size of untrusted data can be checked before a buffer is allocated for it.
+		/// </summary>
+		HLAPI static uint64 GetMaxDecompressedSize(CompressionType type, uint64 compressedSize);
+
+		/// <summary>
+		/// Compresses the source into the destination.
+		/// </summary>
+		/// <returns>Returns the compressed size or 0, if the destination is too small.</returns>
+		HLAPI static uint64 Compress(CompressionType type, const void *source, uint64 sourceSize, void *destination, uint64 destinationCapacity);
+
+		/// <summary>
+		/// Decompresses the source into the destination, which has to be exactly as big as the uncompressed data.
+		/// Corrupted input is detected and never read or written out of bounds.
+		/// </summary>
+		HLAPI static bool Decompress(CompressionType type, const void *source, uint64 sourceSize, void *destination, uint64 destinationSize);
+
+		HLAPI static const char *GetName(CompressionType type);
+	};
+}
+
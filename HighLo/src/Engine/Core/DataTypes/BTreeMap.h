@@ -0,0 +1,708 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "FlatMap.h"
+
+#include <functional>
+#include <utility>
+
+namespace highlo
+{
+	/// <summary>
+	/// Ordered map, that stores its entries in a B+ tree. Every node holds many keys in one array, that spans a few cache lines,
+	/// so a lookup only touches a handful of nodes and searches each of them with a branchless binary search.
+	/// The tree stays balanced and inserting or removing only moves the entries of one node, so unlike HLFlatMap it is suited for maps that change often.
+	/// The entries are stored in linked leaves, iterating is a linear walk over the leaves.
+	/// Keys and values have to be default constructible. Iterators are invalidated by every insert and remove.
+	/// </summary>
+	/// <typeparam name="NodeSize">The size of the key array of a node in bytes.</typeparam>
+	template<typename Key, typename Value, typename Compare = std::less<Key>, uint32 NodeSize = 256>
+	class HLBTreeMap
+	{
+	private:
+
+		static constexpr uint32 MaxKeys = HL_MAX(4u, (uint32)(NodeSize / sizeof(Key)));
+		static constexpr uint32 MinKeys = MaxKeys / 2;
+
+		struct Node
+		{
+			bool IsLeaf;
+			uint32 Count = 0;
+			Key Keys[MaxKeys];
+
+			Node(bool isLeaf) : IsLeaf(isLeaf) {}
+		};
+
+		struct LeafNode : public Node
+		{
+			Value Values[MaxKeys];
+			LeafNode *Next = nullptr;
+			LeafNode *Prev = nullptr;
+
+			LeafNode() : Node(true) {}
+		};
+
+		struct InnerNode : public Node
+		{
+			Node *Children[MaxKeys + 1] = {};
+
+			InnerNode() : Node(false) {}
+		};
+
+		template<bool IsConst>
+		class IteratorBase
+		{
+		public:
+
+			using ValueReference = std::conditional_t<IsConst, const Value&, Value&>;
+
+			IteratorBase() = default;
+			IteratorBase(LeafNode *leaf, uint32 index)
+				: m_Leaf(leaf), m_Index(index)
+			{
+			}
+
+			// A const iterator can be created from a mutable one
+			template<bool OtherConst, typename = std::enable_if_t<IsConst || !OtherConst>>
+			IteratorBase(const IteratorBase<OtherConst> &other)
+				: m_Leaf(other.m_Leaf), m_Index(other.m_Index)
+			{
+			}
+
+			const Key &GetKey() const { return m_Leaf->Keys[m_Index]; }
+			ValueReference GetValue() const { return m_Leaf->Values[m_Index]; }
+
+			/// <summary>
+			/// The entries are not stored as pairs, so the pair only references the key and value. Use it as for (const auto &[key, value] : map).
+			/// </summary>
+			std::pair<const Key&, ValueReference> operator*() const { return { GetKey(), GetValue() }; }
+
+			IteratorBase &operator++()
+			{
+				if (++m_Index >= m_Leaf->Count)
+				{
+					m_Leaf = m_Leaf->Next;
+					m_Index = 0;
+				}
+
+				return *this;
+			}
+
+			IteratorBase operator++(int)
+			{
+				IteratorBase tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const IteratorBase &other) const { return m_Leaf == other.m_Leaf && m_Index == other.m_Index; }
+			bool operator!=(const IteratorBase &other) const { return !(*this == other); }
+
+		private:
+
+			LeafNode *m_Leaf = nullptr;
+			uint32 m_Index = 0;
+
+			template<bool> friend class IteratorBase;
+			friend class HLBTreeMap;
+		};
+
+		struct SplitResult
+		{
+			Key Separator;
+			Node *Right = nullptr;
+		};
+
+	public:
+
+		using Iterator = IteratorBase<false>;
+		using ConstIterator = IteratorBase<true>;
+
+		HLAPI HLBTreeMap() = default;
+
+		HLAPI explicit HLBTreeMap(const Compare &compare)
+			: m_Compare(compare)
+		{
+		}
+
+		HLAPI HLBTreeMap(const HLBTreeMap &other)
+			: m_Compare(other.m_Compare)
+		{
+			for (ConstIterator it = other.begin(); it != other.end(); ++it)
+				Emplace(it.GetKey(), it.GetValue());
+		}
+
+		HLAPI HLBTreeMap(HLBTreeMap &&other) noexcept
+			: m_Root(other.m_Root), m_First(other.m_First), m_Size(other.m_Size), m_Compare(std::move(other.m_Compare))
+		{
+			other.m_Root = nullptr;
+			other.m_First = nullptr;
+			other.m_Size = 0;
+		}
+
+		HLAPI ~HLBTreeMap()
+		{
+			Clear();
+		}
+
+		HLAPI HLBTreeMap &operator=(HLBTreeMap other) noexcept
+		{
+			std::swap(m_Root, other.m_Root);
+			std::swap(m_First, other.m_First);
+			std::swap(m_Size, other.m_Size);
+			std::swap(m_Compare, other.m_Compare);
+			return *this;
+		}
+
+		HLAPI Iterator Find(const Key &key)
+		{
+			if (!m_Root)
+				return end();
+
+			LeafNode *leaf = FindLeaf(key);
+			uint32 index = LowerBoundInNode(leaf, key);
+			if (index < leaf->Count && !m_Compare(key, leaf->Keys[index]))
+				return Iterator(leaf, index);
+
+			return end();
+		}
+
+		HLAPI ConstIterator Find(const Key &key) const
+		{
+			return const_cast<HLBTreeMap*>(this)->Find(key);
+		}
+
+		HLAPI bool Contains(const Key &key) const
+		{
+			return Find(key) != end();
+		}
+
+		/// <summary>
+		/// Returns a pointer to the value of the key or nullptr, if the map does not contain the key.
+		/// </summary>
+		HLAPI Value *TryGet(const Key &key)
+		{
+			Iterator it = Find(key);
+			return it != end() ? &it.GetValue() : nullptr;
+		}
+
+		HLAPI const Value *TryGet(const Key &key) const
+		{
+			ConstIterator it = Find(key);
+			return it != end() ? &it.GetValue() : nullptr;
+		}
+
+		HLAPI Value &At(const Key &key)
+		{
+			Iterator it = Find(key);
+			HL_ASSERT(it != end(), "The key does not exist!");
+			return it.GetValue();
+		}
+
+		HLAPI const Value &At(const Key &key) const
+		{
+			ConstIterator it = Find(key);
+			HL_ASSERT(it != end(), "The key does not exist!");
+			return it.GetValue();
+		}
+
+		/// <summary>
+		/// Returns the value of the key and inserts a default constructed value, if the key does not exist yet.
+		/// </summary>
+		HLAPI Value &operator[](const Key &key)
+		{
+			return Emplace(key).first.GetValue();
+		}
+
+		/// <summary>
+		/// Inserts the value, if the key does not exist yet, otherwise the existing value is kept.
+		/// </summary>
+		/// <returns>Returns the entry of the key and true, if the value has been inserted.</returns>
+		template<typename... Args>
+		HLAPI std::pair<Iterator, bool> Emplace(const Key &key, Args&&... args)
+		{
+			if (!m_Root)
+			{
+				m_First = new LeafNode();
+				m_Root = m_First;
+			}
+
+			Iterator position;
+			SplitResult split;
+			bool inserted = InsertRecursive(m_Root, key, split, position, std::forward<Args>(args)...);
+
+			if (split.Right)
+			{
+				// The root has been split, so the tree grows by one level
+				InnerNode *root = new InnerNode();
+				root->Keys[0] = std::move(split.Separator);
+				root->Children[0] = m_Root;
+				root->Children[1] = split.Right;
+				root->Count = 1;
+				m_Root = root;
+			}
+
+			if (inserted)
+				++m_Size;
+
+			return { position, inserted };
+		}
+
+		HLAPI std::pair<Iterator, bool> Insert(const Key &key, const Value &value)
+		{
+			return Emplace(key, value);
+		}
+
+		HLAPI std::pair<Iterator, bool> Insert(const Key &key, Value &&value)
+		{
+			return Emplace(key, std::move(value));
+		}
+
+		/// <summary>
+		/// Inserts the value or replaces the value of an existing key.
+		/// </summary>
+		HLAPI Value &InsertOrAssign(const Key &key, Value value)
+		{
+			auto [it, inserted] = Emplace(key, std::move(value));
+			if (!inserted)
+				it.GetValue() = std::move(value);
+
+			return it.GetValue();
+		}
+
+		/// <returns>Returns false, if the map does not contain the key.</returns>
+		HLAPI bool Remove(const Key &key)
+		{
+			if (!m_Root || !RemoveRecursive(m_Root, key))
+				return false;
+
+			--m_Size;
+
+			if (!m_Root->IsLeaf && m_Root->Count == 0)
+			{
+				// The root only has one child left, so the tree shrinks by one level
+				InnerNode *root = static_cast<InnerNode*>(m_Root);
+				m_Root = root->Children[0];
+				delete root;
+			}
+			else if (m_Root->IsLeaf && m_Root->Count == 0)
+			{
+				delete static_cast<LeafNode*>(m_Root);
+				m_Root = nullptr;
+				m_First = nullptr;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Returns the first entry, whose key is not less than the given key.
+		/// </summary>
+		HLAPI Iterator LowerBound(const Key &key)
+		{
+			if (!m_Root)
+				return end();
+
+			LeafNode *leaf = FindLeaf(key);
+			uint32 index = LowerBoundInNode(leaf, key);
+			if (index < leaf->Count)
+				return Iterator(leaf, index);
+
+			return Iterator(leaf->Next, 0);
+		}
+
+		HLAPI ConstIterator LowerBound(const Key &key) const
+		{
+			return const_cast<HLBTreeMap*>(this)->LowerBound(key);
+		}
+
+		HLAPI void Clear()
+		{
+			if (m_Root)
+				DestroyNode(m_Root);
+
+			m_Root = nullptr;
+			m_First = nullptr;
+			m_Size = 0;
+		}
+
+		HLAPI uint32 Size() const { return m_Size; }
+		HLAPI bool IsEmpty() const { return m_Size == 0; }
+
+		HLAPI Iterator begin() { return Iterator(m_First, 0); }
+		HLAPI Iterator end() { return Iterator(); }
+		HLAPI ConstIterator begin() const { return ConstIterator(m_First, 0); }
+		HLAPI ConstIterator end() const { return ConstIterator(); }
+
+	private:
+
+		uint32 LowerBoundInNode(const Node *node, const Key &key) const
+		{
+			return (uint32)(utils::BranchlessLowerBound(node->Keys, node->Count, key, [](const Key &k) -> const Key& { return k; }, m_Compare) - node->Keys);
+		}
+
+		/// <summary>
+		/// Returns the child, that contains the key. The separator key at index i is the smallest key of the child i + 1.
+		/// </summary>
+		uint32 ChildIndex(const Node *node, const Key &key) const
+		{
+			uint32 index = LowerBoundInNode(node, key);
+			if (index < node->Count && !m_Compare(key, node->Keys[index]))
+				++index;
+
+			return index;
+		}
+
+		LeafNode *FindLeaf(const Key &key) const
+		{
+			Node *node = m_Root;
+			while (!node->IsLeaf)
+				node = static_cast<InnerNode*>(node)->Children[ChildIndex(node, key)];
+
+			return static_cast<LeafNode*>(node);
+		}
+
+		template<typename... Args>
+		void InsertIntoLeaf(LeafNode *leaf, uint32 index, const Key &key, Args&&... args)
+		{
+			for (uint32 i = leaf->Count; i > index; --i)
+			{
+				leaf->Keys[i] = std::move(leaf->Keys[i - 1]);
+				leaf->Values[i] = std::move(leaf->Values[i - 1]);
+			}
+
+			leaf->Keys[index] = key;
+			leaf->Values[index] = Value(std::forward<Args>(args)...);
+			++leaf->Count;
+		}
+
+		void InsertIntoInner(InnerNode *node, uint32 index, Key &&separator, Node *right)
+		{
+			for (uint32 i = node->Count; i > index; --i)
+			{
+				node->Keys[i] = std::move(node->Keys[i - 1]);
+				node->Children[i + 1] = node->Children[i];
+			}
+
+			node->Keys[index] = std::move(separator);
+			node->Children[index + 1] = right;
+			++node->Count;
+		}
+
+		template<typename... Args>
+		bool InsertRecursive(Node *node, const Key &key, SplitResult &split, Iterator &position, Args&&... args)
+		{
+			if (node->IsLeaf)
+			{
+				LeafNode *leaf = static_cast<LeafNode*>(node);
+				uint32 index = LowerBoundInNode(leaf, key);
+				if (index < leaf->Count && !m_Compare(key, leaf->Keys[index]))
+				{
+					position = Iterator(leaf, index);
+					return false;
+				}
+
+				if (leaf->Count < MaxKeys)
+				{
+					InsertIntoLeaf(leaf, index, key, std::forward<Args>(args)...);
+					position = Iterator(leaf, index);
+					return true;
+				}
+
+				// The upper half of the full leaf moves into a new leaf on the right
+				LeafNode *right = new LeafNode();
+				const uint32 middle = MaxKeys / 2;
+				for (uint32 i = middle; i < MaxKeys; ++i)
+				{
+					right->Keys[i - middle] = std::move(leaf->Keys[i]);
+					right->Values[i - middle] = std::move(leaf->Values[i]);
+				}
+
+				right->Count = MaxKeys - middle;
+				leaf->Count = middle;
+
+				right->Next = leaf->Next;
+				right->Prev = leaf;
+				if (leaf->Next)
+					leaf->Next->Prev = right;
+				leaf->Next = right;
+
+				if (index <= middle)
+				{
+					InsertIntoLeaf(leaf, index, key, std::forward<Args>(args)...);
+					position = Iterator(leaf, index);
+				}
+				else
+				{
+					InsertIntoLeaf(right, index - middle, key, std::forward<Args>(args)...);
+					position = Iterator(right, index - middle);
+				}
+
+				split.Separator = right->Keys[0];
+				split.Right = right;
+				return true;
+			}
+
+			InnerNode *inner = static_cast<InnerNode*>(node);
+			uint32 childIndex = ChildIndex(inner, key);
+
+			SplitResult childSplit;
+			bool inserted = InsertRecursive(inner->Children[childIndex], key, childSplit, position, std::forward<Args>(args)...);
+			if (!childSplit.Right)
+				return inserted;
+
+			if (inner->Count < MaxKeys)
+			{
+				InsertIntoInner(inner, childIndex, std::move(childSplit.Separator), childSplit.Right);
+				return inserted;
+			}
+
+			// The middle key moves up to the parent, the keys and children after it move into a new node on the right
+			InnerNode *right = new InnerNode();
+			const uint32 middle = MaxKeys / 2;
+			for (uint32 i = middle + 1; i < MaxKeys; ++i)
+				right->Keys[i - middle - 1] = std::move(inner->Keys[i]);
+
+			for (uint32 i = middle + 1; i <= MaxKeys; ++i)
+				right->Children[i - middle - 1] = inner->Children[i];
+
+			right->Count = MaxKeys - middle - 1;
+			inner->Count = middle;
+			split.Separator = std::move(inner->Keys[middle]);
+			split.Right = right;
+
+			if (childIndex <= middle)
+				InsertIntoInner(inner, childIndex, std::move(childSplit.Separator), childSplit.Right);
+			else
+				InsertIntoInner(right, childIndex - middle - 1, std::move(childSplit.Separator), childSplit.Right);
+
+			return inserted;
+		}
+
+		bool RemoveRecursive(Node *node, const Key &key)
+		{
+			if (node->IsLeaf)
+			{
+				LeafNode *leaf = static_cast<LeafNode*>(node);
+				uint32 index = LowerBoundInNode(leaf, key);
+				if (index >= leaf->Count || m_Compare(key, leaf->Keys[index]))
+					return false;
+
+				for (uint32 i = index + 1; i < leaf->Count; ++i)
+				{
+					leaf->Keys[i - 1] = std::move(leaf->Keys[i]);
+					leaf->Values[i - 1] = std::move(leaf->Values[i]);
+				}
+
+				--leaf->Count;
+				ResetLeafSlot(leaf, leaf->Count);
+				return true;
+			}
+
+			InnerNode *inner = static_cast<InnerNode*>(node);
+			uint32 childIndex = ChildIndex(inner, key);
+			if (!RemoveRecursive(inner->Children[childIndex], key))
+				return false;
+
+			if (inner->Children[childIndex]->Count < MinKeys)
+				Rebalance(inner, childIndex);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Fills up a child with too few keys by borrowing a key from a sibling or by merging it with a sibling.
+		/// </summary>
+		void Rebalance(InnerNode *parent, uint32 childIndex)
+		{
+			Node *left = childIndex > 0 ? parent->Children[childIndex - 1] : nullptr;
+			Node *right = childIndex < parent->Count ? parent->Children[childIndex + 1] : nullptr;
+
+			if (left && left->Count > MinKeys)
+				BorrowFromLeft(parent, childIndex);
+			else if (right && right->Count > MinKeys)
+				BorrowFromRight(parent, childIndex);
+			else if (left)
+				Merge(parent, childIndex - 1);
+			else
+				Merge(parent, childIndex);
+		}
+
+		void BorrowFromLeft(InnerNode *parent, uint32 childIndex)
+		{
+			Node *child = parent->Children[childIndex];
+			Node *left = parent->Children[childIndex - 1];
+
+			if (child->IsLeaf)
+			{
+				LeafNode *childLeaf = static_cast<LeafNode*>(child);
+				LeafNode *leftLeaf = static_cast<LeafNode*>(left);
+
+				for (uint32 i = childLeaf->Count; i > 0; --i)
+				{
+					childLeaf->Keys[i] = std::move(childLeaf->Keys[i - 1]);
+					childLeaf->Values[i] = std::move(childLeaf->Values[i - 1]);
+				}
+
+				childLeaf->Keys[0] = std::move(leftLeaf->Keys[leftLeaf->Count - 1]);
+				childLeaf->Values[0] = std::move(leftLeaf->Values[leftLeaf->Count - 1]);
+				++childLeaf->Count;
+				--leftLeaf->Count;
+				ResetLeafSlot(leftLeaf, leftLeaf->Count);
+
+				parent->Keys[childIndex - 1] = childLeaf->Keys[0];
+				return;
+			}
+
+			InnerNode *childInner = static_cast<InnerNode*>(child);
+			InnerNode *leftInner = static_cast<InnerNode*>(left);
+
+			for (uint32 i = childInner->Count; i > 0; --i)
+				childInner->Keys[i] = std::move(childInner->Keys[i - 1]);
+
+			for (uint32 i = childInner->Count + 1; i > 0; --i)
+				childInner->Children[i] = childInner->Children[i - 1];
+
+			// The separator of the parent rotates down, the last key of the left sibling rotates up
+			childInner->Keys[0] = std::move(parent->Keys[childIndex - 1]);
+			childInner->Children[0] = leftInner->Children[leftInner->Count];
+			parent->Keys[childIndex - 1] = std::move(leftInner->Keys[leftInner->Count - 1]);
+
+			++childInner->Count;
+			--leftInner->Count;
+		}
+
+		void BorrowFromRight(InnerNode *parent, uint32 childIndex)
+		{
+			Node *child = parent->Children[childIndex];
+			Node *right = parent->Children[childIndex + 1];
+
+			if (child->IsLeaf)
+			{
+				LeafNode *childLeaf = static_cast<LeafNode*>(child);
+				LeafNode *rightLeaf = static_cast<LeafNode*>(right);
+
+				childLeaf->Keys[childLeaf->Count] = std::move(rightLeaf->Keys[0]);
+				childLeaf->Values[childLeaf->Count] = std::move(rightLeaf->Values[0]);
+				++childLeaf->Count;
+
+				for (uint32 i = 1; i < rightLeaf->Count; ++i)
+				{
+					rightLeaf->Keys[i - 1] = std::move(rightLeaf->Keys[i]);
+					rightLeaf->Values[i - 1] = std::move(rightLeaf->Values[i]);
+				}
+
+				--rightLeaf->Count;
+				ResetLeafSlot(rightLeaf, rightLeaf->Count);
+
+				parent->Keys[childIndex] = rightLeaf->Keys[0];
+				return;
+			}
+
+			InnerNode *childInner = static_cast<InnerNode*>(child);
+			InnerNode *rightInner = static_cast<InnerNode*>(right);
+
+			childInner->Keys[childInner->Count] = std::move(parent->Keys[childIndex]);
+			childInner->Children[childInner->Count + 1] = rightInner->Children[0];
+			parent->Keys[childIndex] = std::move(rightInner->Keys[0]);
+
+			for (uint32 i = 1; i < rightInner->Count; ++i)
+				rightInner->Keys[i - 1] = std::move(rightInner->Keys[i]);
+
+			for (uint32 i = 1; i <= rightInner->Count; ++i)
+				rightInner->Children[i - 1] = rightInner->Children[i];
+
+			++childInner->Count;
+			--rightInner->Count;
+		}
+
+		/// <summary>
+		/// Moves all keys of the child at index + 1 into the child at index and removes the separator between them from the parent.
+		/// </summary>
+		void Merge(InnerNode *parent, uint32 index)
+		{
+			Node *left = parent->Children[index];
+			Node *right = parent->Children[index + 1];
+
+			if (left->IsLeaf)
+			{
+				LeafNode *leftLeaf = static_cast<LeafNode*>(left);
+				LeafNode *rightLeaf = static_cast<LeafNode*>(right);
+
+				for (uint32 i = 0; i < rightLeaf->Count; ++i)
+				{
+					leftLeaf->Keys[leftLeaf->Count + i] = std::move(rightLeaf->Keys[i]);
+					leftLeaf->Values[leftLeaf->Count + i] = std::move(rightLeaf->Values[i]);
+				}
+
+				leftLeaf->Count += rightLeaf->Count;
+				leftLeaf->Next = rightLeaf->Next;
+				if (rightLeaf->Next)
+					rightLeaf->Next->Prev = leftLeaf;
+
+				delete rightLeaf;
+			}
+			else
+			{
+				InnerNode *leftInner = static_cast<InnerNode*>(left);
+				InnerNode *rightInner = static_cast<InnerNode*>(right);
+
+				leftInner->Keys[leftInner->Count] = std::move(parent->Keys[index]);
+				for (uint32 i = 0; i < rightInner->Count; ++i)
+					leftInner->Keys[leftInner->Count + 1 + i] = std::move(rightInner->Keys[i]);
+
+				for (uint32 i = 0; i <= rightInner->Count; ++i)
+					leftInner->Children[leftInner->Count + 1 + i] = rightInner->Children[i];
+
+				leftInner->Count += rightInner->Count + 1;
+				delete rightInner;
+			}
+
+			for (uint32 i = index + 1; i < parent->Count; ++i)
+			{
+				parent->Keys[i - 1] = std::move(parent->Keys[i]);
+				parent->Children[i] = parent->Children[i + 1];
+			}
+
+			--parent->Count;
+			parent->Keys[parent->Count] = Key();
+		}
+
+		/// <summary>
+		/// Releases the resources of a moved or removed entry.
+		/// </summary>
+		void ResetLeafSlot(LeafNode *leaf, uint32 index)
+		{
+			leaf->Keys[index] = Key();
+			leaf->Values[index] = Value();
+		}
+
+		void DestroyNode(Node *node)
+		{
+			if (node->IsLeaf)
+			{
+				delete static_cast<LeafNode*>(node);
+				return;
+			}
+
+			InnerNode *inner = static_cast<InnerNode*>(node);
+			for (uint32 i = 0; i <= inner->Count; ++i)
+				DestroyNode(inner->Children[i]);
+
+			delete inner;
+		}
+
+		Node *m_Root = nullptr;
+		LeafNode *m_First = nullptr;
+		uint32 m_Size = 0;
+		Compare m_Compare;
+	};
+}
+
@@ -0,0 +1,305 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#define HL_CACHE_LINE_SIZE 64
+
+namespace highlo
+{
+	namespace utils
+	{
+		inline uint32 NextPowerOfTwo(uint32 value)
+		{
+			uint32 result = 1;
+			while (result < value)
+				result <<= 1;
+
+			return result;
+		}
+	}
+
+	/// <summary>
+	/// Bounded lock-free queue for exactly one producer thread and one consumer thread, for example the render commands
+	/// from the game thread to the render thread. The capacity is fixed at construction and rounded up to a power of two.
+	/// </summary>
+	template<typename T>
+	class HLSPSCQueue
+	{
+	public:
+
+		HLAPI explicit HLSPSCQueue(uint32 capacity)
+			: m_Capacity(utils::NextPowerOfTwo(HL_MAX(capacity, 2u))), m_Mask(m_Capacity - 1)
+		{
+			m_Data = static_cast<T*>(::operator new(sizeof(T) * m_Capacity));
+		}
+
+		HLAPI ~HLSPSCQueue()
+		{
+			const uint64 tail = m_Tail.load(std::memory_order_acquire);
+			for (uint64 i = m_Head.load(std::memory_order_acquire); i < tail; ++i)
+				m_Data[i & m_Mask].~T();
+
+			::operator delete(m_Data);
+		}
+
+		HLSPSCQueue(const HLSPSCQueue&) = delete;
+		HLSPSCQueue &operator=(const HLSPSCQueue&) = delete;
+
+		/// <summary>
+		/// Adds an element at the end of the queue. May only be called by the producer thread.
+		/// </summary>
+		/// <returns>Returns false, if the queue is full.</returns>
+		template<typename... Args>
+		HLAPI bool TryEmplace(Args&&... args)
+		{
+			const uint64 tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead == m_Capacity)
+			{
+				// Only reload the position of the consumer if the queue looks full, to keep its cache line shared
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead == m_Capacity)
+					return false;
+			}
+
+			new (&m_Data[tail & m_Mask]) T(std::forward<Args>(args)...);
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		HLAPI bool TryPush(const T &value)
+		{
+			return TryEmplace(value);
+		}
+
+		HLAPI bool TryPush(T &&value)
+		{
+			return TryEmplace(std::move(value));
+		}
+
+		/// <summary>
+		/// Removes the first element of the queue. May only be called by the consumer thread.
+		/// </summary>
+		/// <returns>Returns false, if the queue is empty.</returns>
+		HLAPI bool TryPop(T &value)
+		{
+			const uint64 head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return false;
+			}
+
+			T &element = m_Data[head & m_Mask];
+			value = std::move(element);
+			element.~T();
+
+			m_Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// <summary>
+		/// Returns the amount of elements, the result can already be outdated if the other thread is working on the queue.
+		/// </summary>
+		HLAPI uint32 SizeApprox() const
+		{
+			const uint64 head = m_Head.load(std::memory_order_acquire);
+			const uint64 tail = m_Tail.load(std::memory_order_acquire);
+			return tail > head ? (uint32)(tail - head) : 0;
+		}
+
+		HLAPI bool IsEmpty() const
+		{
+			return SizeApprox() == 0;
+		}
+
+		HLAPI uint32 GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+	private:
+
+		T *m_Data = nullptr;
+		const uint32 m_Capacity;
+		const uint32 m_Mask;
+
+		// The consumer and producer data live on separate cache lines, so the threads do not invalidate each other's cache
+		alignas(HL_CACHE_LINE_SIZE) std::atomic<uint64> m_Head = 0;
+		uint64 m_CachedTail = 0;
+
+		alignas(HL_CACHE_LINE_SIZE) std::atomic<uint64> m_Tail = 0;
+		uint64 m_CachedHead = 0;
+	};
+
+	/// <summary>
+	/// Bounded lock-free queue for any amount of producer and consumer threads, for example events or log messages that are
+	/// sent from worker threads. Every slot stores a sequence number, so producers and consumers only compete for the
+	/// position counters and never wait for a lock. The capacity is fixed at construction and rounded up to a power of two.
+	/// </summary>
+	template<typename T>
+	class HLMPMCQueue
+	{
+	public:
+
+		HLAPI explicit HLMPMCQueue(uint32 capacity)
+			: m_Capacity(utils::NextPowerOfTwo(HL_MAX(capacity, 2u))), m_Mask(m_Capacity - 1)
+		{
+			m_Slots = static_cast<Slot*>(::operator new(sizeof(Slot) * m_Capacity, std::align_val_t(alignof(Slot))));
+			for (uint32 i = 0; i < m_Capacity; ++i)
+				new (&m_Slots[i].Sequence) std::atomic<uint64>(i);
+		}
+
+		HLAPI ~HLMPMCQueue()
+		{
+			const uint64 tail = m_Tail.load(std::memory_order_acquire);
+			for (uint64 i = m_Head.load(std::memory_order_acquire); i < tail; ++i)
+				m_Slots[i & m_Mask].GetValue()->~T();
+
+			::operator delete(m_Slots, std::align_val_t(alignof(Slot)));
+		}
+
+		HLMPMCQueue(const HLMPMCQueue&) = delete;
+		HLMPMCQueue &operator=(const HLMPMCQueue&) = delete;
+
+		/// <summary>
+		/// Adds an element at the end of the queue, can be called from any thread.
+		/// </summary>
+		/// <returns>Returns false, if the queue is full.</returns>
+		template<typename... Args>
+		HLAPI bool TryEmplace(Args&&... args)
+		{
+			uint64 position = m_Tail.load(std::memory_order_relaxed);
+			Slot *slot;
+
+			for (;;)
+			{
+				slot = &m_Slots[position & m_Mask];
+				const uint64 sequence = slot->Sequence.load(std::memory_order_acquire);
+				const int64 difference = (int64)sequence - (int64)position;
+
+				if (difference == 0)
+				{
+					// The slot is free for this position, claim it if no other producer was faster
+					if (m_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					// The slot still holds the element of the previous round
+					return false;
+				}
+				else
+				{
+					position = m_Tail.load(std::memory_order_relaxed);
+				}
+			}
+
+			new (slot->GetValue()) T(std::forward<Args>(args)...);
+			slot->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		HLAPI bool TryPush(const T &value)
+		{
+			return TryEmplace(value);
+		}
+
+		HLAPI bool TryPush(T &&value)
+		{
+			return TryEmplace(std::move(value));
+		}
+
+		/// <summary>
+		/// Removes the first element of the queue, can be called from any thread.
+		/// </summary>
+		/// <returns>Returns false, if the queue is empty.</returns>
+		HLAPI bool TryPop(T &value)
+		{
+			uint64 position = m_Head.load(std::memory_order_relaxed);
+			Slot *slot;
+
+			for (;;)
+			{
+				slot = &m_Slots[position & m_Mask];
+				const uint64 sequence = slot->Sequence.load(std::memory_order_acquire);
+				const int64 difference = (int64)sequence - (int64)(position + 1);
+
+				if (difference == 0)
+				{
+					if (m_Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					// No producer has written this slot yet
+					return false;
+				}
+				else
+				{
+					position = m_Head.load(std::memory_order_relaxed);
+				}
+			}
+
+			T *element = slot->GetValue();
+			value = std::move(*element);
+			element->~T();
+
+			// Frees the slot for the producers of the next round
+			slot->Sequence.store(position + m_Capacity, std::memory_order_release);
+			return true;
+		}
+
+		/// <summary>
+		/// Returns the amount of elements, the result can already be outdated if other threads are working on the queue.
+		/// </summary>
+		HLAPI uint32 SizeApprox() const
+		{
+			const uint64 head = m_Head.load(std::memory_order_acquire);
+			const uint64 tail = m_Tail.load(std::memory_order_acquire);
+			return tail > head ? (uint32)(tail - head) : 0;
+		}
+
+		HLAPI bool IsEmpty() const
+		{
+			return SizeApprox() == 0;
+		}
+
+		HLAPI uint32 GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+	private:
+
+		struct Slot
+		{
+			std::atomic<uint64> Sequence;
+			alignas(T) uint8 Storage[sizeof(T)];
+
+			T *GetValue()
+			{
+				return reinterpret_cast<T*>(Storage);
+			}
+		};
+
+		Slot *m_Slots = nullptr;
+		const uint32 m_Capacity;
+		const uint32 m_Mask;
+
+		alignas(HL_CACHE_LINE_SIZE) std::atomic<uint64> m_Head = 0;
+		alignas(HL_CACHE_LINE_SIZE) std::atomic<uint64> m_Tail = 0;
+	};
+}
+
@@ -0,0 +1,78 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/LinearAllocator.h"
+
+#include <new>
+
+namespace highlo
+{
+	// Container allocators provide the raw memory of containers like HLVector. Every allocator has to implement
+	//     void *Allocate(uint64 size, uint64 alignment);
+	//     void Free(void *memory, uint64 size, uint64 alignment);
+	// The allocator is copied together with the container, so it should only hold a pointer to its memory source.
+
+	/// <summary>
+	/// The default container allocator, that allocates from the global heap.
+	/// </summary>
+	struct HeapContainerAllocator
+	{
+		HLAPI void *Allocate(uint64 size, uint64 alignment)
+		{
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				return ::operator new((size_t)size, std::align_val_t((size_t)alignment));
+
+			return ::operator new((size_t)size);
+		}
+
+		HLAPI void Free(void *memory, uint64 size, uint64 alignment)
+		{
+			if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				::operator delete(memory, std::align_val_t((size_t)alignment));
+			else
+				::operator delete(memory);
+		}
+	};
+
+	/// <summary>
+	/// Allocates container memory from a LinearAllocator, for example for temporary lists that are built and thrown away every frame.
+	/// Free does nothing, the memory is only returned by LinearAllocator::FreeAll, so the container should be reserved up front.
+	/// </summary>
+	class LinearContainerAllocator
+	{
+	public:
+
+		HLAPI LinearContainerAllocator() = default;
+		HLAPI LinearContainerAllocator(LinearAllocator *allocator)
+			: m_Allocator(allocator)
+		{
+		}
+
+		HLAPI void *Allocate(uint64 size, uint64 alignment)
+		{
+			HL_ASSERT(m_Allocator, "The container has no LinearAllocator!");
+
+			uint8 *memory = (uint8*)m_Allocator->Allocate(size + alignment - 1);
+			if (!memory)
+				return nullptr;
+
+			return (void*)(((uint64)memory + alignment - 1) & ~(alignment - 1));
+		}
+
+		HLAPI void Free(void *memory, uint64 size, uint64 alignment)
+		{
+		}
+
+	private:
+
+		LinearAllocator *m_Allocator = nullptr;
+	};
+}
+
@@ -2,6 +2,9 @@
 
 //
 // version history:
+//     - 1.5 (2026-10-19) Added FlatMap and BTreeMap
+//     - 1.4 (2026-10-19) Added ConcurrentQueue
+//     - 1.3 (2026-10-19) Added Name
 //     - 1.2 (2022-09-19) Added Optional
 //     - 1.1 (2021-10-22) Added Sorting
 //     - 1.0 (2021-09-14) initial release
@@ -12,10 +15,14 @@
 #include "List.h"
 #include "Optional.h"
 #include "String.h"
+#include "Name.h"
 #include "StringView.h"
 #include "Queue.h"
+#include "ConcurrentQueue.h"
 #include "Stack.h"
 #include "Hashmap.h"
+#include "FlatMap.h"
+#include "BTreeMap.h"
 #include "Vector.h"
 #include "Sorting.h"
 #include "BinaryTree.h"
@@ -0,0 +1,241 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <functional>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace highlo
+{
+	namespace utils
+	{
+		/// <summary>
+		/// Binary search, that only uses the result of the comparison to move the base, so the compiler can use a conditional move instead of a branch.
+		/// Returns the first element, that is not less than the key.
+		/// </summary>
+		template<typename T, typename Key, typename GetKey, typename Compare>
+		inline const T *BranchlessLowerBound(const T *data, uint32 count, const Key &key, GetKey getKey, const Compare &compare)
+		{
+			if (count == 0)
+				return data;
+
+			const T *base = data;
+			while (count > 1)
+			{
+				const uint32 half = count / 2;
+				base = compare(getKey(base[half]), key) ? base + half : base;
+				count -= half;
+			}
+
+			return base + (compare(getKey(*base), key) ? 1 : 0);
+		}
+	}
+
+	/// <summary>
+	/// Ordered map, that stores its entries sorted in one array. Lookups are a branchless binary search over contiguous memory
+	/// and iterating is a linear walk, but inserting and removing moves all following entries.
+	/// Use it for maps that are mostly read, like registries that are filled once at startup.
+	/// Iterators and references are invalidated by every insert and remove.
+	/// </summary>
+	template<typename Key, typename Value, typename Compare = std::less<Key>>
+	class HLFlatMap
+	{
+	public:
+
+		using EntryType = std::pair<Key, Value>;
+		using Iterator = typename std::vector<EntryType>::iterator;
+		using ConstIterator = typename std::vector<EntryType>::const_iterator;
+
+		HLAPI HLFlatMap() = default;
+
+		HLAPI explicit HLFlatMap(const Compare &compare)
+			: m_Compare(compare)
+		{
+		}
+
+		HLAPI HLFlatMap(std::initializer_list<EntryType> entries, const Compare &compare = Compare())
+			: m_Compare(compare)
+		{
+			m_Entries.reserve(entries.size());
+			for (const EntryType &entry : entries)
+				Insert(entry.first, entry.second);
+		}
+
+		/// <summary>
+		/// Adopts entries, that are already sorted by the key and contain every key only once, without sorting them again.
+		/// </summary>
+		HLAPI static HLFlatMap FromSorted(std::vector<EntryType> &&entries, const Compare &compare = Compare())
+		{
+			HLFlatMap map(compare);
+			map.m_Entries = std::move(entries);
+			return map;
+		}
+
+		HLAPI Iterator Find(const Key &key)
+		{
+			Iterator it = LowerBound(key);
+			return (it != m_Entries.end() && !m_Compare(key, it->first)) ? it : m_Entries.end();
+		}
+
+		HLAPI ConstIterator Find(const Key &key) const
+		{
+			ConstIterator it = LowerBound(key);
+			return (it != m_Entries.end() && !m_Compare(key, it->first)) ? it : m_Entries.end();
+		}
+
+		HLAPI bool Contains(const Key &key) const
+		{
+			return Find(key) != m_Entries.end();
+		}
+
+		/// <summary>
+		/// Returns a pointer to the value of the key or nullptr, if the map does not contain the key.
+		/// </summary>
+		HLAPI Value *TryGet(const Key &key)
+		{
+			Iterator it = Find(key);
+			return it != m_Entries.end() ? &it->second : nullptr;
+		}
+
+		HLAPI const Value *TryGet(const Key &key) const
+		{
+			ConstIterator it = Find(key);
+			return it != m_Entries.end() ? &it->second : nullptr;
+		}
+
+		HLAPI Value &At(const Key &key)
+		{
+			Iterator it = Find(key);
+			HL_ASSERT(it != m_Entries.end(), "The key does not exist!");
+			return it->second;
+		}
+
+		HLAPI const Value &At(const Key &key) const
+		{
+			ConstIterator it = Find(key);
+			HL_ASSERT(it != m_Entries.end(), "The key does not exist!");
+			return it->second;
+		}
+
+		/// <summary>
+		/// Returns the value of the key and inserts a default constructed value, if the key does not exist yet.
+		/// </summary>
+		HLAPI Value &operator[](const Key &key)
+		{
+			return Emplace(key).first->second;
+		}
+
+		/// <summary>
+		/// Inserts the value, if the key does not exist yet, otherwise the existing value is kept.
+		/// </summary>
+		/// <returns>Returns the entry of the key and true, if the value has been inserted.</returns>
+		template<typename... Args>
+		HLAPI std::pair<Iterator, bool> Emplace(const Key &key, Args&&... args)
+		{
+			Iterator it = LowerBound(key);
+			if (it != m_Entries.end() && !m_Compare(key, it->first))
+				return { it, false };
+
+			it = m_Entries.emplace(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { it, true };
+		}
+
+		HLAPI std::pair<Iterator, bool> Insert(const Key &key, const Value &value)
+		{
+			return Emplace(key, value);
+		}
+
+		HLAPI std::pair<Iterator, bool> Insert(const Key &key, Value &&value)
+		{
+			return Emplace(key, std::move(value));
+		}
+
+		/// <summary>
+		/// Inserts the value or replaces the value of an existing key.
+		/// </summary>
+		HLAPI Value &InsertOrAssign(const Key &key, Value value)
+		{
+			auto [it, inserted] = Emplace(key, std::move(value));
+			if (!inserted)
+				it->second = std::move(value);
+
+			return it->second;
+		}
+
+		/// <returns>Returns false, if the map does not contain the key.</returns>
+		HLAPI bool Remove(const Key &key)
+		{
+			Iterator it = Find(key);
+			if (it == m_Entries.end())
+				return false;
+
+			m_Entries.erase(it);
+			return true;
+		}
+
+		/// <returns>Returns the iterator to the entry after the removed entry.</returns>
+		HLAPI Iterator Remove(ConstIterator it)
+		{
+			return m_Entries.erase(it);
+		}
+
+		/// <summary>
+		/// Returns the first entry, whose key is not less than the given key.
+		/// </summary>
+		HLAPI Iterator LowerBound(const Key &key)
+		{
+			return m_Entries.begin() + (LowerBoundPtr(key) - m_Entries.data());
+		}
+
+		HLAPI ConstIterator LowerBound(const Key &key) const
+		{
+			return m_Entries.begin() + (LowerBoundPtr(key) - m_Entries.data());
+		}
+
+		/// <summary>
+		/// Returns the first entry, whose key is greater than the given key.
+		/// </summary>
+		HLAPI Iterator UpperBound(const Key &key)
+		{
+			Iterator it = LowerBound(key);
+			return (it != m_Entries.end() && !m_Compare(key, it->first)) ? it + 1 : it;
+		}
+
+		HLAPI ConstIterator UpperBound(const Key &key) const
+		{
+			ConstIterator it = LowerBound(key);
+			return (it != m_Entries.end() && !m_Compare(key, it->first)) ? it + 1 : it;
+		}
+
+		HLAPI void Reserve(uint32 capacity) { m_Entries.reserve(capacity); }
+		HLAPI void Clear() { m_Entries.clear(); }
+		HLAPI uint32 Size() const { return (uint32)m_Entries.size(); }
+		HLAPI bool IsEmpty() const { return m_Entries.empty(); }
+
+		HLAPI Iterator begin() { return m_Entries.begin(); }
+		HLAPI Iterator end() { return m_Entries.end(); }
+		HLAPI ConstIterator begin() const { return m_Entries.begin(); }
+		HLAPI ConstIterator end() const { return m_Entries.end(); }
+
+	private:
+
+		const EntryType *LowerBoundPtr(const Key &key) const
+		{
+			return utils::BranchlessLowerBound(m_Entries.data(), (uint32)m_Entries.size(), key, [](const EntryType &entry) -> const Key& { return entry.first; }, m_Compare);
+		}
+
+		std::vector<EntryType> m_Entries;
+		Compare m_Compare;
+	};
+}
+
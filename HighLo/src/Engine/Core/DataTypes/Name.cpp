@@ -0,0 +1,220 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Name.h"
+
+#include <mutex>
+#include <shared_mutex>
+
+#define NAME_TABLE_LOG_PREFIX "NameTable>    "
+
+#define NAME_TABLE_PAGE_SIZE 4096
+#define NAME_TABLE_MAX_PAGES 4096
+#define NAME_TABLE_SHARD_COUNT 64
+
+namespace highlo
+{
+	namespace utils
+	{
+		struct NameEntry
+		{
+			HLString Str;
+			uint64 Hash = 0;
+			uint32 NextWithSameHash = HLName::None;
+		};
+
+		struct NameTableShard
+		{
+			std::shared_mutex Mutex;
+			std::unordered_map<uint64, uint32> FirstIDs; // the hash of a string to the first entry with the hash
+		};
+
+		/// <summary>
+		/// The entries are stored in pages that are never moved or freed, so an id can be resolved without a lock.
+		/// Only the lookup by string is guarded, by one of several shards, so that threads interning different names rarely wait for each other.
+		/// </summary>
+		class NameTable
+		{
+		public:
+
+			NameTable()
+			{
+				// The first entry is the empty name
+				NameEntry &none = AllocateEntry(m_EntryCount++);
+				none.Hash = HashName("", 0);
+			}
+
+			~NameTable()
+			{
+				for (uint32 i = 0; i < NAME_TABLE_MAX_PAGES; ++i)
+					delete[] m_Pages[i].load(std::memory_order_relaxed);
+			}
+
+			uint32 Intern(const char *str, uint32 length, uint64 hash)
+			{
+				if (length == 0)
+					return HLName::None;
+
+				NameTableShard &shard = GetShard(hash);
+
+				{
+					std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+					uint32 id = FindInShard(shard, str, length, hash);
+					if (id != HLName::None)
+						return id;
+				}
+
+				std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+
+				// Another thread could have added the string between both locks
+				uint32 id = FindInShard(shard, str, length, hash);
+				if (id != HLName::None)
+					return id;
+
+				id = m_EntryCount.fetch_add(1, std::memory_order_relaxed);
+				if (id >= NAME_TABLE_PAGE_SIZE * NAME_TABLE_MAX_PAGES)
+				{
+					HL_CORE_ERROR(NAME_TABLE_LOG_PREFIX "[-] The name table is full, could not add {0} [-]", std::string(str, length));
+					return HLName::None;
+				}
+
+				NameEntry &entry = AllocateEntry(id);
+				entry.Str = HLString(str, length);
+				entry.Hash = hash;
+
+				auto [it, inserted] = shard.FirstIDs.try_emplace(hash, id);
+				if (!inserted)
+				{
+					// Hash collision, the new entry is put at the front of the chain
+					entry.NextWithSameHash = it->second;
+					it->second = id;
+				}
+
+				return id;
+			}
+
+			uint32 Find(const char *str, uint32 length, uint64 hash)
+			{
+				if (length == 0)
+					return HLName::None;
+
+				NameTableShard &shard = GetShard(hash);
+				std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+				return FindInShard(shard, str, length, hash);
+			}
+
+			const NameEntry &GetEntry(uint32 id) const
+			{
+				HL_ASSERT(id < m_EntryCount.load(std::memory_order_relaxed), "Invalid name id!");
+				return m_Pages[id / NAME_TABLE_PAGE_SIZE].load(std::memory_order_acquire)[id % NAME_TABLE_PAGE_SIZE];
+			}
+
+			uint32 GetEntryCount() const
+			{
+				return m_EntryCount.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			NameTableShard &GetShard(uint64 hash)
+			{
+				// The low bits select the bucket inside of the shard, so the shard is selected by the high bits
+				return m_Shards[(hash >> 58) % NAME_TABLE_SHARD_COUNT];
+			}
+
+			uint32 FindInShard(NameTableShard &shard, const char *str, uint32 length, uint64 hash) const
+			{
+				auto it = shard.FirstIDs.find(hash);
+				if (it == shard.FirstIDs.end())
+					return HLName::None;
+
+				for (uint32 id = it->second; id != HLName::None;)
+				{
+					const NameEntry &entry = GetEntry(id);
+					if (entry.Str.Length() == length && memcmp(entry.Str.C_Str(), str, length) == 0)
+						return id;
+
+					id = entry.NextWithSameHash;
+				}
+
+				return HLName::None;
+			}
+
+			NameEntry &AllocateEntry(uint32 id)
+			{
+				std::atomic<NameEntry*> &page = m_Pages[id / NAME_TABLE_PAGE_SIZE];
+
+				NameEntry *entries = page.load(std::memory_order_acquire);
+				if (!entries)
+				{
+					// Several shards can need the same page at the same time, only one allocation survives
+					NameEntry *newEntries = new NameEntry[NAME_TABLE_PAGE_SIZE];
+					if (page.compare_exchange_strong(entries, newEntries, std::memory_order_acq_rel))
+						entries = newEntries;
+					else
+						delete[] newEntries;
+				}
+
+				return entries[id % NAME_TABLE_PAGE_SIZE];
+			}
+
+			std::atomic<NameEntry*> m_Pages[NAME_TABLE_MAX_PAGES] = {};
+			std::atomic<uint32> m_EntryCount = 0;
+			NameTableShard m_Shards[NAME_TABLE_SHARD_COUNT];
+		};
+
+		static NameTable &GetNameTable()
+		{
+			// Constructed on first use, because names can be created during static initialization
+			static NameTable s_NameTable;
+			return s_NameTable;
+		}
+	}
+
+	HLName::HLName(const char *str)
+		: HLName(str, (uint32)strlen(str))
+	{
+	}
+
+	HLName::HLName(const char *str, uint32 length)
+		: m_ID(utils::GetNameTable().Intern(str, length, utils::HashName(str, length)))
+	{
+	}
+
+	HLName::HLName(const HLString &str)
+		: HLName(str.C_Str(), str.Length())
+	{
+	}
+
+	HLName::HLName(const HLNameLiteral &literal)
+		: m_ID(utils::GetNameTable().Intern(literal.Str, literal.Length, literal.Hash))
+	{
+	}
+
+	HLName HLName::FromID(uint32 id)
+	{
+		HL_ASSERT(id < utils::GetNameTable().GetEntryCount(), "Invalid name id!");
+		return HLName(id);
+	}
+
+	HLName HLName::Find(const char *str, uint32 length)
+	{
+		return HLName(utils::GetNameTable().Find(str, length, utils::HashName(str, length)));
+	}
+
+	uint32 HLName::GetNameCount()
+	{
+		return utils::GetNameTable().GetEntryCount();
+	}
+
+	uint64 HLName::GetHash() const
+	{
+		return utils::GetNameTable().GetEntry(m_ID).Hash;
+	}
+
+	const HLString &HLName::GetString() const
+	{
+		return utils::GetNameTable().GetEntry(m_ID).Str;
+	}
+}
+
@@ -0,0 +1,138 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "String.h"
+
+/// <summary>
+/// Interns a string literal once per call site, the hash of the literal is computed at compile time.
+/// Use it for names on hot paths, like uniform names: material->Set(HL_NAME("u_Color"), color);
+/// </summary>
+#define HL_NAME(literal) ([]() -> const ::highlo::HLName& { static constexpr ::highlo::HLNameLiteral s_Literal(literal); static const ::highlo::HLName s_Name(s_Literal); return s_Name; }())
+
+namespace highlo
+{
+	namespace utils
+	{
+		/// <summary>
+		/// 64-bit FNV-1a, usable at compile time.
+		/// </summary>
+		constexpr uint64 HashName(const char *str, uint32 length)
+		{
+			uint64 hash = 14695981039346656037ull;
+			for (uint32 i = 0; i < length; ++i)
+				hash = (hash ^ (uint8)str[i]) * 1099511628211ull;
+
+			return hash;
+		}
+	}
+
+	/// <summary>
+	/// A string literal with its length and hash, created at compile time by HL_NAME.
+	/// </summary>
+	struct HLNameLiteral
+	{
+		const char *Str;
+		uint32 Length;
+		uint64 Hash;
+
+		template<uint32 N>
+		constexpr HLNameLiteral(const char (&literal)[N])
+			: Str(literal), Length(N - 1), Hash(utils::HashName(literal, N - 1))
+		{
+		}
+	};
+
+	/// <summary>
+	/// An interned string. Every distinct string is stored once in a global, append-only table and
+	/// the name only holds the 32-bit index of the entry, so copying, comparing and hashing names are integer operations.
+	/// The table is never shrunk, so names should be used for identifiers and not for arbitrary text.
+	/// </summary>
+	class HLName
+	{
+	public:
+
+		/// <summary>
+		/// The id of the empty name.
+		/// </summary>
+		static constexpr uint32 None = 0;
+
+		HLAPI HLName() = default;
+		HLAPI HLName(const char *str);
+		HLAPI HLName(const char *str, uint32 length);
+		HLAPI HLName(const HLString &str);
+		HLAPI HLName(const HLNameLiteral &literal);
+
+		/// <summary>
+		/// Returns the name of an existing table entry, the id has to be returned by GetID before.
+		/// </summary>
+		HLAPI static HLName FromID(uint32 id);
+
+		/// <summary>
+		/// Looks up a string without adding it to the table.
+		/// </summary>
+		/// <returns>Returns an empty name, if the string has never been interned.</returns>
+		HLAPI static HLName Find(const char *str, uint32 length);
+
+		/// <summary>
+		/// Returns the amount of strings in the table, including the empty name.
+		/// </summary>
+		HLAPI static uint32 GetNameCount();
+
+		HLAPI uint32 GetID() const { return m_ID; }
+		HLAPI bool IsNone() const { return m_ID == None; }
+
+		/// <summary>
+		/// Returns the hash of the string, that has been computed when the string was interned.
+		/// </summary>
+		HLAPI uint64 GetHash() const;
+
+		HLAPI const HLString &GetString() const;
+		HLAPI const char *C_Str() const { return GetString().C_Str(); }
+		HLAPI uint32 Length() const { return GetString().Length(); }
+
+		HLAPI operator const HLString&() const { return GetString(); }
+		HLAPI const char *operator*() const { return C_Str(); }
+
+		HLAPI bool operator==(const HLName &other) const { return m_ID == other.m_ID; }
+		HLAPI bool operator!=(const HLName &other) const { return m_ID != other.m_ID; }
+
+		/// <summary>
+		/// Orders names by their id and not alphabetically, the order only stays the same during one run.
+		/// </summary>
+		HLAPI bool operator<(const HLName &other) const { return m_ID < other.m_ID; }
+
+		HLAPI friend std::ostream &operator<<(std::ostream &stream, const HLName &name)
+		{
+			return stream << name.GetString();
+		}
+
+	private:
+
+		explicit HLName(uint32 id)
+			: m_ID(id)
+		{
+		}
+
+		uint32 m_ID = None;
+	};
+}
+
+namespace std
+{
+	template<>
+	struct hash<highlo::HLName>
+	{
+		std::size_t operator()(const highlo::HLName &name) const
+		{
+			return hash<uint32>()(name.GetID());
+		}
+	};
+}
+
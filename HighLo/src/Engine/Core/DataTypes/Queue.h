@@ -2,73 +2,265 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Relocate trivially relocatable elements with memcpy
+//     - 1.2 (2026-10-19) Replaced the linked list with a growing ring buffer
 //     - 1.1 (2022-03-24) removed comments
 //     - 1.0 (2021-09-14) initial release
 //
 
 #pragma once
 
-#include "List.h"
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Log.h"
+#include "Relocatable.h"
+
+#include <iostream>
+#include <new>
+#include <utility>
 
 namespace highlo
 {
+	/// <summary>
+	/// FIFO queue, that stores the elements in one ring buffer. The capacity is always a power of two and doubles when the buffer is full,
+	/// so Enqueue and Dequeue do not allocate except for the amortized growth.
+	/// </summary>
 	template<typename T>
 	class HLQueue
 	{
-	private:
-		List<T> m_List;
-
 	public:
 
 		HLAPI HLQueue() {}
-		HLAPI ~HLQueue() {}
+
+		HLAPI explicit HLQueue(uint32 capacity)
+		{
+			Reserve(capacity);
+		}
+
+		HLAPI HLQueue(const HLQueue &other)
+		{
+			Reserve(other.m_Count);
+			for (uint32 i = 0; i < other.m_Count; ++i)
+				new (&m_Data[i]) T(other.At(i));
+
+			m_Count = other.m_Count;
+		}
+
+		HLAPI HLQueue(HLQueue &&other) noexcept
+			: m_Data(other.m_Data), m_Capacity(other.m_Capacity), m_Head(other.m_Head), m_Count(other.m_Count)
+		{
+			other.m_Data = nullptr;
+			other.m_Capacity = 0;
+			other.m_Head = 0;
+			other.m_Count = 0;
+		}
+
+		HLAPI ~HLQueue()
+		{
+			Clear();
+			::operator delete(m_Data);
+		}
+
+		HLAPI HLQueue &operator=(const HLQueue &other)
+		{
+			if (this != &other)
+			{
+				HLQueue copy(other);
+				*this = std::move(copy);
+			}
+
+			return *this;
+		}
+
+		HLAPI HLQueue &operator=(HLQueue &&other) noexcept
+		{
+			if (this != &other)
+			{
+				Clear();
+				::operator delete(m_Data);
+
+				m_Data = other.m_Data;
+				m_Capacity = other.m_Capacity;
+				m_Head = other.m_Head;
+				m_Count = other.m_Count;
+
+				other.m_Data = nullptr;
+				other.m_Capacity = 0;
+				other.m_Head = 0;
+				other.m_Count = 0;
+			}
+
+			return *this;
+		}
 
 		HLAPI void Enqueue(const T &value)
 		{
-			m_List.Append(value);
+			Emplace(value);
 		}
 
-		HLAPI void Dequeue()
+		HLAPI void Enqueue(T &&value)
 		{
-			m_List.RemoveFirst();
+			Emplace(std::move(value));
 		}
 
-		HLAPI T Front()
+		template<typename... Args>
+		HLAPI T &Emplace(Args&&... args)
+		{
+			if (m_Count == m_Capacity)
 			{
-			return m_List.GetFirst();
+				// The arguments could reference an element of the queue, so the value is created before the buffer moves
+				T value(std::forward<Args>(args)...);
+				Grow(m_Count + 1);
+				return *new (&m_Data[m_Count++]) T(std::move(value));
 			}
 
-		HLAPI bool IsEmpty()
+			T *slot = new (&m_Data[(m_Head + m_Count) & (m_Capacity - 1)]) T(std::forward<Args>(args)...);
+			++m_Count;
+			return *slot;
+		}
+
+		HLAPI void Dequeue()
+		{
+			HL_ASSERT(m_Count > 0, "Queue was empty!");
+
+			m_Data[m_Head].~T();
+			m_Head = (m_Head + 1) & (m_Capacity - 1);
+			--m_Count;
+		}
+
+		/// <summary>
+		/// Moves the first element into value and removes it from the queue.
+		/// </summary>
+		/// <returns>Returns false, if the queue was empty.</returns>
+		HLAPI bool TryDequeue(T &value)
 		{
-			return m_List.IsEmpty();
+			if (m_Count == 0)
+				return false;
+
+			value = std::move(m_Data[m_Head]);
+			Dequeue();
+			return true;
 		}
 
-		HLAPI uint32 Size()
+		HLAPI T &Front()
 		{
-			return m_List.Size();
+			HL_ASSERT(m_Count > 0, "Queue was empty!");
+			return m_Data[m_Head];
 		}
 
+		HLAPI const T &Front() const
+		{
+			HL_ASSERT(m_Count > 0, "Queue was empty!");
+			return m_Data[m_Head];
+		}
+
+		HLAPI T &Back()
+		{
+			HL_ASSERT(m_Count > 0, "Queue was empty!");
+			return At(m_Count - 1);
+		}
+
+		HLAPI const T &Back() const
+		{
+			HL_ASSERT(m_Count > 0, "Queue was empty!");
+			return At(m_Count - 1);
+		}
+
+		/// <summary>
+		/// Returns the element at the given position, counted from the front of the queue.
+		/// </summary>
+		HLAPI T &At(uint32 index)
+		{
+			HL_ASSERT(index < m_Count, "Index out of bounds!");
+			return m_Data[(m_Head + index) & (m_Capacity - 1)];
+		}
+
+		HLAPI const T &At(uint32 index) const
+		{
+			HL_ASSERT(index < m_Count, "Index out of bounds!");
+			return m_Data[(m_Head + index) & (m_Capacity - 1)];
+		}
+
+		HLAPI bool IsEmpty() const
+		{
+			return m_Count == 0;
+		}
+
+		HLAPI uint32 Size() const
+		{
+			return m_Count;
+		}
+
+		HLAPI uint32 GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		HLAPI void Reserve(uint32 capacity)
+		{
+			if (capacity > m_Capacity)
+				Grow(capacity);
+		}
+
+		/// <summary>
+		/// Destroys all elements, but keeps the buffer for later use.
+		/// </summary>
 		HLAPI void Clear()
 		{
-			m_List.Clear();
+			for (uint32 i = 0; i < m_Count; ++i)
+				At(i).~T();
+
+			m_Head = 0;
+			m_Count = 0;
 		}
 
 		HLAPI void Print()
 		{
-			m_List.Print();
+			if (m_Count == 0)
+			{
+				HL_CORE_WARN("Queue was empty!");
+				return;
+			}
+
+			for (uint32 i = 0; i < m_Count; ++i)
+				std::cout << At(i) << std::endl;
 		}
-		
+
 		HLAPI friend std::ostream &operator<<(std::ostream &stream, HLQueue<T> &queue)
 		{
 			while (!queue.IsEmpty())
 			{
-				T content = queue.Front();
+				stream << queue.Front() << ", ";
 				queue.Dequeue();
-				stream << content << ", ";
 			}
 
 			return stream << "\n";
 		}
+
+	private:
+
+		void Grow(uint32 minCapacity)
+		{
+			uint32 capacity = m_Capacity ? m_Capacity : 8;
+			while (capacity < minCapacity)
+				capacity *= 2;
+
+			T *data = static_cast<T*>(::operator new(sizeof(T) * capacity));
+
+			// The elements are unwrapped, so the front of the queue starts at the beginning of the new buffer
+			const uint32 firstPart = HL_MIN(m_Count, m_Capacity - m_Head);
+			utils::RelocateElements(m_Data + m_Head, firstPart, data);
+			utils::RelocateElements(m_Data, m_Count - firstPart, data + firstPart);
+
+			::operator delete(m_Data);
+			m_Data = data;
+			m_Capacity = capacity;
+			m_Head = 0;
+		}
+
+		T *m_Data = nullptr;
+		uint32 m_Capacity = 0;
+		uint32 m_Head = 0;
+		uint32 m_Count = 0;
 	};
 }
 
@@ -0,0 +1,58 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// <summary>
+/// Marks a type as trivially relocatable: moving an object to another address and not destroying the old object
+/// is the same as copying its bytes. That is true for every type that does not store pointers into itself.
+/// Has to be used in the global namespace.
+/// </summary>
+#define HL_DECLARE_TRIVIALLY_RELOCATABLE(type) namespace highlo { template<> struct IsTriviallyRelocatable<type> : std::true_type {}; }
+
+namespace highlo
+{
+	/// <summary>
+	/// Containers relocate elements of these types with memcpy instead of moving and destroying them one by one.
+	/// </summary>
+	template<typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+	template<typename T>
+	inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
+
+	namespace utils
+	{
+		/// <summary>
+		/// Moves count elements into uninitialized memory and ends the lifetime of the source elements. The ranges must not overlap.
+		/// </summary>
+		template<typename T>
+		inline void RelocateElements(T *src, uint32 count, T *dst)
+		{
+			if constexpr (IsTriviallyRelocatableV<T>)
+			{
+				if (count)
+					memcpy((void*)dst, (const void*)src, sizeof(T) * count);
+			}
+			else
+			{
+				for (uint32 i = 0; i < count; ++i)
+				{
+					new (&dst[i]) T(std::move(src[i]));
+					src[i].~T();
+				}
+			}
+		}
+	}
+}
+
@@ -3,61 +3,20 @@
 #include "HighLoPch.h"
 #include "Sorting.h"
 
-#include "Engine/Threading/LocalThread.h"
-#include "Engine/Core/Allocator.h"
+#include "Engine/Threading/ThreadPool.h"
 
 namespace highlo
 {
-	static LocalThread<SortingStack> s_SortingStacks;
-
-	SortingStack::SortingStack()
-	{
-	}
-
-	SortingStack::~SortingStack()
-	{
-		Allocator::Free(m_Data);
-	}
-
-	SortingStack &SortingStack::Get()
-	{
-		return s_SortingStacks.Get();
-	}
-
-	void SortingStack::SetCapacity(int32 capacity)
+	void Sorting::RunParallel(uint32 count, const std::function<void(uint32 begin, uint32 end)> &job)
 	{
-		HL_ASSERT(capacity >= 0);
-		if (m_Capacity == capacity)
-			return;
-
-		int32 *newData = nullptr;
-		if (capacity > 0)
-			newData = (int32*)malloc(capacity * sizeof(int32));
-
-		const int32 newCount = m_Count < capacity ? m_Count : capacity;
-		if (m_Data)
-		{
-			if (newData && newCount)
-				memcpy(newData, m_Data, newCount * sizeof(int32));
-
-			delete[] m_Data;
-		}
-
-		m_Data = newData;
-		m_Capacity = capacity;
-		m_Count = newCount;
+		// One index per batch, every index is already a large chunk of work
+		ThreadPool::Get().ParallelFor(count, 1, job);
 	}
 
-	void SortingStack::EnsureCapacity(int32 minCapacity)
+	uint32 Sorting::GetParallelWorkerCount()
 	{
-		if (m_Capacity >= minCapacity)
-			return;
-
-		int32 newCapacity = m_Capacity == 0 ? 64 : m_Capacity * 2;
-		if (newCapacity < minCapacity)
-			newCapacity = minCapacity;
-
-		SetCapacity(newCapacity);
+		// The calling thread works on the batches as well
+		return ThreadPool::Get().GetThreadCount() + 1;
 	}
 }
 
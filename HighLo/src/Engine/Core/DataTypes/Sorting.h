@@ -2,43 +2,69 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Replaced the stack based QuickSort with IntroSort and added InsertionSort, HeapSort, MergeSort, RadixSort and ParallelSort
 //     - 1.0 (2021-10-22) initial release
 //
 
 #pragma once
 
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
 namespace highlo
 {
-	class SortingStack
+	namespace utils
 	{
-	public:
+		// Below this size the partitions are sorted by InsertionSort, which is faster for a few elements
+		static constexpr int32 SortingInsertionThreshold = 16;
 
-		int32 m_Count = 0;
-		int32 m_Capacity = 0;
-		int32 *m_Data = nullptr;
+		// Chunks of ParallelSort should be large enough to outweigh the scheduling of the jobs
+		static constexpr int32 ParallelSortMinChunkSize = 8192;
 
-		HLAPI SortingStack();
-		HLAPI ~SortingStack();
+		/// <summary>
+		/// Converts a key into an unsigned integer with the same order, so that RadixSort can compare the bytes of the keys.
+		/// The result has the size of the key, so small keys only need one or two passes.
+		/// </summary>
+		inline uint8 ToRadixKey(uint8 key) { return key; }
+		inline uint16 ToRadixKey(uint16 key) { return key; }
+		inline uint32 ToRadixKey(uint32 key) { return key; }
+		inline uint64 ToRadixKey(uint64 key) { return key; }
+		inline uint8 ToRadixKey(int8 key) { return (uint8)key ^ 0x80u; }
+		inline uint16 ToRadixKey(int16 key) { return (uint16)key ^ 0x8000u; }
+		inline uint32 ToRadixKey(int32 key) { return (uint32)key ^ 0x80000000u; }
+		inline uint64 ToRadixKey(int64 key) { return (uint64)key ^ 0x8000000000000000ull; }
 
-		HLAPI static SortingStack &Get();
+		// char is a distinct type from int8 and uint8, its sign depends on the platform
+		inline uint8 ToRadixKey(char key) { return std::is_signed_v<char> ? (uint8)key ^ 0x80u : (uint8)key; }
 
-		HLAPI void SetCapacity(int32 capacity);
-		HLAPI void EnsureCapacity(int32 minCapacity);
+		inline uint32 ToRadixKey(float key)
+		{
+			uint32 bits;
+			memcpy(&bits, &key, sizeof(bits));
 
-		HLAPI void Push(const int32 item)
+			// Negative values are flipped completely, so that larger magnitudes come first, positive values only get the sign bit
+			return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+		}
+
+		inline uint64 ToRadixKey(double key)
 		{
-			EnsureCapacity(m_Count + 1);
-			m_Data[++m_Count] = item;
+			uint64 bits;
+			memcpy(&bits, &key, sizeof(bits));
+			return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
 		}
 
-		HLAPI int32 Pop()
+		inline int32 SortingDepthLimit(int32 count)
 		{
-			HL_ASSERT(m_Count > 0);
-			const int32 item = m_Data[m_Count - 1];
-			--m_Count;
-			return item;
+			int32 depth = 0;
+			for (; count > 1; count >>= 1)
+				++depth;
+
+			return 2 * depth;
 		}
-	};
+	}
 
 	class Sorting
 	{
@@ -47,110 +73,354 @@ namespace highlo
 		template<typename T>
 		static void Swap(T &a, T &b) noexcept
 		{
-			T tmp = a;
-			a = b;
-			b = tmp;
+			T tmp = std::move(a);
+			a = std::move(b);
+			b = std::move(tmp);
 		}
 
+		/// <summary>
+		/// Sorts the data with IntroSort, kept for compatibility.
+		/// </summary>
 		template<typename T>
 		HLAPI static void QuickSort(T *data, int32 count)
+		{
+			IntroSort(data, count);
+		}
+
+		/// <summary>
+		/// Sorts the data with IntroSort, kept for compatibility.
+		/// </summary>
+		template<typename T>
+		HLAPI static void QuickSort(T *data, int32 count, bool (*compare)(const T &a, const T &b))
+		{
+			IntroSort(data, count, compare);
+		}
+
+		/// <summary>
+		/// Unstable O(n log n) sort: QuickSort with a median-of-three pivot, that falls back to HeapSort if the recursion gets too deep
+		/// and uses InsertionSort for small partitions. Sorted and reverse sorted input are not a worst case.
+		/// </summary>
+		template<typename T, typename Compare = std::less<T>>
+		HLAPI static void IntroSort(T *data, int32 count, Compare compare = Compare())
 		{
 			if (count < 2)
 				return;
 
-			// Idea: we use a stack to maintain the left and right border of the array
+			IntroSortLoop(data, 0, count, utils::SortingDepthLimit(count), compare);
+		}
+
+		/// <summary>
+		/// Stable O(n^2) sort, that is the fastest choice for a few or nearly sorted elements.
+		/// </summary>
+		template<typename T, typename Compare = std::less<T>>
+		HLAPI static void InsertionSort(T *data, int32 count, Compare compare = Compare())
+		{
+			for (int32 i = 1; i < count; ++i)
+			{
+				if (!compare(data[i], data[i - 1]))
+					continue;
+
+				T value = std::move(data[i]);
+				int32 j = i;
+				for (; j > 0 && compare(value, data[j - 1]); --j)
+					data[j] = std::move(data[j - 1]);
+
+				data[j] = std::move(value);
+			}
+		}
+
+		/// <summary>
+		/// Unstable O(n log n) sort without additional memory.
+		/// </summary>
+		template<typename T, typename Compare = std::less<T>>
+		HLAPI static void HeapSort(T *data, int32 count, Compare compare = Compare())
+		{
+			for (int32 i = count / 2 - 1; i >= 0; --i)
+				SiftDown(data, i, count, compare);
+
+			for (int32 end = count - 1; end > 0; --end)
+			{
+				Swap(data[0], data[end]);
+				SiftDown(data, 0, end, compare);
+			}
+		}
+
+		/// <summary>
+		/// Stable O(n log n) sort, equal elements keep their order. It needs a copy of the data as temporary storage.
+		/// </summary>
+		template<typename T, typename Compare = std::less<T>>
+		HLAPI static void MergeSort(T *data, int32 count, Compare compare = Compare())
+		{
+			if (count <= utils::SortingInsertionThreshold)
+			{
+				InsertionSort(data, count, compare);
+				return;
+			}
+
+			// Bottom up: sort small runs in place, then merge runs of doubling width between the data and the buffer
+			const int32 runSize = utils::SortingInsertionThreshold * 2;
+			for (int32 begin = 0; begin < count; begin += runSize)
+				InsertionSort(data + begin, HL_MIN(runSize, count - begin), compare);
 
-			auto &stack = SortingStack::Get();
-			stack.Push(0); // left border
-			stack.Push(count - 1); // right border
+			std::vector<T> buffer(data, data + count);
+			T *src = data;
+			T *dst = buffer.data();
 
-			while (stack.m_Count)
+			for (int32 width = runSize; width < count; width *= 2)
 			{
-				// Get the current left and right borders
-				int32 right = stack.Pop();
-				const int32 left = stack.Pop();
-
-				// Partition the data
-				T *x = &data[right];
-				int32 i = left - 1;
-				for (int32 j = left; j <= right - 1; ++j)
+				for (int32 begin = 0; begin < count; begin += 2 * width)
 				{
-					if (data[j] < *x)
-					{
-						++i;
-						Swap(data[i], data[j]);
-					}
+					int32 middle = HL_MIN(begin + width, count);
+					int32 end = HL_MIN(begin + 2 * width, count);
+					MergeRuns(src, begin, middle, end, dst, compare);
 				}
 
-				Swap(data[i + 1], data[right]);
-				const int32 pivot = i + 1;
+				std::swap(src, dst);
+			}
+
+			if (src != data)
+				std::move(src, src + count, data);
+		}
+
+		/// <summary>
+		/// Stable O(n) sort for integer and floating point values, the values are sorted byte by byte from the least significant byte.
+		/// Passes are skipped if all keys share the same byte, so small keys in large integer types are cheap.
+		/// </summary>
+		template<typename T>
+		HLAPI static void RadixSort(T *data, int32 count)
+		{
+			static_assert(std::is_arithmetic_v<T>, "RadixSort without a key function only supports integer and floating point values!");
+			RadixSort(data, count, [](const T &value) { return value; });
+		}
+
+		/// <summary>
+		/// Stable O(n) sort by an integer or floating point key, for example the sort keys of draw calls or the depth of objects.
+		/// </summary>
+		/// <param name="getKey">Returns the key of an element, it is called once per element and pass.</param>
+		template<typename T, typename KeyFunc>
+		HLAPI static void RadixSort(T *data, int32 count, KeyFunc getKey)
+		{
+			using KeyType = decltype(utils::ToRadixKey(getKey(*data)));
+			constexpr uint32 passCount = sizeof(KeyType);
 
-				// If we have elements on the left side of the pivot, push them as the new borders
-				if (pivot - 1 > left)
+			if (count <= utils::SortingInsertionThreshold)
+			{
+				InsertionSort(data, count, [&getKey](const T &a, const T &b) { return utils::ToRadixKey(getKey(a)) < utils::ToRadixKey(getKey(b)); });
+				return;
+			}
+
+			// The histograms of all passes are counted with one read of the data
+			uint32 histograms[passCount][256] = {};
+			for (int32 i = 0; i < count; ++i)
+			{
+				KeyType key = utils::ToRadixKey(getKey(data[i]));
+				for (uint32 pass = 0; pass < passCount; ++pass)
+					++histograms[pass][(key >> (pass * 8)) & 0xFF];
+			}
+
+			std::vector<T> buffer(data, data + count);
+			T *src = data;
+			T *dst = buffer.data();
+
+			for (uint32 pass = 0; pass < passCount; ++pass)
+			{
+				uint32 *histogram = histograms[pass];
+				KeyType firstKey = utils::ToRadixKey(getKey(src[0]));
+				if (histogram[(firstKey >> (pass * 8)) & 0xFF] == (uint32)count)
+					continue;
+
+				uint32 offsets[256];
+				uint32 offset = 0;
+				for (uint32 bucket = 0; bucket < 256; ++bucket)
 				{
-					stack.Push(left);
-					stack.Push(pivot - 1);
+					offsets[bucket] = offset;
+					offset += histogram[bucket];
 				}
 
-				// If we have elements of the right side of the pivot, push them as the new borders
-				if (pivot + 1 < right)
+				for (int32 i = 0; i < count; ++i)
 				{
-					stack.Push(pivot + 1);
-					stack.Push(right);
+					KeyType key = utils::ToRadixKey(getKey(src[i]));
+					dst[offsets[(key >> (pass * 8)) & 0xFF]++] = std::move(src[i]);
 				}
+
+				std::swap(src, dst);
 			}
+
+			if (src != data)
+				std::move(src, src + count, data);
 		}
 
-		template<typename T>
-		HLAPI static void QuickSort(T *data, int32 count, bool (*compare)(const T &a, const T &b))
+		/// <summary>
+		/// Unstable sort, that sorts chunks of the data with IntroSort on the ThreadPool and merges them in parallel rounds.
+		/// Small inputs are sorted on the calling thread. The compare function is called from several threads at once.
+		/// </summary>
+		template<typename T, typename Compare = std::less<T>>
+		HLAPI static void ParallelSort(T *data, int32 count, Compare compare = Compare())
 		{
-			if (count < 2)
+			// A power of two, so that every merge round halves the amount of chunks
+			uint32 chunkCount = 1;
+			uint32 workerCount = GetParallelWorkerCount();
+			while (chunkCount < workerCount && (int64)count / (chunkCount * 2) >= utils::ParallelSortMinChunkSize)
+				chunkCount *= 2;
+
+			if (chunkCount == 1)
+			{
+				IntroSort(data, count, compare);
 				return;
+			}
+
+			std::vector<int32> bounds(chunkCount + 1);
+			for (uint32 i = 0; i <= chunkCount; ++i)
+				bounds[i] = (int32)((int64)count * i / chunkCount);
 
-			// Idea: we use a stack to maintain the left and right border of the array
+			RunParallel(chunkCount, [&](uint32 begin, uint32 end)
+			{
+				for (uint32 chunk = begin; chunk < end; ++chunk)
+					IntroSort(data + bounds[chunk], bounds[chunk + 1] - bounds[chunk], compare);
+			});
 
-			auto &stack = SortingStack::Get();
-			stack.Push(0); // left border
-			stack.Push(count - 1); // right border
+			std::vector<T> buffer(data, data + count);
+			T *src = data;
+			T *dst = buffer.data();
 
-			while (stack.m_Count)
+			for (uint32 width = 1; width < chunkCount; width *= 2)
 			{
-				// Get the current left and right borders
-				int32 right = stack.Pop();
-				const int32 left = stack.Pop();
-
-				// Partition the data
-				T *x = &data[right];
-				int32 i = left - 1;
-				for (int32 j = left; j <= right - 1; ++j)
+				RunParallel(chunkCount / (2 * width), [&](uint32 begin, uint32 end)
 				{
-					if (compare(data[j], *x))
+					for (uint32 merge = begin; merge < end; ++merge)
 					{
-						++i;
-						Swap(data[i], data[j]);
+						uint32 firstChunk = merge * 2 * width;
+						MergeRuns(src, bounds[firstChunk], bounds[firstChunk + width], bounds[firstChunk + 2 * width], dst, compare);
 					}
-				}
+				});
+
+				std::swap(src, dst);
+			}
+
+			if (src != data)
+				std::move(src, src + count, data);
+		}
+
+	private:
 
-				Swap(data[i + 1], data[right]);
-				const int32 pivot = i + 1;
+		/// <summary>
+		/// Runs the job for every index in [0, count) on the ThreadPool and returns once all jobs are done.
+		/// The calling thread runs the indices, that no worker has picked up, so the sorts can be called from inside a pool job.
+		/// </summary>
+		HLAPI static void RunParallel(uint32 count, const std::function<void(uint32 begin, uint32 end)> &job);
+		HLAPI static uint32 GetParallelWorkerCount();
 
-				// If we have elements on the left side of the pivot, push them as the new borders
-				if (pivot - 1 > left)
+		template<typename T, typename Compare>
+		static void IntroSortLoop(T *data, int32 left, int32 right, int32 depthLimit, Compare &compare)
+		{
+			while (right - left > utils::SortingInsertionThreshold)
+			{
+				if (depthLimit == 0)
 				{
-					stack.Push(left);
-					stack.Push(pivot - 1);
+					HeapSort(data + left, right - left, compare);
+					return;
 				}
 
-				// If we have elements of the right side of the pivot, push them as the new borders
-				if (pivot + 1 < right)
+				--depthLimit;
+				int32 pivot = Partition(data, left, right, compare);
+
+				// Recursing into the smaller side limits the stack depth to O(log n)
+				if (pivot - left < right - pivot)
 				{
-					stack.Push(pivot + 1);
-					stack.Push(right);
+					IntroSortLoop(data, left, pivot, depthLimit, compare);
+					left = pivot + 1;
+				}
+				else
+				{
+					IntroSortLoop(data, pivot + 1, right, depthLimit, compare);
+					right = pivot;
 				}
 			}
+
+			InsertionSort(data + left, right - left, compare);
 		}
 
+		/// <summary>
+		/// Partitions [left, right) around the median of the first, middle and last element and returns the final position of the pivot.
+		/// </summary>
+		template<typename T, typename Compare>
+		static int32 Partition(T *data, int32 left, int32 right, Compare &compare)
+		{
+			int32 middle = left + (right - left) / 2;
+			int32 last = right - 1;
+
+			if (compare(data[middle], data[left]))
+				Swap(data[middle], data[left]);
+			if (compare(data[last], data[left]))
+				Swap(data[last], data[left]);
+			if (compare(data[last], data[middle]))
+				Swap(data[last], data[middle]);
+
+			// The first and last element are already on the correct side and stop both scans without bounds checks
+			Swap(data[middle], data[last - 1]);
+			const T &pivot = data[last - 1];
+
+			int32 i = left;
+			int32 j = last - 1;
+			for (;;)
+			{
+				while (compare(data[++i], pivot)) {}
+				while (compare(pivot, data[--j])) {}
+
+				if (i >= j)
+					break;
+
+				Swap(data[i], data[j]);
+			}
+
+			Swap(data[i], data[last - 1]);
+			return i;
+		}
+
+		template<typename T, typename Compare>
+		static void SiftDown(T *data, int32 root, int32 count, Compare &compare)
+		{
+			for (;;)
+			{
+				int32 child = 2 * root + 1;
+				if (child >= count)
+					return;
 
+				if (child + 1 < count && compare(data[child], data[child + 1]))
+					++child;
+
+				if (!compare(data[root], data[child]))
+					return;
+
+				Swap(data[root], data[child]);
+				root = child;
+			}
+		}
+
+		/// <summary>
+		/// Merges the sorted runs [begin, middle) and [middle, end) of src into the same range of dst, equal elements are taken from the left run first.
+		/// </summary>
+		template<typename T, typename Compare>
+		static void MergeRuns(T *src, int32 begin, int32 middle, int32 end, T *dst, Compare &compare)
+		{
+			int32 left = begin;
+			int32 right = middle;
+			int32 out = begin;
+
+			while (left < middle && right < end)
+			{
+				if (compare(src[right], src[left]))
+					dst[out++] = std::move(src[right++]);
+				else
+					dst[out++] = std::move(src[left++]);
+			}
+
+			while (left < middle)
+				dst[out++] = std::move(src[left++]);
+
+			while (right < end)
+				dst[out++] = std::move(src[right++]);
+		}
 	};
 }
 
@@ -2,73 +2,227 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Relocate trivially relocatable elements with memcpy
+//     - 1.2 (2026-10-19) Replaced the linked list with a growing array
 //     - 1.1 (2022-03-24) removed comments
 //     - 1.0 (2021-09-14) initial release
 //
 
 #pragma once
 
-#include "List.h"
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Log.h"
+#include "Relocatable.h"
+
+#include <iostream>
+#include <new>
+#include <utility>
 
 namespace highlo
 {
+	/// <summary>
+	/// LIFO stack, that stores the elements in one array. The capacity doubles when the array is full,
+	/// so Push and Pop do not allocate except for the amortized growth.
+	/// </summary>
 	template<typename T>
 	struct HLStack
 	{
-	private:
-		List<T> m_List;
-
 	public:
 
 		HLAPI HLStack() {}
-		HLAPI ~HLStack() {}
 
-		HLAPI void Push(T value)
+		HLAPI explicit HLStack(uint32 capacity)
+		{
+			Reserve(capacity);
+		}
+
+		HLAPI HLStack(const HLStack &other)
+		{
+			Reserve(other.m_Count);
+			for (uint32 i = 0; i < other.m_Count; ++i)
+				new (&m_Data[i]) T(other.m_Data[i]);
+
+			m_Count = other.m_Count;
+		}
+
+		HLAPI HLStack(HLStack &&other) noexcept
+			: m_Data(other.m_Data), m_Capacity(other.m_Capacity), m_Count(other.m_Count)
+		{
+			other.m_Data = nullptr;
+			other.m_Capacity = 0;
+			other.m_Count = 0;
+		}
+
+		HLAPI ~HLStack()
+		{
+			Clear();
+			::operator delete(m_Data);
+		}
+
+		HLAPI HLStack &operator=(const HLStack &other)
+		{
+			if (this != &other)
+			{
+				HLStack copy(other);
+				*this = std::move(copy);
+			}
+
+			return *this;
+		}
+
+		HLAPI HLStack &operator=(HLStack &&other) noexcept
+		{
+			if (this != &other)
+			{
+				Clear();
+				::operator delete(m_Data);
+
+				m_Data = other.m_Data;
+				m_Capacity = other.m_Capacity;
+				m_Count = other.m_Count;
+
+				other.m_Data = nullptr;
+				other.m_Capacity = 0;
+				other.m_Count = 0;
+			}
+
+			return *this;
+		}
+
+		HLAPI void Push(const T &value)
+		{
+			Emplace(value);
+		}
+
+		HLAPI void Push(T &&value)
 		{
-			m_List.Append(value);
+			Emplace(std::move(value));
+		}
+
+		template<typename... Args>
+		HLAPI T &Emplace(Args&&... args)
+		{
+			if (m_Count == m_Capacity)
+			{
+				// The arguments could reference an element of the stack, so the value is created before the array moves
+				T value(std::forward<Args>(args)...);
+				Grow(m_Count + 1);
+				return *new (&m_Data[m_Count++]) T(std::move(value));
+			}
+
+			T *slot = new (&m_Data[m_Count]) T(std::forward<Args>(args)...);
+			++m_Count;
+			return *slot;
 		}
 
 		HLAPI void Pop()
 		{
-			m_List.RemoveLast();
+			HL_ASSERT(m_Count > 0, "Stack was empty!");
+
+			--m_Count;
+			m_Data[m_Count].~T();
+		}
+
+		/// <summary>
+		/// Moves the top element into value and removes it from the stack.
+		/// </summary>
+		/// <returns>Returns false, if the stack was empty.</returns>
+		HLAPI bool TryPop(T &value)
+		{
+			if (m_Count == 0)
+				return false;
+
+			value = std::move(m_Data[m_Count - 1]);
+			Pop();
+			return true;
+		}
+
+		HLAPI T &Top()
+		{
+			HL_ASSERT(m_Count > 0, "Stack was empty!");
+			return m_Data[m_Count - 1];
+		}
+
+		HLAPI const T &Top() const
+		{
+			HL_ASSERT(m_Count > 0, "Stack was empty!");
+			return m_Data[m_Count - 1];
+		}
+
+		HLAPI bool IsEmpty() const
+		{
+			return m_Count == 0;
 		}
 
-		HLAPI T Top()
+		HLAPI uint32 Size() const
 		{
-			return m_List.GetLast();
+			return m_Count;
 		}
 
-		HLAPI bool IsEmpty()
+		HLAPI uint32 GetCapacity() const
 		{
-			return m_List.IsEmpty();
+			return m_Capacity;
 		}
 
-		HLAPI uint32 Size()
+		HLAPI void Reserve(uint32 capacity)
 		{
-			return m_List.Size();
+			if (capacity > m_Capacity)
+				Grow(capacity);
 		}
 
+		/// <summary>
+		/// Destroys all elements, but keeps the array for later use.
+		/// </summary>
 		HLAPI void Clear()
 		{
-			m_List.Clear();
+			for (uint32 i = 0; i < m_Count; ++i)
+				m_Data[i].~T();
+
+			m_Count = 0;
 		}
 
 		HLAPI void Print()
 		{
-			m_List.Print();
+			if (m_Count == 0)
+			{
+				HL_CORE_WARN("Stack was empty!");
+				return;
+			}
+
+			for (uint32 i = 0; i < m_Count; ++i)
+				std::cout << m_Data[i] << std::endl;
 		}
 
 		HLAPI friend std::ostream &operator<<(std::ostream &stream, HLStack<T> &stack)
 		{
 			while (!stack.IsEmpty())
 			{
-				T content = stack.Top();
+				stream << stack.Top() << ", ";
 				stack.Pop();
-				stream << content << ", ";
 			}
 
 			return stream << "\n";
 		}
+
+	private:
+
+		void Grow(uint32 minCapacity)
+		{
+			uint32 capacity = m_Capacity ? m_Capacity * 2 : 8;
+			if (capacity < minCapacity)
+				capacity = minCapacity;
+
+			T *data = static_cast<T*>(::operator new(sizeof(T) * capacity));
+			utils::RelocateElements(m_Data, m_Count, data);
+
+			::operator delete(m_Data);
+			m_Data = data;
+			m_Capacity = capacity;
+		}
+
+		T *m_Data = nullptr;
+		uint32 m_Capacity = 0;
+		uint32 m_Count = 0;
 	};
 }
 
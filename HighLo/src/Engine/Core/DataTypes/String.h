@@ -2,6 +2,9 @@
 
 //
 // version history:
+//     - 1.6 (2026-10-19) Vectorized searches, case conversions and counting of byte strings, added IndexOfAny, SplitLines and UTF-8 transcoding
+//     - 1.5 (2026-10-19) Declared HLStrings as trivially relocatable
+//     - 1.4 (2026-10-19) Moved short strings into the object, added geometric capacity growth and allocation free comparisons and searches
 //     - 1.3 (2021-10-02) Added begin and end functions to be able to use ForEach loops over Strings
 //     - 1.2 (2021-10-01) fixed Bug in Contains methods - the engine does not longer crash if the checked string is empty
 //     - 1.1 (2021-09-29) Refactored hole class to support multibyte Strings as well
@@ -12,12 +15,14 @@
 
 #include "Engine/Core/Core.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/DataTypes/Relocatable.h"
+#include "Engine/Core/DataTypes/StringAlgorithms.h"
 #include "Engine/Core/Defines/BaseTypes.h"
 
 #include <iostream>
 
 #define HASH_LENGTH 20
-#define HL_STRING_MAX_STRING_SIZE 16
+#define HL_STRING_MAX_STRING_SIZE 24 // The bytes of inline storage, including the null terminator
 
 namespace highlo
 {
@@ -29,6 +34,10 @@ namespace highlo
 	using HLString32 = HLStringBase<char32_t>;
 	using HLStringWide = HLStringBase<wchar_t>;
 
+	// Short strings live inside of the object, but no pointer refers to them, so the bytes of a string can be moved
+	template<typename T>
+	struct IsTriviallyRelocatable<HLStringBase<T>> : std::true_type {};
+
 	namespace utils
 	{
 		static char *CopySubStr(const char *str, uint32 pos, uint32 size)
@@ -47,14 +56,103 @@ namespace highlo
 			return memcmp((const void*)str1, (const void*)str2, (size_t)size);
 		}
 
-		static int32 Compare(const char *str1, uint32 pos1, uint32 size1, const char *str2, uint32 pos2, uint32 size2, uint32 *outLhsSize, uint32 *outRhsSize)
+		template<typename StringType>
+		static uint32 StringLength(const StringType *str)
+		{
+			if constexpr (std::is_same_v<StringType, char>)
+			{
+				return (uint32)strlen(str);
+			}
+			else if constexpr (std::is_same_v<StringType, wchar_t>)
+			{
+				return (uint32)wcslen(str);
+			}
+			else
+			{
+				uint32 length = 0;
+				while (str[length] != 0)
+					++length;
+
+				return length;
+			}
+		}
+
+		/// <summary>
+		/// Compares the characters of both strings, the strings are not copied.
+		/// </summary>
+		template<typename StringType>
+		static int32 CompareChars(const StringType *str1, const StringType *str2, uint32 size)
+		{
+			if constexpr (sizeof(StringType) == 1)
+			{
+				return memcmp((const void*)str1, (const void*)str2, (size_t)size);
+			}
+			else
+			{
+				for (uint32 i = 0; i < size; ++i)
+				{
+					if (str1[i] != str2[i])
+						return str1[i] < str2[i] ? -1 : 1;
+				}
+
+				return 0;
+			}
+		}
+
+		template<typename StringType>
+		static uint32 FindChar(const StringType *str, uint32 size, StringType letter, uint32 offset)
+		{
+			if (offset >= size)
+				return static_cast<uint32>(-1);
+
+			if constexpr (sizeof(StringType) == 1)
+			{
+				const void *found = memchr(str + offset, letter, size - offset);
+				return found ? (uint32)((const StringType*)found - str) : static_cast<uint32>(-1);
+			}
+			else
+			{
+				for (uint32 i = offset; i < size; ++i)
+				{
+					if (str[i] == letter)
+						return i;
+				}
+
+				return static_cast<uint32>(-1);
+			}
+		}
+
+		/// <summary>
+		/// Searches the first occurrence of find in str, starting at the offset. Empty strings are never found.
+		/// </summary>
+		template<typename StringType>
+		static uint32 FindString(const StringType *str, uint32 size, const StringType *find, uint32 findSize, uint32 offset)
 		{
-			char *str1Copied = utils::CopySubStr(str1, pos1, size1);
-			char *str2Copied = utils::CopySubStr(str2, pos2, size2);
+			if constexpr (std::is_same_v<StringType, char>)
+				return FindSubstring(str, size, find, findSize, offset);
+
+			if (findSize == 0 || offset >= size || findSize > size - offset)
+				return static_cast<uint32>(-1);
+
+			// Only the positions with a matching first character are compared completely
+			uint32 lastStart = size - findSize;
+			for (uint32 i = FindChar(str, lastStart + 1, find[0], offset); i != static_cast<uint32>(-1); i = FindChar(str, lastStart + 1, find[0], i + 1))
+			{
+				if (CompareChars(str + i + 1, find + 1, findSize - 1) == 0)
+					return i;
+			}
+
+			return static_cast<uint32>(-1);
+		}
 
-			uint32 str1Len = (uint32)strlen(str1Copied);
-			uint32 str2Len = (uint32)strlen(str2Copied);
-			int32 result = utils::Compare(str1Copied, str2Copied, str1Len <= str2Len ? str1Len : str2Len);
+		/// <summary>
+		/// Compares the character ranges [pos1, size1) and [pos2, size2), the ranges end early at a null terminator.
+		/// </summary>
+		static int32 Compare(const char *str1, uint32 pos1, uint32 size1, const char *str2, uint32 pos2, uint32 size2, uint32 *outLhsSize, uint32 *outRhsSize)
+		{
+			uint32 str1Len = pos1 < size1 ? (uint32)strnlen(str1 + pos1, size1 - pos1) : 0;
+			uint32 str2Len = pos2 < size2 ? (uint32)strnlen(str2 + pos2, size2 - pos2) : 0;
+			int32 result = utils::CompareChars(str1 + pos1, str2 + pos2, str1Len <= str2Len ? str1Len : str2Len);
 
 			if (outLhsSize)
 				*outLhsSize = str1Len;
@@ -62,9 +160,6 @@ namespace highlo
 			if (outRhsSize)
 				*outRhsSize = str2Len;
 
-			delete[] str1Copied;
-			delete[] str2Copied;
-
 			return result;
 		}
 
@@ -88,75 +183,78 @@ namespace highlo
 		}
 	}
 
+	/// <summary>
+	/// Strings that fit into the object are stored inline, longer strings use a single heap buffer,
+	/// that grows geometrically, so that appending characters one by one does not allocate every time.
+	/// </summary>
 	template<typename StringType>
 	class HLStringBase
 	{
 	public:
 
-		static const uint32 NPOS = static_cast<uint32>(-1);
+		static constexpr uint32 NPOS = static_cast<uint32>(-1);
+
+		/// <summary>
+		/// The number of characters, that are stored without a heap allocation.
+		/// </summary>
+		static constexpr uint32 ShortStringCapacity = HL_STRING_MAX_STRING_SIZE / sizeof(StringType) - 1;
 
 		HLAPI HLStringBase()
 		{
-			Assign("", 0);
+			m_Short[0] = 0;
 		}
 
 		HLAPI HLStringBase(const StringType *data)
 		{
-			uint32 size = utils::GetSizeOfUnknownStringType<StringType>(data);
-			Assign(data, size);
+			m_Short[0] = 0;
+			Assign(data, utils::StringLength<StringType>(data));
 		}
 
 		HLAPI HLStringBase(const StringType *data, uint32 length)
 		{
+			m_Short[0] = 0;
 			Assign(data, length);
 		}
 
 		HLAPI HLStringBase(const std::string &str)
 		{
+			m_Short[0] = 0;
 			Assign(str.c_str(), (uint32)str.size());
 		}
 
 		HLAPI HLStringBase(const std::wstring &wideStr)
 		{
+			m_Short[0] = 0;
 			Assign(wideStr.c_str(), (uint32)wideStr.size());
 		}
 
 		HLAPI HLStringBase(const HLStringBase &other)
 		{
+			m_Short[0] = 0;
 			Assign(other.C_Str(), other.Length());
 		}
 
 		HLAPI HLStringBase(const HLStringBase &other, uint32 length)
 		{
+			m_Short[0] = 0;
 			Assign(other.C_Str(), length);
 		}
 
 		HLAPI HLStringBase(const HLStringBase &other, uint32 start, uint32 end)
 		{
+			m_Short[0] = 0;
 			Assign(other.C_Str(), end, start);
 		}
 
 		HLAPI HLStringBase(HLStringBase &&other) noexcept
 		{
-			m_DataPointer = other.m_DataPointer;
-			m_UsingShortStr = other.m_UsingShortStr;
-
-			// TODO: potentially leaking memory here
-			other.m_DataPointer = nullptr;
-			other.m_UsingShortStr = true; // Restore default
+			TakeStorage(other);
 		}
 
 		HLAPI ~HLStringBase()
 		{
 			if (!m_UsingShortStr)
-			{
-				LongStringData *data = (LongStringData*)m_DataPointer;
-				delete[] data->Data;
-				data->Data = nullptr;
-			}
-
-			delete m_DataPointer;
-			m_DataPointer = nullptr;
+				delete[] m_Long.Data;
 		}
 
 		HLAPI HLStringBase &Assign(const StringType *str, uint32 size, uint32 startOffset = 0)
@@ -164,101 +262,30 @@ namespace highlo
 			HL_ASSERT(str);
 			HL_ASSERT(startOffset <= size);
 
-			uint32 new_size = size - startOffset;
-
-			if (new_size < HL_STRING_MAX_STRING_SIZE)
-			{
-				ShortStringData *data = new ShortStringData();
-				data->Size = new_size;
-				data->Data[data->Size] = '\0';
-
-				if (str)
-				{
-					memcpy_s(data->Data, HL_STRING_MAX_STRING_SIZE, str + startOffset, new_size);
-				}
-
-				// Delete old data, if exists
-				if (!m_UsingShortStr && m_DataPointer)
-				{
-					LongStringData *old_data = (LongStringData*)m_DataPointer;
-					if (old_data->Data)
-					{
-						delete[] old_data->Data;
-						old_data->Data = nullptr;
-					}
-				}
-				else if (m_UsingShortStr && m_DataPointer)
-				{
-					delete m_DataPointer;
-				}
-
-				m_DataPointer = data;
-				m_UsingShortStr = true;
-
-				return *this;
-			}
-
-			LongStringData *data = new LongStringData();
-			data->Data = new StringType[new_size + 1];
-			data->Size = new_size;
-			data->Data[data->Size] = '\0';
-
-			if (str)
-			{
-				memcpy_s(data->Data, data->Size, str + startOffset, new_size);
-			}
+			uint32 newSize = size - startOffset;
+			const StringType *source = str + startOffset;
 
-			// Delete old data, if exists
-			if (!m_UsingShortStr && m_DataPointer)
+			if (newSize > GetCapacity())
 			{
-				LongStringData *old_data = (LongStringData*)m_DataPointer;
-				if (old_data)
-				{
-					delete[] old_data;
-					old_data = nullptr;
-				}
+				// The source can be a part of this string, so the old buffer is released after the copy
+				StringType *newData = new StringType[newSize + 1];
+				memcpy(newData, source, newSize * sizeof(StringType));
+				SetLongStorage(newData, newSize);
 			}
-			else if (m_UsingShortStr && m_DataPointer)
+			else
 			{
-				delete m_DataPointer;
+				memmove(SelectStringSource(), source, newSize * sizeof(StringType));
 			}
 
-			m_DataPointer = data;
-			m_UsingShortStr = false;
-
+			m_Size = newSize;
+			SelectStringSource()[m_Size] = 0;
 			return *this;
 		}
 
 		HLAPI HLStringBase &operator=(const HLStringBase &other)
 		{
 			if (this != &other)
-			{
-				if (other.m_UsingShortStr)
-				{
-					ShortStringData *data = (ShortStringData*)other.m_DataPointer;
-					ShortStringData *new_data = new ShortStringData();
-					new_data->Size = data->Size;
-					
-					new_data->Data[new_data->Size] = '\0';
-					memcpy(new_data->Data, data->Data, data->Size);
-
-					m_UsingShortStr = true;
-					m_DataPointer = new_data;
-				}
-				else
-				{
-					LongStringData *data = (LongStringData*)other.m_DataPointer;
-					LongStringData *new_data = new LongStringData();
-					new_data->Size = data->Size;
-					new_data->Data = new StringType[data->Size + 1];
-					
-					new_data->Data[new_data->Size] = '\0';
-					memcpy(new_data->Data, data->Data, data->Size);
-					
-					m_UsingShortStr = false;
-					m_DataPointer = new_data;
-				}
-			}
+				Assign(other.C_Str(), other.Length());
 
 			return *this;
 		}
@@ -267,11 +294,10 @@ namespace highlo
 		{
 			if (this != &other)
 			{
-				m_DataPointer = other.m_DataPointer;
-				m_UsingShortStr = other.m_UsingShortStr;
+				if (!m_UsingShortStr)
+					delete[] m_Long.Data;
 
-				other.m_DataPointer = nullptr;
-				other.m_UsingShortStr = true;
+				TakeStorage(other);
 			}
 
 			return *this;
@@ -279,75 +305,84 @@ namespace highlo
 
 		HLAPI StringType *begin()
 		{
-			return SelectStringSource()[0];
+			return SelectStringSource();
 		}
 
 		HLAPI StringType *end()
 		{
-			return SelectStringSource()[SelectStringSize()];
+			return SelectStringSource() + m_Size;
 		}
 
-		HLAPI void Clear()
+		HLAPI const StringType *begin() const
 		{
-			if (!m_UsingShortStr)
-			{
-				LongStringData *data = (LongStringData*)m_DataPointer;
-				delete[] data->Data;
-				data->Data = nullptr;
-			}
+			return SelectStringSource();
+		}
+
+		HLAPI const StringType *end() const
+		{
+			return SelectStringSource() + m_Size;
+		}
 
-			delete m_DataPointer;
-			m_DataPointer = nullptr;
-			m_UsingShortStr = true; // Restore default
+		/// <summary>
+		/// Empties the string, the capacity is kept.
+		/// </summary>
+		HLAPI void Clear()
+		{
+			m_Size = 0;
+			SelectStringSource()[0] = 0;
 		}
 
+		/// <summary>
+		/// Changes the length of the string, the existing characters are kept and new characters are zero.
+		/// </summary>
 		HLAPI void Resize(uint32 size)
 		{
-			if (!m_DataPointer)
-				return;
+			if (size > GetCapacity())
+				Reallocate(size);
 
-			Clear();
-			if (size < HL_STRING_MAX_STRING_SIZE)
-			{
-				ShortStringData *data = new ShortStringData;
-				data->Size = size;
-				data->Data[data->Size] = '\0';
-				m_DataPointer = data;
+			if (size > m_Size)
+				memset(SelectStringSource() + m_Size, 0, (size - m_Size) * sizeof(StringType));
 
-				m_UsingShortStr = true;
-				return;
-			}
+			m_Size = size;
+			SelectStringSource()[m_Size] = 0;
+		}
 
-			LongStringData *data = new LongStringData;
-			data->Data = new StringType[size];
-			data->Size = size;
-			data->Data[data->Size] = '\0';
-			m_DataPointer = data;
-			m_UsingShortStr = false;
+		/// <summary>
+		/// Makes sure, that the string can grow to the given length without another allocation.
+		/// </summary>
+		HLAPI void Reserve(uint32 capacity)
+		{
+			if (capacity > GetCapacity())
+				Reallocate(capacity);
+		}
+
+		HLAPI uint32 GetCapacity() const
+		{
+			return m_UsingShortStr ? ShortStringCapacity : m_Long.Capacity;
 		}
 
 		HLAPI uint32 Length() const
 		{
-			return SelectStringSize();
+			return m_Size;
 		}
 
 		HLAPI wchar_t *W_Str()
 		{
-			wchar_t *result = new wchar_t[SelectStringSize() + 1];
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			wchar_t *result = new wchar_t[m_Size + 1];
+			for (uint32 i = 0; i < m_Size; ++i)
 				result[i] = SelectStringSource()[i];
 
-			result[SelectStringSize()] = L'\0';
+			result[m_Size] = L'\0';
 			return result;
 		}
 
 		HLAPI const wchar_t *W_Str() const
 		{
-			wchar_t *result = new wchar_t[SelectStringSize() + 1];
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			wchar_t *result = new wchar_t[m_Size + 1];
+			for (uint32 i = 0; i < m_Size; ++i)
 				result[i] = SelectStringSource()[i];
 
-			result[SelectStringSize()] = L'\0';
+			result[m_Size] = L'\0';
 			return result;
 		}
 
@@ -363,7 +398,7 @@ namespace highlo
 
 		HLAPI StringType At(uint32 index)
 		{
-			if (index < SelectStringSize())
+			if (index < m_Size)
 				return SelectStringSource()[index];
 
 			return (char)NPOS;
@@ -371,7 +406,7 @@ namespace highlo
 
 		HLAPI const StringType At(uint32 index) const
 		{
-			if (index < SelectStringSize())
+			if (index < m_Size)
 				return SelectStringSource()[index];
 
 			return (char)NPOS;
@@ -379,200 +414,95 @@ namespace highlo
 
 		HLAPI HLStringBase &Append(const StringType letter)
 		{
-			StringType *new_data = new StringType[SelectStringSize() + 2]; // +1 for a character and another +1 for the null terminator
-			new_data[SelectStringSize()] = letter;
-			new_data[SelectStringSize() + 1] = '\0';
-
-			if (SelectStringSource())
-			{
-				memcpy(new_data, SelectStringSource(), SelectStringSize());
-			}
+			if (m_Size + 1 > GetCapacity())
+				Grow(m_Size + 1);
 
-			return Assign(new_data, SelectStringSize());
+			StringType *data = SelectStringSource();
+			data[m_Size] = letter;
+			data[++m_Size] = 0;
+			return *this;
 		}
 
-		HLAPI HLStringBase &Append(const HLStringBase &other)
+		HLAPI HLStringBase &Append(const StringType *str, uint32 length)
 		{
-			uint32 new_size = SelectStringSize() + other.SelectStringSize();
-			StringType *new_data = new StringType[new_size + 1]; // +1 for the null terminator
-			new_data[new_size] = '\0';
-
-			if (SelectStringSource())
+			if (m_Size + length > GetCapacity())
 			{
-				memcpy(new_data, SelectStringSource(), SelectStringSize()); // copy existing string
+				// The appended characters can be a part of this string and have to survive the reallocation
+				const StringType *data = SelectStringSource();
+				bool isInside = str >= data && str <= data + m_Size;
+				uint64 offset = str - data;
+
+				Grow(m_Size + length);
+
+				if (isInside)
+					str = SelectStringSource() + offset;
 			}
 
-			memcpy((StringType*)(new_data + SelectStringSize()), other.SelectStringSource(), other.SelectStringSize()); // copy appended string
+			StringType *data = SelectStringSource();
+			memmove(data + m_Size, str, length * sizeof(StringType));
+			m_Size += length;
+			data[m_Size] = 0;
+			return *this;
+		}
 
-			return Assign(new_data, new_size);
+		HLAPI HLStringBase &Append(const HLStringBase &other)
+		{
+			return Append(other.SelectStringSource(), other.m_Size);
 		}
 
 		HLAPI HLStringBase &Remove(const StringType letter)
 		{
-			if (SelectStringSource() && Contains(letter))
-			{
-				uint32 i = 0;
-				uint32 j = 0;
-				uint32 start_pos = IndexOf(letter);
-				uint32 new_size = SelectStringSize() - 1;
-				StringType *new_data = new StringType[new_size + 1];
-				new_data[new_size] = '\0';
-
-				if (start_pos > 0)
-				{
-					memcpy(new_data, SelectStringSource(), start_pos);
-					j = start_pos;
-				}
-
-				for (i = start_pos + 1; i < SelectStringSize(); ++i)
-				{
-					new_data[j] = SelectStringSource()[i];
-					++j;
-				}
-
-				return Assign(new_data, new_size);
-			}
+			uint32 pos = IndexOf(letter);
+			if (pos != NPOS)
+				Erase(pos, 1);
 
 			return *this;
 		}
 
 		HLAPI HLStringBase &Remove(const HLStringBase &other)
 		{
-			if (SelectStringSource() && Contains(other))
-			{
-				uint32 i = 0;
-				uint32 j = 0;
-				uint32 start_pos = IndexOf(other);
-				uint32 new_size = SelectStringSize() - other.Length();
-				StringType *new_data = new StringType[new_size + 1];
-				new_data[new_size] = '\0';
-
-				// copy part before the part to remove
-				if (start_pos > 0)
-				{
-					memcpy(new_data, SelectStringSource(), start_pos);
-					j = start_pos;
-				}
-
-				// copy part after the part to remove
-				for (i = start_pos + other.Length(); i < SelectStringSize(); ++i)
-				{
-					new_data[j] = SelectStringSource()[i];
-					++j;
-				}
-
-				return Assign(new_data, new_size);
-			}
+			uint32 pos = IndexOf(other);
+			if (pos != NPOS)
+				Erase(pos, other.m_Size);
 
 			return *this;
 		}
 
 		HLAPI uint32 FirstIndexOf(const StringType letter, uint32 offset = 0) const
 		{
-			for (uint32 i = offset; i < SelectStringSize(); ++i)
-			{
-				if (SelectStringSource()[i] == letter)
-					return i;
-			}
-
-			return NPOS;
+			return utils::FindChar(SelectStringSource(), m_Size, letter, offset);
 		}
 
 		HLAPI uint32 FirstIndexOf(const HLStringBase &other, uint32 offset = 0) const
 		{
-			uint32 i = offset;
-			uint32 j = 0;
-
-			while (SelectStringSource()[i] != '\0')
-			{
-				if (SelectStringSource()[i] == other[j])
-				{
-					while (SelectStringSource()[i] == other[j] && other[j] != '\0')
-					{
-						++j;
-						++i;
-					}
-
-					if (other[j] == '\0')
-						return i - j;
-
-					j = 0;
-				}
-
-				++i;
-			}
-
-			return NPOS;
+			return utils::FindString(SelectStringSource(), m_Size, other.SelectStringSource(), other.m_Size, offset);
 		}
 
 		HLAPI uint32 IndexOf(const StringType letter, uint32 offset = 0) const
 		{
-			for (uint32 i = offset; i < SelectStringSize(); ++i)
-			{
-				if (SelectStringSource()[i] == letter)
-					return i;
-			}
-
-			return NPOS;
+			return utils::FindChar(SelectStringSource(), m_Size, letter, offset);
 		}
 
 		HLAPI uint32 IndexOf(const HLStringBase &other, uint32 offset = 0) const
 		{
-			uint32 i = offset;
-			uint32 j = 0;
-
-			while (SelectStringSource()[i] != '\0')
-			{
-				if (SelectStringSource()[i] == other[j])
-				{
-					while (SelectStringSource()[i] == other[j] && other[j] != '\0')
-					{
-						++j;
-						++i;
-					}
-
-					if (other[j] == '\0')
-						return i - j;
-
-					j = 0;
-				}
-
-				++i;
-			}
-
-			return NPOS;
+			return utils::FindString(SelectStringSource(), m_Size, other.SelectStringSource(), other.m_Size, offset);
 		}
 
+		/// <summary>
+		/// Searches the last occurrence before the offset, an offset of 0 searches the whole string.
+		/// </summary>
 		HLAPI uint32 LastIndexOf(const StringType letter, uint32 offset = 0) const
 		{
-			HL_ASSERT(offset >= 0 && offset < SelectStringSize(), "Offset is out of bounds!");
+			HL_ASSERT(offset >= 0 && offset < m_Size, "Offset is out of bounds!");
 
 			if (offset == 0)
-				offset = SelectStringSize();
+				offset = m_Size;
 
-			// Count how many times the letter exists
-			uint32 letterCount = 0;
-			for (uint32 i = 0; i < offset; ++i)
+			const StringType *data = SelectStringSource();
+			for (uint32 i = offset; i > 0; --i)
 			{
-				if (SelectStringSource()[i] == letter)
-					++letterCount;
-			}
-
-			// If No Letter exists, return
-			if (0 == letterCount)
-				return NPOS;
-
-			// Get the last letter index
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
-			{
-				if (letterCount == 1 && SelectStringSource()[i] == letter)
-					return i;
-
-				if (SelectStringSource()[i] == letter && letterCount > 0)
-				{
-					--letterCount;
-					continue;
-				}
+				if (data[i - 1] == letter)
+					return i - 1;
 			}
 
 			return NPOS;
@@ -580,31 +510,17 @@ namespace highlo
 
 		HLAPI uint32 LastIndexOf(const HLStringBase &other, uint32 offset = 0) const
 		{
-			if (Contains(other))
-			{
-				uint32 i = SelectStringSize() - other.Length();
-				uint32 j = 0;
-
-				while (SelectStringSource()[i] != '\0')
-				{
-					if (SelectStringSource()[i] == other[j])
-					{
-						while (SelectStringSource()[i] == other[j] && other[j] != '\0')
-						{
-							++j;
-							++i;
-						}
+			if (offset == 0 || offset > m_Size)
+				offset = m_Size;
 
-						if (other[j] == '\0')
-							return i - j;
-
-						j = 0;
-					}
-
-					++i;
-				}
+			if (other.m_Size == 0 || other.m_Size > offset)
+				return NPOS;
 
-				return i;
+			const StringType *data = SelectStringSource();
+			for (uint32 i = offset - other.m_Size + 1; i > 0; --i)
+			{
+				if (utils::CompareChars(data + i - 1, other.SelectStringSource(), other.m_Size) == 0)
+					return i - 1;
 			}
 
 			return NPOS;
@@ -612,133 +528,140 @@ namespace highlo
 
 		HLAPI uint32 FirstIndexNotOf(const StringType letter, uint32 offset = 0) const
 		{
-			const int32 len = static_cast<int32>(strspn(SelectStringSource() + offset, &letter));
-			if (len + offset >= SelectStringSize())
-				return NPOS;
+			const StringType *data = SelectStringSource();
+			for (uint32 i = offset; i < m_Size; ++i)
+			{
+				if (data[i] != letter)
+					return i;
+			}
 
-			return len + offset;
+			return NPOS;
 		}
 
 		HLAPI uint32 FirstIndexNotOf(const HLStringBase &other, uint32 offset = 0) const
 		{
-			const int32 len = static_cast<int32>(strspn(SelectStringSource() + offset, *other));
-			if (len + offset >= SelectStringSize())
-				return NPOS;
+			const StringType *data = SelectStringSource();
+			for (uint32 i = offset; i < m_Size; ++i)
+			{
+				if (utils::FindChar(other.SelectStringSource(), other.m_Size, data[i], 0) == NPOS)
+					return i;
+			}
 
-			return len + offset;
+			return NPOS;
 		}
 
-		HLAPI std::vector<HLStringBase> Split(StringType delimiter)
+		/// <summary>
+		/// Searches the first character, that is one of the given characters.
+		/// </summary>
+		HLAPI uint32 IndexOfAny(const HLStringBase &chars, uint32 offset = 0) const
 		{
-			uint32 wordCount = 1;
-			uint32 charIdx = 0;
-			uint32 wordBeginIdx = 0;
-			HLStringBase word;
+			const StringType *data = SelectStringSource();
+			if constexpr (std::is_same_v<StringType, char>)
+				return utils::FindAnyChar(data, m_Size, chars.SelectStringSource(), chars.m_Size, offset);
 
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			for (uint32 i = offset; i < m_Size; ++i)
 			{
-				if (SelectStringSource()[i] == delimiter)
-					++wordCount;
+				if (utils::FindChar(chars.SelectStringSource(), chars.m_Size, data[i], 0) != NPOS)
+					return i;
 			}
 
-			std::vector<HLStringBase> result(wordCount);
-			for (uint32 i = 0; i < wordCount; ++i)
-			{
-				wordBeginIdx = charIdx;
-				while (SelectStringSource()[charIdx] != delimiter && SelectStringSource()[charIdx] != '\0')
-					++charIdx;
+			return NPOS;
+		}
+
+		HLAPI std::vector<HLStringBase> Split(StringType delimiter)
+		{
+			std::vector<HLStringBase> result;
+			result.reserve(CountOf(delimiter) + 1);
 
-				word = Substr(wordBeginIdx, charIdx);
-				result[i] = word;
-				++charIdx;
+			const StringType *data = SelectStringSource();
+			uint32 wordBeginIdx = 0;
+			for (uint32 i = IndexOf(delimiter); i != NPOS; i = IndexOf(delimiter, i + 1))
+			{
+				result.emplace_back(data + wordBeginIdx, i - wordBeginIdx);
+				wordBeginIdx = i + 1;
 			}
 
+			result.emplace_back(data + wordBeginIdx, m_Size - wordBeginIdx);
 			return result;
 		}
 
-		HLAPI HLStringBase *Split(StringType delimiter, uint32 *outWordCount)
+		/// <summary>
+		/// Splits the string at \n, \r\n and \r, the line breaks are not part of the lines.
+		/// </summary>
+		HLAPI std::vector<HLStringBase> SplitLines() const
 		{
-			uint32 wordCount = 1;
-			uint32 charIdx = 0;
-			uint32 wordBeginIdx = 0;
-			HLStringBase word;
+			const StringType lineBreaks[] = { '\r', '\n' };
+			const HLStringBase lineBreakChars(lineBreaks, 2);
+
+			std::vector<HLStringBase> result;
+			const StringType *data = SelectStringSource();
+			uint32 lineBeginIdx = 0;
 
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			for (uint32 i = IndexOfAny(lineBreakChars); i != NPOS; i = IndexOfAny(lineBreakChars, lineBeginIdx))
 			{
-				if (SelectStringSource()[i] == delimiter)
-					++wordCount;
+				result.emplace_back(data + lineBeginIdx, i - lineBeginIdx);
+				lineBeginIdx = (data[i] == '\r' && i + 1 < m_Size && data[i + 1] == '\n') ? i + 2 : i + 1;
 			}
 
-			HLStringBase *result = new HLStringBase[wordCount];
-			for (uint32 i = 0; i < wordCount; ++i)
-			{
-				wordBeginIdx = charIdx;
-				while (SelectStringSource()[charIdx] != delimiter && SelectStringSource()[charIdx] != '\0')
-					++charIdx;
+			if (lineBeginIdx < m_Size)
+				result.emplace_back(data + lineBeginIdx, m_Size - lineBeginIdx);
 
-				word = Substr(wordBeginIdx, charIdx);
-				result[i] = word;
-				++charIdx;
-			}
+			return result;
+		}
+
+		HLAPI HLStringBase *Split(StringType delimiter, uint32 *outWordCount)
+		{
+			std::vector<HLStringBase> words = Split(delimiter);
+
+			HLStringBase *result = new HLStringBase[words.size()];
+			for (uint32 i = 0; i < (uint32)words.size(); ++i)
+				result[i] = std::move(words[i]);
 
 			if (outWordCount)
-				*outWordCount = wordCount;
+				*outWordCount = (uint32)words.size();
 
 			return result;
 		}
 
 		HLAPI HLStringBase &Replace(const HLStringBase &find, const HLStringBase &replaceValue, uint32 occurencesToReplace = 0)
 		{
-			// @See https://stackoverflow.com/a/32413923/12873837
+			if (find.IsEmpty())
+				return *this;
 
-			StringType *newString = new StringType[SelectStringSize() + 512 + 1]; // +1 for null termination character
-			StringType *strValuePointer = &newString[0];
-			const StringType *tmp = SelectStringSource();
-			uint32 findLength = find.Length();
-			uint32 replaceLength = replaceValue.Length();
-			uint32 occurencesReplaced = 0;
+			HLStringBase result;
+			result.Reserve(m_Size);
 
-			newString[SelectStringSize() + 512] = '\0';
+			const StringType *data = SelectStringSource();
+			uint32 occurencesReplaced = 0;
+			uint32 pos = 0;
 
-			while (true)
+			while (!occurencesToReplace || occurencesReplaced < occurencesToReplace)
 			{
-				const StringType *p = strstr(tmp, find);
-				//	std::cout << "Found substring: " << p << std::endl;
-
-				// walked past last occurrence of needle; copy remaining part
-				if (!p)
-				{
-					//	std::cout << "last part: " << tmp << std::endl;
-					strcpy(strValuePointer, tmp);
+				uint32 found = utils::FindString(data, m_Size, find.SelectStringSource(), find.m_Size, pos);
+				if (found == NPOS)
 					break;
-				}
-
-				// copy part before needle
-				memcpy(strValuePointer, tmp, p - tmp);
-				strValuePointer += p - tmp;
-
-				// copy replacement string
-				memcpy(strValuePointer, replaceValue, replaceLength);
-				strValuePointer += replaceLength;
 
-				// adjust pointers, move on
-				tmp = p + findLength;
+				// copy part before needle and the replacement string
+				result.Append(data + pos, found - pos);
+				result.Append(replaceValue);
 
+				pos = found + find.m_Size;
 				++occurencesReplaced;
-				if (occurencesToReplace && occurencesReplaced >= occurencesToReplace)
-					break;
 			}
 
-			return Assign(newString, utils::GetSizeOfUnknownStringType<StringType>(newString));
+			// copy remaining part
+			result.Append(data + pos, m_Size - pos);
+			return *this = std::move(result);
 		}
 
 		HLAPI HLStringBase &Reverse()
 		{
-			for (uint32 i = 0; i < SelectStringSize() / 2; i++)
+			StringType *data = SelectStringSource();
+			for (uint32 i = 0; i < m_Size / 2; i++)
 			{
-				StringType temp = SelectStringSource()[i];
-				SelectStringSource()[i] = SelectStringSource()[SelectStringSize() - i - 1];
-				SelectStringSource()[SelectStringSize() - i - 1] = temp;
+				StringType temp = data[i];
+				data[i] = data[m_Size - i - 1];
+				data[m_Size - i - 1] = temp;
 			}
 
 			return *this;
@@ -747,9 +670,9 @@ namespace highlo
 		HLAPI HLStringBase &Substr(uint32 beginIndex, uint32 endIndex = 0)
 		{
 			if (endIndex == 0)
-				endIndex = SelectStringSize();
+				endIndex = m_Size;
 
-			if ((endIndex - beginIndex) > SelectStringSize())
+			if (endIndex > m_Size || beginIndex > endIndex)
 				return *this;
 
 			return Assign(SelectStringSource(), endIndex, beginIndex);
@@ -757,10 +680,17 @@ namespace highlo
 
 		HLAPI HLStringBase &ToLowerCase()
 		{
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			StringType *data = SelectStringSource();
+			if constexpr (std::is_same_v<StringType, char>)
+			{
+				utils::ToLowerCaseASCII(data, m_Size);
+				return *this;
+			}
+
+			for (uint32 i = 0; i < m_Size; ++i)
 			{
-				if (SelectStringSource()[i] >= 'A' && SelectStringSource()[i] <= 'Z')
-					SelectStringSource()[i] = SelectStringSource()[i] - ('A' - 'a');
+				if (data[i] >= 'A' && data[i] <= 'Z')
+					data[i] = data[i] - ('A' - 'a');
 			}
 
 			return *this;
@@ -768,10 +698,17 @@ namespace highlo
 
 		HLAPI HLStringBase &ToUpperCase()
 		{
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			StringType *data = SelectStringSource();
+			if constexpr (std::is_same_v<StringType, char>)
+			{
+				utils::ToUpperCaseASCII(data, m_Size);
+				return *this;
+			}
+
+			for (uint32 i = 0; i < m_Size; ++i)
 			{
-				if (SelectStringSource()[i] >= 'a' && SelectStringSource()[i] <= 'z')
-					SelectStringSource()[i] = SelectStringSource()[i] + ('A' - 'a');
+				if (data[i] >= 'a' && data[i] <= 'z')
+					data[i] = data[i] + ('A' - 'a');
 			}
 
 			return *this;
@@ -779,10 +716,14 @@ namespace highlo
 
 		HLAPI uint32 CountOf(StringType letter) const
 		{
+			const StringType *data = SelectStringSource();
+			if constexpr (std::is_same_v<StringType, char>)
+				return utils::CountChar(data, m_Size, letter);
+
 			uint32 count = 0;
-			for (uint32 i = 0; i < SelectStringSize(); ++i)
+			for (uint32 i = 0; i < m_Size; ++i)
 			{
-				if (SelectStringSource()[i] == letter)
+				if (data[i] == letter)
 					++count;
 			}
 
@@ -795,7 +736,7 @@ namespace highlo
 			uint64 hash = 2166136261UL;
 			unsigned char *p = (unsigned char*)SelectStringSource();
 
-			for (i = 0; i < SelectStringSize(); i++)
+			for (i = 0; i < m_Size; i++)
 				hash = (hash ^ p[i]) * 16777619;
 
 			return hash;
@@ -803,79 +744,27 @@ namespace highlo
 
 		HLAPI bool IsEmpty() const
 		{
-			return SelectStringSize() == 0;
+			return m_Size == 0;
 		}
 
 		HLAPI bool Contains(const StringType letter, uint32 offset = 0) const
 		{
-			bool hasLetter = false;
-
-			if (IsEmpty())
-				return false;
-
-			for (uint32 i = offset; i < SelectStringSize(); ++i)
-			{
-				if (SelectStringSource()[i] == letter)
-				{
-					hasLetter = true;
-					break;
-				}
-			}
-
-			return hasLetter;
+			return IndexOf(letter, offset) != NPOS;
 		}
 
 		HLAPI bool Contains(const HLStringBase &other, uint32 offset = 0) const
 		{
-			uint32 i = offset;
-			uint32 j = 0;
-
-			if (IsEmpty())
-				return false;
-
-			while (SelectStringSource()[i] != '\0')
-			{
-				if (SelectStringSource()[i] == other[j])
-				{
-					while (SelectStringSource()[i] == other[j] && other[j] != '\0')
-					{
-						++j;
-						++i;
-					}
-
-					if (other[j] == '\0')
-						return true;
-
-					j = 0;
-				}
-
-				++i;
-			}
-
-			return false;
+			return IndexOf(other, offset) != NPOS;
 		}
 
 		HLAPI bool StartsWith(const StringType letter) const
 		{
-			if (SelectStringSource()[0] == letter)
-				return true;
-
-			return false;
+			return SelectStringSource()[0] == letter;
 		}
 
 		HLAPI bool StartsWith(const HLStringBase &other) const
 		{
-			uint32 equalCount = 0;
-			for (uint32 i = 0; i < other.SelectStringSize(); ++i)
-			{
-				if (SelectStringSource()[i] == other[i])
-					++equalCount;
-			}
-
-			if (equalCount == other.SelectStringSize())
-				return true;
-
-			return false;
+			return other.m_Size <= m_Size && utils::CompareChars(SelectStringSource(), other.SelectStringSource(), other.m_Size) == 0;
 		}
 
 		HLAPI bool EndsWith(const StringType letter) const
@@ -883,73 +772,28 @@ namespace highlo
 			if (IsEmpty())
 				return false;
 
-			if (SelectStringSource()[SelectStringSize() - 1] == letter)
-				return true;
-
-			return false;
+			return SelectStringSource()[m_Size - 1] == letter;
 		}
 
 		HLAPI bool EndsWith(const HLStringBase &other) const
 		{
-			uint32 equalCount = 0;
-			uint32 start_pos = SelectStringSize() - other.SelectStringSize();
-
-			for (uint32 i = start_pos; i < SelectStringSize(); ++i)
-			{
-				for (uint32 j = 0; j < other.SelectStringSize(); ++j)
-				{
-					if (SelectStringSource()[i] == other[j])
-						++equalCount;
-				}
-			}
-
-			if (equalCount == other.SelectStringSize())
-				return true;
-
-			return false;
+			return other.m_Size <= m_Size && utils::CompareChars(SelectStringSource() + m_Size - other.m_Size, other.SelectStringSource(), other.m_Size) == 0;
 		}
 
 		HLAPI int32 Compare(const HLStringBase &other) const
 		{
-			uint32 lhsSize = Length();
-			uint32 rhsSize = other.Length();
-
-			int32 result = utils::Compare(SelectStringSource(), other.SelectStringSource(), lhsSize <= rhsSize ? lhsSize : rhsSize);
-
-			if (result != 0)
-				return result;
-
-			if (lhsSize < rhsSize)
-				return -1;
-
-			if (lhsSize > rhsSize)
-				return 1;
-
-			return 0;
+			return CompareRange(SelectStringSource(), m_Size, other.SelectStringSource(), other.m_Size);
 		}
 
 		HLAPI int32 Compare(uint32 pos1, uint32 count1, const HLStringBase &other, uint32 pos2 = 0, uint32 count2 = NPOS) const
 		{
-			if (count2 == NPOS)
-				count2 = other.Length();
+			// Both ranges are clamped to their strings and compared in place
+			pos1 = pos1 < m_Size ? pos1 : m_Size;
+			pos2 = pos2 < other.m_Size ? pos2 : other.m_Size;
+			count1 = count1 < m_Size - pos1 ? count1 : m_Size - pos1;
+			count2 = count2 < other.m_Size - pos2 ? count2 : other.m_Size - pos2;
 
-			uint32 lhsSize = pos1 + count1;
-			uint32 rhsSize = pos2 + count2;
-
-			uint32 newLhsSize;
-			uint32 newRhsSize;
-			int32 result = utils::Compare(SelectStringSource(), pos1, lhsSize, other.SelectStringSource(), pos2, rhsSize, &newLhsSize, &newRhsSize);
-
-			if (result != 0)
-				return result;
-
-			if (newLhsSize < newRhsSize)
-				return -1;
-
-			if (newLhsSize > newRhsSize)
-				return 1;
-
-			return 0;
+			return CompareRange(SelectStringSource() + pos1, count1, other.SelectStringSource() + pos2, count2);
 		}
 
 		HLAPI static HLString FromWideString(const wchar_t *str)
@@ -1000,12 +844,12 @@ namespace highlo
 
 		HLAPI bool operator==(const StringType *other) const
 		{
-			return Compare(HLStringBase(other)) == 0;
+			return CompareRange(SelectStringSource(), m_Size, other, utils::StringLength<StringType>(other)) == 0;
 		}
 
 		HLAPI bool operator==(const HLStringBase &other) const
 		{
-			return Compare(other) == 0;
+			return m_Size == other.m_Size && utils::CompareChars(SelectStringSource(), other.SelectStringSource(), m_Size) == 0;
 		}
 
 		HLAPI bool operator!=(const StringType *other) const
@@ -1020,7 +864,7 @@ namespace highlo
 
 		HLAPI bool operator<(const StringType *other) const
 		{
-			return Compare(HLStringBase(other)) < 0;
+			return CompareRange(SelectStringSource(), m_Size, other, utils::StringLength<StringType>(other)) < 0;
 		}
 
 		HLAPI bool operator<(const HLStringBase &other) const
@@ -1030,7 +874,7 @@ namespace highlo
 
 		HLAPI bool operator>(const StringType *other) const
 		{
-			return Compare(HLStringBase(other)) > 0;
+			return CompareRange(SelectStringSource(), m_Size, other, utils::StringLength<StringType>(other)) > 0;
 		}
 
 		HLAPI bool operator>(const HLStringBase &other) const
@@ -1040,7 +884,7 @@ namespace highlo
 
 		HLAPI bool operator<=(const StringType *other) const
 		{
-			return Compare(HLStringBase(other)) <= 0;
+			return CompareRange(SelectStringSource(), m_Size, other, utils::StringLength<StringType>(other)) <= 0;
 		}
 
 		HLAPI bool operator<=(const HLStringBase &other) const
@@ -1050,7 +894,7 @@ namespace highlo
 
 		HLAPI bool operator>=(const StringType *other) const
 		{
-			return Compare(HLStringBase(other)) >= 0;
+			return CompareRange(SelectStringSource(), m_Size, other, utils::StringLength<StringType>(other)) >= 0;
 		}
 
 		HLAPI bool operator>=(const HLStringBase &other) const
@@ -1075,17 +919,17 @@ namespace highlo
 
 		HLAPI friend HLStringBase operator+(HLStringBase str, const HLStringBase &other)
 		{
-			return str.Append(other);
+			return std::move(str.Append(other));
 		}
 
 		HLAPI friend HLStringBase operator+(HLStringBase str, const StringType letter)
 		{
-			return str.Append(letter);
+			return std::move(str.Append(letter));
 		}
 
 		HLAPI friend HLStringBase operator+(HLStringBase str, const StringType *other)
 		{
-			return str.Append(other);
+			return std::move(str.Append(other, utils::StringLength<StringType>(other)));
 		}
 
 		HLAPI HLStringBase &operator-=(const HLStringBase &other)
@@ -1110,19 +954,19 @@ namespace highlo
 
 		HLAPI StringType &operator[](uint32 index)
 		{
-			HL_ASSERT(index <= SelectStringSize());
+			HL_ASSERT(index <= m_Size);
 			return SelectStringSource()[index];
 		}
 
 		HLAPI const StringType &operator[](uint32 index) const
 		{
-			HL_ASSERT(index <= SelectStringSize());
+			HL_ASSERT(index <= m_Size);
 			return SelectStringSource()[index];
 		}
 
 		HLAPI friend std::ostream &operator<<(std::ostream &stream, const HLStringBase &str)
 		{
-			for (uint32 i = 0; i < str.SelectStringSize(); ++i)
+			for (uint32 i = 0; i < str.m_Size; ++i)
 				stream << str.SelectStringSource()[i];
 
 			return stream;
@@ -1169,76 +1013,99 @@ namespace highlo
 
 		HL_FORCE_INLINE StringType *SelectStringSource()
 		{
-			HL_ASSERT(m_DataPointer);
-
-			if (m_UsingShortStr)
-			{
-				return &(((ShortStringData*)m_DataPointer)->Data)[0];
-			}
-			else
-			{
-				return ((LongStringData*)m_DataPointer)->Data;
-			}
+			return m_UsingShortStr ? m_Short : m_Long.Data;
 		}
 
 		HL_FORCE_INLINE const StringType *SelectStringSource() const
 		{
-			HL_ASSERT(m_DataPointer);
+			return m_UsingShortStr ? m_Short : m_Long.Data;
+		}
 
-			if (m_UsingShortStr)
-			{
-				return &(((ShortStringData*)m_DataPointer)->Data)[0];
-			}
-			else
-			{
-				return ((LongStringData*)m_DataPointer)->Data;
-			}
+		HL_FORCE_INLINE uint32 SelectStringSize() const
+		{
+			return m_Size;
 		}
 
-		HL_FORCE_INLINE uint32 SelectStringSize()
+		static int32 CompareRange(const StringType *lhs, uint32 lhsSize, const StringType *rhs, uint32 rhsSize)
 		{
-			if (!m_DataPointer)
-				return 0;
+			int32 result = utils::CompareChars(lhs, rhs, lhsSize <= rhsSize ? lhsSize : rhsSize);
 
-			if (m_UsingShortStr)
-			{
-				return ((ShortStringData*)m_DataPointer)->Size;
-			}
-			else
-			{
-				return ((LongStringData*)m_DataPointer)->Size;
-			}
+			if (result != 0)
+				return result;
+
+			if (lhsSize < rhsSize)
+				return -1;
+
+			if (lhsSize > rhsSize)
+				return 1;
+
+			return 0;
 		}
 
-		HL_FORCE_INLINE uint32 SelectStringSize() const
+		/// <summary>
+		/// Grows the capacity at least by half, so that repeated appends only reallocate a logarithmic number of times.
+		/// </summary>
+		void Grow(uint32 requiredCapacity)
 		{
-			if (!m_DataPointer)
-				return 0;
+			uint32 capacity = GetCapacity();
+			uint32 grownCapacity = capacity + capacity / 2;
+			Reallocate(requiredCapacity > grownCapacity ? requiredCapacity : grownCapacity);
+		}
 
-			if (m_UsingShortStr)
-			{
-				return ((ShortStringData*)m_DataPointer)->Size;
-			}
+		void Reallocate(uint32 capacity)
+		{
+			StringType *newData = new StringType[capacity + 1];
+			memcpy(newData, SelectStringSource(), (m_Size + 1) * sizeof(StringType));
+			SetLongStorage(newData, capacity);
+		}
+
+		void SetLongStorage(StringType *data, uint32 capacity)
+		{
+			if (!m_UsingShortStr)
+				delete[] m_Long.Data;
+
+			m_Long.Data = data;
+			m_Long.Capacity = capacity;
+			m_UsingShortStr = false;
+		}
+
+		void Erase(uint32 pos, uint32 count)
+		{
+			StringType *data = SelectStringSource();
+			memmove(data + pos, data + pos + count, (m_Size - pos - count + 1) * sizeof(StringType));
+			m_Size -= count;
+		}
+
+		void TakeStorage(HLStringBase &other)
+		{
+			m_Size = other.m_Size;
+			m_UsingShortStr = other.m_UsingShortStr;
+
+			if (other.m_UsingShortStr)
+				memcpy(m_Short, other.m_Short, (other.m_Size + 1) * sizeof(StringType));
 			else
-			{
-				return ((LongStringData*)m_DataPointer)->Size;
-			}
+				m_Long = other.m_Long;
+
+			// The other string is left empty
+			other.m_UsingShortStr = true;
+			other.m_Size = 0;
+			other.m_Short[0] = 0;
 		}
 
 		struct LongStringData
 		{
-			StringType *Data = nullptr;
-			uint32 Size = 0;
+			StringType *Data;
+			uint32 Capacity;
 		};
 
-		struct ShortStringData
+		// The inline characters share the memory with the pointer to the heap buffer
+		union
 		{
-			StringType Data[HL_STRING_MAX_STRING_SIZE] = { 0 };
-			uint32 Size = 0;
+			LongStringData m_Long;
+			StringType m_Short[HL_STRING_MAX_STRING_SIZE / sizeof(StringType)];
 		};
 
-		// Either points to LongStringData or to ShortStringData
-		void *m_DataPointer = nullptr;
+		uint32 m_Size = 0;
 		bool m_UsingShortStr = true; // Determines which string version is currently used
 	};
 
@@ -1246,6 +1113,87 @@ namespace highlo
 	{
 	public:
 
+		HLAPI static bool IsValid(const HLString &str)
+		{
+			return utils::IsValidUTF8(*str, str.Length());
+		}
+
+		/// <summary>
+		/// Transcodes UTF-8 to UTF-16, invalid UTF-8 results in an empty string.
+		/// </summary>
+		HLAPI static HLString16 ToUTF16(const HLString &str)
+		{
+			HLString16 result;
+			result.Resize(str.Length());
+
+			uint32 length = utils::UTF8ToUTF16(*str, str.Length(), *result);
+			if (length == HLString16::NPOS)
+			{
+				HL_CORE_ERROR("Could not convert to UTF-16; Invalid UTF-8.");
+				length = 0;
+			}
+
+			result.Resize(length);
+			return result;
+		}
+
+		/// <summary>
+		/// Transcodes UTF-8 to UTF-32, invalid UTF-8 results in an empty string.
+		/// </summary>
+		HLAPI static HLString32 ToUTF32(const HLString &str)
+		{
+			HLString32 result;
+			result.Resize(str.Length());
+
+			uint32 length = utils::UTF8ToUTF32(*str, str.Length(), *result);
+			if (length == HLString32::NPOS)
+			{
+				HL_CORE_ERROR("Could not convert to UTF-32; Invalid UTF-8.");
+				length = 0;
+			}
+
+			result.Resize(length);
+			return result;
+		}
+
+		/// <summary>
+		/// Transcodes UTF-16 to UTF-8, unpaired surrogates result in an empty string.
+		/// </summary>
+		HLAPI static HLString FromUTF16(const HLString16 &str)
+		{
+			HLString result;
+			result.Resize(str.Length() * 3);
+
+			uint32 length = utils::UTF16ToUTF8(*str, str.Length(), *result);
+			if (length == HLString::NPOS)
+			{
+				HL_CORE_ERROR("Could not convert to UTF-8; Invalid UTF-16.");
+				length = 0;
+			}
+
+			result.Resize(length);
+			return result;
+		}
+
+		/// <summary>
+		/// Transcodes UTF-32 to UTF-8, invalid code points result in an empty string.
+		/// </summary>
+		HLAPI static HLString FromUTF32(const HLString32 &str)
+		{
+			HLString result;
+			result.Resize(str.Length() * 4);
+
+			uint32 length = utils::UTF32ToUTF8(*str, str.Length(), *result);
+			if (length == HLString::NPOS)
+			{
+				HL_CORE_ERROR("Could not convert to UTF-8; Invalid UTF-32.");
+				length = 0;
+			}
+
+			result.Resize(length);
+			return result;
+		}
+
 		HLAPI static uint32 UTF8StringLength(const HLString &str)
 		{
 			uint32 length = 0;
@@ -0,0 +1,721 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "StringAlgorithms.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+	// SSE2 is part of every x64 processor, AVX2 is only used, if the processor reports it at runtime
+	#define HL_STRING_SSE2
+	#include <immintrin.h>
+
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+#if defined(HL_STRING_SSE2) && (defined(__GNUC__) || defined(__clang__))
+	#define HL_STRING_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define HL_STRING_TARGET_AVX2
+#endif
+
+#define STRING_NOT_FOUND static_cast<uint32>(-1)
+
+namespace highlo::utils
+{
+	static HL_FORCE_INLINE uint32 CountTrailingZeros(uint32 mask)
+	{
+	#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return (uint32)index;
+	#else
+		return (uint32)__builtin_ctz(mask);
+	#endif
+	}
+
+	static bool DetectAVX2()
+	{
+	#if defined(HL_STRING_SSE2) && defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		// The operating system has to save the AVX registers on context switches
+		__cpuid(info, 1);
+		if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	#elif defined(HL_STRING_SSE2)
+		return __builtin_cpu_supports("avx2");
+	#else
+		return false;
+	#endif
+	}
+
+	// Static initializers, that run before this one, see false and use the SSE2 versions
+	static const bool s_AVX2Enabled = DetectAVX2();
+
+	/// <summary>
+	/// Decodes one UTF-8 sequence and returns its length or 0, if it is malformed.
+	/// </summary>
+	static uint32 DecodeUTF8Sequence(const uint8 *str, uint32 remaining, uint32 &outCodepoint)
+	{
+		uint8 lead = str[0];
+		if (lead < 0x80)
+		{
+			outCodepoint = lead;
+			return 1;
+		}
+
+		// The second byte has a narrower range after the leads, that could start overlong sequences, surrogates or code points after U+10FFFF
+		uint32 length;
+		uint32 codepoint;
+		uint8 secondMin = 0x80;
+		uint8 secondMax = 0xBF;
+
+		if (lead < 0xC2)
+		{
+			return 0;
+		}
+		else if (lead < 0xE0)
+		{
+			length = 2;
+			codepoint = lead & 0x1F;
+		}
+		else if (lead < 0xF0)
+		{
+			length = 3;
+			codepoint = lead & 0x0F;
+
+			if (lead == 0xE0)
+				secondMin = 0xA0;
+			else if (lead == 0xED)
+				secondMax = 0x9F;
+		}
+		else if (lead < 0xF5)
+		{
+			length = 4;
+			codepoint = lead & 0x07;
+
+			if (lead == 0xF0)
+				secondMin = 0x90;
+			else if (lead == 0xF4)
+				secondMax = 0x8F;
+		}
+		else
+		{
+			return 0;
+		}
+
+		if (remaining < length || str[1] < secondMin || str[1] > secondMax)
+			return 0;
+
+		codepoint = (codepoint << 6) | (str[1] & 0x3F);
+		for (uint32 i = 2; i < length; ++i)
+		{
+			if ((str[i] & 0xC0) != 0x80)
+				return 0;
+
+			codepoint = (codepoint << 6) | (str[i] & 0x3F);
+		}
+
+		outCodepoint = codepoint;
+		return length;
+	}
+
+	static HL_FORCE_INLINE uint32 EncodeUTF8(uint32 codepoint, char *out)
+	{
+		if (codepoint < 0x80)
+		{
+			out[0] = (char)codepoint;
+			return 1;
+		}
+		else if (codepoint < 0x800)
+		{
+			out[0] = (char)(0xC0 | (codepoint >> 6));
+			out[1] = (char)(0x80 | (codepoint & 0x3F));
+			return 2;
+		}
+		else if (codepoint < 0x10000)
+		{
+			out[0] = (char)(0xE0 | (codepoint >> 12));
+			out[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+			out[2] = (char)(0x80 | (codepoint & 0x3F));
+			return 3;
+		}
+
+		out[0] = (char)(0xF0 | (codepoint >> 18));
+		out[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+		out[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+		out[3] = (char)(0x80 | (codepoint & 0x3F));
+		return 4;
+	}
+
+	static HL_FORCE_INLINE bool IsASCIILetter(char c, char first)
+	{
+		return (uint8)(c - first) < 26;
+	}
+
+#ifdef HL_STRING_SSE2
+
+	// The SIMD kernels process full blocks, advance the position to the first unprocessed byte and leave the remaining bytes to the scalar code
+
+	static bool FindSubstringSSE2(const char *str, uint32 &position, uint32 lastStart, const char *find, uint32 findSize)
+	{
+		const __m128i first = _mm_set1_epi8(find[0]);
+		const __m128i last = _mm_set1_epi8(find[findSize - 1]);
+
+		uint32 i = position;
+		for (; (uint64)i + 16 <= (uint64)lastStart + 1; i += 16)
+		{
+			__m128i blockFirst = _mm_loadu_si128((const __m128i*)(str + i));
+			__m128i blockLast = _mm_loadu_si128((const __m128i*)(str + i + findSize - 1));
+			uint32 mask = (uint32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last)));
+
+			while (mask)
+			{
+				uint32 candidate = i + CountTrailingZeros(mask);
+				if (memcmp(str + candidate + 1, find + 1, findSize - 2) == 0)
+				{
+					position = candidate;
+					return true;
+				}
+
+				mask &= mask - 1;
+			}
+		}
+
+		position = i;
+		return false;
+	}
+
+	HL_STRING_TARGET_AVX2 static bool FindSubstringAVX2(const char *str, uint32 &position, uint32 lastStart, const char *find, uint32 findSize)
+	{
+		const __m256i first = _mm256_set1_epi8(find[0]);
+		const __m256i last = _mm256_set1_epi8(find[findSize - 1]);
+
+		uint32 i = position;
+		for (; (uint64)i + 32 <= (uint64)lastStart + 1; i += 32)
+		{
+			__m256i blockFirst = _mm256_loadu_si256((const __m256i*)(str + i));
+			__m256i blockLast = _mm256_loadu_si256((const __m256i*)(str + i + findSize - 1));
+			uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last)));
+
+			while (mask)
+			{
+				uint32 candidate = i + CountTrailingZeros(mask);
+				if (memcmp(str + candidate + 1, find + 1, findSize - 2) == 0)
+				{
+					position = candidate;
+					return true;
+				}
+
+				mask &= mask - 1;
+			}
+		}
+
+		position = i;
+		return false;
+	}
+
+	static bool FindAnyCharSSE2(const char *str, uint32 size, uint32 &position, const char *chars, uint32 charCount)
+	{
+		__m128i sets[16];
+		for (uint32 c = 0; c < charCount; ++c)
+			sets[c] = _mm_set1_epi8(chars[c]);
+
+		uint32 i = position;
+		for (; (uint64)i + 16 <= size; i += 16)
+		{
+			__m128i block = _mm_loadu_si128((const __m128i*)(str + i));
+			__m128i matches = _mm_cmpeq_epi8(block, sets[0]);
+			for (uint32 c = 1; c < charCount; ++c)
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, sets[c]));
+
+			uint32 mask = (uint32)_mm_movemask_epi8(matches);
+			if (mask)
+			{
+				position = i + CountTrailingZeros(mask);
+				return true;
+			}
+		}
+
+		position = i;
+		return false;
+	}
+
+	HL_STRING_TARGET_AVX2 static bool FindAnyCharAVX2(const char *str, uint32 size, uint32 &position, const char *chars, uint32 charCount)
+	{
+		__m256i sets[16];
+		for (uint32 c = 0; c < charCount; ++c)
+			sets[c] = _mm256_set1_epi8(chars[c]);
+
+		uint32 i = position;
+		for (; (uint64)i + 32 <= size; i += 32)
+		{
+			__m256i block = _mm256_loadu_si256((const __m256i*)(str + i));
+			__m256i matches = _mm256_cmpeq_epi8(block, sets[0]);
+			for (uint32 c = 1; c < charCount; ++c)
+				matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, sets[c]));
+
+			uint32 mask = (uint32)_mm256_movemask_epi8(matches);
+			if (mask)
+			{
+				position = i + CountTrailingZeros(mask);
+				return true;
+			}
+		}
+
+		position = i;
+		return false;
+	}
+
+	static uint32 CountCharSSE2(const char *str, uint32 size, uint32 &position, char letter)
+	{
+		const __m128i target = _mm_set1_epi8(letter);
+		const __m128i zero = _mm_setzero_si128();
+
+		uint64 count = 0;
+		uint32 i = position;
+		while ((uint64)i + 16 <= size)
+		{
+			// Every match subtracts -1 from a byte counter, the counters are summed up before they can overflow
+			__m128i counters = zero;
+			for (uint32 blocks = 0; blocks < 255 && (uint64)i + 16 <= size; ++blocks, i += 16)
+				counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(str + i)), target));
+
+			__m128i sums = _mm_sad_epu8(counters, zero);
+			count += (uint64)_mm_cvtsi128_si64(sums) + (uint64)_mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums));
+		}
+
+		position = i;
+		return (uint32)count;
+	}
+
+	HL_STRING_TARGET_AVX2 static uint32 CountCharAVX2(const char *str, uint32 size, uint32 &position, char letter)
+	{
+		const __m256i target = _mm256_set1_epi8(letter);
+		const __m256i zero = _mm256_setzero_si256();
+
+		uint64 count = 0;
+		uint32 i = position;
+		while ((uint64)i + 32 <= size)
+		{
+			__m256i counters = zero;
+			for (uint32 blocks = 0; blocks < 255 && (uint64)i + 32 <= size; ++blocks, i += 32)
+				counters = _mm256_sub_epi8(counters, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(str + i)), target));
+
+			alignas(32) uint64 sums[4];
+			_mm256_store_si256((__m256i*)sums, _mm256_sad_epu8(counters, zero));
+			count += sums[0] + sums[1] + sums[2] + sums[3];
+		}
+
+		position = i;
+		return (uint32)count;
+	}
+
+	static uint32 FlipCaseSSE2(char *str, uint32 size, char first)
+	{
+		// Moves the letters [first, first + 25] to the smallest signed bytes, so that a single signed comparison finds them
+		const __m128i shift = _mm_set1_epi8((char)(128 - first));
+		const __m128i limit = _mm_set1_epi8((char)(-128 + 26));
+		const __m128i caseBit = _mm_set1_epi8(0x20);
+
+		uint32 i = 0;
+		for (; (uint64)i + 16 <= size; i += 16)
+		{
+			__m128i block = _mm_loadu_si128((const __m128i*)(str + i));
+			__m128i isLetter = _mm_cmpgt_epi8(limit, _mm_add_epi8(block, shift));
+			_mm_storeu_si128((__m128i*)(str + i), _mm_xor_si128(block, _mm_and_si128(isLetter, caseBit)));
+		}
+
+		return i;
+	}
+
+	HL_STRING_TARGET_AVX2 static uint32 FlipCaseAVX2(char *str, uint32 size, char first)
+	{
+		const __m256i shift = _mm256_set1_epi8((char)(128 - first));
+		const __m256i limit = _mm256_set1_epi8((char)(-128 + 26));
+		const __m256i caseBit = _mm256_set1_epi8(0x20);
+
+		uint32 i = 0;
+		for (; (uint64)i + 32 <= size; i += 32)
+		{
+			__m256i block = _mm256_loadu_si256((const __m256i*)(str + i));
+			__m256i isLetter = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(block, shift));
+			_mm256_storeu_si256((__m256i*)(str + i), _mm256_xor_si256(block, _mm256_and_si256(isLetter, caseBit)));
+		}
+
+		return i;
+	}
+
+	/// <summary>
+	/// Returns the position of the first byte, that is not ASCII, or the position, where less than a full block is left.
+	/// </summary>
+	static uint32 SkipASCIISSE2(const uint8 *str, uint32 size, uint32 i)
+	{
+		for (; (uint64)i + 16 <= size; i += 16)
+		{
+			uint32 mask = (uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(str + i)));
+			if (mask)
+				return i + CountTrailingZeros(mask);
+		}
+
+		return i;
+	}
+
+	HL_STRING_TARGET_AVX2 static uint32 SkipASCIIAVX2(const uint8 *str, uint32 size, uint32 i)
+	{
+		for (; (uint64)i + 32 <= size; i += 32)
+		{
+			uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(str + i)));
+			if (mask)
+				return i + CountTrailingZeros(mask);
+		}
+
+		return i;
+	}
+
+#endif
+
+	bool IsStringAVX2Enabled()
+	{
+		return s_AVX2Enabled;
+	}
+
+	uint32 FindSubstring(const char *str, uint32 size, const char *find, uint32 findSize, uint32 offset)
+	{
+		if (findSize == 0 || offset >= size || findSize > size - offset)
+			return STRING_NOT_FOUND;
+
+		if (findSize == 1)
+		{
+			const void *found = memchr(str + offset, find[0], size - offset);
+			return found ? (uint32)((const char*)found - str) : STRING_NOT_FOUND;
+		}
+
+		uint32 lastStart = size - findSize;
+		uint32 i = offset;
+
+	#ifdef HL_STRING_SSE2
+		bool found = s_AVX2Enabled ? FindSubstringAVX2(str, i, lastStart, find, findSize) : FindSubstringSSE2(str, i, lastStart, find, findSize);
+		if (found)
+			return i;
+	#endif
+
+		for (; i <= lastStart; ++i)
+		{
+			if (str[i] == find[0] && str[i + findSize - 1] == find[findSize - 1] && memcmp(str + i + 1, find + 1, findSize - 2) == 0)
+				return i;
+		}
+
+		return STRING_NOT_FOUND;
+	}
+
+	uint32 FindAnyChar(const char *str, uint32 size, const char *chars, uint32 charCount, uint32 offset)
+	{
+		if (offset >= size || charCount == 0)
+			return STRING_NOT_FOUND;
+
+		if (charCount == 1)
+		{
+			const void *found = memchr(str + offset, chars[0], size - offset);
+			return found ? (uint32)((const char*)found - str) : STRING_NOT_FOUND;
+		}
+
+		uint32 i = offset;
+
+	#ifdef HL_STRING_SSE2
+		// Larger sets need more comparisons per block than the table lookup below costs
+		if (charCount <= 16)
+		{
+			bool found = s_AVX2Enabled ? FindAnyCharAVX2(str, size, i, chars, charCount) : FindAnyCharSSE2(str, size, i, chars, charCount);
+			if (found)
+				return i;
+		}
+	#endif
+
+		bool isSearched[256] = {};
+		for (uint32 c = 0; c < charCount; ++c)
+			isSearched[(uint8)chars[c]] = true;
+
+		for (; i < size; ++i)
+		{
+			if (isSearched[(uint8)str[i]])
+				return i;
+		}
+
+		return STRING_NOT_FOUND;
+	}
+
+	uint32 CountChar(const char *str, uint32 size, char letter)
+	{
+		uint32 count = 0;
+		uint32 i = 0;
+
+	#ifdef HL_STRING_SSE2
+		count = s_AVX2Enabled ? CountCharAVX2(str, size, i, letter) : CountCharSSE2(str, size, i, letter);
+	#endif
+
+		for (; i < size; ++i)
+		{
+			if (str[i] == letter)
+				++count;
+		}
+
+		return count;
+	}
+
+	void ToLowerCaseASCII(char *str, uint32 size)
+	{
+		uint32 i = 0;
+
+	#ifdef HL_STRING_SSE2
+		i = s_AVX2Enabled ? FlipCaseAVX2(str, size, 'A') : FlipCaseSSE2(str, size, 'A');
+	#endif
+
+		for (; i < size; ++i)
+		{
+			if (IsASCIILetter(str[i], 'A'))
+				str[i] ^= 0x20;
+		}
+	}
+
+	void ToUpperCaseASCII(char *str, uint32 size)
+	{
+		uint32 i = 0;
+
+	#ifdef HL_STRING_SSE2
+		i = s_AVX2Enabled ? FlipCaseAVX2(str, size, 'a') : FlipCaseSSE2(str, size, 'a');
+	#endif
+
+		for (; i < size; ++i)
+		{
+			if (IsASCIILetter(str[i], 'a'))
+				str[i] ^= 0x20;
+		}
+	}
+
+	bool IsValidUTF8(const char *str, uint32 size)
+	{
+		const uint8 *bytes = (const uint8*)str;
+		uint32 i = 0;
+
+		while (i < size)
+		{
+		#ifdef HL_STRING_SSE2
+			i = s_AVX2Enabled ? SkipASCIIAVX2(bytes, size, i) : SkipASCIISSE2(bytes, size, i);
+			if (i >= size)
+				break;
+		#endif
+
+			uint32 codepoint;
+			uint32 length = DecodeUTF8Sequence(bytes + i, size - i, codepoint);
+			if (!length)
+				return false;
+
+			i += length;
+		}
+
+		return true;
+	}
+
+	uint32 UTF8ToUTF16(const char *str, uint32 size, char16_t *out)
+	{
+		const uint8 *bytes = (const uint8*)str;
+		uint32 i = 0;
+		uint32 written = 0;
+
+		while (i < size)
+		{
+			uint32 blockEnd = size;
+
+		#ifdef HL_STRING_SSE2
+			// Every block is widened completely, the characters after the first non ASCII byte are overwritten by the scalar code.
+			// Less characters are written than bytes are read, so the stores stay inside of the output.
+			const __m128i zero = _mm_setzero_si128();
+			for (; (uint64)i + 16 <= size; i += 16, written += 16)
+			{
+				__m128i block = _mm_loadu_si128((const __m128i*)(bytes + i));
+				_mm_storeu_si128((__m128i*)(out + written), _mm_unpacklo_epi8(block, zero));
+				_mm_storeu_si128((__m128i*)(out + written + 8), _mm_unpackhi_epi8(block, zero));
+
+				uint32 mask = (uint32)_mm_movemask_epi8(block);
+				if (mask)
+				{
+					uint32 ascii = CountTrailingZeros(mask);
+					blockEnd = i + 16;
+					i += ascii;
+					written += ascii;
+					break;
+				}
+			}
+		#endif
+
+			while (i < blockEnd)
+			{
+				uint32 codepoint;
+				uint32 length = DecodeUTF8Sequence(bytes + i, size - i, codepoint);
+				if (!length)
+					return STRING_NOT_FOUND;
+
+				if (codepoint >= 0x10000)
+				{
+					codepoint -= 0x10000;
+					out[written++] = (char16_t)(0xD800 + (codepoint >> 10));
+					out[written++] = (char16_t)(0xDC00 + (codepoint & 0x3FF));
+				}
+				else
+				{
+					out[written++] = (char16_t)codepoint;
+				}
+
+				i += length;
+			}
+		}
+
+		return written;
+	}
+
+	uint32 UTF8ToUTF32(const char *str, uint32 size, char32_t *out)
+	{
+		const uint8 *bytes = (const uint8*)str;
+		uint32 i = 0;
+		uint32 written = 0;
+
+		while (i < size)
+		{
+			uint32 blockEnd = size;
+
+		#ifdef HL_STRING_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			for (; (uint64)i + 16 <= size; i += 16, written += 16)
+			{
+				__m128i block = _mm_loadu_si128((const __m128i*)(bytes + i));
+				__m128i low = _mm_unpacklo_epi8(block, zero);
+				__m128i high = _mm_unpackhi_epi8(block, zero);
+				_mm_storeu_si128((__m128i*)(out + written), _mm_unpacklo_epi16(low, zero));
+				_mm_storeu_si128((__m128i*)(out + written + 4), _mm_unpackhi_epi16(low, zero));
+				_mm_storeu_si128((__m128i*)(out + written + 8), _mm_unpacklo_epi16(high, zero));
+				_mm_storeu_si128((__m128i*)(out + written + 12), _mm_unpackhi_epi16(high, zero));
+
+				uint32 mask = (uint32)_mm_movemask_epi8(block);
+				if (mask)
+				{
+					uint32 ascii = CountTrailingZeros(mask);
+					blockEnd = i + 16;
+					i += ascii;
+					written += ascii;
+					break;
+				}
+			}
+		#endif
+
+			while (i < blockEnd)
+			{
+				uint32 codepoint;
+				uint32 length = DecodeUTF8Sequence(bytes + i, size - i, codepoint);
+				if (!length)
+					return STRING_NOT_FOUND;
+
+				out[written++] = (char32_t)codepoint;
+				i += length;
+			}
+		}
+
+		return written;
+	}
+
+	uint32 UTF16ToUTF8(const char16_t *str, uint32 size, char *out)
+	{
+		uint32 i = 0;
+		uint32 written = 0;
+
+		while (i < size)
+		{
+			uint32 blockEnd = size;
+
+		#ifdef HL_STRING_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i nonASCIIBits = _mm_set1_epi16((short)0xFF80);
+			for (; (uint64)i + 8 <= size; i += 8, written += 8)
+			{
+				__m128i block = _mm_loadu_si128((const __m128i*)(str + i));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, nonASCIIBits), zero)) != 0xFFFF)
+				{
+					blockEnd = i + 8;
+					break;
+				}
+
+				_mm_storel_epi64((__m128i*)(out + written), _mm_packus_epi16(block, block));
+			}
+		#endif
+
+			while (i < blockEnd)
+			{
+				uint32 unit = str[i];
+				if (unit >= 0xD800 && unit <= 0xDFFF)
+				{
+					if (unit > 0xDBFF || i + 1 >= size || str[i + 1] < 0xDC00 || str[i + 1] > 0xDFFF)
+						return STRING_NOT_FOUND;
+
+					uint32 codepoint = 0x10000 + ((unit - 0xD800) << 10) + (str[i + 1] - 0xDC00);
+					written += EncodeUTF8(codepoint, out + written);
+					i += 2;
+				}
+				else
+				{
+					written += EncodeUTF8(unit, out + written);
+					++i;
+				}
+			}
+		}
+
+		return written;
+	}
+
+	uint32 UTF32ToUTF8(const char32_t *str, uint32 size, char *out)
+	{
+		uint32 i = 0;
+		uint32 written = 0;
+
+		while (i < size)
+		{
+			uint32 blockEnd = size;
+
+		#ifdef HL_STRING_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i nonASCIIBits = _mm_set1_epi32(~0x7F);
+			for (; (uint64)i + 4 <= size; i += 4, written += 4)
+			{
+				__m128i block = _mm_loadu_si128((const __m128i*)(str + i));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(block, nonASCIIBits), zero)) != 0xFFFF)
+				{
+					blockEnd = i + 4;
+					break;
+				}
+
+				__m128i packed = _mm_packs_epi32(block, block);
+				int32 bytes = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+				memcpy(out + written, &bytes, 4);
+			}
+		#endif
+
+			for (; i < blockEnd; ++i)
+			{
+				uint32 codepoint = (uint32)str[i];
+				if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+					return STRING_NOT_FOUND;
+
+				written += EncodeUTF8(codepoint, out + written);
+			}
+		}
+
+		return written;
+	}
+}
+
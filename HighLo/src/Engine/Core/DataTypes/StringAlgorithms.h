@@ -0,0 +1,74 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Defines/BaseTypes.h"
+
+namespace highlo
+{
+	// Vectorized kernels for byte strings, that HLString uses for its searches and conversions.
+	// On x64 they process 16 bytes per step with SSE2 and 32 bytes with AVX2, if the processor supports it.
+	// On other platforms the scalar versions are used. All functions return static_cast<uint32>(-1), if they did not find anything.
+	namespace utils
+	{
+		/// <summary>
+		/// Returns true, if the string kernels use the AVX2 versions on this processor.
+		/// </summary>
+		HLAPI bool IsStringAVX2Enabled();
+
+		/// <summary>
+		/// Searches the first occurrence of find in str, starting at the offset. Empty strings are never found.
+		/// Only positions, where the first and the last character match, are compared completely.
+		/// </summary>
+		HLAPI uint32 FindSubstring(const char *str, uint32 size, const char *find, uint32 findSize, uint32 offset);
+
+		/// <summary>
+		/// Searches the first character, that is one of the given characters, starting at the offset.
+		/// </summary>
+		HLAPI uint32 FindAnyChar(const char *str, uint32 size, const char *chars, uint32 charCount, uint32 offset);
+
+		HLAPI uint32 CountChar(const char *str, uint32 size, char letter);
+
+		/// <summary>
+		/// Converts the ASCII letters, all other bytes, like the bytes of UTF-8 sequences, stay the same.
+		/// </summary>
+		HLAPI void ToLowerCaseASCII(char *str, uint32 size);
+		HLAPI void ToUpperCaseASCII(char *str, uint32 size);
+
+		/// <summary>
+		/// Checks, that the string is well-formed UTF-8: no overlong sequences, no surrogates and no code points after U+10FFFF.
+		/// </summary>
+		HLAPI bool IsValidUTF8(const char *str, uint32 size);
+
+		/// <summary>
+		/// Transcodes UTF-8 to UTF-16, the output needs space for size characters.
+		/// </summary>
+		/// <returns>Returns the number of written characters or static_cast<uint32>(-1), if the input is not valid UTF-8.</returns>
+		HLAPI uint32 UTF8ToUTF16(const char *str, uint32 size, char16_t *out);
+
+		/// <summary>
+		/// Transcodes UTF-8 to UTF-32, the output needs space for size characters.
+		/// </summary>
+		/// <returns>Returns the number of written characters or static_cast<uint32>(-1), if the input is not valid UTF-8.</returns>
+		HLAPI uint32 UTF8ToUTF32(const char *str, uint32 size, char32_t *out);
+
+		/// <summary>
+		/// Transcodes UTF-16 to UTF-8, the output needs space for 3 * size bytes.
+		/// </summary>
+		/// <returns>Returns the number of written bytes or static_cast<uint32>(-1), if the input contains unpaired surrogates.</returns>
+		HLAPI uint32 UTF16ToUTF8(const char16_t *str, uint32 size, char *out);
+
+		/// <summary>
+		/// Transcodes UTF-32 to UTF-8, the output needs space for 4 * size bytes.
+		/// </summary>
+		/// <returns>Returns the number of written bytes or static_cast<uint32>(-1), if the input contains surrogates or code points after U+10FFFF.</returns>
+		HLAPI uint32 UTF32ToUTF8(const char32_t *str, uint32 size, char *out);
+	}
+}
+
@@ -2,12 +2,17 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Allocate raw storage from container allocators, relocate with memcpy where possible and added HLSmallVector
 //     - 1.0 (2021-09-14) initial release
 //
 
 #pragma once
 
 #include "Engine/Core/Core.h"
+#include "ContainerAllocator.h"
+#include "Relocatable.h"
+
+#include <initializer_list>
 
 namespace highlo
 {
@@ -118,89 +123,157 @@ namespace highlo
 		}
 	};
 
-	template<typename T>
-	class HLVector
+	namespace utils
+	{
+		template<typename T, uint32 InlineCapacity>
+		struct VectorInlineStorage
+		{
+			alignas(T) uint8 InlineStorage[InlineCapacity * sizeof(T)];
+
+			T *GetInlineData() { return reinterpret_cast<T*>(InlineStorage); }
+		};
+
+		template<typename T>
+		struct VectorInlineStorage<T, 0>
+		{
+			T *GetInlineData() { return nullptr; }
+		};
+	}
+
+	/// <summary>
+	/// Dynamic array, that allocates its raw storage from the given container allocator.
+	/// Elements are only constructed when they are added and trivially relocatable elements are moved with memcpy when the vector grows.
+	/// With an InlineCapacity the first elements are stored inside of the vector itself, see HLSmallVector.
+	/// </summary>
+	template<typename T, typename AllocatorType = HeapContainerAllocator, uint32 InlineCapacity = 0>
+	class HLVector : private AllocatorType, private utils::VectorInlineStorage<T, InlineCapacity>
 	{
 	private:
 
+		using InlineStorage = utils::VectorInlineStorage<T, InlineCapacity>;
+
 		T *m_Data = nullptr;
 		uint32 m_Size = 0;
 		uint32 m_Capacity = 0;
 
-		void ReAllocate(uint32 newCapacity)
+		bool IsInline(const T *data) const
 		{
-			// Allocate new block of memory
-			T *newBlock = (T*)::operator new(newCapacity * sizeof(T));
+			if constexpr (InlineCapacity > 0)
+				return data == const_cast<HLVector*>(this)->GetInlineData();
+			else
+				return false;
+		}
 
-			// Move from old block to new block
-			if (newCapacity < m_Size)
-				m_Size = newCapacity;
+		T *AllocateBlock(uint32 capacity)
+		{
+			// Without inline storage an empty vector holds no memory at all
+			if (capacity <= InlineCapacity)
+				return InlineStorage::GetInlineData();
 
-			for (uint32 i = 0; i < m_Size; ++i)
-				new (&newBlock[i]) T(std::move(m_Data[i]));
+			return static_cast<T*>(AllocatorType::Allocate((uint64)capacity * sizeof(T), alignof(T)));
+		}
 
-			// Delete old block
-			::operator delete(m_Data, m_Capacity * sizeof(T));
+		void FreeBlock(T *data, uint32 capacity)
+		{
+			if (data && !IsInline(data))
+				AllocatorType::Free(data, (uint64)capacity * sizeof(T), alignof(T));
+		}
+
+		uint32 GetGrowCapacity(uint32 minCapacity) const
+		{
+			uint32 capacity = m_Capacity + m_Capacity / 2;
+			if (capacity < 2)
+				capacity = 2;
+
+			return capacity < minCapacity ? minCapacity : capacity;
+		}
+
+		void ReAllocate(uint32 newCapacity)
+		{
+			HL_ASSERT(newCapacity >= m_Size);
+
+			T *newBlock = AllocateBlock(newCapacity);
+			if (newBlock == m_Data)
+				return;
+
+			utils::RelocateElements(m_Data, m_Size, newBlock);
+			FreeBlock(m_Data, m_Capacity);
 
 			m_Data = newBlock;
-			m_Capacity = newCapacity;
+			m_Capacity = newCapacity < InlineCapacity ? InlineCapacity : newCapacity;
+		}
+
+		void TakeStorage(HLVector &other)
+		{
+			if (other.IsInline(other.m_Data))
+			{
+				// Inline elements can not be stolen, they are relocated into the own inline storage
+				m_Data = InlineStorage::GetInlineData();
+				m_Capacity = InlineCapacity;
+				utils::RelocateElements(other.m_Data, other.m_Size, m_Data);
+			}
+			else
+			{
+				m_Data = other.m_Data;
+				m_Capacity = other.m_Capacity;
+			}
+
+			m_Size = other.m_Size;
+
+			other.m_Data = other.InlineStorage::GetInlineData();
+			other.m_Size = 0;
+			other.m_Capacity = InlineCapacity;
 		}
 
 	public:
 
 		using ValueType = T;
-		using Iterator  = HLVectorIterator<HLVector<T>>;
+		using Iterator  = HLVectorIterator<HLVector>;
 
 		HLAPI HLVector()
+			: m_Data(InlineStorage::GetInlineData()), m_Capacity(InlineCapacity)
 		{
-			ReAllocate(2);
 		}
 
-		HLAPI HLVector(const HLVector &other)
+		HLAPI explicit HLVector(const AllocatorType &allocator)
+			: AllocatorType(allocator), m_Data(InlineStorage::GetInlineData()), m_Capacity(InlineCapacity)
 		{
-			m_Size = other.m_Size;
-			m_Capacity = other.m_Capacity;
-
-			ReAllocate(m_Capacity);
-			for (uint32 i = 0; i < m_Size; ++i)
-			{
-				m_Data[i] = std::move(other.m_Data[i]);
-			}
 		}
 
-		HLAPI HLVector(HLVector &&other) noexcept
+		HLAPI HLVector(std::initializer_list<T> values, const AllocatorType &allocator = AllocatorType())
+			: HLVector(allocator)
 		{
-			if (this != &other)
-			{
-				m_Size = other.m_Size;
-				m_Capacity = other.m_Capacity;
+			Reserve((uint32)values.size());
+			for (const T &value : values)
+				new (&m_Data[m_Size++]) T(value);
+		}
 
-				ReAllocate(m_Capacity);
-				for (uint32 i = 0; i < m_Size; ++i)
-				{
-					m_Data[i] = std::move(other.m_Data[i]);
-				}
+		HLAPI HLVector(const HLVector &other)
+			: HLVector(static_cast<const AllocatorType&>(other))
+		{
+			Reserve(other.m_Size);
+			for (uint32 i = 0; i < other.m_Size; ++i)
+				new (&m_Data[i]) T(other.m_Data[i]);
 
-				for (uint32 i = 0; i < other.m_Size; ++i)
-				{
-					other.m_Data[i]->~T();
-				}
+			m_Size = other.m_Size;
+		}
 
-				other.m_Size = 0;
-				other.m_Capacity = 0;
-				other.m_Data = nullptr;
-			}
+		HLAPI HLVector(HLVector &&other) noexcept
+			: AllocatorType(static_cast<const AllocatorType&>(other))
+		{
+			TakeStorage(other);
 		}
 
 		HLAPI HLVector &operator=(const HLVector &other)
 		{
-			m_Size = other.m_Size;
-			m_Capacity = other.m_Capacity;
-
-			ReAllocate(m_Capacity);
-			for (uint32 i = 0; i < m_Size; ++i)
+			if (this != &other)
 			{
-				m_Data[i] = std::move(other.m_Data[i]);
+				Clear();
+				Reserve(other.m_Size);
+				for (uint32 i = 0; i < other.m_Size; ++i)
+					new (&m_Data[i]) T(other.m_Data[i]);
+
+				m_Size = other.m_Size;
 			}
 
 			return *this;
@@ -210,23 +283,11 @@ namespace highlo
 		{
 			if (this != &other)
 			{
-				m_Size = other.m_Size;
-				m_Capacity = other.m_Capacity;
-
-				ReAllocate(m_Capacity);
-				for (uint32 i = 0; i < m_Size; ++i)
-				{
-					m_Data[i] = std::move(other.m_Data[i]);
-				}
-
-				for (uint32 i = 0; i < other.m_Size; ++i)
-				{
-					other.m_Data[i]->~T();
-				}
+				Clear();
+				FreeBlock(m_Data, m_Capacity);
 
-				other.m_Size = 0;
-				other.m_Capacity = 0;
-				other.m_Data = nullptr;
+				AllocatorType::operator=(static_cast<const AllocatorType&>(other));
+				TakeStorage(other);
 			}
 
 			return *this;
@@ -235,35 +296,38 @@ namespace highlo
 		HLAPI ~HLVector()
 		{
 			Clear();
-// TODO: check why this is crashing
-			//::operator delete(m_Data, m_Capacity * sizeof(T));
+			FreeBlock(m_Data, m_Capacity);
 		}
 
 		HLAPI void PushBack(const T &value)
 		{
-			if (m_Size >= m_Capacity)
-				ReAllocate(m_Capacity + m_Capacity / 2);
-
-			m_Data[m_Size] = value;
-			++m_Size;
+			EmplaceBack(value);
 		}
 
 		HLAPI void PushBack(T &&value)
 		{
-			if (m_Size >= m_Capacity)
-				ReAllocate(m_Capacity + m_Capacity / 2);
-
-			m_Data[m_Size] = std::move(value);
-			++m_Size;
+			EmplaceBack(std::move(value));
 		}
 
 		template<typename... Args>
 		HLAPI T &EmplaceBack(Args&&... args)
 		{
-			if (m_Size >= m_Capacity)
-				ReAllocate(m_Capacity + m_Capacity / 2);
+			if (m_Size < m_Capacity)
+			{
+				new (&m_Data[m_Size]) T(std::forward<Args>(args)...);
+				return m_Data[m_Size++];
+			}
 
-			new(&m_Data[m_Size]) T(std::forward<Args>(args)...);
+			// The new element is created before the old elements are relocated, because the arguments could reference them
+			uint32 newCapacity = GetGrowCapacity(m_Size + 1);
+			T *newBlock = AllocateBlock(newCapacity);
+			new (&newBlock[m_Size]) T(std::forward<Args>(args)...);
+
+			utils::RelocateElements(m_Data, m_Size, newBlock);
+			FreeBlock(m_Data, m_Capacity);
+
+			m_Data = newBlock;
+			m_Capacity = newCapacity;
 			return m_Data[m_Size++];
 		}
 
@@ -276,22 +340,67 @@ namespace highlo
 			}
 		}
 
+		/// <summary>
+		/// Removes the element at the index and moves all following elements one step to the front.
+		/// </summary>
 		HLAPI void Remove(uint32 index)
 		{
-			HL_ASSERT(index >= 0 && index < m_Size);
+			HL_ASSERT(index < m_Size);
 
-			for (uint32 i = index; i < m_Size - 1; ++i)
+			if constexpr (IsTriviallyRelocatableV<T>)
 			{
-				m_Data[i] = m_Data[i + 1];
+				m_Data[index].~T();
+				memmove((void*)&m_Data[index], (const void*)&m_Data[index + 1], sizeof(T) * (m_Size - index - 1));
+			}
+			else
+			{
+				for (uint32 i = index; i < m_Size - 1; ++i)
+					m_Data[i] = std::move(m_Data[i + 1]);
+
+				m_Data[m_Size - 1].~T();
 			}
 
 			--m_Size;
 		}
 
-		HLAPI void Clear()
+		/// <summary>
+		/// Removes the element at the index by moving the last element into its place, so the order of the elements changes.
+		/// </summary>
+		HLAPI void RemoveUnordered(uint32 index)
+		{
+			HL_ASSERT(index < m_Size);
+
+			if (index != m_Size - 1)
+				m_Data[index] = std::move(m_Data[m_Size - 1]);
+
+			PopBack();
+		}
+
+		/// <summary>
+		/// Removes the first element, that is equal to the value.
+		/// </summary>
+		/// <returns>Returns false, if the vector does not contain the value.</returns>
+		HLAPI bool RemoveValue(const T &value)
 		{
 			for (uint32 i = 0; i < m_Size; ++i)
-				m_Data[i].~T();
+			{
+				if (m_Data[i] == value)
+				{
+					Remove(i);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		HLAPI void Clear()
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (uint32 i = 0; i < m_Size; ++i)
+					m_Data[i].~T();
+			}
 
 			m_Size = 0;
 		}
@@ -313,43 +422,93 @@ namespace highlo
 			return Iterator(m_Data + m_Size);
 		}
 
+		HLAPI bool Contains(const T &value) const
+		{
+			for (uint32 i = 0; i < m_Size; ++i)
+			{
+				if (m_Data[i] == value)
+					return true;
+			}
+
+			return false;
+		}
+
 		HLAPI bool IsEmpty() const { return m_Size == 0; }
 		HLAPI uint32 Size() const { return m_Size; }
 		HLAPI uint32 Capacity() const { return m_Capacity; }
-		HLAPI T &At(uint32 index) { HL_ASSERT(index >= 0 && index < m_Size); return m_Data[index]; }
-		HLAPI const T &At(uint32 index) const { HL_ASSERT(index >= 0 && index < m_Size); return m_Data[index]; }
-
+		HLAPI T *Data() { return m_Data; }
+		HLAPI const T *Data() const { return m_Data; }
+		HLAPI T &At(uint32 index) { HL_ASSERT(index < m_Size); return m_Data[index]; }
+		HLAPI const T &At(uint32 index) const { HL_ASSERT(index < m_Size); return m_Data[index]; }
+		HLAPI const AllocatorType &GetAllocator() const { return *this; }
+
+		/// <summary>
+		/// Returns true, if the elements are stored inside of the vector and not in allocated memory.
+		/// </summary>
+		HLAPI bool IsUsingInlineStorage() const { return IsInline(m_Data); }
+
+		/// <summary>
+		/// Makes sure, that the vector can hold the given amount of elements without allocating. Never shrinks the vector.
+		/// </summary>
 		HLAPI void Reserve(uint32 capacity)
 		{
-			if (!m_Data)
+			if (capacity > m_Capacity)
+				ReAllocate(capacity);
+		}
+
+		/// <summary>
+		/// Default constructs new elements or destroys the elements after the new size.
+		/// When the vector shrinks the unused memory is released as well.
+		/// </summary>
+		HLAPI void Resize(uint32 size)
+		{
+			if (size < m_Size)
 			{
-				m_Size = 0;
-				m_Capacity = 0;
+				for (uint32 i = size; i < m_Size; ++i)
+					m_Data[i].~T();
+
+				m_Size = size;
+				ShrinkToFit();
+				return;
 			}
 
-			T *buffer = new T[capacity];
-			uint32 newSize = capacity < m_Size ? capacity : m_Size;
-			for (uint32 i = 0; i < newSize; ++i)
-				buffer[i] = std::move(m_Data[i]);
+			Reserve(size);
+			for (uint32 i = m_Size; i < size; ++i)
+				new (&m_Data[i]) T();
 
-			::operator delete(m_Data, m_Capacity * sizeof(T));
-			m_Capacity = capacity;
-			m_Data = buffer;
+			m_Size = size;
 		}
 
-		HLAPI void Resize(uint32 size)
+		/// <summary>
+		/// Reduces the capacity to the size, elements move back into the inline storage if they fit.
+		/// </summary>
+		HLAPI void ShrinkToFit()
 		{
-			Reserve(size);
-			m_Size = size;
+			if (m_Capacity > m_Size && !IsInline(m_Data))
+				ReAllocate(m_Size);
 		}
 
 		HLAPI T &Front()
 		{
+			HL_ASSERT(m_Size > 0);
+			return m_Data[0];
+		}
+
+		HLAPI const T &Front() const
+		{
+			HL_ASSERT(m_Size > 0);
 			return m_Data[0];
 		}
 
 		HLAPI T &Back()
 		{
+			HL_ASSERT(m_Size > 0);
+			return m_Data[m_Size - 1];
+		}
+
+		HLAPI const T &Back() const
+		{
+			HL_ASSERT(m_Size > 0);
 			return m_Data[m_Size - 1];
 		}
 
@@ -363,6 +522,16 @@ namespace highlo
 			return Iterator(m_Data + m_Size);
 		}
 
+		HLAPI const T *begin() const
+		{
+			return m_Data;
+		}
+
+		HLAPI const T *end() const
+		{
+			return m_Data + m_Size;
+		}
+
 		HLAPI T &operator[](uint32 index)
 		{
 			HL_ASSERT(index < m_Size);
@@ -375,7 +544,7 @@ namespace highlo
 			return m_Data[index];
 		}
 
-		HLAPI friend std::ostream &operator<<(std::ostream &stream, const HLVector<T> &vector)
+		HLAPI friend std::ostream &operator<<(std::ostream &stream, const HLVector &vector)
 		{
 			for (uint32 i = 0; i < vector.Size(); ++i)
 				stream << vector[i] << std::endl;
@@ -383,5 +552,12 @@ namespace highlo
 			return stream;
 		}
 	};
+
+	/// <summary>
+	/// Vector, that stores up to InlineCapacity elements inside of itself and only allocates when it grows beyond that,
+	/// for the many small lists like the children of an entity.
+	/// </summary>
+	template<typename T, uint32 InlineCapacity, typename AllocatorType = HeapContainerAllocator>
+	using HLSmallVector = HLVector<T, AllocatorType, InlineCapacity>;
 }
 
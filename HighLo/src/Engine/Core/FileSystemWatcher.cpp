@@ -0,0 +1,156 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "FileSystemWatcher.h"
+
+namespace highlo
+{
+	namespace utils
+	{
+		static FileSystemAction CoalesceActions(FileSystemAction previous, FileSystemAction next)
+		{
+			switch (previous)
+			{
+				case FileSystemAction::Added:
+				{
+					// The file did not exist before the batch, so the later changes are part of its creation
+					if (next == FileSystemAction::Deleted)
+						return FileSystemAction::None;
+
+					return next == FileSystemAction::Renamed ? FileSystemAction::Renamed : FileSystemAction::Added;
+				}
+
+				case FileSystemAction::Deleted:
+				{
+					// Editors often save by deleting and recreating the file
+					if (next == FileSystemAction::Added)
+						return FileSystemAction::Modified;
+
+					return next;
+				}
+
+				case FileSystemAction::Renamed:
+				{
+					// Modifications of a renamed file are picked up by the asset that is moved to the new path
+					return next == FileSystemAction::Modified || next == FileSystemAction::Added ? FileSystemAction::Renamed : next;
+				}
+			}
+
+			return next;
+		}
+	}
+
+	void FileSystemChangeBatch::Add(FileSystemAction action, const FileSystemPath &filePath, bool isDirectory, const FileSystemPath &oldFilePath)
+	{
+		++m_RawCount;
+
+		Change change;
+		change.Action = action;
+		change.FilePath = filePath;
+		change.IsDirectory = isDirectory;
+
+		if (action == FileSystemAction::Renamed)
+		{
+			change.OldFilePath = oldFilePath;
+
+			auto oldIt = m_Indices.find(oldFilePath.String());
+			if (oldIt != m_Indices.end())
+			{
+				Change previous = m_Changes[oldIt->second];
+				Remove(oldFilePath.String());
+
+				if (previous.Action == FileSystemAction::Added)
+				{
+					// The file has been created within the batch, which is how editors save atomically.
+					// inotify does not report the replaced target, so the content at the new path counts as modified
+					// and the receivers import the path if it is not known yet.
+					change.Action = FileSystemAction::Modified;
+					change.OldFilePath = FileSystemPath();
+				}
+				else if (previous.Action == FileSystemAction::Renamed)
+				{
+					// Renamed back to the original name
+					if (previous.OldFilePath == filePath)
+						return;
+
+					change.OldFilePath = previous.OldFilePath;
+				}
+			}
+		}
+
+		auto it = m_Indices.find(filePath.String());
+		if (it == m_Indices.end())
+		{
+			m_Indices[filePath.String()] = (uint32)m_Changes.size();
+			m_Changes.push_back(change);
+			return;
+		}
+
+		Change &current = m_Changes[it->second];
+		if (current.Action == FileSystemAction::Renamed && change.Action == FileSystemAction::Deleted)
+		{
+			// A file that has been renamed and deleted afterwards has only been deleted from the outside
+			FileSystemPath originalPath = current.OldFilePath;
+			Remove(filePath.String());
+
+			--m_RawCount;
+			Add(FileSystemAction::Deleted, originalPath, isDirectory);
+			return;
+		}
+
+		FileSystemAction coalesced = utils::CoalesceActions(current.Action, change.Action);
+		if (coalesced == FileSystemAction::None)
+		{
+			Remove(filePath.String());
+			return;
+		}
+
+		if (change.Action == FileSystemAction::Renamed)
+			current.OldFilePath = change.OldFilePath;
+
+		current.Action = coalesced;
+		current.IsDirectory = isDirectory;
+	}
+
+	std::vector<FileSystemChangedEvent> FileSystemChangeBatch::Flush()
+	{
+		std::vector<FileSystemChangedEvent> events;
+		events.reserve(m_Indices.size());
+
+		for (const Change &change : m_Changes)
+		{
+			if (change.Action == FileSystemAction::None)
+				continue;
+
+			FileSystemChangedEvent e;
+			e.FilePath = change.FilePath;
+			e.IsDirectory = change.IsDirectory;
+			e.Action = change.Action;
+
+			if (change.Action == FileSystemAction::Renamed)
+			{
+				e.OldFilePath = change.OldFilePath;
+				e.OldName = change.OldFilePath.Filename();
+				e.NewName = change.FilePath.Filename();
+			}
+
+			events.push_back(e);
+		}
+
+		m_Changes.clear();
+		m_Indices.clear();
+		m_RawCount = 0;
+		return events;
+	}
+
+	void FileSystemChangeBatch::Remove(const HLString &filePath)
+	{
+		auto it = m_Indices.find(filePath);
+		if (it == m_Indices.end())
+			return;
+
+		m_Changes[it->second].Action = FileSystemAction::None;
+		m_Indices.erase(it);
+	}
+}
+
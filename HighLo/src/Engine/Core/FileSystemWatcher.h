@@ -2,15 +2,59 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Renames keep the full previous path and atomic saves are reported as modifications
+//     - 1.1 (2026-10-19) Added the Linux implementation and the debounced batches of changes
 //     - 1.0 (2021-10-04) initial release
 //
 
 #pragma once
 
+#include <atomic>
+
 #include "Engine/Events/ApplicationEvents.h"
 
 namespace highlo
 {
+	/// <summary>
+	/// Collects the raw changes of a burst and coalesces them into at most one change per path,
+	/// so that for example a file that is created, written several times and deleted again produces no event at all.
+	/// </summary>
+	class FileSystemChangeBatch
+	{
+	public:
+
+		/// <summary>
+		/// Adds a raw change, renames have to provide the previous path of the file.
+		/// </summary>
+		HLAPI void Add(FileSystemAction action, const FileSystemPath &filePath, bool isDirectory, const FileSystemPath &oldFilePath = FileSystemPath());
+
+		/// <summary>
+		/// Returns the coalesced changes in the order in which their paths have been changed first and clears the batch.
+		/// Renames carry the full previous path, so that moves between different directories are reported as renames as well.
+		/// </summary>
+		HLAPI std::vector<FileSystemChangedEvent> Flush();
+
+		HLAPI bool IsEmpty() const { return m_Indices.empty(); }
+		HLAPI uint32 GetRawCount() const { return m_RawCount; }
+
+	private:
+
+		struct Change
+		{
+			FileSystemAction Action = FileSystemAction::None;
+			FileSystemPath FilePath;
+			FileSystemPath OldFilePath;
+			bool IsDirectory = false;
+		};
+
+		void Remove(const HLString &filePath);
+
+		// Removed changes stay in the list with the action None, so that the order of the others is kept
+		std::vector<Change> m_Changes;
+		std::unordered_map<HLString, uint32> m_Indices;
+		uint32 m_RawCount = 0;
+	};
+
 	class FileSystemWatcher : public Singleton<FileSystemWatcher>
 	{
 	public:
@@ -21,10 +65,29 @@ namespace highlo
 		HLAPI void SetWatchPath(const HLString &filePath);
 		HLAPI void DisableWatchUntilNextAction();
 
+		/// <summary>
+		/// The changes are dispatched once the watched directory has been quiet for the debounce interval,
+		/// but at the latest after the maximum delay, so that a constant stream of changes is still reported.
+		/// </summary>
+		HLAPI void SetDebounceInterval(uint32 debounceMilliseconds, uint32 maxDelayMilliseconds)
+		{
+			m_DebounceMilliseconds = debounceMilliseconds;
+			m_MaxDelayMilliseconds = maxDelayMilliseconds > debounceMilliseconds ? maxDelayMilliseconds : debounceMilliseconds;
+		}
+
+		HLAPI uint32 GetDebounceInterval() const { return m_DebounceMilliseconds; }
+		HLAPI uint32 GetMaxDelay() const { return m_MaxDelayMilliseconds; }
+
 	private:
 
+	#ifdef HL_PLATFORM_WINDOWS
 		static ULONG Watch(void *param);
-		
+	#else
+		static void Watch();
+	#endif // HL_PLATFORM_WINDOWS
+
+		std::atomic<uint32> m_DebounceMilliseconds = 100;
+		std::atomic<uint32> m_MaxDelayMilliseconds = 1000;
 	};
 }
 
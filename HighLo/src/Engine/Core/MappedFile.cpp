@@ -0,0 +1,182 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "MappedFile.h"
+
+#define MAPPED_FILE_LOG_PREFIX "MappedFile>   "
+
+namespace highlo
+{
+	MappedFile::MappedFile(const FileSystemPath &filePath, MappedFileAccess access)
+	{
+		Open(filePath, access);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	MappedFile::MappedFile(MappedFile &&other) noexcept
+		: m_Data(other.m_Data), m_Size(other.m_Size), m_Open(other.m_Open)
+	{
+		other.m_Data = nullptr;
+		other.m_Size = 0;
+		other.m_Open = false;
+	}
+
+	MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+
+			m_Data = other.m_Data;
+			m_Size = other.m_Size;
+			m_Open = other.m_Open;
+
+			other.m_Data = nullptr;
+			other.m_Size = 0;
+			other.m_Open = false;
+		}
+
+		return *this;
+	}
+
+	bool MappedFile::Open(const FileSystemPath &filePath, MappedFileAccess access)
+	{
+		Close();
+
+		m_Open = Map(filePath, access);
+		if (!m_Open)
+		{
+			m_Data = nullptr;
+			m_Size = 0;
+			HL_CORE_ERROR(MAPPED_FILE_LOG_PREFIX "[-] Failed to map file {0} [-]", *filePath.String());
+		}
+
+		return m_Open;
+	}
+
+	void MappedFile::Close()
+	{
+		if (!m_Open)
+			return;
+
+		// Empty files are never mapped
+		if (m_Data)
+			Unmap();
+
+		m_Data = nullptr;
+		m_Size = 0;
+		m_Open = false;
+	}
+
+	FileStreamReader::FileStreamReader(const FileSystemPath &filePath, uint32 bufferSize)
+		: m_Stream(*filePath.String(), std::ios::in | std::ios::binary)
+	{
+		if (!m_Stream)
+			return;
+
+		m_Stream.seekg(0, std::ios::end);
+		m_Size = (uint64)m_Stream.tellg();
+		m_Stream.seekg(0, std::ios::beg);
+
+		m_Buffer.resize(HL_MAX(bufferSize, 1u));
+		m_Open = true;
+	}
+
+	uint64 FileStreamReader::Read(void *destination, uint64 size)
+	{
+		Byte *writePtr = (Byte*)destination;
+		uint64 totalRead = 0;
+
+		while (totalRead < size)
+		{
+			const Byte *chunk = nullptr;
+			uint64 chunkSize = ReadChunk(chunk, size - totalRead);
+			if (chunkSize == 0)
+				break;
+
+			memcpy(writePtr + totalRead, chunk, chunkSize);
+			totalRead += chunkSize;
+		}
+
+		return totalRead;
+	}
+
+	uint64 FileStreamReader::ReadChunk(const Byte *&outData, uint64 maxSize)
+	{
+		if (m_BufferPosition == m_BufferSize && !FillBuffer())
+			return 0;
+
+		uint64 chunkSize = HL_MIN(maxSize, m_BufferSize - m_BufferPosition);
+		outData = m_Buffer.data() + m_BufferPosition;
+		m_BufferPosition += chunkSize;
+		return chunkSize;
+	}
+
+	bool FileStreamReader::ReadLine(HLString &outLine)
+	{
+		if (IsEndOfFile())
+			return false;
+
+		std::string line;
+		while (m_BufferPosition < m_BufferSize || FillBuffer())
+		{
+			const Byte *begin = m_Buffer.data() + m_BufferPosition;
+			const Byte *end = m_Buffer.data() + m_BufferSize;
+			const Byte *lineBreak = std::find(begin, end, (Byte)'\n');
+
+			line.append((const char*)begin, lineBreak - begin);
+			m_BufferPosition += lineBreak - begin;
+
+			if (lineBreak != end)
+			{
+				++m_BufferPosition;
+				break;
+			}
+		}
+
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		outLine = HLString(line.c_str(), (uint32)line.size());
+		return true;
+	}
+
+	bool FileStreamReader::Seek(uint64 position)
+	{
+		if (!m_Open || position > m_Size)
+			return false;
+
+		// Seeking inside of the buffered range does not touch the file
+		if (position >= m_BufferOffset && position <= m_BufferOffset + m_BufferSize)
+		{
+			m_BufferPosition = position - m_BufferOffset;
+			return true;
+		}
+
+		m_Stream.clear();
+		m_Stream.seekg((std::streamoff)position, std::ios::beg);
+		m_BufferOffset = position;
+		m_BufferPosition = 0;
+		m_BufferSize = 0;
+		return (bool)m_Stream;
+	}
+
+	bool FileStreamReader::FillBuffer()
+	{
+		if (!m_Open)
+			return false;
+
+		m_BufferOffset += m_BufferSize;
+		m_BufferPosition = 0;
+		m_BufferSize = 0;
+
+		m_Stream.read((char*)m_Buffer.data(), m_Buffer.size());
+		m_BufferSize = (uint64)m_Stream.gcount();
+		return m_BufferSize > 0;
+	}
+}
+
@@ -0,0 +1,122 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <fstream>
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/FileSystemPath.h"
+
+namespace highlo
+{
+	enum class MappedFileAccess
+	{
+		Normal = 0,
+		Sequential	/**< The file is read once from the beginning to the end, the OS can read ahead and drop the pages early. */
+	};
+
+	/// <summary>
+	/// Maps a file read-only into the address space. The content is paged in by the OS when it is accessed,
+	/// so nothing is copied and only the used parts of the file occupy memory. The mapping is released together with the object.
+	/// </summary>
+	class MappedFile
+	{
+	public:
+
+		HLAPI MappedFile() = default;
+		HLAPI MappedFile(const FileSystemPath &filePath, MappedFileAccess access = MappedFileAccess::Normal);
+		HLAPI ~MappedFile();
+
+		HLAPI MappedFile(MappedFile &&other) noexcept;
+		HLAPI MappedFile &operator=(MappedFile &&other) noexcept;
+
+		HL_NON_COPYABLE(MappedFile);
+
+		/// <summary>
+		/// Maps the file, a previous mapping is released. Empty files can be opened, but have no data.
+		/// </summary>
+		HLAPI bool Open(const FileSystemPath &filePath, MappedFileAccess access = MappedFileAccess::Normal);
+		HLAPI void Close();
+
+		HLAPI bool IsOpen() const { return m_Open; }
+		HLAPI const Byte *GetData() const { return m_Data; }
+		HLAPI uint64 GetSize() const { return m_Size; }
+
+		/// <summary>
+		/// Returns the content as characters, the text is not null terminated, GetSize() returns its length.
+		/// </summary>
+		HLAPI const char *GetText() const { return (const char*)m_Data; }
+
+		HLAPI operator bool() const { return m_Open; }
+
+	private:
+
+		bool Map(const FileSystemPath &filePath, MappedFileAccess access);
+		void Unmap();
+
+		const Byte *m_Data = nullptr;
+		uint64 m_Size = 0;
+		bool m_Open = false;
+	};
+
+	/// <summary>
+	/// Reads a file front to back through a fixed size buffer, so that files of any size can be processed with constant memory.
+	/// </summary>
+	class FileStreamReader
+	{
+	public:
+
+		HLAPI FileStreamReader(const FileSystemPath &filePath, uint32 bufferSize = 64 * 1024);
+		HLAPI ~FileStreamReader() = default;
+
+		HL_NON_COPYABLE(FileStreamReader);
+
+		HLAPI bool IsOpen() const { return m_Open; }
+		HLAPI uint64 GetSize() const { return m_Size; }
+		HLAPI uint64 GetPosition() const { return m_BufferOffset + m_BufferPosition; }
+		HLAPI bool IsEndOfFile() const { return GetPosition() >= m_Size; }
+
+		/// <summary>
+		/// Copies the next bytes of the file into the destination.
+		/// </summary>
+		/// <returns>Returns the number of bytes, that have been read.</returns>
+		HLAPI uint64 Read(void *destination, uint64 size);
+
+		template<typename T>
+		HLAPI bool Read(T &outValue)
+		{
+			return Read(&outValue, sizeof(T)) == sizeof(T);
+		}
+
+		/// <summary>
+		/// Returns the next bytes of the file without copying them, outData points into the internal buffer and is valid until the next call.
+		/// </summary>
+		/// <returns>Returns the number of bytes in outData, 0 at the end of the file.</returns>
+		HLAPI uint64 ReadChunk(const Byte *&outData, uint64 maxSize = ~0ull);
+
+		/// <summary>
+		/// Reads the next line without the line break, it returns false at the end of the file.
+		/// </summary>
+		HLAPI bool ReadLine(HLString &outLine);
+
+		HLAPI bool Seek(uint64 position);
+
+	private:
+
+		bool FillBuffer();
+
+		std::ifstream m_Stream;
+		std::vector<Byte> m_Buffer;
+		uint64 m_BufferOffset = 0;		/**< The position of the first byte of the buffer in the file. */
+		uint64 m_BufferPosition = 0;
+		uint64 m_BufferSize = 0;
+		uint64 m_Size = 0;
+		bool m_Open = false;
+	};
+}
+
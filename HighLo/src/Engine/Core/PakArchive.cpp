@@ -0,0 +1,405 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "PakArchive.h"
+
+#include <filesystem>
+
+#include "Engine/Threading/Thread.h"
+
+#define PAK_ARCHIVE_LOG_PREFIX "PakArchive>   "
+
+namespace highlo
+{
+	namespace utils
+	{
+		static uint64 AlignPakOffset(uint64 offset, uint64 alignment)
+		{
+			return (offset + alignment - 1) / alignment * alignment;
+		}
+
+		static bool IsPowerOfTwo(uint32 value)
+		{
+			return value && !(value & (value - 1));
+		}
+
+		static bool WritePadding(std::ofstream &out, uint64 alignment)
+		{
+			static const char s_Zeros[256] = {};
+
+			uint64 position = (uint64)out.tellp();
+			uint64 padding = AlignPakOffset(position, alignment) - position;
+			while (padding > 0)
+			{
+				uint64 count = padding < sizeof(s_Zeros) ? padding : sizeof(s_Zeros);
+				out.write(s_Zeros, count);
+				padding -= count;
+			}
+
+			return out.good();
+		}
+	}
+
+	Ref<PakArchive> PakArchive::Open(const FileSystemPath &filePath)
+	{
+		Ref<PakArchive> archive = Ref<PakArchive>::Create();
+		archive->m_FilePath = filePath;
+
+		if (!archive->m_File.Open(filePath))
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] Failed to open archive {0} [-]", *filePath.String());
+			return nullptr;
+		}
+
+		const Byte *data = archive->m_File.GetData();
+		uint64 size = archive->m_File.GetSize();
+
+		if (size < sizeof(PakHeader))
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] {0} is not an archive [-]", *filePath.String());
+			return nullptr;
+		}
+
+		const PakHeader *header = (const PakHeader*)data;
+		if (header->Magic != HL_PAK_MAGIC || header->Version != HL_PAK_VERSION)
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] {0} is not an archive or has been written by another version [-]", *filePath.String());
+			return nullptr;
+		}
+
+		// Everything is validated once here, so that the lookups can trust the table of contents
+		bool valid = header->EntryOffset % alignof(PakEntry) == 0
+			&& header->EntryOffset <= size
+			&& header->EntryCount <= (size - header->EntryOffset) / sizeof(PakEntry)
+			&& header->StringOffset <= size
+			&& header->StringTableSize <= size - header->StringOffset
+			&& header->DataOffset <= size;
+
+		const PakEntry *entries = valid ? (const PakEntry*)(data + header->EntryOffset) : nullptr;
+		for (uint32 i = 0; valid && i < header->EntryCount; ++i)
+		{
+			const PakEntry &entry = entries[i];
+			// The uncompressed size is bounded as well, because ReadFile allocates it before the data is decompressed
+			valid = entry.Offset >= header->DataOffset
+				&& entry.Offset <= size
+				&& entry.CompressedSize <= size - entry.Offset
+				&& (uint64)entry.PathOffset + entry.PathLength <= header->StringTableSize
+				&& (entry.Compression == CompressionType::LZ4 || (entry.Compression == CompressionType::None && entry.CompressedSize == entry.Size))
+				&& entry.Size <= Compression::GetMaxDecompressedSize(entry.Compression, entry.CompressedSize)
+				&& (i == 0 || entries[i - 1].PathHash <= entry.PathHash);
+		}
+
+		if (!valid)
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] The table of contents of {0} is corrupted [-]", *filePath.String());
+			return nullptr;
+		}
+
+		archive->m_Header = header;
+		archive->m_Entries = entries;
+		archive->m_Strings = (const char*)(data + header->StringOffset);
+		return archive;
+	}
+
+	int64 PakArchive::GetFileSize(const HLString &path) const
+	{
+		const PakEntry *entry = FindEntry(path);
+		return entry ? (int64)entry->Size : -1;
+	}
+
+	Byte *PakArchive::ReadFile(const HLString &path, int64 *outSize) const
+	{
+		const PakEntry *entry = FindEntry(path);
+		return entry ? ReadEntry(*entry, outSize) : nullptr;
+	}
+
+	Byte *PakArchive::ReadEntry(const PakEntry &entry, int64 *outSize) const
+	{
+		uint64 archiveSize = m_File.GetSize();
+		if (entry.Offset > archiveSize || entry.CompressedSize > archiveSize - entry.Offset
+			|| entry.Size > Compression::GetMaxDecompressedSize(entry.Compression, entry.CompressedSize))
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] The entry at offset {0} is outside of {1} [-]", entry.Offset, *m_FilePath.String());
+			return nullptr;
+		}
+
+		Byte *buffer = new Byte[entry.Size > 0 ? entry.Size : 1];
+		const Byte *source = m_File.GetData() + entry.Offset;
+
+		if (!Compression::Decompress(entry.Compression, source, entry.CompressedSize, buffer, entry.Size))
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] Failed to decompress the entry at offset {0} from {1} [-]", entry.Offset, *m_FilePath.String());
+			delete[] buffer;
+			return nullptr;
+		}
+
+		if (outSize)
+			*outSize = (int64)entry.Size;
+
+		return buffer;
+	}
+
+	const Byte *PakArchive::GetUncompressedView(const HLString &path, uint64 *outSize) const
+	{
+		const PakEntry *entry = FindEntry(path);
+		if (!entry || entry->Compression != CompressionType::None)
+			return nullptr;
+
+		if (outSize)
+			*outSize = entry->Size;
+
+		return m_File.GetData() + entry->Offset;
+	}
+
+	HLString PakArchive::GetEntryPath(uint32 index) const
+	{
+		const PakEntry &entry = m_Entries[index];
+		return HLString(m_Strings + entry.PathOffset, entry.PathLength);
+	}
+
+	HLString PakArchive::NormalizePath(const HLString &path)
+	{
+		std::string result;
+		result.reserve(path.Length());
+
+		uint32 segmentStart = 0;
+		for (uint32 i = 0; i <= path.Length(); ++i)
+		{
+			if (i < path.Length() && path[i] != '/' && path[i] != '\\')
+				continue;
+
+			uint32 segmentLength = i - segmentStart;
+			bool isCurrentDirectory = segmentLength == 1 && path[segmentStart] == '.';
+			if (segmentLength > 0 && !isCurrentDirectory)
+			{
+				if (!result.empty())
+					result += '/';
+
+				result.append(path.C_Str() + segmentStart, segmentLength);
+			}
+
+			segmentStart = i + 1;
+		}
+
+		return HLString(result);
+	}
+
+	uint64 PakArchive::HashPath(const HLString &normalizedPath)
+	{
+		uint64 hash = 14695981039346656037ull;
+		for (uint32 i = 0; i < normalizedPath.Length(); ++i)
+			hash = (hash ^ (Byte)normalizedPath[i]) * 1099511628211ull;
+
+		return hash;
+	}
+
+	const PakEntry *PakArchive::FindEntry(const HLString &path) const
+	{
+		if (!m_Header)
+			return nullptr;
+
+		HLString normalized = NormalizePath(path);
+		uint64 hash = HashPath(normalized);
+
+		const PakEntry *end = m_Entries + m_Header->EntryCount;
+		const PakEntry *entry = std::lower_bound(m_Entries, end, hash, [](const PakEntry &entry, uint64 hash)
+		{
+			return entry.PathHash < hash;
+		});
+
+		// Different paths can share a hash, they are stored next to each other
+		for (; entry != end && entry->PathHash == hash; ++entry)
+		{
+			if (entry->PathLength == normalized.Length() && memcmp(m_Strings + entry->PathOffset, normalized.C_Str(), entry->PathLength) == 0)
+				return entry;
+		}
+
+		return nullptr;
+	}
+
+	void PakWriter::AddFile(const HLString &archivePath, const FileSystemPath &sourcePath)
+	{
+		HLString path = PakArchive::NormalizePath(archivePath);
+		auto it = m_FileIndices.find(path);
+		if (it != m_FileIndices.end())
+		{
+			m_Files[it->second].SourcePath = sourcePath;
+			return;
+		}
+
+		m_FileIndices[path] = (uint32)m_Files.size();
+		m_Files.push_back({ path, sourcePath });
+	}
+
+	uint32 PakWriter::AddDirectory(const FileSystemPath &directory, const HLString &archivePrefix)
+	{
+		uint32 count = 0;
+		std::error_code error;
+		std::filesystem::path root = *directory.String();
+
+		for (const auto &entry : std::filesystem::recursive_directory_iterator(root, error))
+		{
+			std::error_code entryError;
+			if (!entry.is_regular_file(entryError))
+				continue;
+
+			HLString relativePath = entry.path().lexically_relative(root).generic_string();
+			AddFile(archivePrefix.IsEmpty() ? relativePath : archivePrefix + "/" + relativePath, HLString(entry.path().string()));
+			++count;
+		}
+
+		if (error)
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] Failed to read directory {0}: {1} [-]", *directory.String(), error.message());
+
+		return count;
+	}
+
+	bool PakWriter::Write(const FileSystemPath &filePath, const PakWriteOptions &options, PakWriteStats *outStats)
+	{
+		if (!utils::IsPowerOfTwo(options.Alignment) || options.Alignment < alignof(PakEntry))
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] The alignment has to be a power of two of at least {0} [-]", alignof(PakEntry));
+			return false;
+		}
+
+		// The table of contents is sorted by the hash of the paths, the data is written in the same order
+		std::vector<PakEntry> entries(m_Files.size());
+		std::vector<uint32> order(m_Files.size());
+		for (uint32 i = 0; i < (uint32)m_Files.size(); ++i)
+		{
+			entries[i].PathHash = PakArchive::HashPath(m_Files[i].ArchivePath);
+			order[i] = i;
+		}
+
+		std::sort(order.begin(), order.end(), [&](uint32 a, uint32 b)
+		{
+			return entries[a].PathHash < entries[b].PathHash;
+		});
+
+		std::string strings;
+		std::vector<PakEntry> sortedEntries(entries.size());
+		for (uint32 i = 0; i < (uint32)order.size(); ++i)
+		{
+			const HLString &path = m_Files[order[i]].ArchivePath;
+
+			PakEntry &entry = sortedEntries[i];
+			entry.PathHash = entries[order[i]].PathHash;
+			entry.PathOffset = (uint32)strings.size();
+			entry.PathLength = path.Length();
+			strings.append(*path, path.Length());
+		}
+
+		PakHeader header;
+		header.EntryCount = (uint32)sortedEntries.size();
+		header.Alignment = options.Alignment;
+		header.EntryOffset = utils::AlignPakOffset(sizeof(PakHeader), alignof(PakEntry));
+		header.StringOffset = header.EntryOffset + sortedEntries.size() * sizeof(PakEntry);
+		header.StringTableSize = strings.size();
+		header.DataOffset = utils::AlignPakOffset(header.StringOffset + header.StringTableSize, options.Alignment);
+
+		HLString tempName = fmt::format("{0}.{1}.tmp", *filePath.String(), Thread::GetCurrentThreadID());
+		std::ofstream out(*tempName, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out)
+		{
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] Failed to create archive {0} [-]", *filePath.String());
+			return false;
+		}
+
+		// The table of contents is written at the end, when the offsets and sizes of all entries are known
+		std::vector<char> placeholder(header.DataOffset, 0);
+		out.write(placeholder.data(), placeholder.size());
+
+		PakWriteStats stats;
+		stats.EntryCount = header.EntryCount;
+
+		std::vector<Byte> compressed;
+		bool success = true;
+
+		for (uint32 i = 0; success && i < (uint32)order.size(); ++i)
+		{
+			const SourceFile &file = m_Files[order[i]];
+			PakEntry &entry = sortedEntries[i];
+
+			MappedFile source;
+			if (!source.Open(file.SourcePath, MappedFileAccess::Sequential))
+			{
+				HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] Failed to read {0} [-]", *file.SourcePath.String());
+				success = false;
+				break;
+			}
+
+			bool storeUncompressed = options.Compression == CompressionType::None || source.GetSize() == 0;
+			for (const HLString &extension : options.UncompressedExtensions)
+			{
+				if (file.ArchivePath.EndsWith(extension))
+					storeUncompressed = true;
+			}
+
+			const Byte *data = source.GetData();
+			uint64 dataSize = source.GetSize();
+			entry.Size = dataSize;
+			entry.Compression = CompressionType::None;
+
+			if (!storeUncompressed)
+			{
+				compressed.resize(Compression::GetMaxCompressedSize(options.Compression, dataSize));
+				uint64 compressedSize = Compression::Compress(options.Compression, data, dataSize, compressed.data(), compressed.size());
+
+				// Data that does not compress well is stored as it is, so that it can be mapped without decompressing
+				if (compressedSize > 0 && (float)compressedSize <= (float)dataSize * options.MinCompressionRatio)
+				{
+					data = compressed.data();
+					dataSize = compressedSize;
+					entry.Compression = options.Compression;
+					++stats.CompressedEntryCount;
+				}
+			}
+
+			success = utils::WritePadding(out, options.Alignment);
+			entry.Offset = (uint64)out.tellp();
+			entry.CompressedSize = dataSize;
+
+			if (dataSize > 0)
+				out.write((const char*)data, dataSize);
+
+			success = success && out.good();
+			stats.UncompressedSize += entry.Size;
+		}
+
+		if (success)
+		{
+			stats.ArchiveSize = (uint64)out.tellp();
+
+			out.seekp(0);
+			out.write((const char*)&header, sizeof(PakHeader));
+			utils::WritePadding(out, alignof(PakEntry));
+			out.write((const char*)sortedEntries.data(), sortedEntries.size() * sizeof(PakEntry));
+			out.write(strings.data(), strings.size());
+			success = out.good();
+		}
+
+		out.close();
+
+		std::error_code error;
+		if (success)
+		{
+			std::filesystem::rename(*tempName, *filePath.String(), error);
+			success = !error;
+		}
+
+		if (!success)
+		{
+			std::filesystem::remove(*tempName, error);
+			HL_CORE_ERROR(PAK_ARCHIVE_LOG_PREFIX "[-] Failed to write archive {0} [-]", *filePath.String());
+			return false;
+		}
+
+		if (outStats)
+			*outStats = stats;
+
+		HL_CORE_INFO(PAK_ARCHIVE_LOG_PREFIX "[+] Wrote {0} entries ({1} compressed) into {2}, {3} KB of {4} KB [+]",
+			stats.EntryCount, stats.CompressedEntryCount, *filePath.String(), stats.ArchiveSize / 1024, stats.UncompressedSize / 1024);
+		return true;
+	}
+}
+
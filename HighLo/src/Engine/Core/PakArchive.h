@@ -0,0 +1,187 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added ReadEntry and bounded the sizes of the entries
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/SharedReference.h"
+#include "Engine/Core/MappedFile.h"
+#include "Engine/Core/Compression.h"
+
+#define HL_PAK_MAGIC 0x4B41504C // "LPAK"
+#define HL_PAK_VERSION 1
+#define HL_PAK_EXTENSION ".hlpak"
+#define HL_PAK_DEFAULT_ALIGNMENT 16
+
+namespace highlo
+{
+	/// <summary>
+	/// The header at the beginning of an archive, all offsets are relative to the beginning of the file.
+	/// </summary>
+	struct PakHeader
+	{
+		uint32 Magic = HL_PAK_MAGIC;
+		uint32 Version = HL_PAK_VERSION;
+		uint32 EntryCount = 0;
+		uint32 Alignment = HL_PAK_DEFAULT_ALIGNMENT;
+
+		uint64 EntryOffset = 0;
+		uint64 StringOffset = 0;
+		uint64 StringTableSize = 0;
+		uint64 DataOffset = 0;
+	};
+
+	/// <summary>
+	/// An entry of the table of contents. The entries are sorted by the hash of their path, so that they can be found with a binary search
+	/// right in the mapped file, without building a lookup table when the archive is opened.
+	/// </summary>
+	struct PakEntry
+	{
+		uint64 PathHash = 0;
+		uint64 Offset = 0;
+		uint64 CompressedSize = 0;
+		uint64 Size = 0;
+		uint32 PathOffset = 0;
+		uint32 PathLength = 0;
+		CompressionType Compression = CompressionType::None;
+		uint32 Padding = 0;
+	};
+
+	/// <summary>
+	/// A read-only archive, that contains many files in a single mapped file.
+	/// Uncompressed entries are aligned and can be used right from the mapping, compressed entries are decompressed into a new buffer.
+	/// All functions can be called from any thread.
+	/// </summary>
+	class PakArchive : public IsSharedReference
+	{
+	public:
+
+		HLAPI PakArchive() = default;
+		HLAPI ~PakArchive() = default;
+
+		/// <summary>
+		/// Maps the archive and validates its table of contents.
+		/// </summary>
+		/// <returns>Returns nullptr, if the file is not a valid archive.</returns>
+		HLAPI static Ref<PakArchive> Open(const FileSystemPath &filePath);
+
+		HLAPI bool Contains(const HLString &path) const { return FindEntry(path) != nullptr; }
+
+		/// <summary>
+		/// Returns the entry of the path in the table of contents or nullptr, if the archive does not contain the path.
+		/// </summary>
+		HLAPI const PakEntry *FindEntry(const HLString &path) const;
+
+		/// <summary>
+		/// Returns the uncompressed size of the entry or -1, if the archive does not contain the path.
+		/// </summary>
+		HLAPI int64 GetFileSize(const HLString &path) const;
+
+		/// <summary>
+		/// Returns the content of the entry in a new buffer, which has to be deleted by the caller, the same way as FileSystem::ReadFile.
+		/// </summary>
+		HLAPI Byte *ReadFile(const HLString &path, int64 *outSize) const;
+
+		/// <summary>
+		/// Same as ReadFile for an entry, that has already been found with FindEntry.
+		/// </summary>
+		HLAPI Byte *ReadEntry(const PakEntry &entry, int64 *outSize) const;
+
+		/// <summary>
+		/// Returns a pointer into the mapping of the archive without copying, which is only possible for uncompressed entries.
+		/// The pointer is valid as long as the archive exists.
+		/// </summary>
+		HLAPI const Byte *GetUncompressedView(const HLString &path, uint64 *outSize) const;
+
+		HLAPI uint32 GetEntryCount() const { return m_Header ? m_Header->EntryCount : 0; }
+		HLAPI const PakEntry &GetEntry(uint32 index) const { return m_Entries[index]; }
+		HLAPI HLString GetEntryPath(uint32 index) const;
+		HLAPI const FileSystemPath &GetFilePath() const { return m_FilePath; }
+		HLAPI uint64 GetArchiveSize() const { return m_File.GetSize(); }
+
+		/// <summary>
+		/// Converts the path into the form, in which the paths are stored: relative, with forward slashes and without "./".
+		/// </summary>
+		HLAPI static HLString NormalizePath(const HLString &path);
+		HLAPI static uint64 HashPath(const HLString &normalizedPath);
+
+	private:
+
+		FileSystemPath m_FilePath;
+		MappedFile m_File;
+		const PakHeader *m_Header = nullptr;
+		const PakEntry *m_Entries = nullptr;
+		const char *m_Strings = nullptr;
+	};
+
+	struct PakWriteOptions
+	{
+		CompressionType Compression = CompressionType::LZ4;
+
+		/// <summary>
+		/// The alignment of every entry in the archive, entries that should be mapped by the GPU upload path can require larger alignments.
+		/// </summary>
+		uint32 Alignment = HL_PAK_DEFAULT_ALIGNMENT;
+
+		/// <summary>
+		/// Entries are stored uncompressed, if compression does not shrink them at least to this fraction,
+		/// so that already compressed formats like png can be used right from the mapping.
+		/// </summary>
+		float MinCompressionRatio = 0.9f;
+
+		/// <summary>
+		/// Files with these extensions (including the dot) are always stored uncompressed, so that they can be mapped.
+		/// </summary>
+		std::vector<HLString> UncompressedExtensions;
+	};
+
+	struct PakWriteStats
+	{
+		uint32 EntryCount = 0;
+		uint32 CompressedEntryCount = 0;
+		uint64 UncompressedSize = 0;
+		uint64 ArchiveSize = 0;
+	};
+
+	/// <summary>
+	/// Collects files and writes them into an archive.
+	/// </summary>
+	class PakWriter
+	{
+	public:
+
+		/// <summary>
+		/// Adds a file, which is stored under the given path inside the archive. An existing entry with the same path is replaced.
+		/// </summary>
+		HLAPI void AddFile(const HLString &archivePath, const FileSystemPath &sourcePath);
+
+		/// <summary>
+		/// Adds all files in the directory and its sub directories, the paths inside the archive are relative to the directory.
+		/// </summary>
+		HLAPI uint32 AddDirectory(const FileSystemPath &directory, const HLString &archivePrefix = "");
+
+		HLAPI uint32 GetFileCount() const { return (uint32)m_Files.size(); }
+
+		/// <summary>
+		/// Reads all added files and writes the archive, the file is replaced only if it has been written completely.
+		/// </summary>
+		HLAPI bool Write(const FileSystemPath &filePath, const PakWriteOptions &options = PakWriteOptions(), PakWriteStats *outStats = nullptr);
+
+	private:
+
+		struct SourceFile
+		{
+			HLString ArchivePath;
+			FileSystemPath SourcePath;
+		};
+
+		std::vector<SourceFile> m_Files;
+		std::unordered_map<HLString, uint32> m_FileIndices;
+	};
+}
+
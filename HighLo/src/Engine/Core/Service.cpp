@@ -25,8 +25,9 @@ namespace highlo
 	void Service::Sort()
 	{
 		auto &services = GetServices();
+		// Stable, so that services with the same order are initialized in the order they have been registered
 		if (!services.empty())
-			Sorting::QuickSort(&services[0], (int32)services.size(), &utils::CompareServices);
+			Sorting::MergeSort(&services[0], (int32)services.size(), &utils::CompareServices);
 	}
 
 	bool Service::Init()
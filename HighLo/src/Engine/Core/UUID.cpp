@@ -3,21 +3,104 @@
 #include "HighLoPch.h"
 #include "UUID.h"
 
+#include <atomic>
+#include <chrono>
 #include <random>
 
+// 2021-01-01 00:00:00 UTC, 42 bits of milliseconds reach until the year 2160
+#define UUID_TIME_EPOCH_MS 1609459200000ull
+#define UUID_SEQUENCE_BITS 22
+
+// Each millisecond starts its sequence below 2^12, so the remaining 2^22 - 2^12 UUIDs of the millisecond never run into the next one
+#define UUID_SEQUENCE_START_BITS 12
+
 namespace highlo
 {
-	static std::random_device s_UUID_RandomDevice;
+	namespace utils
+	{
+		static uint64 SplitMix64(uint64 &state)
+		{
+			state += 0x9E3779B97F4A7C15ull;
+			return MixUUID(state);
+		}
+
+		static HL_FORCE_INLINE uint64 RotateLeft(uint64 value, int32 bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		/// <summary>
+		/// xoshiro256**, a small and fast generator with a period of 2^256 - 1.
+		/// </summary>
+		struct UUIDGenerator
+		{
+			uint64 State[4];
+
+			UUIDGenerator()
+			{
+				// The random device is slow, but it only seeds the generator once per thread.
+				// The address and the time separate the threads on platforms, where the random device is deterministic.
+				std::random_device device;
+				uint64 seed = ((uint64)device() << 32) ^ (uint64)device();
+				seed ^= (uint64)(uintptr_t)this;
+				seed ^= (uint64)std::chrono::high_resolution_clock::now().time_since_epoch().count() * 0x9E3779B97F4A7C15ull;
 
-	static std::mt19937_64 s_UUID_eng(s_UUID_RandomDevice());
-	static std::uniform_int_distribution<uint64> s_UUID_UniformDistribution;
+				for (uint32 i = 0; i < 4; ++i)
+					State[i] = SplitMix64(seed);
+			}
 
-	static std::mt19937 s_UUID_eng32(s_UUID_RandomDevice());
-	static std::uniform_int_distribution<uint32> s_UUID_UniformDistribution32;
+			uint64 Next()
+			{
+				const uint64 result = RotateLeft(State[1] * 5, 7) * 9;
+				const uint64 t = State[1] << 17;
+
+				State[2] ^= State[0];
+				State[3] ^= State[1];
+				State[1] ^= State[2];
+				State[0] ^= State[3];
+				State[2] ^= t;
+				State[3] = RotateLeft(State[3], 45);
+
+				return result;
+			}
+		};
+
+		static UUIDGenerator &GetThreadUUIDGenerator()
+		{
+			static thread_local UUIDGenerator s_Generator;
+			return s_Generator;
+		}
+	}
+
+	static std::atomic<UUIDGenerationMode> s_UUIDGenerationMode(UUIDGenerationMode::Random);
+	static std::atomic<uint64> s_LastTimeOrderedUUID(0);
+
+	static uint64 GenerateTimeOrderedUUID()
+	{
+		uint64 milliseconds = (uint64)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		uint64 timestamp = (milliseconds - UUID_TIME_EPOCH_MS) << UUID_SEQUENCE_BITS;
+
+		// A new millisecond restarts the sequence at a small random value, so that two sessions, which create UUIDs in the same millisecond, most likely do not collide.
+		// Within the same millisecond, after a sequence overflow or when the clock went backwards, the last UUID is incremented instead,
+		// which carries into the timestamp bits, so the UUIDs keep increasing and never repeat.
+		uint64 start = timestamp | (utils::GetThreadUUIDGenerator().Next() >> (64 - UUID_SEQUENCE_START_BITS));
+		uint64 last = s_LastTimeOrderedUUID.load(std::memory_order_relaxed);
+		uint64 next;
+		do
+		{
+			next = (timestamp > (last & ~((1ull << UUID_SEQUENCE_BITS) - 1))) ? start : last + 1;
+		}
+		while (!s_LastTimeOrderedUUID.compare_exchange_weak(last, next, std::memory_order_relaxed));
+
+		return next;
+	}
 
 	UUID::UUID()
-		: m_UUID(s_UUID_UniformDistribution(s_UUID_eng))
 	{
+		if (s_UUIDGenerationMode.load(std::memory_order_relaxed) == UUIDGenerationMode::TimeOrdered)
+			m_UUID = GenerateTimeOrderedUUID();
+		else
+			m_UUID = utils::GetThreadUUIDGenerator().Next();
 	}
 
 	UUID::UUID(uint64 uuid)
@@ -30,8 +113,18 @@ namespace highlo
 	{
 	}
 
+	void UUID::SetGenerationMode(UUIDGenerationMode mode)
+	{
+		s_UUIDGenerationMode.store(mode, std::memory_order_relaxed);
+	}
+
+	UUIDGenerationMode UUID::GetGenerationMode()
+	{
+		return s_UUIDGenerationMode.load(std::memory_order_relaxed);
+	}
+
 	UUID32::UUID32()
-		: m_UUID(s_UUID_UniformDistribution32(s_UUID_eng32))
+		: m_UUID((uint32)(utils::GetThreadUUIDGenerator().Next() >> 32))
 	{
 	}
 	
@@ -45,4 +138,3 @@ namespace highlo
 	{
 	}
 }
-
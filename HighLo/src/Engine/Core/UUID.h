@@ -2,17 +2,40 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Restarted the time-ordered sequence every millisecond and kept time-ordered UUIDs increasing on overflow and clock changes
+//     - 1.2 (2026-10-19) Generated UUIDs with a generator per thread, added time-ordered UUIDs and mixed the hash
+//     - 1.1 (2026-10-19) Declared UUIDs as trivially relocatable
 //     - 1.0 (2021-09-14) initial release
 //
 
 #pragma once
 
+#include "Engine/Core/DataTypes/Relocatable.h"
+
 namespace highlo
 {
+	enum class UUIDGenerationMode
+	{
+		/// <summary>
+		/// Every bit is random, the default for everything, that is shared between projects or machines.
+		/// </summary>
+		Random = 0,
+
+		/// <summary>
+		/// The upper 42 bits are the milliseconds since 2021-01-01, the lower 22 bits count up from a small random start in every millisecond.
+		/// If the sequence overflows or the clock goes backwards, the timestamp is advanced instead, so every UUID is greater than the one before.
+		/// New UUIDs sort after older ones, so registries and serialized scenes keep the creation order and produce small diffs.
+		/// </summary>
+		TimeOrdered
+	};
+
 	class UUID
 	{
 	public:
 
+		/// <summary>
+		/// Generates a new UUID. Every thread uses its own generator, so UUIDs can be created from jobs without locking.
+		/// </summary>
 		HLAPI UUID();
 		HLAPI UUID(uint64 uuid);
 		HLAPI UUID(const UUID &other);
@@ -20,6 +43,12 @@ namespace highlo
 		HLAPI operator uint64() { return m_UUID; }
 		HLAPI operator const uint64() const { return m_UUID; }
 
+		/// <summary>
+		/// Changes how new UUIDs are generated on all threads.
+		/// </summary>
+		HLAPI static void SetGenerationMode(UUIDGenerationMode mode);
+		HLAPI static UUIDGenerationMode GetGenerationMode();
+
 	private:
 
 		uint64 m_UUID;
@@ -40,8 +69,35 @@ namespace highlo
 
 		uint32 m_UUID;
 	};
+
+	namespace utils
+	{
+		/// <summary>
+		/// Spreads every bit of the UUID over the whole hash (the finalizer of SplitMix64).
+		/// Time-ordered UUIDs only differ in a few bits, without the mixing they would share the buckets of hash tables.
+		/// </summary>
+		inline constexpr uint64 MixUUID(uint64 uuid)
+		{
+			uuid = (uuid ^ (uuid >> 30)) * 0xBF58476D1CE4E5B9ull;
+			uuid = (uuid ^ (uuid >> 27)) * 0x94D049BB133111EBull;
+			return uuid ^ (uuid >> 31);
+		}
+
+		/// <summary>
+		/// The finalizer of MurmurHash3 for 32-bit UUIDs.
+		/// </summary>
+		inline constexpr uint32 MixUUID32(uint32 uuid)
+		{
+			uuid = (uuid ^ (uuid >> 16)) * 0x85EBCA6Bu;
+			uuid = (uuid ^ (uuid >> 13)) * 0xC2B2AE35u;
+			return uuid ^ (uuid >> 16);
+		}
+	}
 }
 
+HL_DECLARE_TRIVIALLY_RELOCATABLE(highlo::UUID)
+HL_DECLARE_TRIVIALLY_RELOCATABLE(highlo::UUID32)
+
 namespace std
 {
 	template<>
@@ -49,7 +105,7 @@ namespace std
 	{
 		std::size_t operator()(const highlo::UUID &uuid) const
 		{
-			return hash<uint64_t>()((uint64_t)uuid);
+			return (std::size_t)highlo::utils::MixUUID((uint64)uuid);
 		}
 	};
 
@@ -58,7 +114,7 @@ namespace std
 	{
 		std::size_t operator()(const highlo::UUID32 &uuid) const
 		{
-			return hash<uint32>()((uint32)uuid);
+			return (std::size_t)highlo::utils::MixUUID32((uint32)uuid);
 		}
 	};
 }
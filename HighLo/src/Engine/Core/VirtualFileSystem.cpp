@@ -21,9 +21,21 @@ namespace highlo
 		}
 		}
 
+	bool VirtualFileSystem::MountArchive(const HLString &virtualPath, const FileSystemPath &archivePath)
+	{
+		Ref<PakArchive> archive = PakArchive::Open(archivePath);
+		if (!archive)
+			return false;
+
+		m_ArchiveMounts[virtualPath].push_back(archive);
+		return true;
+	}
+
 	void VirtualFileSystem::Unmount(const HLString &path)
 	{
 		m_MountPoints[path].clear();
+
+		m_ArchiveMounts.erase(path);
 	}
 
 	bool VirtualFileSystem::ResolvePhysicalPath(HLString &path, HLString &outPath)
@@ -60,16 +72,77 @@ namespace highlo
 
 	Byte *VirtualFileSystem::ReadFile(const HLString &path, int64 *outSize)
 	{
+		const PakEntry *entry = nullptr;
+		if (Ref<PakArchive> archive = FindArchive(path, entry))
+			return archive->ReadEntry(*entry, outSize);
+
 		HLString physicalPath;
 		return ResolvePhysicalPath(HLString(path), physicalPath) ? FileSystem::Get()->ReadFile(physicalPath, outSize) : nullptr;
 	}
 
 	HLString VirtualFileSystem::ReadTextFile(const HLString &path)
 	{
+		const PakEntry *entry = nullptr;
+		if (Ref<PakArchive> archive = FindArchive(path, entry))
+		{
+			int64 size = 0;
+			Byte *data = archive->ReadEntry(*entry, &size);
+			if (!data)
+				return HLString();
+
+			HLString text((const char*)data, (uint32)size);
+			delete[] data;
+			return text;
+		}
+
 		HLString physicalPath;
 		return ResolvePhysicalPath(HLString(path), physicalPath) ? FileSystem::Get()->ReadTextFile(physicalPath) : HLString();
 	}
 
+	Ref<AsyncIORequest> VirtualFileSystem::ReadFileAsync(const HLString &path, const AsyncIOCallback &callback, AsyncIOPriority priority)
+	{
+		const PakEntry *pakEntry = nullptr;
+		if (Ref<PakArchive> archive = FindArchive(path, pakEntry))
+		{
+			// The entry is copied, because the callback runs after the archive might have been unmounted
+			PakEntry entry = *pakEntry;
+
+			// A size of 0 would read the rest of the archive, so empty entries read from the end of the archive instead
+			uint64 offset = entry.Size > 0 ? entry.Offset : archive->GetArchiveSize();
+			return AsyncFileIO::Get()->Read(archive->GetFilePath(), [archive, entry, callback](AsyncIORequest &request)
+			{
+				if (request.Succeeded() && entry.Compression != CompressionType::None)
+				{
+					Allocator decompressed;
+					decompressed.Allocate((uint32)entry.Size);
+
+					if (!Compression::Decompress(entry.Compression, request.Buffer.Data, request.Buffer.Size, decompressed.Data, entry.Size))
+					{
+						decompressed.Release();
+						request.State = AsyncIOState::Failed;
+					}
+
+					request.Buffer.Release();
+					request.Buffer = decompressed;
+				}
+
+				if (callback)
+					callback(request);
+			}, priority, offset, entry.CompressedSize);
+		}
+
+		// Paths that can't be resolved are still submitted, so that the callback reports the failure like for every other request
+		HLString physicalPath;
+		ResolvePhysicalPath(HLString(path), physicalPath);
+		return AsyncFileIO::Get()->Read(physicalPath, callback, priority);
+	}
+
+	bool VirtualFileSystem::MapFile(const HLString &path, MappedFile &outFile, MappedFileAccess access)
+	{
+		HLString physicalPath;
+		return ResolvePhysicalPath(HLString(path), physicalPath) ? outFile.Open(physicalPath, access) : false;
+	}
+
 	bool VirtualFileSystem::WriteFile(const HLString &path, Byte *buffer, int64 size)
 	{
 		HLString physicalPath;
@@ -90,12 +163,20 @@ namespace highlo
 
 	int64 VirtualFileSystem::GetFileSize(const HLString &path)
 	{
+		const PakEntry *entry = nullptr;
+		if (FindArchive(path, entry))
+			return (int64)entry->Size;
+
 		HLString physicalPath;
 		return ResolvePhysicalPath(HLString(path), physicalPath) ? FileSystem::Get()->GetFileSize(physicalPath) : -1;
 	}
 
 	bool VirtualFileSystem::FileExists(const HLString &path)
 	{
+		const PakEntry *entry = nullptr;
+		if (FindArchive(path, entry))
+			return true;
+
 		HLString physicalPath;
 		return ResolvePhysicalPath(HLString(path), physicalPath) ? FileSystem::Get()->FileExists(physicalPath) : false;
 	}
@@ -135,4 +216,33 @@ namespace highlo
 		ResolvePhysicalPath(p, physicalPath);
 		return physicalPath;
 	}
+
+	Ref<PakArchive> VirtualFileSystem::FindArchive(const HLString &path, const PakEntry *&outEntry)
+	{
+		if (path.IsEmpty() || path[0] != '/' || m_ArchiveMounts.empty())
+			return nullptr;
+
+		// Unlike the physical mount points, the whole remaining path is used, because archives keep their directory structure
+		std::string virtualPath = *path + 1;
+		size_t separator = virtualPath.find('/');
+		if (separator == std::string::npos)
+			return nullptr;
+
+		auto it = m_ArchiveMounts.find(HLString(virtualPath.substr(0, separator)));
+		if (it == m_ArchiveMounts.end())
+			return nullptr;
+
+		// The entry is handed out, so that the callers don't have to search the table of contents a second time
+		HLString entryPath = virtualPath.substr(separator + 1);
+		for (const Ref<PakArchive> &archive : it->second)
+		{
+			if (const PakEntry *entry = archive->FindEntry(entryPath))
+			{
+				outEntry = entry;
+				return archive;
+			}
+		}
+
+		return nullptr;
+	}
 }
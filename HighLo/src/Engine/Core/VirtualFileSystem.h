@@ -2,6 +2,9 @@
 
 //
 // version history:
+//     - 1.4 (2026-10-19) Added ReadFileAsync
+//     - 1.3 (2026-10-19) Added archive mounts
+//     - 1.2 (2026-10-19) Added MapFile
 //     - 1.1 (2021-10-17) Refactored VirtualFileSystem to be a Singleton class
 //     - 1.0 (2021-09-14) initial release
 //
@@ -11,6 +14,9 @@
 #include "Engine/Core/Core.h"
 #include "Engine/Core/DataTypes/Hashmap.h"
 #include "Engine/Core/DataTypes/String.h"
+#include "Engine/Core/MappedFile.h"
+#include "Engine/Core/PakArchive.h"
+#include "Engine/Core/AsyncFileIO.h"
 
 namespace highlo
 {
@@ -19,12 +25,32 @@ namespace highlo
 	public:
 
 		HLAPI void Mount(const HLString &virtualPath, const HLString &physicalPath);
+
+		/// <summary>
+		/// Mounts the content of an archive, the paths inside of the archive are relative to the virtual path.
+		/// Archives are searched before the physical directories of the same virtual path, in the order in which they have been mounted.
+		/// </summary>
+		HLAPI bool MountArchive(const HLString &virtualPath, const FileSystemPath &archivePath);
+
+		/// <summary>
+		/// Removes all physical directories and archives of the virtual path.
+		/// </summary>
 		HLAPI void Unmount(const HLString &path);
 
 		HLAPI bool ResolvePhysicalPath(HLString &path, HLString &outPath);
 
 		HLAPI Byte *ReadFile(const HLString &path, int64 *outSize);
 		HLAPI HLString ReadTextFile(const HLString &path);
+
+		/// <summary>
+		/// Reads the file through the AsyncFileIO service, entries of archives are decompressed before the callback is executed.
+		/// </summary>
+		HLAPI Ref<AsyncIORequest> ReadFileAsync(const HLString &path, const AsyncIOCallback &callback, AsyncIOPriority priority = AsyncIOPriority::Normal);
+
+		/// <summary>
+		/// Maps the file read-only into memory instead of copying its content into a new buffer.
+		/// </summary>
+		HLAPI bool MapFile(const HLString &path, MappedFile &outFile, MappedFileAccess access = MappedFileAccess::Normal);
 		
 		HLAPI bool WriteFile(const HLString &path, Byte *buffer, int64 size);
 		HLAPI bool WriteTextFile(const HLString &path, const HLString &text);
@@ -45,6 +71,13 @@ namespace highlo
 
 	private:
 
+		/// <summary>
+		/// Finds the archive that contains the virtual path, outEntry receives its entry, which stays valid as long as the archive exists.
+		/// </summary>
+		Ref<PakArchive> FindArchive(const HLString &path, const PakEntry *&outEntry);
+
 		HLHashmap<HLString, std::vector<HLString>> m_MountPoints;
+		// Looked up for every file access, possibly from worker threads, so it must not copy its values on access like HLHashmap
+		std::unordered_map<HLString, std::vector<Ref<PakArchive>>> m_ArchiveMounts;
 	};
 }
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.4 (2026-10-19) Store the children of the RelationshipComponent in a HLSmallVector
 //     - 1.3 (2022-09-03) Added Script component
 //     - 1.2 (2021-09-19) Added Prefab Component
 //     - 1.1 (2021-09-15) Changed ID Types to UUID, Removed TagComponent
@@ -16,6 +17,7 @@
 #include "Engine/Graphics/MaterialTable.h"
 #include "Engine/Camera/Camera.h"
 #include "Engine/Core/UUID.h"
+#include "Engine/Core/DataTypes/Vector.h"
 #include "Engine/Scripting/ScriptType.h"
 
 namespace highlo
@@ -23,7 +25,9 @@ namespace highlo
 	struct RelationshipComponent
 	{
 		UUID ParentHandle = 0;
-		std::vector<UUID> Children;
+
+		// Most entities only have a few children, they are stored inside of the component without an allocation
+		HLSmallVector<UUID, 4> Children;
 	};
 
 	struct PrefabComponent
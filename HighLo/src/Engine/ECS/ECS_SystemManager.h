@@ -2,12 +2,14 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Stored the named systems in a HLFlatMap
 //     - 1.0 (2021-09-14) initial release
 //
 
 #pragma once
 
 #include "ISystemBase.h"
+#include "Engine/Core/DataTypes/FlatMap.h"
 
 namespace highlo
 {
@@ -24,15 +26,15 @@ namespace highlo
 			m_Systems.push_back(instance);
 
 			if (!name.IsEmpty())
-				m_SystemMappings[name] = instance;
+				m_SystemMappings.InsertOrAssign(name, instance);
 		}
 
 		HLAPI Ref<ISystemBase> GetSystem(const HLString &name)
 		{
-			if (m_SystemMappings.find(name) != m_SystemMappings.end())
-				return m_SystemMappings[name];
-			else
-				return nullptr;
+			if (Ref<ISystemBase> *system = m_SystemMappings.TryGet(name))
+				return *system;
+
+			return nullptr;
 		}
 
 		HLAPI void Update(Timestep ts);
@@ -40,7 +42,7 @@ namespace highlo
 
 	private:
 
-		std::map<HLString, Ref<ISystemBase>> m_SystemMappings;
+		HLFlatMap<HLString, Ref<ISystemBase>> m_SystemMappings;
 		std::vector<Ref<ISystemBase>> m_Systems;
 	};
 }
@@ -50,10 +50,10 @@ namespace highlo
 	void Entity::SetParent(Entity other)
 	{
 		SetParentUUID(other.GetUUID());
-		other.Children().emplace_back(GetUUID());
+		other.Children().EmplaceBack(GetUUID());
 	}
 
-	std::vector<UUID> &Entity::Children()
+	HLSmallVector<UUID, 4> &Entity::Children()
 	{
 		if (HasComponent<RelationshipComponent>())
 			return GetComponent<RelationshipComponent>()->Children;
@@ -61,7 +61,7 @@ namespace highlo
 			return AddComponent<RelationshipComponent>()->Children;
 	}
 
-	const std::vector<UUID> &Entity::Children() const
+	const HLSmallVector<UUID, 4> &Entity::Children() const
 	{
 		return GetComponent<RelationshipComponent>()->Children;
 	}
@@ -94,24 +94,14 @@ namespace highlo
 
 	bool Entity::RemoveChild(Entity child)
 	{
-		UUID childId = child.GetUUID();
-		auto &children = Children();
-
-		auto it = std::find(children.begin(), children.end(), childId);
-		if (it != children.end())
-		{
-			children.erase(it);
-			return true;
-		}
-
-		return false;
+		return Children().RemoveValue(child.GetUUID());
 	}
 
 	bool Entity::IsAncesterOf(Entity other)
 	{
 		const auto &children = Children();
 
-		if (children.size() == 0)
+		if (children.IsEmpty())
 			return false;
 
 		for (UUID child : children)
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Children are returned as HLSmallVector
 //     - 1.1 (2021-11-10) big refactoring to support child entities and parents
 //     - 1.0 (2021-09-14) initial release
 //
@@ -10,6 +11,7 @@
 
 #include "Engine/Core/Core.h"
 #include "Engine/Core/DataTypes/String.h"
+#include "Engine/Core/DataTypes/Vector.h"
 #include "ECS_Registry.h"
 #include "Engine/Math/Transform.h"
 
@@ -88,8 +90,8 @@ namespace highlo
 		HLAPI const HLString &Tag() const { return m_Tag; }
 
 		HLAPI void SetParent(Entity other);
-		HLAPI std::vector<UUID> &Children();
-		HLAPI const std::vector<UUID> &Children() const;
+		HLAPI HLSmallVector<UUID, 4> &Children();
+		HLAPI const HLSmallVector<UUID, 4> &Children() const;
 
 		HLAPI void SetParentUUID(UUID uuid);
 		HLAPI UUID GetParentUUID() const;
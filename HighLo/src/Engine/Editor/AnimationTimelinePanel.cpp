@@ -80,7 +80,7 @@ namespace highlo
 		{
 
 		}
-		UI::DrawHelpMarker(translation->GetText("animation-timeline-begin-btn-tooltip"), false);
+		UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-begin-btn-tooltip")), false);
 		ImGui::SameLine();
 
 		ImGui::SetCursorPosX(1650);
@@ -88,7 +88,7 @@ namespace highlo
 		{
 
 		}
-		UI::DrawHelpMarker(translation->GetText("animation-timeline-prev-frame-btn-tooltip"), false);
+		UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-prev-frame-btn-tooltip")), false);
 		ImGui::SameLine();
 
 		if (m_AnimPlaying)
@@ -100,7 +100,7 @@ namespace highlo
 				m_AnimPlaying = false;
 			}
 			ImGui::PopStyleColor();
-			UI::DrawHelpMarker(translation->GetText("animation-timeline-pause-btn-tooltip"), false);
+			UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-pause-btn-tooltip")), false);
 			ImGui::SameLine();
 		}
 		else
@@ -112,7 +112,7 @@ namespace highlo
 				m_AnimPlaying = true;
 			}
 			ImGui::PopStyleColor();
-			UI::DrawHelpMarker(translation->GetText("animation-timeline-play-btn-tooltip"), false);
+			UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-play-btn-tooltip")), false);
 			ImGui::SameLine();
 		}
 
@@ -120,7 +120,7 @@ namespace highlo
 		{
 
 		}
-		UI::DrawHelpMarker(translation->GetText("animation-timeline-next-frame-btn-tooltip"), false);
+		UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-next-frame-btn-tooltip")), false);
 		ImGui::SameLine();
 
 		ImGui::SetCursorPosX(1775);
@@ -128,7 +128,7 @@ namespace highlo
 		{
 			// Skip the animation to the end of the animation
 		}
-		UI::DrawHelpMarker(translation->GetText("animation-timeline-end-btn-tooltip"), false);
+		UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-end-btn-tooltip")), false);
 		ImGui::SameLine();
 
 		ImGui::PushStyleColor(ImGuiCol_Text, { 1.0f, 0.0f, 0.0f, 1.0f });
@@ -138,7 +138,7 @@ namespace highlo
 			// Create a new keyframe
 		}
 		ImGui::PopStyleColor();
-		UI::DrawHelpMarker(translation->GetText("animation-timeline-keyframe-btn-tooltip"), false);
+		UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-keyframe-btn-tooltip")), false);
 		ImGui::SameLine();
 
 		ImGui::PushStyleColor(ImGuiCol_Text, { 1.0f, 0.0f, 0.0f, 1.0f });
@@ -147,7 +147,7 @@ namespace highlo
 			// auto-keying is activated, so now every time a model has been transformed a new keyframe should be created at the current timeline position
 		}
 		ImGui::PopStyleColor();
-		UI::DrawHelpMarker(translation->GetText("animation-timeline-autokeying-btn-tooltip"), false);
+		UI::DrawHelpMarker(translation->GetText(HL_NAME("animation-timeline-autokeying-btn-tooltip")), false);
 
 		ImGui::End();
 	}
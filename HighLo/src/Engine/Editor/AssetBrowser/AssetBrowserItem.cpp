@@ -320,19 +320,19 @@ namespace highlo
 	{
 		Translation *translation = HLApplication::Get().GetActiveTranslation();
 
-		if (ImGui::MenuItem((HLString(ICON_FA_SYNC_ALT) + " " + translation->GetText("asset-browser-item-reload")).C_Str()))
+		if (ImGui::MenuItem((HLString(ICON_FA_SYNC_ALT) + " " + translation->GetText(HL_NAME("asset-browser-item-reload"))).C_Str()))
 			actionResult.Set(AssetBrowserAction::Reload);
 
-		if (ImGui::MenuItem((HLString(ICON_FA_EDIT) + " " + translation->GetText("asset-browser-item-rename")).C_Str()))
+		if (ImGui::MenuItem((HLString(ICON_FA_EDIT) + " " + translation->GetText(HL_NAME("asset-browser-item-rename"))).C_Str()))
 			actionResult.Set(AssetBrowserAction::StartRenaming);
 
-		if (ImGui::MenuItem((HLString(ICON_FA_COPY) + " " + translation->GetText("asset-browser-item-copy")).C_Str()))
+		if (ImGui::MenuItem((HLString(ICON_FA_COPY) + " " + translation->GetText(HL_NAME("asset-browser-item-copy"))).C_Str()))
 			actionResult.Set(AssetBrowserAction::Copy);
 
-		if (ImGui::MenuItem((HLString(ICON_FA_TRASH_ALT) + " " + translation->GetText("asset-browser-item-delete")).C_Str()))
+		if (ImGui::MenuItem((HLString(ICON_FA_TRASH_ALT) + " " + translation->GetText(HL_NAME("asset-browser-item-delete"))).C_Str()))
 			actionResult.Set(AssetBrowserAction::OpenDeleteDialogue);
 
-		if (ImGui::MenuItem((HLString(ICON_FA_EXTERNAL_LINK_ALT) + " " + translation->GetText("asset-browser-item-explorer")).C_Str()))
+		if (ImGui::MenuItem((HLString(ICON_FA_EXTERNAL_LINK_ALT) + " " + translation->GetText(HL_NAME("asset-browser-item-explorer"))).C_Str()))
 			actionResult.Set(AssetBrowserAction::ShowInExplorer);
 
 		ImGui::Separator();
@@ -472,9 +472,7 @@ namespace highlo
 			return false;
 		}
 
-		// TODO: this could be optimized, but should work for now
-		FileSystemPath destReplacer = dest;
-		AssetManager::OnAssetMoved(m_AssetInfo.Handle, destReplacer);
+		AssetManager::OnAssetMoved(m_AssetInfo.Handle, Project::GetActive()->GetAssetDirectory() / dest);
 		return true;
 	}
 
@@ -111,7 +111,7 @@ namespace highlo
 
 				ImGui::BeginChild("##folders_common");
 				{
-					if (ImGui::CollapsingHeader(translation->GetText("asset-browser-content-headline"), nullptr, ImGuiTreeNodeFlags_DefaultOpen))
+					if (ImGui::CollapsingHeader(translation->GetText(HL_NAME("asset-browser-content-headline")), nullptr, ImGuiTreeNodeFlags_DefaultOpen))
 					{
 						UI::ScopedStyle spacing(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 0.0f));
 						UI::ScopedColorStack itemBg(ImGuiCol_Header, IM_COL32_DISABLE, ImGuiCol_HeaderActive, IM_COL32_DISABLE);
@@ -150,9 +150,9 @@ namespace highlo
 						ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4.0f, 4.0f));
 						if (ImGui::BeginPopupContextWindow(0, 1, false))
 						{
-							if (ImGui::BeginMenu((HLString(ICON_FA_PLUS) + " " + translation->GetText("asset-browser-right-click-menu-new")).C_Str()))
+							if (ImGui::BeginMenu((HLString(ICON_FA_PLUS) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-new"))).C_Str()))
 							{
-								if (ImGui::MenuItem((HLString(ICON_FA_FOLDER) + " " + translation->GetText("asset-browser-right-click-menu-new-folder")).C_Str()))
+								if (ImGui::MenuItem((HLString(ICON_FA_FOLDER) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-new-folder"))).C_Str()))
 								{
 									FileSystemPath newFilePath = Project::GetAssetDirectory() / m_CurrentDirectory->FilePath / "New Folder";
 									bool created = FileSystem::Get()->CreateFolder(newFilePath);
@@ -177,7 +177,7 @@ namespace highlo
 									}
 								}
 
-								if (ImGui::MenuItem((HLString(ICON_FA_FILM) + " " + translation->GetText("asset-browser-right-click-menu-new-scene")).C_Str()))
+								if (ImGui::MenuItem((HLString(ICON_FA_FILM) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-new-scene"))).C_Str()))
 								{
 									CreateAssetRepresentation<Scene>("New Scene.hlscene");
 								}
@@ -191,21 +191,21 @@ namespace highlo
 								ImGui::EndMenu();
 							}
 
-							if (ImGui::MenuItem((HLString(ICON_FA_TRUCK_LOADING) + " " + translation->GetText("asset-browser-right-click-menu-import").C_Str())))
+							if (ImGui::MenuItem((HLString(ICON_FA_TRUCK_LOADING) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-import")).C_Str())))
 							{
 								// TODO
 							}
 
-							if (ImGui::MenuItem((HLString(ICON_FA_SYNC_ALT) + " " + translation->GetText("asset-browser-right-click-menu-refresh")).C_Str()))
+							if (ImGui::MenuItem((HLString(ICON_FA_SYNC_ALT) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-refresh"))).C_Str()))
 								Refresh();
 
-							if (ImGui::MenuItem((HLString(ICON_FA_COPY) + " " + translation->GetText("asset-browser-right-click-menu-copy")).C_Str(), "Ctrl+C", nullptr, m_SelectionStack.Count() > 0))
+							if (ImGui::MenuItem((HLString(ICON_FA_COPY) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-copy"))).C_Str(), "Ctrl+C", nullptr, m_SelectionStack.Count() > 0))
 								m_CopiedAssets.CopyFrom(m_SelectionStack);
 
-							if (ImGui::MenuItem((HLString(ICON_FA_PASTE) + " " + translation->GetText("asset-browser-right-click-menu-paste")).C_Str(), "Ctrl+V", nullptr, m_CopiedAssets.Count() > 0))
+							if (ImGui::MenuItem((HLString(ICON_FA_PASTE) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-paste"))).C_Str(), "Ctrl+V", nullptr, m_CopiedAssets.Count() > 0))
 								PasteCopiedAssets();
 
-							if (ImGui::MenuItem((HLString(ICON_FA_CLONE) + " " + translation->GetText("asset-browser-right-click-menu-duplicate")).C_Str(), "Ctrl+D", nullptr, m_SelectionStack.Count() > 0))
+							if (ImGui::MenuItem((HLString(ICON_FA_CLONE) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-duplicate"))).C_Str(), "Ctrl+D", nullptr, m_SelectionStack.Count() > 0))
 							{
 								m_CopiedAssets.CopyFrom(m_SelectionStack);
 								PasteCopiedAssets();
@@ -213,7 +213,7 @@ namespace highlo
 
 							ImGui::Separator();
 
-							if (ImGui::MenuItem((HLString(ICON_FA_EXTERNAL_LINK_ALT) + " " + translation->GetText("asset-browser-right-click-menu-explorer")).C_Str()))
+							if (ImGui::MenuItem((HLString(ICON_FA_EXTERNAL_LINK_ALT) + " " + translation->GetText(HL_NAME("asset-browser-right-click-menu-explorer"))).C_Str()))
 							{
 								FileSystemPath p = m_CurrentDirectory->FilePath.Absolute();
 								FileSystem::Get()->OpenInExplorer(p);
@@ -340,14 +340,14 @@ namespace highlo
 				continue;
 			}
 
-			AssetMetaData &metaData = AssetManager::Get()->GetMetaData(entry.FullPath);
+			AssetMetaData metaData = AssetManager::Get()->GetMetaData(entry.FullPath);
 			if (!metaData.IsValid())
 			{
 				AssetType type = AssetManager::Get()->GetAssetTypeFromPath(entryPath);
 				if (type == AssetType::None)
 					continue;
 
-				metaData.Handle = AssetManager::Get()->ImportAsset(entryPath);
+				metaData = AssetManager::Get()->GetMetaData(AssetManager::Get()->ImportAsset(entryPath));
 			}
 
 			// Failed to import asset
@@ -546,7 +546,7 @@ namespace highlo
 				ChangeDirectory(m_PrevDirectory);
 			}
 
-			UI::DrawHelpMarker(translation->GetText("asset-browser-prev-dir-btn-tooltip"), false);
+			UI::DrawHelpMarker(translation->GetText(HL_NAME("asset-browser-prev-dir-btn-tooltip")), false);
 			ImGui::Spring(-1.0f, edgeOffset);
 
 			if (ContentBrowserButton(ICON_FA_ARROW_RIGHT))
@@ -554,13 +554,13 @@ namespace highlo
 				ChangeDirectory(m_NextDirectory);
 			}
 
-			UI::DrawHelpMarker(translation->GetText("asset-browser-next-dir-btn-tooltip"), false);
+			UI::DrawHelpMarker(translation->GetText(HL_NAME("asset-browser-next-dir-btn-tooltip")), false);
 			ImGui::Spring(-1.0f, edgeOffset * 2.0f);
 
 			if (ContentBrowserButton(ICON_FA_SYNC_ALT))
 				Refresh();
 
-			UI::DrawHelpMarker(translation->GetText("asset-browser-refresh-dir-btn-tooltip"), false);
+			UI::DrawHelpMarker(translation->GetText(HL_NAME("asset-browser-refresh-dir-btn-tooltip")), false);
 			ImGui::Spring(-1.0f, edgeOffset * 2.0f);
 		}
 
@@ -982,7 +982,7 @@ namespace highlo
 
 		for (auto &assetHandle : dirInfo->Assets)
 		{
-			auto &asset = AssetManager::Get()->GetMetaData(assetHandle);
+			AssetMetaData asset = AssetManager::Get()->GetMetaData(assetHandle);
 			HLString fileName = asset.FilePath.Filename();
 			fileName = fileName.ToLowerCase();
 
@@ -41,12 +41,12 @@ namespace highlo
 
 			if (UI::BeginPopup("settings_comp_popup"))
 			{
-				if (ImGui::MenuItem(translation->GetText("object-properties-reset-component")))
+				if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-reset-component"))))
 					resetValues = true;
 
 				if (canBeRemoved)
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-remove-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-remove-component"))))
 						removeComponent = true;
 				}
 
@@ -96,7 +96,7 @@ namespace highlo
 
 		if (UI::BeginPopup("settings_comp_popup"))
 		{
-			if (ImGui::MenuItem(translation->GetText("object-properties-reset-component")))
+			if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-reset-component"))))
 				resetValues = true;
 
 			UI::EndPopup();
@@ -148,7 +148,7 @@ namespace highlo
 		if (m_IsWindow)
 		{
 			UI::ScopedStyle padding(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 10.0f));
-			ImGui::Begin(translation->GetText("object-properties-window-title"), pOpen, ImGuiWindowFlags_AlwaysVerticalScrollbar);
+			ImGui::Begin(translation->GetText(HL_NAME("object-properties-window-title")), pOpen, ImGuiWindowFlags_AlwaysVerticalScrollbar);
 		}
 
 		if (m_SelectedEntity)
@@ -251,7 +251,7 @@ namespace highlo
 			{
 				if (!entity.HasComponent<CameraComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-camera-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-camera-component"))))
 					{
 						entity.AddComponent<CameraComponent>();
 						ImGui::CloseCurrentPopup();
@@ -260,7 +260,7 @@ namespace highlo
 
 				if (!entity.HasComponent<StaticModelComponent>() && !m_SelectedEntity.HasComponent<DynamicModelComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-static-model-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-static-model-component"))))
 					{
 						entity.AddComponent<StaticModelComponent>();
 						ImGui::CloseCurrentPopup();
@@ -269,7 +269,7 @@ namespace highlo
 
 				if (!entity.HasComponent<DynamicModelComponent>() && !m_SelectedEntity.HasComponent<StaticModelComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-dynamic-model-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-dynamic-model-component"))))
 					{
 						entity.AddComponent<DynamicModelComponent>();
 						ImGui::CloseCurrentPopup();
@@ -278,7 +278,7 @@ namespace highlo
 
 				if (!entity.HasComponent<DirectionalLightComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-directional-light-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-directional-light-component"))))
 					{
 						entity.AddComponent<DirectionalLightComponent>();
 						ImGui::CloseCurrentPopup();
@@ -287,7 +287,7 @@ namespace highlo
 
 				if (!entity.HasComponent<PointLightComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-point-light-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-point-light-component"))))
 					{
 						entity.AddComponent<PointLightComponent>();
 						ImGui::CloseCurrentPopup();
@@ -296,7 +296,7 @@ namespace highlo
 
 				if (!entity.HasComponent<SkyLightComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-sky-light-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-sky-light-component"))))
 					{
 						entity.AddComponent<SkyLightComponent>();
 						ImGui::CloseCurrentPopup();
@@ -305,7 +305,7 @@ namespace highlo
 
 				if (!entity.HasComponent<ScriptComponent>())
 				{
-					if (ImGui::MenuItem(translation->GetText("object-properties-script-c#-component")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("object-properties-script-c#-component"))))
 					{
 						entity.AddComponent<ScriptComponent>();
 						ImGui::CloseCurrentPopup();
@@ -317,7 +317,7 @@ namespace highlo
 		}
 
 		// Draw Transform
-		DrawTransformComponent(translation->GetText("object-properties-transform-component"), m_Scene, entity, [&]()
+		DrawTransformComponent(translation->GetText(HL_NAME("object-properties-transform-component")), m_Scene, entity, [&]()
 		{
 			UI::ScopedStyle spacing(ImGuiStyleVar_ItemSpacing, ImVec2(8.0f, 8.0f));
 			UI::ScopedStyle padding(ImGuiStyleVar_FramePadding, ImVec2(4.0f, 4.0f));
@@ -338,7 +338,7 @@ namespace highlo
 			entityTransform.SetRotation(glm::radians(degreeRotation));
 
 			ImGui::TableNextRow();
-			bool scaleChanged = UI::DrawVec3(translation->GetText("object-properties-transform-component-scale"), entityTransform.GetScale(), 1.0f);
+			bool scaleChanged = UI::DrawVec3(translation->GetText(HL_NAME("object-properties-transform-component-scale")), entityTransform.GetScale(), 1.0f);
 
 			ImGui::EndTable();
 
@@ -356,13 +356,13 @@ namespace highlo
 
 		}, m_SettingsIcon);
 
-		DrawComponent<StaticModelComponent>(translation->GetText("object-properties-static-model-component"), entity, [&](StaticModelComponent &component)
+		DrawComponent<StaticModelComponent>(translation->GetText(HL_NAME("object-properties-static-model-component")), entity, [&](StaticModelComponent &component)
 		{
 			Ref<StaticModel> mesh = AssetManager::Get()->GetAsset<StaticModel>(component.Model);
 
 			UI::BeginPropertyGrid();
 			UI::AssetReferenceResult result;
-			if (UI::DrawAssetReferenceWithConversion<StaticModel, MeshFile>(translation->GetText("object-properties-static-model-component"), component.Model, [=](Ref<MeshFile> meshAsset)
+			if (UI::DrawAssetReferenceWithConversion<StaticModel, MeshFile>(translation->GetText(HL_NAME("object-properties-static-model-component")), component.Model, [=](Ref<MeshFile> meshAsset)
 			{
 				// TODO: Add MeshConversionCallback that is going to be called here
 			}, &result))
@@ -379,7 +379,7 @@ namespace highlo
 
 			if (mesh && mesh->IsValid())
 			{
-				if (UI::BeginTreeNode(translation->GetText("object-properties-materials")))
+				if (UI::BeginTreeNode(translation->GetText(HL_NAME("object-properties-materials"))))
 				{
 					UI::BeginPropertyGrid();
 
@@ -413,7 +413,7 @@ namespace highlo
 							{
 								HLString meshMaterialName = meshMaterialAsset->GetMaterial()->GetName();
 								if (meshMaterialName.IsEmpty())
-									meshMaterialName = translation->GetText("object-properties-unnamed-material");
+									meshMaterialName = translation->GetText(HL_NAME("object-properties-unnamed-material"));
 							}
 
 							if (hasLocalMaterial)
@@ -433,14 +433,14 @@ namespace highlo
 			}
 		}, m_SettingsIcon);
 
-		DrawComponent<DynamicModelComponent>(translation->GetText("object-properties-dynamic-model-component"), entity, [&](DynamicModelComponent &component)
+		DrawComponent<DynamicModelComponent>(translation->GetText(HL_NAME("object-properties-dynamic-model-component")), entity, [&](DynamicModelComponent &component)
 		{
 			Ref<DynamicModel> mesh = AssetManager::Get()->GetAsset<DynamicModel>(component.Model);
 
 			UI::BeginPropertyGrid();
 
 			UI::AssetReferenceResult result;
-			if (UI::DrawAssetReferenceWithConversion<StaticModel, MeshFile>(translation->GetText("object-properties-dynamic-model-component"), component.Model, [=](Ref<MeshFile> meshAsset)
+			if (UI::DrawAssetReferenceWithConversion<StaticModel, MeshFile>(translation->GetText(HL_NAME("object-properties-dynamic-model-component")), component.Model, [=](Ref<MeshFile> meshAsset)
 			{
 				// TODO: Add MeshConversionCallback that is going to be called here
 			}, &result))
@@ -467,7 +467,7 @@ namespace highlo
 
 			if (mesh && mesh->IsValid())
 			{
-				if (UI::BeginTreeNode(translation->GetText("object-properties-materials")))
+				if (UI::BeginTreeNode(translation->GetText(HL_NAME("object-properties-materials"))))
 				{
 					UI::BeginPropertyGrid();
 
@@ -501,7 +501,7 @@ namespace highlo
 							{
 								HLString meshMaterialName = meshMaterialAsset->GetMaterial()->GetName();
 								if (meshMaterialName.IsEmpty())
-									meshMaterialName = translation->GetText("object-properties-unnamed-material");
+									meshMaterialName = translation->GetText(HL_NAME("object-properties-unnamed-material"));
 							}
 
 							if (hasLocalMaterial)
@@ -521,22 +521,22 @@ namespace highlo
 			}
 		}, m_SettingsIcon);
 
-		DrawComponent<CameraComponent>(translation->GetText("object-properties-camera-component"), entity, [&](CameraComponent &component)
+		DrawComponent<CameraComponent>(translation->GetText(HL_NAME("object-properties-camera-component")), entity, [&](CameraComponent &component)
 		{
 			UI::BeginPropertyGrid();
 
 			std::vector<HLString> projectionTypes;
-			projectionTypes.push_back(translation->GetText("object-properties-camera-component-perspective"));
-			projectionTypes.push_back(translation->GetText("object-properties-camera-component-orthographic"));
+			projectionTypes.push_back(translation->GetText(HL_NAME("object-properties-camera-component-perspective")));
+			projectionTypes.push_back(translation->GetText(HL_NAME("object-properties-camera-component-orthographic")));
 			int32 currentProjectionType = (int32)component.Camera.GetCurrentProjectionType();
 
 			bool primary = component.Primary;
-			if (UI::DrawCheckbox(translation->GetText("object-properties-camera-component-primary"), primary))
+			if (UI::DrawCheckbox(translation->GetText(HL_NAME("object-properties-camera-component-primary")), primary))
 			{
 				component.Primary = primary;
 			}
 
-			if (UI::DrawDropdown(translation->GetText("object-properties-camera-component-projection"), projectionTypes, &currentProjectionType))
+			if (UI::DrawDropdown(translation->GetText(HL_NAME("object-properties-camera-component-projection")), projectionTypes, &currentProjectionType))
 			{
 				component.Camera.SetProjectionType((Camera::ProjectionType)currentProjectionType);
 			}
@@ -547,13 +547,13 @@ namespace highlo
 				float nearPlane = component.Camera.GetOrthographicNearPlane();
 				float farPlane = component.Camera.GetOrthographicFarPlane();
 
-				if (UI::DrawDragFloat(translation->GetText("object-properties-camera-component-orthographic-size"), orthographicSize))
+				if (UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-camera-component-orthographic-size")), orthographicSize))
 				{
 					component.Camera.SetOrthographicSize(orthographicSize);
 				}
 
 				glm::vec2 values = { nearPlane, farPlane };
-				if (UI::DrawDragFloat2(translation->GetText("object-properties-camera-component-near-far-planes"), values))
+				if (UI::DrawDragFloat2(translation->GetText(HL_NAME("object-properties-camera-component-near-far-planes")), values))
 				{
 					component.Camera.SetOrthographicNearPlane(values[0]);
 					component.Camera.SetOrthographicFarPlane(values[1]);
@@ -565,13 +565,13 @@ namespace highlo
 				float nearPlane = component.Camera.GetPerspectiveNearPlane();
 				float farPlane = component.Camera.GetPerspectiveFarPlane();
 
-				if (UI::DrawDragFloat(translation->GetText("object-properties-camera-component-vertical-fov"), verticalFOV))
+				if (UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-camera-component-vertical-fov")), verticalFOV))
 				{
 					component.Camera.SetPerspectiveFOV(verticalFOV);
 				}
 
 				glm::vec2 values = { nearPlane, farPlane };
-				if (UI::DrawDragFloat2(translation->GetText("object-properties-camera-component-near-far-planes"), values))
+				if (UI::DrawDragFloat2(translation->GetText(HL_NAME("object-properties-camera-component-near-far-planes")), values))
 				{
 					component.Camera.SetPerspectiveNearPlane(values[0]);
 					component.Camera.SetPerspectiveFarPlane(values[1]);
@@ -581,34 +581,34 @@ namespace highlo
 			UI::EndPropertyGrid();
 		}, m_SettingsIcon);
 
-		DrawComponent<DirectionalLightComponent>(translation->GetText("object-properties-directional-light-component"), entity, [&](DirectionalLightComponent &component)
+		DrawComponent<DirectionalLightComponent>(translation->GetText(HL_NAME("object-properties-directional-light-component")), entity, [&](DirectionalLightComponent &component)
 		{
 			UI::BeginPropertyGrid();
-			UI::DrawColorPicker(translation->GetText("object-properties-light-component-radiance"), component.Radiance);
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-intensity"), component.Intensity);
-			UI::DrawCheckbox(translation->GetText("object-properties-light-component-cast-shadows"), component.CastShadows);
-			UI::DrawCheckbox(translation->GetText("object-properties-light-component-soft-shadows"), component.SoftShadows);
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-source-size"), component.LightSize);
+			UI::DrawColorPicker(translation->GetText(HL_NAME("object-properties-light-component-radiance")), component.Radiance);
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-intensity")), component.Intensity);
+			UI::DrawCheckbox(translation->GetText(HL_NAME("object-properties-light-component-cast-shadows")), component.CastShadows);
+			UI::DrawCheckbox(translation->GetText(HL_NAME("object-properties-light-component-soft-shadows")), component.SoftShadows);
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-source-size")), component.LightSize);
 			UI::EndPropertyGrid();
 		}, m_SettingsIcon);
 
-		DrawComponent<PointLightComponent>(translation->GetText("object-properties-point-light-component"), entity, [&](PointLightComponent &component)
+		DrawComponent<PointLightComponent>(translation->GetText(HL_NAME("object-properties-point-light-component")), entity, [&](PointLightComponent &component)
 		{
 			UI::BeginPropertyGrid();
-			UI::DrawColorPicker(translation->GetText("object-properties-light-component-radiance"), component.Radiance);
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-intensity"), component.Intensity);
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-radius"), component.Radius, 0.1f, 0.0f, std::numeric_limits<float>::max());
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-falloff"), component.Falloff, 0.005f, 0.0f, 1.0f);
-			UI::DrawCheckbox(translation->GetText("object-properties-light-component-cast-shadows"), component.CastShadows);
-			UI::DrawCheckbox(translation->GetText("object-properties-light-component-soft-shadows"), component.SoftShadows);
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-source-size"), component.LightSize);
+			UI::DrawColorPicker(translation->GetText(HL_NAME("object-properties-light-component-radiance")), component.Radiance);
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-intensity")), component.Intensity);
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-radius")), component.Radius, 0.1f, 0.0f, std::numeric_limits<float>::max());
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-falloff")), component.Falloff, 0.005f, 0.0f, 1.0f);
+			UI::DrawCheckbox(translation->GetText(HL_NAME("object-properties-light-component-cast-shadows")), component.CastShadows);
+			UI::DrawCheckbox(translation->GetText(HL_NAME("object-properties-light-component-soft-shadows")), component.SoftShadows);
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-source-size")), component.LightSize);
 			UI::EndPropertyGrid();
 		}, m_SettingsIcon);
 
-		DrawComponent<SkyLightComponent>(translation->GetText("object-properties-sky-light-component"), entity, [&](SkyLightComponent &component)
+		DrawComponent<SkyLightComponent>(translation->GetText(HL_NAME("object-properties-sky-light-component")), entity, [&](SkyLightComponent &component)
 		{
 			UI::BeginPropertyGrid();
-			UI::DrawDragFloat(translation->GetText("object-properties-light-component-intensity"), component.Intensity);
+			UI::DrawDragFloat(translation->GetText(HL_NAME("object-properties-light-component-intensity")), component.Intensity);
 			if (AssetManager::Get()->IsAssetHandleValid(component.SceneEnvironment))
 			{
 				auto env = AssetManager::Get()->GetAsset<Environment>(component.SceneEnvironment);
@@ -625,7 +625,7 @@ namespace highlo
 
 			ImGui::Separator();
 
-			UI::DrawCheckbox(translation->GetText("object-properties-light-component-dynamic-sky"), component.DynamicSky);
+			UI::DrawCheckbox(translation->GetText(HL_NAME("object-properties-light-component-dynamic-sky")), component.DynamicSky);
 			if (component.DynamicSky)
 			{
 				bool changed = UI::DrawDragFloat("Turbidity", component.TurbityAzimuthInclination.x, 0.01f);
@@ -652,7 +652,7 @@ namespace highlo
 			UI::EndPropertyGrid();
 		}, m_SettingsIcon);
 
-		DrawComponent<ScriptComponent>(translation->GetText("object-properties-script-c#-component"), entity, [&](ScriptComponent &component)
+		DrawComponent<ScriptComponent>(translation->GetText(HL_NAME("object-properties-script-c#-component")), entity, [&](ScriptComponent &component)
 		{
 			std::vector<HLString> options = {
 				"Test",
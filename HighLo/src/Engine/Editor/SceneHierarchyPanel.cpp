@@ -42,7 +42,7 @@ namespace highlo
 		if (m_IsWindow)
 		{
 			UI::ScopedStyle padding(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
-			ImGui::Begin(translation->GetText("scene-hierarchy-window-title"), pOpen);
+			ImGui::Begin(translation->GetText(HL_NAME("scene-hierarchy-window-title")), pOpen);
 		}
 
 		ImRect windowRect = { ImGui::GetWindowContentRegionMin(), ImGui::GetWindowContentRegionMax() };
@@ -142,20 +142,20 @@ namespace highlo
 
 						if (ImGui::BeginPopupContextWindow(nullptr, ImGuiPopupFlags_MouseButtonRight | ImGuiPopupFlags_NoOpenOverItems))
 						{
-							if (ImGui::BeginMenu(translation->GetText("scene-hierarchy-right-click-menu-new")))
+							if (ImGui::BeginMenu(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new"))))
 							{
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-null-object")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-null-object"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-null-object"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-null-object")));
 									SetSelected(newEntity);
 
 									if (m_EntityAddedCallback)
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-camera")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-camera"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-camera"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-camera")));
 									newEntity.AddComponent<CameraComponent>();
 									SetSelected(newEntity);
 
@@ -165,9 +165,9 @@ namespace highlo
 
 								ImGui::Separator();
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-cube")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-cube"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-cube"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-cube")));
 									StaticModelComponent *component = newEntity.AddComponent<StaticModelComponent>();
 									component->Model = AssetFactory::CreateCube({ 1.0f, 1.0f, 1.0f });
 									SetSelected(newEntity);
@@ -176,9 +176,9 @@ namespace highlo
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-sphere")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-sphere"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-sphere"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-sphere")));
 									StaticModelComponent *component = newEntity.AddComponent<StaticModelComponent>();
 									component->Model = AssetFactory::CreateSphere(4.0f);
 									SetSelected(newEntity);
@@ -187,9 +187,9 @@ namespace highlo
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-capsule")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-capsule"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-capsule"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-capsule")));
 									StaticModelComponent *component = newEntity.AddComponent<StaticModelComponent>();
 									component->Model = AssetFactory::CreateCapsule(4.0f, 8.0f);
 									SetSelected(newEntity);
@@ -198,9 +198,9 @@ namespace highlo
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-cylinder")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-cylinder"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-cylinder"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-cylinder")));
 									StaticModelComponent *component = newEntity.AddComponent<StaticModelComponent>();
 									// TODO: Add Cylinders to AssetFactory and MeshFactory
 								//	component->Model = AssetFactory::CreateCylinder();
@@ -212,9 +212,9 @@ namespace highlo
 
 								ImGui::Separator();
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-directional-light")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-directional-light"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-directional-light"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-directional-light")));
 									newEntity.AddComponent<DirectionalLightComponent>();
 									newEntity.Transform().FromRotation({ 80.0f, 10.0f, 0.0f });
 									SetSelected(newEntity);
@@ -223,9 +223,9 @@ namespace highlo
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-point-light")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-point-light"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-point-light"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-point-light")));
 									newEntity.AddComponent<PointLightComponent>();
 									newEntity.Transform().FromPosition({ 0.0f, 0.0f, 0.0f });
 									SetSelected(newEntity);
@@ -234,9 +234,9 @@ namespace highlo
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-sky-light")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-sky-light"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-sky-light"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-sky-light")));
 									newEntity.AddComponent<SkyLightComponent>();
 									SetSelected(newEntity);
 
@@ -246,9 +246,9 @@ namespace highlo
 
 								ImGui::Separator();
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-c#-script")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-c#-script"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-c#-script"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-c#-script")));
 									newEntity.AddComponent<ScriptComponent>();
 									SetSelected(newEntity);
 
@@ -256,9 +256,9 @@ namespace highlo
 										m_EntityAddedCallback(newEntity);
 								}
 
-								if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-new-lua-script")))
+								if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-lua-script"))))
 								{
-									Entity newEntity = m_Scene->CreateEntity(translation->GetText("scene-hierarchy-right-click-menu-new-lua-script"));
+									Entity newEntity = m_Scene->CreateEntity(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-new-lua-script")));
 									// TODO: Add Lua script component here
 									SetSelected(newEntity);
 
@@ -358,7 +358,7 @@ namespace highlo
 		if (hasChildMatchingSearch)
 			flags |= ImGuiTreeNodeFlags_DefaultOpen;
 
-		if (entity.Children().empty())
+		if (entity.Children().IsEmpty())
 			flags |= ImGuiTreeNodeFlags_Leaf;
 
 		const HLString strId = HLString(name) + HLString::ToString((uint64)entity.GetUUID());
@@ -378,7 +378,7 @@ namespace highlo
 			if (e == m_SelectedEntity)
 				return true;
 
-			if (!e.Children().empty())
+			if (!e.Children().IsEmpty())
 			{
 				for (auto &child : e.Children())
 				{
@@ -454,7 +454,7 @@ namespace highlo
 				UI::ScopedColor colorText(ImGuiCol_Text, Colors::Theme::Text);
 				UI::ScopedColorStack entitySelection(ImGuiCol_Header, Colors::Theme::GroupHeader, ImGuiCol_HeaderHovered, Colors::Theme::GroupHeader, ImGuiCol_HeaderActive, Colors::Theme::GroupHeader);
 
-				if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-duplicate-entity")))
+				if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-duplicate-entity"))))
 				{
 					Entity newEntity = m_Scene->DuplicateEntity(m_SelectedEntity);
 					m_Scene->AddEntity(newEntity);
@@ -463,7 +463,7 @@ namespace highlo
 
 				if (entity.IsHidden())
 				{
-					if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-show-entity")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-show-entity"))))
 					{
 						m_SelectedEntity.Show();
 						m_SelectionChangedCallback(m_SelectedEntity);
@@ -471,7 +471,7 @@ namespace highlo
 				}
 				else
 				{
-					if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-hide-entity")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-hide-entity"))))
 					{
 						m_SelectedEntity.Hide();
 						m_SelectionChangedCallback(m_SelectedEntity);
@@ -480,7 +480,7 @@ namespace highlo
 
 				if (isPrefab)
 				{
-					if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-update-prefab")))
+					if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-update-prefab"))))
 					{
 						AssetHandle prefabAssetHandle = entity.GetComponent<PrefabComponent>()->PrefabID;
 						Ref<Prefab> prefab = AssetManager::Get()->GetAsset<Prefab>(prefabAssetHandle);
@@ -491,7 +491,7 @@ namespace highlo
 					}
 				}
 
-				if (ImGui::MenuItem(translation->GetText("scene-hierarchy-right-click-menu-remove-entity")))
+				if (ImGui::MenuItem(translation->GetText(HL_NAME("scene-hierarchy-right-click-menu-remove-entity"))))
 					entityDeleted = true;
 			}
 
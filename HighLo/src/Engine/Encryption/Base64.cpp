@@ -3,152 +3,474 @@
 #include "HighLoPch.h"
 #include "Base64.h"
 
+#if defined(_M_X64) || defined(__x86_64__)
+	// The kernels need pshufb, so they are only used, if the processor reports SSSE3 or AVX2 at runtime
+	#define HL_BASE64_SIMD
+	#include <immintrin.h>
+
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+#if defined(HL_BASE64_SIMD) && (defined(__GNUC__) || defined(__clang__))
+	#define HL_BASE64_TARGET_SSSE3 __attribute__((target("ssse3")))
+	#define HL_BASE64_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define HL_BASE64_TARGET_SSSE3
+	#define HL_BASE64_TARGET_AVX2
+#endif
+
+#define BASE64_INVALID 0xFF
+
 namespace highlo
 {
-    static const HLString base64_chars =
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz"
-        "0123456789+/";
+	static const char *s_Base64Chars =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+		"abcdefghijklmnopqrstuvwxyz"
+		"0123456789+/";
+
+	namespace utils
+	{
+		struct Base64DecodeTable
+		{
+			uint8 Values[256];
+
+			constexpr Base64DecodeTable()
+				: Values()
+			{
+				for (uint32 i = 0; i < 256; ++i)
+					Values[i] = BASE64_INVALID;
+
+				for (uint32 i = 0; i < 26; ++i)
+				{
+					Values['A' + i] = (uint8)i;
+					Values['a' + i] = (uint8)(26 + i);
+				}
+
+				for (uint32 i = 0; i < 10; ++i)
+					Values['0' + i] = (uint8)(52 + i);
+
+				Values['+'] = 62;
+				Values['/'] = 63;
+			}
+		};
+
+		static constexpr Base64DecodeTable s_Base64DecodeTable;
+
+		static bool DetectBase64SSSE3()
+		{
+		#if defined(HL_BASE64_SIMD) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 1);
+			return (info[2] & (1 << 9)) != 0;
+		#elif defined(HL_BASE64_SIMD)
+			return __builtin_cpu_supports("ssse3");
+		#else
+			return false;
+		#endif
+		}
+
+		static bool DetectBase64AVX2()
+		{
+		#if defined(HL_BASE64_SIMD) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			// The operating system has to save the AVX registers on context switches
+			__cpuid(info, 1);
+			if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+		#elif defined(HL_BASE64_SIMD)
+			return __builtin_cpu_supports("avx2");
+		#else
+			return false;
+		#endif
+		}
+
+		// Static initializers, that run before these ones, see false and use the scalar versions
+		static const bool s_Base64SSSE3Enabled = DetectBase64SSSE3();
+		static const bool s_Base64AVX2Enabled = DetectBase64AVX2();
+
+	#ifdef HL_BASE64_SIMD
+		// The encoders spread 12 bytes to 16 sextets (one per byte) with one shuffle and two multiplications
+		// and translate the sextets to characters by adding an offset, that is looked up from the range of the sextet.
+		// The decoders classify every character by its low and high nibble, which finds invalid characters and the offset back to the sextet at once,
+		// and then pack 16 sextets back into 12 bytes with two multiply-adds.
+		// See "Faster Base64 Encoding and Decoding using AVX2 Instructions" by Wojciech Mula and Daniel Lemire.
+
+		HL_BASE64_TARGET_SSSE3 static HL_FORCE_INLINE __m128i SextetsToCharsSSSE3(__m128i sextets)
+		{
+			const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+			// 0 for a-z, 1-10 for the digits, 11 for '+', 12 for '/' and 13 for A-Z
+			__m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+			const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets);
+			range = _mm_or_si128(range, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+			return _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, range));
+		}
+
+		HL_BASE64_TARGET_SSSE3 static uint64 EncodeSSSE3(const Byte *buffer, uint64 length, char *out)
+		{
+			const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+			uint64 i = 0;
+			for (; i + 16 <= length; i += 12, out += 16)
+			{
+				const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(buffer + i)), spread);
+				const __m128i first = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+				const __m128i second = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+				_mm_storeu_si128((__m128i*)out, SextetsToCharsSSSE3(_mm_or_si128(first, second)));
+			}
+
+			return i;
+		}
+
+		HL_BASE64_TARGET_SSSE3 static uint64 DecodeSSSE3(const char *encoded, uint64 length, Byte *out)
+		{
+			const __m128i lowNibbleClasses = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+			const __m128i highNibbleClasses = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+			const __m128i offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+			const __m128i slash = _mm_set1_epi8(0x2F);
+
+			// Every step stores 16 bytes, but only 12 of them are valid, so the loop stops early enough to stay inside the output
+			uint64 i = 0;
+			for (; i + 24 <= length; i += 16, out += 12)
+			{
+				const __m128i in = _mm_loadu_si128((const __m128i*)(encoded + i));
+				const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), slash);
+				const __m128i lowNibbles = _mm_and_si128(in, slash);
+				const __m128i high = _mm_shuffle_epi8(highNibbleClasses, highNibbles);
+				const __m128i low = _mm_shuffle_epi8(lowNibbleClasses, lowNibbles);
+
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0xFFFF)
+					break;
+
+				const __m128i isSlash = _mm_cmpeq_epi8(in, slash);
+				const __m128i sextets = _mm_add_epi8(in, _mm_shuffle_epi8(offsets, _mm_add_epi8(isSlash, highNibbles)));
+
+				const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+				const __m128i triples = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+				_mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(triples, pack));
+			}
+
+			return i;
+		}
+
+		HL_BASE64_TARGET_AVX2 static uint64 EncodeAVX2(const Byte *buffer, uint64 length, char *out)
+		{
+			const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+			const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+													 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+			uint64 i = 0;
+			for (; i + 28 <= length; i += 24, out += 32)
+			{
+				// Each 128 bit lane gets its own 12 bytes, because the shuffle can not cross lanes
+				const __m128i low = _mm_loadu_si128((const __m128i*)(buffer + i));
+				const __m128i high = _mm_loadu_si128((const __m128i*)(buffer + i + 12));
+				const __m256i in = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), spread);
+
+				const __m256i first = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+				const __m256i second = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+				const __m256i sextets = _mm256_or_si256(first, second);
+
+				__m256i range = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+				const __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets);
+				range = _mm256_or_si256(range, _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+				_mm256_storeu_si256((__m256i*)out, _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, range)));
+			}
+
+			return i;
+		}
+
+		HL_BASE64_TARGET_AVX2 static uint64 DecodeAVX2(const char *encoded, uint64 length, Byte *out)
+		{
+			const __m256i lowNibbleClasses = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+															  0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+			const __m256i highNibbleClasses = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+															   0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+			const __m256i offsets = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+													 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+												  2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+			const __m256i slash = _mm256_set1_epi8(0x2F);
+
+			// Every step stores 32 bytes, but only 24 of them are valid, so the loop stops early enough to stay inside the output
+			uint64 i = 0;
+			for (; i + 44 <= length; i += 32, out += 24)
+			{
+				const __m256i in = _mm256_loadu_si256((const __m256i*)(encoded + i));
+				const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), slash);
+				const __m256i lowNibbles = _mm256_and_si256(in, slash);
+				const __m256i high = _mm256_shuffle_epi8(highNibbleClasses, highNibbles);
+				const __m256i low = _mm256_shuffle_epi8(lowNibbleClasses, lowNibbles);
+
+				if (!_mm256_testz_si256(low, high))
+					break;
+
+				const __m256i isSlash = _mm256_cmpeq_epi8(in, slash);
+				const __m256i sextets = _mm256_add_epi8(in, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(isSlash, highNibbles)));
+
+				const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+				const __m256i triples = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+
+				// Moves the 12 bytes of the upper lane directly behind the 12 bytes of the lower lane
+				const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(triples, pack), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+				_mm256_storeu_si256((__m256i*)out, packed);
+			}
+
+			return i;
+		}
+	#endif
+
+		/// <summary>
+		/// Encodes all complete blocks of 3 bytes and returns the number of encoded bytes.
+		/// </summary>
+		static uint64 EncodeBlocks(const Byte *buffer, uint64 length, char *out)
+		{
+			uint64 i = 0;
+
+		#ifdef HL_BASE64_SIMD
+			if (s_Base64AVX2Enabled)
+				i = EncodeAVX2(buffer, length, out);
+			else if (s_Base64SSSE3Enabled)
+				i = EncodeSSSE3(buffer, length, out);
+		#endif
+
+			out += (i / 3) * 4;
+			for (; i + 3 <= length; i += 3, out += 4)
+			{
+				const uint32 value = ((uint32)buffer[i] << 16) | ((uint32)buffer[i + 1] << 8) | (uint32)buffer[i + 2];
+				out[0] = s_Base64Chars[value >> 18];
+				out[1] = s_Base64Chars[(value >> 12) & 0x3F];
+				out[2] = s_Base64Chars[(value >> 6) & 0x3F];
+				out[3] = s_Base64Chars[value & 0x3F];
+			}
+
+			return i;
+		}
+
+		/// <summary>
+		/// Decodes all complete blocks of 4 characters until the first block, that contains padding or an invalid character,
+		/// and returns the number of decoded characters.
+		/// </summary>
+		static uint64 DecodeBlocks(const char *encoded, uint64 length, Byte *out)
+		{
+			uint64 i = 0;
+
+		#ifdef HL_BASE64_SIMD
+			if (s_Base64AVX2Enabled)
+				i = DecodeAVX2(encoded, length, out);
+			else if (s_Base64SSSE3Enabled)
+				i = DecodeSSSE3(encoded, length, out);
+		#endif
+
+			const uint8 *table = s_Base64DecodeTable.Values;
+			out += (i / 4) * 3;
+			for (; i + 4 <= length; i += 4, out += 3)
+			{
+				const uint32 a = table[(uint8)encoded[i]];
+				const uint32 b = table[(uint8)encoded[i + 1]];
+				const uint32 c = table[(uint8)encoded[i + 2]];
+				const uint32 d = table[(uint8)encoded[i + 3]];
+				// Valid characters are below 64, so the invalid marker is the only value with the high bit
+				if ((a | b | c | d) & 0x80)
+					break;
+
+				const uint32 value = (a << 18) | (b << 12) | (c << 6) | d;
+				out[0] = (Byte)(value >> 16);
+				out[1] = (Byte)(value >> 8);
+				out[2] = (Byte)value;
+			}
+
+			return i;
+		}
+	}
 
 	bool Base64::IsBase64(Byte c)
 	{
-		return (isalnum(c) || (c == '+') || (c == '/'));
+		return utils::s_Base64DecodeTable.Values[c] != BASE64_INVALID;
 	}
-	
+
+	uint64 Base64::Encode(const Byte *buffer, uint64 bufferLength, char *out)
+	{
+		const uint64 encoded = utils::EncodeBlocks(buffer, bufferLength, out);
+		const uint64 remaining = bufferLength - encoded;
+		if (remaining == 0)
+			return (encoded / 3) * 4;
+
+		char *tail = out + (encoded / 3) * 4;
+		const uint32 value = ((uint32)buffer[encoded] << 16) | (remaining == 2 ? (uint32)buffer[encoded + 1] << 8 : 0);
+		tail[0] = s_Base64Chars[value >> 18];
+		tail[1] = s_Base64Chars[(value >> 12) & 0x3F];
+		tail[2] = remaining == 2 ? s_Base64Chars[(value >> 6) & 0x3F] : '=';
+		tail[3] = '=';
+		return GetEncodedLength(bufferLength);
+	}
+
+	bool Base64::Decode(const char *encoded, uint64 length, Byte *out, uint64 &outLength)
+	{
+		uint64 i = utils::DecodeBlocks(encoded, length, out);
+		uint64 written = (i / 4) * 3;
+
+		// The last block can be shorter or padded, it is decoded until the first character, that is not part of the alphabet
+		uint32 values[4] = {};
+		uint32 count = 0;
+		for (; i < length && count < 4; ++i)
+		{
+			const uint8 value = utils::s_Base64DecodeTable.Values[(uint8)encoded[i]];
+			if (value == BASE64_INVALID)
+				break;
+
+			values[count++] = value;
+		}
+
+		const uint32 value = (values[0] << 18) | (values[1] << 12) | (values[2] << 6) | values[3];
+		if (count >= 2)
+			out[written++] = (Byte)(value >> 16);
+
+		if (count >= 3)
+			out[written++] = (Byte)(value >> 8);
+
+		outLength = written;
+
+		// Only the padding of the last block may follow
+		uint64 padding = 0;
+		for (; i < length && encoded[i] == '='; ++i)
+			++padding;
+
+		if (i != length || count == 1)
+			return false;
+
+		return padding == 0 || count + padding == 4;
+	}
+
 	HLString Base64::Encode(const Byte *buffer, uint32 bufferLength)
 	{
-        HLString result;
-        int32 i = 0;
-        int32 j = 0;
-        Byte char_array_3[3];
-        Byte char_array_4[4];
-
-        while (bufferLength--)
-        {
-            char_array_3[i++] = *(buffer++);
-            if (i == 3)
-            {
-                char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-                char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-                char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-                char_array_4[3] = char_array_3[2] & 0x3f;
-
-                for (i = 0; (i < 4); i++)
-                    result += base64_chars[char_array_4[i]];
-                i = 0;
-            }
-        }
-
-        if (i)
-        {
-            for (j = i; j < 3; j++)
-                char_array_3[j] = '\0';
-
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-
-            for (j = 0; (j < i + 1); j++)
-                result += base64_chars[char_array_4[j]];
-
-            while ((i++ < 3))
-                result += '=';
-        }
-
-        return result;
-    }
-	
+		HLString result;
+		result.Resize((uint32)GetEncodedLength(bufferLength));
+		Encode(buffer, bufferLength, *result);
+		return result;
+	}
+
 	std::vector<Byte> Base64::Decode(const HLString &encodedString)
 	{
-        int32 in_len = (int32)encodedString.Length();
-        int32 i = 0;
-        int32 j = 0;
-        int32 in_ = 0;
-        Byte char_array_4[4], char_array_3[3];
-        std::vector<Byte> result;
-
-        while (in_len-- && (encodedString[in_] != '=') && IsBase64(encodedString[in_]))
-        {
-            char_array_4[i++] = encodedString[in_]; in_++;
-            if (i == 4)
-            {
-                for (i = 0; i < 4; i++)
-                    char_array_4[i] = base64_chars.IndexOf(char_array_4[i]);
-
-                char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-                char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-                char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-                for (i = 0; (i < 3); i++)
-                    result.push_back(char_array_3[i]);
-                i = 0;
-            }
-        }
-
-        if (i)
-        {
-            for (j = i; j < 4; j++)
-                char_array_4[j] = 0;
-
-            for (j = 0; j < 4; j++)
-                char_array_4[j] = base64_chars.IndexOf(char_array_4[j]);
-
-            char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-            char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-            char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-            for (j = 0; (j < i - 1); j++)
-                result.push_back(char_array_3[j]);
-        }
-
-        return result;
-    }
-	
+		std::vector<Byte> result(GetMaxDecodedLength(encodedString.Length()));
+
+		uint64 length = 0;
+		Decode(*encodedString, encodedString.Length(), result.data(), length);
+		result.resize(length);
+		return result;
+	}
+
 	HLString Base64::DecodeToString(const HLString &encodedString)
 	{
-        int32 in_len = (int32)encodedString.Length();
-        int32 i = 0;
-        int32 j = 0;
-        int32 in_ = 0;
-        unsigned char char_array_4[4], char_array_3[3];
-        HLString result;
-
-        while (in_len-- && (encodedString[in_] != '=') && IsBase64(encodedString[in_]))
-        {
-            char_array_4[i++] = encodedString[in_]; in_++;
-            if (i == 4)
-            {
-                for (i = 0; i < 4; i++)
-                    char_array_4[i] = base64_chars.IndexOf(char_array_4[i]);
-
-                char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-                char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-                char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-                for (i = 0; (i < 3); i++)
-                    result += char_array_3[i];
-                i = 0;
-            }
-        }
-
-        if (i)
-        {
-            for (j = i; j < 4; j++)
-                char_array_4[j] = 0;
-
-            for (j = 0; j < 4; j++)
-                char_array_4[j] = base64_chars.IndexOf(char_array_4[j]);
-
-            char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-            char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-            char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
-
-            for (j = 0; (j < i - 1); j++)
-                result += char_array_3[j];
-        }
-
-        return result;
-    }
+		HLString result;
+		result.Resize((uint32)GetMaxDecodedLength(encodedString.Length()));
+
+		uint64 length = 0;
+		Decode(*encodedString, encodedString.Length(), (Byte*)*result, length);
+		result.Resize((uint32)length);
+		return result;
+	}
+
+	uint64 Base64Encoder::Update(const Byte *data, uint64 length, char *out)
+	{
+		uint64 written = 0;
+		if (m_PendingCount > 0)
+		{
+			while (m_PendingCount < 3 && length > 0)
+			{
+				m_Pending[m_PendingCount++] = *data++;
+				--length;
+			}
+
+			if (m_PendingCount < 3)
+				return 0;
+
+			written = Base64::Encode(m_Pending, 3, out);
+			m_PendingCount = 0;
+		}
+
+		const uint64 blockBytes = (length / 3) * 3;
+		written += Base64::Encode(data, blockBytes, out + written);
+
+		for (uint64 i = blockBytes; i < length; ++i)
+			m_Pending[m_PendingCount++] = data[i];
+
+		return written;
+	}
+
+	uint64 Base64Encoder::Finish(char *out)
+	{
+		const uint64 written = Base64::Encode(m_Pending, m_PendingCount, out);
+		m_PendingCount = 0;
+		return written;
+	}
+
+	bool Base64Decoder::Update(const char *data, uint64 length, Byte *out, uint64 &outLength)
+	{
+		outLength = 0;
+		if (m_Failed)
+			return false;
+
+		// The last block is always kept back, because it is the only one, that can contain padding
+		const uint64 total = m_PendingCount + length;
+		if (total <= 4)
+		{
+			memcpy(m_Pending + m_PendingCount, data, length);
+			m_PendingCount += (uint32)length;
+			return true;
+		}
+
+		uint64 decodeCount = ((total - 1) / 4) * 4;
+		if (m_PendingCount > 0)
+		{
+			const uint32 missing = 4 - m_PendingCount;
+			memcpy(m_Pending + m_PendingCount, data, missing);
+			data += missing;
+			length -= missing;
+			decodeCount -= 4;
+
+			if (utils::DecodeBlocks(m_Pending, 4, out) != 4)
+			{
+				m_Failed = true;
+				return false;
+			}
+
+			outLength = 3;
+			m_PendingCount = 0;
+		}
+
+		if (utils::DecodeBlocks(data, decodeCount, out + outLength) != decodeCount)
+		{
+			m_Failed = true;
+			return false;
+		}
+
+		outLength += (decodeCount / 4) * 3;
+
+		m_PendingCount = (uint32)(length - decodeCount);
+		memcpy(m_Pending, data + decodeCount, m_PendingCount);
+		return true;
+	}
+
+	bool Base64Decoder::Finish(Byte *out, uint64 &outLength)
+	{
+		const bool valid = Base64::Decode(m_Pending, m_PendingCount, out, outLength) && !m_Failed;
+		if (!valid)
+			outLength = 0;
+
+		m_PendingCount = 0;
+		m_Failed = false;
+		return valid;
+	}
 }
 
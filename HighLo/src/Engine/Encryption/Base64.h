@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added vectorized kernels, that encode and decode into caller buffers, and the streaming Base64Encoder and Base64Decoder
 //     - 1.0 (2021-09-14) initial release
 //
 
@@ -9,14 +10,99 @@
 
 namespace highlo
 {
+	/// <summary>
+	/// Base64 with the standard alphabet and '=' padding.
+	/// On x64 the kernels process 12 input bytes per step with SSSE3 and 24 with AVX2, if the processor supports them,
+	/// otherwise a table based scalar version is used.
+	/// </summary>
 	class Base64
 	{
 	public:
 
 		HLAPI static bool IsBase64(Byte c);
+
+		/// <summary>
+		/// Returns the number of characters, that the encoded bytes take up including the padding.
+		/// </summary>
+		HLAPI static uint64 GetEncodedLength(uint64 byteCount) { return ((byteCount + 2) / 3) * 4; }
+
+		/// <summary>
+		/// Returns the number of bytes, that a decode buffer for the given number of characters needs.
+		/// </summary>
+		HLAPI static uint64 GetMaxDecodedLength(uint64 charCount) { return ((charCount + 3) / 4) * 3; }
+
+		/// <summary>
+		/// Encodes the buffer into out, which needs space for GetEncodedLength(bufferLength) characters. No null terminator is written.
+		/// </summary>
+		/// <returns>Returns the number of written characters.</returns>
+		HLAPI static uint64 Encode(const Byte *buffer, uint64 bufferLength, char *out);
+
+		/// <summary>
+		/// Decodes the characters into out, which needs space for GetMaxDecodedLength(length) bytes.
+		/// The padding at the end is optional, everything after the first character, that is neither part of the alphabet nor padding, is ignored.
+		/// </summary>
+		/// <param name="outLength">Receives the number of bytes, that have been decoded until the end or the first invalid character.</param>
+		/// <returns>Returns false, if the input contains invalid characters or ends with a single character of a block.</returns>
+		HLAPI static bool Decode(const char *encoded, uint64 length, Byte *out, uint64 &outLength);
+
 		HLAPI static HLString Encode(const Byte *buffer, uint32 bufferLength);
 		HLAPI static std::vector<Byte> Decode(const HLString &encodedString);
 		HLAPI static HLString DecodeToString(const HLString &encodedString);
 	};
+
+	/// <summary>
+	/// Encodes a payload, that arrives in chunks of any size, without holding the whole payload in memory.
+	/// The encoded chunks can be concatenated and are the same as the result of Base64::Encode for the whole payload.
+	/// </summary>
+	class Base64Encoder
+	{
+	public:
+
+		/// <summary>
+		/// Encodes all complete blocks of 3 bytes and keeps the remaining bytes for the next call.
+		/// out needs space for Base64::GetEncodedLength(length + 2) characters.
+		/// </summary>
+		/// <returns>Returns the number of written characters.</returns>
+		HLAPI uint64 Update(const Byte *data, uint64 length, char *out);
+
+		/// <summary>
+		/// Encodes the remaining bytes with padding into out, which needs space for 4 characters, and resets the encoder.
+		/// </summary>
+		/// <returns>Returns the number of written characters.</returns>
+		HLAPI uint64 Finish(char *out);
+
+	private:
+
+		Byte m_Pending[3] = {};
+		uint32 m_PendingCount = 0;
+	};
+
+	/// <summary>
+	/// Decodes a payload, that arrives in chunks of any size. Padding is only allowed in the last chunk.
+	/// </summary>
+	class Base64Decoder
+	{
+	public:
+
+		/// <summary>
+		/// Decodes all blocks except the last one, which can contain padding and is decoded by Finish.
+		/// out needs space for Base64::GetMaxDecodedLength(length + 4) bytes.
+		/// </summary>
+		/// <param name="outLength">Receives the number of written bytes.</param>
+		/// <returns>Returns false, if the chunk contains invalid characters. The decoder stays failed until Finish is called.</returns>
+		HLAPI bool Update(const char *data, uint64 length, Byte *out, uint64 &outLength);
+
+		/// <summary>
+		/// Decodes the last block into out, which needs space for 3 bytes, and resets the decoder.
+		/// </summary>
+		/// <returns>Returns false, if the payload has been invalid.</returns>
+		HLAPI bool Finish(Byte *out, uint64 &outLength);
+
+	private:
+
+		char m_Pending[4] = {};
+		uint32 m_PendingCount = 0;
+		bool m_Failed = false;
+	};
 }
 
@@ -3,13 +3,29 @@
 #include "HighLoPch.h"
 #include "Encryptor.h"
 
+#include <atomic>
+#include <filesystem>
+
 #include <openssl/conf.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#include "Engine/Core/MappedFile.h"
+#include "Engine/Threading/Thread.h"
+#include "Engine/Threading/ThreadPool.h"
+
+#define ENCRYPTOR_LOG_PREFIX "Encryptor>    "
 
 namespace highlo
 {
-	static EVP_CIPHER_CTX *s_CipherContext = nullptr;
-	
+	// The authenticated algorithms use 96 bit nonces and 128 bit tags. With CCM the nonce size limits one message to 16 MB.
+	static constexpr uint32 s_NonceSize = 12;
+	static constexpr uint32 s_TagSize = 16;
+
+	// The file functions read and write through buffers of this size
+	static constexpr uint32 s_FileChunkSize = 1024 * 1024;
+
 	namespace utils
 	{
 		static const EVP_CIPHER *ConvertAlgorithmFromType(EncryptionAlgorithm algorithm)
@@ -43,7 +59,14 @@ namespace highlo
 				case EncryptionAlgorithm::AES_192_CFB:
 					return EVP_aes_192_cfb128();
 
+				case EncryptionAlgorithm::AES_128_GCM:
+					return EVP_aes_128_gcm();
+
+				case EncryptionAlgorithm::AES_256_GCM:
+					return EVP_aes_256_gcm();
 
+				case EncryptionAlgorithm::AES_192_GCM:
+					return EVP_aes_192_gcm();
 
 				case EncryptionAlgorithm::None:
 				default:
@@ -51,17 +74,502 @@ namespace highlo
 					return nullptr;
 			}
 		}
+
+		static bool IsCCMAlgorithm(EncryptionAlgorithm algorithm)
+		{
+			return algorithm == EncryptionAlgorithm::AES_128_CCM || algorithm == EncryptionAlgorithm::AES_256_CCM || algorithm == EncryptionAlgorithm::AES_192_CCM;
+		}
+
+		static bool IsGCMAlgorithm(EncryptionAlgorithm algorithm)
+		{
+			return algorithm == EncryptionAlgorithm::AES_128_GCM || algorithm == EncryptionAlgorithm::AES_256_GCM || algorithm == EncryptionAlgorithm::AES_192_GCM;
+		}
+
+		/// <summary>
+		/// Owns the cipher context of one thread. Creating a context allocates and initializing it again is cheap,
+		/// so every thread keeps its context for all following messages.
+		/// </summary>
+		struct ThreadCipherContext
+		{
+			EVP_CIPHER_CTX *Handle = nullptr;
+
+			~ThreadCipherContext()
+			{
+				Release();
+			}
+
+			void Release()
+			{
+				if (Handle)
+				{
+					EVP_CIPHER_CTX_free(Handle);
+					Handle = nullptr;
+				}
+			}
+		};
+
+		static thread_local ThreadCipherContext s_ThreadCipherContext;
+
+		static EVP_CIPHER_CTX *GetThreadCipherContext()
+		{
+			if (!s_ThreadCipherContext.Handle)
+			{
+				s_ThreadCipherContext.Handle = EVP_CIPHER_CTX_new();
+				if (!s_ThreadCipherContext.Handle)
+					HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Cipher context could not be created [-]");
+			}
+
+			return s_ThreadCipherContext.Handle;
+		}
+
+		/// <summary>
+		/// OpenSSL takes the lengths as int, so bigger inputs are passed in pieces.
+		/// </summary>
+		static bool CipherUpdate(EVP_CIPHER_CTX *context, const Byte *data, uint64 length, Byte *out, uint64 &outLength)
+		{
+			outLength = 0;
+			while (length > 0)
+			{
+				const int32 piece = (int32)HL_MIN(length, (uint64)(1 << 30));
+				int32 written = 0;
+				if (!EVP_CipherUpdate(context, out + outLength, &written, data, piece))
+					return false;
+
+				outLength += written;
+				data += piece;
+				length -= piece;
+			}
+
+			return true;
+		}
+
+		static bool AddAssociatedData(EVP_CIPHER_CTX *context, const Byte *data, uint64 length)
+		{
+			while (length > 0)
+			{
+				const int32 piece = (int32)HL_MIN(length, (uint64)(1 << 30));
+				int32 written = 0;
+				if (!EVP_CipherUpdate(context, nullptr, &written, data, piece))
+					return false;
+
+				data += piece;
+				length -= piece;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Encrypts or decrypts one complete message with the given iv or nonce. The cipher text of the authenticated algorithms ends with the tag,
+		/// the nonce is stored by the callers. The last block is written through a local buffer, so nothing after outCapacity is touched,
+		/// even if the padding of a manipulated message claims more bytes.
+		/// </summary>
+		static bool CryptMessage(EVP_CIPHER_CTX *context, EncryptionAlgorithm algorithm, bool encrypt, const Byte *key, const Byte *iv,
+								 const Byte *data, uint64 length, const Byte *associatedData, uint64 associatedDataLength,
+								 Byte *out, uint64 outCapacity, uint64 &outLength)
+		{
+			outLength = 0;
+
+			const EVP_CIPHER *cipher = ConvertAlgorithmFromType(algorithm);
+			if (!context || !cipher)
+				return false;
+
+			const bool ccm = IsCCMAlgorithm(algorithm);
+			const bool authenticated = ccm || IsGCMAlgorithm(algorithm);
+
+			const Byte *tag = nullptr;
+			if (authenticated && !encrypt)
+			{
+				if (length < s_TagSize)
+					return false;
+
+				length -= s_TagSize;
+				tag = data + length;
+			}
+
+			// Padded cipher texts consist of whole blocks and the decryption holds the last block back until the padding has been checked
+			uint64 updateLength = length;
+			const uint64 blockSize = (uint64)EVP_CIPHER_block_size(cipher);
+			if (!encrypt && blockSize > 1)
+			{
+				if (length == 0 || length % blockSize != 0)
+					return false;
+
+				updateLength = length - blockSize;
+			}
+
+			if (!EVP_CipherInit_ex(context, cipher, nullptr, nullptr, nullptr, encrypt ? 1 : 0))
+				return false;
+
+			if (authenticated)
+			{
+				if (!EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_AEAD_SET_IVLEN, s_NonceSize, nullptr))
+					return false;
+
+				// CCM needs the tag length and the expected tag before the key
+				if (ccm && !EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_AEAD_SET_TAG, s_TagSize, (void*)tag))
+					return false;
+			}
+
+			if (!EVP_CipherInit_ex(context, nullptr, nullptr, key, iv, -1))
+				return false;
+
+			int32 written = 0;
+			if (ccm)
+			{
+				// CCM has to know the message length before the associated data and processes the message in one call
+				if (length > (uint64)INT32_MAX || length > outCapacity || !EVP_CipherUpdate(context, nullptr, &written, nullptr, (int32)length))
+					return false;
+			}
+
+			if (authenticated && associatedDataLength > 0 && !AddAssociatedData(context, associatedData, associatedDataLength))
+				return false;
+
+			if (ccm)
+			{
+				// When decrypting, this call already verifies the tag. A null input would be taken for the length again, so empty messages pass the output instead
+				if (!EVP_CipherUpdate(context, out, &written, data ? data : out, (int32)length))
+					return false;
+
+				outLength = written;
+				if (!encrypt)
+					return true;
+			}
+			else
+			{
+				if (updateLength > outCapacity || !CipherUpdate(context, data, length, out, outLength))
+					return false;
+
+				if (tag && !EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_AEAD_SET_TAG, s_TagSize, (void*)tag))
+					return false;
+			}
+
+			Byte lastBlock[EVP_MAX_BLOCK_LENGTH];
+			if (!EVP_CipherFinal_ex(context, lastBlock, &written) || outLength + written > outCapacity)
+				return false;
+
+			// out is null for an empty message, so nothing may be copied into it
+			if (written > 0)
+			{
+				memcpy(out + outLength, lastBlock, written);
+				outLength += written;
+			}
+
+			if (authenticated && encrypt)
+			{
+				if (outLength + s_TagSize > outCapacity || !EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_AEAD_GET_TAG, s_TagSize, out + outLength))
+					return false;
+
+				outLength += s_TagSize;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Checks, that the key and the iv are long enough for the algorithm, OpenSSL would read after their end otherwise.
+		/// </summary>
+		static bool ValidateKeyMaterial(const HLString &key, const HLString &iv, EncryptionAlgorithm algorithm)
+		{
+			if (algorithm == EncryptionAlgorithm::None)
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] No algorithm has been selected [-]");
+				return false;
+			}
+
+			const EVP_CIPHER *cipher = ConvertAlgorithmFromType(algorithm);
+			if (key.Length() < (uint32)EVP_CIPHER_key_length(cipher))
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] The key has {0} bytes, but the algorithm needs {1} bytes [-]", key.Length(), EVP_CIPHER_key_length(cipher));
+				return false;
+			}
+
+			const bool authenticated = IsCCMAlgorithm(algorithm) || IsGCMAlgorithm(algorithm);
+			if (!authenticated && iv.Length() < (uint32)EVP_CIPHER_iv_length(cipher))
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] The iv has {0} bytes, but the algorithm needs {1} bytes [-]", iv.Length(), EVP_CIPHER_iv_length(cipher));
+				return false;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Derives the iv or nonce of a chunk by mixing the chunk index into the last four bytes. Chunk 0 uses the base unchanged.
+		/// </summary>
+		static void DeriveChunkIV(const Byte *baseIV, uint32 ivLength, uint32 chunkIndex, Byte *outIV)
+		{
+			memcpy(outIV, baseIV, ivLength);
+			outIV[ivLength - 4] ^= (Byte)(chunkIndex >> 24);
+			outIV[ivLength - 3] ^= (Byte)(chunkIndex >> 16);
+			outIV[ivLength - 2] ^= (Byte)(chunkIndex >> 8);
+			outIV[ivLength - 1] ^= (Byte)chunkIndex;
+		}
+
+		static HLString BytesToString(const std::vector<Byte> &bytes)
+		{
+			return bytes.empty() ? HLString() : HLString((const char*)bytes.data(), (uint32)bytes.size());
+		}
+
+		static bool CryptFile(CipherStream &stream, const FileSystemPath &source, const FileSystemPath &destination)
+		{
+			if (!stream.IsValid())
+				return false;
+
+			FileStreamReader reader(source, s_FileChunkSize);
+			if (!reader.IsOpen())
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Failed to open {0} [-]", *source.String());
+				return false;
+			}
+
+			// The result is written to a temporary file first, so a failed authentication never leaves unverified data at the destination
+			HLString tempName = fmt::format("{0}.{1}.tmp", *destination.String(), Thread::GetCurrentThreadID());
+			std::ofstream out(*tempName, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!out)
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Failed to create {0} [-]", *destination.String());
+				return false;
+			}
+
+			std::vector<Byte> buffer(s_FileChunkSize + CipherStream::MaxOverhead);
+			bool success = true;
+
+			const Byte *chunk = nullptr;
+			uint64 chunkSize = 0;
+			while (success && (chunkSize = reader.ReadChunk(chunk, s_FileChunkSize)) > 0)
+			{
+				uint64 written = 0;
+				success = stream.Update(chunk, chunkSize, buffer.data(), written);
+				out.write((const char*)buffer.data(), written);
+			}
+
+			uint64 written = 0;
+			success = stream.Finish(buffer.data(), written) && success;
+			out.write((const char*)buffer.data(), written);
+			success = success && out.good();
+			out.close();
+
+			std::error_code error;
+			if (success)
+			{
+				std::filesystem::rename(*tempName, *destination.String(), error);
+				success = !error;
+			}
+
+			if (!success)
+			{
+				std::filesystem::remove(*tempName, error);
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Failed to process {0} [-]", *source.String());
+				return false;
+			}
+
+			return true;
+		}
 	}
 
-	Encryptor::Encryptor(const HLString &key, const HLString &iv, EncryptionAlgorithm algorithm)
-		: m_Key(key), m_IV(iv), m_Algorithm(algorithm)
+	CipherStream::~CipherStream()
 	{
-		if (!s_CipherContext)
+		Release();
+	}
+
+	CipherStream::CipherStream(CipherStream &&other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	CipherStream &CipherStream::operator=(CipherStream &&other) noexcept
+	{
+		if (this != &other)
 		{
-			s_CipherContext = EVP_CIPHER_CTX_new();
-			if (!s_CipherContext)
-				HL_CORE_ERROR("Error: Cipher context could not be created!");
+			Release();
+
+			m_Context = other.m_Context;
+			m_Key = std::move(other.m_Key);
+			m_AssociatedData = std::move(other.m_AssociatedData);
+			memcpy(m_Nonce, other.m_Nonce, sizeof(m_Nonce));
+			memcpy(m_Tag, other.m_Tag, sizeof(m_Tag));
+			m_NonceCount = other.m_NonceCount;
+			m_TagCount = other.m_TagCount;
+			m_Encrypt = other.m_Encrypt;
+			m_Authenticated = other.m_Authenticated;
+			m_Initialized = other.m_Initialized;
+			m_Failed = other.m_Failed;
+
+			other.m_Context = nullptr;
 		}
+
+		return *this;
+	}
+
+	bool CipherStream::Update(const Byte *data, uint64 length, Byte *out, uint64 &outLength)
+	{
+		outLength = 0;
+		if (!IsValid())
+			return false;
+
+		if (m_Encrypt)
+		{
+			// The nonce goes in front of the cipher text
+			if (m_Authenticated && m_NonceCount == 0)
+			{
+				memcpy(out, m_Nonce, s_NonceSize);
+				m_NonceCount = s_NonceSize;
+				outLength = s_NonceSize;
+			}
+
+			uint64 written = 0;
+			if (!Process(data, length, out + outLength, written))
+				return false;
+
+			outLength += written;
+			return true;
+		}
+
+		if (!m_Authenticated)
+			return Process(data, length, out, outLength);
+
+		if (!m_Initialized)
+		{
+			const uint32 nonceBytes = (uint32)HL_MIN((uint64)(s_NonceSize - m_NonceCount), length);
+			memcpy(m_Nonce + m_NonceCount, data, nonceBytes);
+			m_NonceCount += nonceBytes;
+			data += nonceBytes;
+			length -= nonceBytes;
+
+			if (m_NonceCount < s_NonceSize)
+				return true;
+
+			if (!InitAuthenticated())
+				return false;
+		}
+
+		// The last bytes can be the tag, so they are held back until the next chunk arrives or Finish is called
+		const uint64 total = m_TagCount + length;
+		if (total <= s_TagSize)
+		{
+			memcpy(m_Tag + m_TagCount, data, length);
+			m_TagCount += (uint32)length;
+			return true;
+		}
+
+		const uint64 release = total - s_TagSize;
+		const uint32 heldRelease = (uint32)HL_MIN(release, (uint64)m_TagCount);
+		if (!Process(m_Tag, heldRelease, out, outLength))
+			return false;
+
+		memmove(m_Tag, m_Tag + heldRelease, m_TagCount - heldRelease);
+		m_TagCount -= heldRelease;
+
+		const uint64 dataRelease = release - heldRelease;
+		uint64 written = 0;
+		if (!Process(data, dataRelease, out + outLength, written))
+			return false;
+
+		outLength += written;
+
+		memcpy(m_Tag + m_TagCount, data + dataRelease, length - dataRelease);
+		m_TagCount += (uint32)(length - dataRelease);
+		return true;
+	}
+
+	bool CipherStream::Finish(Byte *out, uint64 &outLength)
+	{
+		outLength = 0;
+		if (!IsValid())
+		{
+			Release();
+			return false;
+		}
+
+		bool valid = true;
+		int32 written = 0;
+		if (m_Encrypt)
+		{
+			if (m_Authenticated && m_NonceCount == 0)
+			{
+				memcpy(out, m_Nonce, s_NonceSize);
+				m_NonceCount = s_NonceSize;
+				outLength = s_NonceSize;
+			}
+
+			valid = EVP_CipherFinal_ex(m_Context, out + outLength, &written) == 1;
+			outLength += written;
+
+			if (valid && m_Authenticated)
+			{
+				valid = EVP_CIPHER_CTX_ctrl(m_Context, EVP_CTRL_AEAD_GET_TAG, s_TagSize, out + outLength) == 1;
+				outLength += s_TagSize;
+			}
+		}
+		else if (m_Authenticated)
+		{
+			valid = m_Initialized && m_TagCount == s_TagSize
+				&& EVP_CIPHER_CTX_ctrl(m_Context, EVP_CTRL_AEAD_SET_TAG, s_TagSize, m_Tag) == 1
+				&& EVP_CipherFinal_ex(m_Context, out, &written) == 1;
+			outLength = written;
+		}
+		else
+		{
+			valid = EVP_CipherFinal_ex(m_Context, out, &written) == 1;
+			outLength = written;
+		}
+
+		if (!valid)
+			outLength = 0;
+
+		Release();
+		return valid;
+	}
+
+	bool CipherStream::InitAuthenticated()
+	{
+		m_Initialized = EVP_CipherInit_ex(m_Context, nullptr, nullptr, m_Key.data(), m_Nonce, -1)
+			&& (m_AssociatedData.empty() || utils::AddAssociatedData(m_Context, m_AssociatedData.data(), m_AssociatedData.size()));
+
+		OPENSSL_cleanse(m_Key.data(), m_Key.size());
+		m_Key.clear();
+
+		if (!m_Initialized)
+			m_Failed = true;
+
+		return m_Initialized;
+	}
+
+	bool CipherStream::Process(const Byte *data, uint64 length, Byte *out, uint64 &outLength)
+	{
+		if (!utils::CipherUpdate(m_Context, data, length, out, outLength))
+		{
+			m_Failed = true;
+			return false;
+		}
+
+		return true;
+	}
+
+	void CipherStream::Release()
+	{
+		if (m_Context)
+		{
+			EVP_CIPHER_CTX_free(m_Context);
+			m_Context = nullptr;
+		}
+
+		if (!m_Key.empty())
+		{
+			OPENSSL_cleanse(m_Key.data(), m_Key.size());
+			m_Key.clear();
+		}
+
+		m_NonceCount = 0;
+		m_TagCount = 0;
+		m_Initialized = false;
+		m_Failed = false;
+	}
+
+	Encryptor::Encryptor(const HLString &key, const HLString &iv, EncryptionAlgorithm algorithm)
+		: m_Key(key), m_IV(iv), m_Algorithm(algorithm)
+	{
 	}
 
 	Encryptor::~Encryptor()
@@ -73,86 +581,392 @@ namespace highlo
 		// This Init function is used by the engine itself, without the user being able to manipulate parameters here
 
 // TODO: all the passphrases, salts, keys and ivs are going to be part of config files in the future, we don't want them to be accessible directly here
-		// because the source is open and it shouldn't be visible to the public. 
+		// because the source is open and it shouldn't be visible to the public.
 
 		// Pass = secretPassPhrase
 		// Salt = 2986C2DB93452761
 		m_Key = "58E7151818B518BF2A490389C8EE1C150F0C50D9564A9A6688215F9AA9397F77";
 		m_IV = "8ED75991622CE5C4EB201C26B31D60A1";
 		m_Algorithm = EncryptionAlgorithm::AES_256_CBC;
-		
-		if (!s_CipherContext)
-		{
-			s_CipherContext = EVP_CIPHER_CTX_new();
-			if (!s_CipherContext)
-				std::cout << "Error: Cipher context could not be created!" << std::endl;
-		}
 	}
 
 	void Encryptor::Shutdown()
 	{
-		if (s_CipherContext)
-			EVP_CIPHER_CTX_free(s_CipherContext);
+		utils::s_ThreadCipherContext.Release();
 	}
-	
+
 	HLString Encryptor::Encrypt(const HLString &plainText)
 	{
-		int32 length = 0;
-		uint32 ciphertextLength = 0;
-		unsigned char resultCipher[4096];
-		unsigned char *plainTextRaw = (unsigned char*)*plainText;
+		std::vector<Byte> cipher;
+		if (!Encrypt((const Byte*)*plainText, plainText.Length(), cipher))
+			return HLString();
 
-		if (!EVP_EncryptInit_ex(s_CipherContext, utils::ConvertAlgorithmFromType(m_Algorithm), NULL, (unsigned char*)*m_Key, (unsigned char*)*m_IV))
-			std::cout << "Error: Could not initialize the Encryptor" << std::endl;
+		return utils::BytesToString(cipher);
+	}
 
-		if (!EVP_EncryptUpdate(s_CipherContext, resultCipher, &length, plainTextRaw, plainText.Length()))
-			std::cout << "Error: Could not update the encryption" << std::endl;
+	HLString Encryptor::Decrypt(const HLString &cipherText)
+	{
+		std::vector<Byte> plain;
+		if (!Decrypt((const Byte*)*cipherText, cipherText.Length(), plain))
+			return HLString();
 
-		ciphertextLength = length;
+		return utils::BytesToString(plain);
+	}
 
-		if (!EVP_EncryptFinal_ex(s_CipherContext, resultCipher + length, &length))
-			std::cout << "Error: Could not encrypt" << std::endl;
+	HLString Encryptor::EncryptBase64(const HLString &plainText)
+	{
+		std::vector<Byte> cipher;
+		if (!Encrypt((const Byte*)*plainText, plainText.Length(), cipher))
+			return HLString();
 
-		ciphertextLength += length;
-		HLString result = HLString((const char*)resultCipher, ciphertextLength);
-	//	delete[] &resultCipher;
-		return result;
+		return Base64::Encode(cipher.data(), (uint32)cipher.size());
 	}
-	
-	HLString Encryptor::Decrypt(const HLString &cipherText)
+
+	HLString Encryptor::DecryptBase64(const HLString &cipherText)
 	{
-		int32 length = 0;
-		uint32 plaintextLength = 0;
-		unsigned char resultPlainText[4096];
-		unsigned char *cipherTextRaw = (unsigned char*)*cipherText;
+		std::vector<Byte> cipher(Base64::GetMaxDecodedLength(cipherText.Length()));
+		uint64 cipherLength = 0;
+		Base64::Decode(*cipherText, cipherText.Length(), cipher.data(), cipherLength);
 
-		if (!EVP_DecryptInit_ex(s_CipherContext, utils::ConvertAlgorithmFromType(m_Algorithm), NULL, (unsigned char*)*m_Key, (unsigned char*)*m_IV))
-			std::cout << "Error: Could not initialize the decryptor" << std::endl;
+		std::vector<Byte> plain;
+		if (!Decrypt(cipher.data(), cipherLength, plain))
+			return HLString();
 
-		if (!EVP_DecryptUpdate(s_CipherContext, resultPlainText, &length, cipherTextRaw, cipherText.Length()))
-			std::cout << "Error: Could not update the decryption" << std::endl;
+		return utils::BytesToString(plain);
+	}
+
+	bool Encryptor::Encrypt(const Byte *data, uint64 length, std::vector<Byte> &outCipher, const Byte *associatedData, uint64 associatedDataLength) const
+	{
+		outCipher.clear();
+		if (!utils::ValidateKeyMaterial(m_Key, m_IV, m_Algorithm))
+			return false;
 
-		plaintextLength = length;
+		outCipher.resize(GetCipherLength(length));
 
-		if (!EVP_DecryptFinal_ex(s_CipherContext, resultPlainText + length, &length))
-			std::cout << "Error: Could not decrypt" << std::endl;
+		const Byte *iv = (const Byte*)*m_IV;
+		uint64 headerSize = 0;
+		if (IsAuthenticated())
+		{
+			if (RAND_bytes(outCipher.data(), s_NonceSize) != 1)
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not generate a nonce [-]");
+				outCipher.clear();
+				return false;
+			}
+
+			iv = outCipher.data();
+			headerSize = s_NonceSize;
+		}
 
-		plaintextLength += length;
-		HLString result = HLString((const char*)resultPlainText, plaintextLength);
-	//	delete[] &resultPlainText;
-		return result;
+		uint64 written = 0;
+		if (!utils::CryptMessage(utils::GetThreadCipherContext(), m_Algorithm, true, (const Byte*)*m_Key, iv, data, length, associatedData, associatedDataLength,
+								 outCipher.data() + headerSize, outCipher.size() - headerSize, written))
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not encrypt [-]");
+			outCipher.clear();
+			return false;
+		}
+
+		outCipher.resize(headerSize + written);
+		return true;
 	}
-	
-	HLString Encryptor::EncryptBase64(const HLString &plainText)
+
+	bool Encryptor::Decrypt(const Byte *data, uint64 length, std::vector<Byte> &outPlain, const Byte *associatedData, uint64 associatedDataLength) const
 	{
-		HLString cipher = Encrypt(plainText);
-		return Base64::Encode((Byte*)*cipher, cipher.Length());
+		outPlain.clear();
+		if (!utils::ValidateKeyMaterial(m_Key, m_IV, m_Algorithm))
+			return false;
+
+		const Byte *iv = (const Byte*)*m_IV;
+		if (IsAuthenticated())
+		{
+			if (length < s_NonceSize + s_TagSize)
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] The cipher text is too short [-]");
+				return false;
+			}
+
+			iv = data;
+			data += s_NonceSize;
+			length -= s_NonceSize;
+		}
+
+		// A plain text is never longer than its cipher text, the extra block keeps OpenSSL from needing more space
+		outPlain.resize(length + EVP_MAX_BLOCK_LENGTH);
+
+		uint64 written = 0;
+		if (!utils::CryptMessage(utils::GetThreadCipherContext(), m_Algorithm, false, (const Byte*)*m_Key, iv, data, length, associatedData, associatedDataLength,
+								 outPlain.data(), outPlain.size(), written))
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not decrypt, the key is wrong or the data has been changed [-]");
+			outPlain.clear();
+			return false;
+		}
+
+		outPlain.resize(written);
+		return true;
 	}
-	
-	HLString Encryptor::DecryptBase64(const HLString &cipherText)
+
+	CipherStream Encryptor::CreateEncryptStream(const Byte *associatedData, uint64 associatedDataLength) const
+	{
+		CipherStream stream;
+		if (!utils::ValidateKeyMaterial(m_Key, m_IV, m_Algorithm))
+			return stream;
+
+		if (utils::IsCCMAlgorithm(m_Algorithm))
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] CCM can not be streamed [-]");
+			return stream;
+		}
+
+		stream.m_Context = EVP_CIPHER_CTX_new();
+		stream.m_Encrypt = true;
+		stream.m_Authenticated = IsAuthenticated();
+		if (!stream.m_Context)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Cipher context could not be created [-]");
+			return stream;
+		}
+
+		bool success = EVP_CipherInit_ex(stream.m_Context, utils::ConvertAlgorithmFromType(m_Algorithm), nullptr, nullptr, nullptr, 1) == 1;
+		if (stream.m_Authenticated)
+		{
+			success = success
+				&& EVP_CIPHER_CTX_ctrl(stream.m_Context, EVP_CTRL_AEAD_SET_IVLEN, s_NonceSize, nullptr) == 1
+				&& RAND_bytes(stream.m_Nonce, s_NonceSize) == 1
+				&& EVP_CipherInit_ex(stream.m_Context, nullptr, nullptr, (const Byte*)*m_Key, stream.m_Nonce, -1) == 1
+				&& utils::AddAssociatedData(stream.m_Context, associatedData, associatedDataLength);
+		}
+		else
+		{
+			success = success && EVP_CipherInit_ex(stream.m_Context, nullptr, nullptr, (const Byte*)*m_Key, (const Byte*)*m_IV, -1) == 1;
+		}
+
+		stream.m_Initialized = success;
+		if (!success)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not initialize the encryption stream [-]");
+			stream.m_Failed = true;
+		}
+
+		return stream;
+	}
+
+	CipherStream Encryptor::CreateDecryptStream(const Byte *associatedData, uint64 associatedDataLength) const
+	{
+		CipherStream stream;
+		if (!utils::ValidateKeyMaterial(m_Key, m_IV, m_Algorithm))
+			return stream;
+
+		if (utils::IsCCMAlgorithm(m_Algorithm))
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] CCM can not be streamed [-]");
+			return stream;
+		}
+
+		stream.m_Context = EVP_CIPHER_CTX_new();
+		stream.m_Encrypt = false;
+		stream.m_Authenticated = IsAuthenticated();
+		if (!stream.m_Context)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Cipher context could not be created [-]");
+			return stream;
+		}
+
+		bool success = EVP_CipherInit_ex(stream.m_Context, utils::ConvertAlgorithmFromType(m_Algorithm), nullptr, nullptr, nullptr, 0) == 1;
+		if (stream.m_Authenticated)
+		{
+			// The key is set, when the nonce at the beginning of the cipher text has arrived
+			success = success && EVP_CIPHER_CTX_ctrl(stream.m_Context, EVP_CTRL_AEAD_SET_IVLEN, s_NonceSize, nullptr) == 1;
+
+			const uint32 keyLength = (uint32)EVP_CIPHER_key_length(utils::ConvertAlgorithmFromType(m_Algorithm));
+			stream.m_Key.assign((const Byte*)*m_Key, (const Byte*)*m_Key + keyLength);
+			if (associatedDataLength > 0)
+				stream.m_AssociatedData.assign(associatedData, associatedData + associatedDataLength);
+		}
+		else
+		{
+			success = success && EVP_CipherInit_ex(stream.m_Context, nullptr, nullptr, (const Byte*)*m_Key, (const Byte*)*m_IV, -1) == 1;
+			stream.m_Initialized = success;
+		}
+
+		if (!success)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not initialize the decryption stream [-]");
+			stream.m_Failed = true;
+		}
+
+		return stream;
+	}
+
+	bool Encryptor::EncryptFileData(const FileSystemPath &source, const FileSystemPath &destination) const
+	{
+		CipherStream stream = CreateEncryptStream();
+		return utils::CryptFile(stream, source, destination);
+	}
+
+	bool Encryptor::DecryptFileData(const FileSystemPath &source, const FileSystemPath &destination) const
+	{
+		CipherStream stream = CreateDecryptStream();
+		return utils::CryptFile(stream, source, destination);
+	}
+
+	bool Encryptor::EncryptParallel(const Byte *data, uint64 length, std::vector<Byte> &outCipher, uint32 chunkSize) const
+	{
+		outCipher.clear();
+		if (!utils::ValidateKeyMaterial(m_Key, m_IV, m_Algorithm))
+			return false;
+
+		HL_ASSERT(chunkSize > 0, "The chunk size can not be 0!");
+
+		const bool authenticated = IsAuthenticated();
+		const uint64 headerSize = authenticated ? s_NonceSize : 0;
+		const uint64 chunkCipherSize = GetCipherLength(chunkSize) - headerSize;
+		const uint32 chunkCount = (uint32)HL_MAX(1ull, (length + chunkSize - 1) / chunkSize);
+		const uint64 lastChunkSize = length - (uint64)(chunkCount - 1) * chunkSize;
+
+		outCipher.resize(headerSize + (uint64)(chunkCount - 1) * chunkCipherSize + GetCipherLength(lastChunkSize) - headerSize);
+
+		const EVP_CIPHER *cipher = utils::ConvertAlgorithmFromType(m_Algorithm);
+		const uint32 ivLength = authenticated ? s_NonceSize : (uint32)EVP_CIPHER_iv_length(cipher);
+		const Byte *baseIV = (const Byte*)*m_IV;
+		if (authenticated)
+		{
+			if (RAND_bytes(outCipher.data(), s_NonceSize) != 1)
+			{
+				HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not generate a nonce [-]");
+				outCipher.clear();
+				return false;
+			}
+
+			baseIV = outCipher.data();
+		}
+
+		// Every chunk authenticates the total length, so a truncated cipher text fails even when it ends at a chunk boundary
+		const uint64 totalLength = length;
+		std::atomic<bool> failed = false;
+
+		// ParallelFor only runs the job for batches, that it waits for, so capturing the locals is safe, also when this is called from a pool job
+		ThreadPool::Get().ParallelFor(chunkCount, 1, [&](uint32 begin, uint32 end)
+		{
+			EVP_CIPHER_CTX *context = utils::GetThreadCipherContext();
+			for (uint32 i = begin; i < end; ++i)
+			{
+				Byte iv[EVP_MAX_IV_LENGTH];
+				utils::DeriveChunkIV(baseIV, ivLength, i, iv);
+
+				const uint64 offset = (uint64)i * chunkSize;
+				const uint64 size = (i == chunkCount - 1) ? lastChunkSize : chunkSize;
+				Byte *out = outCipher.data() + headerSize + (uint64)i * chunkCipherSize;
+				const uint64 capacity = outCipher.size() - (out - outCipher.data());
+
+				uint64 written = 0;
+				if (!utils::CryptMessage(context, m_Algorithm, true, (const Byte*)*m_Key, iv, data + offset, size, (const Byte*)&totalLength, sizeof(totalLength), out, capacity, written))
+					failed = true;
+			}
+		});
+
+		if (failed)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not encrypt [-]");
+			outCipher.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool Encryptor::DecryptParallel(const Byte *data, uint64 length, std::vector<Byte> &outPlain, uint32 chunkSize) const
+	{
+		outPlain.clear();
+		if (!utils::ValidateKeyMaterial(m_Key, m_IV, m_Algorithm))
+			return false;
+
+		HL_ASSERT(chunkSize > 0, "The chunk size can not be 0!");
+
+		const bool authenticated = IsAuthenticated();
+		const uint64 headerSize = authenticated ? s_NonceSize : 0;
+		if (length < headerSize)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] The cipher text is too short [-]");
+			return false;
+		}
+
+		const uint64 chunkCipherSize = GetCipherLength(chunkSize) - headerSize;
+		const uint64 bodySize = length - headerSize;
+		const uint32 chunkCount = (uint32)HL_MAX(1ull, (bodySize + chunkCipherSize - 1) / chunkCipherSize);
+
+		// The plain text length of a padded last chunk is only known after it has been decrypted, every other chunk has to fill its chunk completely
+		outPlain.resize((uint64)chunkCount * chunkSize);
+
+		const EVP_CIPHER *cipher = utils::ConvertAlgorithmFromType(m_Algorithm);
+		const uint32 ivLength = authenticated ? s_NonceSize : (uint32)EVP_CIPHER_iv_length(cipher);
+		const Byte *baseIV = authenticated ? data : (const Byte*)*m_IV;
+
+		// Without padding the total length follows from the cipher text length, it is the associated data of every chunk
+		const uint64 totalLength = authenticated ? bodySize - HL_MIN(bodySize, (uint64)chunkCount * s_TagSize) : 0;
+
+		std::atomic<bool> failed = false;
+		std::atomic<uint64> lastChunkSize = 0;
+
+		ThreadPool::Get().ParallelFor(chunkCount, 1, [&](uint32 begin, uint32 end)
+		{
+			EVP_CIPHER_CTX *context = utils::GetThreadCipherContext();
+			for (uint32 i = begin; i < end; ++i)
+			{
+				Byte iv[EVP_MAX_IV_LENGTH];
+				utils::DeriveChunkIV(baseIV, ivLength, i, iv);
+
+				const uint64 offset = headerSize + (uint64)i * chunkCipherSize;
+				const uint64 size = HL_MIN(chunkCipherSize, length - offset);
+				const Byte *associatedData = authenticated ? (const Byte*)&totalLength : nullptr;
+				const uint64 associatedDataLength = authenticated ? sizeof(totalLength) : 0;
+
+				uint64 written = 0;
+				if (!utils::CryptMessage(context, m_Algorithm, false, (const Byte*)*m_Key, iv, data + offset, size, associatedData, associatedDataLength,
+										 outPlain.data() + (uint64)i * chunkSize, chunkSize, written))
+				{
+					failed = true;
+					continue;
+				}
+
+				if (i == chunkCount - 1)
+					lastChunkSize = written;
+				else if (written != chunkSize)
+					failed = true;
+			}
+		});
+
+		if (failed)
+		{
+			HL_CORE_ERROR(ENCRYPTOR_LOG_PREFIX "[-] Could not decrypt, the key is wrong or the data has been changed [-]");
+			outPlain.clear();
+			return false;
+		}
+
+		outPlain.resize((uint64)(chunkCount - 1) * chunkSize + lastChunkSize);
+		return true;
+	}
+
+	uint64 Encryptor::GetCipherLength(uint64 plainLength) const
+	{
+		if (m_Algorithm == EncryptionAlgorithm::None)
+			return 0;
+
+		if (IsAuthenticated())
+			return s_NonceSize + plainLength + s_TagSize;
+
+		// Padded block ciphers always add a block, an empty message becomes one block of padding
+		const uint64 blockSize = (uint64)EVP_CIPHER_block_size(utils::ConvertAlgorithmFromType(m_Algorithm));
+		if (blockSize > 1)
+			return (plainLength / blockSize + 1) * blockSize;
+
+		return plainLength;
+	}
+
+	bool Encryptor::IsAuthenticated() const
 	{
-		HLString cipher = Base64::DecodeToString(cipherText);
-		return Decrypt(cipher);
+		return utils::IsCCMAlgorithm(m_Algorithm) || utils::IsGCMAlgorithm(m_Algorithm);
 	}
 }
 
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Added byte span, streaming, file and chunk-parallel encryption, AES-GCM and per-thread cipher contexts
 //     - 1.1 (2021-10-17) Refactored Encryption class to not have a extra unsigned char* function
 //     - 1.0 (2021-09-14) initial release
 //
@@ -9,8 +10,11 @@
 #pragma once
 
 #include "Engine/Core/Core.h"
+#include "Engine/Core/FileSystemPath.h"
 #include "Base64.h"
 
+struct evp_cipher_ctx_st;
+
 namespace highlo
 {
 	enum class EncryptionAlgorithm
@@ -29,9 +33,74 @@ namespace highlo
 		AES_256_CFB,
 		AES_192_CFB,
 
+		AES_128_GCM,
+		AES_256_GCM,
+		AES_192_GCM
+	};
+
+	/// <summary>
+	/// Encrypts or decrypts a payload, that arrives in chunks, with its own cipher context, so several streams can be active at the same time.
+	/// The output is the same as the one of Encryptor::Encrypt for the whole payload. CCM can not be streamed, because it needs the whole length up front.
+	/// </summary>
+	class CipherStream
+	{
+	public:
+
+		/// <summary>
+		/// Update and Finish never write more than the input length plus this many bytes.
+		/// </summary>
+		static constexpr uint32 MaxOverhead = 32;
+
+		HLAPI CipherStream() = default;
+		HLAPI ~CipherStream();
+
+		HLAPI CipherStream(CipherStream &&other) noexcept;
+		HLAPI CipherStream &operator=(CipherStream &&other) noexcept;
+
+		HL_NON_COPYABLE(CipherStream);
+
+		/// <summary>
+		/// Processes the next chunk, out needs space for length + MaxOverhead bytes.
+		/// </summary>
+		/// <param name="outLength">Receives the number of written bytes.</param>
+		/// <returns>Returns false, if the stream is invalid or the cipher failed.</returns>
+		HLAPI bool Update(const Byte *data, uint64 length, Byte *out, uint64 &outLength);
+
+		/// <summary>
+		/// Writes the last block or the authentication tag into out, which needs space for MaxOverhead bytes.
+		/// When decrypting, false means, that the padding or the authentication tag is wrong and the output must not be trusted.
+		/// </summary>
+		HLAPI bool Finish(Byte *out, uint64 &outLength);
 
+		HLAPI bool IsValid() const { return m_Context != nullptr && !m_Failed; }
+
+	private:
+
+		friend class Encryptor;
+
+		bool InitAuthenticated();
+		bool Process(const Byte *data, uint64 length, Byte *out, uint64 &outLength);
+		void Release();
+
+		evp_cipher_ctx_st *m_Context = nullptr;
+		std::vector<Byte> m_Key;
+		std::vector<Byte> m_AssociatedData;
+		Byte m_Nonce[16] = {};
+		Byte m_Tag[16] = {};
+		uint32 m_NonceCount = 0;		/**< The number of nonce bytes, that have been written or read. */
+		uint32 m_TagCount = 0;			/**< The number of trailing bytes, that a decrypting stream holds back as possible tag. */
+		bool m_Encrypt = true;
+		bool m_Authenticated = false;
+		bool m_Initialized = false;
+		bool m_Failed = false;
 	};
 
+	/// <summary>
+	/// Encrypts data with AES through OpenSSL. The one-shot functions use a cipher context per thread, so one Encryptor can be used from several threads.
+	/// The key and the iv are used as raw bytes, they have to be at least as long as the algorithm requires.
+	/// The authenticated algorithms (GCM and CCM) ignore the iv: every message gets a random nonce, that is written in front of the cipher text,
+	/// and the authentication tag is appended, so decrypting fails, if the data has been changed.
+	/// </summary>
 	class Encryptor : public IsSharedReference
 	{
 	public:
@@ -41,6 +110,10 @@ namespace highlo
 		HLAPI ~Encryptor();
 
 		HLAPI void Init();
+
+		/// <summary>
+		/// Releases the cipher context of the calling thread, the contexts of other threads are released when their threads exit.
+		/// </summary>
 		HLAPI void Shutdown();
 
 		HLAPI HLString Encrypt(const HLString &plainText);
@@ -49,11 +122,44 @@ namespace highlo
 		HLAPI HLString EncryptBase64(const HLString &plainText);
 		HLAPI HLString DecryptBase64(const HLString &cipherText);
 
+		/// <summary>
+		/// Encrypts the bytes, the associated data is only used by the authenticated algorithms and is authenticated, but not encrypted.
+		/// </summary>
+		HLAPI bool Encrypt(const Byte *data, uint64 length, std::vector<Byte> &outCipher, const Byte *associatedData = nullptr, uint64 associatedDataLength = 0) const;
+
+		/// <returns>Returns false, if the key does not fit, the padding is wrong or the authentication failed.</returns>
+		HLAPI bool Decrypt(const Byte *data, uint64 length, std::vector<Byte> &outPlain, const Byte *associatedData = nullptr, uint64 associatedDataLength = 0) const;
+
+		HLAPI CipherStream CreateEncryptStream(const Byte *associatedData = nullptr, uint64 associatedDataLength = 0) const;
+		HLAPI CipherStream CreateDecryptStream(const Byte *associatedData = nullptr, uint64 associatedDataLength = 0) const;
+
+		/// <summary>
+		/// Streams the file through a CipherStream, so files of any size need constant memory.
+		/// </summary>
+		HLAPI bool EncryptFileData(const FileSystemPath &source, const FileSystemPath &destination) const;
+		HLAPI bool DecryptFileData(const FileSystemPath &source, const FileSystemPath &destination) const;
+
+		/// <summary>
+		/// Splits the data into chunks, that are encrypted as independent messages on the ThreadPool. The iv or nonce of every chunk
+		/// is derived from the chunk index, the authenticated algorithms also bind the total length, so chunks can not be reordered or dropped.
+		/// The result can only be decrypted with DecryptParallel and the same chunk size.
+		/// </summary>
+		HLAPI bool EncryptParallel(const Byte *data, uint64 length, std::vector<Byte> &outCipher, uint32 chunkSize = 1024 * 1024) const;
+		HLAPI bool DecryptParallel(const Byte *data, uint64 length, std::vector<Byte> &outPlain, uint32 chunkSize = 1024 * 1024) const;
+
+		/// <summary>
+		/// Returns the length of the result of Encrypt for the given plain text length.
+		/// </summary>
+		HLAPI uint64 GetCipherLength(uint64 plainLength) const;
+
+		HLAPI bool IsAuthenticated() const;
+		HLAPI EncryptionAlgorithm GetAlgorithm() const { return m_Algorithm; }
+
 	private:
 
 		HLString m_Key;
 		HLString m_IV;
-		EncryptionAlgorithm m_Algorithm;
+		EncryptionAlgorithm m_Algorithm = EncryptionAlgorithm::None;
 	};
 }
 
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Added the previous path to the FileSystemChanged Event
 //     - 1.2 (2021-11-08) Added FileMenuChanged Event
 //     - 1.1 (2021-10-21) Added Threading Events
 //     - 1.0 (2021-09-14) initial release
@@ -106,6 +107,7 @@ namespace highlo
 
 		FileSystemAction Action = FileSystemAction::None;
 		FileSystemPath FilePath;
+		FileSystemPath OldFilePath; // Only set for renames, may be in a different directory than FilePath
 		HLString OldName;
 		HLString NewName;
 		bool IsDirectory = false;
@@ -2,12 +2,14 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Uniforms and resources are looked up by interned names
 //     - 1.1 (2021-11-24) refactored hole class to work with new Shader System (SPIR-V)
 //     - 1.0 (2021-09-14) initial release
 //
 
 #pragma once
 
+#include "Engine/Core/DataTypes/Name.h"
 #include "Shaders/Shader.h"
 #include "Texture2D.h"
 #include "Texture3D.h"
@@ -33,47 +35,47 @@ namespace highlo
 
 		HLAPI virtual void Invalidate() = 0;
 
-		HLAPI virtual bool Has(const HLString &name) = 0;
+		HLAPI virtual bool Has(const HLName &name) = 0;
 
 		// Setters
-		HLAPI virtual void Set(const HLString &name, float value) = 0;
-		HLAPI virtual void Set(const HLString &name, int32 value) = 0;
-		HLAPI virtual void Set(const HLString &name, uint32 value) = 0;
-		HLAPI virtual void Set(const HLString &name, bool value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::vec2 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::vec3 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::vec4 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::ivec2 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::ivec3 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::ivec4 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::mat2 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::mat3 &value) = 0;
-		HLAPI virtual void Set(const HLString &name, const glm::mat4 &value) = 0;
-
-		HLAPI virtual void Set(const HLString &name, const Ref<Texture2D> &texture) = 0;
-		HLAPI virtual void Set(const HLString &name, const Ref<Texture2D> &texture, uint32 slot) = 0;
-		HLAPI virtual void Set(const HLString &name, const Ref<Texture3D> &texture) = 0;
+		HLAPI virtual void Set(const HLName &name, float value) = 0;
+		HLAPI virtual void Set(const HLName &name, int32 value) = 0;
+		HLAPI virtual void Set(const HLName &name, uint32 value) = 0;
+		HLAPI virtual void Set(const HLName &name, bool value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::vec2 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::vec3 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::vec4 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::ivec2 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::ivec3 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::ivec4 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::mat2 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::mat3 &value) = 0;
+		HLAPI virtual void Set(const HLName &name, const glm::mat4 &value) = 0;
+
+		HLAPI virtual void Set(const HLName &name, const Ref<Texture2D> &texture) = 0;
+		HLAPI virtual void Set(const HLName &name, const Ref<Texture2D> &texture, uint32 slot) = 0;
+		HLAPI virtual void Set(const HLName &name, const Ref<Texture3D> &texture) = 0;
 		
 		// Getters
-		HLAPI virtual float &GetFloat(const HLString &name) = 0;
-		HLAPI virtual int32 &GetInt(const HLString &name) = 0;
-		HLAPI virtual uint32 &GetUInt(const HLString &name) = 0;
-		HLAPI virtual bool &GetBool(const HLString &name) = 0;
-		HLAPI virtual glm::vec2 &GetVector2(const HLString &name) = 0;
-		HLAPI virtual glm::vec3 &GetVector3(const HLString &name) = 0;
-		HLAPI virtual glm::vec4 &GetVector4(const HLString &name) = 0;
-		HLAPI virtual glm::ivec2 &GetIVector2(const HLString &name) = 0;
-		HLAPI virtual glm::ivec3 &GetIVector3(const HLString &name) = 0;
-		HLAPI virtual glm::ivec4 &GetIVector4(const HLString &name) = 0;
-		HLAPI virtual glm::mat2 &GetMatrix2(const HLString &name) = 0;
-		HLAPI virtual glm::mat3 &GetMatrix3(const HLString &name) = 0;
-		HLAPI virtual glm::mat4 &GetMatrix4(const HLString &name) = 0;
-
-		HLAPI virtual Ref<Texture2D> GetTexture2D(const HLString &name) = 0;
-		HLAPI virtual Ref<Texture3D> GetTexture3D(const HLString &name) = 0;
-
-		HLAPI virtual Ref<Texture2D> TryGetTexture2D(const HLString &name) = 0;
-		HLAPI virtual Ref<Texture3D> TryGetTexture3D(const HLString &name) = 0;
+		HLAPI virtual float &GetFloat(const HLName &name) = 0;
+		HLAPI virtual int32 &GetInt(const HLName &name) = 0;
+		HLAPI virtual uint32 &GetUInt(const HLName &name) = 0;
+		HLAPI virtual bool &GetBool(const HLName &name) = 0;
+		HLAPI virtual glm::vec2 &GetVector2(const HLName &name) = 0;
+		HLAPI virtual glm::vec3 &GetVector3(const HLName &name) = 0;
+		HLAPI virtual glm::vec4 &GetVector4(const HLName &name) = 0;
+		HLAPI virtual glm::ivec2 &GetIVector2(const HLName &name) = 0;
+		HLAPI virtual glm::ivec3 &GetIVector3(const HLName &name) = 0;
+		HLAPI virtual glm::ivec4 &GetIVector4(const HLName &name) = 0;
+		HLAPI virtual glm::mat2 &GetMatrix2(const HLName &name) = 0;
+		HLAPI virtual glm::mat3 &GetMatrix3(const HLName &name) = 0;
+		HLAPI virtual glm::mat4 &GetMatrix4(const HLName &name) = 0;
+
+		HLAPI virtual Ref<Texture2D> GetTexture2D(const HLName &name) = 0;
+		HLAPI virtual Ref<Texture3D> GetTexture3D(const HLName &name) = 0;
+
+		HLAPI virtual Ref<Texture2D> TryGetTexture2D(const HLName &name) = 0;
+		HLAPI virtual Ref<Texture3D> TryGetTexture3D(const HLName &name) = 0;
 
 		HLAPI virtual uint32 GetFlags() const = 0;
 		HLAPI virtual bool GetFlag(MaterialFlag flag) const = 0;
@@ -51,21 +51,32 @@ namespace highlo
 
 	void DynamicModel::OnUpdate(Timestep ts)
 	{
-		if (m_IsAnimated)
+		if (IsAnimated() && m_AnimationPlaying && m_MeshFile->m_AnimationDuration > 0.0f)
 		{
-			if (m_AnimationPlaying)
-			{
-				m_WorldTime += ts;
+			m_WorldTime += ts;
 
-				float ticksPerSecond = (float)(m_MeshFile->m_TicksPerSecond != 0 ? m_MeshFile->m_TicksPerSecond : 25.0f) * m_TimeMultiplier;
-				m_AnimationTime += ts * ticksPerSecond;
-				m_AnimationTime = fmod(m_AnimationTime, m_MeshFile->m_AnimationDuration);
-			}
+			float ticksPerSecond = (float)(m_MeshFile->m_TicksPerSecond != 0 ? m_MeshFile->m_TicksPerSecond : 25.0f) * m_TimeMultiplier;
+			float animationTime = fmod(m_AnimationTime + ts * ticksPerSecond, m_MeshFile->m_AnimationDuration);
 
-			m_MeshFile->ManipulateBoneTransform(m_AnimationTime);
+			if (animationTime != m_AnimationTime)
+			{
+				m_AnimationTime = animationTime;
+				m_BoneTransformsDirty = true;
+			}
 		}
 	}
 
+	bool DynamicModel::UpdateBoneTransforms()
+	{
+		if (!IsAnimated() || !m_BoneTransformsDirty)
+			return false;
+
+		m_MeshFile->ManipulateBoneTransform(m_AnimationTime);
+		m_BoneTransformsDirty = false;
+		++m_BoneTransformVersion;
+		return true;
+	}
+
 	void DynamicModel::SetSubmeshIndices(const std::vector<uint32> &indices)
 	{
 		if (!indices.empty())
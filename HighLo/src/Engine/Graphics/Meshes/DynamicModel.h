@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) The bone transforms are only evaluated when they are requested and the animation time has changed
 //     - 1.1 (2021-11-25) completely refactored to fit the new shading system
 //     - 1.0 (2021-09-14) initial release
 //
@@ -29,6 +30,23 @@ namespace highlo
 		// update function
 		void OnUpdate(Timestep ts);
 
+		// Animation
+		void PlayAnimation() { m_AnimationPlaying = true; }
+		void PauseAnimation() { m_AnimationPlaying = false; }
+		bool IsAnimationPlaying() const { return m_AnimationPlaying; }
+
+		/// <summary>
+		/// Evaluates the bone transforms, if the animation time has changed since the last evaluation.
+		/// Models that are never rendered, because they are paused or culled, don't pay for the evaluation.
+		/// </summary>
+		/// <returns>Returns true, if the bone transforms have been re-evaluated</returns>
+		bool UpdateBoneTransforms();
+
+		/// <summary>
+		/// Is incremented every time the bone transforms change, used to skip redundant uploads of the skinning palette.
+		/// </summary>
+		uint64 GetBoneTransformVersion() const { return m_BoneTransformVersion; }
+
 		// Submesh indices
 		std::vector<uint32> &GetSubmeshIndices() { return m_SubMeshIndices; }
 		const std::vector<uint32> &GetSubmeshIndices() const { return m_SubMeshIndices; }
@@ -67,6 +85,8 @@ namespace highlo
 		float m_AnimationTime = 0.0f;		// The duration of the current animation
 		float m_WorldTime = 0.0f;			// The global deltatime
 		float m_TimeMultiplier = 1.0f;		// used to control the speed of the animations
+		bool m_BoneTransformsDirty = true;	// Whether or not the bone transforms have to be re-evaluated
+		uint64 m_BoneTransformVersion = 0;	// Incremented every time the bone transforms are re-evaluated
 
 		friend class Scene;
 		friend class SceneRenderer;
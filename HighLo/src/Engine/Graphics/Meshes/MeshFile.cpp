@@ -14,6 +14,20 @@ namespace highlo
 		HL_CORE_INFO(MESH_FILE_LOG_PREFIX "Trying to load model {0}", **filePath);
 		m_MeshShader = shouldBeAnimated ? Renderer::GetShaderLibrary()->Get("HighLoPBRAnimated") : Renderer::GetShaderLibrary()->Get("HighLoPBR");
 		m_MeshLoader = MeshLoader::Create(filePath, m_MeshShader);
+		CopyLoaderData();
+	}
+
+	MeshFile::MeshFile(const Ref<MeshLoader> &loader, bool shouldBeAnimated)
+		: m_MeshLoader(loader)
+	{
+		m_MeshShader = shouldBeAnimated ? Renderer::GetShaderLibrary()->Get("HighLoPBRAnimated") : Renderer::GetShaderLibrary()->Get("HighLoPBR");
+		m_MeshLoader->CreateResources(m_MeshShader);
+		CopyLoaderData();
+	}
+
+	void MeshFile::CopyLoaderData()
+	{
+		m_FilePath = m_MeshLoader->GetFilePath();
 		m_IsAnimated = m_MeshLoader->IsAnimated();
 		m_SubMeshes = m_MeshLoader->GetSubmeshes();
 		m_InverseTransform.SetTransform(m_MeshLoader->GetInverseTransform());
@@ -152,6 +166,11 @@ namespace highlo
 		return Ref<MeshFile>::Create(filePath, shouldBeAnimated);
 	}
 
+	Ref<MeshFile> MeshFile::Create(const Ref<MeshLoader> &loader, bool shouldBeAnimated)
+	{
+		return Ref<MeshFile>::Create(loader, shouldBeAnimated);
+	}
+
 	Ref<MeshFile> MeshFile::Create(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices)
 	{
 		return Ref<MeshFile>::Create(vertices, indices);
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added constructor from a decoded MeshLoader
 //     - 1.0 (2021-12-21) initial release
 //
 
@@ -28,6 +29,11 @@ namespace highlo
 	public:
 	
 		MeshFile(const FileSystemPath &filePath, bool shouldBeAnimated = false);
+
+		/// <summary>
+		/// Creates the GPU resources of a mesh, that has been decoded with MeshLoader::Decode(). Has to be called on the main thread.
+		/// </summary>
+		MeshFile(const Ref<MeshLoader> &loader, bool shouldBeAnimated = false);
 		MeshFile(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices);
 		MeshFile(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices, const AABB &aabb);
 		MeshFile(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices, const Transform &transform);
@@ -61,11 +67,16 @@ namespace highlo
 		virtual AssetType GetAssetType() const override { return GetStaticType(); }
 
 		static Ref<MeshFile> Create(const FileSystemPath &filePath, bool shouldBeAnimated = false);
+		static Ref<MeshFile> Create(const Ref<MeshLoader> &loader, bool shouldBeAnimated = false);
 		static Ref<MeshFile> Create(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices);
 		static Ref<MeshFile> Create(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices, const AABB &aabb);
 		static Ref<MeshFile> Create(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices, const Transform &transform);
 		static Ref<MeshFile> Create(const std::vector<Vertex> &vertices, const std::vector<VertexIndex> &indices, const std::vector<Mesh> &subMeshes);
 
+	private:
+
+		void CopyLoaderData();
+
 	private:
 
 		// General infos
@@ -111,7 +111,9 @@ namespace highlo
 			const Ref<MaterialTable> &materials,
 			const TransformVertexData *transformBuffer,
 			uint32 transformBufferOffset,
-			uint32 instanceCount
+			uint32 instanceCount,
+			uint32 boneTransformOffset,
+			uint32 boneTransformStride
 		) = 0;
 
 		HLAPI virtual void DrawInstancedStaticMeshWithMaterial(
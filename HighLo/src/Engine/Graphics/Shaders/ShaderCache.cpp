@@ -6,12 +6,50 @@
 #include "Engine/Application/Application.h"
 #include "Engine/Loaders/DocumentWriter.h"
 #include "Engine/Loaders/DocumentReader.h"
+#include "Engine/Assets/DerivedDataCache.h"
 
 #define SHADER_CACHE_LOG_PREFIX "ShaderCache>  "
+#define SHADER_BINARY_IMPORTER_VERSION 1
 
 namespace highlo
 {
-	static std::map<HLString, uint64> s_ShaderCache;
+	namespace utils
+	{
+		static DerivedDataKey GetBinaryKey(const HLString &target, uint32 stage, const HLString &stageSource, uint64 optionsHash)
+		{
+			uint64 sourceHash = DerivedDataCache::HashSettings(*stageSource, stageSource.Length());
+			uint64 settingsHash = DerivedDataCache::HashSettings(&stage, sizeof(stage), optionsHash);
+			return DerivedDataKey(HLString("Shader") + target, SHADER_BINARY_IMPORTER_VERSION, sourceHash, settingsHash);
+		}
+
+		static DerivedDataKey GetLastGoodBinaryKey(const HLString &target, uint32 stage, const FileSystemPath &filePath)
+		{
+			// The only entry, that is addressed by the path, because it has to be found after the source has changed
+			uint64 pathHash = DerivedDataCache::HashSettings(*filePath.String(), filePath.String().Length());
+			uint64 settingsHash = DerivedDataCache::HashSettings(&stage, sizeof(stage));
+			return DerivedDataKey(HLString("ShaderLastGood") + target, SHADER_BINARY_IMPORTER_VERSION, pathHash, settingsHash);
+		}
+
+		static bool ReadBinary(const DerivedDataKey &key, std::vector<uint32> &outBinary)
+		{
+			Allocator data;
+			if (!DerivedDataCache::Get()->Get(key, data))
+				return false;
+
+			bool valid = data.Size > 0 && data.Size % sizeof(uint32) == 0;
+			if (valid)
+			{
+				outBinary.resize(data.Size / sizeof(uint32));
+				memcpy(outBinary.data(), data.Data, data.Size);
+			}
+
+			data.Release();
+			return valid;
+		}
+	}
+
+	// Looked up for every shader file on every load, but only written when a shader changes
+	static HLFlatMap<HLString, uint64> s_ShaderCache;
 
 	void ShaderCache::Init()
 	{
@@ -27,27 +65,52 @@ namespace highlo
 	{
 		uint64 hash = source.Hash();
 
-		if (s_ShaderCache.find(filePath.String()) == s_ShaderCache.end() || s_ShaderCache.at(filePath.String()) != hash)
+		uint64 *cachedHash = s_ShaderCache.TryGet(filePath.String());
+		if (!cachedHash || *cachedHash != hash)
 		{
-			s_ShaderCache[filePath.String()] = hash;
+			s_ShaderCache.InsertOrAssign(filePath.String(), hash);
 			return true;
 		}
 
 		return false;
 	}
 
-	void ShaderCache::Serialize(const std::map<HLString, uint64> &shaderCache)
+	bool ShaderCache::TryGetBinary(const HLString &target, uint32 stage, const HLString &stageSource, uint64 optionsHash, std::vector<uint32> &outBinary)
+	{
+		return utils::ReadBinary(utils::GetBinaryKey(target, stage, stageSource, optionsHash), outBinary);
+	}
+
+	void ShaderCache::StoreBinary(const HLString &target, uint32 stage, const HLString &stageSource, uint64 optionsHash, const FileSystemPath &filePath, const std::vector<uint32> &binary)
+	{
+		DerivedDataCache *cache = DerivedDataCache::Get();
+		uint64 size = binary.size() * sizeof(uint32);
+
+		bool stored = cache->Put(utils::GetBinaryKey(target, stage, stageSource, optionsHash), binary.data(), size);
+		stored &= cache->Put(utils::GetLastGoodBinaryKey(target, stage, filePath), binary.data(), size);
+
+		if (!stored && cache->IsEnabled())
+			HL_CORE_ERROR(SHADER_CACHE_LOG_PREFIX "[-] Failed to cache shader binary of {0} [-]", *filePath.String());
+	}
+
+	bool ShaderCache::TryGetLastGoodBinary(const HLString &target, uint32 stage, const FileSystemPath &filePath, std::vector<uint32> &outBinary)
+	{
+		return utils::ReadBinary(utils::GetLastGoodBinaryKey(target, stage, filePath), outBinary);
+	}
+
+	void ShaderCache::Serialize(const HLFlatMap<HLString, uint64> &shaderCache)
 	{
 		FileSystemPath shaderRegistryPath = HLApplication::Get().GetApplicationSettings().ShaderRegistryPath;
 		Ref<DocumentWriter> writer = DocumentWriter::Create(shaderRegistryPath, DocumentType::Json);
 
-		writer->WriteUInt64ArrayMap("shaderCache", shaderCache);
+		// The document writer only accepts std::map
+		std::map<HLString, uint64> entries(shaderCache.begin(), shaderCache.end());
+		writer->WriteUInt64ArrayMap("shaderCache", entries);
 
 		bool writeSuccess = writer->WriteOut();
 		HL_ASSERT(writeSuccess);
 	}
 	
-	void ShaderCache::Deserialize(std::map<HLString, uint64> &shaderCache)
+	void ShaderCache::Deserialize(HLFlatMap<HLString, uint64> &shaderCache)
 	{
 		FileSystemPath shaderRegistryPath = HLApplication::Get().GetApplicationSettings().ShaderRegistryPath;
 		Ref<DocumentReader> reader = DocumentReader::Create(shaderRegistryPath, DocumentType::Json);
@@ -55,10 +118,15 @@ namespace highlo
 		bool readSuccess = reader->ReadContents();
 		if (readSuccess)
 		{
-			if (!reader->ReadUInt64ArrayMap("shaderCache", shaderCache))
+			std::map<HLString, uint64> entries;
+			if (!reader->ReadUInt64ArrayMap("shaderCache", entries))
 			{
 				HL_CORE_ERROR(SHADER_CACHE_LOG_PREFIX "[-] Error: Could not read shader cache! [-]");
+				return;
 			}
+
+			// The std::map is already sorted, so the entries can be adopted without sorting them again
+			shaderCache = HLFlatMap<HLString, uint64>::FromSorted(std::vector<std::pair<HLString, uint64>>(entries.begin(), entries.end()));
 		}
 	}
 }
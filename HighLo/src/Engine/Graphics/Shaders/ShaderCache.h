@@ -2,12 +2,15 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Stored the file hashes in a HLFlatMap
+//     - 1.1 (2026-10-19) Stored the compiled binaries in the DerivedDataCache
 //     - 1.0 (2021-12-21) initial release
 //
 
 #pragma once
 
 #include "Engine/Core/FileSystemPath.h"
+#include "Engine/Core/DataTypes/FlatMap.h"
 
 namespace highlo
 {
@@ -20,10 +23,28 @@ namespace highlo
 
 		HLAPI static bool HasChanged(const FileSystemPath &filePath, const HLString &source);
 
+		/// <summary>
+		/// Returns the binary of a shader stage, that has been compiled from exactly the same source with the same options.
+		/// </summary>
+		/// <param name="target">The api, the binary has been compiled for.</param>
+		/// <param name="optionsHash">Has to change, whenever the compile options change.</param>
+		HLAPI static bool TryGetBinary(const HLString &target, uint32 stage, const HLString &stageSource, uint64 optionsHash, std::vector<uint32> &outBinary);
+
+		/// <summary>
+		/// Stores the compiled binary of a shader stage, it also becomes the last good binary of the shader file.
+		/// </summary>
+		HLAPI static void StoreBinary(const HLString &target, uint32 stage, const HLString &stageSource, uint64 optionsHash, const FileSystemPath &filePath, const std::vector<uint32> &binary);
+
+		/// <summary>
+		/// Returns the last binary, that has been compiled successfully from the shader file, regardless of its source.
+		/// It is used instead of a shader stage, that does not compile anymore.
+		/// </summary>
+		HLAPI static bool TryGetLastGoodBinary(const HLString &target, uint32 stage, const FileSystemPath &filePath, std::vector<uint32> &outBinary);
+
 	private:
 
-		static void Serialize(const std::map<HLString, uint64> &shaderCache);
-		static void Deserialize(std::map<HLString, uint64> &shaderCache);
+		static void Serialize(const HLFlatMap<HLString, uint64> &shaderCache);
+		static void Deserialize(HLFlatMap<HLString, uint64> &shaderCache);
 	};
 }
 
@@ -60,8 +60,11 @@ namespace highlo
 
 	void StorageBuffer::SetData(const void *data, uint32 size, uint32 offset)
 	{
-		// TODO: this could be potentially dangerous, if size is less the m_DataSize, because then we would not have the complete m_DataSize space filled with actual data
-		memcpy_s(m_Data, m_DataSize, (void*)((char*)data + offset), m_DataSize);
+		HL_ASSERT(size <= m_DataSize, "The copied buffer is larger than the storage buffer");
+
+		// Only copy the given size, the rest of the storage buffer keeps its previous content
+		uint32 copySize = HL_MIN(size, m_DataSize);
+		memcpy_s(m_Data, m_DataSize, (void*)((char*)data + offset), copySize);
 		UploadToShader();
 	}
 
@@ -78,6 +81,18 @@ namespace highlo
 		UploadToShader();
 	}
 	
+	void StorageBuffer::ResizeData(uint32 size)
+	{
+		if (size == m_DataSize)
+			return;
+
+		void *data = realloc(m_Data, size);
+		HL_ASSERT(data || size == 0);
+
+		m_Data = data;
+		m_DataSize = size;
+	}
+
 	void *StorageBuffer::GetVariable(const HLString &name)
 	{
 		auto &entry = m_UniformVariables.find(name);
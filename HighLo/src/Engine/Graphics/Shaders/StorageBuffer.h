@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) SetData only copies the given size, added ResizeData for growing storage buffers
 //     - 1.0 (2021-12-21) initial release
 //
 
@@ -37,6 +38,11 @@ namespace highlo
 
 		StorageBuffer(uint32 binding, const std::vector<UniformVariable> &layout);
 
+		/// <summary>
+		/// Resizes the CPU side copy of the storage buffer, the content is preserved up to the smaller size.
+		/// </summary>
+		void ResizeData(uint32 size);
+
 	protected:
 
 		// String --> name
@@ -121,6 +121,7 @@ namespace highlo
 	{
 		return {
 			{ "u_BoneTransformIndex.Base", UniformLayoutDataType::UInt, 1, 0 },
+			{ "u_BoneTransformIndex.BoneCount", UniformLayoutDataType::UInt, 1, sizeof(uint32) },
 		};
 	}
 
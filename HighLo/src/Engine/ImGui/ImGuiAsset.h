@@ -419,7 +419,7 @@ namespace highlo::UI
 		{
 			if (!object->IsFlagSet(AssetFlag::Missing))
 			{
-				auto &assetFileName = AssetManager::Get()->GetMetaData(object->Handle).FilePath.Filename();
+				HLString assetFileName = AssetManager::Get()->GetMetaData(object->Handle).FilePath.Filename();
 				if (ImGui::Button(*assetFileName, { buttonWidth, 0.0f }))
 					clicked = true;
 			}
@@ -504,7 +504,7 @@ namespace highlo::UI
 				if (asset->GetAssetType() != T::GetStaticType())
 					continue;
 
-				auto &metaData = AssetManager::Get()->GetMetaData(handle);
+				AssetMetaData metaData = AssetManager::Get()->GetMetaData(handle);
 				bool isSelected = (current == handle);
 				if (ImGui::Selectable(metaData.FilePath.Filename(), isSelected))
 				{
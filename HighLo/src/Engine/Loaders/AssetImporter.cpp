@@ -5,6 +5,8 @@
 
 #include "Engine/Assets/AssetManager.h"
 #include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/AnimationClip.h"
+#include "TextureLoader.h"
 
 namespace highlo
 {
@@ -77,11 +79,92 @@ namespace highlo
 				asset->Handle = assetInfo.Handle;
 				loaded = asset->IsFlagSet(AssetFlag::None) && asset.As<Texture2D>()->IsLoaded();
 				break;
+
+			case AssetType::AnimationClip:
+				asset = AnimationClip::Load(AssetManager::Get()->GetFileSystemPath(assetInfo));
+				asset->Handle = assetInfo.Handle;
+				loaded = asset->IsValid();
+				break;
 		}
 
 		return loaded;
 	}
 
+	bool AssetImporter::TryDecodeData(const AssetMetaData &assetInfo, AssetLoadData &outData)
+	{
+		switch (assetInfo.Type)
+		{
+			case AssetType::Texture:
+			{
+				return TextureLoader::LoadRGBA(assetInfo.FilePath, false, outData.Buffer, outData.Width, outData.Height);
+			}
+
+			case AssetType::AnimationClip:
+			{
+				// Animation clips don't own GPU resources, so they can be created completely on the worker thread
+				outData.DecodedAsset = AnimationClip::Load(assetInfo.FilePath);
+				return outData.DecodedAsset->IsValid();
+			}
+
+			case AssetType::StaticMesh:
+			case AssetType::DynamicMesh:
+			{
+				// The mesh is imported or read from its cooked file and its textures are decoded,
+				// only the buffers, materials and textures are created on the main thread
+				outData.DecodedMesh = MeshLoader::Decode(assetInfo.FilePath);
+				return outData.DecodedMesh && !outData.DecodedMesh->GetSubmeshes().empty();
+			}
+
+			case AssetType::Font:
+			{
+				// The glyphs are packed on the worker thread, only the atlas textures are created on the main thread
+				outData.DecodedAsset = Font::Decode(assetInfo.FilePath, 16, FontType::TRUE_TYPE_FONT);
+				return outData.DecodedAsset != nullptr;
+			}
+		}
+
+		// All other asset types are loaded completely when they are finalized
+		return true;
+	}
+
+	bool AssetImporter::TryFinalizeData(const AssetMetaData &assetInfo, AssetLoadData &data, Ref<Asset> &asset)
+	{
+		switch (assetInfo.Type)
+		{
+			case AssetType::Texture:
+			{
+				asset = Texture2D::Create(TextureFormat::RGBA, data.Width, data.Height, data.Buffer.Data);
+				asset->Handle = assetInfo.Handle;
+				return asset->IsValid() && asset.As<Texture2D>()->IsLoaded();
+			}
+
+			case AssetType::AnimationClip:
+			{
+				asset = data.DecodedAsset;
+				asset->Handle = assetInfo.Handle;
+				return asset->IsValid();
+			}
+
+			case AssetType::StaticMesh:
+			case AssetType::DynamicMesh:
+			{
+				Ref<MeshFile> source = MeshFile::Create(data.DecodedMesh, false);
+				asset = Ref<StaticModel>::Create(source);
+				asset->Handle = assetInfo.Handle;
+				return asset->IsFlagSet(AssetFlag::None);
+			}
+
+			case AssetType::Font:
+			{
+				asset = data.DecodedAsset;
+				asset->Handle = assetInfo.Handle;
+				return asset.As<Font>()->CreateResources() && asset->IsFlagSet(AssetFlag::None);
+			}
+		}
+
+		return TryLoadData(assetInfo, asset);
+	}
+
 	void AssetImporter::Serialize(const AssetMetaData &assetInfo, const Ref<Asset> &asset)
 	{
 		// TODO: write into config file
@@ -2,12 +2,14 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Split loading into a decode step for worker threads and a finalize step for the main thread
 //     - 1.0 (2022-01-21) initial release
 //
 
 #pragma once
 
 #include "Engine/Assets/Asset.h"
+#include "Engine/Assets/AsyncAssetLoader.h"
 
 namespace highlo
 {
@@ -20,6 +22,18 @@ namespace highlo
 
 		HLAPI static bool TryLoadData(const AssetMetaData &assetInfo, Ref<Asset> &asset);
 
+		/// <summary>
+		/// Reads and decodes the asset into outData, can be called from any thread.
+		/// The file path of the assetInfo has to be resolved already, nothing is created on the GPU in this step.
+		/// </summary>
+		HLAPI static bool TryDecodeData(const AssetMetaData &assetInfo, AssetLoadData &outData);
+
+		/// <summary>
+		/// Creates the asset from the decoded data, has to be called from the main thread.
+		/// Asset types without a decode step are loaded completely in here.
+		/// </summary>
+		HLAPI static bool TryFinalizeData(const AssetMetaData &assetInfo, AssetLoadData &data, Ref<Asset> &asset);
+
 		HLAPI static void Serialize(const AssetMetaData &assetInfo, const Ref<Asset> &asset);
 		HLAPI static void Serialize(const Ref<Asset> &asset);
 
@@ -0,0 +1,317 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "BinaryDocument.h"
+
+namespace highlo
+{
+	namespace utils
+	{
+		static bool ReadUInt32(const Byte *&ptr, const Byte *end, uint32 &outValue)
+		{
+			if (end - ptr < (int64)sizeof(uint32))
+				return false;
+
+			// The values inside of the document are not aligned
+			memcpy(&outValue, ptr, sizeof(uint32));
+			ptr += sizeof(uint32);
+			return true;
+		}
+
+		static void AppendEscapedString(std::string &out, const char *str, uint32 length)
+		{
+			out += '"';
+			for (uint32 i = 0; i < length; ++i)
+			{
+				char c = str[i];
+				switch (c)
+				{
+					case '"':	out += "\\\""; break;
+					case '\\':	out += "\\\\"; break;
+					case '\n':	out += "\\n"; break;
+					case '\r':	out += "\\r"; break;
+					case '\t':	out += "\\t"; break;
+					default:
+					{
+						if ((uint8)c < 0x20)
+						{
+							char escaped[8];
+							snprintf(escaped, sizeof(escaped), "\\u%04x", (uint32)c);
+							out += escaped;
+						}
+						else
+						{
+							out += c;
+						}
+						break;
+					}
+				}
+			}
+			out += '"';
+		}
+
+		static void AppendFloats(std::string &out, const Byte *data, uint32 count)
+		{
+			out += '[';
+			for (uint32 i = 0; i < count; ++i)
+			{
+				float value;
+				memcpy(&value, data + i * sizeof(float), sizeof(float));
+
+				char buffer[32];
+				snprintf(buffer, sizeof(buffer), "%.9g", value);
+
+				if (i > 0)
+					out += ',';
+				out += buffer;
+			}
+			out += ']';
+		}
+
+		static void AppendScalarText(std::string &out, const BinaryDocumentValue &value)
+		{
+			char buffer[32];
+			switch (value.ElementType)
+			{
+				case DocumentDataType::Int32:	{ int32 v; memcpy(&v, value.Payload, sizeof(v)); out += std::to_string(v); break; }
+				case DocumentDataType::UInt32:	{ uint32 v; memcpy(&v, value.Payload, sizeof(v)); out += std::to_string(v); break; }
+				case DocumentDataType::Int64:	{ int64 v; memcpy(&v, value.Payload, sizeof(v)); out += std::to_string(v); break; }
+				case DocumentDataType::UInt64:	{ uint64 v; memcpy(&v, value.Payload, sizeof(v)); out += std::to_string(v); break; }
+				case DocumentDataType::Float:	{ float v; memcpy(&v, value.Payload, sizeof(v)); snprintf(buffer, sizeof(buffer), "%.9g", v); out += buffer; break; }
+				case DocumentDataType::Double:	{ double v; memcpy(&v, value.Payload, sizeof(v)); snprintf(buffer, sizeof(buffer), "%.17g", v); out += buffer; break; }
+				case DocumentDataType::Bool:	out += *value.Payload ? "true" : "false"; break;
+				case DocumentDataType::String:	AppendEscapedString(out, (const char*)value.Payload, value.Count); break;
+
+				default:
+				{
+					// Vectors, matrices and quaternions
+					AppendFloats(out, value.Payload, BinaryDocumentValue::GetDataTypeSize(value.ElementType) / sizeof(float));
+					break;
+				}
+			}
+		}
+
+		static void AppendNewLine(std::string &out, bool prettify, uint32 depth)
+		{
+			if (!prettify)
+				return;
+
+			out += '\n';
+			out.append(depth * 2, ' ');
+		}
+
+		static bool AppendText(std::string &out, const BinaryDocumentValue &value, bool prettify, uint32 depth)
+		{
+			if (value.IsObject())
+			{
+				if (depth >= HL_BINARY_DOCUMENT_MAX_DEPTH)
+					return false;
+
+				bool first = true;
+				out += '{';
+				bool success = value.ForEachMember([&](const HLString &key, const BinaryDocumentValue &member) -> bool
+				{
+					if (!first)
+						out += ',';
+
+					first = false;
+					AppendNewLine(out, prettify, depth + 1);
+					AppendEscapedString(out, *key, key.Length());
+					out += prettify ? ": " : ":";
+					return AppendText(out, member, prettify, depth + 1);
+				});
+
+				if (!first)
+					AppendNewLine(out, prettify, depth);
+
+				out += '}';
+				return success;
+			}
+
+			if (value.IsArray())
+			{
+				if (depth >= HL_BINARY_DOCUMENT_MAX_DEPTH)
+					return false;
+
+				bool first = true;
+				out += '[';
+				bool success = value.ForEachElement([&](const BinaryDocumentValue &element) -> bool
+				{
+					if (!first)
+						out += ',';
+
+					first = false;
+					AppendNewLine(out, prettify, depth + 1);
+					return AppendText(out, element, prettify, depth + 1);
+				});
+
+				if (!first)
+					AppendNewLine(out, prettify, depth);
+
+				out += ']';
+				return success;
+			}
+
+			if (value.Tag == BinaryDocumentTag::Null)
+				out += "null";
+			else
+				AppendScalarText(out, value);
+
+			return true;
+		}
+	}
+
+	bool BinaryDocumentValue::Parse(const Byte *data, const Byte *end, BinaryDocumentValue &outValue)
+	{
+		if (data >= end)
+			return false;
+
+		const Byte *ptr = data + 1;
+		outValue = BinaryDocumentValue();
+		outValue.Tag = (BinaryDocumentTag)*data;
+
+		uint64 payloadSize = 0;
+		switch (outValue.Tag)
+		{
+			case BinaryDocumentTag::Null:
+				break;
+
+			case BinaryDocumentTag::Object:
+			case BinaryDocumentTag::Array:
+			{
+				uint32 size;
+				if (!utils::ReadUInt32(ptr, end, size) || !utils::ReadUInt32(ptr, end, outValue.Count))
+					return false;
+
+				payloadSize = size;
+				break;
+			}
+
+			case BinaryDocumentTag::TypedArray:
+			{
+				if (ptr >= end)
+					return false;
+
+				outValue.ElementType = (DocumentDataType)*ptr++;
+				uint32 elementSize = GetDataTypeSize(outValue.ElementType);
+				if (elementSize == 0 || !utils::ReadUInt32(ptr, end, outValue.Count))
+					return false;
+
+				payloadSize = (uint64)elementSize * outValue.Count;
+				break;
+			}
+
+			case (BinaryDocumentTag)DocumentDataType::String:
+			{
+				outValue.ElementType = DocumentDataType::String;
+				if (!utils::ReadUInt32(ptr, end, outValue.Count))
+					return false;
+
+				payloadSize = outValue.Count;
+				break;
+			}
+
+			default:
+			{
+				outValue.ElementType = (DocumentDataType)outValue.Tag;
+				payloadSize = GetDataTypeSize(outValue.ElementType);
+				if (payloadSize == 0)
+					return false;
+
+				break;
+			}
+		}
+
+		if ((uint64)(end - ptr) < payloadSize)
+			return false;
+
+		outValue.Payload = ptr;
+		outValue.End = ptr + payloadSize;
+		return true;
+	}
+
+	bool BinaryDocumentValue::ParseDocument(const Byte *data, uint64 size, BinaryDocumentValue &outRoot)
+	{
+		BinaryDocumentHeader header;
+		if (!data || size < sizeof(BinaryDocumentHeader))
+			return false;
+
+		memcpy(&header, data, sizeof(BinaryDocumentHeader));
+		if (header.Magic != HL_BINARY_DOCUMENT_MAGIC || header.Version > HL_BINARY_DOCUMENT_VERSION)
+			return false;
+
+		return Parse(data + sizeof(BinaryDocumentHeader), data + size, outRoot);
+	}
+
+	uint32 BinaryDocumentValue::GetDataTypeSize(DocumentDataType type)
+	{
+		switch (type)
+		{
+			case DocumentDataType::Int32:
+			case DocumentDataType::UInt32:
+			case DocumentDataType::Float:
+				return 4;
+
+			case DocumentDataType::Int64:
+			case DocumentDataType::UInt64:
+			case DocumentDataType::Double:
+			case DocumentDataType::Vec2:
+				return 8;
+
+			case DocumentDataType::Vec3:
+				return 3 * sizeof(float);
+
+			case DocumentDataType::Vec4:
+			case DocumentDataType::Mat2:
+			case DocumentDataType::Quat:
+				return 4 * sizeof(float);
+
+			case DocumentDataType::Mat3:
+				return 9 * sizeof(float);
+
+			case DocumentDataType::Mat4:
+				return 16 * sizeof(float);
+
+			case DocumentDataType::Bool:
+				return 1;
+		}
+
+		return 0;
+	}
+
+	bool BinaryDocumentValue::FindMember(const HLString &key, BinaryDocumentValue &outValue) const
+	{
+		bool found = false;
+		ForEachMember([&key, &outValue, &found](const HLString &memberKey, const BinaryDocumentValue &member) -> bool
+		{
+			if (memberKey != key)
+				return true;
+
+			outValue = member;
+			found = true;
+			return false;
+		});
+
+		return found;
+	}
+
+	HLString BinaryDocumentValue::ToText(bool prettify) const
+	{
+		std::string text;
+		if (!utils::AppendText(text, *this, prettify, 0))
+			return HLString();
+
+		return HLString(text);
+	}
+
+	bool BinaryDocumentValue::ParseMember(const Byte *data, const Byte *end, HLString &outKey, BinaryDocumentValue &outValue)
+	{
+		uint32 keyLength;
+		if (!utils::ReadUInt32(data, end, keyLength) || (uint64)(end - data) < keyLength)
+			return false;
+
+		outKey = HLString((const char*)data, keyLength);
+		return Parse(data + keyLength, end, outValue);
+	}
+}
+
@@ -0,0 +1,178 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Limited the nesting depth and made the iteration functions templates
+//     - 1.0 (2026-10-19) initial release
+//
+
+/**
+ * The binary document format, used by DocumentType::Binary:
+ *
+ * All numbers are stored in little endian byte order, which is the native byte order on every supported platform,
+ * so values and arrays are copied with memcpy instead of being converted.
+ *
+ * Header:    uint32 magic ("HLBD"), uint32 version
+ * Value:     uint8 tag, followed by the payload of the tag
+ *   Scalars:     the raw value, the tags are the values of DocumentDataType (vectors, matrices and quaternions are stored as floats)
+ *   String:      uint32 length, the characters without a null terminator
+ *   Object:      uint32 payload size, uint32 member count, then per member: uint32 key length, the key, the value
+ *   Array:       uint32 payload size, uint32 element count, then the values
+ *   TypedArray:  uint8 element type, uint32 element count, then all elements as one raw block
+ *
+ * The payload sizes of objects and arrays allow to skip them without parsing their content.
+ * Documents, whose objects and arrays are nested deeper than HL_BINARY_DOCUMENT_MAX_DEPTH, are treated as corrupted,
+ * so that a crafted file can't exhaust the stack of the recursive readers.
+ */
+
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/DataTypes/String.h"
+#include "DocumentType.h"
+
+#define HL_BINARY_DOCUMENT_MAGIC 0x44424C48 // "HLBD"
+#define HL_BINARY_DOCUMENT_VERSION 1
+#define HL_BINARY_DOCUMENT_MAX_DEPTH 128
+
+namespace highlo
+{
+	enum class BinaryDocumentTag : uint8
+	{
+		Null = 0,
+
+		// 1 - 15 are the scalar DocumentDataTypes
+
+		Object = 32,
+		Array,
+		TypedArray
+	};
+
+	struct BinaryDocumentHeader
+	{
+		uint32 Magic = HL_BINARY_DOCUMENT_MAGIC;
+		uint32 Version = HL_BINARY_DOCUMENT_VERSION;
+	};
+
+	/// <summary>
+	/// A view of one value inside of a binary document, the view does not own the memory.
+	/// </summary>
+	struct BinaryDocumentValue
+	{
+		BinaryDocumentTag Tag = BinaryDocumentTag::Null;
+		DocumentDataType ElementType = DocumentDataType::None;	/**< The type of scalars and the element type of typed arrays. */
+		uint32 Count = 0;										/**< The member count of objects, the element count of arrays and the length of strings. */
+		const Byte *Payload = nullptr;							/**< The raw value, the characters of strings or the first member or element of containers. */
+		const Byte *End = nullptr;								/**< The first byte behind the value. */
+
+		/// <summary>
+		/// Parses the value at the given position and validates that it fits into the remaining bytes. Containers are not parsed recursively.
+		/// </summary>
+		HLAPI static bool Parse(const Byte *data, const Byte *end, BinaryDocumentValue &outValue);
+
+		/// <summary>
+		/// Validates the header and parses the root value of a document.
+		/// </summary>
+		HLAPI static bool ParseDocument(const Byte *data, uint64 size, BinaryDocumentValue &outRoot);
+
+		/// <summary>
+		/// Returns the size of a scalar or of one element of a typed array, 0 for strings and unknown types.
+		/// </summary>
+		HLAPI static uint32 GetDataTypeSize(DocumentDataType type);
+
+		HLAPI bool IsScalar(DocumentDataType type) const { return (uint8)Tag == (uint8)type && ElementType == type; }
+		HLAPI bool IsObject() const { return Tag == BinaryDocumentTag::Object; }
+		HLAPI bool IsArray() const { return Tag == BinaryDocumentTag::Array || Tag == BinaryDocumentTag::TypedArray; }
+
+		/// <summary>
+		/// Finds the first member with the given key in an object.
+		/// </summary>
+		HLAPI bool FindMember(const HLString &key, BinaryDocumentValue &outValue) const;
+
+		/// <summary>
+		/// Calls the function with the key and the value of every member of an object, until it returns false.
+		/// </summary>
+		/// <returns>Returns false, if the value is no object, the document is corrupted or the function returned false.</returns>
+		template<typename MemberFunc>
+		HLAPI bool ForEachMember(MemberFunc &&memberFunc) const
+		{
+			if (!IsObject())
+				return false;
+
+			const Byte *ptr = Payload;
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				HLString key;
+				BinaryDocumentValue member;
+				if (!ParseMember(ptr, End, key, member))
+					return false;
+
+				if (!memberFunc(key, member))
+					return false;
+
+				ptr = member.End;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Calls the function with every element of an array, the elements of typed arrays are passed as scalars.
+		/// </summary>
+		template<typename ElementFunc>
+		HLAPI bool ForEachElement(ElementFunc &&elementFunc) const
+		{
+			if (Tag == BinaryDocumentTag::TypedArray)
+			{
+				uint32 elementSize = GetDataTypeSize(ElementType);
+
+				BinaryDocumentValue element;
+				element.Tag = (BinaryDocumentTag)ElementType;
+				element.ElementType = ElementType;
+
+				for (uint32 i = 0; i < Count; ++i)
+				{
+					element.Payload = Payload + (uint64)i * elementSize;
+					element.End = element.Payload + elementSize;
+
+					if (!elementFunc(element))
+						return false;
+				}
+
+				return true;
+			}
+
+			if (Tag != BinaryDocumentTag::Array)
+				return false;
+
+			const Byte *ptr = Payload;
+			for (uint32 i = 0; i < Count; ++i)
+			{
+				BinaryDocumentValue element;
+				if (!Parse(ptr, End, element))
+					return false;
+
+				if (!elementFunc(element))
+					return false;
+
+				ptr = element.End;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Renders the value as JSON, so that binary documents can still be inspected and diffed.
+		/// </summary>
+		/// <returns>Returns an empty string, if the document is corrupted or nested too deeply.</returns>
+		HLAPI HLString ToText(bool prettify = false) const;
+
+	private:
+
+		/// <summary>
+		/// Parses the key and the value of the object member at the given position.
+		/// </summary>
+		HLAPI static bool ParseMember(const Byte *data, const Byte *end, HLString &outKey, BinaryDocumentValue &outValue);
+	};
+}
+
@@ -0,0 +1,601 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "BinaryDocumentReader.h"
+
+#include "Engine/Core/FileSystem.h"
+#include "Engine/Core/MappedFile.h"
+
+#define BINARY_READER_LOG_PREFIX "BinReader>    "
+
+namespace highlo
+{
+	namespace utils
+	{
+		template<typename T>
+		static void GetValue(const BinaryDocumentValue &value, T &outValue)
+		{
+			memcpy(&outValue, value.Payload, sizeof(T));
+		}
+
+		static void GetValue(const BinaryDocumentValue &value, bool &outValue)
+		{
+			outValue = *value.Payload != 0;
+		}
+
+		static void GetValue(const BinaryDocumentValue &value, HLString &outValue)
+		{
+			outValue = HLString((const char*)value.Payload, value.Count);
+		}
+
+		template<typename T>
+		static bool CollectElements(const BinaryDocumentValue &value, DocumentDataType type, std::vector<T> &result, uint32 depth = 0)
+		{
+			if constexpr (!std::is_same_v<T, bool> && !std::is_same_v<T, HLString>)
+			{
+				if (value.Tag == BinaryDocumentTag::TypedArray && value.ElementType == type)
+				{
+					uint64 offset = result.size();
+					result.resize(offset + value.Count);
+					memcpy(result.data() + offset, value.Payload, (uint64)value.Count * sizeof(T));
+					return true;
+				}
+			}
+
+			if (value.IsScalar(type))
+			{
+				// Not emplace_back(), std::vector<bool> returns no real reference
+				T element;
+				GetValue(value, element);
+				result.push_back(element);
+				return true;
+			}
+
+			// The nesting is limited, because a crafted document could exhaust the stack otherwise
+			if (depth >= HL_BINARY_DOCUMENT_MAX_DEPTH)
+				return false;
+
+			// Arrays of objects are flattened, as in the text formats
+			if (value.IsObject())
+			{
+				return value.ForEachMember([type, &result, depth](const HLString &key, const BinaryDocumentValue &member) -> bool
+				{
+					return CollectElements(member, type, result, depth + 1);
+				});
+			}
+
+			if (value.IsArray())
+			{
+				return value.ForEachElement([type, &result, depth](const BinaryDocumentValue &element) -> bool
+				{
+					return CollectElements(element, type, result, depth + 1);
+				});
+			}
+
+			return false;
+		}
+
+		template<typename MapType>
+		static bool CollectMembers(const BinaryDocumentValue &value, DocumentDataType type, MapType &result, uint32 depth = 0)
+		{
+			if (depth >= HL_BINARY_DOCUMENT_MAX_DEPTH)
+				return false;
+
+			if (value.IsObject())
+			{
+				return value.ForEachMember([type, &result, depth](const HLString &key, const BinaryDocumentValue &member) -> bool
+				{
+					if (member.IsScalar(type))
+					{
+						GetValue(member, result[key]);
+						return true;
+					}
+
+					return CollectMembers(member, type, result, depth + 1);
+				});
+			}
+
+			if (value.Tag == BinaryDocumentTag::Array)
+			{
+				return value.ForEachElement([type, &result, depth](const BinaryDocumentValue &element) -> bool
+				{
+					return CollectMembers(element, type, result, depth + 1);
+				});
+			}
+
+			return false;
+		}
+
+		static bool StreamValue(DocumentStreamHandler &handler, const BinaryDocumentValue &value, uint32 depth = 0)
+		{
+			if (value.Tag == BinaryDocumentTag::Null)
+				return handler.OnNull();
+
+			if ((value.IsObject() || value.IsArray()) && depth >= HL_BINARY_DOCUMENT_MAX_DEPTH)
+				return false;
+
+			if (value.IsObject())
+			{
+				if (!handler.OnBeginObject())
+					return false;
+
+				bool success = value.ForEachMember([&handler, depth](const HLString &key, const BinaryDocumentValue &member) -> bool
+				{
+					return handler.OnKey(*key, key.Length()) && StreamValue(handler, member, depth + 1);
+				});
+
+				return success && handler.OnEndObject(value.Count);
+			}
+
+			if (value.IsArray())
+			{
+				if (!handler.OnBeginArray())
+					return false;
+
+				bool success = value.ForEachElement([&handler, depth](const BinaryDocumentValue &element) -> bool
+				{
+					return StreamValue(handler, element, depth + 1);
+				});
+
+				return success && handler.OnEndArray(value.Count);
+			}
+
+			switch (value.ElementType)
+			{
+				case DocumentDataType::Int32:	{ int32 v; GetValue(value, v); return v < 0 ? handler.OnInt64(v) : handler.OnUInt64((uint64)v); }
+				case DocumentDataType::UInt32:	{ uint32 v; GetValue(value, v); return handler.OnUInt64(v); }
+				case DocumentDataType::Int64:	{ int64 v; GetValue(value, v); return v < 0 ? handler.OnInt64(v) : handler.OnUInt64((uint64)v); }
+				case DocumentDataType::UInt64:	{ uint64 v; GetValue(value, v); return handler.OnUInt64(v); }
+				case DocumentDataType::Float:	{ float v; GetValue(value, v); return handler.OnDouble(v); }
+				case DocumentDataType::Double:	{ double v; GetValue(value, v); return handler.OnDouble(v); }
+				case DocumentDataType::Bool:	return handler.OnBool(*value.Payload != 0);
+				case DocumentDataType::String:	return handler.OnString((const char*)value.Payload, value.Count);
+			}
+
+			// Vectors, matrices and quaternions are reported as arrays of their components
+			uint32 componentCount = BinaryDocumentValue::GetDataTypeSize(value.ElementType) / sizeof(float);
+			if (!handler.OnBeginArray())
+				return false;
+
+			for (uint32 i = 0; i < componentCount; ++i)
+			{
+				float component;
+				memcpy(&component, value.Payload + i * sizeof(float), sizeof(float));
+				if (!handler.OnDouble(component))
+					return false;
+			}
+
+			return handler.OnEndArray(componentCount);
+		}
+	}
+
+	BinaryDocumentReader::BinaryDocumentReader(const FileSystemPath &filePath)
+		: m_FilePath(filePath)
+	{
+	}
+
+	BinaryDocumentReader::~BinaryDocumentReader()
+	{
+	}
+
+	bool BinaryDocumentReader::ReadFloat(const HLString &key, float *result)
+	{
+		return Read(key, DocumentDataType::Float, result);
+	}
+
+	bool BinaryDocumentReader::ReadDouble(const HLString &key, double *result)
+	{
+		return Read(key, DocumentDataType::Double, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt32(const HLString &key, int32 *result)
+	{
+		return Read(key, DocumentDataType::Int32, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt32(const HLString &key, uint32 *result)
+	{
+		return Read(key, DocumentDataType::UInt32, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt64(const HLString &key, int64 *result)
+	{
+		return Read(key, DocumentDataType::Int64, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt64(const HLString &key, uint64 *result)
+	{
+		return Read(key, DocumentDataType::UInt64, result);
+	}
+
+	bool BinaryDocumentReader::ReadBool(const HLString &key, bool *result)
+	{
+		return Read(key, DocumentDataType::Bool, result);
+	}
+
+	bool BinaryDocumentReader::ReadString(const HLString &key, HLString *result)
+	{
+		return Read(key, DocumentDataType::String, result);
+	}
+
+	bool BinaryDocumentReader::ReadVector2(const HLString &key, glm::vec2 *result)
+	{
+		return Read(key, DocumentDataType::Vec2, result);
+	}
+
+	bool BinaryDocumentReader::ReadVector3(const HLString &key, glm::vec3 *result)
+	{
+		return Read(key, DocumentDataType::Vec3, result);
+	}
+
+	bool BinaryDocumentReader::ReadVector4(const HLString &key, glm::vec4 *result)
+	{
+		return Read(key, DocumentDataType::Vec4, result);
+	}
+
+	bool BinaryDocumentReader::ReadMatrix2(const HLString &key, glm::mat2 *result)
+	{
+		return Read(key, DocumentDataType::Mat2, result);
+	}
+
+	bool BinaryDocumentReader::ReadMatrix3(const HLString &key, glm::mat3 *result)
+	{
+		return Read(key, DocumentDataType::Mat3, result);
+	}
+
+	bool BinaryDocumentReader::ReadMatrix4(const HLString &key, glm::mat4 *result)
+	{
+		return Read(key, DocumentDataType::Mat4, result);
+	}
+
+	bool BinaryDocumentReader::ReadQuaternion(const HLString &key, glm::quat *result)
+	{
+		return Read(key, DocumentDataType::Quat, result);
+	}
+
+	bool BinaryDocumentReader::ReadFloatArray(const HLString &key, std::vector<float> &result)
+	{
+		return ReadArray(key, DocumentDataType::Float, result);
+	}
+
+	bool BinaryDocumentReader::ReadDoubleArray(const HLString &key, std::vector<double> &result)
+	{
+		return ReadArray(key, DocumentDataType::Double, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt32Array(const HLString &key, std::vector<int32> &result)
+	{
+		return ReadArray(key, DocumentDataType::Int32, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt32Array(const HLString &key, std::vector<uint32> &result)
+	{
+		return ReadArray(key, DocumentDataType::UInt32, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt64Array(const HLString &key, std::vector<int64> &result)
+	{
+		return ReadArray(key, DocumentDataType::Int64, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt64Array(const HLString &key, std::vector<uint64> &result)
+	{
+		return ReadArray(key, DocumentDataType::UInt64, result);
+	}
+
+	bool BinaryDocumentReader::ReadBoolArray(const HLString &key, std::vector<bool> &result)
+	{
+		return ReadArray(key, DocumentDataType::Bool, result);
+	}
+
+	bool BinaryDocumentReader::ReadStringArray(const HLString &key, std::vector<HLString> &result)
+	{
+		return ReadArray(key, DocumentDataType::String, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec2Array(const HLString &key, std::vector<glm::vec2> &result)
+	{
+		return ReadArray(key, DocumentDataType::Vec2, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec3Array(const HLString &key, std::vector<glm::vec3> &result)
+	{
+		return ReadArray(key, DocumentDataType::Vec3, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec4Array(const HLString &key, std::vector<glm::vec4> &result)
+	{
+		return ReadArray(key, DocumentDataType::Vec4, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat2Array(const HLString &key, std::vector<glm::mat2> &result)
+	{
+		return ReadArray(key, DocumentDataType::Mat2, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat3Array(const HLString &key, std::vector<glm::mat3> &result)
+	{
+		return ReadArray(key, DocumentDataType::Mat3, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat4Array(const HLString &key, std::vector<glm::mat4> &result)
+	{
+		return ReadArray(key, DocumentDataType::Mat4, result);
+	}
+
+	bool BinaryDocumentReader::ReadQuatArray(const HLString &key, std::vector<glm::quat> &result)
+	{
+		return ReadArray(key, DocumentDataType::Quat, result);
+	}
+
+	bool BinaryDocumentReader::ReadFloatArrayMap(const HLString &key, std::map<HLString, float> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Float, result);
+	}
+
+	bool BinaryDocumentReader::ReadDoubleArrayMap(const HLString &key, std::map<HLString, double> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Double, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt32ArrayMap(const HLString &key, std::map<HLString, int32> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Int32, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt32ArrayMap(const HLString &key, std::map<HLString, uint32> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::UInt32, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt64ArrayMap(const HLString &key, std::map<HLString, int64> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Int64, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt64ArrayMap(const HLString &key, std::map<HLString, uint64> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::UInt64, result);
+	}
+
+	bool BinaryDocumentReader::ReadBoolArrayMap(const HLString &key, std::map<HLString, bool> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Bool, result);
+	}
+
+	bool BinaryDocumentReader::ReadStringArrayMap(const HLString &key, std::map<HLString, HLString> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::String, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec2ArrayMap(const HLString &key, std::map<HLString, glm::vec2> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Vec2, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec3ArrayMap(const HLString &key, std::map<HLString, glm::vec3> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Vec3, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec4ArrayMap(const HLString &key, std::map<HLString, glm::vec4> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Vec4, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat2ArrayMap(const HLString &key, std::map<HLString, glm::mat2> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Mat2, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat3ArrayMap(const HLString &key, std::map<HLString, glm::mat3> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Mat3, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat4ArrayMap(const HLString &key, std::map<HLString, glm::mat4> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Mat4, result);
+	}
+
+	bool BinaryDocumentReader::ReadQuatArrayMap(const HLString &key, std::map<HLString, glm::quat> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Quat, result);
+	}
+
+	bool BinaryDocumentReader::ReadFloatArrayMap(const HLString &key, std::unordered_map<HLString, float> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Float, result);
+	}
+
+	bool BinaryDocumentReader::ReadDoubleArrayMap(const HLString &key, std::unordered_map<HLString, double> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Double, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt32ArrayMap(const HLString &key, std::unordered_map<HLString, int32> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Int32, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt32ArrayMap(const HLString &key, std::unordered_map<HLString, uint32> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::UInt32, result);
+	}
+
+	bool BinaryDocumentReader::ReadInt64ArrayMap(const HLString &key, std::unordered_map<HLString, int64> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Int64, result);
+	}
+
+	bool BinaryDocumentReader::ReadUInt64ArrayMap(const HLString &key, std::unordered_map<HLString, uint64> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::UInt64, result);
+	}
+
+	bool BinaryDocumentReader::ReadBoolArrayMap(const HLString &key, std::unordered_map<HLString, bool> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Bool, result);
+	}
+
+	bool BinaryDocumentReader::ReadStringArrayMap(const HLString &key, std::unordered_map<HLString, HLString> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::String, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec2ArrayMap(const HLString &key, std::unordered_map<HLString, glm::vec2> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Vec2, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec3ArrayMap(const HLString &key, std::unordered_map<HLString, glm::vec3> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Vec3, result);
+	}
+
+	bool BinaryDocumentReader::ReadVec4ArrayMap(const HLString &key, std::unordered_map<HLString, glm::vec4> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Vec4, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat2ArrayMap(const HLString &key, std::unordered_map<HLString, glm::mat2> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Mat2, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat3ArrayMap(const HLString &key, std::unordered_map<HLString, glm::mat3> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Mat3, result);
+	}
+
+	bool BinaryDocumentReader::ReadMat4ArrayMap(const HLString &key, std::unordered_map<HLString, glm::mat4> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Mat4, result);
+	}
+
+	bool BinaryDocumentReader::ReadQuatArrayMap(const HLString &key, std::unordered_map<HLString, glm::quat> &result)
+	{
+		return ReadArrayMap(key, DocumentDataType::Quat, result);
+	}
+
+	bool BinaryDocumentReader::ReadContents(const FileSystemPath &filePath)
+	{
+		if (!filePath.String().IsEmpty())
+			m_FilePath = filePath;
+
+		if (!FileSystem::Get()->FileExists(m_FilePath))
+		{
+			HL_CORE_ERROR(BINARY_READER_LOG_PREFIX "[-] Error: File {0} not found! [-]", **m_FilePath);
+			return false;
+		}
+
+		MappedFile file(m_FilePath, MappedFileAccess::Sequential);
+		if (!file)
+			return false;
+
+		// Copied instead of keeping the mapping alive, so that the file can be written again while the reader exists
+		m_Buffer.assign(file.GetData(), file.GetData() + file.GetSize());
+
+		HL_CORE_INFO(BINARY_READER_LOG_PREFIX "[+] Loaded {0} [+]", **m_FilePath);
+		return ParseBuffer();
+	}
+
+	HLString BinaryDocumentReader::GetContent(bool prettify)
+	{
+		if (m_Root.Tag == BinaryDocumentTag::Null)
+			return "";
+
+		return m_Root.ToText(prettify);
+	}
+
+	void BinaryDocumentReader::SetContent(const HLString &content)
+	{
+		m_Buffer.assign((const Byte*)*content, (const Byte*)*content + content.Length());
+		ParseBuffer();
+	}
+
+	bool BinaryDocumentReader::ReadStream(DocumentStreamHandler &handler, const FileSystemPath &filePath)
+	{
+		const FileSystemPath &path = filePath.String().IsEmpty() ? m_FilePath : filePath;
+
+		MappedFile file(path, MappedFileAccess::Sequential);
+		if (!file)
+		{
+			HL_CORE_ERROR(BINARY_READER_LOG_PREFIX "[-] Error: File {0} not found! [-]", **path);
+			return false;
+		}
+
+		BinaryDocumentValue root;
+		if (!BinaryDocumentValue::ParseDocument(file.GetData(), file.GetSize(), root))
+		{
+			HL_CORE_ERROR(BINARY_READER_LOG_PREFIX "[-] Error: {0} is no valid binary document [-]", **path);
+			return false;
+		}
+
+		return utils::StreamValue(handler, root);
+	}
+
+	bool BinaryDocumentReader::FindValue(const HLString &key, BinaryDocumentValue &outValue) const
+	{
+		if (m_Root.Tag == BinaryDocumentTag::Null)
+		{
+			HL_CORE_ERROR(BINARY_READER_LOG_PREFIX "[-] Error: Document Root was null! [-]");
+			return false;
+		}
+
+		if (key.IsEmpty())
+		{
+			outValue = m_Root;
+			return true;
+		}
+
+		return m_Root.FindMember(key, outValue);
+	}
+
+	bool BinaryDocumentReader::ParseBuffer()
+	{
+		if (!BinaryDocumentValue::ParseDocument(m_Buffer.data(), m_Buffer.size(), m_Root))
+		{
+			m_Root = BinaryDocumentValue();
+			HL_CORE_ERROR(BINARY_READER_LOG_PREFIX "[-] Error: {0} is no valid binary document [-]", **m_FilePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	bool BinaryDocumentReader::Read(const HLString &key, DocumentDataType type, T *result)
+	{
+		if (!result)
+			return false;
+
+		BinaryDocumentValue value;
+		if (!FindValue(key, value) || !value.IsScalar(type))
+			return false;
+
+		utils::GetValue(value, *result);
+		return true;
+	}
+
+	template<typename T>
+	bool BinaryDocumentReader::ReadArray(const HLString &key, DocumentDataType type, std::vector<T> &result)
+	{
+		BinaryDocumentValue value;
+		if (!FindValue(key, value))
+			return false;
+
+		return utils::CollectElements(value, type, result);
+	}
+
+	template<typename MapType>
+	bool BinaryDocumentReader::ReadArrayMap(const HLString &key, DocumentDataType type, MapType &result)
+	{
+		BinaryDocumentValue value;
+		if (!FindValue(key, value))
+			return false;
+
+		return utils::CollectMembers(value, type, result);
+	}
+}
+
@@ -0,0 +1,812 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "BinaryDocumentWriter.h"
+
+#define BINARY_WRITER_LOG_PREFIX "BinWriter>    "
+
+namespace highlo
+{
+	// The values are copied with memcpy, so the glm types have to match the sizes of the format
+	static_assert(sizeof(glm::vec2) == 2 * sizeof(float) && sizeof(glm::vec3) == 3 * sizeof(float) && sizeof(glm::vec4) == 4 * sizeof(float));
+	static_assert(sizeof(glm::mat2) == 4 * sizeof(float) && sizeof(glm::mat3) == 9 * sizeof(float) && sizeof(glm::mat4) == 16 * sizeof(float));
+	static_assert(sizeof(glm::quat) == 4 * sizeof(float));
+
+	namespace utils
+	{
+		static void AppendBytes(std::vector<Byte> &buffer, const void *data, uint64 size)
+		{
+			const Byte *bytes = (const Byte*)data;
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+
+		static void AppendUInt32(std::vector<Byte> &buffer, uint32 value)
+		{
+			AppendBytes(buffer, &value, sizeof(uint32));
+		}
+
+		static void AppendKey(std::vector<Byte> &buffer, const HLString &key)
+		{
+			AppendUInt32(buffer, key.Length());
+			AppendBytes(buffer, *key, key.Length());
+		}
+
+		template<typename T>
+		static void AppendValue(std::vector<Byte> &buffer, DocumentDataType type, const T &value)
+		{
+			buffer.push_back((Byte)type);
+			AppendBytes(buffer, &value, sizeof(T));
+		}
+
+		static void AppendValue(std::vector<Byte> &buffer, DocumentDataType type, bool value)
+		{
+			buffer.push_back((Byte)DocumentDataType::Bool);
+			buffer.push_back(value ? 1 : 0);
+		}
+
+		static void AppendValue(std::vector<Byte> &buffer, DocumentDataType type, const HLString &value)
+		{
+			buffer.push_back((Byte)DocumentDataType::String);
+			AppendKey(buffer, value);
+		}
+
+		/// <summary>
+		/// Writes the header of an object or array with a placeholder for the size, that is filled in by EndContainer().
+		/// </summary>
+		static uint64 BeginContainer(std::vector<Byte> &buffer, BinaryDocumentTag tag, uint32 count)
+		{
+			buffer.push_back((Byte)tag);
+			uint64 sizeOffset = buffer.size();
+			AppendUInt32(buffer, 0);
+			AppendUInt32(buffer, count);
+			return sizeOffset;
+		}
+
+		static void EndContainer(std::vector<Byte> &buffer, uint64 sizeOffset)
+		{
+			uint64 size = buffer.size() - sizeOffset - 2 * sizeof(uint32);
+			HL_ASSERT(size <= UINT32_MAX, "Binary documents can only contain containers up to 4GB");
+
+			uint32 payloadSize = (uint32)size;
+			memcpy(buffer.data() + sizeOffset, &payloadSize, sizeof(uint32));
+		}
+
+		static void AppendContainer(std::vector<Byte> &buffer, BinaryDocumentTag tag, uint32 count, const std::vector<Byte> &payload)
+		{
+			uint64 sizeOffset = BeginContainer(buffer, tag, count);
+			AppendBytes(buffer, payload.data(), payload.size());
+			EndContainer(buffer, sizeOffset);
+		}
+
+		template<typename T>
+		static void AppendArray(std::vector<Byte> &buffer, DocumentDataType type, const std::vector<T> &values)
+		{
+			// The elements have the same layout in memory and in the file, so the whole array is copied at once
+			buffer.push_back((Byte)BinaryDocumentTag::TypedArray);
+			buffer.push_back((Byte)type);
+			AppendUInt32(buffer, (uint32)values.size());
+			AppendBytes(buffer, values.data(), values.size() * sizeof(T));
+		}
+
+		static void AppendArray(std::vector<Byte> &buffer, DocumentDataType type, const std::vector<bool> &values)
+		{
+			buffer.push_back((Byte)BinaryDocumentTag::TypedArray);
+			buffer.push_back((Byte)DocumentDataType::Bool);
+			AppendUInt32(buffer, (uint32)values.size());
+
+			for (bool value : values)
+				buffer.push_back(value ? 1 : 0);
+		}
+
+		static void AppendArray(std::vector<Byte> &buffer, DocumentDataType type, const std::vector<HLString> &values)
+		{
+			uint64 sizeOffset = BeginContainer(buffer, BinaryDocumentTag::Array, (uint32)values.size());
+			for (const HLString &value : values)
+				AppendValue(buffer, DocumentDataType::String, value);
+
+			EndContainer(buffer, sizeOffset);
+		}
+
+		template<typename MapType>
+		static void AppendMap(std::vector<Byte> &buffer, DocumentDataType type, const MapType &map)
+		{
+			uint64 sizeOffset = BeginContainer(buffer, BinaryDocumentTag::Object, (uint32)map.size());
+			for (const auto &[key, value] : map)
+			{
+				AppendKey(buffer, key);
+				AppendValue(buffer, type, value);
+			}
+
+			EndContainer(buffer, sizeOffset);
+		}
+	}
+
+	BinaryDocumentWriter::BinaryDocumentWriter(const FileSystemPath &filePath)
+		: m_FilePath(filePath)
+	{
+	}
+
+	BinaryDocumentWriter::~BinaryDocumentWriter()
+	{
+	}
+
+	void BinaryDocumentWriter::BeginArray()
+	{
+		m_ShouldWriteIntoArray = true;
+		m_ArrayElements.clear();
+		m_ArrayElementCount = 0;
+	}
+
+	void BinaryDocumentWriter::EndArray(const HLString &key, bool rawData)
+	{
+		if (!m_ShouldWriteIntoArray)
+			return;
+
+		m_ShouldWriteIntoArray = false;
+
+		if (key.IsEmpty())
+		{
+			m_RootArray.clear();
+			utils::AppendContainer(m_RootArray, BinaryDocumentTag::Array, m_ArrayElementCount, m_ArrayElements);
+			m_RootIsArray = true;
+		}
+		else if (CanWriteIntoRoot())
+		{
+			utils::AppendKey(m_RootMembers, key);
+			utils::AppendContainer(m_RootMembers, BinaryDocumentTag::Array, m_ArrayElementCount, m_ArrayElements);
+			++m_RootMemberCount;
+		}
+
+		m_ArrayElements.clear();
+		m_ArrayElementCount = 0;
+	}
+
+	void BinaryDocumentWriter::BeginObject()
+	{
+		m_ShouldWriteIntoObject = true;
+		m_ObjectMembers.clear();
+		m_ObjectMemberCount = 0;
+	}
+
+	void BinaryDocumentWriter::EndObject(bool rawData)
+	{
+		if (!m_ShouldWriteIntoObject)
+			return;
+
+		m_ShouldWriteIntoObject = false;
+
+		if (m_ShouldWriteIntoArray)
+		{
+			utils::AppendContainer(m_ArrayElements, BinaryDocumentTag::Object, m_ObjectMemberCount, m_ObjectMembers);
+			++m_ArrayElementCount;
+		}
+		else if (CanWriteIntoRoot())
+		{
+			// Objects outside of arrays add their members to the root
+			utils::AppendBytes(m_RootMembers, m_ObjectMembers.data(), m_ObjectMembers.size());
+			m_RootMemberCount += m_ObjectMemberCount;
+		}
+
+		m_ObjectMembers.clear();
+		m_ObjectMemberCount = 0;
+	}
+
+	bool BinaryDocumentWriter::WriteFloat(const HLString &key, float value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Float, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteDouble(const HLString &key, double value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Double, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt32(const HLString &key, int32 value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Int32, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt32(const HLString &key, uint32 value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::UInt32, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt64(const HLString &key, int64 value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Int64, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt64(const HLString &key, uint64 value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::UInt64, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteBool(const HLString &key, bool value)
+	{
+		return Write(key, [value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Bool, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteString(const HLString &key, const HLString &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::String, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec2(const HLString &key, const glm::vec2 &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Vec2, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec3(const HLString &key, const glm::vec3 &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Vec3, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec4(const HLString &key, const glm::vec4 &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Vec4, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat2(const HLString &key, const glm::mat2 &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Mat2, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat3(const HLString &key, const glm::mat3 &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Mat3, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat4(const HLString &key, const glm::mat4 &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Mat4, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteQuaternion(const HLString &key, const glm::quat &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendValue(buffer, DocumentDataType::Quat, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteFloatArray(const HLString &key, const std::vector<float> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Float, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteDoubleArray(const HLString &key, const std::vector<double> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Double, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt32Array(const HLString &key, const std::vector<int32> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Int32, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt32Array(const HLString &key, const std::vector<uint32> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::UInt32, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt64Array(const HLString &key, const std::vector<int64> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Int64, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt64Array(const HLString &key, const std::vector<uint64> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::UInt64, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteBoolArray(const HLString &key, const std::vector<bool> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Bool, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteStringArray(const HLString &key, const std::vector<HLString> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::String, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec2Array(const HLString &key, const std::vector<glm::vec2> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Vec2, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec3Array(const HLString &key, const std::vector<glm::vec3> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Vec3, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec4Array(const HLString &key, const std::vector<glm::vec4> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Vec4, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat2Array(const HLString &key, const std::vector<glm::mat2> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Mat2, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat3Array(const HLString &key, const std::vector<glm::mat3> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Mat3, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat4Array(const HLString &key, const std::vector<glm::mat4> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Mat4, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteQuaternionArray(const HLString &key, const std::vector<glm::quat> &value)
+	{
+		return Write(key, [&value](std::vector<Byte> &buffer)
+		{
+			utils::AppendArray(buffer, DocumentDataType::Quat, value);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteFloatArrayMap(const HLString &key, const std::map<HLString, float> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Float, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteDoubleArrayMap(const HLString &key, const std::map<HLString, double> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Double, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt32ArrayMap(const HLString &key, const std::map<HLString, int32> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Int32, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt32ArrayMap(const HLString &key, const std::map<HLString, uint32> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::UInt32, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt64ArrayMap(const HLString &key, const std::map<HLString, int64> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Int64, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt64ArrayMap(const HLString &key, const std::map<HLString, uint64> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::UInt64, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteBoolArrayMap(const HLString &key, const std::map<HLString, bool> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Bool, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteStringArrayMap(const HLString &key, const std::map<HLString, HLString> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::String, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec2ArrayMap(const HLString &key, const std::map<HLString, glm::vec2> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Vec2, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec3ArrayMap(const HLString &key, const std::map<HLString, glm::vec3> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Vec3, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec4ArrayMap(const HLString &key, const std::map<HLString, glm::vec4> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Vec4, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat2ArrayMap(const HLString &key, const std::map<HLString, glm::mat2> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Mat2, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat3ArrayMap(const HLString &key, const std::map<HLString, glm::mat3> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Mat3, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat4ArrayMap(const HLString &key, const std::map<HLString, glm::mat4> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Mat4, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteQuaternionArrayMap(const HLString &key, const std::map<HLString, glm::quat> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Quat, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteFloatArrayMap(const HLString &key, const std::unordered_map<HLString, float> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Float, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteDoubleArrayMap(const HLString &key, const std::unordered_map<HLString, double> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Double, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt32ArrayMap(const HLString &key, const std::unordered_map<HLString, int32> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Int32, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt32ArrayMap(const HLString &key, const std::unordered_map<HLString, uint32> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::UInt32, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteInt64ArrayMap(const HLString &key, const std::unordered_map<HLString, int64> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Int64, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteUInt64ArrayMap(const HLString &key, const std::unordered_map<HLString, uint64> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::UInt64, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteBoolArrayMap(const HLString &key, const std::unordered_map<HLString, bool> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Bool, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteStringArrayMap(const HLString &key, const std::unordered_map<HLString, HLString> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::String, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec2ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::vec2> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Vec2, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec3ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::vec3> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Vec3, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteVec4ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::vec4> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Vec4, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat2ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::mat2> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Mat2, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat3ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::mat3> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Mat3, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteMat4ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::mat4> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Mat4, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::WriteQuaternionArrayMap(const HLString &key, const std::unordered_map<HLString, glm::quat> &map)
+	{
+		return Write(key, [&map](std::vector<Byte> &buffer)
+		{
+			utils::AppendMap(buffer, DocumentDataType::Quat, map);
+		});
+	}
+
+	bool BinaryDocumentWriter::HasKey(const HLString &key) const
+	{
+		BinaryDocumentValue value;
+		return GetRoot().FindMember(key, value);
+	}
+
+	bool BinaryDocumentWriter::WriteOut()
+	{
+		HL_CORE_INFO(BINARY_WRITER_LOG_PREFIX "[+] Writing file {0} [+]", **m_FilePath);
+		std::vector<Byte> data = GetData();
+
+		FILE *file = fopen(**m_FilePath, "wb");
+		if (!file)
+		{
+			HL_CORE_ERROR(BINARY_WRITER_LOG_PREFIX "[-] Could not open file {0} [-]", **m_FilePath);
+			return false;
+		}
+
+		bool success = fwrite(data.data(), 1, data.size(), file) == data.size();
+		fclose(file);
+
+		if (!success)
+			HL_CORE_ERROR(BINARY_WRITER_LOG_PREFIX "[-] Could not write file {0} [-]", **m_FilePath);
+
+		return success;
+	}
+
+	HLString BinaryDocumentWriter::GetContent(bool prettify)
+	{
+		return GetRoot().ToText(prettify);
+	}
+
+	void BinaryDocumentWriter::SetContent(const HLString &content)
+	{
+		BinaryDocumentValue root;
+		if (!BinaryDocumentValue::ParseDocument((const Byte*)*content, content.Length(), root) || !(root.IsObject() || root.Tag == BinaryDocumentTag::Array))
+		{
+			HL_CORE_ERROR(BINARY_WRITER_LOG_PREFIX "[-] The content is no valid binary document [-]");
+			return;
+		}
+
+		m_RootMembers.clear();
+		m_RootMemberCount = 0;
+		m_RootArray.clear();
+		m_RootIsArray = !root.IsObject();
+
+		if (m_RootIsArray)
+		{
+			m_RootArray.assign((const Byte*)*content + sizeof(BinaryDocumentHeader), root.End);
+		}
+		else
+		{
+			m_RootMembers.assign(root.Payload, root.End);
+			m_RootMemberCount = root.Count;
+		}
+	}
+
+	std::vector<Byte> BinaryDocumentWriter::GetData() const
+	{
+		BinaryDocumentHeader header;
+
+		std::vector<Byte> data;
+		data.reserve(sizeof(BinaryDocumentHeader) + 9 + (m_RootIsArray ? m_RootArray.size() : m_RootMembers.size()));
+		utils::AppendBytes(data, &header, sizeof(BinaryDocumentHeader));
+
+		if (m_RootIsArray)
+			utils::AppendBytes(data, m_RootArray.data(), m_RootArray.size());
+		else
+			utils::AppendContainer(data, BinaryDocumentTag::Object, m_RootMemberCount, m_RootMembers);
+
+		return data;
+	}
+
+	template<typename EncodeFunc>
+	bool BinaryDocumentWriter::Write(const HLString &key, EncodeFunc &&encodeFunc)
+	{
+		if (key.IsEmpty())
+		{
+			HL_CORE_ERROR(BINARY_WRITER_LOG_PREFIX "[-] You have to specify a key! [-]");
+			return false;
+		}
+
+		if (m_ShouldWriteIntoObject)
+		{
+			utils::AppendKey(m_ObjectMembers, key);
+			encodeFunc(m_ObjectMembers);
+			++m_ObjectMemberCount;
+		}
+		else if (m_ShouldWriteIntoArray)
+		{
+			// Values outside of objects become objects with a single member, as in the text formats
+			uint64 sizeOffset = utils::BeginContainer(m_ArrayElements, BinaryDocumentTag::Object, 1);
+			utils::AppendKey(m_ArrayElements, key);
+			encodeFunc(m_ArrayElements);
+			utils::EndContainer(m_ArrayElements, sizeOffset);
+			++m_ArrayElementCount;
+		}
+		else if (CanWriteIntoRoot())
+		{
+			utils::AppendKey(m_RootMembers, key);
+			encodeFunc(m_RootMembers);
+			++m_RootMemberCount;
+		}
+		else
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	bool BinaryDocumentWriter::CanWriteIntoRoot() const
+	{
+		if (m_RootIsArray)
+		{
+			HL_CORE_ERROR(BINARY_WRITER_LOG_PREFIX "[-] The document is an array, values can only be added inside of BeginArray() and EndArray() [-]");
+			return false;
+		}
+
+		return true;
+	}
+
+	BinaryDocumentValue BinaryDocumentWriter::GetRoot() const
+	{
+		BinaryDocumentValue root;
+		if (m_RootIsArray)
+		{
+			BinaryDocumentValue::Parse(m_RootArray.data(), m_RootArray.data() + m_RootArray.size(), root);
+			return root;
+		}
+
+		root.Tag = BinaryDocumentTag::Object;
+		root.Count = m_RootMemberCount;
+		root.Payload = m_RootMembers.data();
+		root.End = m_RootMembers.data() + m_RootMembers.size();
+		return root;
+	}
+}
+
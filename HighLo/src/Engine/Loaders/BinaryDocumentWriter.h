@@ -0,0 +1,145 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+/**
+ * Writes documents in the binary format described in BinaryDocument.h, selected with DocumentType::Binary.
+ *
+ * Every value is encoded into a byte buffer as soon as it is written, arrays of numbers, vectors, matrices and quaternions
+ * are copied as one raw block. The types are part of the tags, so the rawData flags of EndArray and EndObject have no effect.
+ * GetContent() returns the document as JSON text for debugging, the binary data is returned by GetData().
+ */
+
+#pragma once
+
+#include "DocumentWriter.h"
+#include "BinaryDocument.h"
+
+namespace highlo
+{
+	class BinaryDocumentWriter : public DocumentWriter
+	{
+	public:
+
+		BinaryDocumentWriter(const FileSystemPath &filePath);
+		virtual ~BinaryDocumentWriter();
+
+		virtual void BeginArray() override;
+		virtual void EndArray(const HLString &key = "", bool rawData = false) override;
+
+		virtual void BeginObject() override;
+		virtual void EndObject(bool rawData = false) override;
+
+		virtual bool WriteFloat(const HLString &key, float value) override;
+		virtual bool WriteDouble(const HLString &key, double value) override;
+		virtual bool WriteInt32(const HLString &key, int32 value) override;
+		virtual bool WriteUInt32(const HLString &key, uint32 value) override;
+		virtual bool WriteInt64(const HLString &key, int64 value) override;
+		virtual bool WriteUInt64(const HLString &key, uint64 value) override;
+		virtual bool WriteBool(const HLString &key, bool value) override;
+		virtual bool WriteString(const HLString &key, const HLString &value) override;
+
+		virtual bool WriteVec2(const HLString &key, const glm::vec2 &value) override;
+		virtual bool WriteVec3(const HLString &key, const glm::vec3 &value) override;
+		virtual bool WriteVec4(const HLString &key, const glm::vec4 &value) override;
+		virtual bool WriteMat2(const HLString &key, const glm::mat2 &value) override;
+		virtual bool WriteMat3(const HLString &key, const glm::mat3 &value) override;
+		virtual bool WriteMat4(const HLString &key, const glm::mat4 &value) override;
+		virtual bool WriteQuaternion(const HLString &key, const glm::quat &value) override;
+
+		virtual bool WriteStringArray(const HLString &key, const std::vector<HLString> &value) override;
+		virtual bool WriteInt32Array(const HLString &key, const std::vector<int32> &value) override;
+		virtual bool WriteUInt32Array(const HLString &key, const std::vector<uint32> &value) override;
+		virtual bool WriteInt64Array(const HLString &key, const std::vector<int64> &value) override;
+		virtual bool WriteUInt64Array(const HLString &key, const std::vector<uint64> &value) override;
+		virtual bool WriteBoolArray(const HLString &key, const std::vector<bool> &value) override;
+		virtual bool WriteFloatArray(const HLString &key, const std::vector<float> &value) override;
+		virtual bool WriteDoubleArray(const HLString &key, const std::vector<double> &value) override;
+
+		virtual bool WriteVec2Array(const HLString &key, const std::vector<glm::vec2> &value) override;
+		virtual bool WriteVec3Array(const HLString &key, const std::vector<glm::vec3> &value) override;
+		virtual bool WriteVec4Array(const HLString &key, const std::vector<glm::vec4> &value) override;
+		virtual bool WriteMat2Array(const HLString &key, const std::vector<glm::mat2> &value) override;
+		virtual bool WriteMat3Array(const HLString &key, const std::vector<glm::mat3> &value) override;
+		virtual bool WriteMat4Array(const HLString &key, const std::vector<glm::mat4> &value) override;
+		virtual bool WriteQuaternionArray(const HLString &key, const std::vector<glm::quat> &value) override;
+
+		virtual bool WriteStringArrayMap(const HLString &key, const std::map<HLString, HLString> &map) override;
+		virtual bool WriteInt32ArrayMap(const HLString &key, const std::map<HLString, int32> &map) override;
+		virtual bool WriteUInt32ArrayMap(const HLString &key, const std::map<HLString, uint32> &map) override;
+		virtual bool WriteInt64ArrayMap(const HLString &key, const std::map<HLString, int64> &map) override;
+		virtual bool WriteUInt64ArrayMap(const HLString &key, const std::map<HLString, uint64> &map) override;
+		virtual bool WriteBoolArrayMap(const HLString &key, const std::map<HLString, bool> &map) override;
+		virtual bool WriteFloatArrayMap(const HLString &key, const std::map<HLString, float> &map) override;
+		virtual bool WriteDoubleArrayMap(const HLString &key, const std::map<HLString, double> &map) override;
+
+		virtual bool WriteVec2ArrayMap(const HLString &key, const std::map<HLString, glm::vec2> &map) override;
+		virtual bool WriteVec3ArrayMap(const HLString &key, const std::map<HLString, glm::vec3> &map) override;
+		virtual bool WriteVec4ArrayMap(const HLString &key, const std::map<HLString, glm::vec4> &map) override;
+		virtual bool WriteMat2ArrayMap(const HLString &key, const std::map<HLString, glm::mat2> &map) override;
+		virtual bool WriteMat3ArrayMap(const HLString &key, const std::map<HLString, glm::mat3> &map) override;
+		virtual bool WriteMat4ArrayMap(const HLString &key, const std::map<HLString, glm::mat4> &map) override;
+		virtual bool WriteQuaternionArrayMap(const HLString &key, const std::map<HLString, glm::quat> &map) override;
+
+		virtual bool WriteStringArrayMap(const HLString &key, const std::unordered_map<HLString, HLString> &map) override;
+		virtual bool WriteInt32ArrayMap(const HLString &key, const std::unordered_map<HLString, int32> &map) override;
+		virtual bool WriteUInt32ArrayMap(const HLString &key, const std::unordered_map<HLString, uint32> &map) override;
+		virtual bool WriteInt64ArrayMap(const HLString &key, const std::unordered_map<HLString, int64> &map) override;
+		virtual bool WriteUInt64ArrayMap(const HLString &key, const std::unordered_map<HLString, uint64> &map) override;
+		virtual bool WriteBoolArrayMap(const HLString &key, const std::unordered_map<HLString, bool> &map) override;
+		virtual bool WriteFloatArrayMap(const HLString &key, const std::unordered_map<HLString, float> &map) override;
+		virtual bool WriteDoubleArrayMap(const HLString &key, const std::unordered_map<HLString, double> &map) override;
+
+		virtual bool WriteVec2ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::vec2> &map) override;
+		virtual bool WriteVec3ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::vec3> &map) override;
+		virtual bool WriteVec4ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::vec4> &map) override;
+		virtual bool WriteMat2ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::mat2> &map) override;
+		virtual bool WriteMat3ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::mat3> &map) override;
+		virtual bool WriteMat4ArrayMap(const HLString &key, const std::unordered_map<HLString, glm::mat4> &map) override;
+		virtual bool WriteQuaternionArrayMap(const HLString &key, const std::unordered_map<HLString, glm::quat> &map) override;
+
+		virtual bool HasKey(const HLString &key) const override;
+		virtual bool WriteOut() override;
+		virtual HLString GetContent(bool prettify = false) override;
+
+		/// <summary>
+		/// Accepts binary documents, for example the result of GetData() or the content of a file written by WriteOut().
+		/// </summary>
+		virtual void SetContent(const HLString &content) override;
+
+		/// <summary>
+		/// Returns the complete binary document, including the header.
+		/// </summary>
+		std::vector<Byte> GetData() const;
+
+	private:
+
+		template<typename EncodeFunc>
+		bool Write(const HLString &key, EncodeFunc &&encodeFunc);
+
+		bool CanWriteIntoRoot() const;
+		BinaryDocumentValue GetRoot() const;
+
+		FileSystemPath m_FilePath;
+
+		// The members of the root object, the object header is only added when the document is serialized
+		std::vector<Byte> m_RootMembers;
+		uint32 m_RootMemberCount = 0;
+
+		// Set by EndArray() without a key, the whole document is the array then
+		std::vector<Byte> m_RootArray;
+		bool m_RootIsArray = false;
+
+		std::vector<Byte> m_ArrayElements;
+		uint32 m_ArrayElementCount = 0;
+		bool m_ShouldWriteIntoArray = false;
+
+		std::vector<Byte> m_ObjectMembers;
+		uint32 m_ObjectMemberCount = 0;
+		bool m_ShouldWriteIntoObject = false;
+	};
+}
+
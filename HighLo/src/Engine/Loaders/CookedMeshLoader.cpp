@@ -0,0 +1,499 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "CookedMeshLoader.h"
+
+#include <fstream>
+
+#include "Engine/Core/FileSystem.h"
+
+#define COOKED_MESH_LOG_PREFIX "CookedMesh>   "
+
+namespace highlo
+{
+	static_assert(std::is_trivially_copyable<CookedMeshHeader>::value, "The cooked mesh header has to be trivially copyable");
+	static_assert(std::is_trivially_copyable<CookedSubmesh>::value, "Cooked submeshes have to be trivially copyable");
+	static_assert(std::is_trivially_copyable<CookedMaterial>::value, "Cooked materials have to be trivially copyable");
+	static_assert(std::is_trivially_copyable<CookedBone>::value, "Cooked bones have to be trivially copyable");
+	static_assert(std::is_trivially_copyable<Vertex>::value && std::is_trivially_copyable<AnimatedVertex>::value, "Vertices are written as raw memory");
+
+	namespace utils
+	{
+		static bool GetSourceStamp(const FileSystemPath &sourcePath, int64 &outWriteTime, int64 &outSize)
+		{
+			std::error_code error;
+			std::filesystem::path path(*sourcePath.Absolute());
+
+			auto writeTime = std::filesystem::last_write_time(path, error);
+			if (error)
+				return false;
+
+			uintmax_t size = std::filesystem::file_size(path, error);
+			if (error)
+				return false;
+
+			outWriteTime = (int64)writeTime.time_since_epoch().count();
+			outSize = (int64)size;
+			return true;
+		}
+
+		static bool IsSectionValid(uint64 fileSize, uint64 offset, uint64 count, uint64 stride)
+		{
+			if (offset % HL_COOKED_MESH_ALIGNMENT != 0 || offset > fileSize)
+				return false;
+
+			return count <= (fileSize - offset) / HL_MAX(stride, (uint64)1);
+		}
+
+		static bool IsStringValid(const CookedMeshHeader &header, uint32 offset)
+		{
+			return offset == HL_COOKED_MESH_NO_STRING || offset < header.StringTableSize;
+		}
+
+		/// <summary>
+		/// Collects the sections of a cooked file, every section starts at an aligned offset.
+		/// </summary>
+		class CookedMeshWriter
+		{
+		public:
+
+			uint64 Append(const void *data, uint64 size)
+			{
+				uint64 offset = (m_Buffer.size() + HL_COOKED_MESH_ALIGNMENT - 1) & ~((uint64)HL_COOKED_MESH_ALIGNMENT - 1);
+				m_Buffer.resize(offset + size);
+
+				if (size)
+					memcpy(m_Buffer.data() + offset, data, size);
+
+				return offset;
+			}
+
+			uint32 AddString(const HLString &str)
+			{
+				if (str.IsEmpty())
+					return HL_COOKED_MESH_NO_STRING;
+
+				uint32 offset = (uint32)m_Strings.size();
+				m_Strings.insert(m_Strings.end(), *str, *str + str.Length());
+				m_Strings.push_back('\0');
+				return offset;
+			}
+
+			std::vector<Byte> &GetBuffer() { return m_Buffer; }
+			const std::vector<char> &GetStrings() const { return m_Strings; }
+
+		private:
+
+			std::vector<Byte> m_Buffer;
+			std::vector<char> m_Strings;
+		};
+	}
+
+	void CookedMeshData::Release()
+	{
+		File.Close();
+		Header = nullptr;
+		Vertices = nullptr;
+		Indices = nullptr;
+		Submeshes = nullptr;
+		Materials = nullptr;
+		Bones = nullptr;
+		Strings = nullptr;
+	}
+
+	bool CookedMeshData::Read(const FileSystemPath &filePath, CookedMeshData &outData)
+	{
+		// The blobs are used right from the mapping, which is aligned to a page
+		if (!outData.File.Open(filePath))
+			return false;
+
+		const Byte *fileData = outData.File.GetData();
+		const uint64 fileSize = outData.File.GetSize();
+		if (fileSize < sizeof(CookedMeshHeader))
+		{
+			outData.Release();
+			return false;
+		}
+
+		const CookedMeshHeader *header = (const CookedMeshHeader*)fileData;
+		bool animated = header->Flags & (uint32)CookedMeshFlag::Animated;
+		uint32 expectedStride = animated ? sizeof(AnimatedVertex) : sizeof(Vertex);
+
+		bool valid = header->Magic == HL_COOKED_MESH_MAGIC
+			&& header->Version == HL_COOKED_MESH_VERSION
+			&& header->VertexStride == expectedStride
+			&& utils::IsSectionValid(fileSize, header->VertexOffset, header->VertexCount, header->VertexStride)
+			&& utils::IsSectionValid(fileSize, header->IndexOffset, header->TriangleCount, sizeof(VertexIndex))
+			&& utils::IsSectionValid(fileSize, header->SubmeshOffset, header->SubmeshCount, sizeof(CookedSubmesh))
+			&& utils::IsSectionValid(fileSize, header->MaterialOffset, header->MaterialCount, sizeof(CookedMaterial))
+			&& utils::IsSectionValid(fileSize, header->BoneOffset, header->BoneCount, sizeof(CookedBone))
+			&& utils::IsSectionValid(fileSize, header->StringOffset, header->StringTableSize, 1);
+
+		// Strings are stored null-terminated, so the table has to end with a terminator
+		if (valid && header->StringTableSize > 0)
+			valid = fileData[header->StringOffset + header->StringTableSize - 1] == '\0';
+
+		if (!valid)
+		{
+			HL_CORE_ERROR(COOKED_MESH_LOG_PREFIX "[-] {0} is not a valid cooked mesh [-]", *filePath.String());
+			outData.Release();
+			return false;
+		}
+
+		outData.Header = header;
+		outData.Vertices = fileData + header->VertexOffset;
+		outData.Indices = (const VertexIndex*)(fileData + header->IndexOffset);
+		outData.Submeshes = (const CookedSubmesh*)(fileData + header->SubmeshOffset);
+		outData.Materials = (const CookedMaterial*)(fileData + header->MaterialOffset);
+		outData.Bones = (const CookedBone*)(fileData + header->BoneOffset);
+		outData.Strings = (const char*)(fileData + header->StringOffset);
+
+		// A corrupt or stale file must not let the triangle cache or the GPU read outside of the vertex buffer
+		for (uint32 i = 0; i < header->TriangleCount && valid; ++i)
+		{
+			const VertexIndex &index = outData.Indices[i];
+			valid = index.P1 < header->VertexCount && index.P2 < header->VertexCount && index.P3 < header->VertexCount;
+		}
+
+		for (uint32 i = 0; i < header->SubmeshCount && valid; ++i)
+		{
+			const CookedSubmesh &submesh = outData.Submeshes[i];
+			valid = submesh.BaseIndex % 3 == 0
+				&& submesh.IndexCount % 3 == 0
+				&& (uint64)submesh.BaseVertex + submesh.VertexCount <= header->VertexCount
+				&& (uint64)submesh.BaseIndex / 3 + submesh.IndexCount / 3 <= header->TriangleCount
+				&& (header->MaterialCount == 0 || submesh.MaterialIndex < header->MaterialCount)
+				&& utils::IsStringValid(*header, submesh.NodeName)
+				&& utils::IsStringValid(*header, submesh.MeshName);
+
+			// The indices of a submesh are relative to its base vertex
+			const VertexIndex *indices = outData.Indices + submesh.BaseIndex / 3;
+			for (uint32 j = 0; j < submesh.IndexCount / 3 && valid; ++j)
+				valid = indices[j].P1 < submesh.VertexCount && indices[j].P2 < submesh.VertexCount && indices[j].P3 < submesh.VertexCount;
+		}
+
+		for (uint32 i = 0; i < header->MaterialCount && valid; ++i)
+		{
+			const CookedMaterial &material = outData.Materials[i];
+			valid = utils::IsStringValid(*header, material.Name)
+				&& utils::IsStringValid(*header, material.DiffuseMap)
+				&& utils::IsStringValid(*header, material.NormalMap)
+				&& utils::IsStringValid(*header, material.RoughnessMap)
+				&& utils::IsStringValid(*header, material.MetalnessMap);
+		}
+
+		for (uint32 i = 0; i < header->BoneCount && valid; ++i)
+			valid = utils::IsStringValid(*header, outData.Bones[i].Name);
+
+		if (!valid)
+		{
+			HL_CORE_ERROR(COOKED_MESH_LOG_PREFIX "[-] {0} contains invalid indices, submeshes, materials or bones [-]", *filePath.String());
+			outData.Release();
+			return false;
+		}
+
+		return true;
+	}
+
+	CookedMeshLoader::CookedMeshLoader(const FileSystemPath &filePath, const FileSystemPath &sourcePath)
+		: m_FilePath(sourcePath.String().IsEmpty() ? filePath : sourcePath)
+	{
+		CookedMeshData data;
+		if (!CookedMeshData::Read(filePath, data))
+			return;
+
+		const CookedMeshHeader &header = *data.Header;
+		m_IsAnimated = data.IsAnimated();
+		m_InverseTransform = header.InverseTransform;
+		m_TicksPerSecond = header.TicksPerSecond;
+		m_AnimationDuration = header.AnimationDuration;
+		m_BoundingBox = AABB(header.BoundsMin, header.BoundsMax);
+
+		if (m_IsAnimated)
+		{
+			const AnimatedVertex *vertices = (const AnimatedVertex*)data.Vertices;
+			m_AnimatedVertices.assign(vertices, vertices + header.VertexCount);
+			m_Layout = BufferLayout::GetAnimatedShaderLayout();
+		}
+		else
+		{
+			const Vertex *vertices = (const Vertex*)data.Vertices;
+			m_StaticVertices.assign(vertices, vertices + header.VertexCount);
+			m_Layout = BufferLayout::GetStaticShaderLayout();
+		}
+
+		m_Indices.assign(data.Indices, data.Indices + header.TriangleCount);
+
+		m_Submeshes.reserve(header.SubmeshCount);
+		for (uint32 i = 0; i < header.SubmeshCount; ++i)
+		{
+			const CookedSubmesh &cookedSubmesh = data.Submeshes[i];
+
+			Mesh &submesh = m_Submeshes.emplace_back();
+			submesh.BaseVertex = cookedSubmesh.BaseVertex;
+			submesh.BaseIndex = cookedSubmesh.BaseIndex;
+			submesh.MaterialIndex = cookedSubmesh.MaterialIndex;
+			submesh.IndexCount = cookedSubmesh.IndexCount;
+			submesh.VertexCount = cookedSubmesh.VertexCount;
+			submesh.BoundingBox = AABB(glm::vec3(cookedSubmesh.BoundsMin), glm::vec3(cookedSubmesh.BoundsMax));
+			submesh.WorldTransform.SetTransform(cookedSubmesh.WorldTransform);
+			submesh.LocalTransform.SetTransform(cookedSubmesh.LocalTransform);
+			submesh.NodeName = data.GetString(cookedSubmesh.NodeName);
+			submesh.MeshName = data.GetString(cookedSubmesh.MeshName);
+		}
+
+		m_BoneInfos.resize(header.BoneCount);
+		m_BoneTransforms.resize(header.BoneCount, glm::mat4(1.0f));
+		for (uint32 i = 0; i < header.BoneCount; ++i)
+		{
+			m_BoneInfos[i].BoneOffset.SetTransform(data.Bones[i].Offset);
+			m_BoneInfos[i].BoneTransform.SetTransform(glm::mat4(1.0f));
+			m_BoneMapping[data.GetString(data.Bones[i].Name)] = i;
+		}
+
+		ReadMaterials(data);
+
+		if (!m_IsAnimated)
+			BuildTriangleCache();
+
+		data.Release();
+		m_Valid = true;
+		HL_CORE_INFO(COOKED_MESH_LOG_PREFIX "[+] Loaded {0} [+]", *filePath.String());
+	}
+
+	void CookedMeshLoader::CreateResources(const Ref<Shader> &shader)
+	{
+		if (!m_Valid || m_VertexBuffer)
+			return;
+
+		// The vertices are already in the layout of the vertex buffer
+		if (m_IsAnimated)
+			m_VertexBuffer = VertexBuffer::Create(m_AnimatedVertices.data(), (uint32)(m_AnimatedVertices.size() * sizeof(AnimatedVertex)));
+		else
+			m_VertexBuffer = VertexBuffer::Create(m_StaticVertices.data(), (uint32)(m_StaticVertices.size() * sizeof(Vertex)));
+
+		m_IndexBuffer = IndexBuffer::Create(m_Indices.data(), (uint32)(m_Indices.size() * sizeof(VertexIndex)));
+		m_MaterialTextures.CreateMaterials(shader, m_MaterialDescriptions, m_Materials, m_Textures, m_NormalMaps);
+	}
+
+	CookedMeshLoader::~CookedMeshLoader()
+	{
+	}
+
+	void CookedMeshLoader::ManipulateBoneTransform(float time, std::vector<glm::mat4> &outTransforms)
+	{
+		outTransforms = m_BoneTransforms;
+	}
+
+	FileSystemPath CookedMeshLoader::GetCookedPath(const FileSystemPath &sourcePath)
+	{
+		return FileSystemPath(sourcePath.String() + HL_COOKED_MESH_EXTENSION);
+	}
+
+	bool CookedMeshLoader::GetCacheKey(const FileSystemPath &sourcePath, DerivedDataKey &outKey)
+	{
+		DerivedDataCache *cache = DerivedDataCache::Get();
+		if (!cache->IsEnabled() || !cache->HashSourceFile(sourcePath, outKey.SourceHash))
+			return false;
+
+		HLString sourceDirectory = sourcePath.ParentPath().Absolute();
+		outKey.Importer = "CookedMesh";
+		outKey.ImporterVersion = HL_COOKED_MESH_VERSION;
+		outKey.SettingsHash = DerivedDataCache::HashSettings(*sourceDirectory, sourceDirectory.Length());
+		return true;
+	}
+
+	bool CookedMeshLoader::ReadHeader(const FileSystemPath &cookedPath, CookedMeshHeader &outHeader)
+	{
+		std::ifstream in(*cookedPath.Absolute(), std::ios::in | std::ios::binary);
+		if (!in)
+			return false;
+
+		if (!in.read((char*)&outHeader, sizeof(CookedMeshHeader)))
+			return false;
+
+		return outHeader.Magic == HL_COOKED_MESH_MAGIC && outHeader.Version == HL_COOKED_MESH_VERSION;
+	}
+
+	bool CookedMeshLoader::IsUpToDate(const FileSystemPath &sourcePath, const FileSystemPath &cookedPath, CookedMeshHeader *outHeader)
+	{
+		CookedMeshHeader header;
+		if (!ReadHeader(cookedPath, header))
+			return false;
+
+		int64 writeTime, size;
+		if (!utils::GetSourceStamp(sourcePath, writeTime, size))
+			return false;
+
+		if (outHeader)
+			*outHeader = header;
+
+		return header.SourceWriteTime == writeTime && header.SourceSize == size;
+	}
+
+	bool CookedMeshLoader::Cook(const Ref<MeshLoader> &source, const FileSystemPath &sourcePath, const FileSystemPath &cookedPath)
+	{
+		CookedMeshHeader header;
+		if (!utils::GetSourceStamp(sourcePath, header.SourceWriteTime, header.SourceSize))
+			return false;
+
+		utils::CookedMeshWriter writer;
+		writer.Append(&header, sizeof(CookedMeshHeader));
+
+		const AABB &bounds = source->GetBoundingBox();
+		header.BoundsMin = bounds.Min;
+		header.BoundsMax = bounds.Max;
+		header.InverseTransform = source->GetInverseTransform();
+		header.TicksPerSecond = source->GetTicksPerSecond();
+		header.AnimationDuration = source->GetAnimationDuration();
+
+		if (source->IsAnimated())
+		{
+			const std::vector<AnimatedVertex> &vertices = source->GetAnimatedVertices();
+			header.Flags |= (uint32)CookedMeshFlag::Animated;
+			header.VertexStride = sizeof(AnimatedVertex);
+			header.VertexCount = (uint32)vertices.size();
+			header.VertexOffset = writer.Append(vertices.data(), vertices.size() * sizeof(AnimatedVertex));
+		}
+		else
+		{
+			const std::vector<Vertex> &vertices = source->GetStaticVertices();
+			header.VertexStride = sizeof(Vertex);
+			header.VertexCount = (uint32)vertices.size();
+			header.VertexOffset = writer.Append(vertices.data(), vertices.size() * sizeof(Vertex));
+		}
+
+		const std::vector<VertexIndex> &indices = source->GetIndices();
+		header.TriangleCount = (uint32)indices.size();
+		header.IndexOffset = writer.Append(indices.data(), indices.size() * sizeof(VertexIndex));
+
+		const std::vector<Mesh> &submeshes = source->GetSubmeshes();
+		std::vector<CookedSubmesh> cookedSubmeshes(submeshes.size());
+		for (uint32 i = 0; i < submeshes.size(); ++i)
+		{
+			const Mesh &submesh = submeshes[i];
+			CookedSubmesh &cookedSubmesh = cookedSubmeshes[i];
+			cookedSubmesh.BaseVertex = submesh.BaseVertex;
+			cookedSubmesh.BaseIndex = submesh.BaseIndex;
+			cookedSubmesh.MaterialIndex = submesh.MaterialIndex;
+			cookedSubmesh.IndexCount = submesh.IndexCount;
+			cookedSubmesh.VertexCount = submesh.VertexCount;
+			cookedSubmesh.NodeName = writer.AddString(submesh.NodeName);
+			cookedSubmesh.MeshName = writer.AddString(submesh.MeshName);
+			cookedSubmesh.BoundsMin = glm::vec4(submesh.BoundingBox.Min, 0.0f);
+			cookedSubmesh.BoundsMax = glm::vec4(submesh.BoundingBox.Max, 0.0f);
+			cookedSubmesh.WorldTransform = submesh.WorldTransform.GetTransform();
+			cookedSubmesh.LocalTransform = submesh.LocalTransform.GetTransform();
+		}
+
+		header.SubmeshCount = (uint32)cookedSubmeshes.size();
+		header.SubmeshOffset = writer.Append(cookedSubmeshes.data(), cookedSubmeshes.size() * sizeof(CookedSubmesh));
+
+		const std::vector<MeshMaterialDescription> &materials = source->GetMaterialDescriptions();
+		std::vector<CookedMaterial> cookedMaterials(materials.size());
+		for (uint32 i = 0; i < materials.size(); ++i)
+		{
+			const MeshMaterialDescription &material = materials[i];
+			CookedMaterial &cookedMaterial = cookedMaterials[i];
+			cookedMaterial.Name = writer.AddString(material.Name);
+			cookedMaterial.DiffuseMap = writer.AddString(material.DiffuseMap);
+			cookedMaterial.NormalMap = writer.AddString(material.NormalMap);
+			cookedMaterial.RoughnessMap = writer.AddString(material.RoughnessMap);
+			cookedMaterial.MetalnessMap = writer.AddString(material.MetalnessMap);
+			cookedMaterial.DiffuseColor = material.DiffuseColor;
+			cookedMaterial.Emission = material.Emission;
+			cookedMaterial.Roughness = material.Roughness;
+			cookedMaterial.Metalness = material.Metalness;
+		}
+
+		header.MaterialCount = (uint32)cookedMaterials.size();
+		header.MaterialOffset = writer.Append(cookedMaterials.data(), cookedMaterials.size() * sizeof(CookedMaterial));
+
+		const std::vector<BoneInfo> &boneInfos = source->GetBoneInfos();
+		std::vector<CookedBone> cookedBones(boneInfos.size());
+		for (uint32 i = 0; i < boneInfos.size(); ++i)
+			cookedBones[i].Offset = boneInfos[i].BoneOffset.GetTransform();
+
+		for (const auto &[name, index] : source->GetBoneMappings())
+		{
+			if (index < cookedBones.size())
+				cookedBones[index].Name = writer.AddString(name);
+		}
+
+		header.BoneCount = (uint32)cookedBones.size();
+		header.BoneOffset = writer.Append(cookedBones.data(), cookedBones.size() * sizeof(CookedBone));
+
+		// The string table is written last, because all sections above add their strings to it
+		const std::vector<char> &strings = writer.GetStrings();
+		header.StringTableSize = (uint32)strings.size();
+		header.StringOffset = writer.Append(strings.data(), strings.size());
+
+		std::vector<Byte> &buffer = writer.GetBuffer();
+		memcpy(buffer.data(), &header, sizeof(CookedMeshHeader));
+
+		// WriteFile does not overwrite existing files, so an outdated cook has to be removed first
+		if (FileSystem::Get()->FileExists(cookedPath))
+			FileSystem::Get()->RemoveFile(cookedPath);
+
+		if (!FileSystem::Get()->WriteFile(cookedPath, buffer.data(), (int64)buffer.size()))
+		{
+			HL_CORE_ERROR(COOKED_MESH_LOG_PREFIX "[-] Failed to write cooked mesh {0} [-]", *cookedPath.String());
+			return false;
+		}
+
+		HL_CORE_INFO(COOKED_MESH_LOG_PREFIX "[+] Cooked {0} [+]", *sourcePath.String());
+		return true;
+	}
+
+	FileSystemPath CookedMeshLoader::GetTexturePath(const FileSystemPath &sourcePath, const HLString &texturePath)
+	{
+		return sourcePath.ParentPath() / texturePath;
+	}
+
+	void CookedMeshLoader::ReadMaterials(const CookedMeshData &data)
+	{
+		const CookedMeshHeader &header = *data.Header;
+		m_MaterialDescriptions.resize(header.MaterialCount);
+
+		for (uint32 i = 0; i < header.MaterialCount; ++i)
+		{
+			const CookedMaterial &cookedMaterial = data.Materials[i];
+
+			MeshMaterialDescription &description = m_MaterialDescriptions[i];
+			description.Name = data.GetString(cookedMaterial.Name);
+			description.DiffuseColor = cookedMaterial.DiffuseColor;
+			description.Emission = cookedMaterial.Emission;
+			description.Roughness = cookedMaterial.Roughness;
+			description.Metalness = cookedMaterial.Metalness;
+			description.DiffuseMap = data.GetString(cookedMaterial.DiffuseMap);
+			description.NormalMap = data.GetString(cookedMaterial.NormalMap);
+			description.RoughnessMap = data.GetString(cookedMaterial.RoughnessMap);
+			description.MetalnessMap = data.GetString(cookedMaterial.MetalnessMap);
+
+			// Maps that can't be decoded fall back to the white texture, when the materials are created
+			m_MaterialTextures.Decode(m_FilePath, description.DiffuseMap);
+			m_MaterialTextures.Decode(m_FilePath, description.NormalMap);
+			m_MaterialTextures.Decode(m_FilePath, description.RoughnessMap);
+			m_MaterialTextures.Decode(m_FilePath, description.MetalnessMap);
+		}
+	}
+
+	void CookedMeshLoader::BuildTriangleCache()
+	{
+		for (uint32 i = 0; i < m_Submeshes.size(); ++i)
+		{
+			const Mesh &submesh = m_Submeshes[i];
+			std::vector<Triangle> &triangles = m_TriangleCache[i];
+			triangles.reserve(submesh.IndexCount / 3);
+
+			for (uint32 j = 0; j < submesh.IndexCount / 3; ++j)
+			{
+				const VertexIndex &index = m_Indices[submesh.BaseIndex / 3 + j];
+				triangles.emplace_back(m_StaticVertices[index.P1 + submesh.BaseVertex],
+									   m_StaticVertices[index.P2 + submesh.BaseVertex],
+									   m_StaticVertices[index.P3 + submesh.BaseVertex]);
+			}
+		}
+	}
+}
+
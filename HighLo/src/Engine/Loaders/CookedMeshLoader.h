@@ -0,0 +1,257 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.5 (2026-10-19) The cooked file is decoded without a shader, the GPU resources are created by CreateResources()
+//     - 1.4 (2026-10-19) Validated the indices and submesh ranges, animated meshes are not cooked anymore
+//     - 1.3 (2026-10-19) Textures are resolved relative to the source mesh and the cache key contains the directory of the source
+//     - 1.2 (2026-10-19) The cooked file is mapped instead of read into a buffer
+//     - 1.1 (2026-10-19) Added ReadHeader, the cooked files are stored in the DerivedDataCache
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "MeshLoader.h"
+#include "Engine/Core/MappedFile.h"
+#include "Engine/Assets/DerivedDataCache.h"
+
+#define HL_COOKED_MESH_MAGIC 0x534D4C48 // "HLMS"
+#define HL_COOKED_MESH_VERSION 1
+#define HL_COOKED_MESH_EXTENSION ".hlmesh"
+#define HL_COOKED_MESH_ALIGNMENT 16
+#define HL_COOKED_MESH_NO_STRING 0xFFFFFFFF
+
+namespace highlo
+{
+	enum class CookedMeshFlag : uint32
+	{
+		None = 0,
+		Animated = HL_BIT(0)	/**< The vertices are AnimatedVertex instead of Vertex and the source contains animations. */
+	};
+
+	/// <summary>
+	/// The header at the beginning of a cooked mesh file.
+	/// All offsets are relative to the beginning of the file and aligned to HL_COOKED_MESH_ALIGNMENT,
+	/// so that the blobs can be used right from a buffer or a mapped view of the file.
+	/// </summary>
+	struct CookedMeshHeader
+	{
+		uint32 Magic = HL_COOKED_MESH_MAGIC;
+		uint32 Version = HL_COOKED_MESH_VERSION;
+		uint32 Flags = (uint32)CookedMeshFlag::None;
+		uint32 VertexStride = 0;
+
+		// Used to detect that the source file has changed since it has been cooked
+		int64 SourceWriteTime = 0;
+		int64 SourceSize = 0;
+
+		uint32 VertexCount = 0;
+		uint32 TriangleCount = 0;
+		uint32 SubmeshCount = 0;
+		uint32 MaterialCount = 0;
+		uint32 BoneCount = 0;
+		uint32 StringTableSize = 0;
+
+		uint64 VertexOffset = 0;
+		uint64 IndexOffset = 0;
+		uint64 SubmeshOffset = 0;
+		uint64 MaterialOffset = 0;
+		uint64 BoneOffset = 0;
+		uint64 StringOffset = 0;
+
+		glm::vec3 BoundsMin = glm::vec3(0.0f);
+		float TicksPerSecond = 0.0f;
+		glm::vec3 BoundsMax = glm::vec3(0.0f);
+		float AnimationDuration = 0.0f;
+		glm::mat4 InverseTransform = glm::mat4(1.0f);
+	};
+
+	struct CookedSubmesh
+	{
+		uint32 BaseVertex = 0;
+		uint32 BaseIndex = 0;
+		uint32 MaterialIndex = 0;
+		uint32 IndexCount = 0;
+		uint32 VertexCount = 0;
+		uint32 NodeName = HL_COOKED_MESH_NO_STRING;
+		uint32 MeshName = HL_COOKED_MESH_NO_STRING;
+		uint32 Padding = 0;
+
+		glm::vec4 BoundsMin = glm::vec4(0.0f);
+		glm::vec4 BoundsMax = glm::vec4(0.0f);
+		glm::mat4 WorldTransform = glm::mat4(1.0f);
+		glm::mat4 LocalTransform = glm::mat4(1.0f);
+	};
+
+	struct CookedMaterial
+	{
+		uint32 Name = HL_COOKED_MESH_NO_STRING;
+		uint32 DiffuseMap = HL_COOKED_MESH_NO_STRING;
+		uint32 NormalMap = HL_COOKED_MESH_NO_STRING;
+		uint32 RoughnessMap = HL_COOKED_MESH_NO_STRING;
+		uint32 MetalnessMap = HL_COOKED_MESH_NO_STRING;
+
+		glm::vec3 DiffuseColor = glm::vec3(0.8f);
+		float Emission = 0.0f;
+		float Roughness = 0.8f;
+		float Metalness = 0.0f;
+	};
+
+	struct CookedBone
+	{
+		uint32 Name = HL_COOKED_MESH_NO_STRING;
+		uint32 Padding[3] = { 0, 0, 0 };
+		glm::mat4 Offset = glm::mat4(1.0f);
+	};
+
+	/// <summary>
+	/// A validated view into the content of a cooked mesh file, the pointers point into the owned mapping of the file.
+	/// </summary>
+	struct CookedMeshData
+	{
+		MappedFile File;
+
+		const CookedMeshHeader *Header = nullptr;
+		const Byte *Vertices = nullptr;
+		const VertexIndex *Indices = nullptr;
+		const CookedSubmesh *Submeshes = nullptr;
+		const CookedMaterial *Materials = nullptr;
+		const CookedBone *Bones = nullptr;
+		const char *Strings = nullptr;
+
+		HLAPI bool IsAnimated() const { return Header->Flags & (uint32)CookedMeshFlag::Animated; }
+		HLAPI HLString GetString(uint32 offset) const { return offset == HL_COOKED_MESH_NO_STRING ? HLString() : HLString(Strings + offset); }
+
+		HLAPI void Release();
+
+		/// <summary>
+		/// Reads the cooked file and checks that all sections lie inside of the file and that every index and submesh stays inside of the vertex and index buffers.
+		/// </summary>
+		HLAPI static bool Read(const FileSystemPath &filePath, CookedMeshData &outData);
+	};
+
+	/// <summary>
+	/// Loads meshes from the engine's cooked binary format, that has been written from an imported mesh by Cook().
+	/// </summary>
+	class CookedMeshLoader : public MeshLoader
+	{
+	public:
+
+		/// <summary>
+		/// Reads the cooked file and decodes its textures. The textures are resolved relative to the source mesh, because the cooked file might be an entry of the DerivedDataCache.
+		/// Without a source path, the cooked file is expected next to its textures.
+		/// </summary>
+		HLAPI CookedMeshLoader(const FileSystemPath &filePath, const FileSystemPath &sourcePath = FileSystemPath());
+		HLAPI virtual ~CookedMeshLoader();
+
+		HLAPI bool IsValid() const { return m_Valid; }
+
+		// Draw data
+		HLAPI virtual const Ref<VertexBuffer> &GetVertexBuffer() const override { return m_VertexBuffer; }
+		HLAPI virtual const Ref<IndexBuffer> &GetIndexBuffer() const override { return m_IndexBuffer; }
+		HLAPI virtual const BufferLayout &GetLayout() const override { return m_Layout; }
+
+		// Materials
+		HLAPI virtual const std::vector<Ref<Material>> &GetMaterials() const override { return m_Materials; }
+		HLAPI virtual const std::vector<Ref<Texture2D>> &GetTextures() const override { return m_Textures; }
+		HLAPI virtual const std::vector<Ref<Texture2D>> &GetNormalMaps() const override { return m_NormalMaps; }
+		HLAPI virtual const std::vector<MeshMaterialDescription> &GetMaterialDescriptions() const override { return m_MaterialDescriptions; }
+
+		// Anim
+		HLAPI virtual const glm::mat4 &GetInverseTransform() const override { return m_InverseTransform; }
+		HLAPI virtual const std::vector<glm::mat4> &GetBoneTransforms() const override { return m_BoneTransforms; }
+		HLAPI virtual const std::unordered_map<uint32, std::vector<Triangle>> &GetTriangleCache() const override { return m_TriangleCache; }
+		HLAPI virtual const std::vector<Mesh> &GetSubmeshes() const override { return m_Submeshes; }
+
+		HLAPI virtual uint32 GetBoneCount() const override { return (uint32)m_BoneInfos.size(); }
+		HLAPI virtual const std::unordered_map<HLString, uint32> &GetBoneMappings() const override { return m_BoneMapping; }
+		HLAPI virtual const std::vector<BoneInfo> &GetBoneInfos() const override { return m_BoneInfos; }
+		HLAPI virtual bool IsAnimated() const override { return m_IsAnimated; }
+		HLAPI virtual const FileSystemPath &GetFilePath() const override { return m_FilePath; }
+		HLAPI virtual const AABB &GetBoundingBox() const override { return m_BoundingBox; }
+
+		HLAPI virtual const std::vector<Vertex> &GetStaticVertices() const override { return m_StaticVertices; }
+		HLAPI virtual const std::vector<AnimatedVertex> &GetAnimatedVertices() const override { return m_AnimatedVertices; }
+		HLAPI virtual const std::vector<VertexIndex> &GetIndices() const override { return m_Indices; }
+
+		HLAPI virtual float GetTicksPerSecond() const override { return m_TicksPerSecond; }
+		HLAPI virtual float GetAnimationDuration() const override { return m_AnimationDuration; }
+
+		/// <summary>
+		/// The cooked format only stores the skeleton, so the bones always stay in their bind pose.
+		/// </summary>
+		HLAPI virtual void ManipulateBoneTransform(float time, std::vector<glm::mat4> &outTransforms) override;
+
+		HLAPI virtual void CreateResources(const Ref<Shader> &shader) override;
+
+		/// <summary>
+		/// Returns the path of the cooked file that belongs to the given source file.
+		/// It is only used, if the DerivedDataCache is disabled, otherwise the cooked file is an entry of the cache.
+		/// </summary>
+		HLAPI static FileSystemPath GetCookedPath(const FileSystemPath &sourcePath);
+
+		/// <summary>
+		/// Returns the key of the cooked file in the DerivedDataCache, it fails if the cache is disabled or the source can't be read.
+		/// The importer only keeps the textures, that exist next to the source, so copies of a mesh in different directories get different keys.
+		/// </summary>
+		HLAPI static bool GetCacheKey(const FileSystemPath &sourcePath, DerivedDataKey &outKey);
+
+		/// <summary>
+		/// Reads the header of the cooked file and returns true, if it has been written by the current version of the cooker.
+		/// </summary>
+		HLAPI static bool ReadHeader(const FileSystemPath &cookedPath, CookedMeshHeader &outHeader);
+
+		/// <summary>
+		/// Returns true, if the cooked file exists, has been written by the current version of the cooker and the source file has not changed since.
+		/// Only the header of the cooked file is read, it is returned in outHeader if requested.
+		/// </summary>
+		HLAPI static bool IsUpToDate(const FileSystemPath &sourcePath, const FileSystemPath &cookedPath, CookedMeshHeader *outHeader = nullptr);
+
+		/// <summary>
+		/// Writes the data of an imported mesh into the cooked format.
+		/// </summary>
+		HLAPI static bool Cook(const Ref<MeshLoader> &source, const FileSystemPath &sourcePath, const FileSystemPath &cookedPath);
+
+		/// <summary>
+		/// Returns the path of a texture, that is referenced by a cooked material. The path is stored relative to the source mesh, just like in the source.
+		/// </summary>
+		HLAPI static FileSystemPath GetTexturePath(const FileSystemPath &sourcePath, const HLString &texturePath);
+
+	private:
+
+		void ReadMaterials(const CookedMeshData &data);
+		void BuildTriangleCache();
+
+		bool m_Valid = false;
+		FileSystemPath m_FilePath;		/**< The source mesh, or the cooked file if it has been loaded without a source. */
+
+		Ref<VertexBuffer> m_VertexBuffer;
+		Ref<IndexBuffer> m_IndexBuffer;
+		BufferLayout m_Layout;
+
+		std::vector<Vertex> m_StaticVertices;
+		std::vector<AnimatedVertex> m_AnimatedVertices;
+		std::vector<VertexIndex> m_Indices;
+		std::vector<Mesh> m_Submeshes;
+		std::unordered_map<uint32, std::vector<Triangle>> m_TriangleCache;
+		glm::mat4 m_InverseTransform = glm::mat4(1.0f);
+		AABB m_BoundingBox;
+
+		// Materials
+		std::vector<Ref<Material>> m_Materials;
+		std::vector<Ref<Texture2D>> m_Textures;
+		std::vector<Ref<Texture2D>> m_NormalMaps;
+		std::vector<MeshMaterialDescription> m_MaterialDescriptions;
+		MeshMaterialTextures m_MaterialTextures;
+
+		// Anim
+		std::unordered_map<HLString, uint32> m_BoneMapping;
+		std::vector<BoneInfo> m_BoneInfos;
+		std::vector<glm::mat4> m_BoneTransforms;
+		bool m_IsAnimated = false;
+		float m_AnimationDuration = 0.0f;
+		float m_TicksPerSecond = 0.0f;
+	};
+}
+
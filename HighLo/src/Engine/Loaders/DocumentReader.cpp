@@ -6,6 +6,9 @@
 #include "Engine/ThirdParty/RapidJSON/JsonReader.h"
 #include "Engine/ThirdParty/RapidXML/XMLReader.h"
 #include "Engine/ThirdParty/YamlCPP/YamlReader.h"
+#include "BinaryDocumentReader.h"
+
+#define DOCUMENT_READER_LOG_PREFIX "DocReader>    "
 
 namespace highlo
 {
@@ -21,10 +24,19 @@ namespace highlo
 
 			case DocumentType::Yaml:
 				return Ref<YamlReader>::Create(filePath);
+
+			case DocumentType::Binary:
+				return Ref<BinaryDocumentReader>::Create(filePath);
 		}
 
 		// Use default parser
 		return Ref<JsonReader>::Create(filePath);
 	}
+
+	bool DocumentReader::ReadStream(DocumentStreamHandler &handler, const FileSystemPath &filePath)
+	{
+		HL_CORE_ERROR(DOCUMENT_READER_LOG_PREFIX "[-] Error: Streaming is not supported by this document type [-]");
+		return false;
+	}
 }
 
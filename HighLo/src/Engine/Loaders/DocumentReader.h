@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added streaming reads
 //     - 1.0 (2022-03-03) initial release
 //
 
@@ -12,6 +13,30 @@
 
 namespace highlo
 {
+	/// <summary>
+	/// Receives the values of a document in the order in which they appear in the file while it is parsed, without building the document in memory.
+	/// Strings are only valid during the call. Returning false stops the parsing.
+	/// </summary>
+	class DocumentStreamHandler
+	{
+	public:
+
+		HLAPI virtual ~DocumentStreamHandler() = default;
+
+		HLAPI virtual bool OnNull() { return true; }
+		HLAPI virtual bool OnBool(bool value) { return true; }
+		HLAPI virtual bool OnInt64(int64 value) { return true; }
+		HLAPI virtual bool OnUInt64(uint64 value) { return true; }	/**< Called for all non-negative integers. */
+		HLAPI virtual bool OnDouble(double value) { return true; }
+		HLAPI virtual bool OnString(const char *str, uint32 length) { return true; }
+
+		HLAPI virtual bool OnKey(const char *key, uint32 length) { return true; }
+		HLAPI virtual bool OnBeginObject() { return true; }
+		HLAPI virtual bool OnEndObject(uint32 memberCount) { return true; }
+		HLAPI virtual bool OnBeginArray() { return true; }
+		HLAPI virtual bool OnEndArray(uint32 elementCount) { return true; }
+	};
+
 	class DocumentReader : public IsSharedReference
 	{
 	public:
@@ -87,6 +112,14 @@ namespace highlo
 		HLAPI virtual HLString GetContent(bool prettify = false) = 0;
 		HLAPI virtual void SetContent(const HLString &content) = 0;
 
+		/// <summary>
+		/// Parses the file and hands every value to the handler right away. Only a small window of the file is in memory,
+		/// which makes it the preferred way to read large files, that are only traversed once.
+		/// The content of the reader is not changed.
+		/// </summary>
+		/// <returns>Returns false, if the file could not be parsed, the handler stopped the parsing or the format does not support streaming.</returns>
+		HLAPI virtual bool ReadStream(DocumentStreamHandler &handler, const FileSystemPath &filePath = "");
+
 		HLAPI static Ref<DocumentReader> Create(const FileSystemPath &filePath, DocumentType type = DocumentType::None);
 	};
 }
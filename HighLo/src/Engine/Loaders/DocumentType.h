@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added the binary document type
 //     - 1.0 (2022-01-10) initial release
 //
 
@@ -14,7 +15,8 @@ namespace highlo
 		None = 0,
 		Json,
 		XML,
-		Yaml
+		Yaml,
+		Binary
 	};
 
 	enum class DocumentDataType
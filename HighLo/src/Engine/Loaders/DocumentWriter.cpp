@@ -6,6 +6,7 @@
 #include "Engine/ThirdParty/RapidJSON/JsonWriter.h"
 #include "Engine/ThirdParty/RapidXML/XMLWriter.h"
 #include "Engine/ThirdParty/YamlCPP/YamlWriter.h"
+#include "BinaryDocumentWriter.h"
 
 namespace highlo
 {
@@ -21,6 +22,9 @@ namespace highlo
 
 			case DocumentType::Yaml:
 				return Ref<YamlWriter>::Create(filePath);
+
+			case DocumentType::Binary:
+				return Ref<BinaryDocumentWriter>::Create(filePath);
 		}
 
 		// Use default parser
@@ -9,7 +9,7 @@
  * Usage:
  *
  * // *Write into file examples*
- * Ref<DocumentWriter> writer = DocumentWriter::Create("test.json", DocumentType::Json); // valid options for DocumentType are: Json, Yaml, XML
+ * Ref<DocumentWriter> writer = DocumentWriter::Create("test.json", DocumentType::Json); // valid options for DocumentType are: Json, Yaml, XML, Binary
  *
  * // Write an array into file
  * std::vector<uint32> arr;
@@ -130,7 +130,7 @@
 namespace highlo
 {
 	/// <summary>
-	/// This class is used as an interface to write/read JSON, XML and YAML files
+	/// This class is used as an interface to write/read JSON, XML, YAML and binary files
 	/// </summary>
 	class DocumentWriter : public IsSharedReference
 	{
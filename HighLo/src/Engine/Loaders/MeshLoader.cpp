@@ -10,12 +10,174 @@
 #include "Engine/ThirdParty/Assimp/AssimpMeshLoader.h"
 #endif // HIGHLO_API_ASSIMP_LOADER
 
+#include "CookedMeshLoader.h"
+#include "TextureLoader.h"
+
+#include "Engine/Renderer/Renderer.h"
+
+#define MESH_LOADER_LOG_PREFIX "MeshLoader>   "
+
 namespace highlo
 {
+	MeshMaterialTextures::~MeshMaterialTextures()
+	{
+		Release();
+	}
+
+	bool MeshMaterialTextures::Decode(const FileSystemPath &meshPath, const HLString &texturePath)
+	{
+		if (texturePath.IsEmpty())
+			return false;
+
+		// Several materials can share the same map
+		if (m_Textures.find(texturePath) != m_Textures.end())
+			return true;
+
+		FileSystemPath path = meshPath.ParentPath() / texturePath;
+		HL_CORE_TRACE(MESH_LOADER_LOG_PREFIX "[+] Loading texture map {0} [+]", *path.String());
+
+		DecodedTexture texture;
+		if (!TextureLoader::LoadRGBA(path, false, texture.Pixels, texture.Width, texture.Height))
+		{
+			HL_CORE_ERROR(MESH_LOADER_LOG_PREFIX "[-] Could not load texture: {0} [-]", *path.String());
+			return false;
+		}
+
+		m_Textures[texturePath] = texture;
+		return true;
+	}
+
+	void MeshMaterialTextures::CreateMaterials(const Ref<Shader> &shader, const std::vector<MeshMaterialDescription> &descriptions, std::vector<Ref<Material>> &outMaterials, std::vector<Ref<Texture2D>> &outTextures, std::vector<Ref<Texture2D>> &outNormalMaps)
+	{
+		Ref<Texture2D> whiteTex = Renderer::GetWhiteTexture();
+		std::unordered_map<HLString, Ref<Texture2D>> uploadedTextures;
+
+		auto createTexture = [this, &uploadedTextures](const HLString &path) -> Ref<Texture2D>
+		{
+			auto uploaded = uploadedTextures.find(path);
+			if (uploaded != uploadedTextures.end())
+				return uploaded->second;
+
+			auto decoded = m_Textures.find(path);
+			if (decoded == m_Textures.end())
+				return nullptr;
+
+			const DecodedTexture &texture = decoded->second;
+			Ref<Texture2D> result = Texture2D::Create(TextureFormat::RGBA, texture.Width, texture.Height, texture.Pixels.Data);
+			uploadedTextures[path] = result;
+			return result;
+		};
+
+		outMaterials.resize(descriptions.size());
+		outTextures.resize(descriptions.size(), whiteTex);
+
+		for (uint32 i = 0; i < (uint32)descriptions.size(); ++i)
+		{
+			const MeshMaterialDescription &description = descriptions[i];
+
+			Ref<Material> mi = Material::Create(shader, description.Name);
+			outMaterials[i] = mi;
+
+			mi->Set("u_MaterialUniforms.DiffuseColor", description.DiffuseColor);
+			mi->Set("u_MaterialUniforms.Emission", description.Emission);
+			mi->Set("u_MaterialUniforms.Roughness", description.Roughness);
+			mi->Set("u_MaterialUniforms.Metalness", description.Metalness);
+
+			Ref<Texture2D> diffuseMap = createTexture(description.DiffuseMap);
+			if (diffuseMap)
+			{
+				// SRGB Texture
+				diffuseMap->GetSpecification().Format = TextureFormat::SRGB;
+				outTextures[i] = diffuseMap;
+			}
+			mi->Set("u_DiffuseTexture", diffuseMap ? diffuseMap : whiteTex);
+
+			Ref<Texture2D> normalMap = createTexture(description.NormalMap);
+			if (normalMap)
+			{
+				outTextures.push_back(normalMap);
+				outNormalMaps.push_back(normalMap);
+			}
+			mi->Set("u_NormalTexture", normalMap ? normalMap : whiteTex);
+			mi->Set("u_MaterialUniforms.UseNormalMap", normalMap ? true : false);
+
+			Ref<Texture2D> roughnessMap = createTexture(description.RoughnessMap);
+			if (roughnessMap)
+				outTextures.push_back(roughnessMap);
+			mi->Set("u_RoughnessTexture", roughnessMap ? roughnessMap : whiteTex);
+
+			Ref<Texture2D> metalnessMap = createTexture(description.MetalnessMap);
+			if (metalnessMap)
+				outTextures.push_back(metalnessMap);
+			mi->Set("u_MetalnessTexture", metalnessMap ? metalnessMap : whiteTex);
+		}
+
+		Release();
+	}
+
+	void MeshMaterialTextures::Release()
+	{
+		for (auto &[path, texture] : m_Textures)
+			texture.Pixels.Release();
+
+		m_Textures.clear();
+	}
+
 	Ref<MeshLoader> MeshLoader::Create(const FileSystemPath &filePath, const Ref<Shader> &shader)
 	{
+		Ref<MeshLoader> loader = Decode(filePath);
+		if (loader)
+			loader->CreateResources(shader);
+
+		return loader;
+	}
+
+	Ref<MeshLoader> MeshLoader::Decode(const FileSystemPath &filePath)
+	{
+		if (filePath.Extension() == HL_COOKED_MESH_EXTENSION)
+			return Ref<CookedMeshLoader>::Create(filePath);
+
+		// The cooked file is addressed by the content and the directory of the source,
+		// so a touched but unchanged source does not have to be cooked again
+		DerivedDataCache *cache = DerivedDataCache::Get();
+		DerivedDataKey cookedKey;
+		bool useCache = CookedMeshLoader::GetCacheKey(filePath, cookedKey);
+
+		FileSystemPath cookedPath;
+		CookedMeshHeader cookedHeader;
+		bool upToDate = false;
+
+		if (useCache)
+		{
+			cookedPath = cache->GetEntryPath(cookedKey);
+			upToDate = cache->Contains(cookedKey) && CookedMeshLoader::ReadHeader(cookedPath, cookedHeader);
+		}
+		else
+		{
+			cookedPath = CookedMeshLoader::GetCookedPath(filePath);
+			upToDate = CookedMeshLoader::IsUpToDate(filePath, cookedPath, &cookedHeader);
+		}
+
+		// Animations are evaluated on the imported scene and are not part of the cooked format, so animated meshes always use the importer.
+		// Cooked files of animated meshes, that have been written by older versions, are ignored.
+		if (upToDate && !(cookedHeader.Flags & (uint32)CookedMeshFlag::Animated))
+		{
+			Ref<CookedMeshLoader> cookedLoader = Ref<CookedMeshLoader>::Create(cookedPath, filePath);
+			if (cookedLoader->IsValid())
+				return cookedLoader;
+
+			upToDate = false;
+		}
+
 	#ifdef HIGHLO_API_ASSIMP_LOADER
-		return Ref<AssimpMeshLoader>::Create(filePath, shader);
+		Ref<MeshLoader> loader = Ref<AssimpMeshLoader>::Create(filePath);
+		if (!upToDate && !loader->IsAnimated() && !loader->GetSubmeshes().empty())
+		{
+			if (CookedMeshLoader::Cook(loader, filePath, cookedPath) && useCache)
+				cache->Register(cookedKey);
+		}
+
+		return loader;
 	#endif // HIGHLO_API_ASSIMP_LOADER
 	}
 }
@@ -2,11 +2,14 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Split loading into Decode() on any thread and CreateResources() on the main thread
+//     - 1.1 (2026-10-19) Added material descriptions and loading of cooked meshes
 //     - 1.0 (2022-01-21) initial release
 //
 
 #pragma once
 
+#include "Engine/Core/Allocator.h"
 #include "Engine/Core/FileSystemPath.h"
 #include "Engine/Math/AABB.h"
 
@@ -19,6 +22,62 @@
 
 namespace highlo
 {
+	/// <summary>
+	/// The parameters a material has been created from, so that it can be recreated without the source file.
+	/// Texture paths are relative to the directory of the mesh file and are empty if the material has no such map.
+	/// </summary>
+	struct MeshMaterialDescription
+	{
+		HLString Name;
+		glm::vec3 DiffuseColor = glm::vec3(0.8f);
+		float Emission = 0.0f;
+		float Roughness = 0.8f;
+		float Metalness = 0.0f;
+
+		HLString DiffuseMap;
+		HLString NormalMap;
+		HLString RoughnessMap;
+		HLString MetalnessMap;
+	};
+
+	/// <summary>
+	/// Holds the decoded pixels of the texture maps of a mesh. The textures are decoded together with the mesh on any thread,
+	/// so that only the upload is left, when the materials are created on the main thread.
+	/// </summary>
+	class MeshMaterialTextures
+	{
+	public:
+
+		HLAPI MeshMaterialTextures() = default;
+		HLAPI MeshMaterialTextures(const MeshMaterialTextures&) = delete;
+		HLAPI MeshMaterialTextures &operator=(const MeshMaterialTextures&) = delete;
+		HLAPI ~MeshMaterialTextures();
+
+		/// <summary>
+		/// Decodes a texture map, whose path is relative to the directory of the mesh file. Returns false, if the texture could not be loaded.
+		/// </summary>
+		HLAPI bool Decode(const FileSystemPath &meshPath, const HLString &texturePath);
+
+		/// <summary>
+		/// Creates the materials of the descriptions and uploads the decoded texture maps, maps that could not be decoded are replaced by the white texture.
+		/// The decoded pixels are released afterwards.
+		/// </summary>
+		HLAPI void CreateMaterials(const Ref<Shader> &shader, const std::vector<MeshMaterialDescription> &descriptions, std::vector<Ref<Material>> &outMaterials, std::vector<Ref<Texture2D>> &outTextures, std::vector<Ref<Texture2D>> &outNormalMaps);
+
+		HLAPI void Release();
+
+	private:
+
+		struct DecodedTexture
+		{
+			Allocator Pixels;
+			uint32 Width = 0;
+			uint32 Height = 0;
+		};
+
+		std::unordered_map<HLString, DecodedTexture> m_Textures;
+	};
+
 	/// <summary>
 	/// Interface to import a model or an animation of any type
 	/// </summary>
@@ -36,6 +95,7 @@ namespace highlo
 		HLAPI virtual const std::vector<Ref<Material>> &GetMaterials() const = 0;
 		HLAPI virtual const std::vector<Ref<Texture2D>> &GetTextures() const = 0;
 		HLAPI virtual const std::vector<Ref<Texture2D>> &GetNormalMaps() const = 0;
+		HLAPI virtual const std::vector<MeshMaterialDescription> &GetMaterialDescriptions() const = 0;
 
 		// Anim
 		HLAPI virtual const glm::mat4 &GetInverseTransform() const = 0;
@@ -59,6 +119,20 @@ namespace highlo
 
 		HLAPI virtual void ManipulateBoneTransform(float time, std::vector<glm::mat4> &outTransforms) = 0;
 
+		/// <summary>
+		/// Creates the vertex and index buffers, the materials and the textures of a decoded mesh. Has to be called on the main thread.
+		/// </summary>
+		HLAPI virtual void CreateResources(const Ref<Shader> &shader) = 0;
+
+		/// <summary>
+		/// Loads the cooked version of the mesh if it is up to date, otherwise the source file is imported and cooked for the next time.
+		/// No GPU resources are created, so it can be called from any thread.
+		/// </summary>
+		HLAPI static Ref<MeshLoader> Decode(const FileSystemPath &filePath);
+
+		/// <summary>
+		/// Decodes the mesh and creates its GPU resources right away.
+		/// </summary>
 		HLAPI static Ref<MeshLoader> Create(const FileSystemPath &filePath, const Ref<Shader> &shader);
 	};
 }
@@ -0,0 +1,93 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "TextureLoader.h"
+
+#include "Engine/Assets/DerivedDataCache.h"
+
+#include <stb_image.h>
+
+#define TEXTURE_LOADER_LOG_PREFIX "TextureLoader>"
+
+namespace highlo
+{
+	namespace utils
+	{
+		/// <summary>
+		/// Stored behind the pixels, so that a cached entry can be used as the pixel buffer without another copy.
+		/// </summary>
+		struct CachedTextureFooter
+		{
+			uint32 Width = 0;
+			uint32 Height = 0;
+		};
+	}
+
+	bool TextureLoader::LoadRGBA(const FileSystemPath &filePath, bool flipOnLoad, Allocator &outPixels, uint32 &outWidth, uint32 &outHeight)
+	{
+		DerivedDataCache *cache = DerivedDataCache::Get();
+
+		DerivedDataKey key;
+		bool cacheable = cache->IsEnabled() && cache->HashSourceFile(filePath, key.SourceHash);
+		if (cacheable)
+		{
+			key.Importer = HL_TEXTURE_IMPORTER_NAME;
+			key.ImporterVersion = HL_TEXTURE_IMPORTER_VERSION;
+			key.SettingsHash = DerivedDataCache::HashSettings(&flipOnLoad, sizeof(flipOnLoad));
+
+			Allocator cached;
+			if (cache->Get(key, cached))
+			{
+				utils::CachedTextureFooter footer;
+				if (cached.Size >= sizeof(footer))
+				{
+					memcpy(&footer, cached.Data + cached.Size - sizeof(footer), sizeof(footer));
+					if ((uint64)footer.Width * (uint64)footer.Height * 4 == cached.Size - sizeof(footer))
+					{
+						outPixels = cached;
+						outPixels.Size -= sizeof(footer);
+						outWidth = footer.Width;
+						outHeight = footer.Height;
+						return true;
+					}
+				}
+
+				HL_CORE_WARN(TEXTURE_LOADER_LOG_PREFIX "[-] Ignoring invalid cache entry for {0} [-]", *filePath.String());
+				cached.Release();
+			}
+		}
+
+		// The flip state has to be thread local, because several textures are decoded at the same time
+		stbi_set_flip_vertically_on_load_thread(flipOnLoad);
+
+		int32 width, height, channels;
+		stbi_uc *pixels = stbi_load(*filePath.Absolute(), &width, &height, &channels, STBI_rgb_alpha);
+		if (!pixels)
+		{
+			HL_CORE_ERROR(TEXTURE_LOADER_LOG_PREFIX "[-] Failed to decode {0} (Error: {1}) [-]", *filePath.String(), stbi_failure_reason());
+			return false;
+		}
+
+		uint32 pixelSize = (uint32)width * (uint32)height * 4; // 4 byte per pixel
+
+		utils::CachedTextureFooter footer;
+		footer.Width = (uint32)width;
+		footer.Height = (uint32)height;
+
+		Allocator blob;
+		blob.Allocate(pixelSize + sizeof(footer));
+		memcpy(blob.Data, pixels, pixelSize);
+		memcpy(blob.Data + pixelSize, &footer, sizeof(footer));
+		stbi_image_free(pixels);
+
+		if (cacheable)
+			cache->Put(key, blob.Data, blob.Size);
+
+		outPixels = blob;
+		outPixels.Size = pixelSize;
+		outWidth = footer.Width;
+		outHeight = footer.Height;
+		return true;
+	}
+}
+
@@ -0,0 +1,32 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Allocator.h"
+#include "Engine/Core/FileSystemPath.h"
+
+#define HL_TEXTURE_IMPORTER_NAME "Texture2D"
+#define HL_TEXTURE_IMPORTER_VERSION 1
+
+namespace highlo
+{
+	/// <summary>
+	/// The TextureLoader decodes image files into RGBA8 pixels. The decoded pixels are stored in the DerivedDataCache,
+	/// so that the image only has to be decoded again, when the content of the file changes.
+	/// </summary>
+	class TextureLoader
+	{
+	public:
+
+		/// <summary>
+		/// Decodes the image with 4 byte per pixel, outPixels has to be released by the caller. Can be called from any thread.
+		/// </summary>
+		HLAPI static bool LoadRGBA(const FileSystemPath &filePath, bool flipOnLoad, Allocator &outPixels, uint32 &outWidth, uint32 &outHeight);
+	};
+}
+
@@ -14,20 +14,22 @@ namespace highlo
 	{
 	}
 
-	void Translation::AddText(const HLString &key, const HLString &value)
+	void Translation::AddText(const HLName &key, const HLString &value)
 	{
 		m_Translations[key] = value;
 	}
 
-	HLString Translation::GetText(const HLString &key)
+	const HLString &Translation::GetText(const HLName &key) const
 	{
-		if (m_Translations.find(key) != m_Translations.end())
-			return m_Translations.at(key);
+		auto it = m_Translations.find(key);
+		if (it != m_Translations.end())
+			return it->second;
 
-		return key;
+		// The string of a name is never freed, so it can be returned by reference
+		return key.GetString();
 	}
 
-	bool Translation::HasText(const HLString &key) const
+	bool Translation::HasText(const HLName &key) const
 	{
 		return m_Translations.find(key) != m_Translations.end();
 	}
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) The keys are interned names
 //     - 1.0 (2022-03-01) initial release
 //
 
@@ -16,19 +17,24 @@ namespace highlo
 		HLAPI Translation(const HLString &language, const HLString &languageCode);
 		HLAPI virtual ~Translation();
 
-		HLAPI void AddText(const HLString &key, const HLString &value);
-		HLAPI HLString GetText(const HLString &key);
-		HLAPI bool HasText(const HLString &key) const;
+		HLAPI void AddText(const HLName &key, const HLString &value);
 
-		HLAPI std::unordered_map<HLString, HLString> &GetAllTranslations() { return m_Translations; }
-		HLAPI const std::unordered_map<HLString, HLString> &GetAllTranslations() const { return m_Translations; }
+		/// <summary>
+		/// Returns the translated text or the key itself, if the key has no translation.
+		/// Use HL_NAME for literal keys, so that the key is only hashed once.
+		/// </summary>
+		HLAPI const HLString &GetText(const HLName &key) const;
+		HLAPI bool HasText(const HLName &key) const;
+
+		HLAPI std::unordered_map<HLName, HLString> &GetAllTranslations() { return m_Translations; }
+		HLAPI const std::unordered_map<HLName, HLString> &GetAllTranslations() const { return m_Translations; }
 
 		HLAPI const HLString &GetLanguageText() const { return m_Language; }
 		HLAPI const HLString &GetLanguageCode() const { return m_LanguageCode; }
 
 	private:
 
-		std::unordered_map<HLString, HLString> m_Translations;
+		std::unordered_map<HLName, HLString> m_Translations;
 		HLString m_Language;
 		HLString m_LanguageCode;
 	};
@@ -2,6 +2,8 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Added NLerpQuatSSE
+//     - 1.1 (2026-10-19) Added LerpSSE and NormalizeQuatSSE for structure-of-arrays data
 //     - 1.0 (2022-03-03) initial release
 //
 
@@ -119,5 +121,55 @@ namespace highlo::Math
 		// The Result is in the lower part of the SSE Register
 		return _mm_cvtss_f32(sumReg);
 	}
+
+	/// <summary>
+	/// Linearly interpolates four lanes at once: a + (b - a) * t
+	/// </summary>
+	HLAPI static HL_FORCE_INLINE __m128 LerpSSE(__m128 a, __m128 b, __m128 t)
+	{
+		return _mm_madd_ps(_mm_sub_ps(b, a), t, a);
+	}
+
+	/// <summary>
+	/// Normalizes four quaternions stored as structure-of-arrays (one register per component).
+	/// </summary>
+	HLAPI static HL_FORCE_INLINE void NormalizeQuatSSE(__m128 &x, __m128 &y, __m128 &z, __m128 &w)
+	{
+		__m128 lengthSquared = _mm_mul_ps(x, x);
+		lengthSquared = _mm_madd_ps(y, y, lengthSquared);
+		lengthSquared = _mm_madd_ps(z, z, lengthSquared);
+		lengthSquared = _mm_madd_ps(w, w, lengthSquared);
+
+		__m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSquared));
+		x = _mm_mul_ps(x, invLength);
+		y = _mm_mul_ps(y, invLength);
+		z = _mm_mul_ps(z, invLength);
+		w = _mm_mul_ps(w, invLength);
+	}
+
+	/// <summary>
+	/// Interpolates four pairs of quaternions (stored as structure-of-arrays) along the shortest path and normalizes the result.
+	/// </summary>
+	HLAPI static HL_FORCE_INLINE void NLerpQuatSSE(__m128 ax, __m128 ay, __m128 az, __m128 aw, __m128 bx, __m128 by, __m128 bz, __m128 bw, __m128 t,
+												   __m128 &outX, __m128 &outY, __m128 &outZ, __m128 &outW)
+	{
+		__m128 dot = _mm_mul_ps(ax, bx);
+		dot = _mm_madd_ps(ay, by, dot);
+		dot = _mm_madd_ps(az, bz, dot);
+		dot = _mm_madd_ps(aw, bw, dot);
+
+		// Flip the sign of b if the quaternions are more than 90 degrees apart
+		__m128 flip = _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+		bx = _mm_xor_ps(bx, flip);
+		by = _mm_xor_ps(by, flip);
+		bz = _mm_xor_ps(bz, flip);
+		bw = _mm_xor_ps(bw, flip);
+
+		outX = LerpSSE(ax, bx, t);
+		outY = LerpSSE(ay, by, t);
+		outZ = LerpSSE(az, bz, t);
+		outW = LerpSSE(aw, bw, t);
+		NormalizeQuatSSE(outX, outY, outZ, outW);
+	}
 }
 
@@ -0,0 +1,442 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Engine/Core/AsyncFileIO.h"
+
+#ifdef HL_PLATFORM_LINUX
+
+#include <thread>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#define LINUX_ASYNC_FILE_IO_LOG_PREFIX "AsyncFileIO>  "
+
+// A single read is limited by the kernel to slightly less than 2 GB, larger requests are split
+#define IO_URING_MAX_READ_SIZE (1u << 30)
+
+namespace highlo
+{
+	namespace utils
+	{
+		// The engine talks to the kernel directly instead of depending on liburing
+		static int32 IOUringSetup(uint32 entries, io_uring_params *params)
+		{
+			return (int32)syscall(__NR_io_uring_setup, entries, params);
+		}
+
+		static int32 IOUringEnter(int32 ringFile, uint32 toSubmit, uint32 minComplete, uint32 flags)
+		{
+			return (int32)syscall(__NR_io_uring_enter, ringFile, toSubmit, minComplete, flags, nullptr, 0);
+		}
+
+		static int32 IOUringRegister(int32 ringFile, uint32 opcode, void *arg, uint32 count)
+		{
+			return (int32)syscall(__NR_io_uring_register, ringFile, opcode, arg, count);
+		}
+
+		/// <summary>
+		/// Keeps the reads in flight in the submission ring of io_uring, a single thread waits for the completions.
+		/// Reads that return less than requested are continued until the whole range has been read.
+		/// </summary>
+		class IOUringAsyncFileIOBackend : public AsyncFileIOBackend
+		{
+		public:
+
+			IOUringAsyncFileIOBackend(const CompletionFunction &onComplete)
+				: m_OnComplete(onComplete) {}
+
+			virtual ~IOUringAsyncFileIOBackend()
+			{
+				Shutdown();
+
+				if (m_Sqes)
+					munmap(m_Sqes, m_SqesSize);
+
+				if (m_CqRing && m_CqRing != m_SqRing)
+					munmap(m_CqRing, m_CqRingSize);
+
+				if (m_SqRing)
+					munmap(m_SqRing, m_SqRingSize);
+
+				if (m_RingFile >= 0)
+					close(m_RingFile);
+			}
+
+			bool Init(uint32 queueDepth)
+			{
+				io_uring_params params;
+				memset(&params, 0, sizeof(params));
+
+				// Fails on kernels older than 5.1 and if io_uring has been disabled, for example by a seccomp filter
+				m_RingFile = IOUringSetup(queueDepth > 2 ? queueDepth : 2, &params);
+				if (m_RingFile < 0)
+					return false;
+
+				// IORING_OP_READ exists since 5.6, older kernels don't support the probe either
+				std::vector<Byte> probeData(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op), 0);
+				io_uring_probe *probe = (io_uring_probe*)probeData.data();
+				if (IOUringRegister(m_RingFile, IORING_REGISTER_PROBE, probe, 256) < 0
+					|| probe->last_op < IORING_OP_READ
+					|| !(probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED))
+					return false;
+
+				m_SqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+				m_CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+				m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+				bool singleMapping = params.features & IORING_FEAT_SINGLE_MMAP;
+				if (singleMapping)
+					m_SqRingSize = m_CqRingSize = std::max(m_SqRingSize, m_CqRingSize);
+
+				m_SqRing = (Byte*)MapRing(m_SqRingSize, IORING_OFF_SQ_RING);
+				m_CqRing = singleMapping ? m_SqRing : (Byte*)MapRing(m_CqRingSize, IORING_OFF_CQ_RING);
+				m_Sqes = (io_uring_sqe*)MapRing(m_SqesSize, IORING_OFF_SQES);
+				if (!m_SqRing || !m_CqRing || !m_Sqes)
+					return false;
+
+				m_SqHead = (uint32*)(m_SqRing + params.sq_off.head);
+				m_SqTail = (uint32*)(m_SqRing + params.sq_off.tail);
+				m_SqMask = *(uint32*)(m_SqRing + params.sq_off.ring_mask);
+				m_SqArray = (uint32*)(m_SqRing + params.sq_off.array);
+				m_SqEntries = params.sq_entries;
+
+				m_CqHead = (uint32*)(m_CqRing + params.cq_off.head);
+				m_CqTail = (uint32*)(m_CqRing + params.cq_off.tail);
+				m_CqMask = *(uint32*)(m_CqRing + params.cq_off.ring_mask);
+				m_Cqes = (io_uring_cqe*)(m_CqRing + params.cq_off.cqes);
+
+				m_CompletionThread = std::thread([this]() { CompletionLoop(); });
+				return true;
+			}
+
+			virtual const char *GetName() const override { return "io_uring"; }
+
+			// One entry stays free for the wake up of the completion thread
+			virtual uint32 GetCapacity() const override { return m_SqEntries - 1; }
+
+			virtual void Submit(const std::vector<AsyncIORequest*> &requests) override
+			{
+				// The completions are reported after the lock has been released, because they can submit the next requests
+				std::vector<std::pair<AsyncIORequest*, bool>> finished;
+				std::vector<ReadState*> rejected;
+				uint32 submitted = 0;
+
+				{
+					std::lock_guard<std::mutex> lock(m_SubmitMutex);
+					for (AsyncIORequest *request : requests)
+					{
+						ReadState *state = Open(request);
+						if (!state)
+						{
+							finished.push_back({ request, false });
+							continue;
+						}
+
+						// Nothing to read, but it still counts as a successful read
+						if (state->Size == 0)
+						{
+							close(state->File);
+							delete state;
+							finished.push_back({ request, true });
+							continue;
+						}
+
+						PushRead(state);
+						++submitted;
+					}
+
+					// The whole batch is handed to the kernel at once
+					if (submitted > 0)
+						Enter(rejected);
+				}
+
+				for (auto &[request, success] : finished)
+					m_OnComplete(request, success);
+
+				for (ReadState *state : rejected)
+					Finish(state, false);
+			}
+
+			virtual void Shutdown() override
+			{
+				if (!m_CompletionThread.joinable())
+					return;
+
+				// Wakes up the completion thread, the entry has no request attached. A full completion ring makes the kernel
+				// reject new entries until the completion thread has caught up, so the wake up is repeated outside of the lock
+				while (!m_CompletionThreadExited)
+				{
+					std::vector<ReadState*> rejected;
+					bool submitted;
+
+					{
+						std::lock_guard<std::mutex> lock(m_SubmitMutex);
+						m_ShouldStop = true;
+
+						io_uring_sqe *sqe = NextSqe();
+						sqe->opcode = IORING_OP_NOP;
+						sqe->user_data = 0;
+						CommitSqe();
+						submitted = Enter(rejected);
+					}
+
+					for (ReadState *state : rejected)
+						Finish(state, false);
+
+					if (submitted)
+						break;
+
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+
+				m_CompletionThread.join();
+			}
+
+		private:
+
+			struct ReadState
+			{
+				AsyncIORequest *Request = nullptr;
+				int32 File = -1;
+				uint64 Size = 0;
+				uint64 BytesRead = 0;
+			};
+
+			void *MapRing(uint64 size, uint64 offset)
+			{
+				void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFile, offset);
+				return memory == MAP_FAILED ? nullptr : memory;
+			}
+
+			ReadState *Open(AsyncIORequest *request)
+			{
+				if (request->CancelRequested)
+					return nullptr;
+
+				int32 file = open(*request->FilePath.String(), O_RDONLY | O_CLOEXEC);
+				if (file < 0)
+					return nullptr;
+
+				struct stat fileInfo;
+				uint64 readSize = 0;
+				if (fstat(file, &fileInfo) != 0 || !AllocateBuffer(request, (uint64)fileInfo.st_size, readSize))
+				{
+					close(file);
+					return nullptr;
+				}
+
+				ReadState *state = new ReadState();
+				state->Request = request;
+				state->File = file;
+				state->Size = readSize;
+				return state;
+			}
+
+			// Expects m_SubmitMutex to be locked
+			io_uring_sqe *NextSqe()
+			{
+				// The capacity leaves one entry free and the kernel consumes the entries on every enter, so the ring can't be full
+				uint32 tail = *m_SqTail;
+				uint32 index = tail & m_SqMask;
+
+				io_uring_sqe *sqe = &m_Sqes[index];
+				memset(sqe, 0, sizeof(io_uring_sqe));
+				m_SqArray[index] = index;
+				return sqe;
+			}
+
+			// Expects m_SubmitMutex to be locked
+			void CommitSqe()
+			{
+				__atomic_store_n(m_SqTail, *m_SqTail + 1, __ATOMIC_RELEASE);
+			}
+
+			// Expects m_SubmitMutex to be locked
+			void PushRead(ReadState *state)
+			{
+				uint64 remaining = state->Size - state->BytesRead;
+
+				io_uring_sqe *sqe = NextSqe();
+				sqe->opcode = IORING_OP_READ;
+				sqe->fd = state->File;
+				sqe->off = state->Request->Offset + state->BytesRead;
+				sqe->addr = (uint64)(state->Request->Buffer.Data + state->BytesRead);
+				sqe->len = (uint32)(remaining < IO_URING_MAX_READ_SIZE ? remaining : IO_URING_MAX_READ_SIZE);
+				sqe->user_data = (uint64)state;
+				CommitSqe();
+			}
+
+			// Expects m_SubmitMutex to be locked. Hands all committed entries to the kernel, the entries, that the kernel did not accept,
+			// are removed from the ring again and their read states are added to outRejected, so that the caller can fail them after unlocking.
+			bool Enter(std::vector<ReadState*> &outRejected)
+			{
+				uint32 count = *m_SqTail - __atomic_load_n(m_SqHead, __ATOMIC_ACQUIRE);
+
+				int32 result;
+				do
+				{
+					result = IOUringEnter(m_RingFile, count, 0, 0);
+				}
+				while (result < 0 && errno == EINTR);
+
+				int32 error = result < 0 ? errno : 0;
+
+				// Without SQPOLL the kernel consumes the entries during the call, everything between head and tail has not been submitted
+				uint32 head = __atomic_load_n(m_SqHead, __ATOMIC_ACQUIRE);
+				uint32 tail = *m_SqTail;
+				if (head == tail)
+					return true;
+
+				HL_CORE_ERROR(LINUX_ASYNC_FILE_IO_LOG_PREFIX "[-] Failed to submit {0} of {1} entries: {2} [-]", tail - head, count, error ? strerror(error) : "partial submission");
+
+				for (uint32 i = head; i != tail; ++i)
+				{
+					ReadState *state = (ReadState*)m_Sqes[i & m_SqMask].user_data;
+					if (state)
+						outRejected.push_back(state);
+				}
+
+				__atomic_store_n(m_SqTail, head, __ATOMIC_RELEASE);
+				return false;
+			}
+
+			void CompletionLoop()
+			{
+				for (;;)
+				{
+					uint32 head = *m_CqHead;
+					uint32 tail = __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE);
+
+					if (head == tail)
+					{
+						int32 result = IOUringEnter(m_RingFile, 0, 1, IORING_ENTER_GETEVENTS);
+						if (result < 0 && errno != EINTR)
+						{
+							HL_CORE_ERROR(LINUX_ASYNC_FILE_IO_LOG_PREFIX "[-] Failed to wait for completions: {0} [-]", strerror(errno));
+							m_CompletionThreadExited = true;
+							return;
+						}
+
+						continue;
+					}
+
+					bool stop = false;
+					for (; head != tail; ++head)
+					{
+						const io_uring_cqe &cqe = m_Cqes[head & m_CqMask];
+						ReadState *state = (ReadState*)cqe.user_data;
+						int32 result = cqe.res;
+
+						// The entry can be reused by the kernel as soon as the head has been moved
+						__atomic_store_n(m_CqHead, head + 1, __ATOMIC_RELEASE);
+
+						if (state)
+							OnReadFinished(state, result);
+						else
+							stop = m_ShouldStop;
+					}
+
+					if (stop)
+					{
+						m_CompletionThreadExited = true;
+						return;
+					}
+				}
+			}
+
+			void OnReadFinished(ReadState *state, int32 result)
+			{
+				if (result == -EINTR || result == -EAGAIN)
+				{
+					Resubmit(state);
+					return;
+				}
+
+				// The file has been truncated since it has been opened, if it ends early
+				if (result <= 0)
+				{
+					Finish(state, false);
+					return;
+				}
+
+				state->BytesRead += (uint64)result;
+				if (state->BytesRead < state->Size && !state->Request->CancelRequested)
+				{
+					Resubmit(state);
+					return;
+				}
+
+				Finish(state, state->BytesRead == state->Size);
+			}
+
+			void Resubmit(ReadState *state)
+			{
+				std::vector<ReadState*> rejected;
+
+				{
+					std::lock_guard<std::mutex> lock(m_SubmitMutex);
+					PushRead(state);
+					Enter(rejected);
+				}
+
+				for (ReadState *rejectedState : rejected)
+					Finish(rejectedState, false);
+			}
+
+			void Finish(ReadState *state, bool success)
+			{
+				AsyncIORequest *request = state->Request;
+				close(state->File);
+				delete state;
+
+				m_OnComplete(request, success);
+			}
+
+			CompletionFunction m_OnComplete;
+			std::thread m_CompletionThread;
+			std::mutex m_SubmitMutex;
+			std::atomic<bool> m_ShouldStop = false;
+			std::atomic<bool> m_CompletionThreadExited = false;
+
+			int32 m_RingFile = -1;
+			Byte *m_SqRing = nullptr;
+			Byte *m_CqRing = nullptr;
+			io_uring_sqe *m_Sqes = nullptr;
+			uint64 m_SqRingSize = 0;
+			uint64 m_CqRingSize = 0;
+			uint64 m_SqesSize = 0;
+
+			uint32 *m_SqHead = nullptr;
+			uint32 *m_SqTail = nullptr;
+			uint32 *m_SqArray = nullptr;
+			uint32 m_SqMask = 0;
+			uint32 m_SqEntries = 0;
+
+			uint32 *m_CqHead = nullptr;
+			uint32 *m_CqTail = nullptr;
+			io_uring_cqe *m_Cqes = nullptr;
+			uint32 m_CqMask = 0;
+		};
+	}
+
+	UniqueRef<AsyncFileIOBackend> AsyncFileIOBackend::CreateNative(uint32 queueDepth, const CompletionFunction &onComplete)
+	{
+		utils::IOUringAsyncFileIOBackend *backend = new utils::IOUringAsyncFileIOBackend(onComplete);
+		if (!backend->Init(queueDepth))
+		{
+			HL_CORE_WARN(LINUX_ASYNC_FILE_IO_LOG_PREFIX "[-] io_uring is not available, the files are read by threads instead [-]");
+			delete backend;
+			return nullptr;
+		}
+
+		return UniqueRef<AsyncFileIOBackend>(backend);
+	}
+}
+
+#endif // HL_PLATFORM_LINUX
+
@@ -0,0 +1,351 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Engine/Core/FileSystemWatcher.h"
+#include "Engine/Application/Application.h"
+
+#ifdef HL_PLATFORM_LINUX
+
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <thread>
+#include <chrono>
+#include <filesystem>
+
+#define FILESYSTEMWATCHER_LOG_PREFIX "FSWatcher>    "
+
+// IN_CLOSE_WRITE instead of IN_MODIFY, so that a file that is written in many chunks is only reported once
+#define INOTIFY_WATCH_MASK (IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR)
+
+namespace highlo
+{
+	static std::thread s_WatcherThread;
+	static std::atomic<bool> s_Watching = false;
+	static std::atomic<bool> s_IgnoreNextChange = false;
+	static HLString s_WatchPath = "";
+	static int32 s_StopEvent = -1;
+
+	namespace utils
+	{
+		struct PendingMove
+		{
+			std::string FilePath;
+			bool IsDirectory = false;
+		};
+
+		struct InotifyState
+		{
+			int32 Inotify = -1;
+			std::unordered_map<int32, std::string> Directories;
+			std::unordered_map<uint32, PendingMove> PendingMoves;
+			FileSystemChangeBatch Batch;
+		};
+
+		static FileSystemPath ToFileSystemPath(const std::string &path)
+		{
+			return FileSystemPath(HLString(path.c_str(), (uint32)path.size()));
+		}
+
+		static bool IsInsideDirectory(const std::string &path, const std::string &directory)
+		{
+			return path.size() >= directory.size()
+				&& path.compare(0, directory.size(), directory) == 0
+				&& (path.size() == directory.size() || path[directory.size()] == '/');
+		}
+
+		/// <summary>
+		/// Watches the directory and all of its sub directories. Directories that are created or moved into the watched tree
+		/// can already contain files before their watch exists, so their content is reported as added.
+		/// </summary>
+		static void AddWatches(InotifyState &state, const std::string &directory, bool reportContent)
+		{
+			int32 descriptor = inotify_add_watch(state.Inotify, directory.c_str(), INOTIFY_WATCH_MASK);
+			if (descriptor < 0)
+			{
+				// ENOSPC means that fs.inotify.max_user_watches is exhausted
+				HL_CORE_WARN(FILESYSTEMWATCHER_LOG_PREFIX "[-] Could not watch {0}: {1} [-]", directory, strerror(errno));
+				return;
+			}
+
+			state.Directories[descriptor] = directory;
+
+			std::error_code error;
+			std::filesystem::directory_iterator it(directory, error);
+			for (; !error && it != std::filesystem::directory_iterator(); it.increment(error))
+			{
+				std::string path = it->path().string();
+				bool isDirectory = it->is_directory(error) && !it->is_symlink(error);
+
+				if (reportContent)
+					state.Batch.Add(FileSystemAction::Added, ToFileSystemPath(path), isDirectory);
+
+				if (isDirectory)
+					AddWatches(state, path, reportContent);
+			}
+		}
+
+		static void RenameWatches(InotifyState &state, const std::string &oldDirectory, const std::string &newDirectory)
+		{
+			for (auto &[descriptor, directory] : state.Directories)
+			{
+				if (IsInsideDirectory(directory, oldDirectory))
+					directory = newDirectory + directory.substr(oldDirectory.size());
+			}
+		}
+
+		static void RemoveWatches(InotifyState &state, const std::string &removedDirectory)
+		{
+			for (auto it = state.Directories.begin(); it != state.Directories.end();)
+			{
+				if (IsInsideDirectory(it->second, removedDirectory))
+				{
+					inotify_rm_watch(state.Inotify, it->first);
+					it = state.Directories.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		static void ProcessEvents(InotifyState &state, const char *buffer, int64 length)
+		{
+			const char *end = buffer + length;
+			for (const char *ptr = buffer; ptr < end;)
+			{
+				const inotify_event *event = (const inotify_event*)ptr;
+				ptr += sizeof(inotify_event) + event->len;
+
+				if (event->mask & IN_Q_OVERFLOW)
+				{
+					HL_CORE_WARN(FILESYSTEMWATCHER_LOG_PREFIX "[-] The event queue overflowed, changes have been lost [-]");
+					continue;
+				}
+
+				if (event->mask & IN_IGNORED)
+				{
+					state.Directories.erase(event->wd);
+					continue;
+				}
+
+				// Events without a name concern the watched directory itself, its parent reports them as well
+				auto it = state.Directories.find(event->wd);
+				if (it == state.Directories.end() || event->len == 0)
+					continue;
+
+				std::string path = it->second + "/" + event->name;
+				bool isDirectory = (event->mask & IN_ISDIR) != 0;
+
+				if (event->mask & IN_CREATE)
+				{
+					state.Batch.Add(FileSystemAction::Added, ToFileSystemPath(path), isDirectory);
+					if (isDirectory)
+						AddWatches(state, path, true);
+				}
+				else if (event->mask & IN_CLOSE_WRITE)
+				{
+					state.Batch.Add(FileSystemAction::Modified, ToFileSystemPath(path), isDirectory);
+				}
+				else if (event->mask & IN_DELETE)
+				{
+					state.Batch.Add(FileSystemAction::Deleted, ToFileSystemPath(path), isDirectory);
+				}
+				else if (event->mask & IN_MOVED_FROM)
+				{
+					state.PendingMoves[event->cookie] = { path, isDirectory };
+				}
+				else if (event->mask & IN_MOVED_TO)
+				{
+					auto move = state.PendingMoves.find(event->cookie);
+					if (move != state.PendingMoves.end())
+					{
+						state.Batch.Add(FileSystemAction::Renamed, ToFileSystemPath(path), isDirectory, ToFileSystemPath(move->second.FilePath));
+						if (isDirectory)
+							RenameWatches(state, move->second.FilePath, path);
+
+						state.PendingMoves.erase(move);
+					}
+					else
+					{
+						// Moved into the watched tree from the outside
+						state.Batch.Add(FileSystemAction::Added, ToFileSystemPath(path), isDirectory);
+						if (isDirectory)
+							AddWatches(state, path, true);
+					}
+				}
+			}
+		}
+
+		static void ResolvePendingMoves(InotifyState &state)
+		{
+			// Moves without a matching target have left the watched tree
+			for (auto &[cookie, move] : state.PendingMoves)
+			{
+				state.Batch.Add(FileSystemAction::Deleted, ToFileSystemPath(move.FilePath), move.IsDirectory);
+				if (move.IsDirectory)
+					RemoveWatches(state, move.FilePath);
+			}
+
+			state.PendingMoves.clear();
+		}
+
+		static void DispatchBatch(FileSystemChangeBatch &batch)
+		{
+			uint32 rawCount = batch.GetRawCount();
+			std::vector<FileSystemChangedEvent> events = batch.Flush();
+
+			if (s_IgnoreNextChange.exchange(false))
+			{
+				HL_CORE_TRACE(FILESYSTEMWATCHER_LOG_PREFIX "[+] Ignoring {0} changes [+]", events.size());
+				return;
+			}
+
+			HL_CORE_INFO(FILESYSTEMWATCHER_LOG_PREFIX "[+] Dispatching {0} changes, coalesced from {1} notifications [+]", events.size(), rawCount);
+
+			const EventCallbackFn &callback = HLApplication::Get().GetWindow().GetEventCallback();
+			for (FileSystemChangedEvent &e : events)
+			{
+				HL_CORE_TRACE(FILESYSTEMWATCHER_LOG_PREFIX "[+] Triggering FileSystemChangedEvent {0} at {1} [+]", *e.ToString(), **e.FilePath);
+				callback(e);
+			}
+		}
+	}
+
+	void FileSystemWatcher::Start(const HLString &filePath)
+	{
+		if (s_WatcherThread.joinable())
+			Stop();
+
+		s_WatchPath = filePath;
+		s_StopEvent = eventfd(0, EFD_CLOEXEC);
+		HL_ASSERT(s_StopEvent >= 0);
+
+		s_Watching = true;
+		s_WatcherThread = std::thread(&FileSystemWatcher::Watch);
+		pthread_setname_np(s_WatcherThread.native_handle(), "HighLoFSWatcher");
+	}
+
+	void FileSystemWatcher::Stop()
+	{
+		if (!s_WatcherThread.joinable())
+			return;
+
+		s_Watching = false;
+
+		uint64 value = 1;
+		write(s_StopEvent, &value, sizeof(value));
+
+		s_WatcherThread.join();
+		close(s_StopEvent);
+		s_StopEvent = -1;
+	}
+
+	void FileSystemWatcher::SetWatchPath(const HLString &filePath)
+	{
+		s_WatchPath = filePath;
+
+		Stop();
+		Start(filePath);
+	}
+
+	void FileSystemWatcher::DisableWatchUntilNextAction()
+	{
+		s_IgnoreNextChange = true;
+	}
+
+	void FileSystemWatcher::Watch()
+	{
+		using Clock = std::chrono::steady_clock;
+
+		utils::InotifyState state;
+		state.Inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (state.Inotify < 0)
+		{
+			HL_CORE_ERROR(FILESYSTEMWATCHER_LOG_PREFIX "[-] Failed to initialize inotify: {0} [-]", strerror(errno));
+			return;
+		}
+
+		std::string root = *s_WatchPath;
+		while (root.size() > 1 && root.back() == '/')
+			root.pop_back();
+
+		utils::AddWatches(state, root, false);
+		HL_CORE_TRACE("Listening on path {0}", root);
+
+		alignas(inotify_event) char buffer[16 * 1024];
+		Clock::time_point firstChange;
+		Clock::time_point lastChange;
+
+		auto getDeadline = [&firstChange, &lastChange]()
+		{
+			FileSystemWatcher *watcher = FileSystemWatcher::Get();
+			return std::min(lastChange + std::chrono::milliseconds(watcher->GetDebounceInterval()), firstChange + std::chrono::milliseconds(watcher->GetMaxDelay()));
+		};
+
+		while (s_Watching)
+		{
+			// Without pending changes the thread sleeps until the next notification
+			int32 timeout = -1;
+			if (!state.Batch.IsEmpty())
+			{
+				int64 remaining = std::chrono::duration_cast<std::chrono::milliseconds>(getDeadline() - Clock::now()).count();
+				timeout = remaining > 0 ? (int32)remaining : 0;
+			}
+
+			pollfd fds[2] = { { state.Inotify, POLLIN, 0 }, { s_StopEvent, POLLIN, 0 } };
+			int32 result = poll(fds, 2, timeout);
+			if (result < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				HL_CORE_ERROR(FILESYSTEMWATCHER_LOG_PREFIX "[-] Failed to wait for changes: {0} [-]", strerror(errno));
+				break;
+			}
+
+			if (fds[1].revents & POLLIN)
+				break;
+
+			if (fds[0].revents & POLLIN)
+			{
+				bool wasEmpty = state.Batch.IsEmpty();
+
+				for (;;)
+				{
+					ssize_t length = read(state.Inotify, buffer, sizeof(buffer));
+					if (length <= 0)
+						break;
+
+					utils::ProcessEvents(state, buffer, length);
+				}
+
+				utils::ResolvePendingMoves(state);
+
+				if (state.Batch.IsEmpty())
+				{
+					// Everything cancelled out, only the counter has to be reset
+					state.Batch.Flush();
+					continue;
+				}
+
+				lastChange = Clock::now();
+				if (wasEmpty)
+					firstChange = lastChange;
+			}
+
+			// Checked after every wakeup, so that a constant stream of changes is dispatched after the maximum delay
+			if (!state.Batch.IsEmpty() && Clock::now() >= getDeadline())
+				utils::DispatchBatch(state.Batch);
+		}
+
+		close(state.Inotify);
+	}
+}
+
+#endif // HL_PLATFORM_LINUX
+
@@ -37,72 +37,72 @@ namespace highlo
 	{
 	}
 	
-	void MetalMaterial::Set(const HLString &name, float value)
+	void MetalMaterial::Set(const HLName &name, float value)
 	{
 		Set<float>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, int32 value)
+	void MetalMaterial::Set(const HLName &name, int32 value)
 	{
 		Set<int32>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, uint32 value)
+	void MetalMaterial::Set(const HLName &name, uint32 value)
 	{
 		Set<uint32>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, bool value)
+	void MetalMaterial::Set(const HLName &name, bool value)
 	{
 		Set<bool>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::vec2 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::vec2 &value)
 	{
 		Set<glm::vec2>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::vec3 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::vec3 &value)
 	{
 		Set<glm::vec3>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::vec4 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::vec4 &value)
 	{
 		Set<glm::vec4>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::ivec2 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::ivec2 &value)
 	{
 		Set<glm::ivec2>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::ivec3 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::ivec3 &value)
 	{
 		Set<glm::ivec3>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::ivec4 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::ivec4 &value)
 	{
 		Set<glm::ivec4>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::mat2 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::mat2 &value)
 	{
 		Set<glm::mat2>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::mat3 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::mat3 &value)
 	{
 		Set<glm::mat3>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const glm::mat4 &value)
+	void MetalMaterial::Set(const HLName &name, const glm::mat4 &value)
 	{
 		Set<glm::mat4>(name, value);
 	}
 	
-	void MetalMaterial::Set(const HLString &name, const Ref<Texture2D> &texture)
+	void MetalMaterial::Set(const HLName &name, const Ref<Texture2D> &texture)
 	{
 		auto decl = FindResourceDeclaration(name);
 		if (!decl)
@@ -115,7 +115,7 @@ namespace highlo
 		m_Texture2Ds[slot] = texture;
 	}
 
-	void MetalMaterial::Set(const HLString &name, const Ref<Texture2D> &texture, uint32 slot)
+	void MetalMaterial::Set(const HLName &name, const Ref<Texture2D> &texture, uint32 slot)
 	{
 		auto decl = FindResourceDeclaration(name);
 		if (!decl)
@@ -127,7 +127,7 @@ namespace highlo
 		m_Texture2Ds[slot] = texture;
 	}
 
-	void MetalMaterial::Set(const HLString &name, const Ref<Texture3D> &texture)
+	void MetalMaterial::Set(const HLName &name, const Ref<Texture3D> &texture)
 	{
 		auto decl = FindResourceDeclaration(name);
 		if (!decl)
@@ -143,87 +143,87 @@ namespace highlo
 		m_Textures[slot] = texture;
 	}
 
-	float &MetalMaterial::GetFloat(const HLString &name)
+	float &MetalMaterial::GetFloat(const HLName &name)
 	{
 		return Get<float>(name);
 	}
 	
-	int32 &MetalMaterial::GetInt(const HLString &name)
+	int32 &MetalMaterial::GetInt(const HLName &name)
 	{
 		return Get<int32>(name);
 	}
 	
-	uint32 &MetalMaterial::GetUInt(const HLString &name)
+	uint32 &MetalMaterial::GetUInt(const HLName &name)
 	{
 		return Get<uint32>(name);
 	}
 	
-	bool &MetalMaterial::GetBool(const HLString &name)
+	bool &MetalMaterial::GetBool(const HLName &name)
 	{
 		return Get<bool>(name);
 	}
 	
-	glm::vec2 &MetalMaterial::GetVector2(const HLString &name)
+	glm::vec2 &MetalMaterial::GetVector2(const HLName &name)
 	{
 		return Get<glm::vec2>(name);
 	}
 	
-	glm::vec3 &MetalMaterial::GetVector3(const HLString &name)
+	glm::vec3 &MetalMaterial::GetVector3(const HLName &name)
 	{
 		return Get<glm::vec3>(name);
 	}
 	
-	glm::vec4 &MetalMaterial::GetVector4(const HLString &name)
+	glm::vec4 &MetalMaterial::GetVector4(const HLName &name)
 	{
 		return Get<glm::vec4>(name);
 	}
 	
-	glm::ivec2 &MetalMaterial::GetIVector2(const HLString &name)
+	glm::ivec2 &MetalMaterial::GetIVector2(const HLName &name)
 	{
 		return Get<glm::ivec2>(name);
 	}
 	
-	glm::ivec3 &MetalMaterial::GetIVector3(const HLString &name)
+	glm::ivec3 &MetalMaterial::GetIVector3(const HLName &name)
 	{
 		return Get<glm::ivec3>(name);
 	}
 	
-	glm::ivec4 &MetalMaterial::GetIVector4(const HLString &name)
+	glm::ivec4 &MetalMaterial::GetIVector4(const HLName &name)
 	{
 		return Get<glm::ivec4>(name);
 	}
 	
-	glm::mat2 &MetalMaterial::GetMatrix2(const HLString &name)
+	glm::mat2 &MetalMaterial::GetMatrix2(const HLName &name)
 	{
 		return Get<glm::mat2>(name);
 	}
 	
-	glm::mat3 &MetalMaterial::GetMatrix3(const HLString &name)
+	glm::mat3 &MetalMaterial::GetMatrix3(const HLName &name)
 	{
 		return Get<glm::mat3>(name);
 	}
 	
-	glm::mat4 &MetalMaterial::GetMatrix4(const HLString &name)
+	glm::mat4 &MetalMaterial::GetMatrix4(const HLName &name)
 	{
 		return Get<glm::mat4>(name);
 	}
 	
-	Ref<Texture2D> MetalMaterial::GetTexture2D(const HLString &name)
+	Ref<Texture2D> MetalMaterial::GetTexture2D(const HLName &name)
 	{
 		return GetResource<Texture2D>(name);
 	}
 	
-	Ref<Texture3D> MetalMaterial::GetTexture3D(const HLString &name)
+	Ref<Texture3D> MetalMaterial::GetTexture3D(const HLName &name)
 	{
 		return GetResource<Texture3D>(name);
 	}
 	
-	Ref<Texture2D> MetalMaterial::TryGetTexture2D(const HLString &name)
+	Ref<Texture2D> MetalMaterial::TryGetTexture2D(const HLName &name)
 	{
 		return TryGetResource<Texture2D>(name);
 	}
 	
-	Ref<Texture3D> MetalMaterial::TryGetTexture3D(const HLString &name)
+	Ref<Texture3D> MetalMaterial::TryGetTexture3D(const HLName &name)
 	{
 		return TryGetResource<Texture3D>(name);
 	}
@@ -276,37 +276,52 @@ namespace highlo
 	
 	void MetalMaterial::OnShaderReloaded()
 	{
+		m_UniformDeclarations.clear();
+		m_ResourceDeclarations.clear();
 	}
 	
-	const ShaderUniform *MetalMaterial::FindUniformDeclaration(const HLString &name)
+	const ShaderUniform *MetalMaterial::FindUniformDeclaration(const HLName &name)
 	{
-		const auto &shaderBuffers = m_Shader->GetShaderBuffers();
+		// Misses are cached as well, the cache is cleared when the shader is reloaded
+		auto cached = m_UniformDeclarations.find(name);
+		if (cached != m_UniformDeclarations.end())
+			return cached->second;
 
-		if (shaderBuffers.size() > 0)
+		const ShaderUniform *result = nullptr;
+		const auto &shaderBuffers = m_Shader->GetShaderBuffers();
+		for (const auto &[n, buffer] : shaderBuffers)
 		{
-			for (const auto &[n, buffer] : shaderBuffers)
+			auto uniform = buffer.Uniforms.find(name.GetString());
+			if (uniform != buffer.Uniforms.end())
 			{
-				if (buffer.Uniforms.find(name) != buffer.Uniforms.end())
-				{
-					return &buffer.Uniforms.at(name);
-				}
+				result = &uniform->second;
+				break;
 			}
 		}
 
-		return nullptr;
+		m_UniformDeclarations[name] = result;
+		return result;
 	}
 	
-	const ShaderResourceDeclaration *MetalMaterial::FindResourceDeclaration(const HLString &name)
+	const ShaderResourceDeclaration *MetalMaterial::FindResourceDeclaration(const HLName &name)
 	{
+		auto cached = m_ResourceDeclarations.find(name);
+		if (cached != m_ResourceDeclarations.end())
+			return cached->second;
+
+		const ShaderResourceDeclaration *result = nullptr;
 		auto &resources = m_Shader->GetResources();
 		for (const auto &[n, resource] : resources)
 		{
-			if (resource.GetName() == name)
-				return &resource;
+			if (resource.GetName() == name.GetString())
+			{
+				result = &resource;
+				break;
+			}
 		}
 
-
-		return nullptr;
+		m_ResourceDeclarations[name] = result;
+		return result;
 	}
 }
 
@@ -23,7 +23,7 @@ namespace highlo
 
 		virtual void Invalidate() override;
 
-		virtual bool Has(const HLString &name) override
+		virtual bool Has(const HLName &name) override
 		{
 			const ShaderUniform *decl = FindUniformDeclaration(name);
 			const ShaderUniform *resource = FindUniformDeclaration(name);
@@ -36,7 +36,7 @@ namespace highlo
 
 		// Setters
 		template<typename T>
-		void Set(const HLString &name, const T &value)
+		void Set(const HLName &name, const T &value)
 		{
 			auto decl = FindUniformDeclaration(name);
 			HL_ASSERT(decl);
@@ -47,7 +47,7 @@ namespace highlo
 			buffer.Write((Byte *)&value, decl->GetSize(), decl->GetOffset());
 		}
 
-		void Set(const HLString &name, const Ref<Texture> &texture)
+		void Set(const HLName &name, const Ref<Texture> &texture)
 		{
 			auto decl = FindResourceDeclaration(name);
 			if (!decl)
@@ -62,27 +62,27 @@ namespace highlo
 			m_Textures[slot] = texture;
 		}
 
-		virtual void Set(const HLString &name, float value) override;
-		virtual void Set(const HLString &name, int32 value)  override;
-		virtual void Set(const HLString &name, uint32 value) override;
-		virtual void Set(const HLString &name, bool value)  override;
-		virtual void Set(const HLString &name, const glm::vec2 &value) override;
-		virtual void Set(const HLString &name, const glm::vec3 &value) override;
-		virtual void Set(const HLString &name, const glm::vec4 &value) override;
-		virtual void Set(const HLString &name, const glm::ivec2 &value) override;
-		virtual void Set(const HLString &name, const glm::ivec3 &value) override;
-		virtual void Set(const HLString &name, const glm::ivec4 &value) override;
-		virtual void Set(const HLString &name, const glm::mat2 &value) override;
-		virtual void Set(const HLString &name, const glm::mat3 &value) override;
-		virtual void Set(const HLString &name, const glm::mat4 &value) override;
-
-		virtual void Set(const HLString &name, const Ref<Texture2D> &texture) override;
-		virtual void Set(const HLString &name, const Ref<Texture3D> &texture) override;
-		virtual void Set(const HLString &name, const Ref<Texture2D> &texture, uint32 slot) override;
+		virtual void Set(const HLName &name, float value) override;
+		virtual void Set(const HLName &name, int32 value)  override;
+		virtual void Set(const HLName &name, uint32 value) override;
+		virtual void Set(const HLName &name, bool value)  override;
+		virtual void Set(const HLName &name, const glm::vec2 &value) override;
+		virtual void Set(const HLName &name, const glm::vec3 &value) override;
+		virtual void Set(const HLName &name, const glm::vec4 &value) override;
+		virtual void Set(const HLName &name, const glm::ivec2 &value) override;
+		virtual void Set(const HLName &name, const glm::ivec3 &value) override;
+		virtual void Set(const HLName &name, const glm::ivec4 &value) override;
+		virtual void Set(const HLName &name, const glm::mat2 &value) override;
+		virtual void Set(const HLName &name, const glm::mat3 &value) override;
+		virtual void Set(const HLName &name, const glm::mat4 &value) override;
+
+		virtual void Set(const HLName &name, const Ref<Texture2D> &texture) override;
+		virtual void Set(const HLName &name, const Ref<Texture3D> &texture) override;
+		virtual void Set(const HLName &name, const Ref<Texture2D> &texture, uint32 slot) override;
 
 		// Getters
 		template<typename T>
-		T &Get(const HLString &name)
+		T &Get(const HLName &name)
 		{
 			auto decl = FindUniformDeclaration(name);
 			HL_ASSERT(decl);
@@ -92,7 +92,7 @@ namespace highlo
 		}
 
 		template<typename T>
-		Ref<T> GetResource(const HLString &name)
+		Ref<T> GetResource(const HLName &name)
 		{
 			auto decl = FindResourceDeclaration(name);
 			HL_ASSERT(decl);
@@ -104,7 +104,7 @@ namespace highlo
 		}
 
 		template<typename T>
-		Ref<T> TryGetResource(const HLString &name)
+		Ref<T> TryGetResource(const HLName &name)
 		{
 			auto decl = FindResourceDeclaration(name);
 			if (!decl)
@@ -117,25 +117,25 @@ namespace highlo
 			return Ref<T>(m_Textures[slot]);
 		}
 
-		virtual float &GetFloat(const HLString &name) override;
-		virtual int32 &GetInt(const HLString &name) override;
-		virtual uint32 &GetUInt(const HLString &name) override;
-		virtual bool &GetBool(const HLString &name) override;
-		virtual glm::vec2 &GetVector2(const HLString &name) override;
-		virtual glm::vec3 &GetVector3(const HLString &name) override;
-		virtual glm::vec4 &GetVector4(const HLString &name) override;
-		virtual glm::ivec2 &GetIVector2(const HLString &name) override;
-		virtual glm::ivec3 &GetIVector3(const HLString &name) override;
-		virtual glm::ivec4 &GetIVector4(const HLString &name) override;
-		virtual glm::mat2 &GetMatrix2(const HLString &name) override;
-		virtual glm::mat3 &GetMatrix3(const HLString &name) override;
-		virtual glm::mat4 &GetMatrix4(const HLString &name) override;
-
-		virtual Ref<Texture2D> GetTexture2D(const HLString &name) override;
-		virtual Ref<Texture3D> GetTexture3D(const HLString &name) override;
-
-		virtual Ref<Texture2D> TryGetTexture2D(const HLString &name) override;
-		virtual Ref<Texture3D> TryGetTexture3D(const HLString &name) override;
+		virtual float &GetFloat(const HLName &name) override;
+		virtual int32 &GetInt(const HLName &name) override;
+		virtual uint32 &GetUInt(const HLName &name) override;
+		virtual bool &GetBool(const HLName &name) override;
+		virtual glm::vec2 &GetVector2(const HLName &name) override;
+		virtual glm::vec3 &GetVector3(const HLName &name) override;
+		virtual glm::vec4 &GetVector4(const HLName &name) override;
+		virtual glm::ivec2 &GetIVector2(const HLName &name) override;
+		virtual glm::ivec3 &GetIVector3(const HLName &name) override;
+		virtual glm::ivec4 &GetIVector4(const HLName &name) override;
+		virtual glm::mat2 &GetMatrix2(const HLName &name) override;
+		virtual glm::mat3 &GetMatrix3(const HLName &name) override;
+		virtual glm::mat4 &GetMatrix4(const HLName &name) override;
+
+		virtual Ref<Texture2D> GetTexture2D(const HLName &name) override;
+		virtual Ref<Texture3D> GetTexture3D(const HLName &name) override;
+
+		virtual Ref<Texture2D> TryGetTexture2D(const HLName &name) override;
+		virtual Ref<Texture3D> TryGetTexture3D(const HLName &name) override;
 
 		virtual uint32 GetFlags() const override { return m_Flags; }
 		virtual bool GetFlag(MaterialFlag flag) const override;
@@ -153,12 +153,14 @@ namespace highlo
 		void AllocateStorage();
 		void OnShaderReloaded();
 
-		const ShaderUniform *FindUniformDeclaration(const HLString &name);
-		const ShaderResourceDeclaration *FindResourceDeclaration(const HLString &name);
+		const ShaderUniform *FindUniformDeclaration(const HLName &name);
+		const ShaderResourceDeclaration *FindResourceDeclaration(const HLName &name);
 
 	private:
 
 		HLString m_Name;
+		std::unordered_map<HLName, const ShaderUniform*> m_UniformDeclarations;
+		std::unordered_map<HLName, const ShaderResourceDeclaration*> m_ResourceDeclarations;
 		Ref<Shader> m_Shader;
 		uint32 m_Flags = 0;
 
@@ -125,7 +125,9 @@ namespace highlo
 		const Ref<MaterialTable> &materials, 
 		const TransformVertexData *transformBuffer, 
 		uint32 transformBufferOffset, 
-		uint32 instanceCount)
+		uint32 instanceCount,
+		uint32 boneTransformOffset,
+		uint32 boneTransformStride)
 	{
 	}
 	
@@ -48,72 +48,72 @@ namespace highlo
 	{
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, float value)
+	void OpenGLMaterial::Set(const HLName &name, float value)
 	{
 		Set<float>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, int32 value)
+	void OpenGLMaterial::Set(const HLName &name, int32 value)
 	{
 		Set<int32>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, uint32 value)
+	void OpenGLMaterial::Set(const HLName &name, uint32 value)
 	{
 		Set<uint32>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, bool value)
+	void OpenGLMaterial::Set(const HLName &name, bool value)
 	{
 		Set<bool>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::vec2 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::vec2 &value)
 	{
 		Set<glm::vec2>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::vec3 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::vec3 &value)
 	{
 		Set<glm::vec3>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::vec4 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::vec4 &value)
 	{
 		Set<glm::vec4>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::ivec2 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::ivec2 &value)
 	{
 		Set<glm::ivec2>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::ivec3 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::ivec3 &value)
 	{
 		Set<glm::ivec3>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::ivec4 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::ivec4 &value)
 	{
 		Set<glm::ivec4>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::mat2 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::mat2 &value)
 	{
 		Set<glm::mat2>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::mat3 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::mat3 &value)
 	{
 		Set<glm::mat3>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const glm::mat4 &value)
+	void OpenGLMaterial::Set(const HLName &name, const glm::mat4 &value)
 	{
 		Set<glm::mat4>(name, value);
 	}
 	
-	void OpenGLMaterial::Set(const HLString &name, const Ref<Texture2D> &texture)
+	void OpenGLMaterial::Set(const HLName &name, const Ref<Texture2D> &texture)
 	{
 		auto decl = FindResourceDeclaration(name);
 		if (!decl)
@@ -126,7 +126,7 @@ namespace highlo
 		m_Texture2Ds[slot] = texture;
 	}
 
-	void OpenGLMaterial::Set(const HLString &name, const Ref<Texture2D> &texture, uint32 slot)
+	void OpenGLMaterial::Set(const HLName &name, const Ref<Texture2D> &texture, uint32 slot)
 	{
 		auto decl = FindResourceDeclaration(name);
 		if (!decl)
@@ -138,7 +138,7 @@ namespace highlo
 		m_Texture2Ds[slot] = texture;
 	}
 
-	void OpenGLMaterial::Set(const HLString &name, const Ref<Texture3D> &texture)
+	void OpenGLMaterial::Set(const HLName &name, const Ref<Texture3D> &texture)
 	{
 		auto decl = FindResourceDeclaration(name);
 		if (!decl)
@@ -154,87 +154,87 @@ namespace highlo
 		m_Textures[slot] = texture;
 	}
 	
-	float &OpenGLMaterial::GetFloat(const HLString &name)
+	float &OpenGLMaterial::GetFloat(const HLName &name)
 	{
 		return Get<float>(name);
 	}
 	
-	int32 &OpenGLMaterial::GetInt(const HLString &name)
+	int32 &OpenGLMaterial::GetInt(const HLName &name)
 	{
 		return Get<int32>(name);
 	}
 	
-	uint32 &OpenGLMaterial::GetUInt(const HLString &name)
+	uint32 &OpenGLMaterial::GetUInt(const HLName &name)
 	{
 		return Get<uint32>(name);
 	}
 
-	bool &OpenGLMaterial::GetBool(const HLString &name)
+	bool &OpenGLMaterial::GetBool(const HLName &name)
 	{
 		return Get<bool>(name);
 	}
 	
-	glm::vec2 &OpenGLMaterial::GetVector2(const HLString &name)
+	glm::vec2 &OpenGLMaterial::GetVector2(const HLName &name)
 	{
 		return Get<glm::vec2>(name);
 	}
 	
-	glm::vec3 &OpenGLMaterial::GetVector3(const HLString &name)
+	glm::vec3 &OpenGLMaterial::GetVector3(const HLName &name)
 	{
 		return Get<glm::vec3>(name);
 	}
 	
-	glm::vec4 &OpenGLMaterial::GetVector4(const HLString &name)
+	glm::vec4 &OpenGLMaterial::GetVector4(const HLName &name)
 	{
 		return Get<glm::vec4>(name);
 	}
 	
-	glm::ivec2 &OpenGLMaterial::GetIVector2(const HLString &name)
+	glm::ivec2 &OpenGLMaterial::GetIVector2(const HLName &name)
 	{
 		return Get<glm::ivec2>(name);
 	}
 	
-	glm::ivec3 &OpenGLMaterial::GetIVector3(const HLString &name)
+	glm::ivec3 &OpenGLMaterial::GetIVector3(const HLName &name)
 	{
 		return Get<glm::ivec3>(name);
 	}
 	
-	glm::ivec4 &OpenGLMaterial::GetIVector4(const HLString &name)
+	glm::ivec4 &OpenGLMaterial::GetIVector4(const HLName &name)
 	{
 		return Get<glm::ivec4>(name);
 	}
 	
-	glm::mat2 &OpenGLMaterial::GetMatrix2(const HLString &name)
+	glm::mat2 &OpenGLMaterial::GetMatrix2(const HLName &name)
 	{
 		return Get<glm::mat2>(name);
 	}
 	
-	glm::mat3 &OpenGLMaterial::GetMatrix3(const HLString &name)
+	glm::mat3 &OpenGLMaterial::GetMatrix3(const HLName &name)
 	{
 		return Get<glm::mat3>(name);
 	}
 	
-	glm::mat4 &OpenGLMaterial::GetMatrix4(const HLString &name)
+	glm::mat4 &OpenGLMaterial::GetMatrix4(const HLName &name)
 	{
 		return Get<glm::mat4>(name);
 	}
 	
-	Ref<Texture2D> OpenGLMaterial::GetTexture2D(const HLString &name)
+	Ref<Texture2D> OpenGLMaterial::GetTexture2D(const HLName &name)
 	{
 		return GetResource<Texture2D>(name);
 	}
 	
-	Ref<Texture3D> OpenGLMaterial::GetTexture3D(const HLString &name)
+	Ref<Texture3D> OpenGLMaterial::GetTexture3D(const HLName &name)
 	{
 		return GetResource<Texture3D>(name);
 	}
 	
-	Ref<Texture2D> OpenGLMaterial::TryGetTexture2D(const HLString &name)
+	Ref<Texture2D> OpenGLMaterial::TryGetTexture2D(const HLName &name)
 	{
 		return TryGetResource<Texture2D>(name);
 	}
 	
-	Ref<Texture3D> OpenGLMaterial::TryGetTexture3D(const HLString &name)
+	Ref<Texture3D> OpenGLMaterial::TryGetTexture3D(const HLName &name)
 	{
 		return TryGetResource<Texture3D>(name);
 	}
@@ -407,39 +407,55 @@ namespace highlo
 
 	void OpenGLMaterial::OnShaderReloaded()
 	{
+		m_UniformDeclarations.clear();
+		m_ResourceDeclarations.clear();
+
 		// TODO
 		HL_CORE_INFO("Reloading material {0}", *m_Name);
 	}
 
-	const ShaderUniform *OpenGLMaterial::FindUniformDeclaration(const HLString &name)
+	const ShaderUniform *OpenGLMaterial::FindUniformDeclaration(const HLName &name)
 	{
-		const auto &shaderBuffers = m_Shader->GetShaderBuffers();
+		// Misses are cached as well, the cache is cleared when the shader is reloaded
+		auto cached = m_UniformDeclarations.find(name);
+		if (cached != m_UniformDeclarations.end())
+			return cached->second;
 
-		if (shaderBuffers.size() > 0)
+		const ShaderUniform *result = nullptr;
+		const auto &shaderBuffers = m_Shader->GetShaderBuffers();
+		for (const auto &[n, buffer] : shaderBuffers)
 		{
-			for (const auto &[n, buffer] : shaderBuffers)
+			auto uniform = buffer.Uniforms.find(name.GetString());
+			if (uniform != buffer.Uniforms.end())
 			{
-				if (buffer.Uniforms.find(name) != buffer.Uniforms.end())
-				{
-					return &buffer.Uniforms.at(name);
-				}
+				result = &uniform->second;
+				break;
 			}
 		}
 
-		return nullptr;
+		m_UniformDeclarations[name] = result;
+		return result;
 	}
 
-	const ShaderResourceDeclaration *OpenGLMaterial::FindResourceDeclaration(const HLString &name)
+	const ShaderResourceDeclaration *OpenGLMaterial::FindResourceDeclaration(const HLName &name)
 	{
+		auto cached = m_ResourceDeclarations.find(name);
+		if (cached != m_ResourceDeclarations.end())
+			return cached->second;
+
+		const ShaderResourceDeclaration *result = nullptr;
 		auto &resources = m_Shader->GetResources();
 		for (const auto &[n, resource] : resources)
 		{
-			if (resource.GetName() == name)
-				return &resource;
+			if (resource.GetName() == name.GetString())
+			{
+				result = &resource;
+				break;
+			}
 		}
 
-
-		return nullptr;
+		m_ResourceDeclarations[name] = result;
+		return result;
 	}
 }
 
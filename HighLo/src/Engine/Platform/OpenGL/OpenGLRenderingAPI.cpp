@@ -92,6 +92,12 @@ namespace highlo
 		glm::mat4 BoneTransform[100];
 	};
 
+	struct BoneTransformIndexUniformBuffer
+	{
+		uint32 Base;
+		uint32 BoneCount;
+	};
+
 	struct GLRendererData
 	{
 		Ref<VertexBuffer> FullscreenQuadVertexBuffer;
@@ -489,7 +495,9 @@ namespace highlo
 		const Ref<MaterialTable> &materials, 
 		const TransformVertexData *transformBuffer, 
 		uint32 transformBufferOffset, 
-		uint32 instanceCount)
+		uint32 instanceCount,
+		uint32 boneTransformOffset,
+		uint32 boneTransformStride)
 	{
 		model->Get()->GetVertexBuffer()->Bind();
 		va->Bind();
@@ -500,17 +508,19 @@ namespace highlo
 		Ref<UniformBuffer> objUB = UniformBuffer::Create(sizeof(TransformVertexData), 16, UniformLayout::GetTransformBufferLayout());
 		objUB->SetData(&objTransform, sizeof(objTransform));
 
-		if (model->IsAnimated())
+		Ref<UniformBuffer> boneIndexUB = nullptr;
+		if (model->IsAnimated() && storageBufferSet)
 		{
-			AnimatedBoneTransformUniformBuffer buffer;
-			auto &boneTransforms = model->GetBoneTransforms();
-			for (uint64 i = 0; boneTransforms.size(); ++i)
-			{
-				buffer.BoneTransform[i] = boneTransforms[i];
-			}
+			// The skinning palette of the frame has already been uploaded by the scene renderer,
+			// the instances only need to know where their bone transforms start
+			BoneTransformIndexUniformBuffer boneIndex = {};
+			boneIndex.Base = boneTransformOffset;
+			boneIndex.BoneCount = boneTransformStride;
 
-			Ref<UniformBuffer> ub = UniformBuffer::Create(sizeof(AnimatedBoneTransformUniformBuffer), 22, UniformLayout::GetAnimatedBoneTransformBufferLayout());
-			ub->SetData(&buffer, sizeof(buffer));
+			boneIndexUB = UniformBuffer::Create(sizeof(BoneTransformIndexUniformBuffer), 19, UniformLayout::GetBoneTransformIndexLayout());
+			boneIndexUB->SetData(&boneIndex, sizeof(boneIndex));
+
+			storageBufferSet->GetStorage(22, 0, Renderer::GetCurrentFrameIndex())->Bind();
 		}
 
 		auto &submeshes = model->Get()->GetSubmeshes();
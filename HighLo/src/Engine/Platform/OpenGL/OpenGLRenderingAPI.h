@@ -90,7 +90,9 @@ namespace highlo
 			const Ref<MaterialTable> &materials,
 			const TransformVertexData *transformBuffer,
 			uint32 transformBufferOffset,
-			uint32 instanceCount) override;
+			uint32 instanceCount,
+			uint32 boneTransformOffset,
+			uint32 boneTransformStride) override;
 
 		virtual void DrawInstancedStaticMeshWithMaterial(
 			const Ref<CommandBuffer> &renderCommandBuffer,
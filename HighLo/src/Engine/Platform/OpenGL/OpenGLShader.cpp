@@ -33,16 +33,6 @@ namespace highlo
 
 	namespace utils
 	{
-		static FileSystemPath GetCacheDirectory()
-		{
-			FileSystemPath path = "assets/cache/shaders/OpenGL/";
-
-			if (!FileSystem::Get()->FolderExists(path))
-				FileSystem::Get()->CreateFolder(path);
-
-			return path;
-		}
-
 		static const char *GLShaderStageCachedOpenGLFileExtension(uint32 stage)
 		{
 			switch (stage)
@@ -157,22 +147,6 @@ namespace highlo
 			return {};
 		}
 
-		static HLString ShaderStageCachedFileExtension(const GLenum stage)
-		{
-			switch (stage)
-			{
-				case GL_VERTEX_SHADER:			return ".cached_opengl.vert";
-				case GL_FRAGMENT_SHADER:		return ".cached_opengl.frag";
-				case GL_COMPUTE_SHADER:			return ".cached_opengl.comp";
-				case GL_TESS_CONTROL_SHADER:	return ".cached_opengl.tessconn";
-				case GL_TESS_EVALUATION_SHADER:	return ".cached_opengl.tessval";
-				case GL_GEOMETRY_SHADER:		return ".cached_opengl.geo";
-			}
-
-			HL_ASSERT(false);
-			return "";
-		}
-
 		static HLString ShaderStageToString(GLenum stage)
 		{
 			switch (stage)
@@ -501,10 +475,10 @@ namespace highlo
 			HL_CORE_TRACE(GL_SHADER_LOG_PREFIX "[+] Trying to create shader {0}... [+]", **m_AssetPath);
 
 			m_ShaderSources = PreProcess(source);
-			bool shaderCacheHasChanged = ShaderCache::HasChanged(m_AssetPath, source);
 
+			// The cached binaries are addressed by the source of each stage, so a changed source never finds an outdated binary
 			std::unordered_map<uint32, std::vector<uint32>> shaderData;
-			CompileOrGetOpenGLBinary(shaderData, forceCompile || shaderCacheHasChanged);
+			CompileOrGetOpenGLBinary(shaderData, forceCompile);
 			LoadAndCreateShaders(shaderData);
 			ReflectAllShaderStages(shaderData);
 
@@ -869,24 +843,6 @@ namespace highlo
 		return "unknown Language!";
 	}
 
-	void OpenGLShader::TryGetOpenGLCachedBinary(const FileSystemPath &cacheDirectory, const HLString &extension, std::unordered_map<GLenum, std::vector<uint32>> &outBinary, GLenum stage) const
-	{
-		FileSystemPath p = cacheDirectory / (m_AssetPath.Filename() + extension);
-
-		FILE *f = nullptr;
-		errno_t err = fopen_s(&f, **p, "rb");
-		if (err || !f)
-			return;
-
-		fseek(f, 0, SEEK_END);
-		uint64 size = ftell(f);
-		fseek(f, 0, SEEK_SET);
-
-		outBinary[stage] = std::vector<uint32>(size / sizeof(uint32));
-		fread(outBinary[stage].data(), sizeof(uint32), outBinary[stage].size(), f);
-		fclose(f);
-	}
-
 	void OpenGLShader::LoadAndCreateShaders(const std::unordered_map<GLenum, std::vector<uint32>> &shaderData)
 	{
 		if (m_RendererID)
@@ -982,17 +938,20 @@ namespace highlo
 	
 	void OpenGLShader::CompileOrGetOpenGLBinary(std::unordered_map<uint32, std::vector<uint32>> &shaderData, bool forceCompile)
 	{
-		FileSystemPath cacheDirectory = utils::GetCacheDirectory();
+		// Has to change together with the compile options in Compile()
+		uint64 optionsHash = 0;
+	#ifdef HL_RELEASE
+		optionsHash = 1;
+	#endif // HL_RELEASE
 
 		for (auto &[stage, source] : m_ShaderSources)
 		{
 			if (source.IsEmpty())
 				continue;
 
-			const HLString &extension = utils::ShaderStageCachedFileExtension(stage);
 			if (!forceCompile)
 			{
-				TryGetOpenGLCachedBinary(cacheDirectory, extension, shaderData, stage);
+				ShaderCache::TryGetBinary("OpenGL", stage, source, optionsHash, shaderData[stage]);
 			}
 
 			if (shaderData[stage].empty())
@@ -1001,24 +960,13 @@ namespace highlo
 				if (error.IsEmpty())
 				{
 					// Compile success
-					FileSystemPath p = cacheDirectory / (m_AssetPath.Filename() + extension);
-
-					FILE *f = nullptr;
-					errno_t fileError = fopen_s(&f, **p, "wb");
-					if (fileError || !f)
-					{
-						HL_CORE_ERROR(GL_SHADER_LOG_PREFIX "[-]     Failed to cache shader binary! [-]");
-						return;
-					}
-
-					fwrite(shaderData[stage].data(), sizeof(uint32), shaderData[stage].size(), f);
-					fclose(f);
+					ShaderCache::StoreBinary("OpenGL", stage, source, optionsHash, m_AssetPath, shaderData[stage]);
 				}
 				else
 				{
 					HL_CORE_ERROR("{0}", *error);
 
-					TryGetOpenGLCachedBinary(cacheDirectory, extension, shaderData, stage);
+					ShaderCache::TryGetLastGoodBinary("OpenGL", stage, m_AssetPath, shaderData[stage]);
 					if (shaderData[stage].empty())
 					{
 						HL_ASSERT(false, "Failed to compile shader and could not find any cached binary!");
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Moved the binary cache into the ShaderCache
 //     - 1.2 (2021-10-16) fixed indentations and added verification check whether the shader file exists
 //     - 1.1 (2021-09-15) Changed m_Name implementation
 //     - 1.0 (2021-09-14) initial release
@@ -82,7 +83,6 @@ namespace highlo
 		// Shader-compilation
 		HLString Compile(std::unordered_map<GLenum, std::vector<uint32>> &outputBinary, const GLenum stage) const;
 		void CompileOrGetOpenGLBinary(std::unordered_map<GLenum, std::vector<uint32>> &outBinary, bool forceCompile);
-		void TryGetOpenGLCachedBinary(const FileSystemPath &cacheDirectory, const HLString &extension, std::unordered_map<GLenum, std::vector<uint32>> &outBinary, GLenum stage) const;
 		void LoadAndCreateShaders(const std::unordered_map<GLenum, std::vector<uint32>> &shaderData);
 
 		void ParseConstantBuffers(const spirv_cross::CompilerGLSL &compiler);
@@ -12,6 +12,9 @@ namespace highlo
 	OpenGLStorageBuffer::OpenGLStorageBuffer(uint32 size, uint32 binding, const std::vector<UniformVariable> &layout)
 		: StorageBuffer(binding, layout), m_Size(size)
 	{
+		if (m_DataSize < size)
+			ResizeData(size);
+
 		glGenBuffers(1, &m_RendererID);
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_RendererID);
 		glBufferData(GL_SHADER_STORAGE_BUFFER, size, m_Data, GL_DYNAMIC_DRAW);
@@ -45,9 +48,12 @@ namespace highlo
 		if (size != m_Size)
 		{
 			m_Size = size;
+			ResizeData(size);
 
+			// The data store has to be re-allocated, glBufferSubData can not grow the buffer
 			glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_RendererID);
-			glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, m_Data);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, size, m_Data, GL_DYNAMIC_DRAW);
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_Binding, m_RendererID);
 		}
 	}
 }
@@ -10,6 +10,7 @@
 #include "Engine/Utils/ImageUtils.h"
 #include "Engine/Renderer/Renderer.h"
 #include "Engine/Core/FileSystem.h"
+#include "Engine/Loaders/TextureLoader.h"
 
 #include "OpenGLUtils.h"
 
@@ -20,8 +21,7 @@ namespace highlo
 	OpenGLTexture2D::OpenGLTexture2D(const FileSystemPath &filePath, bool flipOnLoad)
 		: m_FilePath(filePath)
 	{
-		int32 width, height, channels;
-		stbi_set_flip_vertically_on_load(flipOnLoad);
+		uint32 width, height;
 
 		if (!FileSystem::Get()->FileExists(filePath))
 		{
@@ -29,11 +29,10 @@ namespace highlo
 			return;
 		}
 
-		stbi_uc *data = stbi_load(*filePath.Absolute(), &width, &height, &channels, STBI_rgb_alpha);
-		if (!data)
+		// The pixels are always decoded with 4 channels, images without alpha get an opaque alpha channel
+		if (!TextureLoader::LoadRGBA(filePath, flipOnLoad, m_Buffer, width, height))
 		{
-			stbi_image_free(data);
-			HL_CORE_ERROR("{0}[-] Failed to load Texture2D: {1} (Error: {2}) [-]", TEXTURE2D_LOG_PREFIX, *filePath.String(), stbi_failure_reason());
+			HL_CORE_ERROR("{0}[-] Failed to load Texture2D: {1} [-]", TEXTURE2D_LOG_PREFIX, *filePath.String());
 			return;
 		}
 
@@ -41,25 +40,9 @@ namespace highlo
 		m_Loaded = true;
 		HL_CORE_INFO("{0}[+] Loaded {1} [+]", TEXTURE2D_LOG_PREFIX, *filePath.String());
 
-		if (channels == 4)
-		{
-			m_Buffer = Allocator::Copy(data, width * height * 4); // 4 byte per pixel
-			m_InternalFormat = utils::OpenGLTextureInternalFormat(TextureFormat::RGBA);
-			m_Specification.Format = TextureFormat::RGBA;
-			m_DataFormat = GL_RGBA;
-		}
-		else if (channels == 3)
-		{
-			m_Buffer = Allocator::Copy(data, width * height * 3); // 3 byte per pixel
-			m_InternalFormat = utils::OpenGLTextureInternalFormat(TextureFormat::RGB);
-			m_Specification.Format = TextureFormat::RG8;
-			m_DataFormat = GL_RGB;
-		}
-
-		HL_ASSERT(m_InternalFormat & m_DataFormat, "Format not supported!");
-
-		// Clean up loaded data because it has been copied into our own allocator
-		stbi_image_free(data);
+		m_InternalFormat = utils::OpenGLTextureInternalFormat(TextureFormat::RGBA);
+		m_Specification.Format = TextureFormat::RGBA;
+		m_DataFormat = GL_RGBA;
 
 		m_Specification.Width = width;
 		m_Specification.Height = height;
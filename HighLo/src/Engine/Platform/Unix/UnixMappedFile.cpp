@@ -0,0 +1,56 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Engine/Core/MappedFile.h"
+
+#if defined(HL_PLATFORM_UNIX) || defined(HL_PLATFORM_LINUX) || defined(HL_PLATFORM_MAC)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace highlo
+{
+	bool MappedFile::Map(const FileSystemPath &filePath, MappedFileAccess access)
+	{
+		int32 file = open(*filePath.String(), O_RDONLY | O_CLOEXEC);
+		if (file < 0)
+			return false;
+
+		struct stat fileInfo;
+		if (fstat(file, &fileInfo) != 0)
+		{
+			close(file);
+			return false;
+		}
+
+		m_Size = (uint64)fileInfo.st_size;
+		if (m_Size == 0)
+		{
+			// mmap rejects a length of 0
+			close(file);
+			m_Data = nullptr;
+			return true;
+		}
+
+		void *data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+
+		// The mapping stays valid after the descriptor has been closed
+		close(file);
+		if (data == MAP_FAILED)
+			return false;
+
+		madvise(data, m_Size, access == MappedFileAccess::Sequential ? MADV_SEQUENTIAL : MADV_NORMAL);
+		m_Data = (const Byte*)data;
+		return true;
+	}
+
+	void MappedFile::Unmap()
+	{
+		munmap((void*)m_Data, m_Size);
+	}
+}
+
+#endif // defined(HL_PLATFORM_UNIX) || defined(HL_PLATFORM_LINUX) || defined(HL_PLATFORM_MAC)
+
@@ -51,6 +51,10 @@ namespace highlo
     
     void VulkanMaterial::Invalidate()
     {
+        // The cached declarations point into the shader's reflection data, which is rebuilt on every reload
+        m_UniformDeclarations.clear();
+        m_ResourceDeclarations.clear();
+
         uint32 framesInFlight = Renderer::GetConfig().FramesInFlight;
         auto shader = m_Shader.As<VulkanShader>();
         if (shader->HasDescriptorSet(0))
@@ -64,167 +68,167 @@ namespace highlo
         }
     }
     
-    void VulkanMaterial::Set(const HLString &name, float value)
+    void VulkanMaterial::Set(const HLName &name, float value)
     {
         Set<float>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, int32 value)
+    void VulkanMaterial::Set(const HLName &name, int32 value)
     {
         Set<int32>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, uint32 value)
+    void VulkanMaterial::Set(const HLName &name, uint32 value)
     {
         Set<uint32>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, bool value)
+    void VulkanMaterial::Set(const HLName &name, bool value)
     {
         Set<bool>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::vec2 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::vec2 &value)
     {
         Set<glm::vec2>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::vec3 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::vec3 &value)
     {
         Set<glm::vec3>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::vec4 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::vec4 &value)
     {
         Set<glm::vec4>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::ivec2 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::ivec2 &value)
     {
         Set<glm::ivec2>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::ivec3 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::ivec3 &value)
     {
         Set<glm::ivec3>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::ivec4 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::ivec4 &value)
     {
         Set<glm::ivec4>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::mat2 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::mat2 &value)
     {
         Set<glm::mat2>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::mat3 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::mat3 &value)
     {
         Set<glm::mat3>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const glm::mat4 &value)
+    void VulkanMaterial::Set(const HLName &name, const glm::mat4 &value)
     {
         Set<glm::mat4>(name, value);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const Ref<Texture2D> &texture)
+    void VulkanMaterial::Set(const HLName &name, const Ref<Texture2D> &texture)
     {
         SetVulkanDescriptor(name, texture);
     }
 
-    void VulkanMaterial::Set(const HLString &name, const Ref<Texture2D> &texture, uint32 slot)
+    void VulkanMaterial::Set(const HLName &name, const Ref<Texture2D> &texture, uint32 slot)
     {
         SetVulkanDescriptor(name, texture, slot);
     }
     
-    void VulkanMaterial::Set(const HLString &name, const Ref<Texture3D> &texture)
+    void VulkanMaterial::Set(const HLName &name, const Ref<Texture3D> &texture)
     {
         SetVulkanDescriptor(name, texture);
     }
     
-    float &VulkanMaterial::GetFloat(const HLString &name)
+    float &VulkanMaterial::GetFloat(const HLName &name)
     {
         return Get<float>(name);
     }
     
-    int32 &VulkanMaterial::GetInt(const HLString &name)
+    int32 &VulkanMaterial::GetInt(const HLName &name)
     {
         return Get<int32>(name);
     }
     
-    uint32 &VulkanMaterial::GetUInt(const HLString &name)
+    uint32 &VulkanMaterial::GetUInt(const HLName &name)
     {
         return Get<uint32>(name);
     }
     
-    bool &VulkanMaterial::GetBool(const HLString &name)
+    bool &VulkanMaterial::GetBool(const HLName &name)
     {
         return Get<bool>(name);
     }
     
-    glm::vec2 &VulkanMaterial::GetVector2(const HLString &name)
+    glm::vec2 &VulkanMaterial::GetVector2(const HLName &name)
     {
         return Get<glm::vec2>(name);
     }
     
-    glm::vec3 &VulkanMaterial::GetVector3(const HLString &name)
+    glm::vec3 &VulkanMaterial::GetVector3(const HLName &name)
     {
         return Get<glm::vec3>(name);
     }
     
-    glm::vec4 &VulkanMaterial::GetVector4(const HLString &name)
+    glm::vec4 &VulkanMaterial::GetVector4(const HLName &name)
     {
         return Get<glm::vec4>(name);
     }
     
-    glm::ivec2 &VulkanMaterial::GetIVector2(const HLString &name)
+    glm::ivec2 &VulkanMaterial::GetIVector2(const HLName &name)
     {
         return Get<glm::ivec2>(name);
     }
     
-    glm::ivec3 &VulkanMaterial::GetIVector3(const HLString &name)
+    glm::ivec3 &VulkanMaterial::GetIVector3(const HLName &name)
     {
         return Get<glm::ivec3>(name);
     }
     
-    glm::ivec4 &VulkanMaterial::GetIVector4(const HLString &name)
+    glm::ivec4 &VulkanMaterial::GetIVector4(const HLName &name)
     {
         return Get<glm::ivec4>(name);
     }
     
-    glm::mat2 &VulkanMaterial::GetMatrix2(const HLString &name)
+    glm::mat2 &VulkanMaterial::GetMatrix2(const HLName &name)
     {
         return Get<glm::mat2>(name);
     }
     
-    glm::mat3 &VulkanMaterial::GetMatrix3(const HLString &name)
+    glm::mat3 &VulkanMaterial::GetMatrix3(const HLName &name)
     {
         return Get<glm::mat3>(name);
     }
     
-    glm::mat4 &VulkanMaterial::GetMatrix4(const HLString &name)
+    glm::mat4 &VulkanMaterial::GetMatrix4(const HLName &name)
     {
         return Get<glm::mat4>(name);
     }
     
-    Ref<Texture2D> VulkanMaterial::GetTexture2D(const HLString &name)
+    Ref<Texture2D> VulkanMaterial::GetTexture2D(const HLName &name)
     {
         return GetResource<Texture2D>(name);
     }
     
-    Ref<Texture3D> VulkanMaterial::GetTexture3D(const HLString &name)
+    Ref<Texture3D> VulkanMaterial::GetTexture3D(const HLName &name)
     {
         return GetResource<Texture3D>(name);
     }
     
-    Ref<Texture2D> VulkanMaterial::TryGetTexture2D(const HLString &name)
+    Ref<Texture2D> VulkanMaterial::TryGetTexture2D(const HLName &name)
     {
         return TryGetResource<Texture2D>(name);
     }
     
-    Ref<Texture3D> VulkanMaterial::TryGetTexture3D(const HLString &name)
+    Ref<Texture3D> VulkanMaterial::TryGetTexture3D(const HLName &name)
     {
         return TryGetResource<Texture3D>(name);
     }
@@ -368,7 +372,7 @@ namespace highlo
         InvalidateDescriptorSets();
     }
 
-    void VulkanMaterial::SetVulkanDescriptor(const HLString &name, const Ref<Texture2D> &texture)
+    void VulkanMaterial::SetVulkanDescriptor(const HLName &name, const Ref<Texture2D> &texture)
     {
         const ShaderResourceDeclaration *resource = FindResourceDeclaration(name);
         HL_ASSERT(resource);
@@ -401,7 +405,7 @@ namespace highlo
         InvalidateDescriptorSets();
     }
 
-    void VulkanMaterial::SetVulkanDescriptor(const HLString &name, const Ref<Texture2D> &texture, uint32 arrayIndex)
+    void VulkanMaterial::SetVulkanDescriptor(const HLName &name, const Ref<Texture2D> &texture, uint32 arrayIndex)
     {
         const ShaderResourceDeclaration *resource = FindResourceDeclaration(name);
         HL_ASSERT(resource);
@@ -443,7 +447,7 @@ namespace highlo
         InvalidateDescriptorSets();
     }
 
-    void VulkanMaterial::SetVulkanDescriptor(const HLString &name, const Ref<Texture3D> &texture)
+    void VulkanMaterial::SetVulkanDescriptor(const HLName &name, const Ref<Texture3D> &texture)
     {
         const ShaderResourceDeclaration *resource = FindResourceDeclaration(name);
         HL_ASSERT(resource);
@@ -476,30 +480,48 @@ namespace highlo
         InvalidateDescriptorSets();
     }
 
-    const ShaderUniform *VulkanMaterial::FindUniformDeclaration(const HLString &name)
+    const ShaderUniform *VulkanMaterial::FindUniformDeclaration(const HLName &name)
     {
+        // Misses are cached as well, the cache is cleared when the shader is reloaded
+        auto cached = m_UniformDeclarations.find(name);
+        if (cached != m_UniformDeclarations.end())
+            return cached->second;
+
+        const ShaderUniform *result = nullptr;
         const auto &shaderBuffers = m_Shader->GetShaderBuffers();
         for (const auto &[n, buffer] : shaderBuffers)
         {
-            if (buffer.Uniforms.find(name) != buffer.Uniforms.end())
+            auto uniform = buffer.Uniforms.find(name.GetString());
+            if (uniform != buffer.Uniforms.end())
             {
-                return &buffer.Uniforms.at(name);
+                result = &uniform->second;
+                break;
             }
         }
 
-        return nullptr;
+        m_UniformDeclarations[name] = result;
+        return result;
     }
 
-    const ShaderResourceDeclaration *VulkanMaterial::FindResourceDeclaration(const HLString &name)
+    const ShaderResourceDeclaration *VulkanMaterial::FindResourceDeclaration(const HLName &name)
     {
+        auto cached = m_ResourceDeclarations.find(name);
+        if (cached != m_ResourceDeclarations.end())
+            return cached->second;
+
+        const ShaderResourceDeclaration *result = nullptr;
         auto &resources = m_Shader->GetResources();
         for (const auto &[n, resource] : resources)
         {
-            if (resource.GetName() == name)
-                return &resource;
+            if (resource.GetName() == name.GetString())
+            {
+                result = &resource;
+                break;
+            }
         }
 
-        return nullptr;
+        m_ResourceDeclarations[name] = result;
+        return result;
     }
 }
 
@@ -27,7 +27,7 @@ namespace highlo
 
 		virtual void Invalidate() override;
 
-		virtual bool Has(const HLString &name) override
+		virtual bool Has(const HLName &name) override
 		{
 			const ShaderUniform *decl = FindUniformDeclaration(name);
 			const ShaderUniform *resource = FindUniformDeclaration(name);
@@ -40,7 +40,7 @@ namespace highlo
 
 		// Setters
 		template<typename T>
-		void Set(const HLString &name, const T &value)
+		void Set(const HLName &name, const T &value)
 		{
 			auto decl = FindUniformDeclaration(name);
 			HL_ASSERT(decl);
@@ -51,7 +51,7 @@ namespace highlo
 			buffer.Write((Byte*)&value, decl->GetSize(), decl->GetOffset());
 		}
 
-		void Set(const HLString &name, const Ref<Texture> &texture)
+		void Set(const HLName &name, const Ref<Texture> &texture)
 		{
 			auto decl = FindResourceDeclaration(name);
 			if (!decl)
@@ -68,7 +68,7 @@ namespace highlo
 
 		// Getters
 		template<typename T>
-		T &Get(const HLString &name)
+		T &Get(const HLName &name)
 		{
 			auto decl = FindUniformDeclaration(name);
 			HL_ASSERT(decl);
@@ -78,7 +78,7 @@ namespace highlo
 		}
 
 		template<typename T>
-		Ref<T> GetResource(const HLString &name)
+		Ref<T> GetResource(const HLName &name)
 		{
 			auto decl = FindResourceDeclaration(name);
 			HL_ASSERT(decl);
@@ -90,7 +90,7 @@ namespace highlo
 		}
 
 		template<typename T>
-		Ref<T> TryGetResource(const HLString &name)
+		Ref<T> TryGetResource(const HLName &name)
 		{
 			auto decl = FindResourceDeclaration(name);
 			if (!decl)
@@ -104,44 +104,44 @@ namespace highlo
 		}
 
 		// Setters
-		virtual void Set(const HLString &name, float value) override;
-		virtual void Set(const HLString &name, int32 value) override;
-		virtual void Set(const HLString &name, uint32 value) override;
-		virtual void Set(const HLString &name, bool value) override;
-		virtual void Set(const HLString &name, const glm::vec2 &value) override;
-		virtual void Set(const HLString &name, const glm::vec3 &value) override;
-		virtual void Set(const HLString &name, const glm::vec4 &value) override;
-		virtual void Set(const HLString &name, const glm::ivec2 &value) override;
-		virtual void Set(const HLString &name, const glm::ivec3 &value) override;
-		virtual void Set(const HLString &name, const glm::ivec4 &value) override;
-		virtual void Set(const HLString &name, const glm::mat2 &value) override;
-		virtual void Set(const HLString &name, const glm::mat3 &value) override;
-		virtual void Set(const HLString &name, const glm::mat4 &value) override;
-
-		virtual void Set(const HLString &name, const Ref<Texture2D> &texture) override;
-		virtual void Set(const HLString &name, const Ref<Texture2D> &texture, uint32 slot) override;
-		virtual void Set(const HLString &name, const Ref<Texture3D> &texture) override;
+		virtual void Set(const HLName &name, float value) override;
+		virtual void Set(const HLName &name, int32 value) override;
+		virtual void Set(const HLName &name, uint32 value) override;
+		virtual void Set(const HLName &name, bool value) override;
+		virtual void Set(const HLName &name, const glm::vec2 &value) override;
+		virtual void Set(const HLName &name, const glm::vec3 &value) override;
+		virtual void Set(const HLName &name, const glm::vec4 &value) override;
+		virtual void Set(const HLName &name, const glm::ivec2 &value) override;
+		virtual void Set(const HLName &name, const glm::ivec3 &value) override;
+		virtual void Set(const HLName &name, const glm::ivec4 &value) override;
+		virtual void Set(const HLName &name, const glm::mat2 &value) override;
+		virtual void Set(const HLName &name, const glm::mat3 &value) override;
+		virtual void Set(const HLName &name, const glm::mat4 &value) override;
+
+		virtual void Set(const HLName &name, const Ref<Texture2D> &texture) override;
+		virtual void Set(const HLName &name, const Ref<Texture2D> &texture, uint32 slot) override;
+		virtual void Set(const HLName &name, const Ref<Texture3D> &texture) override;
 
 		// Getters
-		virtual float &GetFloat(const HLString &name) override;
-		virtual int32 &GetInt(const HLString &name) override;
-		virtual uint32 &GetUInt(const HLString &name) override;
-		virtual bool &GetBool(const HLString &name) override;
-		virtual glm::vec2 &GetVector2(const HLString &name) override;
-		virtual glm::vec3 &GetVector3(const HLString &name) override;
-		virtual glm::vec4 &GetVector4(const HLString &name) override;
-		virtual glm::ivec2 &GetIVector2(const HLString &name) override;
-		virtual glm::ivec3 &GetIVector3(const HLString &name) override;
-		virtual glm::ivec4 &GetIVector4(const HLString &name) override;
-		virtual glm::mat2 &GetMatrix2(const HLString &name) override;
-		virtual glm::mat3 &GetMatrix3(const HLString &name) override;
-		virtual glm::mat4 &GetMatrix4(const HLString &name) override;
-
-		virtual Ref<Texture2D> GetTexture2D(const HLString &name) override;
-		virtual Ref<Texture3D> GetTexture3D(const HLString &name) override;
-
-		virtual Ref<Texture2D> TryGetTexture2D(const HLString &name) override;
-		virtual Ref<Texture3D> TryGetTexture3D(const HLString &name) override;
+		virtual float &GetFloat(const HLName &name) override;
+		virtual int32 &GetInt(const HLName &name) override;
+		virtual uint32 &GetUInt(const HLName &name) override;
+		virtual bool &GetBool(const HLName &name) override;
+		virtual glm::vec2 &GetVector2(const HLName &name) override;
+		virtual glm::vec3 &GetVector3(const HLName &name) override;
+		virtual glm::vec4 &GetVector4(const HLName &name) override;
+		virtual glm::ivec2 &GetIVector2(const HLName &name) override;
+		virtual glm::ivec3 &GetIVector3(const HLName &name) override;
+		virtual glm::ivec4 &GetIVector4(const HLName &name) override;
+		virtual glm::mat2 &GetMatrix2(const HLName &name) override;
+		virtual glm::mat3 &GetMatrix3(const HLName &name) override;
+		virtual glm::mat4 &GetMatrix4(const HLName &name) override;
+
+		virtual Ref<Texture2D> GetTexture2D(const HLName &name) override;
+		virtual Ref<Texture3D> GetTexture3D(const HLName &name) override;
+
+		virtual Ref<Texture2D> TryGetTexture2D(const HLName &name) override;
+		virtual Ref<Texture3D> TryGetTexture3D(const HLName &name) override;
 
 		virtual uint32 GetFlags() const override { return m_Flags; }
 		virtual bool GetFlag(MaterialFlag flag) const override;
@@ -166,12 +166,12 @@ namespace highlo
 		void AllocateStorage();
 		void OnShaderReloaded();
 
-		void SetVulkanDescriptor(const HLString &name, const Ref<Texture2D> &texture);
-		void SetVulkanDescriptor(const HLString &name, const Ref<Texture2D> &texture, uint32 arrayIndex);
-		void SetVulkanDescriptor(const HLString &name, const Ref<Texture3D> &texture);
+		void SetVulkanDescriptor(const HLName &name, const Ref<Texture2D> &texture);
+		void SetVulkanDescriptor(const HLName &name, const Ref<Texture2D> &texture, uint32 arrayIndex);
+		void SetVulkanDescriptor(const HLName &name, const Ref<Texture3D> &texture);
 
-		const ShaderUniform *FindUniformDeclaration(const HLString &name);
-		const ShaderResourceDeclaration *FindResourceDeclaration(const HLString &name);
+		const ShaderUniform *FindUniformDeclaration(const HLName &name);
+		const ShaderResourceDeclaration *FindResourceDeclaration(const HLName &name);
 
 	private:
 
@@ -208,6 +208,8 @@ namespace highlo
 
 		Ref<Shader> m_Shader;
 		HLString m_Name;
+		std::unordered_map<HLName, const ShaderUniform*> m_UniformDeclarations;
+		std::unordered_map<HLName, const ShaderResourceDeclaration*> m_ResourceDeclarations;
 		uint32 m_Flags = 0;
 
 		Allocator m_LocalData;
@@ -130,31 +130,6 @@ namespace highlo
             return ShaderLanguage::None;
         }
 
-        static FileSystemPath GetCacheDirectory()
-        {
-            FileSystemPath path = "assets/cache/shaders/Vulkan/";
-
-            if (!FileSystem::Get()->FolderExists(path))
-                FileSystem::Get()->CreateFolder(path);
-
-            return path;
-        }
-
-        static HLString ShaderStageCachedFileExtension(const VkShaderStageFlagBits stage)
-        {
-            switch (stage)
-            {
-                case VK_SHADER_STAGE_VERTEX_BIT:                    return ".cached_vulkan.vert";
-                case VK_SHADER_STAGE_FRAGMENT_BIT:                  return ".cached_vulkan.frag";
-                case VK_SHADER_STAGE_COMPUTE_BIT:                   return ".cached_vulkan.comp";
-                case VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT:      return ".cached_vulkan.tessconn";
-                case VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT:   return ".cached_vulkan.tessval";
-                case VK_SHADER_STAGE_GEOMETRY_BIT:                  return ".cached_vulkan.geo";
-            }
-
-            HL_ASSERT(false);
-            return "";
-        }
     }
 
     static std::unordered_map<uint32, std::unordered_map<uint32, VulkanShaderUniformBuffer*>> s_UniformBuffers;
@@ -856,18 +831,21 @@ namespace highlo
 
     void VulkanShader::CompileOrGetVulkanBinary(std::unordered_map<VkShaderStageFlagBits, std::vector<uint32>> &outBinary, bool forceCompile)
     {
-        FileSystemPath cacheDirectory = utils::GetCacheDirectory();
+        // Has to change together with the compile options in Compile()
+        uint64 optionsHash = 0;
+    #ifdef HL_RELEASE
+        optionsHash = 1;
+    #endif // HL_RELEASE
 
+        // The cached binaries are addressed by the source of each stage, so a changed source never finds an outdated binary
         for (auto &[stage, source] : m_ShaderSources)
         {
             if (source.IsEmpty())
                 continue;
 
-            bool shaderCacheHasChanged = ShaderCache::HasChanged(m_AssetPath, source);
-            const HLString &extension = utils::ShaderStageCachedFileExtension(stage);
-            if (!forceCompile && !shaderCacheHasChanged)
+            if (!forceCompile)
             {
-                TryGetVulkanCachedBinary(cacheDirectory, extension, outBinary, stage);
+                ShaderCache::TryGetBinary("Vulkan", (uint32)stage, source, optionsHash, outBinary[stage]);
             }
 
             if (outBinary[stage].empty())
@@ -876,21 +854,13 @@ namespace highlo
                 if (error.IsEmpty())
                 {
                     // Compile success
-                    FileSystemPath p = cacheDirectory / (m_AssetPath.Filename() + extension);
-                    
-                    FILE *f;
-                    errno_t error = fopen_s(&f, **p, "wb");
-                    if (error)
-                        HL_CORE_ERROR("Failed to cache shader binary!");
-
-                    fwrite(outBinary[stage].data(), sizeof(uint32), outBinary[stage].size(), f);
-                    fclose(f);
+                    ShaderCache::StoreBinary("Vulkan", (uint32)stage, source, optionsHash, m_AssetPath, outBinary[stage]);
                 }
                 else
                 {
                     HL_CORE_ERROR("{0}", *error);
 
-                    TryGetVulkanCachedBinary(cacheDirectory, extension, outBinary, stage);
+                    ShaderCache::TryGetLastGoodBinary("Vulkan", (uint32)stage, m_AssetPath, outBinary[stage]);
                     if (outBinary[stage].empty())
                     {
                         HL_ASSERT(false, "Failed to compile shader and could not find any cached binary");
@@ -904,24 +874,6 @@ namespace highlo
         }
     }
     
-    void VulkanShader::TryGetVulkanCachedBinary(const FileSystemPath &cacheDirectory, const HLString &extension, std::unordered_map<VkShaderStageFlagBits, std::vector<uint32>> &outBinary, VkShaderStageFlagBits stage) const
-    {
-        FileSystemPath p = cacheDirectory / (m_AssetPath.Filename() + extension);
-
-        FILE *f;
-        errno_t err = fopen_s(&f, **p, "rb");
-        if (err)
-            return;
-
-        fseek(f, 0, SEEK_END);
-        uint64 size = ftell(f);
-        fseek(f, 0, SEEK_SET);
-
-        outBinary[stage] = std::vector<uint32>(size / sizeof(uint32));
-        fread(outBinary[stage].data(), sizeof(uint32), outBinary[stage].size(), f);
-        fclose(f);
-    }
-    
     void VulkanShader::LoadAndCreateShaders(const std::unordered_map<VkShaderStageFlagBits, std::vector<uint32>> &shaderData)
     {
         VkDevice device = VulkanContext::GetCurrentDevice()->GetNativeDevice();
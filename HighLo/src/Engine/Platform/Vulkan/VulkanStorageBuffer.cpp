@@ -12,6 +12,9 @@ namespace highlo
     VulkanStorageBuffer::VulkanStorageBuffer(uint32 size, uint32 binding, const std::vector<UniformVariable> &layout)
         : StorageBuffer(binding, layout), m_Size(size)
     {
+        if (m_DataSize < size)
+            ResizeData(size);
+
         Invalidate();
     }
 
@@ -30,6 +33,7 @@ namespace highlo
     void VulkanStorageBuffer::Resize(uint32 size)
     {
         m_Size = size;
+        ResizeData(size);
         Invalidate();
     }
     
@@ -8,6 +8,7 @@
 #include <stb_image.h>
 
 #include "Engine/Utils/ImageUtils.h"
+#include "Engine/Loaders/TextureLoader.h"
 
 #include "VulkanUtils.h"
 
@@ -21,13 +22,10 @@ namespace highlo
         : m_FilePath(filePath)
     {
         // Load the actual image
-        int32 width, height;
+        uint32 width = 0, height = 0;
         HL_ASSERT(!stbi_is_hdr(**filePath), "Texture is not allowed to be a HDR Texture! Please use Texture3D instead.");
 
-        m_Buffer.Data = (Byte*)stbi_load(**filePath, &width, &height, nullptr, 4);
-        m_Buffer.Size = width * height * 4;
-
-        if (!m_Buffer.Data)
+        if (!TextureLoader::LoadRGBA(filePath, flipOnLoad, m_Buffer, width, height))
         {
             HL_CORE_ERROR(TEXTURE2D_LOG_PREFIX "[-] Could not load texture {0} [-]", **filePath);
             m_Loaded = false;
@@ -11,6 +11,7 @@
 #include <Shlobj.h>
 
 #include "Engine/Core/FileSystemWatcher.h"
+#include "Engine/Core/MappedFile.h"
 
 namespace highlo
 {
@@ -337,17 +338,12 @@ namespace highlo
 
     HLString FileSystem::ReadTextFile(const FileSystemPath &path)
     {
-        HANDLE file = utils::OpenFileInternal(path.String());
-        uint32 size = (uint32)utils::GetFileSizeInternal(file);
-
-        char *readBuffer = new char[size + 1];
-        readBuffer[size] = '\0';
-        bool success = utils::ReadFileInternal(file, &readBuffer[0], size);
-        HLString result = HLString(readBuffer);
-        delete[] readBuffer;
+        // The string is created right from the mapped file, so the content is copied only once
+        MappedFile file(path, MappedFileAccess::Sequential);
+        if (!file || file.GetSize() == 0)
+            return "";
 
-        CloseHandle(file);
-        return success ? result : "";
+        return HLString(file.GetText(), (uint32)file.GetSize());
     }
 
     bool FileSystem::WriteFile(const FileSystemPath &path, Byte *buffer, int64 size)
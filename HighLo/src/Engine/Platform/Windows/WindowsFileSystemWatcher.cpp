@@ -93,6 +93,7 @@ namespace highlo
 			FILE_NOTIFY_INFORMATION *pNotify;
 			int32 offset = 0;
 			HLString oldName;
+			FileSystemPath oldFilePath;
 
 			do
 			{
@@ -139,12 +140,14 @@ namespace highlo
 					{
 						HL_CORE_INFO(FILESYSTEMWATCHER_LOG_PREFIX "[+] SAVING OLD NAME: {0} [+]", *e.FilePath.Filename());
 						oldName = e.FilePath.Filename();
+						oldFilePath = e.FilePath;
 						break;
 					}
 
 					case FILE_ACTION_RENAMED_NEW_NAME:
 					{
 						e.OldName = oldName;
+						e.OldFilePath = oldFilePath;
 						e.NewName = e.FilePath.Filename();
 						e.Action = FileSystemAction::Renamed;
 						HL_CORE_INFO(FILESYSTEMWATCHER_LOG_PREFIX "[+] FILE RENAMED FROM {0} to {1} [+]", *e.OldName, **e.FilePath);
@@ -0,0 +1,56 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Engine/Core/MappedFile.h"
+
+#ifdef HL_PLATFORM_WINDOWS
+
+#include <Windows.h>
+
+namespace highlo
+{
+	bool MappedFile::Map(const FileSystemPath &filePath, MappedFileAccess access)
+	{
+		DWORD flags = FILE_ATTRIBUTE_NORMAL;
+		if (access == MappedFileAccess::Sequential)
+			flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+
+		HANDLE file = CreateFileW(filePath.String().W_Str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		m_Size = (uint64)size.QuadPart;
+		if (m_Size == 0)
+		{
+			// A mapping of an empty file can not be created
+			CloseHandle(file);
+			m_Data = nullptr;
+			return true;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		CloseHandle(file);
+		if (!mapping)
+			return false;
+
+		// The view keeps the mapping alive, so both handles can be closed right away
+		m_Data = (const Byte*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		return m_Data != nullptr;
+	}
+
+	void MappedFile::Unmap()
+	{
+		UnmapViewOfFile(m_Data);
+	}
+}
+
+#endif // HL_PLATFORM_WINDOWS
+
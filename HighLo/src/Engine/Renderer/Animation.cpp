@@ -6,6 +6,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/quaternion.hpp>
 
+#include "Engine/Core/Profiler/ProfilerTimer.h"
+
 namespace highlo
 {
 	Transform BoneTransform::GetLocalTransform()
@@ -55,72 +57,299 @@ namespace highlo
 		return result;
 	}
 
+	namespace utils
+	{
+		/// <summary>
+		/// Per-thread scratch memory for the pose evaluation.
+		/// The interpolation inputs are stored as structure-of-arrays, padded to a multiple of four bones.
+		/// </summary>
+		struct PoseScratchBuffer
+		{
+			enum Channel : uint32
+			{
+				FromTX = 0, FromTY, FromTZ,
+				ToTX, ToTY, ToTZ,
+				FromQX, FromQY, FromQZ, FromQW,
+				ToQX, ToQY, ToQZ, ToQW,
+				Progression,
+				ChannelCount
+			};
+
+			std::vector<float> Data;
+			std::vector<glm::mat4> GlobalTransforms;
+			AnimationLocalPose LocalPose;
+			uint32 Stride = 0;
+
+			void Resize(uint32 boneCount)
+			{
+				Stride = (boneCount + 3) & ~3u;
+				if (Data.size() < (uint64)Stride * ChannelCount)
+					Data.resize((uint64)Stride * ChannelCount);
+
+				if (GlobalTransforms.size() < boneCount)
+					GlobalTransforms.resize(boneCount);
+			}
+
+			float *Get(Channel channel)
+			{
+				return Data.data() + (uint64)channel * Stride;
+			}
+		};
+
+		static PoseScratchBuffer &GetPoseScratchBuffer()
+		{
+			static thread_local PoseScratchBuffer s_ScratchBuffer;
+			return s_ScratchBuffer;
+		}
+
+		/// <summary>
+		/// The offset matrix of a bone is the inverse of its global bind transform, so the local bind transform is the
+		/// offset matrix of the parent multiplied by the inverse offset matrix of the bone. Scale is not part of a local pose and is dropped.
+		/// </summary>
+		static void ComputeBindPose(const Skeleton &skeleton, const glm::mat4 &inverseTransform, AnimationLocalPose &outPose)
+		{
+			const uint32 boneCount = skeleton.GetBoneCount();
+			outPose.Resize(boneCount);
+
+			for (uint32 i = 0; i < boneCount; ++i)
+			{
+				int32 parentIndex = skeleton.ParentIndices[i];
+				glm::mat4 parentOffset = parentIndex < 0 ? glm::inverse(inverseTransform) : skeleton.OffsetMatrices[parentIndex];
+				glm::mat4 localTransform = parentOffset * glm::inverse(skeleton.OffsetMatrices[i]);
+
+				glm::mat3 rotation = glm::mat3(glm::normalize(glm::vec3(localTransform[0])), glm::normalize(glm::vec3(localTransform[1])), glm::normalize(glm::vec3(localTransform[2])));
+				outPose.SetBone(i, glm::vec3(localTransform[3]), glm::normalize(glm::quat_cast(rotation)));
+			}
+		}
+	}
+
 	Animation::Animation(const HLString &name, float duration, float ticksPerSecond, glm::mat4 inverseTransform, int32 bone_count, Bone rootBone, glm::mat4 correctionMatrix)
 		: Name(name), Duration(duration), TicksPerSecond(ticksPerSecond), m_InverseTransform(inverseTransform), m_RootBone(rootBone),
 		m_BoneCount((uint32)bone_count), m_CorrectionMatrix(correctionMatrix)
 	{
-		for (uint64 i = 0; i < HL_MAX_SKELETAL_BONES; i++)
-			m_BoneFrameTransforms[i] = glm::mat4(1.0f);
+		m_Skeleton = Skeleton::Build(m_RootBone);
+		utils::ComputeBindPose(m_Skeleton, m_InverseTransform, m_BindPose);
+		m_Pose.BoneTransforms.resize(HL_MAX_SKELETAL_BONES, glm::mat4(1.0f));
 	}
 
-	void Animation::CalculateFinalBoneTransforms(Bone &bone, glm::mat4 parentTransform, float animationTime)
+	void Animation::EvaluatePose(AnimationPose &pose) const
 	{
-		auto frames = GetPreviousAndNextFrames(bone, animationTime);
-		auto progression = CalculateProgression(bone, frames.first, frames.second, animationTime);
+		AnimationLocalPose &localPose = utils::GetPoseScratchBuffer().LocalPose;
+		SampleLocalPose(pose.Time, pose.KeyframeCursors, localPose);
+		ComposePose(localPose, pose.BoneTransforms);
+	}
 
-		// Sanity check
-		if (frames.first > bone.Keyframes.size() - 1)
-			frames.first = 0;
+	void Animation::SampleLocalPose(float time, std::vector<uint32> &keyframeCursors, AnimationLocalPose &outPose) const
+	{
+		const uint32 boneCount = m_Skeleton.GetBoneCount();
+
+		if (keyframeCursors.size() != boneCount)
+			keyframeCursors.assign(boneCount, 0);
+
+		if (outPose.BoneCount != boneCount)
+			outPose.Resize(boneCount);
+
+		if (boneCount == 0)
+			return;
+
+		utils::PoseScratchBuffer &scratch = utils::GetPoseScratchBuffer();
+		scratch.Resize(boneCount);
+
+		float *fromTX = scratch.Get(utils::PoseScratchBuffer::FromTX);
+		float *fromTY = scratch.Get(utils::PoseScratchBuffer::FromTY);
+		float *fromTZ = scratch.Get(utils::PoseScratchBuffer::FromTZ);
+		float *toTX = scratch.Get(utils::PoseScratchBuffer::ToTX);
+		float *toTY = scratch.Get(utils::PoseScratchBuffer::ToTY);
+		float *toTZ = scratch.Get(utils::PoseScratchBuffer::ToTZ);
+		float *fromQX = scratch.Get(utils::PoseScratchBuffer::FromQX);
+		float *fromQY = scratch.Get(utils::PoseScratchBuffer::FromQY);
+		float *fromQZ = scratch.Get(utils::PoseScratchBuffer::FromQZ);
+		float *fromQW = scratch.Get(utils::PoseScratchBuffer::FromQW);
+		float *toQX = scratch.Get(utils::PoseScratchBuffer::ToQX);
+		float *toQY = scratch.Get(utils::PoseScratchBuffer::ToQY);
+		float *toQZ = scratch.Get(utils::PoseScratchBuffer::ToQZ);
+		float *toQW = scratch.Get(utils::PoseScratchBuffer::ToQW);
+		float *progression = scratch.Get(utils::PoseScratchBuffer::Progression);
+
+		const float *bindTX = m_BindPose.Get(AnimationLocalPose::TranslationX);
+		const float *bindTY = m_BindPose.Get(AnimationLocalPose::TranslationY);
+		const float *bindTZ = m_BindPose.Get(AnimationLocalPose::TranslationZ);
+		const float *bindQX = m_BindPose.Get(AnimationLocalPose::RotationX);
+		const float *bindQY = m_BindPose.Get(AnimationLocalPose::RotationY);
+		const float *bindQZ = m_BindPose.Get(AnimationLocalPose::RotationZ);
+		const float *bindQW = m_BindPose.Get(AnimationLocalPose::RotationW);
+
+		// 1. Find the surrounding keyframes of every bone and gather them into the SoA buffers
+		for (uint32 i = 0; i < scratch.Stride; ++i)
+		{
+			uint32 keyCount = i < boneCount ? m_Skeleton.GetKeyframeCount(i) : 0;
+			if (keyCount == 0)
+			{
+				// Bones without keyframes stay at their bind pose, the padding lanes of the bind pose are identity transforms
+				fromTX[i] = toTX[i] = bindTX[i];
+				fromTY[i] = toTY[i] = bindTY[i];
+				fromTZ[i] = toTZ[i] = bindTZ[i];
+				fromQX[i] = toQX[i] = bindQX[i];
+				fromQY[i] = toQY[i] = bindQY[i];
+				fromQZ[i] = toQZ[i] = bindQZ[i];
+				fromQW[i] = toQW[i] = bindQW[i];
+				progression[i] = 0.0f;
+				continue;
+			}
 
-		if (frames.second > bone.Keyframes.size() - 1)
-			frames.second = 0;
+			const uint32 first = m_Skeleton.TrackOffsets[i];
+			const float *timestamps = &m_Skeleton.KeyTimestamps[first];
 
-		Transform current_pose = InterpolatePoses(bone.Keyframes[frames.first].Transform, bone.Keyframes[frames.second].Transform, progression);
-		glm::mat4 transform = parentTransform * current_pose.GetTransform();
+			// The cursor only moves forward, unless the animation time jumped back (looping, Stop())
+			uint32 &cursor = keyframeCursors[i];
+			if (cursor >= keyCount || timestamps[cursor] > time)
+				cursor = 0;
 
-		bone.FinalTransform = m_InverseTransform * transform * bone.OffsetMatrix;
+			while (cursor + 1 < keyCount && timestamps[cursor + 1] <= time)
+				++cursor;
 
-		for (auto &child : bone.Children)
-			CalculateFinalBoneTransforms(child, transform, animationTime);
+			uint32 previous = cursor;
+			uint32 next = HL_MIN(cursor + 1, keyCount - 1);
+
+			float totalTime = timestamps[next] - timestamps[previous];
+			float currentTime = time - timestamps[previous];
+			progression[i] = totalTime > 0.0f ? glm::clamp(currentTime / totalTime, 0.0f, 1.0f) : 0.0f;
+
+			const glm::vec3 &fromTranslation = m_Skeleton.KeyTranslations[first + previous];
+			const glm::vec3 &toTranslation = m_Skeleton.KeyTranslations[first + next];
+			const glm::quat &fromRotation = m_Skeleton.KeyRotations[first + previous];
+			const glm::quat &toRotation = m_Skeleton.KeyRotations[first + next];
+
+			fromTX[i] = fromTranslation.x; fromTY[i] = fromTranslation.y; fromTZ[i] = fromTranslation.z;
+			toTX[i] = toTranslation.x; toTY[i] = toTranslation.y; toTZ[i] = toTranslation.z;
+			fromQX[i] = fromRotation.x; fromQY[i] = fromRotation.y; fromQZ[i] = fromRotation.z; fromQW[i] = fromRotation.w;
+			toQX[i] = toRotation.x; toQY[i] = toRotation.y; toQZ[i] = toRotation.z; toQW[i] = toRotation.w;
+		}
+
+		// 2. Interpolate four bones at once
+		float *outTX = outPose.Get(AnimationLocalPose::TranslationX);
+		float *outTY = outPose.Get(AnimationLocalPose::TranslationY);
+		float *outTZ = outPose.Get(AnimationLocalPose::TranslationZ);
+		float *outQX = outPose.Get(AnimationLocalPose::RotationX);
+		float *outQY = outPose.Get(AnimationLocalPose::RotationY);
+		float *outQZ = outPose.Get(AnimationLocalPose::RotationZ);
+		float *outQW = outPose.Get(AnimationLocalPose::RotationW);
+
+		for (uint32 i = 0; i < scratch.Stride; i += 4)
+		{
+			__m128 t = _mm_loadu_ps(progression + i);
+
+			_mm_storeu_ps(outTX + i, Math::LerpSSE(_mm_loadu_ps(fromTX + i), _mm_loadu_ps(toTX + i), t));
+			_mm_storeu_ps(outTY + i, Math::LerpSSE(_mm_loadu_ps(fromTY + i), _mm_loadu_ps(toTY + i), t));
+			_mm_storeu_ps(outTZ + i, Math::LerpSSE(_mm_loadu_ps(fromTZ + i), _mm_loadu_ps(toTZ + i), t));
+
+			// Takes the shortest path, same as BoneTransform::Interpolate
+			__m128 x, y, z, w;
+			Math::NLerpQuatSSE(_mm_loadu_ps(fromQX + i), _mm_loadu_ps(fromQY + i), _mm_loadu_ps(fromQZ + i), _mm_loadu_ps(fromQW + i),
+							   _mm_loadu_ps(toQX + i), _mm_loadu_ps(toQY + i), _mm_loadu_ps(toQZ + i), _mm_loadu_ps(toQW + i),
+							   t, x, y, z, w);
+
+			_mm_storeu_ps(outQX + i, x);
+			_mm_storeu_ps(outQY + i, y);
+			_mm_storeu_ps(outQZ + i, z);
+			_mm_storeu_ps(outQW + i, w);
+		}
 	}
 
-	void Animation::AddBoneTransform(Bone &bone)
+	void Animation::ComposePose(const AnimationLocalPose &localPose, std::vector<glm::mat4> &outBoneTransforms) const
 	{
-		glm::mat4 boneFrameTransform = bone.UserTransformation * m_CorrectionMatrix * bone.FinalTransform;
+		const uint32 boneCount = m_Skeleton.GetBoneCount();
+		HL_ASSERT(localPose.BoneCount == boneCount);
+
+		if (outBoneTransforms.size() != HL_MAX_SKELETAL_BONES)
+			outBoneTransforms.resize(HL_MAX_SKELETAL_BONES, glm::mat4(1.0f));
+
+		utils::PoseScratchBuffer &scratch = utils::GetPoseScratchBuffer();
+		scratch.Resize(boneCount);
+
+		const float *tx = localPose.Get(AnimationLocalPose::TranslationX);
+		const float *ty = localPose.Get(AnimationLocalPose::TranslationY);
+		const float *tz = localPose.Get(AnimationLocalPose::TranslationZ);
+		const float *qx = localPose.Get(AnimationLocalPose::RotationX);
+		const float *qy = localPose.Get(AnimationLocalPose::RotationY);
+		const float *qz = localPose.Get(AnimationLocalPose::RotationZ);
+		const float *qw = localPose.Get(AnimationLocalPose::RotationW);
+
+		// Compose the local matrices and walk the hierarchy linearly, parents are always evaluated first
+		const glm::mat4 correctionAndInverse = m_CorrectionMatrix * m_InverseTransform;
+		for (uint32 i = 0; i < boneCount; ++i)
+		{
+			glm::mat4 localTransform = glm::mat4_cast(glm::quat(qw[i], qx[i], qy[i], qz[i]));
+			localTransform[3] = glm::vec4(tx[i], ty[i], tz[i], 1.0f);
 
-		if (!isnan(boneFrameTransform[0][0]))
-			m_BoneFrameTransforms[bone.ID] = boneFrameTransform;
+			int32 parentIndex = m_Skeleton.ParentIndices[i];
+			glm::mat4 &globalTransform = scratch.GlobalTransforms[i];
+			globalTransform = parentIndex < 0 ? localTransform : scratch.GlobalTransforms[parentIndex] * localTransform;
 
-		for (auto& child : bone.Children)
-			AddBoneTransform(child);
+			uint32 boneID = m_Skeleton.BoneIDs[i];
+			if (boneID >= HL_MAX_SKELETAL_BONES)
+				continue;
+
+			glm::mat4 boneFrameTransform = m_Skeleton.Bones[i]->UserTransformation * correctionAndInverse * globalTransform * m_Skeleton.OffsetMatrices[i];
+			if (!isnan(boneFrameTransform[0][0]))
+				outBoneTransforms[boneID] = boneFrameTransform;
+		}
+	}
+
+	void Animation::EvaluatePoses(const std::vector<AnimationEvaluationRequest> &requests, ThreadPool &threadPool)
+	{
+		HL_PROFILE_FUNCTION();
+
+		threadPool.ParallelFor((uint32)requests.size(), 4, [&requests](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+			{
+				const AnimationEvaluationRequest &request = requests[i];
+				if (request.Anim && request.Pose)
+					request.Anim->EvaluatePose(*request.Pose);
+			}
+		});
 	}
 
 	glm::mat4 *Animation::GetCurrentPoseTransforms()
 	{
+		if (m_Pose.BoneTransforms.size() != HL_MAX_SKELETAL_BONES)
+		{
+			m_Pose.BoneTransforms.resize(HL_MAX_SKELETAL_BONES, glm::mat4(1.0f));
+			m_PoseValid = false;
+		}
+
+		// Paused animations and multiple calls per frame don't have to evaluate the pose again
+		if (m_PoseValid && m_PoseWasPlaying == m_IsPlaying && (!m_IsPlaying || m_Pose.Time == CurrentAnimationTime))
+			return m_Pose.BoneTransforms.data();
+
+		m_PoseValid = true;
+		m_PoseWasPlaying = m_IsPlaying;
+		++m_PoseVersion;
+
 		if (m_IsPlaying)
 		{
-			CalculateFinalBoneTransforms(m_RootBone, glm::mat4(1.0f), CurrentAnimationTime);
-			AddBoneTransform(m_RootBone);
+			m_Pose.Time = CurrentAnimationTime;
+			EvaluatePose(m_Pose);
 		}
 		else
 		{
-			for (uint64 i = 0; i < m_BoneCount; i++)
-				m_BoneFrameTransforms[i] = m_CorrectionMatrix;
+			for (uint64 i = 0; i < m_BoneCount && i < HL_MAX_SKELETAL_BONES; i++)
+				m_Pose.BoneTransforms[i] = m_CorrectionMatrix;
 		}
 
-		return m_BoneFrameTransforms;
+		return m_Pose.BoneTransforms.data();
 	}
 
 	Bone *Animation::FindBone(const HLString &name)
 	{
-		Bone *result = nullptr;
-
-		ForEachBone(m_RootBone, [&name, &result](Bone &bone) {
-			if (bone.Name == (name))
-				result = &bone;
-		});
+		for (Bone *bone : m_Skeleton.Bones)
+		{
+			if (bone->Name == name)
+				return bone;
+		}
 
-		return result;
+		return nullptr;
 	}
 
 	void Animation::ForEachBone(Bone &bone, const std::function<void(Bone&)> &lambda)
@@ -136,41 +365,6 @@ namespace highlo
 		return Ref<Animation>::Create(name, duration, ticksPerSecond, inverseTransform, boneCount, rootBone, correctionMatrix);
 	}
 
-	std::pair<uint64, uint64> Animation::GetPreviousAndNextFrames(Bone &bone, float animationTime)
-	{
-		float previousFrame = bone.Keyframes[0].Timestamp;
-		float nextFrame = bone.Keyframes[0].Timestamp;
-
-		uint64 previousFrameIndex = 0;
-		uint64 nextFrameIndex = 0;
-
-		for (uint64 i = 1; i < bone.Keyframes.size(); i++)
-		{
-			nextFrame = bone.Keyframes[i].Timestamp;
-			nextFrameIndex = i;
-
-			if (nextFrame > animationTime)
-				break;
-
-			previousFrame = bone.Keyframes[i].Timestamp;
-			previousFrameIndex = i;
-		}
-
-		return { previousFrameIndex, nextFrameIndex };
-	}
-
-	float Animation::CalculateProgression(Bone &bone, uint64 previousFrameIndex, uint64 nextFrameIndex, float animationTime)
-	{
-		float totalTime = bone.Keyframes[nextFrameIndex].Timestamp - bone.Keyframes[previousFrameIndex].Timestamp;
-		float currentTime = animationTime - bone.Keyframes[previousFrameIndex].Timestamp;
-		return currentTime / totalTime;
-	}
-
-	Transform Animation::InterpolatePoses(BoneTransform previousPose, BoneTransform nextPose, float progression)
-	{
-		return BoneTransform::Interpolate(previousPose, nextPose, progression).GetLocalTransform();
-	}
-
 	void Animation::Play()
 	{
 		m_IsPlaying = true;
@@ -2,6 +2,10 @@
 
 //
 // version history:
+//     - 1.6 (2026-10-19) Added the bind pose, bones without keyframes now stay at their bind pose
+//     - 1.5 (2026-10-19) GetCurrentPoseTransforms only re-evaluates the pose if the animation state has changed
+//     - 1.4 (2026-10-19) Split the evaluation into SampleLocalPose and ComposePose, so that poses can be blended in between
+//     - 1.3 (2026-10-19) Evaluation is now based on a flat Skeleton with cached keyframe cursors, added batch evaluation of multiple poses
 //     - 1.2 (2021-10-21) added Create function and a const version of GetRootBone
 //     - 1.1 (2021-10-16) fixed indentations
 //     - 1.0 (2021-09-14) initial release
@@ -16,6 +20,10 @@
 #include "Engine/Core/Time.h"
 #include "Engine/Math/Math.h"
 #include "Engine/Math/Transform.h"
+#include "Engine/Threading/ThreadPool.h"
+
+#include "Skeleton.h"
+#include "AnimationPose.h"
 
 namespace highlo
 {
@@ -57,12 +65,23 @@ namespace highlo
 		Bone() = default;
 	};
 
+	class Animation;
+
+	struct AnimationEvaluationRequest
+	{
+		const Animation *Anim = nullptr;
+		AnimationPose *Pose = nullptr;
+	};
+
 	class Animation : public IsSharedReference
 	{
 	public:
 		HLAPI Animation() = default;
 		HLAPI Animation(const HLString &name, float duration, float ticksPerSecond, glm::mat4 inverseTransform, int32 boneCount, Bone rootBone, glm::mat4 correctionMatrix);
 
+		// The skeleton stores pointers into the bone hierarchy of this animation
+		HL_NON_COPYABLE(Animation);
+
 		HLString Name;
 
 		float Duration = 0;
@@ -81,8 +100,49 @@ namespace highlo
 		HLAPI void Stop();
 		HLAPI void Update(Timestep ts);
 
+		/// <summary>
+		/// Returns the skinning matrices of the current animation time, indexed by bone id.
+		/// The pose is only re-evaluated if the animation time or the playing state changed since the last call.
+		/// </summary>
 		HLAPI glm::mat4 *GetCurrentPoseTransforms();
 
+		/// <summary>
+		/// Is incremented every time GetCurrentPoseTransforms produces a new pose.
+		/// </summary>
+		HLAPI uint64 GetPoseVersion() const { return m_PoseVersion; }
+
+		/// <summary>
+		/// Forces the next call to GetCurrentPoseTransforms to evaluate the pose, needed after the user transformation of a bone has been changed.
+		/// </summary>
+		HLAPI void InvalidatePose() { m_PoseValid = false; }
+
+		/// <summary>
+		/// Samples the animation at pose.Time and writes the final bone transforms into pose.BoneTransforms.
+		/// The animation itself is not modified, so multiple poses can be evaluated in parallel.
+		/// </summary>
+		HLAPI void EvaluatePose(AnimationPose &pose) const;
+
+		/// <summary>
+		/// Samples the bone-local translations and rotations at the given time.
+		/// </summary>
+		HLAPI void SampleLocalPose(float time, std::vector<uint32> &keyframeCursors, AnimationLocalPose &outPose) const;
+
+		/// <summary>
+		/// Applies the bone hierarchy to a local pose and writes the final skinning matrices, indexed by bone id.
+		/// </summary>
+		HLAPI void ComposePose(const AnimationLocalPose &localPose, std::vector<glm::mat4> &outBoneTransforms) const;
+
+		/// <summary>
+		/// Returns the bone-local transforms of the bind pose, derived from the offset matrices when the skeleton is built.
+		/// Composing the bind pose results in skinning matrices, that leave the mesh unchanged.
+		/// </summary>
+		HLAPI const AnimationLocalPose &GetBindPose() const { return m_BindPose; }
+
+		/// <summary>
+		/// Evaluates all requested poses, distributed over the worker threads of the thread pool.
+		/// </summary>
+		HLAPI static void EvaluatePoses(const std::vector<AnimationEvaluationRequest> &requests, ThreadPool &threadPool = ThreadPool::Get());
+
 		HLAPI glm::mat4 &GetCorrectionMatrix() { return m_CorrectionMatrix; }
 		HLAPI const glm::mat4 &GetCorrectionMatrix() const { return m_CorrectionMatrix; }
 
@@ -92,6 +152,8 @@ namespace highlo
 		HLAPI Bone &GetRootBone() { return m_RootBone; }
 		HLAPI const Bone &GetRootBone() const { return m_RootBone; }
 
+		HLAPI const Skeleton &GetSkeleton() const { return m_Skeleton; }
+
 		HLAPI static Ref<Animation> Create(const HLString &name, float duration, float ticksPerSecond, glm::mat4 inverseTransform, int32 boneCount, Bone rootBone, glm::mat4 correctionMatrix);
 
 	private:
@@ -99,17 +161,15 @@ namespace highlo
 		glm::mat4 m_InverseTransform = glm::mat4(1.0f);
 		glm::mat4 m_CorrectionMatrix = glm::mat4(1.0f);
 		Bone m_RootBone = Bone();
+		Skeleton m_Skeleton;
+		AnimationLocalPose m_BindPose;
 		uint32 m_BoneCount = 0;
 		bool m_IsPlaying = false;
-		glm::mat4 m_BoneFrameTransforms[HL_MAX_SKELETAL_BONES];
-
-	private:
-
-		void CalculateFinalBoneTransforms(Bone &bone, glm::mat4 parentTransform, float animation_time);
-		void AddBoneTransform(Bone &bone);
+		AnimationPose m_Pose;
 
-		std::pair<uint64, uint64> GetPreviousAndNextFrames(Bone& bone, float animation_time);
-		float CalculateProgression(Bone& bone, uint64 previous_frame_index, uint64 next_frame_index, float animation_time);
-		Transform InterpolatePoses(BoneTransform previous_pose, BoneTransform next_pose, float progression);
+		// State of the last evaluation of m_Pose
+		bool m_PoseValid = false;
+		bool m_PoseWasPlaying = false;
+		uint64 m_PoseVersion = 0;
 	};
 }
@@ -0,0 +1,402 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AnimationClip.h"
+
+#include "Engine/Core/FileSystem.h"
+
+#define HL_ANIMATION_CLIP_MAGIC 0x4D494E41 // "ANIM"
+#define HL_ANIMATION_CLIP_VERSION 1
+
+namespace highlo
+{
+	struct AnimationClipHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 TrackCount;
+		uint32 KeyCount;
+		float Duration;
+		float TicksPerSecond;
+	};
+
+	struct AnimationClipTrack
+	{
+		glm::vec3 TranslationMin;
+		glm::vec3 TranslationExtent;
+		uint32 FirstKey;
+		uint32 KeyCount;
+	};
+
+	struct AnimationClipKey
+	{
+		uint16 Time;
+		uint16 Translation[3];
+		uint16 Rotation[3];
+	};
+
+	namespace utils
+	{
+		static constexpr float QuantizedRotationRange = 0.70710678118f; // 1 / sqrt(2)
+
+		static uint16 QuantizeUnit(float value, uint32 maxValue)
+		{
+			return (uint16)(glm::clamp(value, 0.0f, 1.0f) * (float)maxValue + 0.5f);
+		}
+
+		static void CompressRotation(const glm::quat &rotation, uint16 outRotation[3])
+		{
+			float components[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+			uint32 largestIndex = 0;
+			for (uint32 i = 1; i < 4; ++i)
+			{
+				if (glm::abs(components[i]) > glm::abs(components[largestIndex]))
+					largestIndex = i;
+			}
+
+			// q and -q represent the same rotation, so the largest component can always be reconstructed as positive
+			float sign = components[largestIndex] < 0.0f ? -1.0f : 1.0f;
+
+			uint16 quantized[3];
+			uint32 target = 0;
+			for (uint32 i = 0; i < 4; ++i)
+			{
+				if (i == largestIndex)
+					continue;
+
+				float normalized = (components[i] * sign / QuantizedRotationRange) * 0.5f + 0.5f;
+				quantized[target++] = QuantizeUnit(normalized, 0x7FFF);
+			}
+
+			// The index of the dropped component is stored in the highest bit of the first two values
+			outRotation[0] = quantized[0] | (uint16)((largestIndex & 1) << 15);
+			outRotation[1] = quantized[1] | (uint16)((largestIndex >> 1) << 15);
+			outRotation[2] = quantized[2];
+		}
+
+		static glm::quat DecompressRotation(const uint16 rotation[3])
+		{
+			uint32 largestIndex = (rotation[0] >> 15) | ((rotation[1] >> 15) << 1);
+
+			float values[3];
+			float sumOfSquares = 0.0f;
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				values[i] = ((float)(rotation[i] & 0x7FFF) / (float)0x7FFF * 2.0f - 1.0f) * QuantizedRotationRange;
+				sumOfSquares += values[i] * values[i];
+			}
+
+			float components[4];
+			uint32 source = 0;
+			for (uint32 i = 0; i < 4; ++i)
+			{
+				if (i == largestIndex)
+					components[i] = glm::sqrt(glm::max(0.0f, 1.0f - sumOfSquares));
+				else
+					components[i] = values[source++];
+			}
+
+			return glm::quat(components[3], components[0], components[1], components[2]);
+		}
+
+		static glm::quat NLerp(const glm::quat &a, glm::quat b, float t)
+		{
+			if (glm::dot(a, b) < 0.0f)
+				b = -b;
+
+			return glm::normalize(glm::quat(
+				glm::mix(a.w, b.w, t),
+				glm::mix(a.x, b.x, t),
+				glm::mix(a.y, b.y, t),
+				glm::mix(a.z, b.z, t)));
+		}
+
+		/// <summary>
+		/// Checks if all keyframes between first and last can be reconstructed by interpolating first and last.
+		/// </summary>
+		static bool CanRemoveKeyframes(const Skeleton &skeleton, uint32 offset, uint32 first, uint32 last, const AnimationCompressionSettings &settings)
+		{
+			const float startTime = skeleton.KeyTimestamps[offset + first];
+			const float totalTime = skeleton.KeyTimestamps[offset + last] - startTime;
+
+			for (uint32 i = first + 1; i < last; ++i)
+			{
+				float t = totalTime > 0.0f ? (skeleton.KeyTimestamps[offset + i] - startTime) / totalTime : 0.0f;
+
+				glm::vec3 translation = glm::mix(skeleton.KeyTranslations[offset + first], skeleton.KeyTranslations[offset + last], t);
+				if (glm::length(translation - skeleton.KeyTranslations[offset + i]) > settings.TranslationTolerance)
+					return false;
+
+				glm::quat rotation = NLerp(skeleton.KeyRotations[offset + first], skeleton.KeyRotations[offset + last], t);
+				float angle = 2.0f * glm::acos(glm::min(1.0f, glm::abs(glm::dot(rotation, skeleton.KeyRotations[offset + i]))));
+				if (angle > settings.RotationTolerance)
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	AnimationClip::AnimationClip(const Animation &animation, const AnimationCompressionSettings &settings)
+	{
+		const Skeleton &skeleton = animation.GetSkeleton();
+		const uint32 trackCount = skeleton.GetBoneCount();
+
+		// Select the keyframes that have to be kept, greedy error-bounded reduction per track
+		std::vector<std::vector<uint32>> keptKeyframes(trackCount);
+		uint32 keyCount = 0;
+
+		for (uint32 track = 0; track < trackCount; ++track)
+		{
+			const uint32 offset = skeleton.TrackOffsets[track];
+			const uint32 count = skeleton.GetKeyframeCount(track);
+			std::vector<uint32> &kept = keptKeyframes[track];
+
+			if (count > 0)
+			{
+				uint32 anchor = 0;
+				kept.push_back(anchor);
+
+				for (uint32 candidate = 2; candidate < count; ++candidate)
+				{
+					if (!utils::CanRemoveKeyframes(skeleton, offset, anchor, candidate, settings))
+					{
+						anchor = candidate - 1;
+						kept.push_back(anchor);
+					}
+				}
+
+				if (count > 1)
+					kept.push_back(count - 1);
+			}
+
+			keyCount += (uint32)kept.size();
+		}
+
+		uint32 dataSize = sizeof(AnimationClipHeader) + trackCount * sizeof(AnimationClipTrack) + keyCount * sizeof(AnimationClipKey);
+		m_Data.Allocate(dataSize);
+		m_Data.ZeroInitialize();
+
+		// BindData needs the track count to locate the keyframes
+		((AnimationClipHeader*)m_Data.Data)->TrackCount = trackCount;
+		BindData();
+
+		m_Header->Magic = HL_ANIMATION_CLIP_MAGIC;
+		m_Header->Version = HL_ANIMATION_CLIP_VERSION;
+		m_Header->TrackCount = trackCount;
+		m_Header->KeyCount = keyCount;
+		m_Header->Duration = animation.Duration;
+		m_Header->TicksPerSecond = animation.TicksPerSecond;
+
+		const float timeScale = animation.Duration > 0.0f ? 1.0f / animation.Duration : 0.0f;
+
+		uint32 nextKey = 0;
+		for (uint32 track = 0; track < trackCount; ++track)
+		{
+			const uint32 offset = skeleton.TrackOffsets[track];
+			const std::vector<uint32> &kept = keptKeyframes[track];
+
+			glm::vec3 translationMin = glm::vec3(MAX_FLOAT);
+			glm::vec3 translationMax = glm::vec3(MIN_FLOAT);
+			for (uint32 key : kept)
+			{
+				translationMin = glm::min(translationMin, skeleton.KeyTranslations[offset + key]);
+				translationMax = glm::max(translationMax, skeleton.KeyTranslations[offset + key]);
+			}
+
+			AnimationClipTrack &clipTrack = m_Tracks[track];
+			clipTrack.FirstKey = nextKey;
+			clipTrack.KeyCount = (uint32)kept.size();
+			clipTrack.TranslationMin = kept.empty() ? glm::vec3(0.0f) : translationMin;
+			clipTrack.TranslationExtent = kept.empty() ? glm::vec3(0.0f) : translationMax - translationMin;
+
+			for (uint32 key : kept)
+			{
+				AnimationClipKey &clipKey = m_Keys[nextKey++];
+				clipKey.Time = utils::QuantizeUnit(skeleton.KeyTimestamps[offset + key] * timeScale, 0xFFFF);
+
+				const glm::vec3 &translation = skeleton.KeyTranslations[offset + key];
+				for (uint32 i = 0; i < 3; ++i)
+				{
+					float extent = clipTrack.TranslationExtent[i];
+					clipKey.Translation[i] = extent > 0.0f ? utils::QuantizeUnit((translation[i] - clipTrack.TranslationMin[i]) / extent, 0xFFFF) : 0;
+				}
+
+				utils::CompressRotation(glm::normalize(skeleton.KeyRotations[offset + key]), clipKey.Rotation);
+			}
+		}
+	}
+
+	AnimationClip::AnimationClip(Allocator data)
+		: m_Data(data)
+	{
+		if (m_Data.Size < sizeof(AnimationClipHeader))
+		{
+			HL_CORE_ERROR("[-] Invalid animation clip: the data is too small [-]");
+			m_Data.Release();
+			SetFlag(AssetFlag::Invalid);
+			return;
+		}
+
+		// The counts are checked in 64 bits before BindData, so a corrupt header can not wrap the expected size around
+		const AnimationClipHeader *header = (const AnimationClipHeader*)m_Data.Data;
+		uint64 expectedSize = sizeof(AnimationClipHeader) + (uint64)header->TrackCount * sizeof(AnimationClipTrack) + (uint64)header->KeyCount * sizeof(AnimationClipKey);
+		if (header->Magic != HL_ANIMATION_CLIP_MAGIC || header->Version != HL_ANIMATION_CLIP_VERSION || (uint64)m_Data.Size != expectedSize)
+		{
+			HL_CORE_ERROR("[-] Invalid animation clip: unknown format or version [-]");
+			m_Data.Release();
+			SetFlag(AssetFlag::Invalid);
+			return;
+		}
+
+		BindData();
+
+		if (!ValidateData())
+		{
+			HL_CORE_ERROR("[-] Invalid animation clip: a track references keyframes outside of the clip [-]");
+			m_Data.Release();
+			m_Header = nullptr;
+			m_Tracks = nullptr;
+			m_Keys = nullptr;
+			SetFlag(AssetFlag::Invalid);
+		}
+	}
+
+	AnimationClip::~AnimationClip()
+	{
+		m_Data.Release();
+	}
+
+	float AnimationClip::GetDuration() const
+	{
+		return m_Header ? m_Header->Duration : 0.0f;
+	}
+
+	float AnimationClip::GetTicksPerSecond() const
+	{
+		return m_Header ? m_Header->TicksPerSecond : 0.0f;
+	}
+
+	uint32 AnimationClip::GetTrackCount() const
+	{
+		return m_Header ? m_Header->TrackCount : 0;
+	}
+
+	uint32 AnimationClip::GetKeyframeCount() const
+	{
+		return m_Header ? m_Header->KeyCount : 0;
+	}
+
+	void AnimationClip::SampleLocalPose(float time, std::vector<uint32> &keyframeCursors, AnimationLocalPose &outPose, const AnimationLocalPose *bindPose) const
+	{
+		const uint32 trackCount = GetTrackCount();
+
+		if (keyframeCursors.size() != trackCount)
+			keyframeCursors.assign(trackCount, 0);
+
+		if (outPose.BoneCount != trackCount)
+			outPose.Resize(trackCount);
+
+		if (trackCount == 0)
+			return;
+
+		HL_ASSERT(!bindPose || bindPose->BoneCount == trackCount, "The bind pose does not belong to the skeleton of the clip");
+
+		const float duration = m_Header->Duration;
+		const float timeScale = duration / (float)0xFFFF;
+
+		for (uint32 track = 0; track < trackCount; ++track)
+		{
+			const AnimationClipTrack &clipTrack = m_Tracks[track];
+			if (clipTrack.KeyCount == 0)
+			{
+				if (bindPose)
+					outPose.SetBone(track, bindPose->GetTranslation(track), bindPose->GetRotation(track));
+				else
+					outPose.SetBone(track, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+				continue;
+			}
+
+			const AnimationClipKey *keys = &m_Keys[clipTrack.FirstKey];
+
+			// Same forward-only cursor as in Animation::SampleLocalPose
+			uint32 &cursor = keyframeCursors[track];
+			if (cursor >= clipTrack.KeyCount || (float)keys[cursor].Time * timeScale > time)
+				cursor = 0;
+
+			while (cursor + 1 < clipTrack.KeyCount && (float)keys[cursor + 1].Time * timeScale <= time)
+				++cursor;
+
+			const AnimationClipKey &previous = keys[cursor];
+			const AnimationClipKey &next = keys[HL_MIN(cursor + 1, clipTrack.KeyCount - 1)];
+
+			float previousTime = (float)previous.Time * timeScale;
+			float totalTime = (float)next.Time * timeScale - previousTime;
+			float progression = totalTime > 0.0f ? glm::clamp((time - previousTime) / totalTime, 0.0f, 1.0f) : 0.0f;
+
+			glm::vec3 previousTranslation, nextTranslation;
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				float scale = clipTrack.TranslationExtent[i] / (float)0xFFFF;
+				previousTranslation[i] = clipTrack.TranslationMin[i] + (float)previous.Translation[i] * scale;
+				nextTranslation[i] = clipTrack.TranslationMin[i] + (float)next.Translation[i] * scale;
+			}
+
+			glm::quat rotation = utils::NLerp(utils::DecompressRotation(previous.Rotation), utils::DecompressRotation(next.Rotation), progression);
+			outPose.SetBone(track, glm::mix(previousTranslation, nextTranslation, progression), rotation);
+		}
+	}
+
+	bool AnimationClip::Save(const FileSystemPath &filePath) const
+	{
+		if (!m_Data)
+			return false;
+
+		// FileSystem::WriteFile does not overwrite existing files
+		if (FileSystem::Get()->FileExists(filePath))
+			FileSystem::Get()->RemoveFile(filePath);
+
+		return FileSystem::Get()->WriteFile(filePath, m_Data.Data, (int64)m_Data.Size);
+	}
+
+	Ref<AnimationClip> AnimationClip::Create(const Animation &animation, const AnimationCompressionSettings &settings)
+	{
+		return Ref<AnimationClip>::Create(animation, settings);
+	}
+
+	Ref<AnimationClip> AnimationClip::Load(const FileSystemPath &filePath)
+	{
+		// The file content is the in-memory representation, so one read is all we need
+		int64 size = 0;
+		Byte *data = FileSystem::Get()->ReadFile(filePath, &size);
+		if (!data)
+		{
+			Ref<AnimationClip> result = Ref<AnimationClip>::Create();
+			result->SetFlag(AssetFlag::Missing);
+			return result;
+		}
+
+		return Ref<AnimationClip>::Create(Allocator(data, (uint32)size));
+	}
+
+	void AnimationClip::BindData()
+	{
+		m_Header = (AnimationClipHeader*)m_Data.Data;
+		m_Tracks = (AnimationClipTrack*)(m_Data.Data + sizeof(AnimationClipHeader));
+		m_Keys = (AnimationClipKey*)(m_Data.Data + sizeof(AnimationClipHeader) + (uint64)m_Header->TrackCount * sizeof(AnimationClipTrack));
+	}
+
+	bool AnimationClip::ValidateData() const
+	{
+		for (uint32 track = 0; track < m_Header->TrackCount; ++track)
+		{
+			if ((uint64)m_Tracks[track].FirstKey + m_Tracks[track].KeyCount > m_Header->KeyCount)
+				return false;
+		}
+
+		return true;
+	}
+}
+
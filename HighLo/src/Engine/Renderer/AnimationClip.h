@@ -0,0 +1,84 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Assets/Asset.h"
+#include "Engine/Core/Allocator.h"
+
+#include "Animation.h"
+#include "AnimationPose.h"
+
+namespace highlo
+{
+	struct AnimationClipHeader;
+	struct AnimationClipTrack;
+	struct AnimationClipKey;
+
+	struct AnimationCompressionSettings
+	{
+		/// Keyframes that can be reconstructed by interpolating their neighbours within these tolerances are removed.
+		float TranslationTolerance = 0.001f;
+		float RotationTolerance = 0.001f; // in radians
+	};
+
+	/// <summary>
+	/// A compressed, read-only animation clip.
+	/// Translations are quantized to 16 bits per component relative to the bounds of each track,
+	/// rotations are stored as the smallest three components with 15 bits each and redundant keyframes are removed.
+	/// The whole clip is one contiguous memory block, which is written to and read from disk without any parsing.
+	/// The tracks use the bone order of the Skeleton the clip has been created from.
+	/// </summary>
+	class AnimationClip : public Asset
+	{
+	public:
+
+		HLAPI AnimationClip() = default;
+		HLAPI AnimationClip(const Animation &animation, const AnimationCompressionSettings &settings = AnimationCompressionSettings());
+		HLAPI AnimationClip(Allocator data);
+		HLAPI virtual ~AnimationClip();
+
+		HL_NON_COPYABLE(AnimationClip);
+
+		HLAPI float GetDuration() const;
+		HLAPI float GetTicksPerSecond() const;
+		HLAPI uint32 GetTrackCount() const;
+		HLAPI uint32 GetKeyframeCount() const;
+
+		/// <summary>
+		/// Returns the size of the compressed clip in bytes.
+		/// </summary>
+		HLAPI uint32 GetMemorySize() const { return m_Data.Size; }
+
+		/// <summary>
+		/// Samples the bone-local translations and rotations at the given time.
+		/// </summary>
+		/// <param name="bindPose">Bones without keyframes are copied from this pose, usually Animation::GetBindPose(), or set to identity if it is null.</param>
+		HLAPI void SampleLocalPose(float time, std::vector<uint32> &keyframeCursors, AnimationLocalPose &outPose, const AnimationLocalPose *bindPose = nullptr) const;
+
+		HLAPI bool Save(const FileSystemPath &filePath) const;
+
+		// Inherited via Asset
+		HLAPI static AssetType GetStaticType() { return AssetType::AnimationClip; }
+		HLAPI virtual AssetType GetAssetType() const override { return GetStaticType(); }
+
+		HLAPI static Ref<AnimationClip> Create(const Animation &animation, const AnimationCompressionSettings &settings = AnimationCompressionSettings());
+		HLAPI static Ref<AnimationClip> Load(const FileSystemPath &filePath);
+
+	private:
+
+		void BindData();
+		bool ValidateData() const;
+
+		Allocator m_Data;
+
+		AnimationClipHeader *m_Header = nullptr;
+		AnimationClipTrack *m_Tracks = nullptr;
+		AnimationClipKey *m_Keys = nullptr;
+	};
+}
+
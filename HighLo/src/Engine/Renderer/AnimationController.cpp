@@ -0,0 +1,228 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AnimationController.h"
+
+namespace highlo
+{
+	namespace utils
+	{
+		/// <summary>
+		/// Finds the two blend tree nodes surrounding the blend parameter and the weight of the second one.
+		/// The nodes have to be sorted by their threshold.
+		/// </summary>
+		static void ComputeBlendTreeWeights(const std::vector<AnimationBlendTreeNode> &nodes, float blendParameter, uint32 &outFirst, uint32 &outSecond, float &outWeight)
+		{
+			outFirst = 0;
+			outSecond = 0;
+			outWeight = 0.0f;
+
+			if (nodes.size() < 2 || blendParameter <= nodes.front().Threshold)
+				return;
+
+			if (blendParameter >= nodes.back().Threshold)
+			{
+				outFirst = outSecond = (uint32)nodes.size() - 1;
+				return;
+			}
+
+			for (uint32 i = 0; i + 1 < (uint32)nodes.size(); ++i)
+			{
+				if (blendParameter <= nodes[i + 1].Threshold)
+				{
+					float range = nodes[i + 1].Threshold - nodes[i].Threshold;
+					outFirst = i;
+					outSecond = i + 1;
+					outWeight = range > 0.0f ? (blendParameter - nodes[i].Threshold) / range : 0.0f;
+					return;
+				}
+			}
+		}
+
+		static float GetClipLengthInSeconds(const Ref<AnimationClip> &clip)
+		{
+			float ticksPerSecond = clip->GetTicksPerSecond() > 0.0f ? clip->GetTicksPerSecond() : 1.0f;
+			return clip->GetDuration() / ticksPerSecond;
+		}
+	}
+
+	AnimationController::AnimationController(const Ref<Animation> &animation)
+		: m_Animation(animation)
+	{
+		m_BoneTransforms.resize(HL_MAX_SKELETAL_BONES, glm::mat4(1.0f));
+	}
+
+	uint32 AnimationController::AddLayer(AnimationLayerBlendMode mode, float weight)
+	{
+		AnimationLayer &layer = m_Layers.emplace_back();
+		layer.Mode = mode;
+		layer.Weight = weight;
+		return (uint32)m_Layers.size() - 1;
+	}
+
+	void AnimationController::SetLayerWeight(uint32 layer, float weight)
+	{
+		HL_ASSERT(layer < m_Layers.size());
+		m_Layers[layer].Weight = glm::clamp(weight, 0.0f, 1.0f);
+	}
+
+	void AnimationController::SetLayerSpeed(uint32 layer, float speed)
+	{
+		HL_ASSERT(layer < m_Layers.size());
+		m_Layers[layer].Speed = speed;
+	}
+
+	void AnimationController::Play(uint32 layer, const Ref<AnimationClip> &clip, float crossFadeDuration, bool loop)
+	{
+		HL_ASSERT(layer < m_Layers.size());
+		SetLayerState(m_Layers[layer], { { clip, 0.0f } }, crossFadeDuration, loop);
+	}
+
+	void AnimationController::PlayBlendTree(uint32 layer, const std::vector<AnimationBlendTreeNode> &nodes, float crossFadeDuration, bool loop)
+	{
+		HL_ASSERT(layer < m_Layers.size());
+		SetLayerState(m_Layers[layer], nodes, crossFadeDuration, loop);
+	}
+
+	void AnimationController::SetBlendParameter(uint32 layer, float value)
+	{
+		HL_ASSERT(layer < m_Layers.size());
+		m_Layers[layer].BlendParameter = value;
+	}
+
+	void AnimationController::Update(Timestep ts)
+	{
+		for (AnimationLayer &layer : m_Layers)
+		{
+			float deltaTime = ts * layer.Speed;
+
+			AdvanceState(layer.Current, layer.BlendParameter, deltaTime);
+
+			if (layer.Previous.IsValid())
+			{
+				AdvanceState(layer.Previous, layer.BlendParameter, deltaTime);
+
+				layer.FadeElapsed += ts;
+				if (layer.FadeElapsed >= layer.FadeDuration)
+					layer.Previous = AnimationLayerState();
+			}
+		}
+	}
+
+	glm::mat4 *AnimationController::Evaluate()
+	{
+		// Start from the bind pose, so that a partially weighted first layer blends towards the rest pose instead of the origin.
+		// The bind pose is computed once per animation, the copy reuses the memory of the previous frame
+		m_ResultPose = m_Animation->GetBindPose();
+
+		for (AnimationLayer &layer : m_Layers)
+		{
+			if (!layer.Current.IsValid() || layer.Weight <= 0.0f)
+				continue;
+
+			SampleState(layer.Current, layer.BlendParameter, layer.Current.NormalizedTime, layer.Current.KeyframeCursors, m_LayerPose);
+
+			if (layer.Previous.IsValid() && layer.FadeDuration > 0.0f)
+			{
+				SampleState(layer.Previous, layer.BlendParameter, layer.Previous.NormalizedTime, layer.Previous.KeyframeCursors, m_FadePose);
+				AnimationLocalPose::Blend(m_FadePose, m_LayerPose, glm::clamp(layer.FadeElapsed / layer.FadeDuration, 0.0f, 1.0f), m_LayerPose);
+			}
+
+			if (layer.Mode == AnimationLayerBlendMode::Override)
+			{
+				AnimationLocalPose::Blend(m_ResultPose, m_LayerPose, layer.Weight, m_ResultPose);
+			}
+			else
+			{
+				// The first frame of an additive state serves as its reference pose
+				SampleState(layer.Current, layer.BlendParameter, 0.0f, m_ReferenceCursors, m_ReferencePose);
+				AnimationLocalPose::BlendAdditive(m_ResultPose, m_LayerPose, m_ReferencePose, layer.Weight, m_ResultPose);
+			}
+		}
+
+		m_Animation->ComposePose(m_ResultPose, m_BoneTransforms);
+		return m_BoneTransforms.data();
+	}
+
+	Ref<AnimationController> AnimationController::Create(const Ref<Animation> &animation)
+	{
+		return Ref<AnimationController>::Create(animation);
+	}
+
+	void AnimationController::SetLayerState(AnimationLayer &layer, std::vector<AnimationBlendTreeNode> nodes, float crossFadeDuration, bool loop)
+	{
+		const uint32 boneCount = m_Animation->GetSkeleton().GetBoneCount();
+		for (const AnimationBlendTreeNode &node : nodes)
+		{
+			HL_ASSERT(node.Clip, "Blend tree nodes need a clip");
+			HL_ASSERT(node.Clip->GetTrackCount() == boneCount, "The clip has not been created from this skeleton");
+		}
+
+		std::sort(nodes.begin(), nodes.end(), [](const AnimationBlendTreeNode &a, const AnimationBlendTreeNode &b)
+		{
+			return a.Threshold < b.Threshold;
+		});
+
+		if (crossFadeDuration > 0.0f && layer.Current.IsValid())
+		{
+			layer.Previous = std::move(layer.Current);
+			layer.FadeDuration = crossFadeDuration;
+			layer.FadeElapsed = 0.0f;
+		}
+		else
+		{
+			layer.Previous = AnimationLayerState();
+			layer.FadeDuration = 0.0f;
+			layer.FadeElapsed = 0.0f;
+		}
+
+		layer.Current = AnimationLayerState();
+		layer.Current.Nodes = std::move(nodes);
+		layer.Current.KeyframeCursors.resize(layer.Current.Nodes.size());
+		layer.Current.Loop = loop;
+	}
+
+	void AnimationController::AdvanceState(AnimationLayerState &state, float blendParameter, float deltaTime)
+	{
+		if (!state.IsValid())
+			return;
+
+		// The length of a blend tree is the weighted length of the blended clips
+		uint32 first, second;
+		float weight;
+		utils::ComputeBlendTreeWeights(state.Nodes, blendParameter, first, second, weight);
+
+		float length = glm::mix(utils::GetClipLengthInSeconds(state.Nodes[first].Clip), utils::GetClipLengthInSeconds(state.Nodes[second].Clip), weight);
+		if (length <= 0.0f)
+			return;
+
+		state.NormalizedTime += deltaTime / length;
+
+		if (state.Loop)
+			state.NormalizedTime -= glm::floor(state.NormalizedTime);
+		else
+			state.NormalizedTime = glm::clamp(state.NormalizedTime, 0.0f, 1.0f);
+	}
+
+	void AnimationController::SampleState(AnimationLayerState &state, float blendParameter, float normalizedTime, std::vector<std::vector<uint32>> &keyframeCursors, AnimationLocalPose &outPose)
+	{
+		uint32 first, second;
+		float weight;
+		utils::ComputeBlendTreeWeights(state.Nodes, blendParameter, first, second, weight);
+
+		if (keyframeCursors.size() < state.Nodes.size())
+			keyframeCursors.resize(state.Nodes.size());
+
+		const AnimationLocalPose &bindPose = m_Animation->GetBindPose();
+		const Ref<AnimationClip> &firstClip = state.Nodes[first].Clip;
+		firstClip->SampleLocalPose(normalizedTime * firstClip->GetDuration(), keyframeCursors[first], outPose, &bindPose);
+
+		if (first != second && weight > 0.0f)
+		{
+			const Ref<AnimationClip> &secondClip = state.Nodes[second].Clip;
+			secondClip->SampleLocalPose(normalizedTime * secondClip->GetDuration(), keyframeCursors[second], m_NodePose, &bindPose);
+			AnimationLocalPose::Blend(outPose, m_NodePose, weight, outPose);
+		}
+	}
+}
+
@@ -0,0 +1,116 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include "Engine/Core/Time.h"
+
+#include "Animation.h"
+#include "AnimationClip.h"
+#include "AnimationPose.h"
+
+namespace highlo
+{
+	enum class AnimationLayerBlendMode
+	{
+		Override = 0,	/**< The layer is blended over the result of all previous layers. */
+		Additive		/**< The difference of the layer to its first frame is added to the result of all previous layers. */
+	};
+
+	struct AnimationBlendTreeNode
+	{
+		Ref<AnimationClip> Clip = nullptr;
+		float Threshold = 0.0f;
+	};
+
+	/// <summary>
+	/// Plays compressed animation clips on the skeleton of an animation.
+	/// Every layer either plays a single clip or a one-dimensional blend tree, changing the clip of a layer cross-fades
+	/// from the previous state. Layers are evaluated in order and are combined by their blend mode and weight.
+	/// The clips inside of a blend tree are synchronized by their normalized time, so walk and run cycles stay in phase.
+	/// </summary>
+	class AnimationController : public IsSharedReference
+	{
+	public:
+
+		HLAPI AnimationController(const Ref<Animation> &animation);
+		HLAPI virtual ~AnimationController() = default;
+
+		/// <summary>
+		/// Adds a new layer on top of all existing layers and returns its index.
+		/// </summary>
+		HLAPI uint32 AddLayer(AnimationLayerBlendMode mode = AnimationLayerBlendMode::Override, float weight = 1.0f);
+		HLAPI uint32 GetLayerCount() const { return (uint32)m_Layers.size(); }
+
+		HLAPI void SetLayerWeight(uint32 layer, float weight);
+		HLAPI void SetLayerSpeed(uint32 layer, float speed);
+
+		/// <summary>
+		/// Plays a single clip on the given layer, fading from the currently playing state over crossFadeDuration seconds.
+		/// </summary>
+		HLAPI void Play(uint32 layer, const Ref<AnimationClip> &clip, float crossFadeDuration = 0.0f, bool loop = true);
+
+		/// <summary>
+		/// Plays a one-dimensional blend tree on the given layer, the blend parameter selects the clips to blend between.
+		/// </summary>
+		HLAPI void PlayBlendTree(uint32 layer, const std::vector<AnimationBlendTreeNode> &nodes, float crossFadeDuration = 0.0f, bool loop = true);
+		HLAPI void SetBlendParameter(uint32 layer, float value);
+
+		HLAPI void Update(Timestep ts);
+
+		/// <summary>
+		/// Evaluates all layers and returns the final skinning matrices, indexed by bone id.
+		/// </summary>
+		HLAPI glm::mat4 *Evaluate();
+
+		HLAPI const Ref<Animation> &GetAnimation() const { return m_Animation; }
+
+		HLAPI static Ref<AnimationController> Create(const Ref<Animation> &animation);
+
+	private:
+
+		struct AnimationLayerState
+		{
+			std::vector<AnimationBlendTreeNode> Nodes;
+			std::vector<std::vector<uint32>> KeyframeCursors;
+			float NormalizedTime = 0.0f;
+			bool Loop = true;
+
+			bool IsValid() const { return !Nodes.empty(); }
+		};
+
+		struct AnimationLayer
+		{
+			AnimationLayerBlendMode Mode = AnimationLayerBlendMode::Override;
+			float Weight = 1.0f;
+			float Speed = 1.0f;
+			float BlendParameter = 0.0f;
+
+			AnimationLayerState Current;
+			AnimationLayerState Previous;
+			float FadeDuration = 0.0f;
+			float FadeElapsed = 0.0f;
+		};
+
+		void SetLayerState(AnimationLayer &layer, std::vector<AnimationBlendTreeNode> nodes, float crossFadeDuration, bool loop);
+		void AdvanceState(AnimationLayerState &state, float blendParameter, float deltaTime);
+		void SampleState(AnimationLayerState &state, float blendParameter, float normalizedTime, std::vector<std::vector<uint32>> &keyframeCursors, AnimationLocalPose &outPose);
+
+		Ref<Animation> m_Animation;
+		std::vector<AnimationLayer> m_Layers;
+		std::vector<glm::mat4> m_BoneTransforms;
+
+		// Scratch poses, kept as members to avoid allocations during the evaluation
+		AnimationLocalPose m_ResultPose;
+		AnimationLocalPose m_LayerPose;
+		AnimationLocalPose m_FadePose;
+		AnimationLocalPose m_NodePose;
+		AnimationLocalPose m_ReferencePose;
+		std::vector<std::vector<uint32>> m_ReferenceCursors;
+	};
+}
+
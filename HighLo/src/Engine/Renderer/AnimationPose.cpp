@@ -0,0 +1,99 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "AnimationPose.h"
+
+#include "Engine/Math/Math.h"
+
+namespace highlo
+{
+	void AnimationLocalPose::Resize(uint32 boneCount)
+	{
+		BoneCount = boneCount;
+		Stride = (boneCount + 3) & ~3u;
+		Data.assign((uint64)Stride * ChannelCount, 0.0f);
+
+		// The padding lanes have to stay valid quaternions, otherwise the SIMD normalization would divide by zero
+		float *rotationW = Get(RotationW);
+		for (uint32 i = 0; i < Stride; ++i)
+			rotationW[i] = 1.0f;
+	}
+
+	glm::vec3 AnimationLocalPose::GetTranslation(uint32 bone) const
+	{
+		return { Get(TranslationX)[bone], Get(TranslationY)[bone], Get(TranslationZ)[bone] };
+	}
+
+	glm::quat AnimationLocalPose::GetRotation(uint32 bone) const
+	{
+		return glm::quat(Get(RotationW)[bone], Get(RotationX)[bone], Get(RotationY)[bone], Get(RotationZ)[bone]);
+	}
+
+	void AnimationLocalPose::SetBone(uint32 bone, const glm::vec3 &translation, const glm::quat &rotation)
+	{
+		Get(TranslationX)[bone] = translation.x;
+		Get(TranslationY)[bone] = translation.y;
+		Get(TranslationZ)[bone] = translation.z;
+		Get(RotationX)[bone] = rotation.x;
+		Get(RotationY)[bone] = rotation.y;
+		Get(RotationZ)[bone] = rotation.z;
+		Get(RotationW)[bone] = rotation.w;
+	}
+
+	void AnimationLocalPose::Blend(const AnimationLocalPose &a, const AnimationLocalPose &b, float weight, AnimationLocalPose &outPose)
+	{
+		HL_ASSERT(a.BoneCount == b.BoneCount);
+
+		if (outPose.BoneCount != a.BoneCount)
+			outPose.Resize(a.BoneCount);
+
+		const __m128 t = _mm_set1_ps(weight);
+		for (uint32 i = 0; i < a.Stride; i += 4)
+		{
+			for (uint32 channel = TranslationX; channel <= TranslationZ; ++channel)
+			{
+				__m128 from = _mm_loadu_ps(a.Get((Channel)channel) + i);
+				__m128 to = _mm_loadu_ps(b.Get((Channel)channel) + i);
+				_mm_storeu_ps(outPose.Get((Channel)channel) + i, Math::LerpSSE(from, to, t));
+			}
+
+			__m128 x, y, z, w;
+			Math::NLerpQuatSSE(_mm_loadu_ps(a.Get(RotationX) + i), _mm_loadu_ps(a.Get(RotationY) + i), _mm_loadu_ps(a.Get(RotationZ) + i), _mm_loadu_ps(a.Get(RotationW) + i),
+							   _mm_loadu_ps(b.Get(RotationX) + i), _mm_loadu_ps(b.Get(RotationY) + i), _mm_loadu_ps(b.Get(RotationZ) + i), _mm_loadu_ps(b.Get(RotationW) + i),
+							   t, x, y, z, w);
+
+			_mm_storeu_ps(outPose.Get(RotationX) + i, x);
+			_mm_storeu_ps(outPose.Get(RotationY) + i, y);
+			_mm_storeu_ps(outPose.Get(RotationZ) + i, z);
+			_mm_storeu_ps(outPose.Get(RotationW) + i, w);
+		}
+	}
+
+	void AnimationLocalPose::BlendAdditive(const AnimationLocalPose &base, const AnimationLocalPose &additive, const AnimationLocalPose &reference, float weight, AnimationLocalPose &outPose)
+	{
+		HL_ASSERT(base.BoneCount == additive.BoneCount && base.BoneCount == reference.BoneCount);
+
+		if (outPose.BoneCount != base.BoneCount)
+			outPose.Resize(base.BoneCount);
+
+		const glm::quat identity = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		for (uint32 i = 0; i < base.BoneCount; ++i)
+		{
+			glm::vec3 translationDelta = additive.GetTranslation(i) - reference.GetTranslation(i);
+			glm::quat rotationDelta = additive.GetRotation(i) * glm::inverse(reference.GetRotation(i));
+
+			// Scale the rotation delta along the shortest path
+			if (glm::dot(identity, rotationDelta) < 0.0f)
+				rotationDelta = -rotationDelta;
+
+			rotationDelta = glm::normalize(glm::quat(
+				glm::mix(identity.w, rotationDelta.w, weight),
+				glm::mix(identity.x, rotationDelta.x, weight),
+				glm::mix(identity.y, rotationDelta.y, weight),
+				glm::mix(identity.z, rotationDelta.z, weight)));
+
+			outPose.SetBone(i, base.GetTranslation(i) + translationDelta * weight, glm::normalize(rotationDelta * base.GetRotation(i)));
+		}
+	}
+}
+
@@ -0,0 +1,73 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <vector>
+
+#include "Engine/Core/Core.h"
+
+namespace highlo
+{
+	/// <summary>
+	/// Holds the evaluation state of one animated instance.
+	/// The keyframe cursors remember the last sampled keyframe of every bone, so advancing the time
+	/// only has to look at the next few keyframes instead of scanning the whole track.
+	/// </summary>
+	struct AnimationPose
+	{
+		float Time = 0.0f;
+		std::vector<uint32> KeyframeCursors;
+		std::vector<glm::mat4> BoneTransforms;
+	};
+
+	/// <summary>
+	/// The bone-local translations and rotations of a skeleton, before the hierarchy has been applied.
+	/// The data is stored as structure-of-arrays with one channel per component, padded to a multiple of four bones,
+	/// so that poses can be sampled and blended four bones at a time.
+	/// </summary>
+	struct AnimationLocalPose
+	{
+		enum Channel : uint32
+		{
+			TranslationX = 0, TranslationY, TranslationZ,
+			RotationX, RotationY, RotationZ, RotationW,
+			ChannelCount
+		};
+
+		uint32 BoneCount = 0;
+		uint32 Stride = 0;
+		std::vector<float> Data;
+
+		/// <summary>
+		/// Resizes the pose, all bones are reset to the identity transform.
+		/// </summary>
+		HLAPI void Resize(uint32 boneCount);
+
+		HLAPI float *Get(Channel channel) { return Data.data() + (uint64)channel * Stride; }
+		HLAPI const float *Get(Channel channel) const { return Data.data() + (uint64)channel * Stride; }
+
+		HLAPI glm::vec3 GetTranslation(uint32 bone) const;
+		HLAPI glm::quat GetRotation(uint32 bone) const;
+		HLAPI void SetBone(uint32 bone, const glm::vec3 &translation, const glm::quat &rotation);
+
+		/// <summary>
+		/// Blends from pose a to pose b, a weight of 0 results in a and a weight of 1 results in b.
+		/// The output may be the same pose as one of the inputs.
+		/// </summary>
+		HLAPI static void Blend(const AnimationLocalPose &a, const AnimationLocalPose &b, float weight, AnimationLocalPose &outPose);
+
+		/// <summary>
+		/// Applies the difference between additive and reference on top of base, scaled by weight.
+		/// The output may be the same pose as base.
+		/// </summary>
+		HLAPI static void BlendAdditive(const AnimationLocalPose &base, const AnimationLocalPose &additive, const AnimationLocalPose &reference, float weight, AnimationLocalPose &outPose);
+	};
+}
+
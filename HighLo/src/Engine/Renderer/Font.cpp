@@ -22,6 +22,21 @@ namespace highlo
 		HL_ASSERT(false, "Unknown font type!");
 		return nullptr;
 	}
+
+	Ref<Font> Font::Decode(const FileSystemPath &path, uint16 size, FontType fontType)
+	{
+		switch (fontType)
+		{
+			case FontType::BITMAP_FONT:
+				return Ref<BitmapFont>::Create(path, size);
+
+			case FontType::TRUE_TYPE_FONT:
+				return Ref<TrueTypeFont>::Create(path, size, false);
+		}
+
+		HL_ASSERT(false, "Unknown font type!");
+		return nullptr;
+	}
 }
 
 #if 0
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.5 (2026-10-19) Added Decode and CreateResources, so that fonts can be loaded on a worker thread
 //     - 1.4 (2023-01-29) Rewritten whole font implementation
 //     - 1.3 (2021-10-05) Fixed warning in Release mode, because HL_ASSERT was used in release
 //     - 1.2 (2021-09-26) Added MSDFData getter and moved GetDefaultFont to FontManager
@@ -118,6 +119,11 @@ namespace highlo
 		HLAPI virtual int32 GetLineHeight() const = 0;
 		HLAPI virtual float GetTabXAdvance() const = 0;
 
+		/// <summary>
+		/// Creates the atlas textures of a font, that has been loaded with Decode(). Has to be called on the main thread.
+		/// </summary>
+		HLAPI virtual bool CreateResources() { return true; }
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -127,6 +133,12 @@ namespace highlo
 		/// <returns></returns>
 		HLAPI static Ref<Font> Create(const FileSystemPath &path, uint16 size, FontType fontType = FontType::NONE);
 
+		/// <summary>
+		/// Loads the font and packs its glyphs without creating any GPU resources, so that it can be called from any thread.
+		/// CreateResources() has to be called, before the font can be rendered.
+		/// </summary>
+		HLAPI static Ref<Font> Decode(const FileSystemPath &path, uint16 size, FontType fontType = FontType::NONE);
+
 	protected:
 
 		std::vector<FontGlyph> m_Glyphs;
@@ -54,7 +54,7 @@ namespace highlo
 
 	struct GlobalShaderInfo
 	{
-		std::unordered_map<HLString, std::unordered_map<uint64, WeakRef<Shader>>> GlobalMacros;
+		std::unordered_map<HLName, std::unordered_map<uint64, WeakRef<Shader>>> GlobalMacros;
 		std::vector<WeakRef<Shader>> DirtyShaders;
 	};
 
@@ -171,10 +171,11 @@ namespace highlo
 		s_GlobalShaderInfo.DirtyShaders.push_back(shader);
 	}
 
-	void Renderer::SetGlobalMacroInShaders(const HLString &name, const HLString &value)
+	void Renderer::SetGlobalMacroInShaders(const HLName &name, const HLString &value)
 	{
-		HL_ASSERT(s_GlobalShaderInfo.GlobalMacros.find(name) != s_GlobalShaderInfo.GlobalMacros.end(), "Macro has not been passed from any shader!");
-		for (auto &[hash, shader] : s_GlobalShaderInfo.GlobalMacros.at(name))
+		auto macroShaders = s_GlobalShaderInfo.GlobalMacros.find(name);
+		HL_ASSERT(macroShaders != s_GlobalShaderInfo.GlobalMacros.end(), "Macro has not been passed from any shader!");
+		for (auto &[hash, shader] : macroShaders->second)
 		{
 			HL_ASSERT(shader.IsValid(), "Shader was deleted!");
 			shader->SetMacro(name, value);
@@ -246,9 +247,11 @@ namespace highlo
 		const Ref<MaterialTable> &materials, 
 		const TransformVertexData *transformBuffer, 
 		uint32 transformBufferOffset, 
-		uint32 instanceCount)
+		uint32 instanceCount,
+		uint32 boneTransformOffset,
+		uint32 boneTransformStride)
 	{
-		s_RenderingAPI->DrawInstancedDynamicMesh(renderCommandBuffer, va, uniformBufferSet, storageBufferSet, model, submeshIndex, materials, transformBuffer, transformBufferOffset, instanceCount);
+		s_RenderingAPI->DrawInstancedDynamicMesh(renderCommandBuffer, va, uniformBufferSet, storageBufferSet, model, submeshIndex, materials, transformBuffer, transformBufferOffset, instanceCount, boneTransformOffset, boneTransformStride);
 	}
 
 	void Renderer::RenderInstancedStaticMesh(
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Global shader macros are looked up by their interned name
 //     - 1.2 (2021-10-17) Added RenderCommandQueue
 //     - 1.1 (2021-09-29) Added Renderer2DText Shader loading to init function
 //     - 1.0 (2021-09-14) initial release
@@ -110,7 +111,7 @@ namespace highlo
 
 		HLAPI static void AcknowledgeParsedGlobalMacros(const std::unordered_set<HLString> &macros, const Ref<Shader> &shader);
 		HLAPI static void SetMacroInShader(Ref<Shader> &shader, const HLString &name, const HLString &value = "");
-		HLAPI static void SetGlobalMacroInShaders(const HLString &name, const HLString &value = "");
+		HLAPI static void SetGlobalMacroInShaders(const HLName &name, const HLString &value = "");
 
 		HLAPI static void WaitAndRender();
 		HLAPI static void RenderFullscreenQuad(
@@ -154,7 +155,9 @@ namespace highlo
 			const Ref<MaterialTable> &materials,
 			const TransformVertexData *transformBuffer,
 			uint32 transformBufferOffset,
-			uint32 instanceCount);
+			uint32 instanceCount,
+			uint32 boneTransformOffset,
+			uint32 boneTransformStride);
 
 		HLAPI static void RenderInstancedStaticMesh(
 			const Ref<CommandBuffer> &renderCommandBuffer, 
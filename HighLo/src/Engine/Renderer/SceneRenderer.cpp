@@ -23,6 +23,7 @@ namespace highlo
 		PointLightsBinding = 4,
 		ScreenBinding = 17,
 		HBAOBinding = 18,
+		BoneTransformsBinding = 22,
 	};
 
 	SceneRenderer::SceneRenderer(Ref<Scene> &scene, SceneRendererSpecification &specification)
@@ -54,6 +55,7 @@ namespace highlo
 		m_UniformBufferSet->CreateUniform(sizeof(UniformBufferHBAOData), HBAOBinding, UniformLayout::GetHBAODataLayout()); // HBAO data Uniform block
 
 		m_StorageBufferSet = StorageBufferSet::Create(framesInFlight);
+		m_SkinningPalette = SkinningPalette(framesInFlight);
 	//	m_StorageBufferSet->CreateStorage(1, 14); // size is set to 1 because the storage buffer gets resized later anyway
 	//	m_StorageBufferSet->CreateStorage(1, 23);
 
@@ -335,6 +337,28 @@ namespace highlo
 	}
 
 	void SceneRenderer::SubmitDynamicModel(const Ref<DynamicModel> &model, uint32 submeshIndex, Ref<MaterialTable> materials, const glm::mat4 &transform, const Ref<Material> &overrideMaterial)
+	{
+		MeshKey key = SubmitDynamicModelInstance(model, submeshIndex, materials, transform, overrideMaterial);
+
+		if (model->IsAnimated())
+		{
+			// Only evaluates the bones, if the animation has advanced since the last time the model has been rendered
+			model->UpdateBoneTransforms();
+
+			const auto &boneTransforms = model->GetBoneTransforms();
+			AddSkinnedInstance(m_MeshTransformMap[key], boneTransforms.data(), (uint32)boneTransforms.size(), (uint64)model.Get(), model->GetBoneTransformVersion());
+		}
+	}
+
+	void SceneRenderer::SubmitDynamicModel(const Ref<DynamicModel> &model, uint32 submeshIndex, const glm::mat4 *boneTransforms, uint32 boneCount, Ref<MaterialTable> materials, const glm::mat4 &transform, const Ref<Material> &overrideMaterial)
+	{
+		HL_ASSERT(model->IsAnimated());
+
+		MeshKey key = SubmitDynamicModelInstance(model, submeshIndex, materials, transform, overrideMaterial);
+		AddSkinnedInstance(m_MeshTransformMap[key], boneTransforms, boneCount, 0, 0);
+	}
+
+	MeshKey SceneRenderer::SubmitDynamicModelInstance(const Ref<DynamicModel> &model, uint32 submeshIndex, const Ref<MaterialTable> &materials, const glm::mat4 &transform, const Ref<Material> &overrideMaterial)
 	{
 		const auto &submeshes = model->Get()->GetSubmeshes();
 		uint32 materialIndex = submeshes[submeshIndex].MaterialIndex;
@@ -373,6 +397,41 @@ namespace highlo
 			dc.OverrideMaterial = overrideMaterial;
 			dc.InstanceCount++;
 		}
+
+		return key;
+	}
+
+	void SceneRenderer::AddSkinnedInstance(TransformMapData &transformData, const glm::mat4 *boneTransforms, uint32 boneCount, uint64 source, uint64 version)
+	{
+		// The transform of the instance has already been added
+		uint32 instanceIndex = (uint32)transformData.Transforms.size() - 1;
+
+		if (instanceIndex == 0)
+		{
+			transformData.BoneTransforms.assign(boneTransforms, boneTransforms + boneCount);
+			transformData.BoneCount = boneCount;
+			transformData.BoneTransformSource = source;
+			transformData.BoneTransformVersion = version;
+			transformData.SharedPose = source != 0;
+			return;
+		}
+
+		HL_ASSERT(boneCount == transformData.BoneCount, "All instances of a model need the same number of bones");
+
+		// Instances of the same model without an own pose all use the pose of the model
+		if (transformData.SharedPose && source == transformData.BoneTransformSource && version == transformData.BoneTransformVersion)
+			return;
+
+		if (transformData.SharedPose)
+		{
+			// From now on every instance needs its own range inside the palette
+			transformData.SharedPose = false;
+			transformData.BoneTransforms.resize((uint64)instanceIndex * boneCount);
+			for (uint32 i = 1; i < instanceIndex; ++i)
+				std::copy_n(transformData.BoneTransforms.begin(), boneCount, transformData.BoneTransforms.begin() + (uint64)i * boneCount);
+		}
+
+		transformData.BoneTransforms.insert(transformData.BoneTransforms.end(), boneTransforms, boneTransforms + boneCount);
 	}
 
 	void SceneRenderer::SubmitSelectedStaticModel(const Ref<StaticModel> &model, const Ref<MaterialTable> &materials, const glm::mat4 &transform, const Ref<Material> &overrideMaterial)
@@ -592,6 +651,8 @@ namespace highlo
 
 	void SceneRenderer::PreRender()
 	{
+		m_SkinningPalette.Begin();
+
 		uint32 offset = 0;
 		for (auto &[key, transformData] : m_MeshTransformMap)
 		{
@@ -601,7 +662,21 @@ namespace highlo
 				m_TransformVertexData[offset] = transform;
 				++offset;
 			}
+
+			if (transformData.BoneCount > 0)
+			{
+				// A shared pose is stored once and addressed with a stride of zero by all instances
+				transformData.BoneTransformOffset = m_SkinningPalette.Add(
+					transformData.BoneTransforms.data(),
+					(uint32)transformData.BoneTransforms.size(),
+					transformData.SharedPose ? transformData.BoneTransformSource : 0,
+					transformData.BoneTransformVersion);
+				transformData.BoneTransformStride = transformData.SharedPose ? 0 : transformData.BoneCount;
+			}
 		}
+
+		// Skipped, if no model has been re-evaluated since this frame in flight has been written the last time
+		m_SkinningPalette.Upload(m_StorageBufferSet, BoneTransformsBinding, Renderer::GetCurrentFrameIndex());
 	}
 
 	void SceneRenderer::ClearPass()
@@ -745,7 +820,9 @@ namespace highlo
 				dc.Materials ? dc.Materials : dc.Model->GetMaterials(), 
 				m_TransformVertexData,
 				transformData.TransformOffset, 
-				dc.InstanceCount);
+				dc.InstanceCount,
+				transformData.BoneTransformOffset,
+				transformData.BoneTransformStride);
 		}
 
 		Renderer::EndRenderPass(m_CommandBuffer);
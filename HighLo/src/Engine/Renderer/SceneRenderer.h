@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.3 (2026-10-19) Skinned instances are packed into a skinning palette, which is uploaded once per frame
 //     - 1.2 (2021-09-26) Added CompositeRenderPass
 //     - 1.1 (2021-09-15) Added SetLineWidth method
 //     - 1.0 (2021-09-14) initial release
@@ -25,6 +26,8 @@
 #include "Engine/Graphics/Meshes/DynamicModel.h"
 #include "Engine/Graphics/Meshes/StaticModel.h"
 
+#include "SkinningPalette.h"
+
 namespace highlo
 {
 	struct SceneRendererOptions
@@ -113,6 +116,16 @@ namespace highlo
 	{
 		std::vector<TransformVertexData> Transforms;
 		uint32 TransformOffset = 0;
+
+		// Skinned instances, as long as all instances share the same pose, only a single pose is stored
+		std::vector<glm::mat4> BoneTransforms;
+		uint32 BoneCount = 0;
+		uint64 BoneTransformSource = 0;
+		uint64 BoneTransformVersion = 0;
+		bool SharedPose = true;
+
+		uint32 BoneTransformOffset = 0;
+		uint32 BoneTransformStride = 0;
 	};
 
 	/// <summary>
@@ -156,6 +169,12 @@ namespace highlo
 		HLAPI void SubmitStaticModel(const Ref<StaticModel> &model, const Ref<MaterialTable> &materials = nullptr, const glm::mat4 &transform = glm::mat4(1.0f), const Ref<Material> &overrideMaterial = nullptr);
 		HLAPI void SubmitDynamicModel(const Ref<DynamicModel> &model, uint32 submeshIndex, Ref<MaterialTable> materials = nullptr, const glm::mat4 &transform = glm::mat4(1.0f), const Ref<Material> &overrideMaterial = nullptr);
 
+		/// <summary>
+		/// Submits an instance of an animated model with its own pose, for example evaluated by an AnimationController.
+		/// All instances of the same model are still rendered with a single instanced draw call.
+		/// </summary>
+		HLAPI void SubmitDynamicModel(const Ref<DynamicModel> &model, uint32 submeshIndex, const glm::mat4 *boneTransforms, uint32 boneCount, Ref<MaterialTable> materials = nullptr, const glm::mat4 &transform = glm::mat4(1.0f), const Ref<Material> &overrideMaterial = nullptr);
+
 		HLAPI void SubmitSelectedStaticModel(const Ref<StaticModel> &model, const Ref<MaterialTable> &materials = nullptr, const glm::mat4 &transform = glm::mat4(1.0f), const Ref<Material> &overrideMaterial = nullptr);
 		HLAPI void SubmitSelectedDynamicModel(const Ref<DynamicModel> &model, uint32 submeshIndex, const Ref<MaterialTable> &materials = nullptr, const glm::mat4 &transform = glm::mat4(1.0f), const Ref<Material> &overrideMaterial = nullptr);
 
@@ -196,6 +215,9 @@ namespace highlo
 
 		void UpdateStatistics();
 
+		MeshKey SubmitDynamicModelInstance(const Ref<DynamicModel> &model, uint32 submeshIndex, const Ref<MaterialTable> &materials, const glm::mat4 &transform, const Ref<Material> &overrideMaterial);
+		void AddSkinnedInstance(TransformMapData &transformData, const glm::mat4 *boneTransforms, uint32 boneCount, uint64 source, uint64 version);
+
 		void CalculateCascades(CascadeData *data, const Camera &sceneCamera, const glm::vec3 &lightDir) const;
 
 	private:
@@ -251,6 +273,7 @@ namespace highlo
 		std::map<MeshKey, TransformMapData> m_MeshTransformMap;
 
 		TransformVertexData *m_TransformVertexData = nullptr;
+		SkinningPalette m_SkinningPalette;
 
 		// Bloom
 		Ref<Shader> m_BloomBlurShader = nullptr;
@@ -0,0 +1,44 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "Skeleton.h"
+
+#include "Animation.h"
+
+namespace highlo
+{
+	Skeleton Skeleton::Build(Bone &rootBone)
+	{
+		Skeleton result;
+
+		// Breadth-first traversal guarantees that every parent is stored before its children
+		std::vector<std::pair<Bone*, int32>> queue;
+		queue.push_back({ &rootBone, -1 });
+
+		for (uint64 i = 0; i < queue.size(); ++i)
+		{
+			Bone *bone = queue[i].first;
+			int32 boneIndex = (int32)i;
+
+			result.Bones.push_back(bone);
+			result.ParentIndices.push_back(queue[i].second);
+			result.BoneIDs.push_back(bone->ID);
+			result.OffsetMatrices.push_back(bone->OffsetMatrix);
+			result.TrackOffsets.push_back((uint32)result.KeyTimestamps.size());
+
+			for (const Keyframe &keyframe : bone->Keyframes)
+			{
+				result.KeyTimestamps.push_back(keyframe.Timestamp);
+				result.KeyTranslations.push_back(keyframe.Transform.Translation);
+				result.KeyRotations.push_back(keyframe.Transform.Rotation);
+			}
+
+			for (Bone &child : bone->Children)
+				queue.push_back({ &child, boneIndex });
+		}
+
+		result.TrackOffsets.push_back((uint32)result.KeyTimestamps.size());
+		return result;
+	}
+}
+
@@ -0,0 +1,49 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <vector>
+
+#include "Engine/Core/Core.h"
+
+namespace highlo
+{
+	struct Bone;
+
+	/// <summary>
+	/// Flat representation of a bone hierarchy.
+	/// The bones are stored in topological order, so every parent is located before its children,
+	/// which allows the global transforms to be calculated in a single linear pass without recursion.
+	/// The keyframes of all bones are stored in structure-of-arrays form, each bone owns the range
+	/// [TrackOffsets[i], TrackOffsets[i + 1]) inside the keyframe arrays.
+	/// </summary>
+	struct Skeleton
+	{
+		std::vector<int32> ParentIndices;
+		std::vector<uint32> BoneIDs;
+		std::vector<Bone*> Bones;
+		std::vector<glm::mat4> OffsetMatrices;
+
+		std::vector<uint32> TrackOffsets;
+		std::vector<float> KeyTimestamps;
+		std::vector<glm::vec3> KeyTranslations;
+		std::vector<glm::quat> KeyRotations;
+
+		HLAPI uint32 GetBoneCount() const { return (uint32)ParentIndices.size(); }
+		HLAPI uint32 GetKeyframeCount(uint32 boneIndex) const { return TrackOffsets[boneIndex + 1] - TrackOffsets[boneIndex]; }
+
+		/// <summary>
+		/// Flattens the bone hierarchy starting at the given root bone.
+		/// The skeleton keeps pointers to the bones, so the hierarchy must outlive the skeleton.
+		/// </summary>
+		HLAPI static Skeleton Build(Bone &rootBone);
+	};
+}
+
@@ -0,0 +1,78 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include "HighLoPch.h"
+#include "SkinningPalette.h"
+
+namespace highlo
+{
+	namespace utils
+	{
+		static uint64 CombineSignature(uint64 signature, uint64 value)
+		{
+			// FNV-1a style mixing, good enough to detect changed ranges
+			return (signature ^ value) * 1099511628211ull;
+		}
+
+		static uint32 GetPaletteCapacity(uint32 boneCount)
+		{
+			// Grow in steps of 1024 matrices, so that small changes in the number of instances don't reallocate the storage buffer
+			const uint32 granularity = 1024;
+			return HL_MAX(granularity, ((boneCount + granularity - 1) / granularity) * granularity);
+		}
+	}
+
+	SkinningPalette::SkinningPalette(uint32 framesInFlight)
+	{
+		m_UploadedSignatures.resize(framesInFlight, 0);
+		m_Capacities.resize(framesInFlight, 0);
+	}
+
+	void SkinningPalette::Begin()
+	{
+		m_BoneTransforms.clear();
+		m_Signature = 14695981039346656037ull;
+		m_HasUnversionedData = false;
+	}
+
+	uint32 SkinningPalette::Add(const glm::mat4 *boneTransforms, uint32 boneCount, uint64 sourceID, uint64 version)
+	{
+		uint32 offset = (uint32)m_BoneTransforms.size();
+		m_BoneTransforms.insert(m_BoneTransforms.end(), boneTransforms, boneTransforms + boneCount);
+
+		if (sourceID == 0)
+			m_HasUnversionedData = true;
+
+		m_Signature = utils::CombineSignature(m_Signature, sourceID);
+		m_Signature = utils::CombineSignature(m_Signature, version);
+		m_Signature = utils::CombineSignature(m_Signature, ((uint64)offset << 32) | boneCount);
+		return offset;
+	}
+
+	bool SkinningPalette::Upload(const Ref<StorageBufferSet> &storageBufferSet, uint32 binding, uint32 frame)
+	{
+		HL_ASSERT(frame < m_Capacities.size());
+
+		uint32 requiredCapacity = utils::GetPaletteCapacity((uint32)m_BoneTransforms.size());
+		if (m_Capacities[frame] == 0)
+		{
+			Ref<StorageBuffer> storageBuffer = StorageBuffer::Create(requiredCapacity * sizeof(glm::mat4), binding);
+			storageBufferSet->SetStorage(storageBuffer, 0, frame);
+			m_Capacities[frame] = requiredCapacity;
+			m_UploadedSignatures[frame] = 0;
+		}
+		else if (m_Capacities[frame] < requiredCapacity)
+		{
+			storageBufferSet->GetStorage(binding, 0, frame)->Resize(requiredCapacity * sizeof(glm::mat4));
+			m_Capacities[frame] = requiredCapacity;
+			m_UploadedSignatures[frame] = 0;
+		}
+
+		if (m_BoneTransforms.empty() || (!m_HasUnversionedData && m_UploadedSignatures[frame] == m_Signature))
+			return false;
+
+		storageBufferSet->GetStorage(binding, 0, frame)->SetData(m_BoneTransforms.data(), (uint32)(m_BoneTransforms.size() * sizeof(glm::mat4)));
+		m_UploadedSignatures[frame] = m_Signature;
+		return true;
+	}
+}
+
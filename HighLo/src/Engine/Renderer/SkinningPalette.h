@@ -0,0 +1,65 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "Engine/Core/Core.h"
+#include "Engine/Graphics/Shaders/StorageBufferSet.h"
+
+namespace highlo
+{
+	/// <summary>
+	/// Packs the skinning matrices of all skinned instances of a frame into one contiguous array,
+	/// which is uploaded into a single storage buffer per frame in flight.
+	/// Every instance only occupies as many matrices as its skeleton actually uses, the shaders address
+	/// the matrices of an instance by the offset that has been returned by Add.
+	///
+	/// Every palette range carries the id and version of its source. If all ranges of a frame are the same
+	/// as the last time the storage buffer of that frame has been written, the upload is skipped.
+	/// </summary>
+	class SkinningPalette
+	{
+	public:
+
+		HLAPI SkinningPalette(uint32 framesInFlight = 1);
+
+		/// <summary>
+		/// Removes all ranges, has to be called before the ranges of a new frame are added.
+		/// </summary>
+		HLAPI void Begin();
+
+		/// <summary>
+		/// Appends the bone transforms of one instance and returns the offset of the first matrix inside the palette.
+		/// A sourceID of 0 marks data without a version, which is always considered to be changed.
+		/// </summary>
+		HLAPI uint32 Add(const glm::mat4 *boneTransforms, uint32 boneCount, uint64 sourceID = 0, uint64 version = 0);
+
+		/// <summary>
+		/// Writes the palette into the storage buffer of the given frame, the storage buffer is created or grown if necessary.
+		/// The storage buffer is created even if the palette is empty, so that it can always be bound.
+		/// </summary>
+		/// <returns>Returns false, if the storage buffer already contained the same data and the upload has been skipped.</returns>
+		HLAPI bool Upload(const Ref<StorageBufferSet> &storageBufferSet, uint32 binding, uint32 frame);
+
+		HLAPI uint32 GetBoneCount() const { return (uint32)m_BoneTransforms.size(); }
+		HLAPI const std::vector<glm::mat4> &GetBoneTransforms() const { return m_BoneTransforms; }
+
+	private:
+
+		std::vector<glm::mat4> m_BoneTransforms;
+		uint64 m_Signature = 0;
+		bool m_HasUnversionedData = false;
+
+		// Per frame in flight
+		std::vector<uint64> m_UploadedSignatures;
+		std::vector<uint32> m_Capacities;
+	};
+}
+
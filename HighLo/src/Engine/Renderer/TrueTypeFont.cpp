@@ -8,8 +8,8 @@
 
 namespace highlo
 {
-	TrueTypeFont::TrueTypeFont(const FileSystemPath &filePath, uint16 size)
-		: m_AssetPath(filePath)
+	TrueTypeFont::TrueTypeFont(const FileSystemPath &filePath, uint16 size, bool createResources)
+		: m_AssetPath(filePath), m_ResourcesCreated(createResources)
 	{
 		m_Name = filePath.Filename();
 
@@ -225,18 +225,15 @@ namespace highlo
 			codepoint_data.Codepoints[i + 1] = i + 32;
 		}
 
-		TextureSpecification spec;
-		spec.Format = TextureFormat::RGBA;
-		spec.Width = (uint32)out_variant->AtlasSizeX;
-		spec.Height = (uint32)out_variant->AtlasSizeY;
-		spec.Properties.SamplerFilter = TextureFilter::Linear;
-		spec.Properties.SamplerWrap = TextureWrap::Clamp;
-		spec.Usage = TextureUsage::FontAtlas;
-		out_variant->Atlas = Texture2D::CreateFromSpecification(spec);
-		if (!out_variant->Atlas)
+		// Without a renderer the atlas is created by CreateResources, until then the packed pixels are kept
+		if (m_ResourcesCreated)
 		{
-			HL_CORE_ERROR("Could not create texture font atlas!");
-			return false;
+			out_variant->Atlas = CreateAtlas(out_variant);
+			if (!out_variant->Atlas)
+			{
+				HL_CORE_ERROR("Could not create texture font atlas!");
+				return false;
+			}
 		}
 
 		codepoint_data.Scale = stbtt_ScaleForPixelHeight(&data.Info, (float)size);
@@ -292,7 +289,26 @@ namespace highlo
 
 
 		// Store the pixel values inside the texture class
-		variant->Atlas->SetData((void*)rgba_pixels, pack_image_size * 4);
+		if (m_ResourcesCreated)
+		{
+			variant->Atlas->SetData((void*)rgba_pixels, pack_image_size * 4);
+		}
+		else
+		{
+			auto pending = std::find_if(m_PendingAtlases.begin(), m_PendingAtlases.end(), [variant](const PendingAtlas &atlas)
+			{
+				return atlas.Face == variant->Face && atlas.Size == variant->Size;
+			});
+
+			if (pending == m_PendingAtlases.end())
+			{
+				pending = m_PendingAtlases.emplace(m_PendingAtlases.end());
+				pending->Face = variant->Face;
+				pending->Size = variant->Size;
+			}
+
+			pending->Pixels.assign(rgba_pixels, rgba_pixels + pack_image_size * 4);
+		}
 		free(rgba_pixels);
 		free(pixels);
 
@@ -415,6 +431,63 @@ namespace highlo
 		return true;
 	}
 
+	bool TrueTypeFont::CreateResources()
+	{
+		if (m_ResourcesCreated)
+			return true;
+
+		m_ResourcesCreated = true;
+
+		bool created = true;
+		for (PendingAtlas &pending : m_PendingAtlases)
+		{
+			// Variants that failed to load have not been added to the font
+			FontData *variant = FindFontVariant(pending.Face, pending.Size);
+			if (!variant)
+				continue;
+
+			variant->Atlas = CreateAtlas(variant);
+			if (!variant->Atlas)
+			{
+				HL_CORE_ERROR("Could not create texture font atlas!");
+				created = false;
+				continue;
+			}
+
+			variant->Atlas->SetData((void*)pending.Pixels.data(), (uint32)pending.Pixels.size());
+		}
+
+		m_PendingAtlases.clear();
+		return created;
+	}
+
+	Ref<Texture2D> TrueTypeFont::CreateAtlas(const FontData *variant) const
+	{
+		TextureSpecification spec;
+		spec.Format = TextureFormat::RGBA;
+		spec.Width = (uint32)variant->AtlasSizeX;
+		spec.Height = (uint32)variant->AtlasSizeY;
+		spec.Properties.SamplerFilter = TextureFilter::Linear;
+		spec.Properties.SamplerWrap = TextureWrap::Clamp;
+		spec.Usage = TextureUsage::FontAtlas;
+		return Texture2D::CreateFromSpecification(spec);
+	}
+
+	FontData *TrueTypeFont::FindFontVariant(const HLString &face, uint16 size)
+	{
+		uint16 id = HL_INVALID_ID_U16;
+		if (!m_FontIds.Get(face, &id) || id == HL_INVALID_ID_U16)
+			return nullptr;
+
+		for (FontData &variant : m_Fonts[id].SizeVariants)
+		{
+			if (variant.Size == size)
+				return &variant;
+		}
+
+		return nullptr;
+	}
+
 	const FontData *TrueTypeFont::GetDefaultFontFace() const
 	{
 		if (m_Fonts.size() > 0)
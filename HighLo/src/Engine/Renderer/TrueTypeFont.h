@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) The atlas textures can be created after the font has been loaded
 //     - 1.0 (2023-01-29) initial release
 //
 
@@ -52,7 +53,10 @@ namespace highlo
 	{
 	public:
 
-		TrueTypeFont(const FileSystemPath &filePath, uint16 size);
+		/// <summary>
+		/// Loads the font and packs the glyphs of the default size. Without createResources the packed atlases are kept until CreateResources() is called.
+		/// </summary>
+		TrueTypeFont(const FileSystemPath &filePath, uint16 size, bool createResources = true);
 		virtual ~TrueTypeFont();
 
 		virtual FileSystemPath &GetAssetPath() override { return m_AssetPath; }
@@ -73,8 +77,20 @@ namespace highlo
 		virtual int32 GetLineHeight() const override;
 		virtual float GetTabXAdvance() const override;
 
+		virtual bool CreateResources() override;
+
 	private:
 
+		/// <summary>
+		/// The RGBA pixels of an atlas, that has been packed before the atlas texture has been created.
+		/// </summary>
+		struct PendingAtlas
+		{
+			HLString Face;
+			uint16 Size = 0;
+			std::vector<uint8> Pixels;
+		};
+
 		bool LoadFont(uint32 default_size);
 		bool SetupFontData(FontData *variant, uint16 font_size);
 		void CleanupFontData(FontData *variant);
@@ -83,6 +99,9 @@ namespace highlo
 		bool RebuildFontVariantAtlas(TrueTypeFontData data, FontData *variant);
 		bool VerifyFontSizeVariant(TrueTypeFontData data, FontData *variant, const HLString &text);
 
+		Ref<Texture2D> CreateAtlas(const FontData *variant) const;
+		FontData *FindFontVariant(const HLString &face, uint16 size);
+
 		const FontData *GetDefaultFontFace() const;
 
 	private:
@@ -93,6 +112,9 @@ namespace highlo
 		HashTable<uint16> m_FontIds; // Contains all font ids
 		std::vector<TrueTypeFontData> m_Fonts;
 
+		bool m_ResourcesCreated = false;
+		std::vector<PendingAtlas> m_PendingAtlases;
+
 		FontData m_TEMP;
 	};
 }
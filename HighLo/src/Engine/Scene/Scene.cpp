@@ -474,7 +474,7 @@ namespace highlo
 		}
 
 		entity.SetParentUUID(parent.GetUUID());
-		parent.Children().push_back(entity.GetUUID());
+		parent.Children().PushBack(entity.GetUUID());
 		ConvertToLocalSpace(entity);
 	}
 	
@@ -486,8 +486,7 @@ namespace highlo
 		if (!parent)
 			return;
 
-		auto &parentChildren = parent.Children();
-		parentChildren.erase(std::remove(parentChildren.begin(), parentChildren.end(), entity.GetUUID()), parentChildren.end());
+		parent.Children().RemoveValue(entity.GetUUID());
 
 		if (convertToWorldSpace)
 			ConvertToWorldSpace(entity);
@@ -623,7 +622,7 @@ namespace highlo
 
 		if (!excludeChildren)
 		{
-			for (uint32 i = 0; i < (uint32)entity.Children().size(); ++i)
+			for (uint32 i = 0; i < entity.Children().Size(); ++i)
 			{
 				auto childId = entity.Children()[i];
 				Entity child = FindEntityByUUID(childId);
@@ -661,7 +660,7 @@ namespace highlo
 			UnparentEntity(childDuplicate, false);
 
 			childDuplicate.SetParentUUID(newEntity.GetUUID());
-			newEntity.Children().push_back(childDuplicate.GetUUID());
+			newEntity.Children().PushBack(childDuplicate.GetUUID());
 		}
 
 		if (entity.HasParent())
@@ -670,7 +669,7 @@ namespace highlo
 			HL_ASSERT(parent, "Failed to find parent entity");
 
 			newEntity.SetParentUUID(entity.GetParentUUID());
-			parent.Children().push_back(newEntity.GetUUID());
+			parent.Children().PushBack(newEntity.GetUUID());
 		}
 
 		return newEntity;
@@ -1,6 +1,8 @@
 #include "HighLoPch.h"
 #include "AssimpMeshLoader.h"
 
+#include <mutex>
+
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
@@ -21,19 +23,16 @@ namespace highlo
 			result[0][3] = matrix.d1; result[1][3] = matrix.d2; result[2][3] = matrix.d3; result[3][3] = matrix.d4;
 			return result;
 		}
-
-		static FileSystemPath GetTexturePath(const FileSystemPath &rootPath, const HLString &newPath)
-		{
-			FileSystemPath parent = rootPath.ParentPath();
-			parent /= newPath;
-			return parent;
-		}
 	}
 
 	struct LogStream : public Assimp::LogStream
 	{
 		static void Initialize()
 		{
+			// Meshes are decoded on several worker threads at the same time
+			static std::mutex s_Mutex;
+			std::lock_guard<std::mutex> lock(s_Mutex);
+
 			if (Assimp::DefaultLogger::isNullLogger())
 			{
 				Assimp::DefaultLogger::create("", Assimp::Logger::VERBOSE);
@@ -47,13 +46,13 @@ namespace highlo
 		}
 	};
 
-	AssimpMeshLoader::AssimpMeshLoader(const FileSystemPath &filePath, const Ref<Shader> &shader)
+	AssimpMeshLoader::AssimpMeshLoader(const FileSystemPath &filePath)
 		: m_FilePath(filePath)
 	{
 		LogStream::Initialize();
 
 		m_Importer = UniqueRef<Assimp::Importer>::Create();
-		const aiScene *scene = m_Importer->ReadFile(*filePath.String(), m_MeshImportFlags);
+		const aiScene *scene = m_Importer->ReadFile(*filePath.String(), MeshImportFlags);
 		if (!scene || !scene->HasMeshes())
 			return;
 
@@ -168,267 +167,165 @@ namespace highlo
 													m_StaticVertices[index.P3 + submesh.BaseVertex]);
 				}
 			}
+		}
 
-			// Load Animation
-			TraverseNodes(scene->mRootNode);
+		// Load Animation
+		TraverseNodes(scene->mRootNode);
 
-			// update correct bounding box
-			for (const auto &submesh : m_Submeshes)
-			{
-				AABB transformedSubmeshAABB = submesh.BoundingBox;
-				glm::vec3 min = glm::vec3(submesh.WorldTransform.GetTransform() * glm::vec4(transformedSubmeshAABB.Min, 1.0f));
-				glm::vec3 max = glm::vec3(submesh.WorldTransform.GetTransform() * glm::vec4(transformedSubmeshAABB.Max, 1.0f));
+		// update correct bounding box
+		for (const auto &submesh : m_Submeshes)
+		{
+			AABB transformedSubmeshAABB = submesh.BoundingBox;
+			glm::vec3 min = glm::vec3(submesh.WorldTransform.GetTransform() * glm::vec4(transformedSubmeshAABB.Min, 1.0f));
+			glm::vec3 max = glm::vec3(submesh.WorldTransform.GetTransform() * glm::vec4(transformedSubmeshAABB.Max, 1.0f));
 
-				m_BoundingBox.Min.x = glm::min(m_BoundingBox.Min.x, min.x);
-				m_BoundingBox.Min.y = glm::min(m_BoundingBox.Min.y, min.y);
-				m_BoundingBox.Min.z = glm::min(m_BoundingBox.Min.z, min.z);
+			m_BoundingBox.Min.x = glm::min(m_BoundingBox.Min.x, min.x);
+			m_BoundingBox.Min.y = glm::min(m_BoundingBox.Min.y, min.y);
+			m_BoundingBox.Min.z = glm::min(m_BoundingBox.Min.z, min.z);
 
-				m_BoundingBox.Max.x = glm::max(m_BoundingBox.Max.x, max.x);
-				m_BoundingBox.Max.y = glm::max(m_BoundingBox.Max.y, max.y);
-				m_BoundingBox.Max.z = glm::max(m_BoundingBox.Max.z, max.z);
-			}
+			m_BoundingBox.Max.x = glm::max(m_BoundingBox.Max.x, max.x);
+			m_BoundingBox.Max.y = glm::max(m_BoundingBox.Max.y, max.y);
+			m_BoundingBox.Max.z = glm::max(m_BoundingBox.Max.z, max.z);
+		}
 
-			// Load Single bones
-			if (m_IsAnimated)
+		// Load Single bones
+		if (m_IsAnimated)
+		{
+			for (uint32 i = 0; i < scene->mNumMeshes; ++i)
 			{
-				for (uint32 i = 0; i < scene->mNumMeshes; ++i)
+				aiMesh *mesh = scene->mMeshes[i];
+				Mesh &submesh = m_Submeshes[i];
+
+				for (uint32 j = 0; j < mesh->mNumBones; ++j)
 				{
-					aiMesh *mesh = scene->mMeshes[i];
-					Mesh &submesh = m_Submeshes[i];
+					aiBone *bone = mesh->mBones[j];
+					HLString boneName(bone->mName.data);
+					int32 boneIndex = 0;
 
-					for (uint32 j = 0; j < mesh->mNumBones; ++j)
+					if (m_BoneMapping.find(boneName) == m_BoneMapping.end())
 					{
-						aiBone *bone = mesh->mBones[j];
-						HLString boneName(bone->mName.data);
-						int32 boneIndex = 0;
-
-						if (m_BoneMapping.find(boneName) == m_BoneMapping.end())
-						{
-							boneIndex = m_BoneCount;
-							++m_BoneCount;
-							BoneInfo bi;
-							m_BoneInfos.push_back(bi);
-							m_BoneInfos[boneIndex].BoneOffset.SetTransform(utils::Mat4FromAssimp(bone->mOffsetMatrix));
-							m_BoneMapping[boneName] = boneIndex;
-						}
-						else
-						{
-							boneIndex = m_BoneMapping[boneName];
-						}
+						boneIndex = m_BoneCount;
+						++m_BoneCount;
+						BoneInfo bi;
+						m_BoneInfos.push_back(bi);
+						m_BoneInfos[boneIndex].BoneOffset.SetTransform(utils::Mat4FromAssimp(bone->mOffsetMatrix));
+						m_BoneMapping[boneName] = boneIndex;
+					}
+					else
+					{
+						boneIndex = m_BoneMapping[boneName];
+					}
 
-						for (uint32 j = 0; j < bone->mNumWeights; ++j)
-						{
-							int32 id = submesh.BaseVertex + bone->mWeights[j].mVertexId;
-							float weight = bone->mWeights[j].mWeight;
-							m_AnimatedVertices[id].AddBone(boneIndex, weight);
-						}
+					for (uint32 j = 0; j < bone->mNumWeights; ++j)
+					{
+						int32 id = submesh.BaseVertex + bone->mWeights[j].mVertexId;
+						float weight = bone->mWeights[j].mWeight;
+						m_AnimatedVertices[id].AddBone(boneIndex, weight);
 					}
 				}
 			}
+		}
 
-			// Load Materials
-			Ref<Texture2D> whiteTex = Renderer::GetWhiteTexture();
-			if (scene->HasMaterials())
-			{
-				m_Textures.resize(scene->mNumMaterials);
-				m_Materials.resize(scene->mNumMaterials);
-
-				for (uint32 i = 0; i < scene->mNumMaterials; ++i)
-				{
-					auto aiMaterial = scene->mMaterials[i];
-					auto aiMaterialName = aiMaterial->GetName();
-
-					auto mi = Material::Create(shader, aiMaterialName.data);
-					m_Materials[i] = mi;
-
-					aiString aiTexPath;
-					uint32 textureCount = aiMaterial->GetTextureCount(aiTextureType_DIFFUSE);
-
-					glm::vec3 diffuseColor(0.0f);
-					float emission = 0.0f;
-					aiColor3D aiColor, aiEmission;
-					float shininess, metalness, roughness;
-
-					// Load fallback colors
-
-					// Diffuse and emission
-					if (aiMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, aiColor) == AI_SUCCESS)
-						diffuseColor = { aiColor.r, aiColor.g, aiColor.b };
-
-					if (aiMaterial->Get(AI_MATKEY_COLOR_EMISSIVE, aiEmission) == AI_SUCCESS)
-						emission = aiEmission.r;
-
-					mi->Set("u_MaterialUniforms.DiffuseColor", diffuseColor);
-					mi->Set("u_MaterialUniforms.Emission", emission);
+		// Load Materials, the texture maps are only decoded here and uploaded together with the materials in CreateResources()
+		if (scene->HasMaterials())
+		{
+			m_MaterialDescriptions.resize(scene->mNumMaterials);
 
-					// Shininess and metalness
-					if (aiMaterial->Get(AI_MATKEY_SHININESS, shininess) != aiReturn_SUCCESS)
-						shininess = 80.0f;
+			for (uint32 i = 0; i < scene->mNumMaterials; ++i)
+			{
+				auto aiMaterial = scene->mMaterials[i];
+				auto aiMaterialName = aiMaterial->GetName();
 
-					if (aiMaterial->Get(AI_MATKEY_REFLECTIVITY, metalness) != aiReturn_SUCCESS)
-						metalness = 0.0f;
+				MeshMaterialDescription &description = m_MaterialDescriptions[i];
+				description = MeshMaterialDescription();
+				description.Name = aiMaterialName.data;
 
-					// Roughness
-					roughness = 1.0f - glm::sqrt(shininess / 100.0f);
+				aiString aiTexPath;
+				aiColor3D aiColor, aiEmission;
+				float shininess, metalness;
 
-					// Load real texture maps
+				// Load fallback colors
 
-					// Diffuse
-					bool hasDiffuseMap = aiMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &aiTexPath) == AI_SUCCESS;
-					bool useFallback = !hasDiffuseMap;
+				// Diffuse and emission
+				description.DiffuseColor = glm::vec3(0.0f);
+				if (aiMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, aiColor) == AI_SUCCESS)
+					description.DiffuseColor = { aiColor.r, aiColor.g, aiColor.b };
 
-					if (hasDiffuseMap)
-					{
-						FileSystemPath texturePath = utils::GetTexturePath(filePath, aiTexPath.data);
-						HL_CORE_TRACE("Loading Diffuse Map: {0}", *texturePath);
+				if (aiMaterial->Get(AI_MATKEY_COLOR_EMISSIVE, aiEmission) == AI_SUCCESS)
+					description.Emission = aiEmission.r;
 
-						// SRGB Texture
-						Ref<Texture2D> tex = Texture2D::LoadFromFile(texturePath);
-						tex->GetSpecification().Format = TextureFormat::SRGB;
-						if (tex->IsLoaded())
-						{
-							m_Textures[i] = tex;
-							mi->Set("u_DiffuseTexture", tex);
-							mi->Set("u_MaterialUniforms.DiffuseColor", glm::vec3(1.0f));
-						}
-						else
-						{
-							HL_CORE_ERROR("Could not load texture: {0}", **texturePath);
-							m_Textures[i] = whiteTex;
-							useFallback = true;
-						}
-					}
+				// Shininess and metalness
+				if (aiMaterial->Get(AI_MATKEY_SHININESS, shininess) != aiReturn_SUCCESS)
+					shininess = 80.0f;
 
-					if (useFallback)
-					{
-						mi->Set("u_DiffuseTexture", whiteTex);
-					}
+				if (aiMaterial->Get(AI_MATKEY_REFLECTIVITY, metalness) != aiReturn_SUCCESS)
+					metalness = 0.0f;
 
-					// Normal
-					bool hasNormalMap = aiMaterial->GetTexture(aiTextureType_NORMALS, 0, &aiTexPath) == AI_SUCCESS;
-					useFallback = !hasNormalMap;
+				// Roughness
+				description.Roughness = 1.0f - glm::sqrt(shininess / 100.0f);
+				description.Metalness = metalness;
 
-					if (hasNormalMap)
-					{
-						FileSystemPath texturePath = utils::GetTexturePath(filePath, aiTexPath.data);
-						HL_CORE_TRACE("Loading Normal Map: {0}", **texturePath);
+				// Load real texture maps, a map is only part of the description if it could be decoded
 
-						Ref<Texture2D> tex = Texture2D::LoadFromFile(texturePath);
-						if (tex->IsLoaded())
-						{
-							m_Textures.push_back(tex);
-							m_NormalMaps.push_back(tex);
-							mi->Set("u_NormalTexture", tex);
-							mi->Set("u_MaterialUniforms.UseNormalMap", true);
-						}
-						else
-						{
-							HL_CORE_ERROR("Could not load texture: {0}", **texturePath);
-							useFallback = true;
-						}
-					}
-
-					if (useFallback)
-					{
-						mi->Set("u_NormalTexture", whiteTex);
-						mi->Set("u_MaterialUniforms.UseNormalMap", false);
-					}
-
-					// Roughness
-					bool hasRoughnessMap = aiMaterial->GetTexture(aiTextureType_SHININESS, 0, &aiTexPath) == AI_SUCCESS;
-					useFallback = !hasRoughnessMap;
+				// Diffuse
+				if (aiMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &aiTexPath) == AI_SUCCESS && m_MaterialTextures.Decode(filePath, aiTexPath.data))
+				{
+					description.DiffuseColor = glm::vec3(1.0f);
+					description.DiffuseMap = aiTexPath.data;
+				}
 
-					if (hasRoughnessMap)
-					{
-						FileSystemPath texturePath = utils::GetTexturePath(filePath, aiTexPath.data);
-						HL_CORE_TRACE("Loading Roughness Map: {0}", **texturePath);
+				// Normal
+				if (aiMaterial->GetTexture(aiTextureType_NORMALS, 0, &aiTexPath) == AI_SUCCESS && m_MaterialTextures.Decode(filePath, aiTexPath.data))
+					description.NormalMap = aiTexPath.data;
 
-						Ref<Texture2D> tex = Texture2D::LoadFromFile(texturePath);
-						if (tex->IsLoaded())
-						{
-							m_Textures.push_back(tex);
-							mi->Set("u_RoughnessTexture", tex);
-							mi->Set("u_MaterialUniforms.Roughness", 1.0f);
-						}
-						else
-						{
-							HL_CORE_ERROR("Could not load texture: {0}", **texturePath);
-							useFallback = true;
-						}
-					}
+				// Roughness
+				if (aiMaterial->GetTexture(aiTextureType_SHININESS, 0, &aiTexPath) == AI_SUCCESS && m_MaterialTextures.Decode(filePath, aiTexPath.data))
+				{
+					description.Roughness = 1.0f;
+					description.RoughnessMap = aiTexPath.data;
+				}
 
-					if (useFallback)
+				// Metalness
+				for (uint32 j = 0; j < aiMaterial->mNumProperties; ++j)
+				{
+					auto property = aiMaterial->mProperties[j];
+					if (property->mType == aiPTI_String)
 					{
-						mi->Set("u_RoughnessTexture", whiteTex);
-						mi->Set("u_MaterialUniforms.Roughness", roughness);
-					}
+						uint32 strLength = *(uint32*)property->mData;
+						HLString str(property->mData + 4, strLength);
+						HLString key = property->mKey.data;
 
-					// Metalness
-					bool metalnessTextureFound = false;
-					for (uint32 j = 0; j < aiMaterial->mNumProperties; ++j)
-					{
-						auto property = aiMaterial->mProperties[j];
-						if (property->mType == aiPTI_String)
+						if (key == "$raw.ReflectionFactor|file" && m_MaterialTextures.Decode(filePath, str))
 						{
-							uint32 strLength = *(uint32*)property->mData;
-							HLString str(property->mData + 4, strLength);
-							HLString key = property->mKey.data;
-
-							if (key == "$raw.ReflectionFactor|file")
-							{
-								FileSystemPath texturePath = utils::GetTexturePath(filePath, str);
-								Ref<Texture2D> tex = Texture2D::LoadFromFile(texturePath);
-								if (tex->IsLoaded())
-								{
-									metalnessTextureFound = true;
-									m_Textures.push_back(tex);
-									mi->Set("u_MetalnessTexture", tex);
-									mi->Set("u_MaterialUniforms.Metalness", 1.0f);
-								}
-								else
-								{
-									HL_CORE_ERROR("Could not load texture: {0}", **texturePath);
-								}
-							}
+							description.Metalness = 1.0f;
+							description.MetalnessMap = str;
 						}
 					}
-
-					useFallback = !metalnessTextureFound;
-					if (useFallback)
-					{
-						mi->Set("u_MetalnessTexture", whiteTex);
-						mi->Set("u_MaterialUniforms.Metalness", metalness);
-					}
 				}
 			}
-			else
-			{
-				auto mi = Material::Create(shader, "HighLo-Default-Material");
-				mi->Set("u_MaterialUniforms.DiffuseColor", glm::vec3(0.8f));
-				mi->Set("u_MaterialUniforms.Emission", 0.0f);
-				mi->Set("u_MaterialUniforms.Metalness", 0.0f);
-				mi->Set("u_MaterialUniforms.Roughness", 0.8f);
-				mi->Set("u_MaterialUniforms.UseNormalMap", false);
-
-				mi->Set("u_AlbedoTexture", whiteTex);
-				mi->Set("u_MetalnessTexture", whiteTex);
-				mi->Set("u_RoughnessTexture", whiteTex);
-				m_Materials.push_back(mi);
-			}
+		}
+		else
+		{
+			MeshMaterialDescription description;
+			description.Name = "HighLo-Default-Material";
+			m_MaterialDescriptions.push_back(description);
+		}
 
-			if (m_IsAnimated)
-			{
-				m_Layout = BufferLayout::GetAnimatedShaderLayout();
-				m_VertexBuffer = VertexBuffer::Create(m_AnimatedVertices.data(), (uint32)(m_AnimatedVertices.size() * sizeof(AnimatedVertex)));
-			}
-			else
-			{
-				m_Layout = BufferLayout::GetStaticShaderLayout();
-				m_VertexBuffer = VertexBuffer::Create(m_StaticVertices.data(), (uint32)(m_StaticVertices.size() * sizeof(Vertex)));
-			}
+		m_Layout = m_IsAnimated ? BufferLayout::GetAnimatedShaderLayout() : BufferLayout::GetStaticShaderLayout();
+	}
 
-			m_IndexBuffer = IndexBuffer::Create(m_Indices.data(), (uint32)(m_Indices.size() * sizeof(VertexIndex)));
-		}
+	void AssimpMeshLoader::CreateResources(const Ref<Shader> &shader)
+	{
+		if (m_Submeshes.empty() || m_VertexBuffer)
+			return;
+
+		if (m_IsAnimated)
+			m_VertexBuffer = VertexBuffer::Create(m_AnimatedVertices.data(), (uint32)(m_AnimatedVertices.size() * sizeof(AnimatedVertex)));
+		else
+			m_VertexBuffer = VertexBuffer::Create(m_StaticVertices.data(), (uint32)(m_StaticVertices.size() * sizeof(Vertex)));
+
+		m_IndexBuffer = IndexBuffer::Create(m_Indices.data(), (uint32)(m_Indices.size() * sizeof(VertexIndex)));
+		m_MaterialTextures.CreateMaterials(shader, m_MaterialDescriptions, m_Materials, m_Textures, m_NormalMaps);
 	}
 
 	AssimpMeshLoader::~AssimpMeshLoader()
@@ -24,7 +24,10 @@ namespace highlo
 	{
 	public:
 
-		AssimpMeshLoader(const FileSystemPath &filePath, const Ref<Shader> &shader);
+		/// <summary>
+		/// Imports the mesh and decodes its texture maps, no GPU resources are created until CreateResources() is called.
+		/// </summary>
+		AssimpMeshLoader(const FileSystemPath &filePath);
 		virtual ~AssimpMeshLoader();
 		
 		// Draw data
@@ -36,6 +39,7 @@ namespace highlo
 		const std::vector<Ref<Material>> &GetMaterials() const override { return m_Materials; }
 		const std::vector<Ref<Texture2D>> &GetTextures() const override { return m_Textures; }
 		virtual const std::vector<Ref<Texture2D>> &GetNormalMaps() const override { return m_NormalMaps; }
+		virtual const std::vector<MeshMaterialDescription> &GetMaterialDescriptions() const override { return m_MaterialDescriptions; }
 
 		// Anim
 		const glm::mat4 &GetInverseTransform() const override { return m_InverseTransform; }
@@ -59,6 +63,18 @@ namespace highlo
 
 		virtual void ManipulateBoneTransform(float time, std::vector<glm::mat4> &outTransforms) override;
 
+		virtual void CreateResources(const Ref<Shader> &shader) override;
+
+		static constexpr uint32 MeshImportFlags =
+			aiProcess_CalcTangentSpace |        // Create binormals/tangents just in case
+			aiProcess_Triangulate |             // Make sure we're triangles
+			aiProcess_SortByPType |             // Split meshes by primitive type
+			aiProcess_GenNormals |              // Make sure we have legit normals
+			aiProcess_GenUVCoords |             // Convert UVs if required 
+			aiProcess_OptimizeMeshes |          // Batch draws where possible
+			aiProcess_JoinIdenticalVertices |
+			aiProcess_ValidateDataStructure;    // Validation
+
 	private:
 
 		void BoneTransform(float time);
@@ -97,6 +113,8 @@ namespace highlo
 		std::vector<Ref<Material>> m_Materials;
 		std::vector<Ref<Texture2D>> m_Textures;
 		std::vector<Ref<Texture2D>> m_NormalMaps;
+		std::vector<MeshMaterialDescription> m_MaterialDescriptions;
+		MeshMaterialTextures m_MaterialTextures;
 
 		// Anim
 		uint32 m_BoneCount = 0;
@@ -106,16 +124,6 @@ namespace highlo
 		float m_AnimationDuration = 0.0f;
 		float m_TicksPerSecond = 0.0f;
 		AABB m_BoundingBox;
-
-		uint32 m_MeshImportFlags = 
-			aiProcess_CalcTangentSpace |        // Create binormals/tangents just in case
-			aiProcess_Triangulate |             // Make sure we're triangles
-			aiProcess_SortByPType |             // Split meshes by primitive type
-			aiProcess_GenNormals |              // Make sure we have legit normals
-			aiProcess_GenUVCoords |             // Convert UVs if required 
-			aiProcess_OptimizeMeshes |          // Batch draws where possible
-			aiProcess_JoinIdenticalVertices |
-			aiProcess_ValidateDataStructure;    // Validation
 	};
 }
 
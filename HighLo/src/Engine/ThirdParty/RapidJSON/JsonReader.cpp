@@ -4,10 +4,14 @@
 #include "JsonReader.h"
 
 #include "Engine/Core/FileSystem.h"
+#include "Engine/Core/MappedFile.h"
 #include "Engine/Utils/LoaderUtils.h"
 #include "JsonHelper.h"
 
 #include <rapidjson/filereadstream.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/error/en.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/prettywriter.h>
@@ -17,6 +21,35 @@
 
 namespace highlo
 {
+	namespace utils
+	{
+		/// <summary>
+		/// Forwards the events of the RapidJSON SAX reader to a DocumentStreamHandler.
+		/// </summary>
+		struct JsonStreamAdapter : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JsonStreamAdapter>
+		{
+			DocumentStreamHandler &Handler;
+
+			JsonStreamAdapter(DocumentStreamHandler &handler)
+				: Handler(handler) {}
+
+			bool Null() { return Handler.OnNull(); }
+			bool Bool(bool value) { return Handler.OnBool(value); }
+			bool Int(int value) { return Handler.OnInt64(value); }
+			bool Uint(unsigned value) { return Handler.OnUInt64(value); }
+			bool Int64(int64_t value) { return Handler.OnInt64(value); }
+			bool Uint64(uint64_t value) { return Handler.OnUInt64(value); }
+			bool Double(double value) { return Handler.OnDouble(value); }
+			bool String(const char *str, rapidjson::SizeType length, bool copy) { return Handler.OnString(str, length); }
+
+			bool Key(const char *str, rapidjson::SizeType length, bool copy) { return Handler.OnKey(str, length); }
+			bool StartObject() { return Handler.OnBeginObject(); }
+			bool EndObject(rapidjson::SizeType memberCount) { return Handler.OnEndObject(memberCount); }
+			bool StartArray() { return Handler.OnBeginArray(); }
+			bool EndArray(rapidjson::SizeType elementCount) { return Handler.OnEndArray(elementCount); }
+		};
+	}
+
 	JsonReader::JsonReader(const FileSystemPath &filePath)
 		: m_FilePath(filePath)
 	{
@@ -884,12 +917,17 @@ namespace highlo
 		if (FileSystem::Get()->FileExists(m_FilePath))
 		{
 			HL_CORE_INFO(JSON_LOG_PREFIX "[+] Loaded {0} [+]", **m_FilePath);
-			HLString content = FileSystem::Get()->ReadTextFile(m_FilePath);
-			if (content.IsEmpty())
+
+			MappedFile file(m_FilePath, MappedFileAccess::Sequential);
+			if (!file || file.GetSize() == 0)
 				return false;
 
-			m_Document.Parse(*content);
-			return true;
+			// One copy of the whole file is cheaper than allocating every string of the document separately
+			m_Buffer.resize(file.GetSize() + 1);
+			memcpy(m_Buffer.data(), file.GetText(), file.GetSize());
+			m_Buffer.back() = '\0';
+
+			return ParseBuffer();
 		}
 		else
 		{
@@ -921,10 +959,54 @@ namespace highlo
 	
 	void JsonReader::SetContent(const HLString &content)
 	{
-		m_Document.Parse(*content);
+		m_Buffer.assign(*content, *content + content.Length());
+		m_Buffer.push_back('\0');
+		ParseBuffer();
+	}
+
+	bool JsonReader::ReadStream(DocumentStreamHandler &handler, const FileSystemPath &filePath)
+	{
+		const FileSystemPath &path = filePath.String().IsEmpty() ? m_FilePath : filePath;
+
+		MappedFile file(path, MappedFileAccess::Sequential);
+		if (!file)
+		{
+			HL_CORE_ERROR(JSON_LOG_PREFIX "[-] Error: File {0} not found! [-]", **path);
+			return false;
+		}
+
+		// The file is parsed straight from the mapping, the pages are read ahead and released by the OS while the parser moves through them
+		rapidjson::MemoryStream stream(file.GetText(), (size_t)file.GetSize());
+		utils::JsonStreamAdapter adapter(handler);
+
+		rapidjson::Reader reader;
+		rapidjson::ParseResult result = reader.Parse<rapidjson::kParseDefaultFlags>(stream, adapter);
+		if (result.IsError())
+		{
+			// The termination is requested by the handler and is no error of the file
+			if (result.Code() != rapidjson::kParseErrorTermination)
+				HL_CORE_ERROR(JSON_LOG_PREFIX "[-] Error: Failed to parse {0} at offset {1}: {2} [-]", **path, result.Offset(), rapidjson::GetParseError_En(result.Code()));
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool JsonReader::ParseBuffer()
+	{
+		m_Document.ParseInsitu(m_Buffer.data());
+		if (m_Document.HasParseError())
+		{
+			HL_CORE_ERROR(JSON_LOG_PREFIX "[-] Error: Failed to parse {0} at offset {1}: {2} [-]", **m_FilePath, m_Document.GetErrorOffset(), rapidjson::GetParseError_En(m_Document.GetParseError()));
+			return false;
+		}
+
+		return true;
 	}
 	
-	bool JsonReader::Read(const HLString &key, DocumentDataType type, const std::function<bool(rapidjson::Value&)> &insertFunc)
+	template<typename InsertFunc>
+	bool JsonReader::Read(const HLString &key, DocumentDataType type, InsertFunc &&insertFunc)
 	{
 		if (m_Document.IsNull())
 		{
@@ -989,7 +1071,8 @@ namespace highlo
 		return false;
 	}
 	
-	bool JsonReader::ReadArray(const HLString &key, DocumentDataType type, const std::function<bool(const rapidjson::Value&)> &insertFunc)
+	template<typename InsertFunc>
+	bool JsonReader::ReadArray(const HLString &key, DocumentDataType type, InsertFunc &&insertFunc)
 	{
 		if (m_Document.IsNull())
 		{
@@ -1013,24 +1096,19 @@ namespace highlo
 			}
 
 			rapidjson::GenericArray elements = member->value.GetArray();
-			ParseJSONArray(elements, [=](const rapidjson::Value &arrayEl)
-			{
-				return insertFunc(arrayEl);
-			});
+			ParseJSONArray(elements, insertFunc);
 
 			return true;
 		}
 
 		rapidjson::GenericArray elements = m_Document.GetArray();
-		ParseJSONArray(elements, [=](const rapidjson::Value &arrayElement)
-		{
-			return insertFunc(arrayElement);
-		});
+		ParseJSONArray(elements, insertFunc);
 
 		return true;
 	}
 
-	bool JsonReader::ReadArrayMap(const HLString &key, DocumentDataType type, const std::function<bool(const HLString&, const rapidjson::Value&)> &insertFunc)
+	template<typename InsertFunc>
+	bool JsonReader::ReadArrayMap(const HLString &key, DocumentDataType type, InsertFunc &&insertFunc)
 	{
 		if (m_Document.IsNull())
 		{
@@ -1045,7 +1123,7 @@ namespace highlo
 		}
 
 		rapidjson::GenericArray elements = *elementsWrapper.Value();
-		ParseJSONArray(elements, [=](const rapidjson::Value &arrayElement)
+		ParseJSONArray(elements, [&](const rapidjson::Value &arrayElement)
 		{
 			if (!arrayElement.IsObject())
 			{
@@ -1100,7 +1178,8 @@ namespace highlo
 		return true;
 	}
 	
-	void JsonReader::ParseJSONArray(const rapidjson::GenericArray<false, rapidjson::Value> &arrayElements, const std::function<void(const rapidjson::Value&)> &elementFunc)
+	template<typename ElementFunc>
+	void JsonReader::ParseJSONArray(const rapidjson::GenericArray<false, rapidjson::Value> &arrayElements, ElementFunc &&elementFunc)
 	{
 		for (uint32 i = 0; i < arrayElements.Size(); ++i)
 		{
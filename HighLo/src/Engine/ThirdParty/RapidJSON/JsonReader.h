@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added streaming reads, the DOM is parsed in situ
 //     - 1.0 (2022-03-03) initial release
 //
 
@@ -90,17 +91,34 @@ namespace highlo
 		virtual HLString GetContent(bool prettify = false) override;
 		virtual void SetContent(const HLString &content) override;
 
+		virtual bool ReadStream(DocumentStreamHandler &handler, const FileSystemPath &filePath = "") override;
+
 	private:
 
-		bool Read(const HLString &key, DocumentDataType type, const std::function<bool(rapidjson::Value&)> &insertFunc);
-		bool ReadArray(const HLString &key, DocumentDataType type, const std::function<bool(const rapidjson::Value&)> &insertFunc);
-		bool ReadArrayMap(const HLString &key, DocumentDataType type, const std::function<bool(const HLString&, const rapidjson::Value&)> &insertFunc);
+		// The insert functions are templates, so that the lambdas of the typed reads are called directly instead of through a std::function
+		template<typename InsertFunc>
+		bool Read(const HLString &key, DocumentDataType type, InsertFunc &&insertFunc);
+
+		template<typename InsertFunc>
+		bool ReadArray(const HLString &key, DocumentDataType type, InsertFunc &&insertFunc);
+
+		template<typename InsertFunc>
+		bool ReadArrayMap(const HLString &key, DocumentDataType type, InsertFunc &&insertFunc);
+
+		template<typename ElementFunc>
+		void ParseJSONArray(const rapidjson::GenericArray<false, rapidjson::Value> &arrayElements, ElementFunc &&elementFunc);
 
-		void ParseJSONArray(const rapidjson::GenericArray<false, rapidjson::Value> &arrayElements, const std::function<void(const rapidjson::Value&)> &elementFunc);
 		Optional<rapidjson::GenericArray<false, rapidjson::Value>> GetOrFindArrayFormat(rapidjson::Document &doc, const HLString &key);
 
+		/// <summary>
+		/// Parses the null terminated content of m_Buffer in situ.
+		/// </summary>
+		bool ParseBuffer();
+
 	private:
 
+		// The document is parsed in situ, its strings point into the buffer instead of being copied
+		std::vector<char> m_Buffer;
 		rapidjson::Document m_Document;
 		FileSystemPath m_FilePath;
 	};
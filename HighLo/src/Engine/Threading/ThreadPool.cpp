@@ -5,6 +5,141 @@
 
 namespace highlo
 {
+	ThreadPool::ThreadPool(uint32 threadCount)
+	{
+		if (threadCount == 0)
+		{
+			uint32 hardwareThreads = std::thread::hardware_concurrency();
+			threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
 
+		m_Workers.reserve(threadCount);
+		for (uint32 i = 0; i < threadCount; ++i)
+			m_Workers.emplace_back([this]() { WorkerLoop(); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_ShouldStop = true;
+		}
+
+		m_JobAvailable.notify_all();
+		for (std::thread &worker : m_Workers)
+		{
+			if (worker.joinable())
+				worker.join();
+		}
+	}
+
+	void ThreadPool::Submit(const ThreadPoolJob &job)
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_Jobs.push_back(job);
+		}
+
+		m_JobAvailable.notify_one();
+	}
+
+	void ThreadPool::ParallelFor(uint32 count, uint32 batchSize, const ThreadPoolRangeJob &job)
+	{
+		if (count == 0)
+			return;
+
+		if (batchSize == 0)
+			batchSize = 1;
+
+		// Small workloads are not worth the synchronisation overhead
+		if (count <= batchSize || m_Workers.empty())
+		{
+			job(0, count);
+			return;
+		}
+
+		// The helpers can start after this call has returned, so they only share this state and never touch the stack of the caller
+		struct ParallelForState
+		{
+			const ThreadPoolRangeJob *Job = nullptr;
+			uint32 Count = 0;
+			uint32 BatchSize = 0;
+			uint32 BatchCount = 0;
+			std::atomic<uint32> NextBatch = 0;
+			std::atomic<uint32> CompletedBatches = 0;
+		};
+
+		std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+		state->Job = &job;
+		state->Count = count;
+		state->BatchSize = batchSize;
+		state->BatchCount = (count + batchSize - 1) / batchSize;
+
+		// The job is only dereferenced after a batch has been claimed, the caller waits for every claimed batch, so the pointer is still valid
+		auto runBatches = [](ParallelForState &s)
+		{
+			uint32 batch;
+			while ((batch = s.NextBatch.fetch_add(1)) < s.BatchCount)
+			{
+				uint32 begin = batch * s.BatchSize;
+				uint32 end = HL_MIN(begin + s.BatchSize, s.Count);
+				(*s.Job)(begin, end);
+				s.CompletedBatches.fetch_add(1);
+			}
+		};
+
+		uint32 helperCount = HL_MIN(state->BatchCount - 1, (uint32)m_Workers.size());
+		for (uint32 i = 0; i < helperCount; ++i)
+			Submit([state, runBatches]() { runBatches(*state); });
+
+		// The calling thread works on the batches as well, so the loop finishes even if every worker is busy,
+		// for example when ParallelFor is called from inside a pool job
+		runBatches(*state);
+
+		// Only the batches, that other threads are executing right now, are left
+		while (state->CompletedBatches.load() < state->BatchCount)
+			std::this_thread::yield();
+	}
+
+	void ThreadPool::Wait()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_JobsDone.wait(lock, [this]() { return m_Jobs.empty() && m_ActiveJobs == 0; });
+	}
+
+	ThreadPool &ThreadPool::Get()
+	{
+		static ThreadPool s_Instance;
+		return s_Instance;
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		for (;;)
+		{
+			ThreadPoolJob job;
+
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_JobAvailable.wait(lock, [this]() { return m_ShouldStop || !m_Jobs.empty(); });
+
+				if (m_ShouldStop && m_Jobs.empty())
+					return;
+
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+				++m_ActiveJobs;
+			}
+
+			job();
+
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				--m_ActiveJobs;
+				if (m_Jobs.empty() && m_ActiveJobs == 0)
+					m_JobsDone.notify_all();
+			}
+		}
+	}
 }
 
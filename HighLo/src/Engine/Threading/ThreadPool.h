@@ -2,20 +2,72 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Implemented worker threads, job submission and ParallelFor
 //     - 1.0 (2021-10-21) initial release
 //
 
 #pragma once
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
 #include "Thread.h"
 
 namespace highlo
 {
+	using ThreadPoolJob = std::function<void()>;
+	using ThreadPoolRangeJob = std::function<void(uint32 begin, uint32 end)>;
+
+	/// <summary>
+	/// A fixed set of worker threads that execute submitted jobs in FIFO order.
+	/// </summary>
 	class ThreadPool
 	{
 	public:
 
+		/// <summary>
+		/// Creates the worker threads.
+		/// </summary>
+		/// <param name="threadCount">The amount of worker threads, 0 means one less than the available hardware threads.</param>
+		HLAPI ThreadPool(uint32 threadCount = 0);
+		HLAPI ~ThreadPool();
+
+		HL_NON_COPYABLE(ThreadPool);
+
+		/// <summary>
+		/// Queues a job to be executed by the next free worker.
+		/// </summary>
+		HLAPI void Submit(const ThreadPoolJob &job);
+
+		/// <summary>
+		/// Splits the range [0, count) into batches of batchSize and runs them on the workers.
+		/// The calling thread participates in the work and returns once every batch has been executed, without waiting for helper jobs,
+		/// that are still queued behind other jobs. This makes it safe to call ParallelFor from inside a pool job.
+		/// </summary>
+		HLAPI void ParallelFor(uint32 count, uint32 batchSize, const ThreadPoolRangeJob &job);
+
+		/// <summary>
+		/// Blocks until all submitted jobs have been executed.
+		/// </summary>
+		HLAPI void Wait();
+
+		HLAPI uint32 GetThreadCount() const { return (uint32)m_Workers.size(); }
+
+		HLAPI static ThreadPool &Get();
+
+	private:
+
+		void WorkerLoop();
 
+		std::vector<std::thread> m_Workers;
+		std::deque<ThreadPoolJob> m_Jobs;
+		std::mutex m_Mutex;
+		std::condition_variable m_JobAvailable;
+		std::condition_variable m_JobsDone;
+		uint32 m_ActiveJobs = 0;
+		bool m_ShouldStop = false;
 	};
 }
 
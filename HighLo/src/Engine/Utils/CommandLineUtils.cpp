@@ -55,6 +55,14 @@ namespace highlo::utils
 			{
 				m_Settings.AssetsRegistryPath = m_Arguments[i + 1];
 			}
+			else if (cmd == "--derived-data-cache")
+			{
+				m_Settings.DerivedDataCachePath = m_Arguments[i + 1];
+			}
+			else if (cmd == "--derived-data-cache-size")
+			{
+				m_Settings.DerivedDataCacheSizeMB = m_Arguments[i + 1].ToUInt32();
+			}
 			else if (cmd == "--window-title")
 			{
 				m_Settings.WindowTitle = m_Arguments[i + 1];
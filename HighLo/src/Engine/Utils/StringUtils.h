@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.5 (2026-10-19) Compare does not copy the strings anymore
 //     - 1.4 (2022-01-13) Added LexicalCast function (it can convert any type to any different type)
 //     - 1.3 (2022-01-13) Added String conversion functions
 //     - 1.2 (2021-11-19) Added Compare functions
@@ -56,15 +57,21 @@ namespace highlo
 			return memcmp((const void *)str1, (const void *)str2, (size_t)size);
 		}
 
+		/// <summary>
+		/// Compares the character ranges [pos1, size1) and [pos2, size2) in place, the ranges end early at a null terminator.
+		/// </summary>
 		template<typename StringType>
 		static int32 Compare(const StringType *str1, uint32 pos1, uint32 size1, const StringType *str2, uint32 pos2, uint32 size2, uint32 *outLhsSize, uint32 *outRhsSize)
 		{
-			StringType *str1Copied = utils::CopySubStr<StringType>(str1, pos1, size1);
-			StringType *str2Copied = utils::CopySubStr<StringType>(str2, pos2, size2);
+			uint32 str1Len = 0;
+			while (pos1 + str1Len < size1 && str1[pos1 + str1Len] != 0)
+				++str1Len;
 
-			uint32 str1Len = utils::GetSizeOfUnknownStringType<StringType>(str1Copied);
-			uint32 str2Len = utils::GetSizeOfUnknownStringType<StringType>(str2Copied);
-			int32 result = utils::Compare<StringType>(str1Copied, str2Copied, str1Len <= str2Len ? str1Len : str2Len);
+			uint32 str2Len = 0;
+			while (pos2 + str2Len < size2 && str2[pos2 + str2Len] != 0)
+				++str2Len;
+
+			int32 result = utils::CompareChars<StringType>(str1 + pos1, str2 + pos2, str1Len <= str2Len ? str1Len : str2Len);
 
 			if (outLhsSize)
 				*outLhsSize = str1Len;
@@ -72,9 +79,6 @@ namespace highlo
 			if (outRhsSize)
 				*outRhsSize = str2Len;
 
-			delete[] str1Copied;
-			delete[] str2Copied;
-
 			return result;
 		}
 	}
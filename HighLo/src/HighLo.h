@@ -21,8 +21,12 @@
 
 #include "Engine/Assets/Asset.h"
 #include "Engine/Assets/AssetExtensions.h"
+#include "Engine/Assets/AssetDirectoryScanner.h"
 #include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/AssetRegistryFile.h"
 #include "Engine/Assets/AssetTypes.h"
+#include "Engine/Assets/AsyncAssetLoader.h"
+#include "Engine/Assets/DerivedDataCache.h"
 
 #include "Engine/Factories/AssetFactory.h"
 #include "Engine/Factories/MeshFactory.h"
@@ -42,6 +46,10 @@
 #include "Engine/Core/FileSystem.h"
 #include "Engine/Core/FileSystemPath.h"
 #include "Engine/Core/FileSystemWatcher.h"
+#include "Engine/Core/MappedFile.h"
+#include "Engine/Core/Compression.h"
+#include "Engine/Core/PakArchive.h"
+#include "Engine/Core/AsyncFileIO.h"
 #include "Engine/Core/VirtualFileSystem.h"
 #include "Engine/Core/Profiler/Profiler.h"
 #include "Engine/Core/Profiler/ProfilerTimer.h"
@@ -133,6 +141,8 @@
 #include "Engine/Scene/UserSettings.h"
 
 #include "Engine/Loaders/MeshLoader.h"
+#include "Engine/Loaders/CookedMeshLoader.h"
+#include "Engine/Loaders/TextureLoader.h"
 #include "Engine/Loaders/DocumentWriter.h"
 #include "Engine/Loaders/DocumentReader.h"
 
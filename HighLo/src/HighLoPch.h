@@ -38,5 +38,6 @@
 #include "Engine/Core/UniqueReference.h"
 #include "Engine/Core/WeakReference.h"
 #include "Engine/Core/DataTypes/String.h"
+#include "Engine/Core/DataTypes/Name.h"
 #include "Engine/Core/Exceptions/Exceptions.h"
 
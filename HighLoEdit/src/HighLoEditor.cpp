@@ -480,7 +480,7 @@ void HighLoEditor::OnUIRender(Timestep timestep)
 					if (asset->GetAssetType() == AssetType::StaticMesh)
 					{
 						Ref<StaticModel> model = asset.As<StaticModel>();
-						auto &assetData = AssetManager::Get()->GetMetaData(model->Handle);
+						AssetMetaData assetData = AssetManager::Get()->GetMetaData(model->Handle);
 						HL_TRACE("Creating Static Model by drag and drop");
 
 					//	Entity entity = m_EditorScene->CreateEntity(assetData.FilePath.Filename());
@@ -25,6 +25,7 @@ if shouldShowHelpMenu[0]:
     print('--help                   Show this help menu')
     print('--visual-studio={value}  Generate the engine for a specific visual studio version (valid values are 2019 and 2022 for now)')
     print('--generate-unit-tests    Generate the unit tests for the engine')
+    print('--generate-benchmarks    Generate the benchmarks for the engine')
     exit(0)
 
 
@@ -33,6 +34,11 @@ shouldGenerateUnitTests = Utils.GetCommandLineArgument(sys.argv[1:], '--generate
 if shouldGenerateUnitTests[0]:
     generateUnitTests = '--generate-unit-tests=True'
 
+generateBenchmarks = ''
+shouldGenerateBenchmarks = Utils.GetCommandLineArgument(sys.argv[1:], '--generate-benchmarks')
+if shouldGenerateBenchmarks[0]:
+    generateBenchmarks = '--generate-benchmarks=True'
+
 print('Your detected System is: ' + platform.system())
 
 # Change from Scripts directory to root
@@ -61,23 +67,23 @@ if (platform.system() == 'Windows'):
 
         if not visualStudioVersion[0]:
             # use default 
-            subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2022", generateUnitTests])
+            subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2022", generateUnitTests, generateBenchmarks])
             exit(0)
 
         if visualStudioVersion[1] == '2022':
-            subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2022", generateUnitTests])
+            subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2022", generateUnitTests, generateBenchmarks])
         elif visualStudioVersion[1] == '2019':
-            subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2019", generateUnitTests])
+            subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2019", generateUnitTests, generateBenchmarks])
         else:
             print('Error: Unknown Visual Studio version: ', visualStudioVersion[1], ' - 2019 or 2022 are valid')
             exit(1)
     else:
         # use the current visual studio version
-        subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2022", generateUnitTests])
+        subprocess.call(["vendor/bin/premake/Windows/premake5.exe", "vs2022", generateUnitTests, generateBenchmarks])
 elif (platform.system() == 'Linux'):
     subprocess.call(["chmod", "+x", "vendor/bin/premake/Linux/premake5"])
-    subprocess.call(["vendor/bin/premake/Linux/premake5", "gmake", generateUnitTests])
+    subprocess.call(["vendor/bin/premake/Linux/premake5", "gmake", generateUnitTests, generateBenchmarks])
 elif (platform.system() == 'Darwin'):
     subprocess.call(["chmod", "+x", "vendor/bin/premake/MacOS/premake5"])
-    subprocess.call(["vendor/bin/premake/MacOS/premake5", "xcode4", generateUnitTests])
+    subprocess.call(["vendor/bin/premake/MacOS/premake5", "xcode4", generateUnitTests, generateBenchmarks])
     
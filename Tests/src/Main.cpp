@@ -4,12 +4,21 @@
 #include <gtest/gtest.h>
 
 #include "tests/StringTests.h"
+#include "tests/NameTests.h"
+#include "tests/UUIDTests.h"
+#include "tests/SortingTests.h"
 #include "tests/EncryptionTests.h"
+#include "tests/Base64Tests.h"
 #include "tests/HashmapTests.h"
+#include "tests/FlatMapTests.h"
+#include "tests/BTreeMapTests.h"
 #include "tests/ECSTests.h"
+#include "tests/AnimationTests.h"
 #include "tests/ListTests.h"
 #include "tests/StackTests.h"
 #include "tests/QueueTests.h"
+#include "tests/ConcurrentQueueTests.h"
+#include "tests/ThreadPoolTests.h"
 #include "tests/VectorTests.h"
 #include "tests/BinaryTreeTests.h"
 #include "tests/BinarySearchTreeTests.h"
@@ -17,10 +26,18 @@
 #include "tests/FileSystemPathTests.h"
 #include "tests/JSONWriteParserTests.h"
 #include "tests/JSONReadParserTests.h"
+#include "tests/BinaryDocumentTests.h"
 #include "tests/XMLWriteParserTests.h"
 #include "tests/XMLReadParserTests.h"
 #include "tests/YAMLWriteParserTests.h"
 #include "tests/YAMLReadParserTests.h"
+#include "tests/AssetRegistryTests.h"
+#include "tests/AssetDirectoryScannerTests.h"
+#include "tests/DerivedDataCacheTests.h"
+#include "tests/CookedMeshTests.h"
+#include "tests/PakArchiveTests.h"
+#include "tests/AsyncFileIOTests.h"
+#include "tests/FileSystemWatcherTests.h"
 
 int main(int argc, char *argv[])
 {
@@ -0,0 +1,154 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY AnimationTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+
+#include "Engine/Renderer/AnimationClip.h"
+#include "Engine/Renderer/AnimationController.h"
+
+using namespace highlo;
+
+static void ExpectMatrixNear(const glm::mat4 &actual, const glm::mat4 &expected)
+{
+	for (uint32 column = 0; column < 4; ++column)
+	{
+		for (uint32 row = 0; row < 4; ++row)
+			EXPECT_NEAR(actual[column][row], expected[column][row], 1e-3f);
+	}
+}
+
+/// <summary>
+/// Creates a chain of three bones with rigid bind transforms, the last bone has no keyframes.
+/// If animated is false, the keyframes of the other bones are the bind pose.
+/// </summary>
+static Ref<Animation> CreateTestAnimation(bool animated)
+{
+	glm::mat4 globalBind[3];
+	globalBind[0] = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.0f, 0.0f)) * glm::mat4_cast(glm::angleAxis(0.5f, glm::vec3(0.0f, 0.0f, 1.0f)));
+	globalBind[1] = globalBind[0] * glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 2.0f, 0.0f)) * glm::mat4_cast(glm::angleAxis(-0.3f, glm::vec3(1.0f, 0.0f, 0.0f)));
+	globalBind[2] = globalBind[1] * glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.5f, 0.5f));
+
+	Bone bones[3];
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		bones[i].ID = i;
+		bones[i].Name = HLString::ToString(i);
+		bones[i].OffsetMatrix = glm::inverse(globalBind[i]);
+
+		if (i == 2)
+			continue;
+
+		glm::mat4 localBind = i == 0 ? globalBind[0] : glm::inverse(globalBind[i - 1]) * globalBind[i];
+		for (uint32 key = 0; key < 2; ++key)
+		{
+			Keyframe keyframe;
+			keyframe.Timestamp = (float)key * 10.0f;
+			keyframe.Transform.Translation = glm::vec3(localBind[3]);
+			keyframe.Transform.Rotation = glm::quat_cast(glm::mat3(localBind));
+
+			if (animated)
+			{
+				keyframe.Transform.Translation += glm::vec3(1.0f, 0.0f, (float)key);
+				keyframe.Transform.Rotation = glm::angleAxis(1.0f + (float)key, glm::vec3(0.0f, 1.0f, 0.0f)) * keyframe.Transform.Rotation;
+			}
+
+			bones[i].Keyframes.push_back(keyframe);
+		}
+	}
+
+	bones[1].Children.push_back(bones[2]);
+	bones[0].Children.push_back(bones[1]);
+	return Animation::Create("Test", 10.0f, 1.0f, glm::mat4(1.0f), 3, bones[0], glm::mat4(1.0f));
+}
+
+TEST(TEST_CATEGORY, BindPoseComposesToIdentity)
+{
+	Ref<Animation> animation = CreateTestAnimation(true);
+
+	std::vector<glm::mat4> boneTransforms;
+	animation->ComposePose(animation->GetBindPose(), boneTransforms);
+	for (uint32 i = 0; i < 3; ++i)
+		ExpectMatrixNear(boneTransforms[i], glm::mat4(1.0f));
+
+	// The bone without keyframes stays at its bind pose, relative to its animated parent
+	AnimationLocalPose pose;
+	std::vector<uint32> cursors;
+	animation->SampleLocalPose(5.0f, cursors, pose);
+	EXPECT_NEAR(glm::length(pose.GetTranslation(2) - animation->GetBindPose().GetTranslation(2)), 0.0f, 1e-5f);
+	EXPECT_NEAR(glm::abs(glm::dot(pose.GetRotation(2), animation->GetBindPose().GetRotation(2))), 1.0f, 1e-5f);
+}
+
+TEST(TEST_CATEGORY, PartialLayerBlendsFromBindPose)
+{
+	// A layer, that plays the bind pose, must not move the mesh at any weight
+	Ref<Animation> restAnimation = CreateTestAnimation(false);
+	Ref<AnimationController> restController = AnimationController::Create(restAnimation);
+	restController->Play(restController->AddLayer(AnimationLayerBlendMode::Override, 0.5f), AnimationClip::Create(*restAnimation));
+	restController->Update(2.5f);
+
+	glm::mat4 *restTransforms = restController->Evaluate();
+	for (uint32 i = 0; i < 3; ++i)
+		ExpectMatrixNear(restTransforms[i], glm::mat4(1.0f));
+
+	// An animated layer at half weight ends up half way between the bind pose and the clip
+	Ref<Animation> animation = CreateTestAnimation(true);
+	Ref<AnimationClip> clip = AnimationClip::Create(*animation);
+	Ref<AnimationController> controller = AnimationController::Create(animation);
+	controller->Play(controller->AddLayer(AnimationLayerBlendMode::Override, 0.5f), clip);
+	controller->Update(2.5f);
+
+	AnimationLocalPose clipPose;
+	std::vector<uint32> cursors;
+	clip->SampleLocalPose(2.5f, cursors, clipPose, &animation->GetBindPose());
+
+	AnimationLocalPose expectedPose;
+	AnimationLocalPose::Blend(animation->GetBindPose(), clipPose, 0.5f, expectedPose);
+
+	std::vector<glm::mat4> expectedTransforms;
+	animation->ComposePose(expectedPose, expectedTransforms);
+
+	glm::mat4 *transforms = controller->Evaluate();
+	for (uint32 i = 0; i < 3; ++i)
+		ExpectMatrixNear(transforms[i], expectedTransforms[i]);
+}
+
+TEST(TEST_CATEGORY, ClipRejectsCorruptCounts)
+{
+	Ref<AnimationClip> clip = AnimationClip::Create(*CreateTestAnimation(true));
+	const char *path = "AnimationTestClip.anim";
+	ASSERT_TRUE(clip->Save(path));
+
+	std::ifstream file(path, std::ios::binary);
+	std::vector<Byte> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	file.close();
+	FileSystem::Get()->RemoveFile(path);
+
+	ASSERT_EQ(data.size(), clip->GetMemorySize());
+	Ref<AnimationClip> copy = Ref<AnimationClip>::Create(Allocator::Copy(data.data(), (uint32)data.size()));
+	EXPECT_TRUE(copy->IsValid());
+	EXPECT_EQ(copy->GetTrackCount(), 3);
+
+	// 2^27 additional tracks of 32 bytes wrap a 32 bit size calculation back to the real size
+	std::vector<Byte> wrapped = data;
+	uint32 trackCount;
+	memcpy(&trackCount, wrapped.data() + 8, sizeof(trackCount));
+	trackCount += 1u << 27;
+	memcpy(wrapped.data() + 8, &trackCount, sizeof(trackCount));
+
+	Ref<AnimationClip> corrupt = Ref<AnimationClip>::Create(Allocator::Copy(wrapped.data(), (uint32)wrapped.size()));
+	EXPECT_FALSE(corrupt->IsValid());
+	EXPECT_EQ(corrupt->GetTrackCount(), 0);
+}
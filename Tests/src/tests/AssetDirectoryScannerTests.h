@@ -0,0 +1,135 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace highlo;
+
+struct AssetDirectoryScannerTests : public testing::Test
+{
+	std::filesystem::path Directory = std::filesystem::absolute("AssetDirectoryScannerTest");
+	FileSystemPath ManifestPath = FileSystemPath("AssetDirectoryScannerTest.hlcache");
+
+	AssetDirectoryScannerTests()
+	{
+		std::filesystem::create_directories(Directory / "Meshes");
+	}
+
+	virtual ~AssetDirectoryScannerTests()
+	{
+		std::error_code error;
+		std::filesystem::remove_all(Directory, error);
+		std::filesystem::remove(*ManifestPath.String(), error);
+	}
+
+	void WriteTestFile(const std::filesystem::path &path, const char *content)
+	{
+		std::ofstream out(path, std::ios::out | std::ios::binary);
+		out << content;
+	}
+
+	AssetScanFile *FindFile(AssetDirectoryScanner &scanner, const std::filesystem::path &path)
+	{
+		HLString filePath = path.generic_string();
+		for (AssetScanFile &file : scanner.GetFiles())
+		{
+			if (file.FilePath == filePath)
+				return &file;
+		}
+
+		return nullptr;
+	}
+};
+
+TEST_F(AssetDirectoryScannerTests, RemembersFilesThatAreNotAssets)
+{
+	WriteTestFile(Directory / "notes.txt", "not an asset");
+
+	{
+		AssetDirectoryScanner scanner;
+		scanner.LoadManifest(ManifestPath, 1);
+		scanner.Scan(FileSystemPath(Directory.generic_string()));
+
+		AssetScanFile *file = FindFile(scanner, Directory / "notes.txt");
+		ASSERT_NE(file, nullptr);
+		EXPECT_EQ(file->State, AssetFileState::Added);
+
+		// The importer has rejected the file
+		file->IsAsset = false;
+		EXPECT_EQ(scanner.WriteManifest(ManifestPath), true);
+	}
+
+	{
+		AssetDirectoryScanner scanner;
+		scanner.LoadManifest(ManifestPath, 1);
+		scanner.Scan(FileSystemPath(Directory.generic_string()));
+
+		AssetScanFile *file = FindFile(scanner, Directory / "notes.txt");
+		ASSERT_NE(file, nullptr);
+		EXPECT_EQ(file->State, AssetFileState::Ignored);
+		EXPECT_EQ(file->IsAsset, false);
+		EXPECT_EQ(scanner.GetReport().IgnoredCount, 1u);
+		EXPECT_EQ(scanner.GetReport().HashedCount, 0u);
+	}
+
+	{
+		// The importer accepts different files now, so the file has to be imported again
+		AssetDirectoryScanner scanner;
+		scanner.LoadManifest(ManifestPath, 2);
+		scanner.Scan(FileSystemPath(Directory.generic_string()));
+
+		AssetScanFile *file = FindFile(scanner, Directory / "notes.txt");
+		ASSERT_NE(file, nullptr);
+		EXPECT_EQ(file->State, AssetFileState::Added);
+		EXPECT_EQ(file->IsAsset, true);
+	}
+}
+
+TEST_F(AssetDirectoryScannerTests, KeepsHandleOfMovedFiles)
+{
+	WriteTestFile(Directory / "Rock.hlmesh", "rock mesh");
+	WriteTestFile(Directory / "Tree.hlmesh", "tree mesh");
+
+	{
+		AssetDirectoryScanner scanner;
+		scanner.Scan(FileSystemPath(Directory.generic_string()));
+		FindFile(scanner, Directory / "Rock.hlmesh")->Handle = 1234;
+		FindFile(scanner, Directory / "Tree.hlmesh")->Handle = 5678;
+		EXPECT_EQ(scanner.WriteManifest(ManifestPath), true);
+	}
+
+	// Renamed into another directory and deleted while the engine was not running
+	std::filesystem::rename(Directory / "Rock.hlmesh", Directory / "Meshes" / "Stone.hlmesh");
+	std::filesystem::remove(Directory / "Tree.hlmesh");
+	WriteTestFile(Directory / "Bush.hlmesh", "bush mesh");
+
+	AssetDirectoryScanner scanner;
+	scanner.LoadManifest(ManifestPath);
+	scanner.Scan(FileSystemPath(Directory.generic_string()));
+
+	AssetScanFile *moved = FindFile(scanner, Directory / "Meshes" / "Stone.hlmesh");
+	ASSERT_NE(moved, nullptr);
+	EXPECT_EQ(moved->State, AssetFileState::Moved);
+	EXPECT_EQ((uint64)moved->Handle, 1234u);
+	EXPECT_EQ(moved->PreviousFilePath, HLString((Directory / "Rock.hlmesh").generic_string()));
+
+	AssetScanFile *added = FindFile(scanner, Directory / "Bush.hlmesh");
+	ASSERT_NE(added, nullptr);
+	EXPECT_EQ(added->State, AssetFileState::Added);
+	EXPECT_EQ((uint64)added->Handle, 0u);
+
+	const AssetScanReport &report = scanner.GetReport();
+	EXPECT_EQ(report.MovedCount, 1u);
+	EXPECT_EQ(report.AddedCount, 1u);
+	EXPECT_EQ(report.RemovedCount, 1u);
+}
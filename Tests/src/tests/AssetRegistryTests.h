@@ -0,0 +1,187 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.2 (2026-10-19) Lookups return copies and are tested from several threads
+//     - 1.1 (2026-10-19) Added registry file tests
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+struct AssetRegistryTests : public testing::Test
+{
+	AssetRegistry Registry;
+	AssetMetaData Texture;
+	AssetMetaData Mesh;
+
+	AssetRegistryTests()
+	{
+		Texture.Handle = AssetHandle();
+		Texture.FilePath = FileSystemPath("textures/wall.png");
+		Texture.Type = AssetType::Texture;
+
+		Mesh.Handle = AssetHandle();
+		Mesh.FilePath = FileSystemPath("models/sponza.obj");
+		Mesh.Type = AssetType::StaticMesh;
+
+		Registry.Add(Texture.FilePath, Texture);
+		Registry.Add(Mesh.FilePath, Mesh);
+	}
+
+	virtual ~AssetRegistryTests()
+	{
+	}
+};
+
+TEST_F(AssetRegistryTests, FindByHandle)
+{
+	AssetMetaData metaData;
+	EXPECT_EQ(Registry.TryGet(Mesh.Handle, metaData), true);
+	EXPECT_EQ(metaData.Type, AssetType::StaticMesh);
+	EXPECT_EQ(Registry.TryGet(AssetHandle(0), metaData), false);
+}
+
+TEST_F(AssetRegistryTests, FindByPath)
+{
+	AssetMetaData metaData;
+	EXPECT_EQ(Registry.TryGet(FileSystemPath("textures/wall.png"), metaData), true);
+	EXPECT_EQ((uint64)metaData.Handle, (uint64)Texture.Handle);
+	EXPECT_EQ((uint64)Registry.GetHandle(FileSystemPath("textures/./wall.png")), (uint64)Texture.Handle);
+	EXPECT_EQ(Registry.Contains(FileSystemPath("textures/floor.png")), false);
+}
+
+TEST_F(AssetRegistryTests, ReplacePath)
+{
+	Texture.FilePath = FileSystemPath("textures/floor.png");
+	Registry.Add(Texture.FilePath, Texture);
+
+	EXPECT_EQ(Registry.Count(), 2);
+	EXPECT_EQ(Registry.Contains(FileSystemPath("textures/wall.png")), false);
+	EXPECT_EQ(Registry.Contains(FileSystemPath("textures/floor.png")), true);
+}
+
+TEST_F(AssetRegistryTests, Remove)
+{
+	EXPECT_EQ(Registry.Remove(Texture.Handle), 1);
+	EXPECT_EQ(Registry.Remove(Mesh.FilePath), 1);
+	EXPECT_EQ(Registry.Count(), 0);
+	EXPECT_EQ(Registry.Contains(Texture.FilePath), false);
+}
+
+TEST_F(AssetRegistryTests, TryGet)
+{
+	AssetMetaData metaData;
+	EXPECT_EQ(Registry.TryGet(Texture.Handle, metaData), true);
+	EXPECT_EQ(metaData.Type, AssetType::Texture);
+
+	Registry.Clear();
+	EXPECT_EQ(Registry.TryGet(Texture.Handle, metaData), false);
+
+	// The copy is not affected by the removal of the entry
+	EXPECT_EQ(metaData.Type, AssetType::Texture);
+	EXPECT_EQ(StringEquals("textures/wall.png", metaData.FilePath.String()), true);
+}
+
+TEST_F(AssetRegistryTests, SetDataLoaded)
+{
+	EXPECT_EQ(Registry.SetDataLoaded(Texture.Handle, true), true);
+	EXPECT_EQ(Registry.SetDataLoaded(AssetHandle(0), true), false);
+
+	AssetMetaData metaData;
+	EXPECT_EQ(Registry.TryGet(Texture.Handle, metaData), true);
+	EXPECT_EQ(metaData.IsDataLoaded, true);
+}
+
+TEST_F(AssetRegistryTests, ConcurrentLookups)
+{
+	std::atomic<bool> done = false;
+	std::atomic<uint32> found = 0;
+
+	std::vector<std::thread> readers;
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		readers.emplace_back([&]()
+		{
+			AssetMetaData metaData;
+			while (!done.load())
+			{
+				if (Registry.TryGet(FileSystemPath("textures/wall.png"), metaData))
+					++found;
+
+				Registry.TryGet(Mesh.Handle, metaData);
+			}
+		});
+	}
+
+	// The main thread keeps replacing the entries, while the readers only ever see complete copies
+	for (uint32 i = 0; i < 200; ++i)
+	{
+		Texture.FilePath = FileSystemPath(i % 2 ? "textures/floor.png" : "textures/wall.png");
+		Registry.Add(Texture.FilePath, Texture);
+		Registry.Remove(Mesh.Handle);
+		Registry.Add(Mesh.FilePath, Mesh);
+	}
+
+	done = true;
+	for (std::thread &reader : readers)
+		reader.join();
+
+	EXPECT_EQ(Registry.Count(), 2);
+	EXPECT_EQ(Registry.Contains(FileSystemPath("textures/wall.png")), false);
+	EXPECT_EQ(Registry.Contains(FileSystemPath("textures/floor.png")), true);
+}
+
+TEST_F(AssetRegistryTests, FileRoundTrip)
+{
+	FileSystemPath filePath = FileSystemPath("AssetRegistryTest.hl");
+	EXPECT_EQ(AssetRegistryFile::Write(filePath, Registry), true);
+
+	AssetRegistry loaded;
+	EXPECT_EQ(AssetRegistryFile::Read(filePath, loaded), true);
+	EXPECT_EQ(loaded.Count(), 2);
+
+	AssetMetaData mesh;
+	EXPECT_EQ(loaded.TryGet(Mesh.Handle, mesh), true);
+	EXPECT_EQ(mesh.Type, AssetType::StaticMesh);
+	EXPECT_EQ(StringEquals("models/sponza.obj", mesh.FilePath.String()), true);
+
+	FileSystem::Get()->RemoveFile(filePath);
+}
+
+TEST_F(AssetRegistryTests, JournalReplay)
+{
+	FileSystemPath filePath = FileSystemPath("AssetRegistryJournalTest.hl");
+	FileSystemPath journalPath = AssetRegistryFile::GetJournalPath(filePath);
+	EXPECT_EQ(AssetRegistryFile::Write(filePath, Registry), true);
+
+	AssetRegistryJournal journal;
+	journal.Start(journalPath, 10000);
+
+	// Both changes of the texture are coalesced into the last one
+	Texture.FilePath = FileSystemPath("textures/floor.png");
+	journal.RecordAdd(Texture);
+	Texture.FilePath = FileSystemPath("textures/ceiling.png");
+	journal.RecordAdd(Texture);
+	journal.RecordRemove(Mesh.Handle);
+	journal.Stop();
+
+	EXPECT_EQ(journal.GetWrittenRecordCount(), 2);
+
+	AssetRegistry loaded;
+	EXPECT_EQ(AssetRegistryFile::Read(filePath, loaded), true);
+	EXPECT_EQ(loaded.Count(), 1);
+	EXPECT_EQ(loaded.Contains(Mesh.Handle), false);
+	EXPECT_EQ(loaded.Contains(FileSystemPath("textures/ceiling.png")), true);
+
+	journal.Reset();
+	EXPECT_EQ(FileSystem::Get()->FileExists(journalPath), false);
+	FileSystem::Get()->RemoveFile(filePath);
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace highlo;
+
+struct AsyncFileIOTests : public testing::Test
+{
+	FileSystemPath FilePath = FileSystemPath("AsyncFileIOTest.bin");
+
+	AsyncFileIOTests()
+	{
+		Logger::Init();
+
+		std::ofstream out(*FilePath.String(), std::ios::out | std::ios::binary | std::ios::trunc);
+		for (uint32 i = 0; i < 100000; ++i)
+			out.put((char)(i % 251));
+	}
+
+	virtual ~AsyncFileIOTests()
+	{
+		AsyncFileIO::Get()->Shutdown();
+
+		std::error_code error;
+		std::filesystem::remove(*FilePath.String(), error);
+		Logger::Shutdown();
+	}
+};
+
+TEST_F(AsyncFileIOTests, ReadWholeFile)
+{
+	Ref<AsyncIORequest> request = AsyncFileIO::Get()->Read(FilePath);
+	AsyncFileIO::Get()->Wait(request);
+
+	EXPECT_EQ(request->Succeeded(), true);
+	EXPECT_EQ(request->Buffer.Size, 100000u);
+	EXPECT_EQ(request->Buffer.Data[99999], (Byte)(99999 % 251));
+}
+
+TEST_F(AsyncFileIOTests, ReadRange)
+{
+	Ref<AsyncIORequest> request = AsyncFileIO::Get()->Read(FilePath, nullptr, AsyncIOPriority::High, 1000, 16);
+	AsyncFileIO::Get()->Wait(request);
+
+	EXPECT_EQ(request->Succeeded(), true);
+	EXPECT_EQ(request->Buffer.Size, 16u);
+	EXPECT_EQ(request->Buffer.Data[0], (Byte)(1000 % 251));
+
+	// Ranges are clamped to the end of the file
+	request = AsyncFileIO::Get()->Read(FilePath, nullptr, AsyncIOPriority::Normal, 99990, 100);
+	AsyncFileIO::Get()->Wait(request);
+	EXPECT_EQ(request->Buffer.Size, 10u);
+}
+
+TEST_F(AsyncFileIOTests, MissingFileFails)
+{
+	Ref<AsyncIORequest> request = AsyncFileIO::Get()->Read("AsyncFileIOMissing.bin");
+	AsyncFileIO::Get()->Wait(request);
+
+	EXPECT_EQ(request->State.load(), AsyncIOState::Failed);
+	EXPECT_EQ(request->Buffer.Data, nullptr);
+}
+
+TEST_F(AsyncFileIOTests, BatchWithCallbacks)
+{
+	std::atomic<uint32> completed = 0;
+	std::vector<Ref<AsyncIORequest>> requests;
+	for (uint32 i = 0; i < 200; ++i)
+	{
+		Ref<AsyncIORequest> request = Ref<AsyncIORequest>::Create();
+		request->FilePath = FilePath;
+		request->Offset = i * 100;
+		request->Size = 100;
+		request->Priority = (AsyncIOPriority)(i % (uint32)AsyncIOPriority::Count);
+		request->Callback = [&completed](AsyncIORequest &request)
+		{
+			if (request.Succeeded() && request.Buffer.Data[0] == (Byte)(request.Offset % 251))
+				++completed;
+		};
+
+		requests.push_back(request);
+	}
+
+	AsyncFileIO::Get()->Submit(requests);
+	AsyncFileIO::Get()->WaitAll();
+
+	EXPECT_EQ(completed.load(), 200u);
+	EXPECT_EQ(AsyncFileIO::Get()->GetOutstandingCount(), 0u);
+}
+
+TEST_F(AsyncFileIOTests, CancelFinishedRequest)
+{
+	Ref<AsyncIORequest> request = AsyncFileIO::Get()->Read(FilePath);
+	AsyncFileIO::Get()->Wait(request);
+
+	// Finished requests can't be cancelled anymore
+	EXPECT_EQ(AsyncFileIO::Get()->Cancel(request), false);
+	EXPECT_EQ(request->Succeeded(), true);
+}
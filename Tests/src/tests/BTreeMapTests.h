@@ -0,0 +1,142 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY BTreeMapTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+// Nodes with only four keys, so that a few entries already split and merge nodes on several levels
+template<typename Key, typename Value>
+using SmallNodeBTreeMap = HLBTreeMap<Key, Value, std::less<Key>, 4 * sizeof(Key)>;
+
+TEST(TEST_CATEGORY, InsertAndFind)
+{
+	HLBTreeMap<HLString, uint64> map;
+	EXPECT_EQ(map.Insert("b", 2).second, true);
+	EXPECT_EQ(map.Insert("a", 1).second, true);
+	EXPECT_EQ(map.Insert("c", 3).second, true);
+	EXPECT_EQ(map.Insert("a", 10).second, false);
+
+	EXPECT_EQ(map.Size(), 3u);
+	EXPECT_EQ(map.Contains("a"), true);
+	EXPECT_EQ(map.Contains("d"), false);
+	EXPECT_EQ(map.At("a"), 1u);
+	EXPECT_EQ(map.TryGet("d"), nullptr);
+
+	map.InsertOrAssign("a", 10);
+	EXPECT_EQ(*map.TryGet("a"), 10u);
+
+	map["d"] = 4;
+	EXPECT_EQ(map.At("d"), 4u);
+}
+
+TEST(TEST_CATEGORY, IteratesInOrder)
+{
+	SmallNodeBTreeMap<uint32, uint32> map;
+	for (uint32 i = 0; i < 100; ++i)
+		map.Insert((i * 37) % 100, i);
+
+	uint32 expected = 0;
+	for (const auto &[key, value] : map)
+	{
+		EXPECT_EQ(key, expected);
+		EXPECT_EQ((value * 37) % 100, key);
+		++expected;
+	}
+
+	EXPECT_EQ(expected, 100u);
+	EXPECT_EQ(map.LowerBound(50).GetKey(), 50u);
+	EXPECT_EQ(map.LowerBound(100) == map.end(), true);
+}
+
+TEST(TEST_CATEGORY, RemoveAll)
+{
+	SmallNodeBTreeMap<uint32, HLString> map;
+	for (uint32 i = 0; i < 200; ++i)
+		map.Insert(i, HLString::ToString(i));
+
+	for (uint32 i = 0; i < 200; i += 2)
+		EXPECT_EQ(map.Remove(i), true);
+
+	EXPECT_EQ(map.Remove(0), false);
+	EXPECT_EQ(map.Size(), 100u);
+	EXPECT_EQ(StringEquals(map.At(101), "101"), true);
+
+	for (uint32 i = 1; i < 200; i += 2)
+		EXPECT_EQ(map.Remove(i), true);
+
+	EXPECT_EQ(map.IsEmpty(), true);
+	EXPECT_EQ(map.begin() == map.end(), true);
+
+	map.Insert(7, "7");
+	EXPECT_EQ(map.Size(), 1u);
+}
+
+TEST(TEST_CATEGORY, CopyAndMove)
+{
+	SmallNodeBTreeMap<uint32, uint32> map;
+	for (uint32 i = 0; i < 50; ++i)
+		map.Insert(i, i);
+
+	SmallNodeBTreeMap<uint32, uint32> copy = map;
+	copy.Remove(10);
+	EXPECT_EQ(map.Contains(10), true);
+	EXPECT_EQ(copy.Contains(10), false);
+
+	SmallNodeBTreeMap<uint32, uint32> moved = std::move(copy);
+	EXPECT_EQ(moved.Size(), 49u);
+	EXPECT_EQ(copy.IsEmpty(), true);
+
+	map = moved;
+	EXPECT_EQ(map.Size(), 49u);
+}
+
+TEST(TEST_CATEGORY, MatchesStdMap)
+{
+	std::mt19937 random(42);
+	SmallNodeBTreeMap<uint32, uint32> map;
+	std::map<uint32, uint32> reference;
+
+	for (uint32 i = 0; i < 20000; ++i)
+	{
+		uint32 key = random() % 2000;
+		if (random() % 2 == 0)
+		{
+			EXPECT_EQ(map.Remove(key), reference.erase(key) == 1);
+		}
+		else
+		{
+			map.InsertOrAssign(key, i);
+			reference[key] = i;
+		}
+	}
+
+	ASSERT_EQ(map.Size(), (uint32)reference.size());
+
+	auto it = reference.begin();
+	for (const auto &[key, value] : map)
+	{
+		EXPECT_EQ(key, it->first);
+		EXPECT_EQ(value, it->second);
+		++it;
+	}
+
+	for (uint32 key = 0; key < 2000; ++key)
+		EXPECT_EQ(map.Contains(key), reference.count(key) == 1);
+}
+
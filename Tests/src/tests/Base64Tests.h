@@ -0,0 +1,168 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY Base64Tests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+using namespace highlo;
+
+static std::string ReferenceBase64Encode(const std::vector<Byte> &bytes)
+{
+	static const char *chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	std::string result;
+	for (size_t i = 0; i < bytes.size(); i += 3)
+	{
+		uint32 value = (uint32)bytes[i] << 16;
+		if (i + 1 < bytes.size())
+			value |= (uint32)bytes[i + 1] << 8;
+		if (i + 2 < bytes.size())
+			value |= (uint32)bytes[i + 2];
+
+		result += chars[value >> 18];
+		result += chars[(value >> 12) & 0x3F];
+		result += i + 1 < bytes.size() ? chars[(value >> 6) & 0x3F] : '=';
+		result += i + 2 < bytes.size() ? chars[value & 0x3F] : '=';
+	}
+
+	return result;
+}
+
+static std::vector<Byte> RandomBase64Bytes(std::mt19937 &engine, uint32 count)
+{
+	std::vector<Byte> bytes(count);
+	for (Byte &byte : bytes)
+		byte = (Byte)(engine() & 0xFF);
+
+	return bytes;
+}
+
+TEST(TEST_CATEGORY, KnownVectors)
+{
+	const char *plain[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+	const char *encoded[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+
+	for (uint32 i = 0; i < 7; ++i)
+	{
+		HLString result = Base64::Encode((const Byte*)plain[i], (uint32)strlen(plain[i]));
+		EXPECT_STREQ(*result, encoded[i]);
+		EXPECT_STREQ(*Base64::DecodeToString(encoded[i]), plain[i]);
+	}
+}
+
+TEST(TEST_CATEGORY, RoundTripMatchesReference)
+{
+	std::mt19937 engine(49);
+
+	// The lengths cover the vector loops and every remainder, that the scalar tail handles
+	for (uint32 length = 0; length < 400; ++length)
+	{
+		std::vector<Byte> bytes = RandomBase64Bytes(engine, length);
+		std::string expected = ReferenceBase64Encode(bytes);
+
+		std::vector<char> encoded(Base64::GetEncodedLength(length));
+		ASSERT_EQ(Base64::Encode(bytes.data(), length, encoded.data()), expected.size());
+		ASSERT_EQ(std::string(encoded.begin(), encoded.end()), expected);
+
+		std::vector<Byte> decoded(Base64::GetMaxDecodedLength(encoded.size()));
+		uint64 decodedLength = 0;
+		ASSERT_TRUE(Base64::Decode(encoded.data(), encoded.size(), decoded.data(), decodedLength));
+		decoded.resize(decodedLength);
+		ASSERT_EQ(decoded, bytes);
+	}
+}
+
+TEST(TEST_CATEGORY, DecodeValidatesInput)
+{
+	Byte out[16];
+	uint64 length = 0;
+
+	EXPECT_TRUE(Base64::Decode("Zm9vYg", 6, out, length));
+	EXPECT_EQ(length, 4);
+
+	EXPECT_TRUE(Base64::Decode("Zm9vYg==", 8, out, length));
+	EXPECT_EQ(length, 4);
+
+	EXPECT_FALSE(Base64::Decode("Zm9v!mFy", 8, out, length));
+	EXPECT_EQ(length, 3);
+
+	EXPECT_FALSE(Base64::Decode("Zm9vY", 5, out, length));
+	EXPECT_FALSE(Base64::Decode("Zm9v=", 5, out, length));
+	EXPECT_FALSE(Base64::Decode("Zg=A", 4, out, length));
+	EXPECT_FALSE(Base64::Decode("Zg===", 5, out, length));
+
+	// An invalid character inside the part, that the vector loops decode
+	std::vector<Byte> bytes(300, 0x5A);
+	std::string encoded = ReferenceBase64Encode(bytes);
+	encoded[200] = '*';
+
+	std::vector<Byte> decoded(Base64::GetMaxDecodedLength(encoded.size()));
+	EXPECT_FALSE(Base64::Decode(encoded.data(), encoded.size(), decoded.data(), length));
+	EXPECT_EQ(length, 150);
+
+	// The HLString versions stop at the first invalid character like before
+	std::vector<Byte> partial = Base64::Decode("Zm9vYmFy!Zm9v");
+	EXPECT_EQ(std::string(partial.begin(), partial.end()), "foobar");
+}
+
+TEST(TEST_CATEGORY, StreamingMatchesOneShot)
+{
+	std::mt19937 engine(50);
+	std::vector<Byte> bytes = RandomBase64Bytes(engine, 10000);
+	std::string expected = ReferenceBase64Encode(bytes);
+
+	Base64Encoder encoder;
+	std::string encoded;
+	std::vector<char> chunkOut;
+	for (uint32 offset = 0; offset < bytes.size();)
+	{
+		uint32 chunk = std::min<uint32>(engine() % 97, (uint32)bytes.size() - offset);
+		chunkOut.resize(Base64::GetEncodedLength(chunk + 2));
+		uint64 written = encoder.Update(bytes.data() + offset, chunk, chunkOut.data());
+		encoded.append(chunkOut.data(), written);
+		offset += chunk;
+	}
+
+	char tail[4];
+	encoded.append(tail, encoder.Finish(tail));
+	ASSERT_EQ(encoded, expected);
+
+	Base64Decoder decoder;
+	std::vector<Byte> decoded;
+	std::vector<Byte> decodedChunk;
+	for (uint32 offset = 0; offset < encoded.size();)
+	{
+		uint32 chunk = std::min<uint32>(engine() % 131, (uint32)encoded.size() - offset);
+		decodedChunk.resize(Base64::GetMaxDecodedLength(chunk + 4));
+		uint64 written = 0;
+		ASSERT_TRUE(decoder.Update(encoded.data() + offset, chunk, decodedChunk.data(), written));
+		decoded.insert(decoded.end(), decodedChunk.begin(), decodedChunk.begin() + written);
+		offset += chunk;
+	}
+
+	Byte last[3];
+	uint64 lastLength = 0;
+	ASSERT_TRUE(decoder.Finish(last, lastLength));
+	decoded.insert(decoded.end(), last, last + lastLength);
+	EXPECT_EQ(decoded, bytes);
+
+	// Padding is only allowed at the end of the payload
+	uint64 written = 0;
+	Byte out[16];
+	EXPECT_TRUE(decoder.Update("Zg==", 4, out, written));
+	EXPECT_FALSE(decoder.Update("Zm9v", 4, out, written));
+	EXPECT_FALSE(decoder.Finish(out, written));
+}
+
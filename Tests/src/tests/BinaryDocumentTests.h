@@ -0,0 +1,194 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added nesting depth tests
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+using namespace highlo;
+
+struct BinaryDocumentTests : public testing::Test
+{
+	FileSystemPath FilePath = FileSystemPath("BinaryDocumentTest.hlbd");
+	Ref<DocumentWriter> Writer;
+	Ref<DocumentReader> Reader;
+
+	BinaryDocumentTests()
+	{
+		Writer = DocumentWriter::Create(FilePath, DocumentType::Binary);
+		Reader = DocumentReader::Create(FilePath, DocumentType::Binary);
+	}
+
+	virtual ~BinaryDocumentTests()
+	{
+		std::error_code error;
+		std::filesystem::remove(*FilePath.String(), error);
+	}
+};
+
+TEST_F(BinaryDocumentTests, ScalarRoundTrip)
+{
+	EXPECT_TRUE(Writer->WriteInt32("int", -42));
+	EXPECT_TRUE(Writer->WriteUInt64("big", 1ull << 40));
+	EXPECT_TRUE(Writer->WriteDouble("double", 0.125));
+	EXPECT_TRUE(Writer->WriteBool("flag", true));
+	EXPECT_TRUE(Writer->WriteString("name", "HighLo"));
+	EXPECT_TRUE(Writer->WriteVec3("position", glm::vec3(1.0f, 2.0f, 3.0f)));
+	EXPECT_TRUE(Writer->WriteMat4("transform", glm::mat4(2.0f)));
+	EXPECT_TRUE(Writer->HasKey("name"));
+	EXPECT_FALSE(Writer->HasKey("missing"));
+	EXPECT_TRUE(Writer->WriteOut());
+
+	EXPECT_TRUE(Reader->ReadContents());
+
+	int32 intValue = 0;
+	uint64 bigValue = 0;
+	double doubleValue = 0.0;
+	bool flag = false;
+	HLString name;
+	glm::vec3 position;
+	glm::mat4 transform;
+
+	EXPECT_TRUE(Reader->ReadInt32("int", &intValue));
+	EXPECT_TRUE(Reader->ReadUInt64("big", &bigValue));
+	EXPECT_TRUE(Reader->ReadDouble("double", &doubleValue));
+	EXPECT_TRUE(Reader->ReadBool("flag", &flag));
+	EXPECT_TRUE(Reader->ReadString("name", &name));
+	EXPECT_TRUE(Reader->ReadVector3("position", &position));
+	EXPECT_TRUE(Reader->ReadMatrix4("transform", &transform));
+
+	EXPECT_EQ(intValue, -42);
+	EXPECT_EQ(bigValue, 1ull << 40);
+	EXPECT_EQ(doubleValue, 0.125);
+	EXPECT_TRUE(flag);
+	EXPECT_EQ(name, "HighLo");
+	EXPECT_EQ(position, glm::vec3(1.0f, 2.0f, 3.0f));
+	EXPECT_EQ(transform, glm::mat4(2.0f));
+
+	// The types are stored in the document, so mismatching reads fail
+	int64 wrongType = 0;
+	EXPECT_FALSE(Reader->ReadInt64("int", &wrongType));
+	EXPECT_FALSE(Reader->ReadInt32("missing", &intValue));
+}
+
+TEST_F(BinaryDocumentTests, ArrayRoundTrip)
+{
+	std::vector<glm::vec3> vertices;
+	for (uint32 i = 0; i < 10000; ++i)
+		vertices.push_back(glm::vec3((float)i, (float)i * 0.5f, -(float)i));
+
+	std::vector<bool> flags = { true, false, true };
+	std::vector<HLString> names = { "first", "second" };
+	std::map<HLString, float> weights = { { "a", 0.25f }, { "b", 0.75f } };
+
+	EXPECT_TRUE(Writer->WriteVec3Array("vertices", vertices));
+	EXPECT_TRUE(Writer->WriteBoolArray("flags", flags));
+	EXPECT_TRUE(Writer->WriteStringArray("names", names));
+	EXPECT_TRUE(Writer->WriteFloatArrayMap("weights", weights));
+	EXPECT_TRUE(Writer->WriteOut());
+
+	EXPECT_TRUE(Reader->ReadContents());
+
+	std::vector<glm::vec3> readVertices;
+	std::vector<bool> readFlags;
+	std::vector<HLString> readNames;
+	std::unordered_map<HLString, float> readWeights;
+
+	EXPECT_TRUE(Reader->ReadVec3Array("vertices", readVertices));
+	EXPECT_TRUE(Reader->ReadBoolArray("flags", readFlags));
+	EXPECT_TRUE(Reader->ReadStringArray("names", readNames));
+	EXPECT_TRUE(Reader->ReadFloatArrayMap("weights", readWeights));
+
+	EXPECT_EQ(readVertices, vertices);
+	EXPECT_EQ(readFlags, flags);
+	EXPECT_EQ(readNames, names);
+	EXPECT_EQ(readWeights.size(), 2u);
+	EXPECT_EQ(readWeights["b"], 0.75f);
+}
+
+TEST_F(BinaryDocumentTests, ArrayOfObjects)
+{
+	Writer->BeginArray();
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		Writer->BeginObject();
+		Writer->WriteUInt32(HLString("object") + HLString::ToString(i), i * 10);
+		Writer->EndObject();
+	}
+	Writer->EndArray("testArray");
+	EXPECT_TRUE(Writer->WriteOut());
+
+	EXPECT_TRUE(Reader->ReadContents());
+
+	std::vector<uint32> values;
+	std::map<HLString, uint32> valueMap;
+	EXPECT_TRUE(Reader->ReadUInt32Array("testArray", values));
+	EXPECT_TRUE(Reader->ReadUInt32ArrayMap("testArray", valueMap));
+
+	EXPECT_EQ(values, std::vector<uint32>({ 0, 10, 20 }));
+	EXPECT_EQ(valueMap["object2"], 20u);
+
+	HLString content = Reader->GetContent();
+	EXPECT_EQ(content, "{\"testArray\":[{\"object0\":0},{\"object1\":10},{\"object2\":20}]}");
+}
+
+TEST_F(BinaryDocumentTests, RejectsCorruptedContent)
+{
+	Reader->SetContent("{ \"no\": \"binary document\" }");
+
+	int32 value = 0;
+	EXPECT_FALSE(Reader->ReadInt32("no", &value));
+}
+
+static std::vector<Byte> CreateNestedArrays(uint32 depth)
+{
+	// The innermost array is empty, every other array contains the next one
+	std::vector<Byte> value = { (Byte)BinaryDocumentTag::Array, 0, 0, 0, 0, 0, 0, 0, 0 };
+	for (uint32 i = 1; i < depth; ++i)
+	{
+		uint32 payloadSize = (uint32)value.size();
+		uint32 count = 1;
+
+		std::vector<Byte> parent(9);
+		parent[0] = (Byte)BinaryDocumentTag::Array;
+		memcpy(parent.data() + 1, &payloadSize, sizeof(uint32));
+		memcpy(parent.data() + 5, &count, sizeof(uint32));
+		parent.insert(parent.end(), value.begin(), value.end());
+		value = std::move(parent);
+	}
+
+	BinaryDocumentHeader header;
+	std::vector<Byte> document(sizeof(BinaryDocumentHeader));
+	memcpy(document.data(), &header, sizeof(BinaryDocumentHeader));
+	document.insert(document.end(), value.begin(), value.end());
+	return document;
+}
+
+TEST_F(BinaryDocumentTests, LimitsNestingDepth)
+{
+	std::vector<Byte> shallow = CreateNestedArrays(3);
+	BinaryDocumentValue root;
+	EXPECT_TRUE(BinaryDocumentValue::ParseDocument(shallow.data(), shallow.size(), root));
+	EXPECT_EQ(root.ToText(), "[[[]]]");
+
+	uint32 elementCount = 0;
+	EXPECT_TRUE(root.ForEachElement([&elementCount](const BinaryDocumentValue &element)
+	{
+		++elementCount;
+		return element.IsArray();
+	}));
+	EXPECT_EQ(elementCount, 1u);
+
+	// Deeper documents are rejected instead of recursing until the stack is exhausted
+	std::vector<Byte> deep = CreateNestedArrays(HL_BINARY_DOCUMENT_MAX_DEPTH * 100);
+	EXPECT_TRUE(BinaryDocumentValue::ParseDocument(deep.data(), deep.size(), root));
+	EXPECT_EQ(root.ToText(), "");
+}
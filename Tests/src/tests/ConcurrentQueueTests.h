@@ -0,0 +1,145 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY ConcurrentQueueTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+TEST(TEST_CATEGORY, SPSCFullAndEmpty)
+{
+	HLSPSCQueue<HLString> queue(3);
+	EXPECT_EQ(queue.GetCapacity(), 4u);
+
+	HLString value;
+	EXPECT_EQ(queue.TryPop(value), false);
+
+	for (uint32 i = 0; i < 4; ++i)
+		EXPECT_EQ(queue.TryPush(HLString::ToString(i)), true);
+
+	EXPECT_EQ(queue.TryPush("Full"), false);
+	EXPECT_EQ(queue.SizeApprox(), 4u);
+
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(queue.TryPop(value), true);
+		EXPECT_EQ(StringEquals(value, HLString::ToString(i)), true);
+	}
+
+	EXPECT_EQ(queue.IsEmpty(), true);
+}
+
+TEST(TEST_CATEGORY, SPSCKeepsOrderAcrossThreads)
+{
+	const uint32 count = 200000;
+	HLSPSCQueue<uint32> queue(256);
+
+	std::thread producer([&queue, count]()
+	{
+		for (uint32 i = 0; i < count; ++i)
+		{
+			while (!queue.TryPush(i))
+				std::this_thread::yield();
+		}
+	});
+
+	uint32 expected = 0;
+	bool ordered = true;
+	while (expected < count)
+	{
+		uint32 value;
+		if (queue.TryPop(value))
+			ordered &= value == expected++;
+		else
+			std::this_thread::yield();
+	}
+
+	producer.join();
+	EXPECT_EQ(ordered, true);
+	EXPECT_EQ(queue.IsEmpty(), true);
+}
+
+TEST(TEST_CATEGORY, MPMCFullAndEmpty)
+{
+	HLMPMCQueue<HLString> queue(4);
+
+	HLString value;
+	EXPECT_EQ(queue.TryPop(value), false);
+
+	for (uint32 i = 0; i < 4; ++i)
+		EXPECT_EQ(queue.TryPush(HLString::ToString(i)), true);
+
+	EXPECT_EQ(queue.TryPush("Full"), false);
+
+	// Unpopped elements are destroyed by the queue
+	EXPECT_EQ(queue.TryPop(value), true);
+	EXPECT_EQ(StringEquals(value, "0"), true);
+	EXPECT_EQ(queue.SizeApprox(), 3u);
+}
+
+TEST(TEST_CATEGORY, MPMCDeliversEveryElementOnce)
+{
+	const uint32 threadCount = 4;
+	const uint32 countPerProducer = 50000;
+	HLMPMCQueue<uint32> queue(1024);
+
+	std::vector<std::atomic<uint32>> received(threadCount * countPerProducer);
+	std::atomic<uint32> receivedCount = 0;
+
+	std::vector<std::thread> threads;
+	for (uint32 producer = 0; producer < threadCount; ++producer)
+	{
+		threads.emplace_back([&queue, producer, countPerProducer]()
+		{
+			for (uint32 i = 0; i < countPerProducer; ++i)
+			{
+				while (!queue.TryPush(producer * countPerProducer + i))
+					std::this_thread::yield();
+			}
+		});
+	}
+
+	for (uint32 consumer = 0; consumer < threadCount; ++consumer)
+	{
+		threads.emplace_back([&]()
+		{
+			while (receivedCount.load() < threadCount * countPerProducer)
+			{
+				uint32 value;
+				if (queue.TryPop(value))
+				{
+					received[value].fetch_add(1);
+					receivedCount.fetch_add(1);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	bool everyElementOnce = true;
+	for (std::atomic<uint32> &count : received)
+		everyElementOnce &= count.load() == 1;
+
+	EXPECT_EQ(everyElementOnce, true);
+	EXPECT_EQ(queue.IsEmpty(), true);
+}
+
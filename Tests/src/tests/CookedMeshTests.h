@@ -0,0 +1,181 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added tests for indices and submeshes outside of the buffers
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace highlo;
+
+struct CookedMeshTests : public testing::Test
+{
+	std::filesystem::path Directory = std::filesystem::absolute("CookedMeshTest");
+
+	CookedMeshTests()
+	{
+		std::filesystem::create_directories(Directory / "A");
+		std::filesystem::create_directories(Directory / "B");
+		DerivedDataCache::Get()->Init(FileSystemPath((Directory / "Cache").generic_string()), 0);
+	}
+
+	virtual ~CookedMeshTests()
+	{
+		DerivedDataCache::Get()->Shutdown();
+
+		std::error_code error;
+		std::filesystem::remove_all(Directory, error);
+	}
+
+	FileSystemPath WriteSource(const char *directory)
+	{
+		std::filesystem::path path = Directory / directory / "Rock.obj";
+		std::ofstream out(path, std::ios::out | std::ios::binary);
+		out << "o Rock\n";
+		return FileSystemPath(path.generic_string());
+	}
+
+	/// <summary>
+	/// Writes a cooked file without geometry, that only contains a material with a diffuse map.
+	/// </summary>
+	void WriteCookedMaterial(const FileSystemPath &cookedPath, const char *diffuseMap)
+	{
+		auto align = [](uint64 offset) { return (offset + HL_COOKED_MESH_ALIGNMENT - 1) & ~((uint64)HL_COOKED_MESH_ALIGNMENT - 1); };
+
+		std::vector<char> strings = { 'R', 'o', 'c', 'k', '\0' };
+		strings.insert(strings.end(), diffuseMap, diffuseMap + strlen(diffuseMap) + 1);
+
+		CookedMeshHeader header;
+		header.VertexStride = sizeof(Vertex);
+		header.MaterialCount = 1;
+		header.StringTableSize = (uint32)strings.size();
+		header.MaterialOffset = align(sizeof(CookedMeshHeader));
+		header.StringOffset = align(header.MaterialOffset + sizeof(CookedMaterial));
+		header.VertexOffset = header.MaterialOffset;
+		header.IndexOffset = header.MaterialOffset;
+		header.SubmeshOffset = header.MaterialOffset;
+		header.BoneOffset = header.MaterialOffset;
+
+		CookedMaterial material;
+		material.Name = 0;
+		material.DiffuseMap = 5;
+
+		std::vector<Byte> buffer(header.StringOffset + strings.size(), 0);
+		memcpy(buffer.data(), &header, sizeof(CookedMeshHeader));
+		memcpy(buffer.data() + header.MaterialOffset, &material, sizeof(CookedMaterial));
+		memcpy(buffer.data() + header.StringOffset, strings.data(), strings.size());
+
+		std::ofstream out(*cookedPath.Absolute(), std::ios::out | std::ios::binary);
+		out.write((const char*)buffer.data(), buffer.size());
+	}
+
+	/// <summary>
+	/// Writes a cooked file with a single submesh and without materials.
+	/// </summary>
+	FileSystemPath WriteCookedGeometry(uint32 vertexCount, const std::vector<VertexIndex> &indices, const CookedSubmesh &submesh)
+	{
+		auto align = [](uint64 offset) { return (offset + HL_COOKED_MESH_ALIGNMENT - 1) & ~((uint64)HL_COOKED_MESH_ALIGNMENT - 1); };
+
+		CookedMeshHeader header;
+		header.VertexStride = sizeof(Vertex);
+		header.VertexCount = vertexCount;
+		header.TriangleCount = (uint32)indices.size();
+		header.SubmeshCount = 1;
+		header.VertexOffset = align(sizeof(CookedMeshHeader));
+		header.IndexOffset = align(header.VertexOffset + vertexCount * sizeof(Vertex));
+		header.SubmeshOffset = align(header.IndexOffset + indices.size() * sizeof(VertexIndex));
+		header.MaterialOffset = align(header.SubmeshOffset + sizeof(CookedSubmesh));
+		header.BoneOffset = header.MaterialOffset;
+		header.StringOffset = header.MaterialOffset;
+
+		std::vector<Byte> buffer(header.MaterialOffset, 0);
+		memcpy(buffer.data(), &header, sizeof(CookedMeshHeader));
+		memcpy(buffer.data() + header.IndexOffset, indices.data(), indices.size() * sizeof(VertexIndex));
+		memcpy(buffer.data() + header.SubmeshOffset, &submesh, sizeof(CookedSubmesh));
+
+		FileSystemPath cookedPath = FileSystemPath((Directory / "Geometry.hlmesh").generic_string());
+		std::ofstream out(*cookedPath.Absolute(), std::ios::out | std::ios::binary | std::ios::trunc);
+		out.write((const char*)buffer.data(), buffer.size());
+		return cookedPath;
+	}
+};
+
+TEST_F(CookedMeshTests, CacheKeyContainsSourceDirectory)
+{
+	FileSystemPath first = WriteSource("A");
+	FileSystemPath second = WriteSource("B");
+
+	DerivedDataKey firstKey, secondKey;
+	ASSERT_EQ(CookedMeshLoader::GetCacheKey(first, firstKey), true);
+	ASSERT_EQ(CookedMeshLoader::GetCacheKey(second, secondKey), true);
+
+	// The content is the same, but the textures next to the copies might not be
+	EXPECT_EQ(firstKey.SourceHash, secondKey.SourceHash);
+	EXPECT_NE(firstKey.ToString(), secondKey.ToString());
+}
+
+TEST_F(CookedMeshTests, TexturesResolveFromSourceWhenLoadedFromCache)
+{
+	FileSystemPath source = WriteSource("A");
+
+	DerivedDataKey key;
+	ASSERT_EQ(CookedMeshLoader::GetCacheKey(source, key), true);
+
+	FileSystemPath cookedPath = DerivedDataCache::Get()->GetEntryPath(key);
+	WriteCookedMaterial(cookedPath, "Textures/Rock.png");
+	ASSERT_EQ(DerivedDataCache::Get()->Register(key), true);
+	ASSERT_EQ(DerivedDataCache::Get()->Contains(key), true);
+
+	CookedMeshData data;
+	ASSERT_EQ(CookedMeshData::Read(DerivedDataCache::Get()->GetEntryPath(key), data), true);
+	ASSERT_EQ(data.Header->MaterialCount, 1u);
+
+	HLString diffuseMap = data.GetString(data.Materials[0].DiffuseMap);
+	EXPECT_EQ(diffuseMap, HLString("Textures/Rock.png"));
+
+	// The texture lies next to the source mesh, not next to the cache entry
+	std::filesystem::path texturePath = std::filesystem::path(*CookedMeshLoader::GetTexturePath(source, diffuseMap).Absolute()).lexically_normal();
+	EXPECT_EQ(texturePath, (Directory / "A" / "Textures" / "Rock.png").lexically_normal());
+
+	data.Release();
+}
+
+TEST_F(CookedMeshTests, RejectsIndicesOutsideOfBuffers)
+{
+	CookedSubmesh submesh;
+	submesh.BaseVertex = 1;
+	submesh.VertexCount = 3;
+	submesh.IndexCount = 6;
+
+	CookedMeshData data;
+	EXPECT_EQ(CookedMeshData::Read(WriteCookedGeometry(4, { { 0, 1, 2 }, { 2, 1, 0 } }, submesh), data), true);
+	data.Release();
+
+	// The index is inside of the vertex buffer, but outside of the vertices of its submesh
+	EXPECT_EQ(CookedMeshData::Read(WriteCookedGeometry(4, { { 0, 1, 2 }, { 3, 1, 0 } }, submesh), data), false);
+
+	// The index is outside of the vertex buffer
+	EXPECT_EQ(CookedMeshData::Read(WriteCookedGeometry(4, { { 0, 1, 2 }, { 0, 1, 9 } }, submesh), data), false);
+
+	// The submesh reaches past the index buffer
+	submesh.IndexCount = 9;
+	EXPECT_EQ(CookedMeshData::Read(WriteCookedGeometry(4, { { 0, 1, 2 }, { 2, 1, 0 } }, submesh), data), false);
+
+	// The submesh does not start at a triangle
+	submesh.BaseIndex = 1;
+	submesh.IndexCount = 3;
+	EXPECT_EQ(CookedMeshData::Read(WriteCookedGeometry(4, { { 0, 1, 2 }, { 2, 1, 0 } }, submesh), data), false);
+
+	// The submesh reaches past the vertex buffer
+	submesh.BaseIndex = 0;
+	submesh.BaseVertex = 2;
+	EXPECT_EQ(CookedMeshData::Read(WriteCookedGeometry(4, { { 0, 1, 2 }, { 2, 1, 0 } }, submesh), data), false);
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+using namespace highlo;
+
+struct DerivedDataCacheTests : public testing::Test
+{
+	DerivedDataCache Cache;
+	FileSystemPath Directory = FileSystemPath("DerivedDataCacheTest/");
+
+	DerivedDataCacheTests()
+	{
+		Cache.Init(Directory, 1024);
+	}
+
+	virtual ~DerivedDataCacheTests()
+	{
+		Cache.Shutdown();
+
+		std::error_code error;
+		std::filesystem::remove_all(*Directory.String(), error);
+	}
+};
+
+TEST_F(DerivedDataCacheTests, PutAndGet)
+{
+	DerivedDataKey key("Test", 1, 42, 7);
+	const char data[] = "derived data";
+	EXPECT_EQ(Cache.Put(key, data, sizeof(data)), true);
+
+	Allocator result;
+	EXPECT_EQ(Cache.Get(key, result), true);
+	EXPECT_EQ(result.Size, (uint32)sizeof(data));
+	EXPECT_EQ(memcmp(result.Data, data, sizeof(data)), 0);
+	result.Release();
+}
+
+TEST_F(DerivedDataCacheTests, KeyParts)
+{
+	const char data[] = "derived data";
+	Cache.Put(DerivedDataKey("Test", 1, 42, 7), data, sizeof(data));
+
+	// Every part of the key has to match
+	EXPECT_EQ(Cache.Contains(DerivedDataKey("Test", 1, 42, 7)), true);
+	EXPECT_EQ(Cache.Contains(DerivedDataKey("Test", 2, 42, 7)), false);
+	EXPECT_EQ(Cache.Contains(DerivedDataKey("Test", 1, 43, 7)), false);
+	EXPECT_EQ(Cache.Contains(DerivedDataKey("Test", 1, 42, 8)), false);
+	EXPECT_EQ(Cache.Contains(DerivedDataKey("Other", 1, 42, 7)), false);
+}
+
+TEST_F(DerivedDataCacheTests, EvictLeastRecentlyUsed)
+{
+	std::vector<Byte> data(400, 0xAB);
+	DerivedDataKey first("Test", 1, 1);
+	DerivedDataKey second("Test", 1, 2);
+	DerivedDataKey third("Test", 1, 3);
+
+	Cache.Put(first, data.data(), data.size());
+	Cache.Put(second, data.data(), data.size());
+
+	// The first entry has been used more recently, so the second one is evicted
+	EXPECT_EQ(Cache.Contains(first), true);
+	Cache.Put(third, data.data(), data.size());
+
+	EXPECT_EQ(Cache.Contains(first), true);
+	EXPECT_EQ(Cache.Contains(second), false);
+	EXPECT_EQ(Cache.Contains(third), true);
+	EXPECT_EQ(Cache.GetStats().Evictions, 1);
+	EXPECT_EQ(Cache.GetStats().TotalSize <= 1024, true);
+}
+
+TEST_F(DerivedDataCacheTests, Reopen)
+{
+	const char data[] = "derived data";
+	DerivedDataKey key("Test", 1, 42);
+	Cache.Put(key, data, sizeof(data));
+	Cache.Shutdown();
+
+	EXPECT_EQ(Cache.Contains(key), false);
+
+	Cache.Init(Directory, 1024);
+	EXPECT_EQ(Cache.Contains(key), true);
+	EXPECT_EQ(Cache.GetStats().EntryCount, 1);
+}
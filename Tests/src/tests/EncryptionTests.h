@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added tests for byte spans, AES-GCM, streams, files and chunk-parallel encryption
 //     - 1.0 (2021-11-18) initial release
 //
 
@@ -17,6 +18,10 @@
 #include <HighLo.h>
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <random>
+
 using namespace highlo;
 
 TEST(TEST_CATEGORY, EncryptionWithString)
@@ -41,3 +46,247 @@ TEST(TEST_CATEGORY, EncryptionWithBase64String)
 	EXPECT_EQ(strcmp(*plainText, *resultPlainText), 0);
 }
 
+static std::vector<Byte> RandomEncryptionBytes(uint64 count, uint32 seed)
+{
+	std::mt19937 engine(seed);
+	std::vector<Byte> bytes(count);
+	for (Byte &byte : bytes)
+		byte = (Byte)(engine() & 0xFF);
+
+	return bytes;
+}
+
+TEST(TEST_CATEGORY, ByteSpansWithAllAlgorithms)
+{
+	const EncryptionAlgorithm algorithms[] =
+	{
+		EncryptionAlgorithm::AES_128_CBC, EncryptionAlgorithm::AES_192_CBC, EncryptionAlgorithm::AES_256_CBC,
+		EncryptionAlgorithm::AES_128_CFB, EncryptionAlgorithm::AES_192_CFB, EncryptionAlgorithm::AES_256_CFB,
+		EncryptionAlgorithm::AES_128_GCM, EncryptionAlgorithm::AES_192_GCM, EncryptionAlgorithm::AES_256_GCM,
+		EncryptionAlgorithm::AES_128_CCM, EncryptionAlgorithm::AES_192_CCM, EncryptionAlgorithm::AES_256_CCM
+	};
+	const uint64 lengths[] = { 0, 1, 15, 16, 17, 1000, 100000 };
+
+	for (EncryptionAlgorithm algorithm : algorithms)
+	{
+		Encryptor enc(KEY, IV, algorithm);
+		for (uint64 length : lengths)
+		{
+			std::vector<Byte> plain = RandomEncryptionBytes(length, (uint32)length);
+
+			std::vector<Byte> cipher;
+			ASSERT_TRUE(enc.Encrypt(plain.data(), plain.size(), cipher));
+			EXPECT_EQ(cipher.size(), enc.GetCipherLength(length));
+
+			std::vector<Byte> decrypted;
+			ASSERT_TRUE(enc.Decrypt(cipher.data(), cipher.size(), decrypted));
+			EXPECT_EQ(decrypted, plain);
+		}
+	}
+}
+
+TEST(TEST_CATEGORY, AuthenticationDetectsChanges)
+{
+	Encryptor enc(KEY, IV, EncryptionAlgorithm::AES_256_GCM);
+	std::vector<Byte> plain = RandomEncryptionBytes(1000, 1);
+	const char *header = "archive header";
+
+	std::vector<Byte> cipher;
+	ASSERT_TRUE(enc.Encrypt(plain.data(), plain.size(), cipher, (const Byte*)header, strlen(header)));
+
+	// Every message gets its own nonce
+	std::vector<Byte> secondCipher;
+	ASSERT_TRUE(enc.Encrypt(plain.data(), plain.size(), secondCipher, (const Byte*)header, strlen(header)));
+	EXPECT_NE(cipher, secondCipher);
+
+	std::vector<Byte> decrypted;
+	EXPECT_TRUE(enc.Decrypt(cipher.data(), cipher.size(), decrypted, (const Byte*)header, strlen(header)));
+	EXPECT_EQ(decrypted, plain);
+
+	EXPECT_FALSE(enc.Decrypt(cipher.data(), cipher.size(), decrypted));
+	EXPECT_TRUE(decrypted.empty());
+
+	cipher[500] ^= 1;
+	EXPECT_FALSE(enc.Decrypt(cipher.data(), cipher.size(), decrypted, (const Byte*)header, strlen(header)));
+
+	Encryptor wrongKey("0000000000000000000000000000000000000000000000000000000000000000", IV, EncryptionAlgorithm::AES_256_GCM);
+	cipher[500] ^= 1;
+	EXPECT_FALSE(wrongKey.Decrypt(cipher.data(), cipher.size(), decrypted, (const Byte*)header, strlen(header)));
+}
+
+TEST(TEST_CATEGORY, StreamsMatchOneShot)
+{
+	std::vector<Byte> plain = RandomEncryptionBytes(50000, 2);
+	std::mt19937 engine(3);
+
+	for (EncryptionAlgorithm algorithm : { EncryptionAlgorithm::AES_256_CBC, EncryptionAlgorithm::AES_256_CFB, EncryptionAlgorithm::AES_256_GCM })
+	{
+		Encryptor enc(KEY, IV, algorithm);
+		std::vector<Byte> buffer;
+
+		CipherStream encryptStream = enc.CreateEncryptStream();
+		ASSERT_TRUE(encryptStream.IsValid());
+
+		std::vector<Byte> cipher;
+		for (uint64 offset = 0; offset < plain.size();)
+		{
+			uint64 chunk = std::min<uint64>(engine() % 3000, plain.size() - offset);
+			buffer.resize(chunk + CipherStream::MaxOverhead);
+
+			uint64 written = 0;
+			ASSERT_TRUE(encryptStream.Update(plain.data() + offset, chunk, buffer.data(), written));
+			cipher.insert(cipher.end(), buffer.begin(), buffer.begin() + written);
+			offset += chunk;
+		}
+
+		buffer.resize(CipherStream::MaxOverhead);
+		uint64 written = 0;
+		ASSERT_TRUE(encryptStream.Finish(buffer.data(), written));
+		cipher.insert(cipher.end(), buffer.begin(), buffer.begin() + written);
+		EXPECT_EQ(cipher.size(), enc.GetCipherLength(plain.size()));
+
+		// The stream output is a normal message
+		std::vector<Byte> decrypted;
+		ASSERT_TRUE(enc.Decrypt(cipher.data(), cipher.size(), decrypted));
+		EXPECT_EQ(decrypted, plain);
+
+		CipherStream decryptStream = enc.CreateDecryptStream();
+		decrypted.clear();
+		for (uint64 offset = 0; offset < cipher.size();)
+		{
+			uint64 chunk = std::min<uint64>(engine() % 20, cipher.size() - offset);
+			buffer.resize(chunk + CipherStream::MaxOverhead);
+
+			ASSERT_TRUE(decryptStream.Update(cipher.data() + offset, chunk, buffer.data(), written));
+			decrypted.insert(decrypted.end(), buffer.begin(), buffer.begin() + written);
+			offset += chunk;
+		}
+
+		buffer.resize(CipherStream::MaxOverhead);
+		ASSERT_TRUE(decryptStream.Finish(buffer.data(), written));
+		decrypted.insert(decrypted.end(), buffer.begin(), buffer.begin() + written);
+		EXPECT_EQ(decrypted, plain);
+	}
+
+	// A changed tag is only noticed by Finish
+	Encryptor enc(KEY, IV, EncryptionAlgorithm::AES_256_GCM);
+	std::vector<Byte> cipher;
+	ASSERT_TRUE(enc.Encrypt(plain.data(), plain.size(), cipher));
+	cipher.back() ^= 1;
+
+	std::vector<Byte> buffer(cipher.size() + CipherStream::MaxOverhead);
+	uint64 written = 0;
+	CipherStream decryptStream = enc.CreateDecryptStream();
+	EXPECT_TRUE(decryptStream.Update(cipher.data(), cipher.size(), buffer.data(), written));
+	EXPECT_FALSE(decryptStream.Finish(buffer.data(), written));
+
+	Encryptor ccm(KEY, IV, EncryptionAlgorithm::AES_256_CCM);
+	EXPECT_FALSE(ccm.CreateEncryptStream().IsValid());
+}
+
+TEST(TEST_CATEGORY, ParallelChunks)
+{
+	const uint32 chunkSize = 64 * 1024;
+	std::vector<Byte> plain = RandomEncryptionBytes(20 * chunkSize + 123, 4);
+
+	for (EncryptionAlgorithm algorithm : { EncryptionAlgorithm::AES_256_CBC, EncryptionAlgorithm::AES_256_CFB, EncryptionAlgorithm::AES_256_GCM, EncryptionAlgorithm::AES_256_CCM })
+	{
+		Encryptor enc(KEY, IV, algorithm);
+
+		std::vector<Byte> cipher;
+		ASSERT_TRUE(enc.EncryptParallel(plain.data(), plain.size(), cipher, chunkSize));
+
+		std::vector<Byte> decrypted;
+		ASSERT_TRUE(enc.DecryptParallel(cipher.data(), cipher.size(), decrypted, chunkSize));
+		EXPECT_EQ(decrypted, plain);
+
+		std::vector<Byte> empty;
+		ASSERT_TRUE(enc.EncryptParallel(nullptr, 0, cipher, chunkSize));
+		ASSERT_TRUE(enc.DecryptParallel(cipher.data(), cipher.size(), decrypted, chunkSize));
+		EXPECT_EQ(decrypted, empty);
+	}
+
+	// The first chunk of CBC is a normal message, because its iv is not changed
+	Encryptor cbc(KEY, IV, EncryptionAlgorithm::AES_256_CBC);
+	std::vector<Byte> parallelCipher;
+	std::vector<Byte> cipher;
+	ASSERT_TRUE(cbc.EncryptParallel(plain.data(), chunkSize, parallelCipher, chunkSize));
+	ASSERT_TRUE(cbc.Encrypt(plain.data(), chunkSize, cipher));
+	EXPECT_EQ(parallelCipher, cipher);
+
+	// Authenticated chunks can not be dropped or reordered
+	Encryptor gcm(KEY, IV, EncryptionAlgorithm::AES_256_GCM);
+	ASSERT_TRUE(gcm.EncryptParallel(plain.data(), plain.size(), cipher, chunkSize));
+
+	const uint64 chunkCipherSize = chunkSize + 16;
+	std::vector<Byte> decrypted;
+	EXPECT_FALSE(gcm.DecryptParallel(cipher.data(), 12 + 10 * chunkCipherSize, decrypted, chunkSize));
+
+	std::vector<Byte> swapped = cipher;
+	std::swap_ranges(swapped.begin() + 12, swapped.begin() + 12 + chunkCipherSize, swapped.begin() + 12 + chunkCipherSize);
+	EXPECT_FALSE(gcm.DecryptParallel(swapped.data(), swapped.size(), decrypted, chunkSize));
+}
+
+TEST(TEST_CATEGORY, ParallelFromPoolWorkers)
+{
+	const uint32 chunkSize = 16 * 1024;
+	std::vector<Byte> plain = RandomEncryptionBytes(8 * chunkSize + 7, 5);
+	Encryptor enc(KEY, IV, EncryptionAlgorithm::AES_256_GCM);
+
+	// More jobs than workers, so every worker calls EncryptParallel, while the helper jobs are queued behind the other jobs
+	const uint32 jobCount = ThreadPool::Get().GetThreadCount() * 2 + 2;
+	std::atomic<uint32> succeeded = 0;
+	for (uint32 job = 0; job < jobCount; ++job)
+	{
+		ThreadPool::Get().Submit([&]()
+		{
+			std::vector<Byte> cipher;
+			std::vector<Byte> decrypted;
+			if (enc.EncryptParallel(plain.data(), plain.size(), cipher, chunkSize)
+				&& enc.DecryptParallel(cipher.data(), cipher.size(), decrypted, chunkSize)
+				&& decrypted == plain)
+				succeeded.fetch_add(1);
+		});
+	}
+
+	ThreadPool::Get().Wait();
+	EXPECT_EQ(succeeded.load(), jobCount);
+}
+
+TEST(TEST_CATEGORY, FileStreaming)
+{
+	const char *plainPath = "EncryptionTestPlain.bin";
+	const char *cipherPath = "EncryptionTestCipher.bin";
+	const char *resultPath = "EncryptionTestResult.bin";
+
+	std::vector<Byte> plain = RandomEncryptionBytes(3 * 1024 * 1024 + 7, 5);
+	{
+		std::ofstream out(plainPath, std::ios::out | std::ios::binary | std::ios::trunc);
+		out.write((const char*)plain.data(), plain.size());
+	}
+
+	Encryptor enc(KEY, IV, EncryptionAlgorithm::AES_256_GCM);
+	ASSERT_TRUE(enc.EncryptFileData(plainPath, cipherPath));
+	EXPECT_EQ(std::filesystem::file_size(cipherPath), enc.GetCipherLength(plain.size()));
+
+	ASSERT_TRUE(enc.DecryptFileData(cipherPath, resultPath));
+	std::ifstream in(resultPath, std::ios::in | std::ios::binary);
+	std::vector<Byte> result((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	in.close();
+	EXPECT_EQ(result, plain);
+
+	// A manipulated file does not leave a result behind
+	std::filesystem::remove(resultPath);
+	{
+		std::fstream file(cipherPath, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekg(1000);
+		char byte = (char)file.get();
+		file.seekp(1000);
+		file.put((char)(byte ^ 1));
+	}
+	EXPECT_FALSE(enc.DecryptFileData(cipherPath, resultPath));
+	EXPECT_FALSE(std::filesystem::exists(resultPath));
+
+	std::filesystem::remove(plainPath);
+	std::filesystem::remove(cipherPath);
+}
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added MappedFile and FileStreamReader tests
 //     - 1.0 (2021-11-18) initial release
 //
 
@@ -87,3 +88,70 @@ TEST(TEST_CATEGORY, HasEnvVar)
 
 }
 
+static void WriteTestFile(const char *fileName, const std::string &content)
+{
+	std::ofstream out(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+	out.write(content.data(), content.size());
+}
+
+TEST(TEST_CATEGORY, MappedFileTest)
+{
+	WriteTestFile("MappedFileTest.txt", "Hello mapped world");
+
+	MappedFile file(FileSystemPath("MappedFileTest.txt"));
+	EXPECT_EQ(file.IsOpen(), true);
+	EXPECT_EQ(file.GetSize(), 18);
+	EXPECT_EQ(memcmp(file.GetText(), "Hello mapped world", 18), 0);
+
+	MappedFile moved = std::move(file);
+	EXPECT_EQ(file.IsOpen(), false);
+	EXPECT_EQ(moved.GetSize(), 18);
+
+	moved.Close();
+	EXPECT_EQ(moved.GetData(), nullptr);
+	std::remove("MappedFileTest.txt");
+
+	EXPECT_EQ(moved.Open(FileSystemPath("MappedFileMissing.txt")), false);
+}
+
+TEST(TEST_CATEGORY, MappedEmptyFile)
+{
+	WriteTestFile("MappedEmptyFile.txt", "");
+
+	MappedFile file(FileSystemPath("MappedEmptyFile.txt"));
+	EXPECT_EQ(file.IsOpen(), true);
+	EXPECT_EQ(file.GetSize(), 0);
+
+	file.Close();
+	std::remove("MappedEmptyFile.txt");
+}
+
+TEST(TEST_CATEGORY, FileStreamReaderTest)
+{
+	WriteTestFile("FileStreamReaderTest.txt", "first line\r\nsecond line\nlast");
+
+	{
+		// The buffer is smaller than a line, so lines have to be assembled from several chunks
+		FileStreamReader reader(FileSystemPath("FileStreamReaderTest.txt"), 4);
+		EXPECT_EQ(reader.IsOpen(), true);
+		EXPECT_EQ(reader.GetSize(), 28);
+
+		HLString line;
+		EXPECT_EQ(reader.ReadLine(line), true);
+		EXPECT_EQ(StringEquals(line, "first line"), true);
+		EXPECT_EQ(reader.ReadLine(line), true);
+		EXPECT_EQ(StringEquals(line, "second line"), true);
+		EXPECT_EQ(reader.ReadLine(line), true);
+		EXPECT_EQ(StringEquals(line, "last"), true);
+		EXPECT_EQ(reader.ReadLine(line), false);
+
+		char word[6] = {};
+		EXPECT_EQ(reader.Seek(12), true);
+		EXPECT_EQ(reader.Read(word, 6), 6);
+		EXPECT_EQ(memcmp(word, "second", 6), 0);
+		EXPECT_EQ(reader.GetPosition(), 18);
+	}
+
+	std::remove("FileStreamReaderTest.txt");
+}
+
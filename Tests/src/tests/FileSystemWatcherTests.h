@@ -0,0 +1,78 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY FileSystemWatcherTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+using namespace highlo;
+
+TEST(TEST_CATEGORY, CoalescesSaveStorm)
+{
+	FileSystemChangeBatch batch;
+	batch.Add(FileSystemAction::Added, "assets/mesh.fbx.tmp", false);
+	for (uint32 i = 0; i < 100; ++i)
+		batch.Add(FileSystemAction::Modified, "assets/mesh.fbx.tmp", false);
+	batch.Add(FileSystemAction::Renamed, "assets/mesh.fbx", false, "assets/mesh.fbx.tmp");
+
+	EXPECT_EQ(batch.GetRawCount(), 102u);
+
+	std::vector<FileSystemChangedEvent> events = batch.Flush();
+	ASSERT_EQ(events.size(), 1u);
+
+	// The atomic save replaces the existing file, so it has to be reloaded
+	EXPECT_EQ(events[0].Action, FileSystemAction::Modified);
+	EXPECT_EQ(events[0].FilePath.String(), HLString("assets/mesh.fbx"));
+	EXPECT_TRUE(batch.IsEmpty());
+	EXPECT_EQ(batch.GetRawCount(), 0u);
+}
+
+TEST(TEST_CATEGORY, CancelsTemporaryFiles)
+{
+	FileSystemChangeBatch batch;
+	batch.Add(FileSystemAction::Added, "assets/temp.txt", false);
+	batch.Add(FileSystemAction::Modified, "assets/temp.txt", false);
+	batch.Add(FileSystemAction::Deleted, "assets/temp.txt", false);
+
+	// Renamed and renamed back again
+	batch.Add(FileSystemAction::Renamed, "assets/b.png", false, "assets/a.png");
+	batch.Add(FileSystemAction::Renamed, "assets/a.png", false, "assets/b.png");
+
+	EXPECT_TRUE(batch.IsEmpty());
+	EXPECT_EQ(batch.Flush().size(), 0u);
+}
+
+TEST(TEST_CATEGORY, KeepsOrderAndRenames)
+{
+	FileSystemChangeBatch batch;
+	batch.Add(FileSystemAction::Deleted, "assets/shader.glsl", false);
+	batch.Add(FileSystemAction::Renamed, "assets/new.png", false, "assets/old.png");
+	batch.Add(FileSystemAction::Added, "assets/shader.glsl", false);
+	batch.Add(FileSystemAction::Renamed, "assets/textures/moved.png", false, "assets/moved.png");
+
+	std::vector<FileSystemChangedEvent> events = batch.Flush();
+	ASSERT_EQ(events.size(), 3u);
+
+	// Recreated files are reported as modified
+	EXPECT_EQ(events[0].Action, FileSystemAction::Modified);
+	EXPECT_EQ(events[0].FilePath.String(), HLString("assets/shader.glsl"));
+
+	EXPECT_EQ(events[1].Action, FileSystemAction::Renamed);
+	EXPECT_EQ(events[1].OldName, HLString("old.png"));
+	EXPECT_EQ(events[1].NewName, HLString("new.png"));
+	EXPECT_EQ(events[1].OldFilePath.String(), HLString("assets/old.png"));
+
+	// Renames between directories keep the full previous path
+	EXPECT_EQ(events[2].Action, FileSystemAction::Renamed);
+	EXPECT_EQ(events[2].OldFilePath.String(), HLString("assets/moved.png"));
+	EXPECT_EQ(events[2].FilePath.String(), HLString("assets/textures/moved.png"));
+	EXPECT_EQ(events[2].OldName, HLString("moved.png"));
+}
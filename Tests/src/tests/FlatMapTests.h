@@ -0,0 +1,119 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY FlatMapTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+TEST(TEST_CATEGORY, InsertAndFind)
+{
+	HLFlatMap<HLString, uint64> map;
+	EXPECT_EQ(map.Insert("b", 2).second, true);
+	EXPECT_EQ(map.Insert("a", 1).second, true);
+	EXPECT_EQ(map.Insert("c", 3).second, true);
+	EXPECT_EQ(map.Insert("a", 10).second, false);
+
+	EXPECT_EQ(map.Size(), 3u);
+	EXPECT_EQ(map.Contains("a"), true);
+	EXPECT_EQ(map.Contains("d"), false);
+	EXPECT_EQ(map.At("a"), 1u);
+	EXPECT_EQ(map.TryGet("d"), nullptr);
+
+	map.InsertOrAssign("a", 10);
+	EXPECT_EQ(*map.TryGet("a"), 10u);
+
+	map["d"] = 4;
+	EXPECT_EQ(map.At("d"), 4u);
+}
+
+TEST(TEST_CATEGORY, IteratesInOrder)
+{
+	HLFlatMap<uint32, uint32> map = { { 5, 50 }, { 1, 10 }, { 3, 30 } };
+
+	uint32 previous = 0;
+	uint32 count = 0;
+	for (const auto &[key, value] : map)
+	{
+		EXPECT_GT(key, previous);
+		EXPECT_EQ(value, key * 10);
+		previous = key;
+		++count;
+	}
+
+	EXPECT_EQ(count, 3u);
+	EXPECT_EQ(map.LowerBound(2)->first, 3u);
+	EXPECT_EQ(map.UpperBound(3)->first, 5u);
+	EXPECT_EQ(map.UpperBound(5) == map.end(), true);
+}
+
+TEST(TEST_CATEGORY, Remove)
+{
+	HLFlatMap<uint32, uint32> map = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+	EXPECT_EQ(map.Remove(2), true);
+	EXPECT_EQ(map.Remove(2), false);
+	EXPECT_EQ(map.Size(), 2u);
+	EXPECT_EQ(map.Contains(2), false);
+
+	auto next = map.Remove(map.Find(1));
+	EXPECT_EQ(next->first, 3u);
+
+	map.Clear();
+	EXPECT_EQ(map.IsEmpty(), true);
+}
+
+TEST(TEST_CATEGORY, FromSorted)
+{
+	std::vector<std::pair<uint32, HLString>> entries = { { 1, "one" }, { 2, "two" }, { 4, "four" } };
+	HLFlatMap<uint32, HLString> map = HLFlatMap<uint32, HLString>::FromSorted(std::move(entries));
+
+	EXPECT_EQ(map.Size(), 3u);
+	EXPECT_EQ(StringEquals(map.At(4), "four"), true);
+	EXPECT_EQ(map.Contains(3), false);
+}
+
+TEST(TEST_CATEGORY, MatchesStdMap)
+{
+	std::mt19937 random(42);
+	HLFlatMap<uint32, uint32> map;
+	std::map<uint32, uint32> reference;
+
+	for (uint32 i = 0; i < 5000; ++i)
+	{
+		uint32 key = random() % 1000;
+		if (random() % 3 == 0)
+		{
+			EXPECT_EQ(map.Remove(key), reference.erase(key) == 1);
+		}
+		else
+		{
+			map.InsertOrAssign(key, i);
+			reference[key] = i;
+		}
+	}
+
+	ASSERT_EQ(map.Size(), (uint32)reference.size());
+
+	auto it = reference.begin();
+	for (const auto &[key, value] : map)
+	{
+		EXPECT_EQ(key, it->first);
+		EXPECT_EQ(value, it->second);
+		++it;
+	}
+}
+
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added in situ and streaming tests
 //     - 1.0 (2022-03-08) initial release
 //
 
@@ -12,6 +13,9 @@
 
 #include "TestUtils.h"
 
+#include <filesystem>
+#include <fstream>
+
 struct JsonReadParserTests : public testing::Test
 {
 	Ref<DocumentReader> Reader;
@@ -26,3 +30,60 @@ struct JsonReadParserTests : public testing::Test
 	}
 };
 
+struct JsonStreamCounter : public DocumentStreamHandler
+{
+	uint32 Keys = 0;
+	uint32 Numbers = 0;
+	uint32 Strings = 0;
+	uint32 Objects = 0;
+	uint32 ArrayElements = 0;
+	int64 Sum = 0;
+	bool StopAtFirstKey = false;
+
+	virtual bool OnInt64(int64 value) override { ++Numbers; Sum += value; return true; }
+	virtual bool OnUInt64(uint64 value) override { ++Numbers; Sum += (int64)value; return true; }
+	virtual bool OnDouble(double value) override { ++Numbers; return true; }
+	virtual bool OnString(const char *str, uint32 length) override { ++Strings; return true; }
+	virtual bool OnKey(const char *key, uint32 length) override { ++Keys; return !StopAtFirstKey; }
+	virtual bool OnEndObject(uint32 memberCount) override { ++Objects; return true; }
+	virtual bool OnEndArray(uint32 elementCount) override { ArrayElements += elementCount; return true; }
+};
+
+TEST_F(JsonReadParserTests, ReadInSituContent)
+{
+	Reader->SetContent("{ \"count\": 42, \"name\": \"HighLo\" }");
+
+	int32 count = 0;
+	HLString name;
+	EXPECT_TRUE(Reader->ReadInt32("count", &count));
+	EXPECT_TRUE(Reader->ReadString("name", &name));
+	EXPECT_EQ(count, 42);
+	EXPECT_EQ(name, HLString("HighLo"));
+}
+
+TEST_F(JsonReadParserTests, ReadStream)
+{
+	const char *filePath = "JsonStreamTest.json";
+	{
+		std::ofstream out(filePath, std::ios::out | std::ios::trunc);
+		out << "{ \"values\": [1, -2, 3.5, true, null, \"text\"], \"nested\": { \"a\": 10 } }";
+	}
+
+	JsonStreamCounter counter;
+	EXPECT_TRUE(Reader->ReadStream(counter, filePath));
+	EXPECT_EQ(counter.Keys, 3u);
+	EXPECT_EQ(counter.Numbers, 4u);
+	EXPECT_EQ(counter.Strings, 1u);
+	EXPECT_EQ(counter.Objects, 2u);
+	EXPECT_EQ(counter.ArrayElements, 6u);
+	EXPECT_EQ(counter.Sum, 9);
+
+	// The handler can stop the parsing early
+	JsonStreamCounter stopping;
+	stopping.StopAtFirstKey = true;
+	EXPECT_FALSE(Reader->ReadStream(stopping, filePath));
+	EXPECT_EQ(stopping.Keys, 1u);
+
+	std::error_code error;
+	std::filesystem::remove(filePath, error);
+}
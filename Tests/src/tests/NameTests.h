@@ -0,0 +1,125 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY NameTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+TEST(TEST_CATEGORY, EqualStringsShareOneID)
+{
+	HLName a = "u_Color";
+	HLName b = HLString("u_Color");
+	HLName c("u_Color with suffix", 7);
+	HLName d = "u_Metalness";
+
+	EXPECT_EQ(a, b);
+	EXPECT_EQ(a, c);
+	EXPECT_NE(a, d);
+	EXPECT_EQ(a.GetID(), b.GetID());
+	EXPECT_EQ(a.GetHash(), b.GetHash());
+	EXPECT_EQ(StringEquals(a.GetString(), "u_Color"), true);
+	EXPECT_EQ(a.Length(), 7u);
+}
+
+TEST(TEST_CATEGORY, EmptyName)
+{
+	HLName none;
+	HLName empty = "";
+
+	EXPECT_EQ(none.IsNone(), true);
+	EXPECT_EQ(none, empty);
+	EXPECT_EQ(none.GetID(), HLName::None);
+	EXPECT_EQ(StringEquals(none.GetString(), ""), true);
+}
+
+TEST(TEST_CATEGORY, LiteralsAreHashedAtCompileTime)
+{
+	static constexpr HLNameLiteral literal("u_Transform");
+	static_assert(literal.Length == 11, "The length of a literal is computed at compile time");
+	static_assert(literal.Hash == utils::HashName("u_Transform", 11), "The hash of a literal is computed at compile time");
+
+	const HLName &name = HL_NAME("u_Transform");
+	EXPECT_EQ(name, HLName("u_Transform"));
+	EXPECT_EQ(name.GetHash(), literal.Hash);
+
+	// The same call site returns the same object
+	const HLName *first = nullptr;
+	for (uint32 i = 0; i < 2; ++i)
+	{
+		const HLName &cached = HL_NAME("u_ViewProjection");
+		if (!first)
+			first = &cached;
+
+		EXPECT_EQ(first, &cached);
+	}
+}
+
+TEST(TEST_CATEGORY, FindDoesNotIntern)
+{
+	uint32 count = HLName::GetNameCount();
+
+	EXPECT_EQ(HLName::Find("a-name-that-is-never-interned", 29).IsNone(), true);
+	EXPECT_EQ(HLName::GetNameCount(), count);
+
+	HLName name = "a-name-that-is-interned-once";
+	EXPECT_EQ(HLName::Find("a-name-that-is-interned-once", 28), name);
+	EXPECT_EQ(HLName::FromID(name.GetID()), name);
+}
+
+TEST(TEST_CATEGORY, UsableAsKey)
+{
+	std::unordered_map<HLName, int32> values;
+	values[HLName("first")] = 1;
+	values[HLName("second")] = 2;
+
+	EXPECT_EQ(values[HLName("first")], 1);
+	EXPECT_EQ(values.at(HL_NAME("second")), 2);
+	EXPECT_EQ(values.find(HLName("third")), values.end());
+}
+
+TEST(TEST_CATEGORY, ConcurrentInterning)
+{
+	const uint32 threadCount = 8;
+	const uint32 nameCount = 2000;
+	std::vector<std::vector<uint32>> ids(threadCount, std::vector<uint32>(nameCount));
+
+	// All threads intern the same names in a different order
+	std::vector<std::thread> threads;
+	for (uint32 t = 0; t < threadCount; ++t)
+	{
+		threads.emplace_back([t, nameCount, &ids]()
+		{
+			for (uint32 i = 0; i < nameCount; ++i)
+			{
+				uint32 index = (i * 7 + t * 131) % nameCount;
+				HLName name = HLString("concurrent-name-") + HLString::ToString(index);
+				ids[t][index] = name.GetID();
+			}
+		});
+	}
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	for (uint32 i = 0; i < nameCount; ++i)
+	{
+		for (uint32 t = 1; t < threadCount; ++t)
+			EXPECT_EQ(ids[t][i], ids[0][i]);
+
+		EXPECT_EQ(StringEquals(HLName::FromID(ids[0][i]).GetString(), HLString("concurrent-name-") + HLString::ToString(i)), true);
+	}
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Added corrupted table of contents tests
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace highlo;
+
+struct PakArchiveTests : public testing::Test
+{
+	FileSystemPath Directory = FileSystemPath("PakArchiveTest/");
+	FileSystemPath ArchivePath = FileSystemPath("PakArchiveTest/test.hlpak");
+
+	PakArchiveTests()
+	{
+		Logger::Init();
+		std::filesystem::create_directories("PakArchiveTest/source/textures");
+
+		std::string text;
+		for (uint32 i = 0; i < 200; ++i)
+			text += "the same line over and over again\n";
+
+		WriteSource("PakArchiveTest/source/repeated.txt", text);
+		WriteSource("PakArchiveTest/source/textures/image.raw", "not compressible enough");
+		WriteSource("PakArchiveTest/source/empty.txt", "");
+	}
+
+	virtual ~PakArchiveTests()
+	{
+		std::error_code error;
+		std::filesystem::remove_all(*Directory.String(), error);
+		Logger::Shutdown();
+	}
+
+	void WriteSource(const char *path, const std::string &content)
+	{
+		std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		out.write(content.data(), content.size());
+	}
+};
+
+TEST(CompressionTests, LZ4RoundTrip)
+{
+	std::vector<Byte> source(100000);
+	for (uint32 i = 0; i < (uint32)source.size(); ++i)
+		source[i] = (Byte)((i % 251) ^ (i / 1000));
+
+	std::vector<Byte> compressed(Compression::GetMaxCompressedSize(CompressionType::LZ4, source.size()));
+	uint64 compressedSize = Compression::Compress(CompressionType::LZ4, source.data(), source.size(), compressed.data(), compressed.size());
+	EXPECT_GT(compressedSize, 0u);
+	EXPECT_LT(compressedSize, source.size());
+
+	std::vector<Byte> result(source.size());
+	EXPECT_EQ(Compression::Decompress(CompressionType::LZ4, compressed.data(), compressedSize, result.data(), result.size()), true);
+	EXPECT_EQ(result, source);
+
+	// A wrong size is detected instead of writing out of bounds
+	EXPECT_EQ(Compression::Decompress(CompressionType::LZ4, compressed.data(), compressedSize, result.data(), result.size() - 1), false);
+}
+
+TEST_F(PakArchiveTests, WriteAndRead)
+{
+	PakWriter writer;
+	EXPECT_EQ(writer.AddDirectory("PakArchiveTest/source"), 3u);
+
+	PakWriteOptions options;
+	options.UncompressedExtensions.push_back(".raw");
+	EXPECT_EQ(writer.Write(ArchivePath, options), true);
+
+	Ref<PakArchive> archive = PakArchive::Open(ArchivePath);
+	ASSERT_EQ((bool)archive, true);
+	EXPECT_EQ(archive->GetEntryCount(), 3u);
+
+	EXPECT_EQ(archive->Contains("repeated.txt"), true);
+	EXPECT_EQ(archive->Contains("./textures\\image.raw"), true);
+	EXPECT_EQ(archive->Contains("missing.txt"), false);
+	EXPECT_EQ(archive->GetFileSize("empty.txt"), 0);
+	EXPECT_EQ(archive->GetFileSize("missing.txt"), -1);
+
+	int64 size = 0;
+	Byte *data = archive->ReadFile("repeated.txt", &size);
+	ASSERT_NE(data, nullptr);
+	EXPECT_EQ(size, 200 * 34);
+	EXPECT_EQ(memcmp(data, "the same line over and over again\n", 34), 0);
+	delete[] data;
+
+	// The repeated text is compressed, so it can't be viewed in the mapping
+	uint64 viewSize = 0;
+	EXPECT_EQ(archive->GetUncompressedView("repeated.txt", &viewSize), nullptr);
+
+	const Byte *view = archive->GetUncompressedView("textures/image.raw", &viewSize);
+	ASSERT_NE(view, nullptr);
+	EXPECT_EQ(viewSize, 23u);
+	EXPECT_EQ((uint64)view % HL_PAK_DEFAULT_ALIGNMENT, 0u);
+	EXPECT_EQ(memcmp(view, "not compressible enough", 23), 0);
+}
+
+TEST_F(PakArchiveTests, MountArchive)
+{
+	PakWriter writer;
+	writer.AddDirectory("PakArchiveTest/source");
+	EXPECT_EQ(writer.Write(ArchivePath), true);
+
+	VirtualFileSystem *vfs = VirtualFileSystem::Get();
+	EXPECT_EQ(vfs->MountArchive("pak", ArchivePath), true);
+
+	EXPECT_EQ(vfs->FileExists("/pak/textures/image.raw"), true);
+	EXPECT_EQ(vfs->FileExists("/pak/textures/missing.raw"), false);
+	EXPECT_EQ(vfs->GetFileSize("/pak/textures/image.raw"), 23);
+	EXPECT_EQ(vfs->ReadTextFile("/pak/textures/image.raw"), "not compressible enough");
+
+	vfs->Unmount("pak");
+	EXPECT_EQ(vfs->FileExists("/pak/textures/image.raw"), false);
+}
+
+TEST_F(PakArchiveTests, RejectsInvalidFiles)
+{
+	EXPECT_EQ((bool)PakArchive::Open("PakArchiveTest/source/repeated.txt"), false);
+	EXPECT_EQ((bool)PakArchive::Open("PakArchiveTest/missing.hlpak"), false);
+}
+
+TEST_F(PakArchiveTests, RejectsCorruptTableOfContents)
+{
+	PakWriter writer;
+	writer.AddDirectory("PakArchiveTest/source");
+	EXPECT_EQ(writer.Write(ArchivePath), true);
+
+	std::ifstream in(*ArchivePath.String(), std::ios::in | std::ios::binary);
+	std::vector<char> original((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	in.close();
+
+	PakHeader header;
+	memcpy(&header, original.data(), sizeof(PakHeader));
+
+	uint32 compressedIndex = 0;
+	for (uint32 i = 0; i < header.EntryCount; ++i)
+	{
+		PakEntry entry;
+		memcpy(&entry, original.data() + header.EntryOffset + i * sizeof(PakEntry), sizeof(PakEntry));
+		if (entry.Compression == CompressionType::LZ4)
+			compressedIndex = i;
+	}
+
+	auto openCorrupted = [&](const std::function<void(PakEntry&)> &corrupt)
+	{
+		std::vector<char> data = original;
+		PakEntry *entry = (PakEntry*)(data.data() + header.EntryOffset + compressedIndex * sizeof(PakEntry));
+		corrupt(*entry);
+		WriteSource("PakArchiveTest/corrupt.hlpak", std::string(data.data(), data.size()));
+		return (bool)PakArchive::Open("PakArchiveTest/corrupt.hlpak");
+	};
+
+	EXPECT_EQ(openCorrupted([](PakEntry&) {}), true);
+
+	// An uncompressed size, that no compressed data of this size can have, would allocate a huge buffer
+	EXPECT_EQ(openCorrupted([](PakEntry &entry) { entry.Size = 1ull << 60; }), false);
+	EXPECT_EQ(openCorrupted([](PakEntry &entry) { entry.Offset = ~0ull - 4; }), false);
+	EXPECT_EQ(openCorrupted([&](PakEntry &entry) { entry.CompressedSize = original.size(); }), false);
+	EXPECT_EQ(openCorrupted([](PakEntry &entry) { entry.Offset = 0; }), false);
+}
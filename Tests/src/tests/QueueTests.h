@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added tests for the ring buffer growth
 //     - 1.0 (2021-11-18) initial release
 //
 
@@ -65,3 +66,44 @@ TEST_F(QueueTests, Clear)
 	EXPECT_EQ(Queue.IsEmpty(), true);
 }
 
+TEST_F(QueueTests, WrapAroundAndGrow)
+{
+	HLQueue<int32> queue;
+	int32 next = 0;
+	int32 expected = 0;
+
+	// Dequeue some elements between the enqueues, so the ring buffer wraps around before it grows
+	for (int32 round = 0; round < 100; ++round)
+	{
+		for (int32 i = 0; i < 7; ++i)
+			queue.Enqueue(next++);
+
+		for (int32 i = 0; i < 5; ++i)
+		{
+			EXPECT_EQ(queue.Front(), expected++);
+			queue.Dequeue();
+		}
+	}
+
+	EXPECT_EQ(queue.Size(), 200u);
+	EXPECT_EQ(queue.Back(), next - 1);
+
+	int32 value = 0;
+	while (queue.TryDequeue(value))
+		EXPECT_EQ(value, expected++);
+
+	EXPECT_EQ(expected, next);
+	EXPECT_EQ(queue.IsEmpty(), true);
+}
+
+TEST_F(QueueTests, CopyAndMove)
+{
+	HLQueue<HLString> copy = Queue;
+	EXPECT_EQ(copy.Size(), 3u);
+	EXPECT_EQ(StringEquals(copy.At(2), "LOL"), true);
+
+	HLQueue<HLString> moved = std::move(copy);
+	EXPECT_EQ(moved.Size(), 3u);
+	EXPECT_EQ(copy.IsEmpty(), true);
+	EXPECT_EQ(StringEquals(moved.Front(), "Hello World!"), true);
+}
@@ -0,0 +1,240 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY SortingTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+static std::vector<int32> CreateSortingInput(uint32 count, int32 maxValue, uint32 seed = 42)
+{
+	std::mt19937 random(seed);
+	std::uniform_int_distribution<int32> distribution(-maxValue, maxValue);
+
+	std::vector<int32> values(count);
+	for (int32 &value : values)
+		value = distribution(random);
+
+	return values;
+}
+
+static std::vector<int32> SortedCopy(std::vector<int32> values)
+{
+	std::sort(values.begin(), values.end());
+	return values;
+}
+
+struct SortingTestItem
+{
+	int32 Key;
+	int32 Index;
+};
+
+TEST(TEST_CATEGORY, IntroSortRandomInput)
+{
+	for (uint32 count : { 0u, 1u, 2u, 15u, 16u, 17u, 100u, 10000u })
+	{
+		std::vector<int32> values = CreateSortingInput(count, 1000000);
+		std::vector<int32> expected = SortedCopy(values);
+
+		Sorting::IntroSort(values.data(), (int32)values.size());
+		EXPECT_EQ(VectorEquals(values, expected), true);
+	}
+}
+
+TEST(TEST_CATEGORY, IntroSortSortedReversedAndDuplicates)
+{
+	std::vector<int32> sorted(10000);
+	for (int32 i = 0; i < (int32)sorted.size(); ++i)
+		sorted[i] = i;
+
+	std::vector<int32> values = sorted;
+	Sorting::IntroSort(values.data(), (int32)values.size());
+	EXPECT_EQ(VectorEquals(values, sorted), true);
+
+	std::reverse(values.begin(), values.end());
+	Sorting::IntroSort(values.data(), (int32)values.size());
+	EXPECT_EQ(VectorEquals(values, sorted), true);
+
+	std::vector<int32> duplicates = CreateSortingInput(10000, 3);
+	std::vector<int32> expected = SortedCopy(duplicates);
+	Sorting::IntroSort(duplicates.data(), (int32)duplicates.size());
+	EXPECT_EQ(VectorEquals(duplicates, expected), true);
+}
+
+TEST(TEST_CATEGORY, CustomCompare)
+{
+	std::vector<int32> values = CreateSortingInput(1000, 1000);
+	std::vector<int32> expected = SortedCopy(values);
+	std::reverse(expected.begin(), expected.end());
+
+	Sorting::IntroSort(values.data(), (int32)values.size(), [](int32 a, int32 b) { return a > b; });
+	EXPECT_EQ(VectorEquals(values, expected), true);
+
+	std::vector<int32> heapValues = CreateSortingInput(1000, 1000);
+	Sorting::HeapSort(heapValues.data(), (int32)heapValues.size(), [](int32 a, int32 b) { return a > b; });
+	EXPECT_EQ(VectorEquals(heapValues, expected), true);
+}
+
+TEST(TEST_CATEGORY, QuickSortCompatibility)
+{
+	std::vector<int32> values = CreateSortingInput(1000, 1000);
+	std::vector<int32> expected = SortedCopy(values);
+
+	Sorting::QuickSort(values.data(), (int32)values.size());
+	EXPECT_EQ(VectorEquals(values, expected), true);
+
+	std::reverse(values.begin(), values.end());
+	Sorting::QuickSort(values.data(), (int32)values.size(), +[](const int32 &a, const int32 &b) { return a < b; });
+	EXPECT_EQ(VectorEquals(values, expected), true);
+}
+
+TEST(TEST_CATEGORY, MergeSortIsStable)
+{
+	std::vector<int32> keys = CreateSortingInput(5000, 10);
+	std::vector<SortingTestItem> items(keys.size());
+	for (int32 i = 0; i < (int32)items.size(); ++i)
+		items[i] = { keys[i], i };
+
+	Sorting::MergeSort(items.data(), (int32)items.size(), [](const SortingTestItem &a, const SortingTestItem &b) { return a.Key < b.Key; });
+
+	for (uint32 i = 1; i < items.size(); ++i)
+	{
+		EXPECT_LE(items[i - 1].Key, items[i].Key);
+		if (items[i - 1].Key == items[i].Key)
+			EXPECT_LT(items[i - 1].Index, items[i].Index);
+	}
+}
+
+TEST(TEST_CATEGORY, RadixSortIntegers)
+{
+	std::vector<int32> values = CreateSortingInput(10000, 2000000000);
+	std::vector<int32> expected = SortedCopy(values);
+
+	Sorting::RadixSort(values.data(), (int32)values.size());
+	EXPECT_EQ(VectorEquals(values, expected), true);
+
+	std::vector<uint64> wideValues(10000);
+	std::mt19937_64 random(7);
+	for (uint64 &value : wideValues)
+		value = random();
+
+	std::vector<uint64> wideExpected = wideValues;
+	std::sort(wideExpected.begin(), wideExpected.end());
+
+	Sorting::RadixSort(wideValues.data(), (int32)wideValues.size());
+	EXPECT_EQ(VectorEquals(wideValues, wideExpected), true);
+}
+
+TEST(TEST_CATEGORY, RadixSortSmallIntegers)
+{
+	std::vector<int32> input = CreateSortingInput(5000, 127);
+
+	std::vector<int8> bytes(input.begin(), input.end());
+	std::vector<int8> expectedBytes = bytes;
+	std::sort(expectedBytes.begin(), expectedBytes.end());
+	Sorting::RadixSort(bytes.data(), (int32)bytes.size());
+	EXPECT_EQ(VectorEquals(bytes, expectedBytes), true);
+
+	std::vector<char> chars(input.begin(), input.end());
+	std::vector<char> expectedChars = chars;
+	std::sort(expectedChars.begin(), expectedChars.end());
+	Sorting::RadixSort(chars.data(), (int32)chars.size());
+	EXPECT_EQ(VectorEquals(chars, expectedChars), true);
+
+	std::vector<int16> shorts;
+	for (int32 value : CreateSortingInput(5000, 32767, 3))
+		shorts.push_back((int16)value);
+
+	std::vector<int16> expectedShorts = shorts;
+	std::sort(expectedShorts.begin(), expectedShorts.end());
+	Sorting::RadixSort(shorts.data(), (int32)shorts.size());
+	EXPECT_EQ(VectorEquals(shorts, expectedShorts), true);
+}
+
+TEST(TEST_CATEGORY, RadixSortFloats)
+{
+	std::vector<float> values;
+	for (int32 value : CreateSortingInput(10000, 1000000))
+		values.push_back((float)value / 1000.0f);
+
+	values.push_back(-0.0f);
+	values.push_back(0.0f);
+	values.push_back(-1000000.0f);
+	values.push_back(1000000.0f);
+
+	std::vector<float> expected = values;
+	std::sort(expected.begin(), expected.end());
+
+	Sorting::RadixSort(values.data(), (int32)values.size());
+	for (uint32 i = 0; i < values.size(); ++i)
+		EXPECT_EQ(values[i], expected[i]);
+}
+
+TEST(TEST_CATEGORY, RadixSortByKeyIsStable)
+{
+	std::vector<int32> keys = CreateSortingInput(5000, 10);
+	std::vector<SortingTestItem> items(keys.size());
+	for (int32 i = 0; i < (int32)items.size(); ++i)
+		items[i] = { keys[i], i };
+
+	Sorting::RadixSort(items.data(), (int32)items.size(), [](const SortingTestItem &item) { return item.Key; });
+
+	for (uint32 i = 1; i < items.size(); ++i)
+	{
+		EXPECT_LE(items[i - 1].Key, items[i].Key);
+		if (items[i - 1].Key == items[i].Key)
+			EXPECT_LT(items[i - 1].Index, items[i].Index);
+	}
+}
+
+TEST(TEST_CATEGORY, ParallelSort)
+{
+	for (uint32 count : { 100u, 100000u, 250001u })
+	{
+		std::vector<int32> values = CreateSortingInput(count, 1000000, count);
+		std::vector<int32> expected = SortedCopy(values);
+
+		Sorting::ParallelSort(values.data(), (int32)values.size());
+		EXPECT_EQ(VectorEquals(values, expected), true);
+	}
+}
+
+TEST(TEST_CATEGORY, ParallelSortInsidePoolJobs)
+{
+	// More jobs than workers, so the chunks of every sort are queued behind the other sorts
+	const uint32 jobCount = ThreadPool::Get().GetThreadCount() * 2 + 2;
+	std::vector<std::vector<int32>> inputs(jobCount);
+	for (uint32 job = 0; job < jobCount; ++job)
+		inputs[job] = CreateSortingInput(100000, 1000000, job);
+
+	std::atomic<uint32> sorted = 0;
+	for (uint32 job = 0; job < jobCount; ++job)
+	{
+		ThreadPool::Get().Submit([&, job]()
+		{
+			std::vector<int32> &values = inputs[job];
+			Sorting::ParallelSort(values.data(), (int32)values.size());
+			if (std::is_sorted(values.begin(), values.end()))
+				sorted.fetch_add(1);
+		});
+	}
+
+	ThreadPool::Get().Wait();
+	EXPECT_EQ(sorted.load(), jobCount);
+}
+
@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added tests for the array growth
 //     - 1.0 (2021-11-18) initial release
 //
 
@@ -66,3 +67,31 @@ TEST_F(StackTests, Clear)
 	EXPECT_EQ(Stack.IsEmpty(), true);
 }
 
+TEST_F(StackTests, Grow)
+{
+	HLStack<int32> stack;
+	for (int32 i = 0; i < 1000; ++i)
+		stack.Push(i);
+
+	EXPECT_EQ(stack.Size(), 1000u);
+	EXPECT_GE(stack.GetCapacity(), 1000u);
+
+	int32 value = 0;
+	for (int32 i = 999; i >= 0; --i)
+	{
+		EXPECT_EQ(stack.TryPop(value), true);
+		EXPECT_EQ(value, i);
+	}
+
+	EXPECT_EQ(stack.TryPop(value), false);
+}
+
+TEST_F(StackTests, PushOwnElement)
+{
+	// The pushed value references the array, that is reallocated by the push
+	for (int32 i = 0; i < 100; ++i)
+		Stack.Push(Stack.Top());
+
+	EXPECT_EQ(Stack.Size(), 102u);
+	EXPECT_EQ(StringEquals(Stack.Top(), "Test!"), true);
+}
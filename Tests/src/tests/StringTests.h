@@ -2,6 +2,8 @@
 
 //
 // version history:
+//     - 1.2 (2026-10-19) Added tests for the vectorized searches, SplitLines and the UTF-8 transcoding
+//     - 1.1 (2026-10-19) Added tests for the inline storage and the capacity growth
 //     - 1.0 (2021-11-18) initial release
 //
 
@@ -681,5 +683,185 @@ TEST(TEST_CATEGORY, GreaterOrEqualOperator)
 	EXPECT_EQ(a >= b, false);
 }
 
+TEST(TEST_CATEGORY, ShortStringIsStoredInline)
+{
+	HLString str = "Hello World!";
+	EXPECT_EQ(str.GetCapacity(), HLString::ShortStringCapacity);
+	EXPECT_EQ((const void*)str.C_Str() >= (const void*)&str && (const void*)str.C_Str() < (const void*)(&str + 1), true);
+
+	HLString copy = str;
+	EXPECT_EQ(copy.GetCapacity(), HLString::ShortStringCapacity);
+	EXPECT_EQ(StringEquals(copy, "Hello World!"), true);
+}
+
+TEST(TEST_CATEGORY, CapacityGrowsGeometrically)
+{
+	HLString str;
+	uint32 lastCapacity = str.GetCapacity();
+	uint32 reallocations = 0;
+
+	for (uint32 i = 0; i < 10000; ++i)
+	{
+		str += (char)('a' + i % 26);
+		if (str.GetCapacity() != lastCapacity)
+		{
+			lastCapacity = str.GetCapacity();
+			++reallocations;
+		}
+	}
+
+	EXPECT_EQ(str.Length(), 10000u);
+	EXPECT_EQ(str[9999], 'a' + 9999 % 26);
+	EXPECT_EQ(reallocations < 25, true);
+}
+
+TEST(TEST_CATEGORY, ClearKeepsCapacity)
+{
+	HLString str = "This string is too long to be stored inline";
+	uint32 capacity = str.GetCapacity();
+
+	str.Clear();
+	EXPECT_EQ(str.IsEmpty(), true);
+	EXPECT_EQ(str.GetCapacity(), capacity);
+
+	str.Reserve(1024);
+	EXPECT_EQ(str.GetCapacity(), 1024u);
+}
+
+TEST(TEST_CATEGORY, AppendToItself)
+{
+	HLString shortStr = "abc";
+	shortStr.Append(shortStr);
+	EXPECT_EQ(StringEquals(shortStr, "abcabc"), true);
+
+	HLString longStr = "abcdefghijklmnopqrstuvwxyz";
+	longStr.Append(longStr);
+	EXPECT_EQ(StringEquals(longStr, "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz"), true);
+
+	longStr.Assign(longStr.C_Str(), 52, 26);
+	EXPECT_EQ(StringEquals(longStr, "abcdefghijklmnopqrstuvwxyz"), true);
+}
+
+TEST(TEST_CATEGORY, MoveLeavesEmptyString)
+{
+	HLString a = "This string is too long to be stored inline";
+	const char *data = a.C_Str();
+
+	HLString b = std::move(a);
+	EXPECT_EQ(b.C_Str(), data);
+	EXPECT_EQ(a.IsEmpty(), true);
+	EXPECT_EQ(StringEquals(a, ""), true);
+
+	a = "Reusable";
+	EXPECT_EQ(StringEquals(a, "Reusable"), true);
+}
+
+TEST(TEST_CATEGORY, LongStringSearch)
+{
+	HLString str = "The quick brown fox jumps over the lazy dog, the quick brown fox";
+
+	EXPECT_EQ(str.IndexOf("quick"), 4u);
+	EXPECT_EQ(str.IndexOf("quick", 5), 49u);
+	EXPECT_EQ(str.LastIndexOf("fox"), 61u);
+	EXPECT_EQ(str.IndexOf("cat"), HLString::NPOS);
+	EXPECT_EQ(str.StartsWith("The quick"), true);
+	EXPECT_EQ(str.EndsWith("brown fox"), true);
+	EXPECT_EQ(str.EndsWith("The quick brown fox jumps over the lazy dog, the quick brown fox!"), false);
+
+	str.Replace("quick", "slow");
+	EXPECT_EQ(StringEquals(str, "The slow brown fox jumps over the lazy dog, the slow brown fox"), true);
+}
+
+TEST(TEST_CATEGORY, SearchAcrossBlocks)
+{
+	// Matches at every position of a 32 byte block and in the remaining bytes after the last full block
+	for (uint32 position = 0; position < 100; ++position)
+	{
+		HLString str;
+		str.Resize(101);
+		for (uint32 i = 0; i < str.Length(); ++i)
+			str[i] = 'a' + (char)(i % 3);
+
+		str[position] = 'x';
+		str[position + 1] = 'y';
+
+		EXPECT_EQ(str.IndexOf("xy"), position);
+		EXPECT_EQ(str.IndexOf("xyz"), HLString::NPOS);
+		EXPECT_EQ(str.IndexOfAny("zyx"), position);
+		EXPECT_EQ(str.CountOf('x'), 1u);
+	}
+
+	HLString text = "uniform sampler2D u_Texture; uniform vec4 u_Color; uniform float u_Time;";
+	EXPECT_EQ(text.IndexOf("uniform float"), 51u);
+	EXPECT_EQ(text.IndexOf("uniform", 1), 29u);
+	EXPECT_EQ(text.CountOf(';'), 3u);
+	EXPECT_EQ(text.IndexOfAny(";:", 30), 49u);
+	EXPECT_EQ(text.IndexOfAny(""), HLString::NPOS);
+}
+
+TEST(TEST_CATEGORY, CaseConversionKeepsUTF8)
+{
+	HLString str = "Assets/Textures/Grüne Wiese/ÄPFEL_und_Birnen_0123456789.PNG";
+	HLString lower = str;
+	lower.ToLowerCase();
+	EXPECT_EQ(StringEquals(lower, "assets/textures/grüne wiese/Äpfel_und_birnen_0123456789.png"), true);
+
+	lower.ToUpperCase();
+	EXPECT_EQ(StringEquals(lower, "ASSETS/TEXTURES/GRüNE WIESE/ÄPFEL_UND_BIRNEN_0123456789.PNG"), true);
+}
+
+TEST(TEST_CATEGORY, SplitLines)
+{
+	HLString source = "#version 450\r\n\nlayout(location = 0) in vec3 a_Position;\rvoid main()\n";
+	std::vector<HLString> lines = source.SplitLines();
+
+	ASSERT_EQ(lines.size(), 4u);
+	EXPECT_EQ(StringEquals(lines[0], "#version 450"), true);
+	EXPECT_EQ(lines[1].IsEmpty(), true);
+	EXPECT_EQ(StringEquals(lines[2], "layout(location = 0) in vec3 a_Position;"), true);
+	EXPECT_EQ(StringEquals(lines[3], "void main()"), true);
+
+	HLString words = "a,b,,c";
+	std::vector<HLString> parts = words.Split(',');
+	ASSERT_EQ(parts.size(), 4u);
+	EXPECT_EQ(StringEquals(parts[1], "b"), true);
+	EXPECT_EQ(parts[2].IsEmpty(), true);
+	EXPECT_EQ(StringEquals(parts[3], "c"), true);
+}
+
+TEST(TEST_CATEGORY, UTF8Validation)
+{
+	EXPECT_EQ(HLStringUTF8::IsValid("Plain ASCII text, that is longer than one block of bytes"), true);
+	EXPECT_EQ(HLStringUTF8::IsValid("Grüße aus Köln, 日本語 und 😀 in einem längeren Text"), true);
+
+	EXPECT_EQ(HLStringUTF8::IsValid("Overlong \xC0\xAF slash"), false);
+	EXPECT_EQ(HLStringUTF8::IsValid("Surrogate \xED\xA0\x80 in UTF-8"), false);
+	EXPECT_EQ(HLStringUTF8::IsValid("After U+10FFFF \xF4\x90\x80\x80"), false);
+	EXPECT_EQ(HLStringUTF8::IsValid("Truncated sequence at the end of the string \xE6\x97"), false);
+	EXPECT_EQ(HLStringUTF8::IsValid("Lone continuation byte \x80 in the middle"), false);
+}
+
+TEST(TEST_CATEGORY, UTF8Transcoding)
+{
+	HLString text = "Grüße aus Köln: 日本語 und 😀, das ist ein längerer Text mit mehr als sechzehn Zeichen";
+
+	HLString16 utf16 = HLStringUTF8::ToUTF16(text);
+	EXPECT_EQ(utf16[2], (char16_t)0xFC);
+	EXPECT_EQ(utf16.IndexOf((char16_t)0x65E5), 16u);
+	EXPECT_EQ(utf16[24], (char16_t)0xD83D);
+	EXPECT_EQ(utf16[25], (char16_t)0xDE00);
+
+	HLString32 utf32 = HLStringUTF8::ToUTF32(text);
+	EXPECT_EQ(utf32[24], (char32_t)0x1F600);
+	EXPECT_EQ(utf32.Length(), utf16.Length() - 1);
+
+	EXPECT_EQ(StringEquals(HLStringUTF8::FromUTF16(utf16), text), true);
+	EXPECT_EQ(StringEquals(HLStringUTF8::FromUTF32(utf32), text), true);
+
+	const char16_t unpairedSurrogate[] = { 'a', 0xD800, 'b', 0 };
+	EXPECT_EQ(HLStringUTF8::FromUTF16(unpairedSurrogate).IsEmpty(), true);
+	EXPECT_EQ(HLStringUTF8::ToUTF16("\xFF").IsEmpty(), true);
+}
+
 // TOOD: Add Matrix/Vectors ToString checks
 
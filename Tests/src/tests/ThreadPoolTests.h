@@ -0,0 +1,97 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY ThreadPoolTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace highlo;
+
+TEST(TEST_CATEGORY, ParallelForCoversRange)
+{
+	ThreadPool pool(3);
+
+	std::vector<uint32> hits(10000, 0);
+	pool.ParallelFor((uint32)hits.size(), 64, [&](uint32 begin, uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+			++hits[i];
+	});
+
+	for (uint32 hit : hits)
+		ASSERT_EQ(hit, 1);
+}
+
+TEST(TEST_CATEGORY, ParallelForDoesNotWaitForQueuedHelpers)
+{
+	ThreadPool pool(1);
+
+	// The only worker is blocked, so the helper jobs of the loop can not start until the loop has returned
+	std::atomic<bool> release = false;
+	pool.Submit([&]()
+	{
+		while (!release.load())
+			std::this_thread::yield();
+	});
+
+	std::atomic<uint32> sum = 0;
+	pool.ParallelFor(100, 1, [&](uint32 begin, uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+			sum.fetch_add(i);
+	});
+
+	EXPECT_EQ(sum.load(), 4950);
+
+	release = true;
+	pool.Wait();
+}
+
+TEST(TEST_CATEGORY, NestedParallelForInsideJobs)
+{
+	ThreadPool pool(2);
+
+	// More outer jobs than workers, so every worker runs a ParallelFor, whose helpers are queued behind the other outer jobs
+	const uint32 jobCount = 8;
+	std::atomic<uint32> sum = 0;
+	for (uint32 job = 0; job < jobCount; ++job)
+	{
+		pool.Submit([&]()
+		{
+			pool.ParallelFor(1000, 10, [&](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; ++i)
+					sum.fetch_add(1);
+			});
+		});
+	}
+
+	pool.Wait();
+	EXPECT_EQ(sum.load(), jobCount * 1000);
+
+	// A ParallelFor, whose batches run nested loops themselves
+	std::atomic<uint32> innerSum = 0;
+	pool.ParallelFor(16, 1, [&](uint32 begin, uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+		{
+			pool.ParallelFor(100, 4, [&](uint32 innerBegin, uint32 innerEnd)
+			{
+				innerSum.fetch_add(innerEnd - innerBegin);
+			});
+		}
+	});
+
+	pool.Wait();
+	EXPECT_EQ(innerSum.load(), 1600);
+}
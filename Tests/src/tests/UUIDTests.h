@@ -0,0 +1,127 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+//
+// version history:
+//     - 1.1 (2026-10-19) Required time-ordered UUIDs to increase strictly, also across threads
+//     - 1.0 (2026-10-19) initial release
+//
+
+#pragma once
+
+#undef TEST_CATEGORY
+#define TEST_CATEGORY UUIDTests
+
+#include <HighLo.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+
+#include "TestUtils.h"
+
+using namespace highlo;
+
+TEST(TEST_CATEGORY, UniqueAcrossThreads)
+{
+	const uint32 threadCount = 4;
+	const uint32 uuidsPerThread = 50000;
+
+	std::vector<std::vector<uint64>> uuids(threadCount);
+	std::vector<std::thread> threads;
+	for (uint32 t = 0; t < threadCount; ++t)
+	{
+		threads.emplace_back([&uuids, t]()
+		{
+			uuids[t].reserve(uuidsPerThread);
+			for (uint32 i = 0; i < uuidsPerThread; ++i)
+				uuids[t].push_back(UUID());
+		});
+	}
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	std::unordered_set<uint64> unique;
+	for (const std::vector<uint64> &list : uuids)
+		unique.insert(list.begin(), list.end());
+
+	EXPECT_EQ(unique.size(), (size_t)(threadCount * uuidsPerThread));
+}
+
+TEST(TEST_CATEGORY, TimeOrdered)
+{
+	UUID::SetGenerationMode(UUIDGenerationMode::TimeOrdered);
+	EXPECT_EQ(UUID::GetGenerationMode(), UUIDGenerationMode::TimeOrdered);
+
+	// Far more UUIDs than fit into the sequence of a single millisecond, so the overflow into the timestamp is covered as well
+	const uint32 uuidCount = 1u << 23;
+	uint64 previous = UUID();
+	uint32 decreasing = 0;
+	for (uint32 i = 0; i < uuidCount; ++i)
+	{
+		uint64 uuid = UUID();
+		if (uuid <= previous)
+			++decreasing;
+
+		previous = uuid;
+	}
+
+	UUID::SetGenerationMode(UUIDGenerationMode::Random);
+	EXPECT_EQ(decreasing, 0u);
+}
+
+TEST(TEST_CATEGORY, TimeOrderedUniqueAcrossThreads)
+{
+	UUID::SetGenerationMode(UUIDGenerationMode::TimeOrdered);
+
+	const uint32 threadCount = 4;
+	const uint32 uuidsPerThread = 50000;
+
+	std::vector<std::vector<uint64>> uuids(threadCount);
+	std::vector<std::thread> threads;
+	for (uint32 t = 0; t < threadCount; ++t)
+	{
+		threads.emplace_back([&uuids, t]()
+		{
+			uuids[t].reserve(uuidsPerThread);
+			for (uint32 i = 0; i < uuidsPerThread; ++i)
+				uuids[t].push_back(UUID());
+		});
+	}
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	UUID::SetGenerationMode(UUIDGenerationMode::Random);
+
+	std::unordered_set<uint64> unique;
+	for (const std::vector<uint64> &list : uuids)
+	{
+		unique.insert(list.begin(), list.end());
+
+		// Every thread sees its own UUIDs in increasing order
+		EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+	}
+
+	EXPECT_EQ(unique.size(), (size_t)(threadCount * uuidsPerThread));
+}
+
+TEST(TEST_CATEGORY, HashSpreadsSimilarUUIDs)
+{
+	// UUIDs, that only differ in their upper bits, like time-ordered UUIDs, still land in different buckets
+	const uint32 bucketCount = 64;
+	std::vector<uint32> buckets(bucketCount, 0);
+	for (uint64 i = 0; i < 1024; ++i)
+		++buckets[std::hash<UUID>()(UUID(i << 22)) % bucketCount];
+
+	for (uint32 count : buckets)
+	{
+		EXPECT_GT(count, 0u);
+		EXPECT_LT(count, 48u);
+	}
+
+	EXPECT_NE(std::hash<UUID>()(UUID(1)), std::hash<UUID>()(UUID(2)));
+	EXPECT_NE(std::hash<UUID32>()(UUID32(1)), std::hash<UUID32>()(UUID32(2)));
+}
+
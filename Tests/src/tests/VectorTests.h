@@ -2,6 +2,7 @@
 
 //
 // version history:
+//     - 1.1 (2026-10-19) Added tests for HLSmallVector, container allocators and element lifetimes
 //     - 1.0 (2021-11-18) initial release
 //
 
@@ -115,3 +116,117 @@ TEST_F(VectorTests, GetByArrayIndexOperator)
 	EXPECT_EQ(StringEquals(Vector[3], "lol!"), true);
 }
 
+/// <summary>
+/// Counts the living instances, to find elements that are never destroyed or destroyed twice.
+/// </summary>
+struct VectorTestsTracked
+{
+	static inline int32 s_Alive = 0;
+	int32 Value;
+
+	VectorTestsTracked(int32 value) : Value(value) { ++s_Alive; }
+	VectorTestsTracked(const VectorTestsTracked &other) : Value(other.Value) { ++s_Alive; }
+	VectorTestsTracked(VectorTestsTracked &&other) noexcept : Value(other.Value) { ++s_Alive; }
+	VectorTestsTracked &operator=(const VectorTestsTracked &other) = default;
+	VectorTestsTracked &operator=(VectorTestsTracked &&other) noexcept = default;
+	~VectorTestsTracked() { --s_Alive; }
+};
+
+TEST_F(VectorTests, ElementLifetimes)
+{
+	{
+		HLVector<VectorTestsTracked> vector;
+		for (int32 i = 0; i < 100; ++i)
+			vector.EmplaceBack(i);
+
+		EXPECT_EQ(VectorTestsTracked::s_Alive, 100);
+
+		vector.Remove(10);
+		vector.RemoveUnordered(0);
+		vector.PopBack();
+		EXPECT_EQ(VectorTestsTracked::s_Alive, 97);
+		EXPECT_EQ(vector[0].Value, 99);
+		EXPECT_EQ(vector[10].Value, 11);
+
+		HLVector<VectorTestsTracked> copy = vector;
+		EXPECT_EQ(VectorTestsTracked::s_Alive, 194);
+
+		HLVector<VectorTestsTracked> moved = std::move(copy);
+		EXPECT_EQ(VectorTestsTracked::s_Alive, 194);
+		EXPECT_EQ(copy.IsEmpty(), true);
+	}
+
+	EXPECT_EQ(VectorTestsTracked::s_Alive, 0);
+}
+
+TEST_F(VectorTests, PushOwnElement)
+{
+	// The pushed value references the storage, that is reallocated by the push
+	while (Vector.Size() < 100)
+		Vector.PushBack(Vector[0]);
+
+	for (uint32 i = 5; i < Vector.Size(); ++i)
+		EXPECT_EQ(StringEquals(Vector[i], "Hello World!"), true);
+}
+
+TEST_F(VectorTests, SmallVectorUsesInlineStorage)
+{
+	HLSmallVector<HLString, 4> vector;
+	EXPECT_EQ(vector.Capacity(), 4);
+	EXPECT_EQ(vector.IsUsingInlineStorage(), true);
+
+	for (uint32 i = 0; i < 4; ++i)
+		vector.PushBack(HLString::ToString(i));
+
+	EXPECT_EQ(vector.IsUsingInlineStorage(), true);
+
+	vector.PushBack("4");
+	EXPECT_EQ(vector.IsUsingInlineStorage(), false);
+	EXPECT_GE(vector.Capacity(), 5u);
+
+	for (uint32 i = 0; i < 5; ++i)
+		EXPECT_EQ(StringEquals(vector[i], HLString::ToString(i)), true);
+
+	// Shrinking moves the elements back into the vector
+	vector.Resize(2);
+	EXPECT_EQ(vector.IsUsingInlineStorage(), true);
+	EXPECT_EQ(vector.Capacity(), 4);
+	EXPECT_EQ(StringEquals(vector[1], "1"), true);
+}
+
+TEST_F(VectorTests, SmallVectorMove)
+{
+	HLSmallVector<HLString, 4> small = { "a", "b" };
+	HLSmallVector<HLString, 4> movedSmall = std::move(small);
+	EXPECT_EQ(movedSmall.Size(), 2);
+	EXPECT_EQ(movedSmall.IsUsingInlineStorage(), true);
+	EXPECT_EQ(StringEquals(movedSmall[1], "b"), true);
+	EXPECT_EQ(small.IsEmpty(), true);
+
+	HLSmallVector<HLString, 4> large = { "a", "b", "c", "d", "e", "f" };
+	const HLString *largeData = large.Data();
+	HLSmallVector<HLString, 4> movedLarge;
+	movedLarge = std::move(large);
+	EXPECT_EQ(movedLarge.Data(), largeData);
+	EXPECT_EQ(StringEquals(movedLarge.Back(), "f"), true);
+	EXPECT_EQ(large.IsUsingInlineStorage(), true);
+}
+
+TEST_F(VectorTests, LinearContainerAllocator)
+{
+	LinearAllocator arena;
+	arena.Init(4096);
+
+	{
+		HLVector<uint64, LinearContainerAllocator> vector((LinearContainerAllocator(&arena)));
+		vector.Reserve(64);
+		for (uint64 i = 0; i < 64; ++i)
+			vector.PushBack(i * i);
+
+		EXPECT_EQ(vector.Size(), 64);
+		EXPECT_EQ(vector[63], 63u * 63u);
+		EXPECT_EQ((uint64)vector.Data() % alignof(uint64), 0u);
+	}
+
+	arena.Shutdown();
+}
@@ -0,0 +1,160 @@
+project "HighLoPak"
+    kind "ConsoleApp"
+    language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+	entrypoint "mainCRTStartup"
+
+    targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+    debugdir ("bin/" .. outputdir .. "/%{prj.name}")
+    objdir ("bin-obj/" .. outputdir .. "/%{prj.name}")
+	buildoptions{"/bigobj"}
+
+    files
+    { 
+        "src/**.h",
+        "src/**.cpp"
+    }
+
+    includedirs
+    {
+		"src",
+		"../../HighLo/src",
+		"%{IncludeDir.spdlog}",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.assimp}",
+		"%{IncludeDir.IconFontCppHeaders}",
+    }
+
+    links
+    {
+        "HighLo",
+    }
+	
+	postbuildcommands
+	{
+		("{COPY} %{wks.location}HighLo/vendor/openssl/lib/libcrypto-3-x64.dll %{wks.location}Tools/HighLoPak/bin/" .. outputdir .. "/HighLoPak/libcrypto-3-x64.dll*"),
+		("{COPY} %{wks.location}HighLo/vendor/openssl/lib/libssl-3-x64.dll %{wks.location}Tools/HighLoPak/bin/" .. outputdir .. "/HighLoPak/libssl-3-x64.dll*"),
+	}
+
+    filter "system:windows"
+        systemversion "latest"
+        disablewarnings { "5033", "4996", "4217", "4006" }
+
+        defines
+        {
+            "HL_PLATFORM_WINDOWS"
+        }
+
+	filter "system:linux"
+		systemversion "latest"
+		
+		defines
+		{
+			"HL_PLATFORM_LINUX"
+		}
+
+	filter "system:macos"
+		systemversion "latest"
+		
+		defines
+		{
+			"HL_PLATFORM_MACOS"
+		}
+
+    filter "configurations:Debug-OpenGL"
+        defines "HL_DEBUG"
+        symbols "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Debug/assimp-vc142-mtd.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
+		}
+
+	filter "configurations:Debug-Vulkan"
+        defines "HL_DEBUG"
+        symbols "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Debug/assimp-vc142-mtd.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
+		}
+
+	filter "configurations:Debug-DX11"
+        defines "HL_DEBUG"
+        symbols "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Debug/assimp-vc142-mtd.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
+		}
+
+	filter "configurations:Debug-DX12"
+        defines "HL_DEBUG"
+        symbols "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Debug/assimp-vc142-mtd.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
+		}
+
+	filter "configurations:Debug-Metal"
+        defines "HL_DEBUG"
+        symbols "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Debug/assimp-vc142-mtd.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
+		}
+
+    filter "configurations:Release-OpenGL"
+        defines "HL_RELEASE"
+        optimize "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Release/assimp-vc142-mt.dll" "%{cfg.targetdir}"',
+		}
+
+	filter "configurations:Release-Vulkan"
+        defines "HL_RELEASE"
+        optimize "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Release/assimp-vc142-mt.dll" "%{cfg.targetdir}"',
+		}
+
+	filter "configurations:Release-DX11"
+        defines "HL_RELEASE"
+        optimize "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Release/assimp-vc142-mt.dll" "%{cfg.targetdir}"',
+		}
+
+	filter "configurations:Release-DX12"
+        defines "HL_RELEASE"
+        optimize "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Release/assimp-vc142-mt.dll" "%{cfg.targetdir}"',
+		}
+
+	filter "configurations:Release-Metal"
+        defines "HL_RELEASE"
+        optimize "On"
+
+		postbuildcommands
+		{
+			'{COPY} "%{wks.location}HighLo/vendor/assimp/lib/Release/assimp-vc142-mt.dll" "%{cfg.targetdir}"',
+		}
+		
+		
\ No newline at end of file
@@ -0,0 +1,118 @@
+// Copyright (c) 2021-2023 Can Karka and Albert Slepak. All rights reserved.
+
+#include <HighLo.h>
+#include <iomanip>
+
+using namespace highlo;
+
+static void PrintUsage()
+{
+	std::cout << "Usage: HighLoPak <input directory> <output archive> [options]" << std::endl;
+	std::cout << "       HighLoPak --list <archive>" << std::endl;
+	std::cout << std::endl;
+	std::cout << "Options:" << std::endl;
+	std::cout << "    --compression <none|lz4>     The compression of the entries (default: lz4)" << std::endl;
+	std::cout << "    --alignment <bytes>          The alignment of every entry, has to be a power of two (default: " << HL_PAK_DEFAULT_ALIGNMENT << ")" << std::endl;
+	std::cout << "    --store <.ext>               Stores files with the extension uncompressed, can be repeated" << std::endl;
+	std::cout << "    --prefix <path>              Prepends the path to all paths inside of the archive" << std::endl;
+}
+
+static int32 ListArchive(const FileSystemPath &archivePath)
+{
+	Ref<PakArchive> archive = PakArchive::Open(archivePath);
+	if (!archive)
+		return 1;
+
+	for (uint32 i = 0; i < archive->GetEntryCount(); ++i)
+	{
+		const PakEntry &entry = archive->GetEntry(i);
+		std::cout << std::setw(12) << entry.Size << std::setw(12) << entry.CompressedSize << "  "
+			<< std::setw(4) << Compression::GetName(entry.Compression) << "  " << *archive->GetEntryPath(i) << std::endl;
+	}
+
+	std::cout << archive->GetEntryCount() << " entries" << std::endl;
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	Logger::Init();
+
+	if (argc == 3 && strcmp(argv[1], "--list") == 0)
+	{
+		int32 result = ListArchive(argv[2]);
+		Logger::Shutdown();
+		return result;
+	}
+
+	if (argc < 3)
+	{
+		PrintUsage();
+		Logger::Shutdown();
+		return 1;
+	}
+
+	FileSystemPath inputDirectory = argv[1];
+	FileSystemPath outputPath = argv[2];
+	HLString prefix;
+	PakWriteOptions options;
+
+	for (int32 i = 3; i < argc; ++i)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--compression") == 0 && hasValue)
+		{
+			HLString compression = argv[++i];
+			if (compression == "none")
+				options.Compression = CompressionType::None;
+			else if (compression == "lz4")
+				options.Compression = CompressionType::LZ4;
+			else
+				hasValue = false;
+		}
+		else if (strcmp(argv[i], "--alignment") == 0 && hasValue)
+		{
+			options.Alignment = HLString(argv[++i]).ToUInt32();
+		}
+		else if (strcmp(argv[i], "--store") == 0 && hasValue)
+		{
+			options.UncompressedExtensions.push_back(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--prefix") == 0 && hasValue)
+		{
+			prefix = argv[++i];
+		}
+		else
+		{
+			hasValue = false;
+		}
+
+		if (!hasValue)
+		{
+			std::cout << "Unknown or incomplete option " << argv[i] << std::endl;
+			PrintUsage();
+			Logger::Shutdown();
+			return 1;
+		}
+	}
+
+	PakWriter writer;
+	if (writer.AddDirectory(inputDirectory, prefix) == 0)
+	{
+		std::cout << "No files found in " << *inputDirectory.String() << std::endl;
+		Logger::Shutdown();
+		return 1;
+	}
+
+	PakWriteStats stats;
+	bool success = writer.Write(outputPath, options, &stats);
+	if (success)
+	{
+		std::cout << "Packed " << stats.EntryCount << " files (" << stats.CompressedEntryCount << " compressed) into "
+			<< *outputPath.String() << ": " << stats.ArchiveSize / 1024 << " KB of " << stats.UncompressedSize / 1024 << " KB" << std::endl;
+	}
+
+	Logger::Shutdown();
+	return success ? 0 : 1;
+}
+
@@ -11,6 +11,13 @@ newoption {
 	value = "True"
 }
 
+newoption {
+	trigger = "generate-benchmarks",
+	description = "Generate the benchmarks",
+	default = "False",
+	value = "True"
+}
+
 newoption {
 	trigger = "project-dir",
 	description = "Describes the path to the script folder. The script folder is either provided by the engine when the user interacts with the editor or by the user, when he uses the GenerateEngine.py script",
@@ -70,10 +77,18 @@ workspace "HighLo"
 			include "Tests"
 		group ""
 	end
+
+	if _OPTIONS['generate-benchmarks'] == "True" then
+		print('generating the benchmarks...')
+		group "benchmarks"
+			include "Benchmark"
+		group ""
+	end
 	
 	group "Tools"
 		include "Sandbox"
 		include "HighLoEdit"
+		include "Tools/HighLoPak"
 	group ""
 	
 	group "Games"